@@ -11,6 +11,8 @@
 #include <locale>      // std::isspace
 #include <memory>
 #include <string.h>
+#include <wordexp.h>   // for ResolvePath
+#include <climits>     // PATH_MAX
 //#include <exception>
 //#include <cstring>  // strncpy
 #include <fstream>
@@ -79,6 +81,19 @@ int ReadListFromFile(std::string filename, std::vector<std::string> &lines, char
 	return lines.size();
 }
 
+std::string ResolvePath(std::string path){
+	// expand '~' and environmental variables, but do not run commands
+	wordexp_t expansion;
+	if(wordexp(path.c_str(), &expansion, WRDE_NOCMD)==0){
+		if(expansion.we_wordc>0) path = expansion.we_wordv[0];
+		wordfree(&expansion);
+	}
+	// then make absolute and resolve symlinks. Paths that do not exist are returned as expanded.
+	char resolved[PATH_MAX];
+	if(realpath(path.c_str(), resolved)!=nullptr) path = resolved;
+	return path;
+}
+
 std::string GetStdoutFromCommand(std::string cmd, int bufsize){
 	/*
 	  credit: Jeremy Morgan, source:
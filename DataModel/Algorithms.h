@@ -26,6 +26,7 @@ class TH1F;
 
 int ReadListFromFile(std::string filename, std::vector<std::string> &lines, char commentchar='#', bool trim_whitespace=true);
 std::string GetStdoutFromCommand(std::string cmd, int bufsize=500);
+std::string ResolvePath(std::string path);  // expand environmental variables and symlinks, as 'readlink -f'
 int SystemCall(std::string cmd, std::string& errmsg);  // or use this one, maybe better?
 void SetRootColourPlotStyle();
 double MomentumToEnergy(basic_array<float[3]>& mom, int pdg);
@@ -93,9 +93,8 @@ std::string PdgToString(int code){
 		const TParticlePDG* particle = pdgdb->GetParticle(code);
 		if(particle!=nullptr) return particle->GetName();
 	}
-	if(constants::pdg_to_string->count(code)!=0){
-		return constants::pdg_to_string->at(code);
-	}
+	const char* name = LookupPdgName(code);
+	if(name!=nullptr) return name;
 	return std::to_string(code);
 }
 
@@ -149,10 +148,9 @@ double PdgToMass(int code){
 	// nuclei aren't in the particle database. To first order we can assume
 	// the mass of the nucleus is the sum of masses of nucleons
 	// pdg codes for nucleons are 10-digit numbers ±10LZZZAAAI, giving us Z and A
-	std::string pdgasstring = std::to_string(code);
-	if(pdgasstring.length()==10){
-		int nprotons = std::stoi(pdgasstring.substr(3,3));
-		int nnucleons = std::stoi(pdgasstring.substr(6,3));
+	if(code>=1000000000){
+		int nprotons = (code/10000)%1000;
+		int nnucleons = (code/10)%1000;
 		int nneutrons = nnucleons-nprotons;
 		static const double protonmass = pdgdb->GetParticle(2212)->Mass()*1000.;
 		static const double neutronmass = pdgdb->GetParticle(2112)->Mass()*1000.;
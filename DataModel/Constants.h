@@ -7,7 +7,6 @@
 #include <map>
 #include <sstream>
 #include <unordered_map>
-#include <unordered_map>
 #include "TInterpreter.h" // TInterpreter::EErrorCode
 #include "TDatabasePDG.h"
 //#include <regex>    // std::regex doesn't work for older g++ versions
@@ -52,7 +51,7 @@ std::string TriggerIDToName(int code);
 std::string GetTriggerNames(int32_t trigid);
 int TriggerNameToID(std::string trigname);
 int GetTriggerThreshold(int trigbit);
-const std::unordered_map<int,std::string>* const GetParticleNameMap();
+const char* LookupPdgName(int code);  // from our own table (pdg_to_name_nuclei.cpp); nullptr if not found
 
 enum class SKROOTMODE : int { NONE = 4, ZEBRA = 3, READ = 2, WRITE = 1, COPY = 0 };
 
@@ -200,10 +199,13 @@ namespace constants{
 	constexpr int BSTORE_ASCII_FORMAT = 1;
 	constexpr int BSTORE_MULTIEVENT_FORMAT = 2;
 	
+	// the tables below are inline rather than static, so there is one copy of each in the program
+	// rather than one built at startup by every translation unit that includes this header.
+	
 	// https://root.cern.ch/root/html532/src/TDatabasePDG.cxx.html
 	// https://root.cern/doc/v608/classTDatabasePDG.html
 
-  static const std::map<int, std::string> Interaction_Mode_To_String{
+  inline const std::map<int, std::string> Interaction_Mode_To_String{
     // find more info at $ATMPD_ROOT/src/analysis/official_ntuple/description.ntuple
     {0, "mode = 0"},
     //  the NEUTRINO modes
@@ -321,7 +323,7 @@ namespace constants{
     {-52, "NC : ELASTIC : NEUBAR,N --> NEUBAR,N"}    
   };
   
-	static const std::map<int,std::string> G3_process_code_to_string{
+	inline const std::map<int,std::string> G3_process_code_to_string{
 		// full list from Geant3 manual page 445
 		// see p420+ for a full list of Geant3 common blocks and their parameters
 		{1, "Volume Boundary"},
@@ -366,7 +368,7 @@ namespace constants{
 	};
 	
 	// from skheadC.h
-	static const std::map<int,std::string> mdrnsk_to_runtype{
+	inline const std::map<int,std::string> mdrnsk_to_runtype{
 		{0,"Monte Carlo"},
 		{1,"Normal Data"},
 		{2,"Laser Calibration"},
@@ -377,7 +379,7 @@ namespace constants{
 		{7,"Linac Calibration"}
 	};
 	
-	static const std::map<int,std::string> G4_process_code_to_string{
+	inline const std::map<int,std::string> G4_process_code_to_string{
 		{1,"CoulombScat"},
 		{2,"Ionisation"},
 		{3,"Brems"},
@@ -440,7 +442,7 @@ namespace constants{
 	};
 	
 	// from skdetsim source file 'gt2pd.h'
-	static const std::map<int,std::string> g3_particle_code_to_string{
+	inline const std::map<int,std::string> g3_particle_code_to_string{
 		{1,"Gamma"},
 		{2,"Positron"},
 		{3,"Electron"},
@@ -494,7 +496,7 @@ namespace constants{
 		{69,"O16"}
 	};
 	
-	static const std::map<std::string,int> string_to_g3_particle_code{
+	inline const std::map<std::string,int> string_to_g3_particle_code{
 		{"Gamma",1},
 		{"Positron",2},
 		{"Electron",3},
@@ -548,7 +550,7 @@ namespace constants{
 		{"O16",69}
 	};
 	
-	static const std::map<int,int> g3_particle_code_to_pdg{
+	inline const std::map<int,int> g3_particle_code_to_pdg{
 		// from https://root.cern.ch/root/html532/src/TDatabasePDG.cxx.html#228
 		// or use Int_t TDatabasePDG::ConvertGeant3ToPdg(Int_t Geant3number)
 		{1,22},        // photon
@@ -614,7 +616,7 @@ namespace constants{
 		// "what are the g3 codes for gadolinium nuclei?" - there are none! no Gd nucleus is saved.
 	};
 	
-	static const std::map<int,int> pdg_to_g3_particle_code{
+	inline const std::map<int,int> pdg_to_g3_particle_code{
 		// from https://root.cern.ch/root/html532/src/TDatabasePDG.cxx.html#228
 		// or use Int_t TDatabasePDG::ConvertPdgToGeant3(Int_t pdgNumber)
 		{22,1},        // photon
@@ -682,7 +684,7 @@ namespace constants{
 		{1000080160,69}   // 16O
 	};
 	
-	static const std::map<int,std::string> numnu_code_to_string{
+	inline const std::map<int,std::string> numnu_code_to_string{
 		{1,"is_neutrino"},   // initial state (incident) neutrino
 		{2,"is_target"},     // initial state (struck) target
 		{3,"fs_lepton"},     // final state (outgoing) target
@@ -690,7 +692,7 @@ namespace constants{
 		{5,"fs_other"}       // final state (outgoing) other particle (codes 5 and up)
 	};
 	
-	static const std::map<int,std::string> neut_mode_to_string{
+	inline const std::map<int,std::string> neut_mode_to_string{
 		{1, "CC quasi-elastic"},
 		{11, "CC single pi from delta resonance"},
 		{12, "CC single pi from delta resonance"},
@@ -709,7 +711,7 @@ namespace constants{
 		{52, "NC elastic"}
 	};
 	
-	static const std::map<muboy_class,std::string> muboy_class_to_name{
+	inline const std::map<muboy_class,std::string> muboy_class_to_name{
 		{muboy_class::misfit,"misfit"},
 		{muboy_class::single_thru_going,"single_thru_going"},
 		{muboy_class::single_stopping,"single_stopping"},
@@ -718,7 +720,7 @@ namespace constants{
 		{muboy_class::corner_clipper,"corner_clipper"}
 	};
 	
-	static const std::map<std::string,muboy_class> muboy_name_to_class{
+	inline const std::map<std::string,muboy_class> muboy_name_to_class{
 		{"misfit",muboy_class::misfit},
 		{"single_thru_going",muboy_class::single_thru_going},
 		{"single_stopping",muboy_class::single_stopping},
@@ -727,9 +729,8 @@ namespace constants{
 		{"corner_clipper",muboy_class::corner_clipper}
 	};
 	
-	static const std::unordered_map<int,std::string>* const pdg_to_string = GetParticleNameMap();
-	/* populating this is now done in pdg_to_name_nuclei.cc, as its real big
-	static const std::map<int,std::string> pdg_to_string{
+	/* this is now a sorted table in pdg_to_name_nuclei.cpp, as its real big: see LookupPdgName
+	inline const std::map<int,std::string> pdg_to_string{
 		// FIXME use TParticlePDG for greater coverage, but need to add nuclei
 		{2212,"Proton"},
 		{-2212,"Anti Proton"},
@@ -790,7 +791,7 @@ namespace constants{
 	};
 	*/
 	
-	static const std::map<std::string,int> string_to_pdg{
+	inline const std::map<std::string,int> string_to_pdg{
 		// FIXME use TParticlePDG for greater coverage, but need to add nuclei
 		{"Proton",2212},
 		{"Anti Proton",-2212},
@@ -850,7 +851,7 @@ namespace constants{
 	// could we use this to connect daughter nuclei to their parent?
 	// we will probably need to build this decay list ourselves though.
 	
-	static const std::map<int, std::string> Trigger_ID_To_Trigger{
+	inline const std::map<int, std::string> Trigger_ID_To_Trigger{
 		// from skheadC.h
 		// "# (Unknown)" entries are empty ID numbers in skheadC.h
 		{-1, "?"},
@@ -888,7 +889,7 @@ namespace constants{
 		{31, "T2K"}       // (SW)
 	};
 	
-	static const std::map<std::string, int> Trigger_To_Trigger_ID{
+	inline const std::map<std::string, int> Trigger_To_Trigger_ID{
 		{"?", -1},
 		{"LE", 0},
 		{"HE", 1},
@@ -925,7 +926,7 @@ namespace constants{
 	};
 	
 	// obviously the following is only relevant for nhits based thresholds
-	static const std::map<int, int> default_trig_thresholds{
+	inline const std::map<int, int> default_trig_thresholds{
 		// note these are run-dependent, roughly based on the majority of SK-VI
 		{TriggerType::LE, 49},
 		{TriggerType::LE_hitsum, 49},
@@ -938,7 +939,7 @@ namespace constants{
 		{TriggerType::OD_hitsum, 0}       // TODO look these up
 	};
 	
-	static const std::map<int, std::string> flag_to_string_SKI_III{
+	inline const std::map<int, std::string> flag_to_string_SKI_III{
 		{0,"ATM"},
 		{1,"TRG"},
 		{2,"SMP REGISTER"},
@@ -973,7 +974,7 @@ namespace constants{
 		{31,"TRG IS AVAILABLE"}
 	};
 	
-	static const std::map<int, std::string> flag_to_string_SKIV{
+	inline const std::map<int, std::string> flag_to_string_SKIV{
 		{0,"QBEE TQ"},
 		{1,"HARD TRG"},
 		{2,"QBEE STAT"},
@@ -1008,7 +1009,7 @@ namespace constants{
 		{31,"(EVNT HDR)&(SOFTWARE TRG)"}
 	};
 	
-	static const std::map<std::string, int> string_to_flag_SKI_III{
+	inline const std::map<std::string, int> string_to_flag_SKI_III{
 		{"ATM", 0},
 		{"TRG", 1},
 		{"SMP_REGISTER", 2},
@@ -1043,7 +1044,7 @@ namespace constants{
 		{"TRG_IS_AVAILABLE", 31}
 	};
 	
-	static const std::map<std::string, int> string_to_flag_SKIV{
+	inline const std::map<std::string, int> string_to_flag_SKIV{
 		{"QBEE_TQ", 0},
 		{"HARD_TRG", 1},
 		{"QBEE_STAT", 2},
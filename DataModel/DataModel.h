@@ -11,6 +11,7 @@
 #include "fortran_routines.h"
 
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <string>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "BStore.h"
 #include "Logging.h"
 #include "LoggingLevels.h"
+#include "LogMacros.h"
 #include "Utilities.h"
 #include "StoreToTTree.h"
 #include "Constants.h"
@@ -43,6 +45,8 @@
 
 #include "MParticle.h"
 #include "MVertex.h"
+#include "EventArena.h"
+#include "RunConditions.h"
 
 #include "ParticleCand.h"
 #include "skroot_loweC.h"
@@ -51,6 +55,8 @@
 
 class MTreeReader;
 class TreeReader;
+class TriggerIndex;
+class NoisePool;
 class ConnectionTable;
 
 /**
@@ -91,6 +97,9 @@ class DataModel {
   Logging *Log; ///< Log class pointer for use in Tools, it can be used to send messages which can have multiple error levels and destination end points
   std::map<std::string,MTreeReader*> Trees; ///< A map of MTreeReader pointers, used to read ROOT trees
   std::map<std::string,MTreeSelection*> Selectors; ///< A map of MTreeSelection pointers used to read event selections
+  std::map<std::string,TriggerIndex*> TriggerIndices; ///< Trigger indices of the files read by TreeReaders, if loaded
+  std::map<std::string,std::shared_ptr<NoisePool>> NoisePools; ///< Decoded noise hits for AddNoise Tools, keyed by noise files and window
+  RunConditions runConditions; ///< Per-run data quality flags, livetimes and energy thresholds, from LoadRunConditions
   std::unordered_map<std::string, std::function<bool()>> hasAFTs;
   std::unordered_map<std::string, std::function<bool()>> loadSHEs;
   std::unordered_map<std::string, std::function<bool()>> loadAFTs;
@@ -149,8 +158,9 @@ class DataModel {
   EventTrueCaptures eventTrueCaptures;
   
   const TDatabasePDG* pdgdb = TDatabasePDG::Instance();
-  std::vector<MParticle> eventParticles;
-  std::vector<MVertex> eventVertices;
+  // MC truth, reset with clear() for each event but keeping the records for reuse
+  EventArena<MParticle> eventParticles;
+  EventArena<MVertex> eventVertices;
   // generalised neutron captures
   std::map<std::string,std::vector<NCaptCandidate>> NCaptureCandidates;
   std::vector<LoweCandidate> LoweCandidates;
@@ -0,0 +1,71 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef EVENT_ARENA_H
+#define EVENT_ARENA_H
+
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+// A vector-like container for per-event records, such as the MC truth particles and vertices,
+// that keeps its records alive from one event to the next. clear() only resets the number in use,
+// and each record is Reset() when it is next handed out, so once the arena has grown to the size
+// of a typical event, filling it no longer allocates: records keep their storage, including the
+// capacity of their own vectors and their BStores.
+// T must be default constructible and movable, with a Reset() that restores its default state.
+// As with std::vector, growing beyond the records made so far may invalidate references.
+template<typename T>
+class EventArena {
+
+	public:
+	typedef typename std::vector<T>::iterator iterator;
+	typedef typename std::vector<T>::const_iterator const_iterator;
+
+	size_t size() const { return n_used; }
+	bool empty() const { return n_used==0; }
+	void clear(){ n_used=0; }
+	void reserve(size_t n){ records.reserve(n); }
+	void resize(size_t n){
+		for(size_t i=n_used; i<n && i<records.size(); ++i) records[i].Reset();
+		while(records.size()<n) records.emplace_back();
+		n_used = n;
+	}
+	T& emplace_back(){
+		resize(n_used+1);
+		return records[n_used-1];
+	}
+	// release records beyond those in use, e.g. after an unusually large event
+	void shrink_to_fit(){
+		while(records.size()>n_used) records.pop_back();
+		records.shrink_to_fit();
+	}
+
+	T& at(size_t i){ CheckIndex(i); return records[i]; }
+	const T& at(size_t i) const { CheckIndex(i); return records[i]; }
+	T& operator[](size_t i){ return records[i]; }
+	const T& operator[](size_t i) const { return records[i]; }
+	// records beyond those in use are left over from earlier events, so these throw if empty
+	T& front(){ CheckIndex(0); return records.front(); }
+	const T& front() const { CheckIndex(0); return records.front(); }
+	T& back(){ CheckIndex(n_used-1); return records[n_used-1]; }
+	const T& back() const { CheckIndex(n_used-1); return records[n_used-1]; }
+
+	iterator begin(){ return records.begin(); }
+	iterator end(){ return records.begin()+n_used; }
+	const_iterator begin() const { return records.begin(); }
+	const_iterator end() const { return records.begin()+n_used; }
+
+	private:
+	void CheckIndex(size_t i) const {
+		if(i>=n_used){
+			if(n_used==0) throw std::out_of_range("EventArena: no records in use");
+			throw std::out_of_range("EventArena: index "+std::to_string(i)
+			                        +" >= size "+std::to_string(n_used));
+		}
+	}
+
+	std::vector<T> records;  // records made so far; the first n_used are in use
+	size_t n_used=0;
+
+};
+
+#endif
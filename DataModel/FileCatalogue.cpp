@@ -0,0 +1,405 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "FileCatalogue.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <algorithm>
+#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TROOT.h"  // EnableThreadSafety
+
+#include "ParallelFor.h"
+
+namespace {
+
+const char* catalogue_magic = "# FileCatalogue 1";
+
+int64_t MTimeNs(const struct stat& info){
+	return int64_t(info.st_mtim.tv_sec)*1000000000 + info.st_mtim.tv_nsec;
+}
+
+bool StatPath(const std::string& path, int64_t& size, int64_t& mtime){
+	struct stat info;
+	if(stat(path.c_str(), &info)!=0) return false;
+	size = info.st_size;
+	mtime = MTimeNs(info);
+	return true;
+}
+
+bool ByPath(const catalogue_file& a, const catalogue_file& b){
+	return a.path < b.path;
+}
+
+// directory of a path, as the keys of the directory map
+std::string ParentDirectory(const std::string& path){
+	size_t pos = path.find_last_of('/');
+	if(pos==std::string::npos) return ".";
+	if(pos==0) return "/";
+	return path.substr(0, pos);
+}
+
+// the rest of a line after the given number of space-separated fields; paths may contain spaces
+std::string RestOfLine(const std::string& line, int nfields){
+	size_t pos=0;
+	for(int field_i=0; field_i<nfields && pos!=std::string::npos; ++field_i){
+		pos = line.find(' ', pos);
+		if(pos!=std::string::npos) ++pos;
+	}
+	return (pos==std::string::npos) ? "" : line.substr(pos);
+}
+
+} // end anonymous namespace
+
+bool FileCatalogue::Read(const std::string& filename){
+	root.clear();
+	depth=-1;
+	tree_name.clear();
+	directories.clear();
+	other_files.clear();
+	modified=false;
+
+	std::ifstream infile(filename);
+	if(!infile.is_open()) return false;  // no catalogue yet; not an error
+	std::string line;
+	if(!std::getline(infile, line) || line!=catalogue_magic){
+		std::cerr<<"FileCatalogue::Read error! "<<filename<<" is not a compatible file catalogue"<<std::endl;
+		return false;
+	}
+
+	catalogue_directory* current=nullptr;
+	while(std::getline(infile, line)){
+		if(line.empty()) continue;
+		std::istringstream ss(line);
+		std::string key;
+		ss>>key;
+		if(key=="root"){
+			root = RestOfLine(line, 1);
+		} else if(key=="depth"){
+			ss>>depth;
+		} else if(key=="tree"){
+			tree_name = RestOfLine(line, 1);
+		} else if(key=="D"){
+			int64_t mtime=0;
+			ss>>mtime;
+			current = &directories[RestOfLine(line, 2)];
+			current->mtime = mtime;
+		} else if(key=="S" && current){
+			current->subdirs.push_back(RestOfLine(line, 1));
+		} else if(key=="O"){
+			catalogue_file afile;
+			ss>>afile.size>>afile.mtime>>afile.entries;
+			afile.path = RestOfLine(line, 4);
+			other_files[afile.path] = afile;
+		} else if(key=="F" && current){
+			catalogue_file afile;
+			ss>>afile.size>>afile.mtime>>afile.entries;
+			afile.path = RestOfLine(line, 4);
+			current->files.push_back(afile);
+		} else {
+			std::cerr<<"FileCatalogue::Read error! Unrecognised line '"<<line<<"' in "<<filename<<std::endl;
+			directories.clear();
+			return false;
+		}
+	}
+	// Write keeps these sorted, but don't rely on it
+	for(auto&& adir : directories) std::sort(adir.second.files.begin(), adir.second.files.end(), ByPath);
+
+	return true;
+}
+
+bool FileCatalogue::Write(const std::string& filename) const {
+	// write to a temporary and rename, so that concurrent jobs never read a partial catalogue
+	std::string tmp_file = filename+".tmp"+std::to_string(getpid());
+	{
+		std::ofstream outfile(tmp_file, std::ios::trunc);
+		if(!outfile.is_open()){
+			std::cerr<<"FileCatalogue::Write error! Could not open "<<tmp_file<<" for writing"<<std::endl;
+			return false;
+		}
+		outfile<<catalogue_magic<<"\n";
+		outfile<<"root "<<root<<"\n";
+		outfile<<"depth "<<depth<<"\n";
+		outfile<<"tree "<<tree_name<<"\n";
+		for(auto&& adir : directories){
+			outfile<<"D "<<adir.second.mtime<<" "<<adir.first<<"\n";
+			for(const std::string& asubdir : adir.second.subdirs) outfile<<"S "<<asubdir<<"\n";
+			for(const catalogue_file& afile : adir.second.files){
+				outfile<<"F "<<afile.size<<" "<<afile.mtime<<" "<<afile.entries<<" "<<afile.path<<"\n";
+			}
+		}
+		for(auto&& afile : other_files){
+			outfile<<"O "<<afile.second.size<<" "<<afile.second.mtime<<" "<<afile.second.entries<<" "<<afile.first<<"\n";
+		}
+		if(!outfile.good()){
+			std::cerr<<"FileCatalogue::Write error writing "<<tmp_file<<std::endl;
+			outfile.close();
+			unlink(tmp_file.c_str());
+			return false;
+		}
+	}
+	if(rename(tmp_file.c_str(), filename.c_str())!=0){
+		std::cerr<<"FileCatalogue::Write error! Could not rename "<<tmp_file<<" to "<<filename
+		         <<": "<<strerror(errno)<<std::endl;
+		unlink(tmp_file.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool FileCatalogue::Update(const std::string& root_dir, int max_depth, int nthreads, bool verbose){
+	return Scan(root_dir, max_depth, nthreads, true, verbose);
+}
+
+bool FileCatalogue::ListFiles(const std::string& root_dir, std::vector<std::string>& paths, int max_depth, int nthreads){
+	FileCatalogue listing;
+	paths.clear();
+	if(!listing.Scan(root_dir, max_depth, nthreads, false, false)) return false;
+	for(const catalogue_file& afile : listing.GetFiles()) paths.push_back(afile.path);
+	return true;
+}
+
+bool FileCatalogue::Scan(const std::string& root_dir, int max_depth, int nthreads, bool stat_files, bool verbose){
+	if(root_dir!=root || max_depth!=depth){
+		if(verbose && !directories.empty()){
+			std::cout<<"FileCatalogue: catalogue was of "<<root<<" to depth "<<depth<<", rescanning"<<std::endl;
+		}
+		directories.clear();
+		root = root_dir;
+		depth = max_depth;
+		modified = true;
+	}
+	if(nthreads<=0) nthreads = std::max(1u, std::thread::hardware_concurrency());
+	nrescanned=0;
+
+	std::map<std::string, catalogue_directory> updated;
+	std::vector<std::string> level{root_dir};
+	for(int level_depth=0; !level.empty(); ++level_depth){
+		std::vector<catalogue_directory> listings(level.size());
+		std::vector<char> rescanned(level.size(), 0);
+		std::vector<int> failed(level.size(), 0);  // errno
+
+		// n.b. threads only read the map structure, and each moves from a different element
+		ParallelFor(level.size(), nthreads, [&](size_t dir_i, int thread_i){
+			const std::string& dir = level[dir_i];
+			struct stat info;
+			if(stat(dir.c_str(), &info)!=0){
+				failed[dir_i]=errno;
+				return;
+			}
+			const int64_t mtime = MTimeNs(info);
+			auto cached = directories.find(dir);
+			if(cached!=directories.end() && cached->second.mtime==mtime){
+				listings[dir_i] = std::move(cached->second);
+				return;
+			}
+			rescanned[dir_i]=1;
+			if(!ScanDirectory(dir, listings[dir_i], stat_files)){
+				failed[dir_i]=errno;
+				return;
+			}
+			listings[dir_i].mtime = mtime;
+			// keep the entry counts of files that have not changed
+			if(cached!=directories.end()){
+				for(catalogue_file& afile : listings[dir_i].files){
+					const catalogue_file* old = FindFile(cached->second, afile.path);
+					if(old && old->size==afile.size && old->mtime==afile.mtime) afile.entries = old->entries;
+				}
+			}
+		});
+
+		std::vector<std::string> next_level;
+		for(size_t dir_i=0; dir_i<level.size(); ++dir_i){
+			if(failed[dir_i]){
+				std::cerr<<"FileCatalogue: error! Could not read directory "<<level[dir_i]<<": "
+				         <<strerror(failed[dir_i])<<std::endl;
+				if(level_depth==0) return false;
+				modified = true;
+				continue;
+			}
+			if(rescanned[dir_i]){
+				if(verbose) std::cout<<"FileCatalogue: read directory "<<level[dir_i]<<std::endl;
+				++nrescanned;
+				modified = true;
+			}
+			if(max_depth<=0 || level_depth+1<max_depth){
+				next_level.insert(next_level.end(), listings[dir_i].subdirs.begin(), listings[dir_i].subdirs.end());
+			}
+			updated[level[dir_i]] = std::move(listings[dir_i]);
+		}
+		level.swap(next_level);
+	}
+	// directories that have been removed are not carried over
+	if(updated.size()!=directories.size()) modified = true;
+	directories.swap(updated);
+
+	if(verbose){
+		std::cout<<"FileCatalogue: "<<directories.size()<<" directories under "<<root_dir<<", "
+		         <<nrescanned<<" read"<<std::endl;
+	}
+	return true;
+}
+
+bool FileCatalogue::ScanDirectory(const std::string& dir, catalogue_directory& listing, bool stat_files){
+	listing.files.clear();
+	listing.subdirs.clear();
+	DIR* dirp = opendir(dir.c_str());
+	if(dirp==nullptr) return false;
+	const int dir_fd = dirfd(dirp);
+	const std::string prefix = (dir=="/") ? dir : dir+"/";
+
+	while(dirent* entry = readdir(dirp)){
+		const char* name = entry->d_name;
+		if(std::strcmp(name,".")==0 || std::strcmp(name,"..")==0) continue;
+		// as with 'find', symlinks to directories are not followed
+		bool is_dir = (entry->d_type==DT_DIR);
+		if(entry->d_type==DT_UNKNOWN){
+			struct stat info;
+			if(fstatat(dir_fd, name, &info, AT_SYMLINK_NOFOLLOW)!=0) continue;
+			is_dir = S_ISDIR(info.st_mode);
+		}
+		if(is_dir){
+			listing.subdirs.push_back(prefix+name);
+			continue;
+		}
+		catalogue_file afile;
+		afile.path = prefix+name;
+		if(stat_files){
+			// follow symlinks to files; broken links are listed with size and time 0
+			struct stat info;
+			if(fstatat(dir_fd, name, &info, 0)==0){
+				afile.size = info.st_size;
+				afile.mtime = MTimeNs(info);
+			}
+		}
+		listing.files.push_back(afile);
+	}
+	closedir(dirp);
+
+	std::sort(listing.files.begin(), listing.files.end(), ByPath);
+	std::sort(listing.subdirs.begin(), listing.subdirs.end());
+	return true;
+}
+
+const catalogue_file* FileCatalogue::FindFile(const catalogue_directory& listing, const std::string& path){
+	catalogue_file key;
+	key.path = path;
+	auto it = std::lower_bound(listing.files.begin(), listing.files.end(), key, ByPath);
+	if(it==listing.files.end() || it->path!=path) return nullptr;
+	return &(*it);
+}
+
+const catalogue_file* FileCatalogue::FindFile(const std::string& path) const {
+	auto adir = directories.find(ParentDirectory(path));
+	if(adir!=directories.end()){
+		const catalogue_file* afile = FindFile(adir->second, path);
+		if(afile) return afile;
+	}
+	auto another = other_files.find(path);
+	return (another==other_files.end()) ? nullptr : &another->second;
+}
+
+catalogue_file* FileCatalogue::FindFile(const std::string& path){
+	return const_cast<catalogue_file*>(static_cast<const FileCatalogue*>(this)->FindFile(path));
+}
+
+int FileCatalogue::CountEntries(const std::string& tree, const std::vector<std::string>& paths,
+                                std::vector<int64_t>* entries, int nthreads, bool verbose){
+	if(tree!=tree_name){
+		// counts are of a different tree
+		for(auto&& adir : directories){
+			for(catalogue_file& afile : adir.second.files) afile.entries=-1;
+		}
+		other_files.clear();
+		tree_name = tree;
+		modified = true;
+	}
+
+	// find the files that need counting
+	std::vector<catalogue_file*> files(paths.size(), nullptr);
+	std::vector<size_t> to_count;
+	for(size_t file_i=0; file_i<paths.size(); ++file_i){
+		const std::string& apath = paths[file_i];
+		int64_t size=0, mtime=0;
+		if(!StatPath(apath, size, mtime)){
+			std::cerr<<"FileCatalogue::CountEntries error! Could not stat "<<apath<<std::endl;
+			continue;
+		}
+		catalogue_file* afile = FindFile(apath);
+		if(afile==nullptr){
+			// not below the catalogue's directory, e.g. from a list of files; keep it anyway
+			afile = &other_files[apath];
+			afile->path = apath;
+		}
+		if(size!=afile->size || mtime!=afile->mtime){
+			afile->size = size;
+			afile->mtime = mtime;
+			afile->entries = -1;
+			modified = true;
+		}
+		files[file_i] = afile;
+		if(afile->entries<0) to_count.push_back(file_i);
+	}
+
+	// count them, opening files in parallel as it is mostly waiting on the disk
+	if(nthreads<=0) nthreads = std::max(1u, std::thread::hardware_concurrency());
+	nthreads = std::min(size_t(nthreads), to_count.size());
+	if(nthreads>1) ROOT::EnableThreadSafety();
+	std::vector<int64_t> counts(to_count.size(), -1);
+	ParallelFor(to_count.size(), nthreads, [&](size_t count_i, int thread_i){
+		const std::string& apath = paths[to_count[count_i]];
+		std::unique_ptr<TFile> infile(TFile::Open(apath.c_str(), "READ"));
+		if(!infile || infile->IsZombie()){
+			std::cerr<<"FileCatalogue::CountEntries error! Could not open "<<apath<<std::endl;
+			return;
+		}
+		TTree* atree = dynamic_cast<TTree*>(infile->Get(tree_name.c_str()));
+		if(atree==nullptr){
+			std::cerr<<"FileCatalogue::CountEntries error! No tree "<<tree_name<<" in "<<apath<<std::endl;
+			return;
+		}
+		counts[count_i] = atree->GetEntries();
+	});
+
+	int ncounted=0;
+	for(size_t count_i=0; count_i<to_count.size(); ++count_i){
+		if(counts[count_i]<0) continue;
+		files[to_count[count_i]]->entries = counts[count_i];
+		if(verbose) std::cout<<"FileCatalogue: "<<paths[to_count[count_i]]<<" has "<<counts[count_i]<<" entries"<<std::endl;
+		++ncounted;
+		modified = true;
+	}
+
+	if(entries){
+		entries->resize(paths.size());
+		for(size_t file_i=0; file_i<paths.size(); ++file_i){
+			(*entries)[file_i] = (files[file_i]) ? files[file_i]->entries : -1;
+		}
+	}
+	return ncounted;
+}
+
+int64_t FileCatalogue::GetEntries(const std::string& path) const {
+	const catalogue_file* afile = FindFile(path);
+	if(afile==nullptr || afile->entries<0) return -1;
+	int64_t size=0, mtime=0;
+	if(!StatPath(path, size, mtime) || size!=afile->size || mtime!=afile->mtime) return -1;
+	return afile->entries;
+}
+
+std::vector<catalogue_file> FileCatalogue::GetFiles() const {
+	std::vector<catalogue_file> files;
+	for(auto&& adir : directories) files.insert(files.end(), adir.second.files.begin(), adir.second.files.end());
+	std::sort(files.begin(), files.end(), ByPath);
+	return files;
+}
@@ -0,0 +1,80 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef FILE_CATALOGUE_H
+#define FILE_CATALOGUE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+// A listing of the files below a directory, with their size, modification time and
+// (optionally) number of TTree entries, which may be saved to a small text file and reused.
+// On reuse only the directories are stat'd: a directory whose modification time is unchanged
+// has had no files added, removed or renamed, so its cached listing is kept and only changed
+// directories are read again. This makes finding the input files of a job on a large
+// data disk take one stat per directory rather than a 'find' over every file.
+
+struct catalogue_file {
+	std::string path;      // absolute
+	int64_t size=0;
+	int64_t mtime=0;       // ns since the epoch
+	int64_t entries=-1;    // entries in the catalogue's tree, or -1 if not yet counted
+};
+
+class FileCatalogue {
+
+	public:
+	// read a catalogue written by Write. Returns false if there is none, or it is not compatible.
+	bool Read(const std::string& filename);
+	bool Write(const std::string& filename) const;
+
+	// bring the listing of root_dir (to max_depth levels of subdirectories; 0 for no limit) up to date,
+	// reading only directories that have changed since the catalogue was made, with up to
+	// nthreads threads (0 for the number of cores). root_dir should be an absolute path.
+	bool Update(const std::string& root_dir, int max_depth=0, int nthreads=0, bool verbose=false);
+
+	// count the entries of tree_name in the given files where not already known, or the file has
+	// changed since, opening up to nthreads (0: number of cores) at once. Files outside the catalogue's
+	// directory are also recorded. Returns the number of files counted, and the entries of all
+	// the given files (-1 for any that could not be read) in entries.
+	int CountEntries(const std::string& tree_name, const std::vector<std::string>& paths,
+	                 std::vector<int64_t>* entries=nullptr, int nthreads=1, bool verbose=false);
+	// entries of the catalogue's tree in a file, or -1 if not known or the file has changed since
+	int64_t GetEntries(const std::string& path) const;
+
+	// all files, sorted by path
+	std::vector<catalogue_file> GetFiles() const;
+	const std::string& GetTreeName() const { return tree_name; }
+	bool Modified() const { return modified; }
+	size_t GetNDirectories() const { return directories.size(); }
+	size_t GetNRescanned() const { return nrescanned; }
+
+	// list the files in a directory and its subdirectories, without a catalogue
+	static bool ListFiles(const std::string& root_dir, std::vector<std::string>& paths,
+	                      int max_depth=0, int nthreads=0);
+
+	private:
+	struct catalogue_directory {
+		int64_t mtime=0;
+		std::vector<catalogue_file> files;
+		std::vector<std::string> subdirs;
+	};
+	// breadth-first over the subdirectories of root_dir, in parallel over those at each level
+	bool Scan(const std::string& root_dir, int max_depth, int nthreads, bool stat_files, bool verbose);
+	// read a directory's entries; stat each file if stat_files
+	static bool ScanDirectory(const std::string& dir, catalogue_directory& listing, bool stat_files);
+	static const catalogue_file* FindFile(const catalogue_directory& listing, const std::string& path);
+	const catalogue_file* FindFile(const std::string& path) const;
+	catalogue_file* FindFile(const std::string& path);
+
+	std::string root;
+	int depth=-1;
+	std::string tree_name;
+	std::map<std::string, catalogue_directory> directories;
+	std::map<std::string, catalogue_file> other_files;  // counted, but not below root
+	bool modified=false;
+	size_t nrescanned=0;
+
+};
+
+#endif
@@ -9,6 +9,11 @@
 #include <iostream>
 #include <map>
 
-int FindFilesInDirectory(std::string inputdir, std::string pattern, std::vector<std::string> &matches, bool case_sensitive=false, int max_subdir_depth=0, bool use_regex=false, std::vector<std::string>* filenames=nullptr, std::vector<std::vector<std::string>>* output_submatches=nullptr, bool verbose=false);
+#include "FileCatalogue.h"
+
+// max_subdir_depth is as 'find -maxdepth': 1 for files in inputdir only, 0 for no limit.
+// If a catalogue is given the listing is taken from it, rescanning only directories that have changed,
+// and the caller should Write it if Modified. Directories are read with up to nthreads threads (0: all cores).
+int FindFilesInDirectory(std::string inputdir, std::string pattern, std::vector<std::string> &matches, bool case_sensitive=false, int max_subdir_depth=0, bool use_regex=false, std::vector<std::string>* filenames=nullptr, std::vector<std::vector<std::string>>* output_submatches=nullptr, bool verbose=false, FileCatalogue* catalogue=nullptr, int nthreads=0);
 
 #endif
@@ -0,0 +1,113 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "FlagCuts.h"
+#include "MTreeSelection.h"
+#include "Constants.h"
+
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+
+bool FlagCuts::ParseBits(const std::string& list, Word word, uint32_t& mask, std::string* bad_entry){
+	std::string spaced = list;
+	std::replace(spaced.begin(), spaced.end(), ',', ' ');
+	std::stringstream ss(spaced);
+	std::string next;
+	while(ss >> next){
+		if(next[0]=='#') break; // trailing comments
+		int bit=-1;
+		if(word==trigger){
+			bit = TriggerNameToID(next);
+		} else if(constants::string_to_flag_SKIV.count(next)){
+			bit = constants::string_to_flag_SKIV.at(next);
+		} else if(constants::string_to_flag_SKI_III.count(next)){
+			bit = constants::string_to_flag_SKI_III.at(next);
+		}
+		if(bit<0){
+			try{
+				size_t nchars=0;
+				bit = std::stoi(next, &nchars);
+				if(nchars!=next.length()) bit=-1;
+			} catch (...) { bit=-1; }
+		}
+		if(bit<0 || bit>31){
+			if(bad_entry) *bad_entry = next;
+			return false;
+		}
+		mask |= (uint32_t(1)<<bit);
+	}
+	return true;
+}
+
+std::string FlagCuts::BitNames(Word word, uint32_t mask){
+	return (word==trigger) ? GetTriggerNames(mask) : GetEventFlagNames(mask);
+}
+
+int FlagCuts::AddCut(const std::string& name, Word word, uint32_t reject_mask, uint32_t require_mask){
+	flag_cut acut;
+	acut.name = name;
+	acut.word = word;
+	acut.reject = reject_mask;
+	acut.require = require_mask;
+	cuts.push_back(acut);
+	reject_any[word] |= reject_mask;
+	if(require_mask) required.push_back(bit_requirement{word, require_mask});
+	return cuts.size()-1;
+}
+
+bool FlagCuts::RecordIn(std::map<std::string,MTreeSelection*>& selectors, const std::string& selector){
+	if(selector!="all" && selectors.count(selector)==0){
+		std::cerr<<"FlagCuts::RecordIn Error! Unrecognised selector "<<selector<<std::endl;
+		return false;
+	}
+	for(auto&& sel : selectors){
+		if(selector!="all" && sel.first!=selector) continue;
+		for(flag_cut& acut : cuts){
+			int cut_id = sel.second->GetCutID(acut.name);
+			if(cut_id<0){
+				std::cerr<<"FlagCuts::RecordIn Error! Selector "<<sel.first<<" has no cut "<<acut.name
+				         <<"; call AddCut on it first"<<std::endl;
+				return false;
+			}
+			acut.recorders.emplace_back(sel.second, cut_id);
+		}
+	}
+	return true;
+}
+
+std::string FlagCuts::Description(int cut_i) const {
+	const flag_cut& acut = cuts.at(cut_i);
+	const std::string what = (acut.word==trigger) ? "triggers" : "flags";
+	std::string description;
+	if(acut.reject) description = "rejected "+what+": "+BitNames(acut.word, acut.reject);
+	if(acut.require){
+		if(!description.empty()) description += ", ";
+		description += "allowed "+what+": "+BitNames(acut.word, acut.require);
+	}
+	return description;
+}
+
+void FlagCuts::Pass(flag_cut& acut){
+	++acut.n_passing;
+	for(auto&& recorder : acut.recorders) recorder.first->AddPassingEvent(recorder.second);
+}
+
+int FlagCuts::Apply(uint32_t idtgsk, uint32_t ifevsk){
+	++n_tested;
+	if(Passes(idtgsk, ifevsk)){
+		for(flag_cut& acut : cuts) Pass(acut);
+		return -1;
+	}
+	// find which cut it failed; those before it were passed
+	for(size_t cut_i=0; cut_i<cuts.size(); ++cut_i){
+		if(Fails(cuts[cut_i], idtgsk, ifevsk)) return cut_i;
+		Pass(cuts[cut_i]);
+	}
+	return -1;  // not reached
+}
+
+void FlagCuts::PrintCutFlow() const {
+	std::cout<<"tested => "<<n_tested<<"\n";
+	for(size_t cut_i=0; cut_i<cuts.size(); ++cut_i){
+		std::cout<<"cut "<<cut_i<<": "<<cuts[cut_i].name<<" => "<<cuts[cut_i].n_passing<<"\n";
+	}
+}
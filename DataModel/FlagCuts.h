@@ -0,0 +1,84 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef FLAG_CUTS_H
+#define FLAG_CUTS_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+class MTreeSelection;
+
+// Cuts on the trigger bits (idtgsk) and event flags (ifevsk) of the SK header.
+// Each cut rejects events with any of its reject bits set, and/or without any of its require bits set.
+// The reject masks of all cuts are merged, so an event that passes them all - most events, once
+// the chain is set up - costs one AND and compare per word, plus one per cut with require bits.
+// The individual cuts are only looked at to find which one an event failed.
+// Passing events can be recorded in MTreeSelections for the cut flow; the cuts are resolved to
+// IDs once by RecordIn, so this doesn't look up selector or cut names for each event.
+// Since it only needs the two words, Passes can be used before the rest of an entry is read,
+// e.g. from the trigger index or the HEADER branch.
+
+class FlagCuts {
+
+	public:
+	enum Word { trigger=0, event_flag=1 };
+
+	// parse a list of bit numbers or names, separated by spaces or commas, into a mask.
+	// Names are those of TriggerNameToID, or the SK-IV or SK-I-III event flag names.
+	// A '#' ends the list. On failure returns false and, if given, sets bad_entry.
+	static bool ParseBits(const std::string& list, Word word, uint32_t& mask, std::string* bad_entry=nullptr);
+	static std::string BitNames(Word word, uint32_t mask);
+
+	// cuts are applied in the order they are added. Returns the index of the new cut.
+	int AddCut(const std::string& name, Word word, uint32_t reject_mask, uint32_t require_mask=0);
+	// record events passing each cut in a selector (or "all"), which must already have cuts of the same names
+	bool RecordIn(std::map<std::string,MTreeSelection*>& selectors, const std::string& selector);
+
+	size_t NumCuts() const { return cuts.size(); }
+	const std::string& CutName(int cut_i) const { return cuts.at(cut_i).name; }
+	std::string Description(int cut_i) const;
+
+	// whether an event passes all cuts, without any accounting
+	bool Passes(uint32_t idtgsk, uint32_t ifevsk) const {
+		if((idtgsk & reject_any[trigger]) || (ifevsk & reject_any[event_flag])) return false;
+		for(const bit_requirement& req : required){
+			if(((req.word==trigger ? idtgsk : ifevsk) & req.mask)==0) return false;
+		}
+		return true;
+	}
+	// index of the first cut the event fails, or -1 if it passes all of them.
+	// Counts and records the event in each cut it passes.
+	int Apply(uint32_t idtgsk, uint32_t ifevsk);
+
+	uint64_t GetTested() const { return n_tested; }
+	uint64_t GetPassing(int cut_i) const { return cuts.at(cut_i).n_passing; }
+	void PrintCutFlow() const;
+
+	private:
+	struct flag_cut {
+		std::string name;
+		Word word;
+		uint32_t reject;
+		uint32_t require;
+		uint64_t n_passing=0;
+		std::vector<std::pair<MTreeSelection*,int>> recorders;  // selector and cut ID
+	};
+	struct bit_requirement {
+		Word word;
+		uint32_t mask;
+	};
+	bool Fails(const flag_cut& acut, uint32_t idtgsk, uint32_t ifevsk) const {
+		const uint32_t bits = (acut.word==trigger) ? idtgsk : ifevsk;
+		return (bits & acut.reject) || (acut.require && (bits & acut.require)==0);
+	}
+	void Pass(flag_cut& acut);
+
+	std::vector<flag_cut> cuts;
+	uint32_t reject_any[2]={0,0};           // any of these bits in either word fails a cut
+	std::vector<bit_requirement> required;  // each needs at least one bit set
+	uint64_t n_tested=0;
+
+};
+
+#endif
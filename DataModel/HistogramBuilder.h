@@ -207,7 +207,7 @@ TH1* HistogramBuilder::AddHist(std::string histname, std::vector<T> type){
 	return nullptr;
 }
 
-std::string HistogramBuilder::AddHist(std::string histname){
+inline std::string HistogramBuilder::AddHist(std::string histname){
 	
 	// sanity check that this histogram doesn't exist already
 	if(hists.count(histname)){
@@ -0,0 +1,31 @@
+#ifndef LOG_MACROS_H
+#define LOG_MACROS_H
+
+// Lazily evaluated logging for use within Tools.
+// `Log(m_unique_name+" Reading entry "+toString(entrynum),v_debug,m_verbose);` builds its message
+// even when it is not printed, which in per-event code is a noticeable cost. Instead use
+//   LOG_DEBUG(m_unique_name+" Reading entry "+toString(entrynum));
+// which only evaluates the message if m_verbose is high enough for it to be printed.
+// LOG_DEBUG_N(n, msg) is equivalent to Log(msg, v_debug+n, m_verbose).
+//
+// Messages above LOG_COMPILED_VERBOSITY are removed at compile time. By default all are kept;
+// build with -DLOG_COMPILED_VERBOSITY=2 to drop debug messages (v_debug = 3), or =1 to also
+// drop messages (v_message = 2), leaving just warnings and errors.
+
+#ifndef LOG_COMPILED_VERBOSITY
+#define LOG_COMPILED_VERBOSITY 99
+#endif
+
+// compiled_level is a literal so that the check of disabled messages is a compile-time constant
+#define LOG_AT_LEVEL(compiled_level, level, ...) \
+	do { \
+		if((compiled_level)<=LOG_COMPILED_VERBOSITY && (level)<=m_verbose) Log((__VA_ARGS__), (level), m_verbose); \
+	} while(0)
+
+#define LOG_ERROR(...)       LOG_AT_LEVEL(0, v_error, __VA_ARGS__)
+#define LOG_WARNING(...)     LOG_AT_LEVEL(1, v_warning, __VA_ARGS__)
+#define LOG_MESSAGE(...)     LOG_AT_LEVEL(2, v_message, __VA_ARGS__)
+#define LOG_DEBUG(...)       LOG_AT_LEVEL(3, v_debug, __VA_ARGS__)
+#define LOG_DEBUG_N(n, ...)  LOG_AT_LEVEL(3+(n), v_debug+(n), __VA_ARGS__)
+
+#endif
@@ -20,7 +20,7 @@ MParticle::~MParticle(){
 	extraInfo=nullptr;
 }
 
-MParticle::MParticle(MParticle&& rhs){
+MParticle::MParticle(MParticle&& rhs) noexcept {
 	
 	m_data = rhs.m_data;
 	pdg = rhs.pdg;
@@ -28,7 +28,7 @@ MParticle::MParticle(MParticle&& rhs){
 	end_vtx_idx = rhs.end_vtx_idx;
 	parent_idx = rhs.parent_idx;
 	direct_parent = rhs.direct_parent;
-	daughters = rhs.daughters;
+	daughters = std::move(rhs.daughters);
 	
 	start_mom = rhs.start_mom;
 	end_mom = rhs.end_mom;
@@ -40,6 +40,21 @@ MParticle::MParticle(MParticle&& rhs){
 	
 }
 
+void MParticle::Reset(){
+	pdg=-1;
+	start_vtx_idx=-1;
+	end_vtx_idx=-1;
+	parent_idx=-1;
+	direct_parent=true;
+	daughters.clear();
+	start_mom.SetXYZ(0,0,0);
+	start_mom.ResetBit(initbit);
+	end_mom.SetXYZ(0,0,0);
+	end_mom.ResetBit(initbit);
+	if(extraInfo) extraInfo->Delete();
+	else extraInfo = new BStore{true,constants::BSTORE_BINARY_FORMAT};
+}
+
 void MParticle::SetParentIndex(int idx){
 	// if -1, unrecorded.
 	// if 0+, index of the direct parent.
@@ -13,7 +13,8 @@ class MParticle {
 	~MParticle();
 	MParticle(const MParticle&) = delete; // must manually declare copy construction that deals with BStore
 	MParticle& operator=(const MParticle&) = delete;
-	MParticle(MParticle&&);
+	MParticle(MParticle&&) noexcept;
+	void Reset();  // back to the default state, keeping storage, for reuse in the next event
 	int pdg=-1; // pdg code
 	int start_vtx_idx=-1;
 	int end_vtx_idx=-1;
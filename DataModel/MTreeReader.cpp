@@ -102,6 +102,10 @@ int MTreeReader::Load(std::string filename, std::string treename){
 }
 
 int MTreeReader::Load(std::vector<std::string> filelist, std::string treename){
+	return Load(filelist, treename, std::vector<int64_t>{});
+}
+
+int MTreeReader::Load(std::vector<std::string> filelist, std::string treename, const std::vector<int64_t>& entries){
 	// Construct a TChain and add all files from the list
 	if(verbosity) std::cout<<"loading TChain '"<<treename<<"' with "<<filelist.size()<<" files"<<std::endl;
 	if(filelist.size()==0){
@@ -109,10 +113,20 @@ int MTreeReader::Load(std::vector<std::string> filelist, std::string treename){
 		return -1;
 	}
 	TChain* chain = new TChain(treename.c_str());
-	for(std::string& afile : filelist){
-		chain->Add(afile.c_str());
+	int nknown=0;
+	for(size_t file_i=0; file_i<filelist.size(); ++file_i){
+		const std::string& afile = filelist[file_i];
+		if(file_i<entries.size() && entries[file_i]>=0){
+			// with the number of entries given the TChain need not open the file to count them,
+			// so GetEntries() doesn't open every file if all are known
+			chain->AddFile(afile.c_str(), entries[file_i]);
+			++nknown;
+		} else {
+			chain->Add(afile.c_str());
+		}
 		// ↑ note this does not check the files contain the correct TTree!
 	}
+	if(verbosity && entries.size()) std::cout<<"entries of "<<nknown<<" files were given"<<std::endl;
 	int localEntry = chain->LoadTree(0);
 	if(localEntry<0){
 		std::cerr<<"!!! MTreeReader constructor found no valid files !!!"<<std::endl
@@ -564,7 +578,13 @@ int MTreeReader::GetEntry(long entry_number, bool skipTreeRead){
 					 <<"TChain::GetEntry returned "<<status<<"\n";
 		}
 	}
-	if(bytesread>0) currentEntryNumber = entry_number;
+	if(bytesread>0){
+		currentEntryNumber = entry_number;
+		if(!skipTreeRead){
+			bytesRead += bytesread;
+			++entriesRead;
+		}
+	}
 	return bytesread;
 }
 
@@ -638,6 +658,14 @@ uint64_t MTreeReader::GetEntryNumber(){
 	return currentEntryNumber;
 }
 
+uint64_t MTreeReader::GetBytesRead(){
+	return bytesRead;
+}
+
+uint64_t MTreeReader::GetEntriesRead(){
+	return entriesRead;
+}
+
 // branch map getters
 std::map<std::string,std::string> MTreeReader::GetBranchTypes(){
 	return branch_types;
@@ -5,6 +5,8 @@
 #include <string>
 #include <map>
 #include <utility> // pair
+#include <vector>
+#include <cstdint>
 
 #include "basic_array.h"
 
@@ -38,6 +40,8 @@ class MTreeReader {
 	int LoadTree(std::string treename);
 	int Load(TTree* thetreein);
 	int Load(std::vector<std::string> filelist, std::string treename);
+	// as above, with the number of entries in each file if known (e.g. from a FileCatalogue), or -1
+	int Load(std::vector<std::string> filelist, std::string treename, const std::vector<int64_t>& entries);
 	void SetOwnsFile(bool ownsfile);
 	
 	// get a pointer to an object
@@ -241,6 +245,8 @@ class MTreeReader {
 	TTree* GetCurrentTree();
 	TChain* GetChain();
 	uint64_t GetEntryNumber();
+	uint64_t GetBytesRead();         // total over all GetEntry calls
+	uint64_t GetEntriesRead();
 	
 	// tree operations
 	int Clear();
@@ -297,6 +303,8 @@ class MTreeReader {
 	int verbosity=1;                 // TODO add to constructor
 	uint64_t currentEntryNumber=0;
 	int currentTreeNumber=0;
+	uint64_t bytesRead=0;
+	uint64_t entriesRead=0;
 	bool isMC=false;
 	Notifier notifier;
 	std::string name="";
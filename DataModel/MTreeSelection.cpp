@@ -87,7 +87,9 @@ bool MTreeSelection::NoteCut(std::string cutname, std::string description, doubl
 	cut_order.push_back(cutname);
 	did_pass_cut.emplace(cutname,false);
 	// N.B. we must have an output file before we make the TTrees in the MTreeCut.
-	cut_pass_entries.emplace(cutname, new MTreeCut(outfile, cutname, description, low, high));
+	MTreeCut* acut = new MTreeCut(outfile, cutname, description, low, high);
+	cut_pass_entries.emplace(cutname, acut);
+	cut_handles.push_back(cut_handle{cutname, acut, &it.first->second});
 	return true;
 }
 
@@ -195,6 +197,24 @@ bool MTreeSelection::AddPassingEvent(std::string cutname){
 	return true;
 }
 
+int MTreeSelection::GetCutID(std::string cutname){
+	for(size_t cut_id=0; cut_id<cut_handles.size(); ++cut_id){
+		if(cut_handles[cut_id].name==cutname) return cut_id;
+	}
+	return -1;
+}
+
+bool MTreeSelection::AddPassingEvent(int cut_id){
+	if(cut_id<0 || size_t(cut_id)>=cut_handles.size()){
+		std::cerr<<"MTreeSelection::AddPassingEvent called with unknown cut ID "<<cut_id<<std::endl;
+		return false;
+	}
+	cut_handle& handle = cut_handles[cut_id];
+	if(not handle.cut->Enter()) return false;  // prevent double counting
+	++(*handle.count);
+	return true;
+}
+
 // provided Initialize is called first we can skip most of the arguments
 bool MTreeSelection::AddPassingEvent(std::string cutname, size_t index){
 	
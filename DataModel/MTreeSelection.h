@@ -49,6 +49,9 @@ class MTreeSelection : public SerialisableObject {
 	bool AddPassingEvent(std::string cutname);
 	bool AddPassingEvent(std::string cutname, size_t index);
 	bool AddPassingEvent(std::string cutname, std::vector<size_t> indices);
+	// as above, but by an ID from GetCutID, to avoid looking up the cut name for every event
+	int GetCutID(std::string cutname);  // -1 if the cut was not made by this selection
+	bool AddPassingEvent(int cut_id);
 	
 	/*
 	template<typename T, class = typename std::enable_if<!std::is_same<T,TTree>::value>::type>
@@ -95,6 +98,13 @@ class MTreeSelection : public SerialisableObject {
 	std::vector<std::string> cut_order;
 	std::map<std::string, uint64_t> cut_tracker;
 	std::map<std::string, MTreeCut*> cut_pass_entries;
+	// the above for each cut made by NoteCut, indexed by cut ID
+	struct cut_handle {
+		std::string name;
+		MTreeCut* cut;
+		uint64_t* count;   // into cut_tracker, whose elements never move
+	};
+	std::vector<cut_handle> cut_handles;
 	
 	MTreeReader* treereader=nullptr;
 	std::map<intptr_t, std::string> branch_addresses;
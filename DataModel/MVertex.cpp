@@ -12,14 +12,14 @@ MVertex::~MVertex(){
 	extraInfo=nullptr;
 }
 
-MVertex::MVertex(MVertex&& rhs){
+MVertex::MVertex(MVertex&& rhs) noexcept {
 	
 	m_data = rhs.m_data;
 	pos = rhs.pos;
 	time = rhs.time;
 	type = rhs.type;
 	target_pdg = rhs.target_pdg;
-	processes = rhs.processes;
+	processes = std::move(rhs.processes);
 	incident_particle_idx = rhs.incident_particle_idx;
 	direct_parent = rhs.direct_parent;
 	incident_particle_pdg = rhs.incident_particle_pdg;
@@ -31,6 +31,20 @@ MVertex::MVertex(MVertex&& rhs){
 	
 }
 
+void MVertex::Reset(){
+	pos.SetXYZ(999,999,999);
+	time=-999;
+	type=-1;
+	target_pdg=-1;
+	processes.clear();
+	incident_particle_idx=-1;
+	direct_parent=true;
+	incident_particle_pdg=-1;
+	incident_particle_mom.SetXYZ(999,999,999);
+	if(extraInfo) extraInfo->Delete();
+	else extraInfo = new BStore{true,constants::BSTORE_BINARY_FORMAT};
+}
+
 void MVertex::SetIncidentParticle(int idx){
 	// if -1, unrecorded.
 	// if 0+, index of the direct parent.
@@ -13,7 +13,8 @@ class MVertex {
 	~MVertex();
 	MVertex(const MVertex&) = delete; // must manually declare copy construction that deals with BStore
 	MVertex& operator=(const MVertex&) = delete;
-	MVertex(MVertex&&);
+	MVertex(MVertex&&) noexcept;
+	void Reset();  // back to the default state, keeping storage, for reuse in the next event
 	// TODO make these arguments of the constructor so that they're mandatory
 	// (since we don't have getters and can't really identify if they're valid based on default values)
 	TVector3 pos{999,999,999};  // [cm]
@@ -0,0 +1,101 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef MATCHED_PAIR_PLANNER_H
+#define MATCHED_PAIR_PLANNER_H
+
+#include <vector>
+#include <map>
+#include <functional>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+
+// Plans the reading of the partner entries matched to each of a stream of events, such as the muons
+// or neutron clouds within +-60 s of each relic candidate, given by entry number in MatchedOutEntryNums.
+// Plan() deduplicates an event's matches and sorts them by partner entry, then reads the partners
+// not already held in increasing entry order, keeping what's needed from each in a Record filled by
+// the loader. Records are kept for the following events: consecutive events share most of their
+// partners, so each partner entry is normally read once and in order, rather than once per pair.
+// Records of entries before the first partner of the current event are dropped, since events (and
+// so their partners) come in time order; a partner that is needed again after all is just read again.
+// Record must be default constructible.
+
+template<typename Record>
+class MatchedPairPlanner {
+
+	public:
+	// read a partner entry and fill the record from it, returning false on failure
+	typedef std::function<bool(int entry, Record& record)> loader_t;
+
+	struct matched_pair {
+		int entry;                // partner entry number
+		size_t match;             // position in the event's list of matches, e.g. for its time difference
+		const Record* record;     // nullptr if the partner could not be read
+	};
+	typedef typename std::vector<matched_pair>::const_iterator const_iterator;
+
+	explicit MatchedPairPlanner(loader_t loader_in=loader_t{}) : loader(loader_in) {}
+	void SetLoader(loader_t loader_in){ loader = loader_in; }
+
+	// plan the pairs of the next event, reading any partners needed.
+	// Of duplicate matches the first is kept; returns the number removed.
+	size_t Plan(const std::vector<int>& matched_entries);
+
+	// the pairs of the current event, in order of partner entry
+	size_t size() const { return pairs.size(); }
+	const_iterator begin() const { return pairs.begin(); }
+	const_iterator end() const { return pairs.end(); }
+	const matched_pair& operator[](size_t i) const { return pairs[i]; }
+
+	// partner entries read, and pairs whose partner was held from a previous event
+	size_t NumRead() const { return n_read; }
+	size_t NumReused() const { return n_reused; }
+	void Clear(){ pairs.clear(); held.clear(); }
+
+	private:
+	struct held_record {
+		Record record;
+		bool ok=false;
+	};
+
+	loader_t loader;
+	std::vector<std::pair<int,size_t>> sorted;   // (entry, match) of the current event
+	std::vector<matched_pair> pairs;
+	std::map<int, held_record> held;             // by entry; elements don't move as others are added
+	size_t n_read=0;
+	size_t n_reused=0;
+
+};
+
+template<typename Record>
+size_t MatchedPairPlanner<Record>::Plan(const std::vector<int>& matched_entries){
+	pairs.clear();
+	sorted.clear();
+	for(size_t match=0; match<matched_entries.size(); ++match){
+		sorted.emplace_back(matched_entries[match], match);
+	}
+	std::sort(sorted.begin(), sorted.end());
+	// for equal entries the first match sorts first, and is the one kept
+	auto last = std::unique(sorted.begin(), sorted.end(),
+	                        [](const std::pair<int,size_t>& a, const std::pair<int,size_t>& b){ return a.first==b.first; });
+	const size_t n_duplicates = sorted.end()-last;
+	sorted.erase(last, sorted.end());
+	if(sorted.empty()) return n_duplicates;
+
+	// drop partners of earlier events
+	held.erase(held.begin(), held.lower_bound(sorted.front().first));
+
+	for(const std::pair<int,size_t>& amatch : sorted){
+		auto hint = held.lower_bound(amatch.first);
+		if(hint!=held.end() && hint->first==amatch.first){
+			++n_reused;
+		} else {
+			hint = held.emplace_hint(hint, amatch.first, held_record{});
+			hint->second.ok = loader && loader(amatch.first, hint->second.record);
+			++n_read;
+		}
+		pairs.push_back(matched_pair{amatch.first, amatch.second, hint->second.ok ? &hint->second.record : nullptr});
+	}
+	return n_duplicates;
+}
+
+#endif
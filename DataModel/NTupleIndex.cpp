@@ -0,0 +1,210 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "NTupleIndex.h"
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <sys/stat.h>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+
+namespace {
+
+// sidecar file layout: header, then nentries packed ntuple_index_entry records in entry order
+constexpr char index_magic[8] = {'S','K','N','T','P','I','D','X'};
+constexpr uint32_t index_version = 1;
+
+struct index_file_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t record_size;
+	uint64_t nentries;
+	int64_t source_size;
+	int64_t source_mtime;
+};
+
+static_assert(std::is_trivially_copyable<ntuple_index_entry>::value, "index records are written as raw bytes");
+
+bool StatFile(const std::string& filename, int64_t& size, int64_t& mtime){
+	struct stat info;
+	if(stat(filename.c_str(), &info)!=0) return false;
+	size = info.st_size;
+	mtime = info.st_mtime;
+	return true;
+}
+
+bool ByEvent(const ntuple_index_entry& a, const ntuple_index_entry& b){
+	return std::tie(a.nrun, a.nsub, a.nev, a.segment, a.entry) < std::tie(b.nrun, b.nsub, b.nev, b.segment, b.entry);
+}
+
+bool BySegment(const ntuple_index_entry& a, const ntuple_index_entry& b){
+	return std::tie(a.segment, a.nev, a.entry) < std::tie(b.segment, b.nev, b.entry);
+}
+
+} // end anonymous namespace
+
+std::string NTupleIndex::IndexPath(const std::string& ntuple_file, const std::string& index_dir){
+	if(index_dir.empty()) return ntuple_file+".ntpidx";
+	std::string basename = ntuple_file.substr(ntuple_file.find_last_of('/')+1);
+	std::string dir = index_dir;
+	if(dir.back()!='/') dir += '/';
+	return dir+basename+".ntpidx";
+}
+
+void NTupleIndex::Clear(){
+	by_event.clear();
+	by_segment.clear();
+	nsegments=0;
+	source_size=0;
+	source_mtime=0;
+}
+
+bool NTupleIndex::Build(const std::string& ntuple_file, const std::string& tree_name){
+	Clear();
+	if(!StatFile(ntuple_file, source_size, source_mtime)){
+		std::cerr<<"NTupleIndex::Build error! Could not stat "<<ntuple_file<<std::endl;
+		return false;
+	}
+	std::unique_ptr<TFile> infile(TFile::Open(ntuple_file.c_str(),"READ"));
+	if(!infile || infile->IsZombie()){
+		std::cerr<<"NTupleIndex::Build error! Could not open "<<ntuple_file<<std::endl;
+		return false;
+	}
+	TTree* tree = (TTree*)infile->Get(tree_name.c_str());
+	if(tree==nullptr || tree->GetBranch("nrun")==nullptr || tree->GetBranch("nsub")==nullptr ||
+	   tree->GetBranch("nev")==nullptr){
+		std::cerr<<"NTupleIndex::Build error! No tree "<<tree_name<<" with nrun, nsub and nev branches in "
+		         <<ntuple_file<<std::endl;
+		return false;
+	}
+
+	// only read the event numbers
+	UInt_t nrun=0;
+	Int_t nsub=0, nev=0;
+	TBranch *b_nrun=nullptr, *b_nsub=nullptr, *b_nev=nullptr;
+	tree->SetMakeClass(1);
+	tree->SetBranchStatus("*",0);
+	tree->SetBranchStatus("nrun",1);
+	tree->SetBranchStatus("nsub",1);
+	tree->SetBranchStatus("nev",1);
+	tree->SetBranchAddress("nrun", &nrun, &b_nrun);
+	tree->SetBranchAddress("nsub", &nsub, &b_nsub);
+	tree->SetBranchAddress("nev", &nev, &b_nev);
+
+	const long nentries = tree->GetEntries();
+	by_segment.resize(nentries);
+	int32_t segment=0;
+	for(long entry_i=0; entry_i<nentries; ++entry_i){
+		if(b_nrun->GetEntry(entry_i)<=0 || b_nsub->GetEntry(entry_i)<=0 || b_nev->GetEntry(entry_i)<=0){
+			std::cerr<<"NTupleIndex::Build error reading entry "<<entry_i<<" of "<<ntuple_file<<std::endl;
+			tree->ResetBranchAddresses();
+			Clear();
+			return false;
+		}
+		if(entry_i>0 && nev<by_segment[entry_i-1].nev) ++segment;
+		ntuple_index_entry& anentry = by_segment[entry_i];
+		anentry.segment = segment;
+		anentry.nrun = nrun;
+		anentry.nsub = nsub;
+		anentry.nev = nev;
+		anentry.entry = entry_i;
+	}
+	tree->ResetBranchAddresses();
+
+	Sort();
+	return true;
+}
+
+bool NTupleIndex::Write(const std::string& index_file) const {
+	std::ofstream outfile(index_file, std::ios::binary | std::ios::trunc);
+	if(!outfile.is_open()){
+		std::cerr<<"NTupleIndex::Write error! Could not open "<<index_file<<" for writing"<<std::endl;
+		return false;
+	}
+	// in entry order, so that segments can be recovered on reading
+	std::vector<ntuple_index_entry> entries(by_event.size());
+	for(const ntuple_index_entry& anentry : by_event) entries[anentry.entry] = anentry;
+
+	index_file_header header;
+	std::memcpy(header.magic, index_magic, sizeof(index_magic));
+	header.version = index_version;
+	header.record_size = sizeof(ntuple_index_entry);
+	header.nentries = entries.size();
+	header.source_size = source_size;
+	header.source_mtime = source_mtime;
+	outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	outfile.write(reinterpret_cast<const char*>(entries.data()), entries.size()*sizeof(ntuple_index_entry));
+	if(!outfile.good()){
+		std::cerr<<"NTupleIndex::Write error writing "<<index_file<<std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool NTupleIndex::Read(const std::string& index_file, const std::string& source_file){
+	Clear();
+	std::ifstream infile(index_file, std::ios::binary);
+	if(!infile.is_open()) return false;  // no index; not necessarily an error
+	index_file_header header;
+	infile.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if(!infile.good() || std::memcmp(header.magic, index_magic, sizeof(index_magic))!=0 ||
+	   header.version!=index_version || header.record_size!=sizeof(ntuple_index_entry)){
+		std::cerr<<"NTupleIndex::Read error! "<<index_file<<" is not a compatible ntuple index"<<std::endl;
+		return false;
+	}
+	if(!source_file.empty()){
+		int64_t size=0, mtime=0;
+		if(!StatFile(source_file, size, mtime) || size!=header.source_size || mtime!=header.source_mtime){
+			std::cerr<<"NTupleIndex::Read error! "<<index_file<<" is out of date with respect to "
+			         <<source_file<<std::endl;
+			return false;
+		}
+	}
+	by_segment.resize(header.nentries);
+	infile.read(reinterpret_cast<char*>(by_segment.data()), by_segment.size()*sizeof(ntuple_index_entry));
+	if(!infile.good()){
+		std::cerr<<"NTupleIndex::Read error! "<<index_file<<" is truncated"<<std::endl;
+		Clear();
+		return false;
+	}
+	source_size = header.source_size;
+	source_mtime = header.source_mtime;
+	Sort();
+	return true;
+}
+
+void NTupleIndex::Sort(){
+	// by_segment starts in entry order, so the last entry has the highest segment
+	nsegments = by_segment.empty() ? 0 : by_segment.back().segment+1;
+	by_event = by_segment;
+	std::sort(by_event.begin(), by_event.end(), ByEvent);
+	std::sort(by_segment.begin(), by_segment.end(), BySegment);
+}
+
+int64_t NTupleIndex::Find(int32_t nrun, int32_t nsub, int32_t nev) const {
+	ntuple_index_entry key;
+	key.nrun = nrun;
+	key.nsub = nsub;
+	key.nev = nev;
+	key.segment = 0;
+	key.entry = 0;
+	auto it = std::lower_bound(by_event.begin(), by_event.end(), key, ByEvent);
+	if(it==by_event.end() || it->nrun!=nrun || it->nsub!=nsub || it->nev!=nev) return -1;
+	return it->entry;
+}
+
+int64_t NTupleIndex::FindInSegment(int32_t segment, int32_t nev) const {
+	ntuple_index_entry key;
+	key.segment = segment;
+	key.nev = nev;
+	key.entry = 0;
+	auto it = std::lower_bound(by_segment.begin(), by_segment.end(), key, BySegment);
+	if(it==by_segment.end() || it->segment!=segment || it->nev!=nev) return -1;
+	return it->entry;
+}
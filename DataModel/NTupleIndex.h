@@ -0,0 +1,56 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef NTUPLE_INDEX_H
+#define NTUPLE_INDEX_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// An index of the (run, subrun, event) numbers of every entry of an ATMPD ntuple ("h1" tree),
+// built by reading only the nrun, nsub and nev branches, so that the entry matching an SK event
+// can be found with a binary search rather than by reading through the ntuple.
+// MC ntuples are often several MC files concatenated, with the event number restarting at
+// each: entries are numbered by 'segment', which increases whenever nev decreases.
+// Like a TriggerIndex, the index may be saved to a small sidecar file next to the ntuple.
+
+struct ntuple_index_entry {
+	int32_t segment=0;
+	int32_t nrun=0;
+	int32_t nsub=0;
+	int32_t nev=0;
+	int64_t entry=0;
+};
+
+class NTupleIndex {
+
+	public:
+	bool Build(const std::string& ntuple_file, const std::string& tree_name="h1");
+	bool Write(const std::string& index_file) const;
+	// read an index file. If source_file is given, fails if the index is older than it.
+	bool Read(const std::string& index_file, const std::string& source_file="");
+	void Clear();
+
+	// default location of the index for an ntuple: in index_dir if given, else alongside it
+	static std::string IndexPath(const std::string& ntuple_file, const std::string& index_dir="");
+
+	// entry with the given run, subrun and event numbers in any segment, or -1 if none
+	int64_t Find(int32_t nrun, int32_t nsub, int32_t nev) const;
+	// entry with the given event number in the given segment, or -1 if none
+	int64_t FindInSegment(int32_t segment, int32_t nev) const;
+
+	size_t size() const { return by_event.size(); }
+	int32_t GetNSegments() const { return nsegments; }
+
+	private:
+	// sorted by (nrun, nsub, nev, segment), and by (segment, nev), each with the entry number
+	std::vector<ntuple_index_entry> by_event;
+	std::vector<ntuple_index_entry> by_segment;
+	int32_t nsegments=0;
+	int64_t source_size=0;
+	int64_t source_mtime=0;
+
+	void Sort();
+
+};
+
+#endif
@@ -0,0 +1,135 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "NoisePool.h"
+
+#include <iostream>
+#include <algorithm>
+#include <thread>
+
+#include "TROOT.h"
+#include "TChain.h"
+#include "TChainElement.h"
+#include "TFile.h"
+#include "TTree.h"
+
+#include "tqrealroot.h"
+
+#include "ParallelFor.h"
+
+bool NoisePool::Load(const std::string& noise_files, float width, long max_entries, int nthreads,
+                     int verbose, const std::string& tree_name){
+
+	hits.clear();
+	window_offsets.assign(1,0);
+	nentries=0;
+	window_width = width;
+	if(window_width<=0){
+		std::cerr<<"NoisePool::Load error! Window width must be positive, not "<<window_width<<std::endl;
+		return false;
+	}
+
+	// find the files and their entries
+	TChain chain(tree_name.c_str());
+	if(chain.Add(noise_files.c_str())==0){
+		std::cerr<<"NoisePool::Load error! No files matching "<<noise_files<<std::endl;
+		return false;
+	}
+	long total_entries = chain.GetEntries();
+	if(max_entries>0 && max_entries<total_entries) total_entries = max_entries;
+	std::vector<std::string> files;
+	std::vector<long> file_entries;  // entries of each file to read
+	long entries_so_far=0;
+	for(TObject* element : *chain.GetListOfFiles()){
+		if(entries_so_far>=total_entries) break;
+		long n = std::min(static_cast<long>(static_cast<TChainElement*>(element)->GetEntries()),
+		                  total_entries-entries_so_far);
+		files.push_back(element->GetTitle());
+		file_entries.push_back(n);
+		entries_so_far += n;
+	}
+	if(verbose) std::cout<<"NoisePool::Load reading "<<total_entries<<" noise entries from "
+	                     <<files.size()<<" files"<<std::endl;
+
+	// decode each file into its own pool, then concatenate them in order
+	if(nthreads<=0) nthreads = std::max(1u, std::thread::hardware_concurrency());
+	nthreads = std::min(nthreads, static_cast<int>(files.size()));
+	if(nthreads>1) ROOT::EnableThreadSafety();
+	std::vector<NoisePool> file_pools(files.size());
+	std::vector<int> file_ok(files.size(), 1);
+	ParallelFor(files.size(), nthreads, [&](size_t file_i, size_t){
+		NoisePool& pool = file_pools[file_i];
+		pool.window_width = window_width;
+		pool.window_offsets.assign(1,0);
+		TFile f(files[file_i].c_str(), "READ");
+		TTree* t = (f.IsZombie()) ? nullptr : dynamic_cast<TTree*>(f.Get(tree_name.c_str()));
+		if(t==nullptr || t->GetBranch("TQREAL")==nullptr){
+			file_ok[file_i]=0;
+			return;
+		}
+		TQReal* tqi = new TQReal;
+		t->SetBranchStatus("*",0);
+		t->SetBranchStatus("TQREAL*",1);
+		t->SetBranchAddress("TQREAL", &tqi);
+		std::vector<noise_hit> entry_hits;
+		for(long entry=0; entry<file_entries[file_i]; ++entry){
+			if(t->GetEntry(entry)<=0){
+				file_ok[file_i]=0;
+				break;
+			}
+			entry_hits.resize(tqi->T.size());
+			for(size_t j=0; j<entry_hits.size(); ++j){
+				entry_hits[j] = noise_hit{tqi->T[j], tqi->Q[j], static_cast<unsigned int>(tqi->cables[j]&0x0000FFFF)};
+			}
+			std::sort(entry_hits.begin(), entry_hits.end(),
+			          [](const noise_hit& a, const noise_hit& b){ return a.t<b.t; });
+			pool.AddEntry(entry_hits);
+		}
+		t->ResetBranchAddresses();
+		delete tqi;
+	});
+
+	size_t nhits=0;
+	for(size_t file_i=0; file_i<files.size(); ++file_i){
+		if(!file_ok[file_i]){
+			std::cerr<<"NoisePool::Load error! Failed to read TQREAL from "<<files[file_i]<<std::endl;
+			return false;
+		}
+		nhits += file_pools[file_i].hits.size();
+	}
+	hits.reserve(nhits);
+	for(NoisePool& pool : file_pools){
+		for(size_t w=1; w<pool.window_offsets.size(); ++w){
+			window_offsets.push_back(hits.size()+pool.window_offsets[w]);
+		}
+		hits.insert(hits.end(), pool.hits.begin(), pool.hits.end());
+		nentries += pool.nentries;
+		std::vector<noise_hit>().swap(pool.hits);
+	}
+
+	if(verbose) std::cout<<"NoisePool::Load made "<<GetNWindows()<<" noise windows of "<<window_width*1e-3
+	                     <<" us, with "<<hits.size()<<" hits ("<<hits.size()*sizeof(noise_hit)/(1024*1024)
+	                     <<" MB)"<<std::endl;
+
+	return true;
+}
+
+void NoisePool::AddEntry(const std::vector<noise_hit>& entry_hits){
+	++nentries;
+	if(entry_hits.empty()) return;
+
+	// as many windows as fit, centred in the entry
+	const float entry_length = entry_hits.back().t - entry_hits.front().t;
+	const int nwindows = static_cast<int>(entry_length / window_width);
+	if(nwindows==0) return;
+	const float t0 = entry_hits.front().t + (entry_length - nwindows*window_width)/2.;
+
+	auto next_hit = entry_hits.begin();
+	for(int w=0; w<nwindows; ++w){
+		const float window_start = t0 + w*window_width;
+		const float window_end = window_start + window_width;
+		while(next_hit!=entry_hits.end() && next_hit->t<window_start) ++next_hit;
+		for(; next_hit!=entry_hits.end() && next_hit->t<window_end; ++next_hit){
+			hits.push_back(noise_hit{next_hit->t - window_start, next_hit->q, next_hit->i});
+		}
+		window_offsets.push_back(hits.size());
+	}
+}
@@ -0,0 +1,50 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef NOISE_POOL_H
+#define NOISE_POOL_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// The hits of dummy-trigger (random trigger) events, decoded once and kept in memory as
+// fixed-width, time-sorted windows of detector noise to be added to MC events (see AddNoise).
+// Each noise entry is cut into as many windows of the given width as fit, centred in the entry,
+// and the hit times of each window are stored relative to its start. Hits are kept as plain
+// (t, q, cable) triplets, so even thousands of 500 us windows take only a few hundred MB.
+// Once loaded the pool is read-only, so one pool may be shared by any number of Tools and threads.
+
+struct noise_hit {
+	float t;            // ns from the start of the window
+	float q;            // p.e.
+	unsigned int i;     // cable number
+};
+
+class NoisePool {
+
+	public:
+	// read the TQREAL hits of the files matching noise_files (wildcards allowed) and cut them into
+	// windows of window_width ns. Reads at most max_entries entries (<=0 for all), decoding
+	// files with up to nthreads threads (0 for the number of cores).
+	bool Load(const std::string& noise_files, float window_width, long max_entries=0, int nthreads=1,
+	          int verbose=1, const std::string& tree_name="data");
+
+	size_t GetNWindows() const { return window_offsets.empty() ? 0 : window_offsets.size()-1; }
+	size_t GetNHits() const { return hits.size(); }
+	float GetWindowWidth() const { return window_width; }
+	long GetNEntries() const { return nentries; }
+	// the hits of a window, sorted by time
+	const noise_hit* WindowBegin(size_t window) const { return hits.data()+window_offsets[window]; }
+	const noise_hit* WindowEnd(size_t window) const { return hits.data()+window_offsets[window+1]; }
+
+	private:
+	// append the windows of one noise entry, given its hits sorted by time
+	void AddEntry(const std::vector<noise_hit>& entry_hits);
+
+	float window_width=0;
+	long nentries=0;
+	std::vector<noise_hit> hits;           // all windows, one after the other
+	std::vector<size_t> window_offsets;    // index in hits of the first hit of each window, then hits.size()
+
+};
+
+#endif
@@ -58,6 +58,20 @@ void PMTHitCluster::Sort()
     bSorted = true;
 }
 
+void PMTHitCluster::MergeSorted(const std::vector<PMTHit>& sortedHits)
+{
+    // hits appended since the last sort may be out of order
+    if (!std::is_sorted(element.begin(), element.end()))
+        std::sort(element.begin(), element.end());
+
+    std::size_t nOld = element.size();
+    element.reserve(nOld + sortedHits.size());
+    for (auto const& hit: sortedHits)
+        Append(hit);
+    std::inplace_merge(element.begin(), element.begin() + nOld, element.end());
+    bSorted = true;
+}
+
 PMTHitCluster PMTHitCluster::Slice(int startIndex, float tWidth)
 {
     if (!bSorted)
@@ -24,6 +24,8 @@ class PMTHitCluster : public Cluster<PMTHit>
         void RemoveVertex();
 
         void Sort();
+        // merge in hits already sorted by time, keeping the cluster sorted, in linear time
+        void MergeSorted(const std::vector<PMTHit>& sortedHits);
 
         void DumpAllElements() { for (auto& hit: element) hit.Dump(); }
 
@@ -0,0 +1,51 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef PARALLELFOR_H
+#define PARALLELFOR_H
+
+#include <thread>
+#include <vector>
+#include <exception>
+#include <algorithm>
+
+// Run func(i, thread_i) for every i in [0, n), statically partitioning the range
+// into contiguous blocks across nthreads threads. The calling thread processes
+// the first block, so nthreads<=1 simply runs the loop serially.
+// Each index is visited by exactly one thread, and thread_i is in [0, nthreads),
+// so callers may keep per-thread state (e.g. a minimizer or random generator) in a
+// vector indexed by thread_i. Block boundaries depend only on n and nthreads,
+// not on scheduling, so results written by index are reproducible.
+// The first exception thrown by any thread is rethrown once all threads have joined.
+template<typename F>
+void ParallelFor(size_t n, int nthreads, F&& func){
+	if(n==0) return;
+	size_t nworkers = std::max(1, std::min(nthreads, static_cast<int>(n)));
+	if(nworkers==1){
+		for(size_t i=0; i<n; ++i) func(i, 0);
+		return;
+	}
+
+	std::vector<std::exception_ptr> errors(nworkers);
+	auto run_block = [&](size_t thread_i){
+		size_t first = (n*thread_i)/nworkers;
+		size_t last = (n*(thread_i+1))/nworkers;
+		try {
+			for(size_t i=first; i<last; ++i) func(i, static_cast<int>(thread_i));
+		} catch(...){
+			errors.at(thread_i) = std::current_exception();
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(nworkers-1);
+	for(size_t thread_i=1; thread_i<nworkers; ++thread_i){
+		workers.emplace_back(run_block, thread_i);
+	}
+	run_block(0);
+	for(std::thread& aworker : workers) aworker.join();
+
+	for(std::exception_ptr& anerror : errors){
+		if(anerror) std::rethrow_exception(anerror);
+	}
+}
+
+#endif
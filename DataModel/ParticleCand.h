@@ -23,6 +23,7 @@ struct ParticleCand {
 	skroot_lowe_common LowECommon;
 	bool hasAFT;
 	int AFTEntryNum; // may not be InEntryNumber+1...
+	bool Overlap = false; // from the overlap prefix of a shard: a matching target only
 };
 
 #endif
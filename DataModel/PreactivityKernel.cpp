@@ -0,0 +1,178 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "PreactivityKernel.h"
+#include "Constants.h"
+
+#include <cmath>
+#include <algorithm>
+
+void PreactivityKernel::SetPMTPosition(int cable, const float pos[3]){
+	if(cable<0) return;
+	if(size_t(cable)>=pmt_known.size()){
+		pmt_x.resize(cable+1, 0);
+		pmt_y.resize(cable+1, 0);
+		pmt_z.resize(cable+1, 0);
+		pmt_known.resize(cable+1, false);
+	}
+	pmt_x[cable] = pos[0];
+	pmt_y[cable] = pos[1];
+	pmt_z[cable] = pos[2];
+	pmt_known[cable] = true;
+}
+
+void PreactivityKernel::SetHits(int nhits, const int* cables, const float* times, const float* charges,
+                                const int* flags, const float vertex[4]){
+	hit_x.clear();
+	hit_y.clear();
+	hit_z.clear();
+	hit_t.clear();
+	hit_q.clear();
+	hit_in_gate.clear();
+	for(int hit_i=0; hit_i<nhits; ++hit_i){
+		const int cable = cables[hit_i];
+		if(!HasPMT(cable)) continue;
+		hit_x.push_back(pmt_x[cable]);
+		hit_y.push_back(pmt_y[cable]);
+		hit_z.push_back(pmt_z[cable]);
+		hit_t.push_back(times[hit_i]);
+		hit_q.push_back(charges[hit_i]);
+		hit_in_gate.push_back(flags[hit_i] & 0x01);
+	}
+
+	// time of flight subtraction, over flat arrays so that it can be vectorised
+	const size_t n = hit_t.size();
+	const float vx=vertex[0], vy=vertex[1], vz=vertex[2], vt=vertex[3];
+	const float inv_c = 1.f/SOL_IN_CM_PER_NS_IN_WATER;
+	float* t = hit_t.data();
+	const float* x = hit_x.data();
+	const float* y = hit_y.data();
+	const float* z = hit_z.data();
+	for(size_t i=0; i<n; ++i){
+		const float dx=x[i]-vx, dy=y[i]-vy, dz=z[i]-vz;
+		t[i] = t[i] - vt - std::sqrt(dx*dx + dy*dy + dz*dz)*inv_c;
+	}
+
+	any_in_gate=false;
+	for(size_t i=0; i<n; ++i){
+		if(!hit_in_gate[i]) continue;
+		if(!any_in_gate || hit_t[i]<first_in_gate) first_in_gate = hit_t[i];
+		any_in_gate=true;
+	}
+}
+
+void PreactivityKernel::SortHits(){
+	// bucket sort: about one bucket per hit over the range of times,
+	// then an insertion sort of the few hits within each bucket
+	const size_t n = hit_t.size();
+	if(n<2) return;
+	const auto minmax = std::minmax_element(hit_t.begin(), hit_t.end());
+	const double tmin = *minmax.first;
+	const double range = double(*minmax.second) - tmin;
+	const size_t nbuckets = n;
+	const double scale = (range>0) ? (nbuckets-1)/range : 0;
+	auto bucket = [&](float t){
+		size_t b = size_t((t-tmin)*scale);
+		return (b<nbuckets) ? b : nbuckets-1;
+	};
+
+	bucket_start.assign(nbuckets+1, 0);
+	for(size_t i=0; i<n; ++i) ++bucket_start[bucket(hit_t[i])+1];
+	for(size_t b=0; b<nbuckets; ++b) bucket_start[b+1] += bucket_start[b];
+	order.resize(n);
+	for(size_t i=0; i<n; ++i) order[bucket_start[bucket(hit_t[i])]++] = i;
+	// bucket_start[b] is now the end of bucket b
+	size_t begin=0;
+	for(size_t b=0; b<nbuckets; ++b){
+		const size_t end = bucket_start[b];
+		if(end-begin>16){
+			// many hits at nearly the same time, e.g. when a few outliers stretch the range
+			std::sort(order.begin()+begin, order.begin()+end,
+			          [this](uint32_t h1, uint32_t h2){ return hit_t[h1]<hit_t[h2]; });
+			begin = end;
+			continue;
+		}
+		for(size_t i=begin+1; i<end; ++i){
+			const uint32_t hit = order[i];
+			size_t j=i;
+			for(; j>begin && hit_t[order[j-1]]>hit_t[hit]; --j) order[j] = order[j-1];
+			order[j] = hit;
+		}
+		begin = end;
+	}
+
+	sort_t.resize(n);
+	sort_q.resize(n);
+	for(size_t i=0; i<n; ++i){
+		sort_t[i] = hit_t[order[i]];
+		sort_q[i] = hit_q[order[i]];
+	}
+	hit_t.swap(sort_t);
+	hit_q.swap(sort_q);
+}
+
+double PreactivityKernel::MaxQ50N50() const {
+	// windows starting at each hit, with a running sum of the charge within them
+	const size_t n = hit_t.size();
+	double max_ratio=0;
+	double q_sum=0;
+	size_t end=0;
+	for(size_t start=0; start<n; ++start){
+		while(end<n && hit_t[end]-hit_t[start]<q50n50_window){
+			q_sum += hit_q[end];
+			++end;
+		}
+		max_ratio = std::max(max_ratio, q_sum/(end-start));
+		q_sum -= hit_q[start];
+	}
+	return max_ratio;
+}
+
+void PreactivityKernel::CalculateGoodness(){
+	// only hits within goodness_range of each other contribute, so for sorted hits
+	// each only needs those between two pointers that move forward with it
+	const size_t n = hit_t.size();
+	const double inv_sigma2 = 1./(goodness_sigma*goodness_sigma);
+	hit_goodness.assign(n, 0);
+	size_t low=0;
+	size_t high=0;
+	for(size_t i=0; i<n; ++i){
+		while(hit_t[i]-hit_t[low]>=goodness_range) ++low;
+		while(high<n && hit_t[high]-hit_t[i]<goodness_range) ++high;
+		double goodness=0;
+		for(size_t j=low; j<high; ++j){
+			if(j==i) continue;
+			const double dt = hit_t[j]-hit_t[i];
+			goodness += std::exp(-0.5*dt*dt*inv_sigma2);
+		}
+		hit_goodness[i] = goodness;
+	}
+}
+
+preactivity_observables PreactivityKernel::Compute(){
+	preactivity_observables result;
+	if(hit_t.empty()) return result;
+	SortHits();
+
+	result.q50n50_ratio = MaxQ50N50();
+
+	CalculateGoodness();
+	const double max_goodness = *std::max_element(hit_goodness.begin(), hit_goodness.end());
+	good_t.clear();
+	for(size_t i=0; i<hit_t.size(); ++i){
+		if(hit_goodness[i] >= dark_threshold + fraction*max_goodness*std::exp(-hit_t[i]/60.)){
+			good_t.push_back(hit_t[i]);
+		}
+	}
+
+	// windows of good hits starting at each one, until they reach the event
+	size_t end=0;
+	for(size_t start=0; start<good_t.size(); ++start){
+		if(end<start) end=start;
+		while(end<good_t.size() && good_t[end]-good_t[start]<preact_window) ++end;
+		if(good_t[end-1]>=preact_end) break;
+		const int nhits = end-start;
+		result.max_pre = std::max(result.max_pre, nhits);
+		if(any_in_gate && good_t[start]>=first_in_gate) result.max_pregate = std::max(result.max_pregate, nhits);
+	}
+
+	return result;
+}
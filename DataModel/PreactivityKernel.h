@@ -0,0 +1,76 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef PREACTIVITY_KERNEL_H
+#define PREACTIVITY_KERNEL_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Pre-activity observables of a lowe event, calculated from its hits with the time of flight
+// from the reconstructed vertex subtracted:
+// - q50n50_ratio: the largest mean charge per hit of the hits in a 50 ns window
+// - max_pre: the largest number of good hits in a 15 ns window ending before the event (-12 ns)
+// - max_pregate: as max_pre, for windows starting after the earliest in-gate hit
+// A hit is good if its goodness, the sum over other hits within 25 ns of exp(-0.5*(dt/5 ns)^2),
+// is above dark_threshold + fraction*max_goodness*exp(-t/60 ns).
+//
+// The kernel is built to be run on every lowe candidate: PMT positions are cached once by cable
+// number, times of flight are computed over flat arrays, hits are bucket sorted in time (their times
+// span a bounded readout window, so with one bucket per hit each holds only a few), and each window
+// is slid over the sorted hits with running counts and sums, so all but the goodness are O(n).
+// Buffers are kept between events.
+
+struct preactivity_observables {
+	double q50n50_ratio=0;
+	int max_pre=0;
+	int max_pregate=0;
+};
+
+class PreactivityKernel {
+
+	public:
+	double dark_threshold=4;
+	double fraction=0.4;
+	double q50n50_window=50;     // [ns]
+	double preact_window=15;     // [ns]
+	double preact_end=-12;       // [ns] windows for max_pre must end before this
+	double goodness_sigma=5;     // [ns]
+	double goodness_range=25;    // [ns] hits further apart than this don't add to each other's goodness
+
+	// PMT positions [cm] by cable number, e.g. from the ConnectionTable
+	void SetPMTPosition(int cable, const float pos[3]);
+	bool HasPMT(int cable) const { return cable>=0 && size_t(cable)<pmt_known.size() && pmt_known[cable]; }
+
+	// hits of an event, given as the sktqz_ arrays, and the vertex [cm] and time [ns] of the event.
+	// Bit 0 of the flags marks in-gate hits. Hits on cables without a position are ignored.
+	void SetHits(int nhits, const int* cables, const float* times, const float* charges, const int* flags,
+	             const float vertex[4]);
+	preactivity_observables Compute();
+
+	private:
+	void SortHits();
+	double MaxQ50N50() const;
+	void CalculateGoodness();
+
+	// cached PMT positions, by cable
+	std::vector<float> pmt_x, pmt_y, pmt_z;
+	std::vector<char> pmt_known;
+
+	// hits of the current event
+	std::vector<float> hit_x, hit_y, hit_z;   // PMT positions gathered for the time of flight
+	std::vector<float> hit_t;                 // ToF-subtracted time
+	std::vector<float> hit_q;
+	std::vector<char> hit_in_gate;
+	std::vector<double> hit_goodness;
+	double first_in_gate=0;
+	bool any_in_gate=false;
+
+	// sorting buffers
+	std::vector<uint32_t> bucket_start;
+	std::vector<uint32_t> order;
+	std::vector<float> sort_t, sort_q;
+	std::vector<float> good_t;
+
+};
+
+#endif
@@ -0,0 +1,199 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "RunConditions.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+namespace {
+
+struct flag_name {
+	uint32_t flag;
+	const char* name;
+};
+
+const flag_name flag_names[] = {
+	{RunConditions::bad_run, "bad_run"},
+	{RunConditions::short_run, "short_run"},
+	{RunConditions::after_hv_recovery, "after_hv_recovery"},
+	{RunConditions::test_run, "test_run"},
+	{RunConditions::calibration_run, "calibration_run"},
+	{RunConditions::hardware_problem, "hardware_problem"},
+	{RunConditions::odd_distribution, "odd_distribution"}
+};
+
+} // end anonymous namespace
+
+uint32_t RunConditions::FlagFromName(const std::string& name){
+	for(const flag_name& aflag : flag_names){
+		if(name==aflag.name) return aflag.flag;
+	}
+	return 0;
+}
+
+std::string RunConditions::FlagNames(uint32_t flags){
+	std::string names;
+	for(const flag_name& aflag : flag_names){
+		if((flags & aflag.flag)==0) continue;
+		if(!names.empty()) names += ", ";
+		names += aflag.name;
+	}
+	return "["+names+"]";
+}
+
+void RunConditions::Clear(){
+	listed_runs.clear();
+	rules.clear();
+	min_livetime=-1;
+	built=false;
+}
+
+bool RunConditions::Load(const std::string& filename){
+	std::ifstream infile(filename);
+	if(!infile.is_open()){
+		std::cerr<<"RunConditions::Load error! Could not open "<<filename<<std::endl;
+		return false;
+	}
+	std::string line;
+	int line_num=0;
+	while(std::getline(infile, line)){
+		++line_num;
+		std::istringstream ss(line);
+		std::string key;
+		if(!(ss >> key) || key[0]=='#') continue;
+		bool ok=false;
+		if(key=="run"){
+			int run, run_type, first_subrun, last_subrun;
+			float livetime;
+			ok = bool(ss >> run >> run_type >> livetime >> first_subrun >> last_subrun);
+			if(ok) SetRun(run, run_type, livetime, first_subrun, last_subrun);
+		} else if(key=="flag"){
+			int run_min, run_max;
+			ok = bool(ss >> run_min >> run_max);
+			uint32_t flags=0;
+			std::string name;
+			while(ok && ss >> name){
+				if(name[0]=='#') break;
+				uint32_t aflag = FlagFromName(name);
+				if(aflag==0){
+					std::cerr<<"RunConditions::Load error! Unknown flag '"<<name<<"' on line "<<line_num
+					         <<" of "<<filename<<std::endl;
+					return false;
+				}
+				flags |= aflag;
+			}
+			ok = ok && flags!=0;
+			if(ok) FlagRuns(run_min, run_max, flags);
+		} else if(key=="energy"){
+			int run_min, run_max;
+			float energy_min, energy_max;
+			ok = bool(ss >> run_min >> run_max >> energy_min >> energy_max);
+			if(ok) AddEnergyRange(run_min, run_max, energy_min, energy_max);
+		} else if(key=="min_livetime"){
+			float seconds;
+			ok = bool(ss >> seconds);
+			if(ok) SetMinLivetime(seconds);
+		} else {
+			std::cerr<<"RunConditions::Load error! Unknown key '"<<key<<"' on line "<<line_num
+			         <<" of "<<filename<<std::endl;
+			return false;
+		}
+		if(!ok){
+			std::cerr<<"RunConditions::Load error! Could not parse line "<<line_num<<" of "<<filename
+			         <<": '"<<line<<"'"<<std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+void RunConditions::SetRun(int run, int run_type, float livetime, int first_subrun, int last_subrun){
+	// a run listed more than once takes its last entry
+	run_conditions arun;
+	arun.run = run;
+	arun.listed = true;
+	arun.run_type = run_type;
+	arun.livetime = livetime;
+	arun.first_subrun = first_subrun;
+	arun.last_subrun = last_subrun;
+	listed_runs.push_back(arun);
+	built=false;
+}
+
+void RunConditions::FlagRuns(int run_min, int run_max, uint32_t flags){
+	rules.push_back(run_rule{run_min, run_max, flags, -1, -1});
+	built=false;
+}
+
+void RunConditions::AddEnergyRange(int run_min, int run_max, float energy_min, float energy_max){
+	rules.push_back(run_rule{run_min, run_max, 0, energy_min, energy_max});
+	built=false;
+}
+
+void RunConditions::SetMinLivetime(float seconds){
+	min_livetime = seconds;
+	built=false;
+}
+
+void RunConditions::ApplyRule(const run_rule& rule, run_conditions& record){
+	record.flags |= rule.flags;
+	if(rule.energy_min>=0) record.energy_min = std::max(record.energy_min, rule.energy_min);
+	if(rule.energy_max>=0){
+		record.energy_max = (record.energy_max<0) ? rule.energy_max : std::min(record.energy_max, rule.energy_max);
+	}
+}
+
+void RunConditions::Build() const {
+	table.clear();
+	before = run_conditions{};
+	after = run_conditions{};
+
+	// the table spans all listed runs and the limits of all rules
+	int last_run=-1;
+	first_run=-1;
+	auto extend = [&](int run){
+		if(run<0) return;
+		if(first_run<0 || run<first_run) first_run = run;
+		if(run>last_run) last_run = run;
+	};
+	for(const run_conditions& arun : listed_runs) extend(arun.run);
+	for(const run_rule& rule : rules){
+		extend(rule.run_min);
+		extend(rule.run_max);
+	}
+
+	if(first_run>=0){
+		table.resize(last_run-first_run+1);
+		for(size_t i=0; i<table.size(); ++i) table[i].run = first_run+i;
+		for(const run_conditions& arun : listed_runs){
+			if(arun.run>=0) table[arun.run-first_run] = arun;
+		}
+	} else {
+		first_run=0;
+	}
+
+	for(const run_rule& rule : rules){
+		if(rule.run_min<0) ApplyRule(rule, before);
+		if(rule.run_max<0) ApplyRule(rule, after);
+		if(table.empty()) continue;
+		const int from = (rule.run_min<0) ? first_run : rule.run_min;
+		const int to = (rule.run_max<0) ? last_run : rule.run_max;
+		for(int run=from; run<=to; ++run) ApplyRule(rule, table[run-first_run]);
+	}
+
+	if(min_livetime>0){
+		for(run_conditions& arun : table){
+			if(arun.listed && arun.livetime>=0 && arun.livetime<min_livetime) arun.flags |= short_run;
+		}
+	}
+
+	built=true;
+}
+
+const run_conditions& RunConditions::Get(int run) const {
+	if(!built) Build();
+	if(run<first_run) return before;
+	if(size_t(run-first_run)>=table.size()) return after;
+	return table[run-first_run];
+}
@@ -0,0 +1,93 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef RUN_CONDITIONS_H
+#define RUN_CONDITIONS_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Per-run conditions: data quality flags, run type, livetime, subrun range and the range of
+// lowe energies to accept. They are read from flat text files (see Load) and from rules added
+// by Tools over ranges of runs. All of these are resolved into a table with one record per run,
+// so looking up a run is a single index however many rules there are.
+// The ToolChain's shared conditions are m_data->runConditions, filled by LoadRunConditions.
+
+struct run_conditions {
+	int32_t run=-1;               // -1 for runs before or after all those listed or given in a rule
+	bool listed=false;            // whether the run has a 'run' line in a conditions file
+	uint32_t flags=0;             // RunConditions::Flag bits; 0 for a good run
+	int32_t run_type=-1;          // mdrnsk, see RunModeToName
+	float livetime=-1;            // [s]
+	int32_t first_subrun=-1;
+	int32_t last_subrun=-1;
+	float energy_min=-1;          // [MeV] range of energies to accept, -1 for no limit
+	float energy_max=-1;
+
+	bool Good() const { return flags==0; }
+	bool AcceptsEnergy(float energy) const {
+		return (energy_min<0 || energy>=energy_min) && (energy_max<0 || energy<=energy_max);
+	}
+};
+
+class RunConditions {
+
+	public:
+	enum Flag : uint32_t {
+		bad_run=1,                // e.g. as lfbadrun
+		short_run=2,              // livetime below the minimum
+		after_hv_recovery=4,      // started too soon after HV recovery
+		test_run=8,
+		calibration_run=16,
+		hardware_problem=32,
+		odd_distribution=64       // odd event distributions
+	};
+	static uint32_t FlagFromName(const std::string& name);  // 0 if not a known flag
+	static std::string FlagNames(uint32_t flags);
+
+	// read a conditions file of lines:
+	//   run <run> <run type> <livetime [s]> <first subrun> <last subrun>
+	//   flag <run min> <run max> <flag name> [<flag name>...]
+	//   energy <run min> <run max> <energy min> <energy max>
+	//   min_livetime <seconds>
+	// where -1 for a run or energy limit means no limit. Lines starting with '#' are ignored.
+	bool Load(const std::string& filename);
+	void Clear();
+
+	void SetRun(int run, int run_type, float livetime, int first_subrun, int last_subrun);
+	// rules for runs in [run_min, run_max], with -1 for either meaning no limit.
+	// Energy ranges of rules covering the same run are intersected.
+	void FlagRuns(int run_min, int run_max, uint32_t flags);
+	void AddEnergyRange(int run_min, int run_max, float energy_min, float energy_max);
+	// listed runs with a livetime shorter than this are flagged as short_run
+	void SetMinLivetime(float seconds);
+
+	// conditions of a run. The table is rebuilt on the first lookup after a change,
+	// so changes should be made when Tools are initialised, not alongside lookups.
+	const run_conditions& Get(int run) const;
+	bool RunIsGood(int run) const { return Get(run).Good(); }
+	bool Empty() const { return listed_runs.empty() && rules.empty(); }
+
+	private:
+	struct run_rule {
+		int run_min;
+		int run_max;
+		uint32_t flags;
+		float energy_min;
+		float energy_max;
+	};
+	static void ApplyRule(const run_rule& rule, run_conditions& record);
+	void Build() const;
+
+	std::vector<run_conditions> listed_runs;
+	std::vector<run_rule> rules;
+	float min_livetime=-1;
+
+	mutable bool built=true;
+	mutable int first_run=0;
+	mutable std::vector<run_conditions> table;  // runs first_run to first_run+table.size()-1
+	mutable run_conditions before;              // runs below and above those in the table
+	mutable run_conditions after;
+
+};
+
+#endif
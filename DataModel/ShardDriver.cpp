@@ -0,0 +1,813 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "ShardDriver.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <set>
+#include <tuple>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TEntryList.h"
+#include "TObjArray.h"
+#include "TParameter.h"
+#include "TNamed.h"
+#include "TList.h"
+#include "TFileMerger.h"
+
+#include "Algorithms.h"            // ReadListFromFile
+#include "FindFilesInDirectory.h"
+#include "TriggerIndex.h"
+#include "SkrootHeaders.h"         // Header
+#include "skheadC.h"               // COUNT_PER_NSEC
+
+namespace {
+
+// split a config file line into its key and (first) value, ignoring comments and blank lines
+bool ParseConfigLine(const std::string& line, std::string& key, std::string& value){
+	std::stringstream ss(line.substr(0, line.find('#')));
+	key="";
+	value="";
+	ss >> key >> value;
+	return !key.empty();
+}
+
+std::map<std::string, std::string> ReadConfig(const std::string& config_file){
+	std::map<std::string, std::string> config;
+	std::ifstream infile(config_file);
+	std::string line, key, value;
+	while(std::getline(infile, line)){
+		if(ParseConfigLine(line, key, value)) config[key] = value;
+	}
+	return config;
+}
+
+bool FileExists(const std::string& filename){
+	struct stat info;
+	return stat(filename.c_str(), &info)==0;
+}
+
+std::string BaseName(const std::string& path){
+	return path.substr(path.find_last_of('/')+1);
+}
+
+bool MakeDirectory(const std::string& dir){
+	// make each missing directory in the path in turn, like mkdir -p
+	for(size_t pos=dir.find('/',1); ; pos=dir.find('/',pos+1)){
+		std::string subdir = dir.substr(0,pos);
+		if(mkdir(subdir.c_str(), 0755)!=0 && errno!=EEXIST){
+			std::cerr<<"ShardDriver error! Could not make directory "<<subdir<<": "<<strerror(errno)<<std::endl;
+			return false;
+		}
+		if(pos==std::string::npos) break;
+	}
+	return true;
+}
+
+} // end anonymous namespace
+
+ShardDriver::ShardDriver(const std::string& toolchain_config_in, int nshards_in, const std::string& shard_dir_in)
+  : toolchain_config(toolchain_config_in), shard_dir(shard_dir_in), nshards(nshards_in){
+	while(shard_dir.size()>1 && shard_dir.back()=='/') shard_dir.pop_back();
+}
+
+int ShardDriver::Run(const std::string& executable){
+	if(nshards<1){
+		std::cerr<<"ShardDriver error! Number of shards must be positive, not "<<nshards<<std::endl;
+		return 1;
+	}
+	if(!ReadToolChain() || !MakeShardConfigs()) return 1;
+	auto start = std::chrono::steady_clock::now();
+	if(!LaunchShards(executable)) return 1;
+	if(!WaitForShards()){
+		std::cerr<<"ShardDriver error! Not all shards completed successfully; outputs have not been merged. "
+		         <<"See the logs in "<<shard_dir<<std::endl;
+		return 1;
+	}
+	if(verbosity){
+		std::cout<<"ShardDriver: all "<<nshards<<" shards finished in "
+		         <<std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count()
+		         <<"s, merging outputs"<<std::endl;
+	}
+	if(!MergeOutputs()) return 1;
+	return 0;
+}
+
+bool ShardDriver::ReadToolChain(){
+	std::ifstream infile(toolchain_config);
+	if(!infile.is_open()){
+		std::cerr<<"ShardDriver error! Could not open ToolChain config "<<toolchain_config<<std::endl;
+		return false;
+	}
+	std::string line, key, value;
+	while(std::getline(infile, line)){
+		toolchain_lines.push_back(line);
+		if(ParseConfigLine(line, key, value) && key=="Tools_File") tools_file = value;
+	}
+	if(tools_file.empty()){
+		std::cerr<<"ShardDriver error! No Tools_File in "<<toolchain_config<<std::endl;
+		return false;
+	}
+
+	std::ifstream toolsfile(tools_file);
+	if(!toolsfile.is_open()){
+		std::cerr<<"ShardDriver error! Could not open Tools_File "<<tools_file<<std::endl;
+		return false;
+	}
+	while(std::getline(toolsfile, line)){
+		std::stringstream ss(line.substr(0, line.find('#')));
+		tool_config atool;
+		if(!(ss >> atool.name >> atool.tool_class)) continue;
+		ss >> atool.config_file;
+		tools.push_back(atool);
+		if(atool.tool_class=="LoadFileList"){
+			if(!file_list_tool.empty()){
+				std::cerr<<"ShardDriver error! ToolChain has more than one LoadFileList Tool; "
+				         <<"don't know which file list to split"<<std::endl;
+				return false;
+			}
+			file_list_tool = atool.name;
+		}
+	}
+	if(file_list_tool.empty()){
+		std::cerr<<"ShardDriver error! ToolChain has no LoadFileList Tool, so there are no files to split"<<std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool ShardDriver::GetFileList(const std::string& config_file, std::vector<std::string>& files) const {
+	// the same file search as LoadFileList
+	std::map<std::string, std::string> config = ReadConfig(config_file);
+	files.clear();
+	if(config["inputFile"]!=""){
+		files.push_back(config["inputFile"]);
+	} else if(config["fileList"]!=""){
+		ReadListFromFile(config["fileList"], files);
+		if(!files.empty() && files.front().find('/')==std::string::npos){
+			for(std::string& afile : files) afile = config["inputDirectory"] + "/" + afile;
+		}
+	} else if(config["inputDirectory"]!=""){
+		bool use_regex = (config["useRegex"]=="1" || config["useRegex"]=="true");
+		int max_depth = config.count("maxSubdirDepth") ? std::stoi(config["maxSubdirDepth"]) : 0;
+		int nthreads = config.count("scanThreads") ? std::stoi(config["scanThreads"]) : 0;
+		FileCatalogue catalogue;
+		FileCatalogue* catalogue_p = nullptr;
+		if(config["catalogueFile"]!=""){
+			catalogue.Read(config["catalogueFile"]);
+			catalogue_p = &catalogue;
+		}
+		FindFilesInDirectory(config["inputDirectory"], config["filePattern"], files, false, max_depth, use_regex,
+		                     nullptr, nullptr, false, catalogue_p, nthreads);
+		if(catalogue_p && catalogue.Modified()) catalogue.Write(config["catalogueFile"]);
+	}
+	int max_files = config.count("maxFiles") ? std::stoi(config["maxFiles"]) : 0;
+	if(max_files>0 && int(files.size())>max_files) files.resize(max_files);
+	return !files.empty();
+}
+
+std::string ShardDriver::ShardOutputPath(const std::string& path, int shard){
+	// outputs of all shards use the same name within their shard directory
+	if(shard_names.count(path)==0){
+		std::string name = path.substr(path.find_last_of('/')+1);
+		std::string unique_name = name;
+		std::set<std::string> used_names;
+		for(auto&& aname : shard_names) used_names.insert(aname.second);
+		for(int i=1; used_names.count(unique_name); ++i) unique_name = std::to_string(i)+"_"+name;
+		shard_names.emplace(path, unique_name);
+		outputs.push_back(output_file{path, std::vector<std::string>(nshards)});
+	}
+	std::string shard_path = shard_dir+"/shard_"+std::to_string(shard)+"/"+shard_names.at(path);
+	for(output_file& anoutput : outputs){
+		if(anoutput.path==path) anoutput.shard_paths.at(shard) = shard_path;
+	}
+	return shard_path;
+}
+
+bool ShardDriver::CopyConfig(const std::string& config_in, const std::string& config_out, int shard, bool is_file_list,
+                             const std::map<std::string, std::string>& overrides){
+	std::ifstream infile(config_in);
+	std::ofstream outfile(config_out);
+	if(!infile.is_open() || !outfile.is_open()){
+		std::cerr<<"ShardDriver error! Could not copy config "<<config_in<<" to "<<config_out<<std::endl;
+		return false;
+	}
+	// where the input files come from; replaced by the shard's file list
+	static const std::set<std::string> file_list_keys{"inputFile", "fileList", "inputDirectory", "filePattern",
+	                                                  "useRegex", "maxFiles", "maxSubdirDepth", "catalogueFile",
+	                                                  "catalogueTreeName", "scanThreads"};
+	std::string line, key, value;
+	while(std::getline(infile, line)){
+		if(ParseConfigLine(line, key, value)){
+			if(is_file_list && file_list_keys.count(key)) continue;
+			if(overrides.count(key)) continue;
+			if(!value.empty() && std::find(output_keys.begin(), output_keys.end(), key)!=output_keys.end()){
+				line = key+" "+ShardOutputPath(value, shard);
+			}
+		}
+		outfile<<line<<"\n";
+	}
+	if(is_file_list) outfile<<"fileList "<<shard_dir<<"/shard_"<<shard<<"/files.txt\n";
+	for(auto&& anoverride : overrides) outfile<<anoverride.first<<" "<<anoverride.second<<"\n";
+	return outfile.good();
+}
+
+bool ShardDriver::MakeShardConfigs(){
+	std::vector<std::string>& files = input_files;
+	std::string file_list_name;
+	for(const tool_config& atool : tools){
+		if(atool.name!=file_list_tool) continue;
+		GetFileList(atool.config_file, files);
+		file_list_name = ReadConfig(atool.config_file)["FileListName"];
+	}
+	if(files.empty()){
+		std::cerr<<"ShardDriver error! LoadFileList Tool "<<file_list_tool<<" found no files"<<std::endl;
+		return false;
+	}
+	if(int(files.size())<nshards){
+		std::cout<<"ShardDriver: only "<<files.size()<<" input files, reducing to "<<files.size()<<" shards"<<std::endl;
+		nshards = files.size();
+	}
+
+	// the TreeReaders of those files, which give the tree that entry numbers refer to
+	for(const tool_config& atool : tools){
+		if(atool.tool_class!="TreeReader" || file_list_name.empty()) continue;
+		std::map<std::string, std::string> config = ReadConfig(atool.config_file);
+		if(config["FileListName"]!=file_list_name) continue;
+		reader_tools.push_back(atool.name);
+		if(config["treeName"]!="") input_tree_name = config["treeName"];
+		trigger_index_dir = config["triggerIndexDir"];
+	}
+	for(const tool_config& atool : tools){
+		if(atool.tool_class!="RelicMuonMatching") continue;
+		std::string match_window = ReadConfig(atool.config_file)["match_window"];
+		if(!match_window.empty() && overlap_secs<std::stod(match_window)){
+			std::cout<<"ShardDriver warning! "<<atool.name<<" matches events up to "<<match_window
+			         <<"s apart, but shards only overlap by "<<overlap_secs<<"s; matches across "
+			         <<"shard boundaries will be missed. Use --shardOverlap "<<match_window<<std::endl;
+		}
+	}
+	if(overlap_secs>0 && reader_tools.empty()){
+		std::cerr<<"ShardDriver error! Found no TreeReader of the files of "<<file_list_tool
+		         <<" to start from the shard overlap"<<std::endl;
+		return false;
+	}
+
+	// contiguous blocks of files, so that entry numbers of the full chain follow shard order
+	shard_files.resize(nshards);
+	shard_first_file.resize(nshards);
+	shard_own_file.resize(nshards);
+	for(int shard=0; shard<nshards; ++shard){
+		shard_own_file[shard] = (files.size()*shard)/nshards;
+		shard_first_file[shard] = shard_own_file[shard];
+		size_t end_file = (files.size()*(shard+1))/nshards;
+
+		// with an overlap, also the preceding files with events in that time before this shard
+		std::map<std::string, std::string> reader_overrides, matcher_overrides;
+		long first_entry=0, overlap_entries=0;
+		if(overlap_secs>0 && shard>0){
+			if(!FindOverlap(shard, shard_first_file[shard], first_entry, overlap_entries)) return false;
+			reader_overrides.emplace("firstEntry", std::to_string(first_entry));
+			matcher_overrides.emplace("overlapEntries", std::to_string(overlap_entries));
+		}
+		shard_files[shard].assign(files.begin()+shard_first_file[shard], files.begin()+end_file);
+
+		const std::string dir = shard_dir+"/shard_"+std::to_string(shard)+"/";
+		if(!MakeDirectory(dir.substr(0,dir.size()-1))) return false;
+
+		// LoadFileList takes paths with no '/' to be relative to its inputDirectory
+		std::ofstream filelist(dir+"files.txt");
+		for(const std::string& afile : shard_files[shard]){
+			filelist<<(afile.find('/')==std::string::npos ? "./" : "")<<afile<<"\n";
+		}
+
+		std::ofstream toolsconfig(dir+"ToolsConfig");
+		static const std::map<std::string, std::string> no_overrides;
+		for(const tool_config& atool : tools){
+			std::string config_out = atool.config_file.empty() ? "" : dir+atool.name+"Config";
+			const bool is_reader = std::find(reader_tools.begin(), reader_tools.end(), atool.name)!=reader_tools.end();
+			const std::map<std::string, std::string>& overrides =
+			    is_reader ? reader_overrides : (atool.tool_class=="RelicMuonMatching" ? matcher_overrides : no_overrides);
+			if(!config_out.empty() && !CopyConfig(atool.config_file, config_out, shard, atool.name==file_list_tool, overrides)){
+				return false;
+			}
+			toolsconfig<<atool.name<<" "<<atool.tool_class<<" "<<config_out<<"\n";
+		}
+
+		std::ofstream chainconfig(dir+"ToolChainConfig");
+		std::string key, value;
+		for(const std::string& line : toolchain_lines){
+			if(ParseConfigLine(line, key, value) && key=="Tools_File") chainconfig<<"Tools_File "<<dir<<"ToolsConfig\n";
+			else chainconfig<<line<<"\n";
+		}
+		if(!filelist.good() || !toolsconfig.good() || !chainconfig.good()){
+			std::cerr<<"ShardDriver error! Failed writing configs to "<<dir<<std::endl;
+			return false;
+		}
+	}
+	if(outputs.empty()){
+		std::cout<<"ShardDriver warning! Found no output files in Tool configs; nothing will be merged"<<std::endl;
+	}
+	return true;
+}
+
+bool ShardDriver::FindOverlap(int shard, size_t& first_file, long& first_entry, long& overlap_entries){
+	// trigger times of a file from its index if there is one, else from its headers
+	auto load_index = [&](const std::string& afile, TriggerIndex& index){
+		if(index.Read(TriggerIndex::IndexPath(afile, trigger_index_dir), afile)) return true;
+		return index.Build(afile, input_tree_name);
+	};
+	const size_t own_file = shard_own_file.at(shard);
+	TriggerIndex own_index;
+	if(!load_index(input_files.at(own_file), own_index)){
+		std::cerr<<"ShardDriver error! Could not get trigger times of "<<input_files.at(own_file)<<std::endl;
+		return false;
+	}
+	long start_entry=0;
+	while(start_entry<long(own_index.size()) && !own_index.at(start_entry).physics) ++start_entry;
+	if(start_entry==long(own_index.size())){
+		// nothing to match to; no overlap needed
+		first_file = own_file;
+		first_entry = overlap_entries = 0;
+		return true;
+	}
+	const int64_t start_ticks = own_index.at(start_entry).ticks;
+	const int64_t overlap_ticks = overlap_secs*1E9*COUNT_PER_NSEC;
+
+	// go back through the preceding files until we reach the start of the overlap
+	first_file = own_file;
+	first_entry = overlap_entries = 0;
+	for(size_t file_i=own_file; file_i>0; --file_i){
+		TriggerIndex index;
+		if(!load_index(input_files.at(file_i-1), index)){
+			std::cerr<<"ShardDriver error! Could not get trigger times of "<<input_files.at(file_i-1)<<std::endl;
+			return false;
+		}
+		long first_in_window=-1;
+		bool earlier_events=false;
+		for(size_t entry_i=0; entry_i<index.size(); ++entry_i){
+			if(!index.at(entry_i).physics) continue;
+			int64_t ticks_before = start_ticks - index.at(entry_i).ticks;
+			if(ticks_before<0) ticks_before += (int64_t(1) << 47);  // rollover
+			if(ticks_before<=overlap_ticks){ first_in_window = entry_i; break; }
+			earlier_events=true;
+		}
+		if(first_in_window<0) break;
+		first_file = file_i-1;
+		overlap_entries += index.size();
+		first_entry = earlier_events ? first_in_window : 0;
+		if(earlier_events) break;
+	}
+	if(verbosity){
+		std::cout<<"ShardDriver: shard "<<shard<<" overlaps the previous "<<(own_file-first_file)
+		         <<" files, reading "<<(overlap_entries-first_entry)<<" entries before its own range"<<std::endl;
+	}
+	return true;
+}
+
+bool ShardDriver::LaunchShards(const std::string& executable){
+	// make sure buffered output isn't duplicated in the children
+	std::cout.flush();
+	std::cerr.flush();
+	for(int shard=0; shard<nshards; ++shard){
+		const std::string dir = shard_dir+"/shard_"+std::to_string(shard)+"/";
+		const std::string config = dir+"ToolChainConfig";
+		const std::string logfile = dir+"log.txt";
+		int pid = fork();
+		if(pid<0){
+			std::cerr<<"ShardDriver error! fork failed for shard "<<shard<<": "<<strerror(errno)<<std::endl;
+			return false;
+		} else if(pid==0){
+			int fd = open(logfile.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644);
+			if(fd>=0){
+				dup2(fd, STDOUT_FILENO);
+				dup2(fd, STDERR_FILENO);
+				close(fd);
+			}
+			execl(executable.c_str(), executable.c_str(), config.c_str(), (char*)nullptr);
+			std::cerr<<"ShardDriver error! Failed to run "<<executable<<": "<<strerror(errno)<<std::endl;
+			_exit(127);
+		}
+		pids.push_back(pid);
+		if(verbosity){
+			std::cout<<"ShardDriver: launched shard "<<shard<<" (pid "<<pid<<") on "<<shard_files[shard].size()
+			         <<" files, logging to "<<logfile<<std::endl;
+		}
+	}
+	return true;
+}
+
+bool ShardDriver::WaitForShards(){
+	bool all_ok=true;
+	int nrunning = pids.size();
+	auto start = std::chrono::steady_clock::now();
+	while(nrunning>0){
+		int status=0;
+		int pid = waitpid(-1, &status, 0);
+		if(pid<0){
+			if(errno==EINTR) continue;
+			std::cerr<<"ShardDriver error! waitpid failed: "<<strerror(errno)<<std::endl;
+			return false;
+		}
+		auto it = std::find(pids.begin(), pids.end(), pid);
+		if(it==pids.end()) continue;
+		--nrunning;
+		int shard = it-pids.begin();
+		bool ok = WIFEXITED(status) && WEXITSTATUS(status)==0;
+		all_ok &= ok;
+		std::string result = WIFEXITED(status) ? "exited with code "+std::to_string(WEXITSTATUS(status))
+		                                       : "was killed by signal "+std::to_string(WTERMSIG(status));
+		if(verbosity || !ok){
+			(ok ? std::cout : std::cerr)<<"ShardDriver: shard "<<shard<<" "<<result<<" after "
+			         <<std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count()<<"s, "
+			         <<nrunning<<" shards still running"<<std::endl;
+		}
+	}
+	return all_ok;
+}
+
+bool ShardDriver::MergeOutputs(){
+	bool all_ok=true;
+	for(const output_file& anoutput : outputs){
+		std::string first_file;
+		for(const std::string& shard_path : anoutput.shard_paths){
+			if(!shard_path.empty() && FileExists(shard_path)){ first_file = shard_path; break; }
+		}
+		if(first_file.empty()){
+			std::cout<<"ShardDriver warning! No shard made output "<<anoutput.path<<std::endl;
+			continue;
+		}
+
+		bool ok=false;
+		if(first_file.size()>5 && first_file.substr(first_file.size()-5)==".root"){
+			std::unique_ptr<TFile> afile(TFile::Open(first_file.c_str(),"READ"));
+			bool is_cut_file = afile && !afile->IsZombie() && afile->GetListOfKeys()->FindObject("cut_tracker");
+			// trees of matched candidates, as written by ReconstructMatchedMuons
+			std::vector<std::string> matched_trees;
+			if(afile && !afile->IsZombie()){
+				for(TObject* akey : *afile->GetListOfKeys()){
+					TTree* atree = dynamic_cast<TTree*>(afile->Get(akey->GetName()));
+					if(atree && atree->GetBranch("HEADER") && atree->GetBranch("MatchedOutEntryNums") &&
+					   std::find(matched_trees.begin(), matched_trees.end(), akey->GetName())==matched_trees.end()){
+						matched_trees.push_back(akey->GetName());
+					}
+				}
+			}
+			afile.reset();
+			if(is_cut_file) ok = MergeCutFiles(anoutput);
+			else if(matched_trees.size()) ok = MergeMatchedFiles(anoutput, matched_trees);
+			else ok = MergeRootFiles(anoutput);
+		} else {
+			ok = ConcatenateFiles(anoutput);
+		}
+		if(!ok) std::cerr<<"ShardDriver error! Failed to merge "<<anoutput.path<<std::endl;
+		else if(verbosity) std::cout<<"ShardDriver: merged "<<anoutput.path<<std::endl;
+		all_ok &= ok;
+	}
+	return all_ok;
+}
+
+bool ShardDriver::MergeRootFiles(const output_file& output){
+	TFileMerger merger(false);
+	if(!merger.OutputFile(output.path.c_str(), "RECREATE")) return false;
+	for(const std::string& shard_path : output.shard_paths){
+		if(!shard_path.empty() && FileExists(shard_path) && !merger.AddFile(shard_path.c_str())) return false;
+	}
+	return merger.Merge();
+}
+
+bool ShardDriver::ConcatenateFiles(const output_file& output){
+	std::ofstream outfile(output.path, std::ios::binary | std::ios::trunc);
+	for(const std::string& shard_path : output.shard_paths){
+		if(shard_path.empty() || !FileExists(shard_path)) continue;
+		std::ifstream infile(shard_path, std::ios::binary);
+		outfile<<infile.rdbuf();
+	}
+	return outfile.good();
+}
+
+long long ShardDriver::EntryOffset(int shard, const std::string& tree_name, bool own_range){
+	std::vector<long long>& entries = file_entries[tree_name];
+	if(entries.empty()){
+		entries.resize(input_files.size(), 0);
+		for(size_t file_i=0; file_i<input_files.size(); ++file_i){
+			std::unique_ptr<TFile> infile(TFile::Open(input_files[file_i].c_str(),"READ"));
+			TTree* tree = (infile && !infile->IsZombie()) ? (TTree*)infile->Get(tree_name.c_str()) : nullptr;
+			if(tree==nullptr){
+				std::cerr<<"ShardDriver error! Could not get tree "<<tree_name<<" from "<<input_files[file_i]
+				         <<" to count its entries; merged entry numbers will be wrong"<<std::endl;
+				continue;
+			}
+			entries[file_i] = tree->GetEntries();
+		}
+	}
+	const size_t first_file = own_range ? shard_own_file.at(shard) : shard_first_file.at(shard);
+	return std::accumulate(entries.begin(), entries.begin()+first_file, 0LL);
+}
+
+bool ShardDriver::MergeCutFiles(const output_file& output){
+	// see MTreeSelection::Write and MTreeCut::Write for the layout of cut files
+	std::vector<std::pair<int, std::unique_ptr<TFile>>> infiles;
+	for(int shard=0; shard<nshards; ++shard){
+		const std::string& shard_path = output.shard_paths.at(shard);
+		if(shard_path.empty() || !FileExists(shard_path)) continue;
+		std::unique_ptr<TFile> infile(TFile::Open(shard_path.c_str(),"READ"));
+		if(!infile || infile->IsZombie()){
+			std::cerr<<"ShardDriver error! Could not open cut file "<<shard_path<<std::endl;
+			return false;
+		}
+		infiles.emplace_back(shard, std::move(infile));
+	}
+
+	// cut-flow counts are summed over shards
+	std::vector<std::string> cut_order;
+	std::map<std::string, Long64_t> cut_counts;
+	for(auto&& ashard : infiles){
+		TObjArray* cut_tracker = (TObjArray*)ashard.second->Get("cut_tracker");
+		if(cut_tracker==nullptr) return false;
+		for(int cut_i=0; cut_i<cut_tracker->GetEntries(); ++cut_i){
+			TParameter<Long64_t>* acut = (TParameter<Long64_t>*)cut_tracker->At(cut_i);
+			if(cut_counts.count(acut->GetName())==0) cut_order.push_back(acut->GetName());
+			cut_counts[acut->GetName()] += acut->GetVal();
+		}
+		delete cut_tracker;
+	}
+
+	TFile outfile(output.path.c_str(),"RECREATE");
+	if(outfile.IsZombie()) return false;
+
+	for(const std::string& cutname : cut_order){
+		// TEntryLists of a TChain hold the passing entries of each file separately, so are simply combined
+		TEntryList* merged_list=nullptr;
+		TTree* merged_tree=nullptr;
+		int cut_type=-1;
+		Long64_t tree_entry=0;
+		std::set<size_t> indexes_this_entry;
+		std::set<size_t>* indexes_this_entry_p = &indexes_this_entry;
+		std::set<std::vector<size_t>> indices_this_entry;
+		std::set<std::vector<size_t>>* indices_this_entry_p = &indices_this_entry;
+
+		for(auto&& ashard : infiles){
+			TEntryList* elist = (TEntryList*)ashard.second->Get(("TEntryList_"+cutname).c_str());
+			TTree* tree = (TTree*)ashard.second->Get(cutname.c_str());
+			if(elist==nullptr || tree==nullptr) continue;  // cut had no entries in this shard
+			// entries of files in the overlap with the previous shard were recorded by that shard
+			std::unique_ptr<TEntryList> own_list;
+			const size_t own_file = shard_own_file.at(ashard.first);
+			if(shard_first_file.at(ashard.first)<own_file && elist->GetLists()){
+				std::set<std::string> overlap_files;
+				for(size_t file_i=shard_first_file.at(ashard.first); file_i<own_file; ++file_i){
+					overlap_files.insert(BaseName(input_files.at(file_i)));
+				}
+				own_list.reset(new TEntryList(elist->GetName(), elist->GetTitle()));
+				for(TObject* asublist : *elist->GetLists()){
+					if(overlap_files.count(BaseName(((TEntryList*)asublist)->GetFileName()))) continue;
+					own_list->Add((TEntryList*)asublist);
+				}
+				elist = own_list.get();
+			}
+			if(merged_list==nullptr){
+				merged_list = (TEntryList*)elist->Clone();
+				merged_list->SetDirectory(nullptr);
+			} else {
+				merged_list->Add(elist);
+			}
+
+			if(merged_tree==nullptr){
+				outfile.cd();
+				merged_tree = tree->CloneTree(0);  // keeps the cut meta info in the UserInfo
+				TParameter<Int_t>* type_par = (TParameter<Int_t>*)tree->GetUserInfo()->FindObject("cut_type");
+				if(type_par) cut_type = type_par->GetVal();
+			}
+			if(cut_type<=0 || tree->GetEntries()==0) continue;
+
+			// array cuts also record the entry number within the shard's TChain; offset it to the full chain
+			std::string tree_name = elist->GetTreeName();
+			if(tree_name.empty() && elist->GetLists() && elist->GetLists()->GetEntries()){
+				tree_name = ((TEntryList*)elist->GetLists()->At(0))->GetTreeName();
+			}
+			if(tree_name.empty()) tree_name = input_tree_name;
+			Long64_t offset = EntryOffset(ashard.first, tree_name);
+			// entries of the overlap with the previous shard were recorded by that shard
+			Long64_t own_range_start = EntryOffset(ashard.first, tree_name, true);
+			tree->SetBranchAddress("TreeEntry", &tree_entry);
+			if(cut_type==1) tree->SetBranchAddress("AdditionalIndices", &indexes_this_entry_p);
+			if(cut_type==2) tree->SetBranchAddress("AdditionalIndices", &indices_this_entry_p);
+			// (re)set after the input, since a clone follows changes to its original's addresses
+			merged_tree->SetBranchAddress("TreeEntry", &tree_entry);
+			if(cut_type==1) merged_tree->SetBranchAddress("AdditionalIndices", &indexes_this_entry_p);
+			if(cut_type==2) merged_tree->SetBranchAddress("AdditionalIndices", &indices_this_entry_p);
+			for(Long64_t entry_i=0; entry_i<tree->GetEntries(); ++entry_i){
+				tree->GetEntry(entry_i);
+				tree_entry += offset;
+				if(tree_entry<own_range_start) continue;
+				merged_tree->Fill();
+			}
+			tree->ResetBranchAddresses();
+		}
+
+		// with overlapping shards, entries may have passed cuts in two shards; the merged lists don't
+		// double count them, and each entry is only counted once per cut (see MTreeSelection::ApplyCut)
+		if(overlap_secs>0) cut_counts.at(cutname) = merged_list ? merged_list->GetN() : 0;
+
+		outfile.cd();
+		if(merged_list==nullptr){
+			// as MTreeCut::Write for a cut with no entries
+			std::string flagstring = cutname+"_empty_write";
+			TNamed flag(flagstring.c_str(), flagstring.c_str());
+			flag.Write(flagstring.c_str(), TObject::kOverwrite);
+			continue;
+		}
+		merged_list->Write(merged_list->GetName(), TObject::kOverwrite);
+		delete merged_list;
+		merged_tree->ResetBranchAddresses();
+		merged_tree->Write("", TObject::kOverwrite);
+	}
+
+	outfile.cd();
+	TObjArray cut_tracker_obj;
+	cut_tracker_obj.SetOwner(true);
+	cut_tracker_obj.SetName("cut_tracker");
+	for(const std::string& cutname : cut_order){
+		cut_tracker_obj.Add((TObject*)(new TParameter<Long64_t>(cutname.c_str(), cut_counts.at(cutname))));
+	}
+	cut_tracker_obj.Write("cut_tracker", TObject::kSingleKey);
+
+	outfile.Close();
+	return true;
+}
+
+bool ShardDriver::MergeMatchedFiles(const output_file& output, const std::vector<std::string>& tree_names){
+	// ReconstructMatchedMuons writes muon and relic candidates to two trees, each entry holding the
+	// event numbers, input entry numbers and output entry numbers of its matches in the other tree.
+	// A candidate may be written by two shards if it was in the overlap of the second: the first
+	// copy is kept, with the matches of the later copy appended (as they follow in time).
+	if(tree_names.size()!=2){
+		std::cerr<<"ShardDriver warning! Expected a muon and a relic tree in "<<output.path<<" but found "
+		         <<tree_names.size()<<"; merging without updating their matches"<<std::endl;
+		return MergeRootFiles(output);
+	}
+	std::vector<std::pair<int, std::unique_ptr<TFile>>> infiles;
+	for(int shard=0; shard<nshards; ++shard){
+		const std::string& shard_path = output.shard_paths.at(shard);
+		if(shard_path.empty() || !FileExists(shard_path)) continue;
+		std::unique_ptr<TFile> infile(TFile::Open(shard_path.c_str(),"READ"));
+		if(!infile || infile->IsZombie()){
+			std::cerr<<"ShardDriver error! Could not open "<<shard_path<<std::endl;
+			return false;
+		}
+		infiles.emplace_back(shard, std::move(infile));
+	}
+
+	// a candidate is identified by its run, event and (sub-)trigger time.
+	// muboy may split a muon into several consecutive entries with the same identity.
+	typedef std::tuple<int, int, Long64_t> cand_id;
+	struct match_list {
+		std::vector<int> evnums, in_entries, out_entries;
+		std::vector<bool> has_aft;
+		std::vector<float> time_diffs, energies;
+		void Append(const match_list& other){
+			evnums.insert(evnums.end(), other.evnums.begin(), other.evnums.end());
+			in_entries.insert(in_entries.end(), other.in_entries.begin(), other.in_entries.end());
+			out_entries.insert(out_entries.end(), other.out_entries.begin(), other.out_entries.end());
+			has_aft.insert(has_aft.end(), other.has_aft.begin(), other.has_aft.end());
+			time_diffs.insert(time_diffs.end(), other.time_diffs.begin(), other.time_diffs.end());
+			energies.insert(energies.end(), other.energies.begin(), other.energies.end());
+		}
+	};
+	struct tree_info {
+		std::map<cand_id, int> first_shard;                      // shard whose copy of each candidate is kept
+		std::map<cand_id, match_list> later_matches;             // matches from copies in later shards
+		std::map<std::pair<int,int>, std::vector<std::pair<Long64_t,Long64_t>>> merged_entries;  // (run, event) -> (ticks, entry)
+		std::map<int, std::vector<bool>> keep;                   // shard -> whether each entry is kept
+		Long64_t nentries=0;
+	};
+	std::map<std::string, tree_info> trees;
+
+	Header* header=nullptr;
+	Long64_t ticks=0;
+	match_list matches;
+	std::vector<int>* evnums_p = &matches.evnums;
+	std::vector<int>* in_entries_p = &matches.in_entries;
+	std::vector<int>* out_entries_p = &matches.out_entries;
+	std::vector<bool>* has_aft_p = &matches.has_aft;
+	std::vector<float>* time_diffs_p = &matches.time_diffs;
+	std::vector<float>* energies_p = &matches.energies;
+	auto set_addresses = [&](TTree* tree){
+		tree->SetBranchAddress("HwClockTicks", &ticks);
+		tree->SetBranchAddress("MatchedEvNums", &evnums_p);
+		tree->SetBranchAddress("MatchedInEntryNums", &in_entries_p);
+		tree->SetBranchAddress("MatchedOutEntryNums", &out_entries_p);
+		tree->SetBranchAddress("MatchedEntryHasAFT", &has_aft_p);
+		tree->SetBranchAddress("MatchedTimeDiff", &time_diffs_p);
+		tree->SetBranchAddress("MatchedParticleE", &energies_p);
+	};
+
+	// first pass: find which entries to keep and their merged entry numbers
+	for(const std::string& tree_name : tree_names){
+		tree_info& info = trees[tree_name];
+		for(auto&& ashard : infiles){
+			TTree* tree = (TTree*)ashard.second->Get(tree_name.c_str());
+			if(tree==nullptr) continue;
+			tree->SetBranchStatus("*",0);
+			for(const char* branch : {"HEADER", "HwClockTicks", "MatchedEvNums", "MatchedInEntryNums", "MatchedOutEntryNums",
+			                          "MatchedEntryHasAFT", "MatchedTimeDiff", "MatchedParticleE"}){
+				tree->SetBranchStatus(branch,1);
+			}
+			tree->SetBranchAddress("HEADER", &header);
+			set_addresses(tree);
+			const Long64_t in_offset = EntryOffset(ashard.first, input_tree_name);
+			std::vector<bool>& keep = info.keep[ashard.first];
+			keep.resize(tree->GetEntries());
+			std::set<cand_id> later_ids;  // of this shard
+			for(Long64_t entry_i=0; entry_i<tree->GetEntries(); ++entry_i){
+				tree->GetEntry(entry_i);
+				cand_id id{header->nrunsk, header->nevsk, ticks};
+				auto first = info.first_shard.emplace(id, ashard.first);
+				keep[entry_i] = (first.first->second==ashard.first);
+				if(keep[entry_i]){
+					std::vector<std::pair<Long64_t,Long64_t>>& entries = info.merged_entries[{header->nrunsk, header->nevsk}];
+					if(first.second) entries.emplace_back(ticks, info.nentries);
+					++info.nentries;
+				} else if(later_ids.insert(id).second){
+					for(int& in_entry : matches.in_entries) in_entry += in_offset;
+					info.later_matches[id].Append(matches);
+				}
+			}
+			tree->ResetBranchAddresses();
+		}
+	}
+
+	// second pass: copy the kept entries, with the matches of all copies and their merged entry numbers
+	TFile outfile(output.path.c_str(),"RECREATE");
+	if(outfile.IsZombie()) return false;
+	long nmissing=0;
+	for(size_t tree_i=0; tree_i<tree_names.size(); ++tree_i){
+		const tree_info& info = trees.at(tree_names[tree_i]);
+		const tree_info& partner = trees.at(tree_names[1-tree_i]);
+		TTree* merged_tree=nullptr;
+		for(auto&& ashard : infiles){
+			TTree* tree = (TTree*)ashard.second->Get(tree_names[tree_i].c_str());
+			if(tree==nullptr) continue;
+			tree->SetBranchStatus("*",1);
+			if(merged_tree==nullptr){
+				outfile.cd();
+				merged_tree = tree->CloneTree(0);
+			}
+			// all other branches are copied as they are
+			tree->SetBranchAddress("HEADER", &header);
+			set_addresses(tree);
+			tree->CopyAddresses(merged_tree);
+			const Long64_t in_offset = EntryOffset(ashard.first, input_tree_name);
+			const std::vector<bool>& keep = info.keep.at(ashard.first);
+			for(Long64_t entry_i=0; entry_i<tree->GetEntries(); ++entry_i){
+				if(!keep[entry_i]) continue;
+				tree->GetEntry(entry_i);
+				for(int& in_entry : matches.in_entries) in_entry += in_offset;
+				auto later = info.later_matches.find(cand_id{header->nrunsk, header->nevsk, ticks});
+				if(later!=info.later_matches.end()) matches.Append(later->second);
+				// find each match in the merged partner tree by its event number and time
+				for(size_t match_i=0; match_i<matches.evnums.size(); ++match_i){
+					matches.out_entries[match_i] = -1;
+					auto candidates = partner.merged_entries.find({header->nrunsk, matches.evnums[match_i]});
+					if(candidates==partner.merged_entries.end()){ ++nmissing; continue; }
+					const double match_ticks = ticks + matches.time_diffs[match_i]*COUNT_PER_NSEC;
+					double closest=-1;
+					for(auto&& acandidate : candidates->second){
+						double ticks_diff = std::abs(acandidate.first-match_ticks);
+						if(closest<0 || ticks_diff<closest){
+							closest = ticks_diff;
+							matches.out_entries[match_i] = acandidate.second;
+						}
+					}
+				}
+				merged_tree->Fill();
+			}
+			tree->CopyAddresses(merged_tree, true);
+			tree->ResetBranchAddresses();
+		}
+		if(merged_tree){
+			outfile.cd();
+			merged_tree->Write("", TObject::kOverwrite);
+		}
+	}
+	delete header;
+	outfile.Close();
+	if(nmissing){
+		std::cerr<<"ShardDriver warning! "<<nmissing<<" matches in "<<output.path<<" were not found in the merged file"
+		         <<"; their MatchedOutEntryNums are -1"<<std::endl;
+	}
+	return true;
+}
@@ -0,0 +1,105 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef SHARD_DRIVER_H
+#define SHARD_DRIVER_H
+
+#include <string>
+#include <vector>
+#include <map>
+
+// Runs a ToolChain as several independent processes, each over a contiguous block of the
+// files found by its LoadFileList Tool, then merges their outputs.
+// SKOFL keeps its state in Fortran common blocks, so a ToolChain can't be multithreaded,
+// but separate processes scale well. Invoked as:
+//   ./main configfiles/<chain>/ToolChainConfig --shards N [--shardDir shards] [--outputKeys key1,key2,...]
+//          [--shardOverlap seconds]
+// For each shard a copy of the ToolChain and Tool configs is made in <shardDir>/shard_<i>/, with the
+// LoadFileList Tool pointed at that shard's files and every output file (any config value of an
+// output key, e.g. outputFile) redirected to the shard directory. Once all shards finish
+// successfully, the outputs are merged back to their original paths:
+//  - MTreeSelection cut files have their passing entries combined, with the TTree entry numbers of
+//    array cuts offset to those of the full chain, and their cut-flow counts summed.
+//  - files of matched muon and relic candidates (from ReconstructMatchedMuons) are combined as
+//    described below, with the entry numbers of their matches updated to the merged file.
+//  - other ROOT files are merged as by hadd.
+//  - any other files are concatenated in shard order.
+// No changes to the Tools themselves are needed.
+//
+// Some Tools relate each event to those before it: RelicMuonMatching pairs muons and relic candidates
+// up to match_window seconds apart, which may be in the previous shard. With --shardOverlap each shard
+// but the first also reads that many seconds of events before its own range (found from the trigger
+// indices of the preceding files; see TriggerIndex), starting its TreeReader at the first of them.
+// RelicMuonMatching is told how many entries are overlap and uses them only as matching targets:
+// they are counted by the previous shard, and are only written out if matched to a candidate in
+// this shard's range. Candidates written by more than one shard are de-duplicated at merge time
+// with their matches combined, so the merged candidates and matches are those of a serial pass if
+// the overlap is at least match_window. Entries of the overlap are also dropped from merged cut
+// files, whose cut-flow counts are then taken from the merged entry lists. Other outputs (e.g.
+// histograms) will include the overlap events of each shard.
+
+class ShardDriver {
+
+	public:
+	ShardDriver(const std::string& toolchain_config, int nshards, const std::string& shard_dir="shards");
+	// config keys whose values are output files. Defaults to those used by current Tools.
+	void SetOutputKeys(const std::vector<std::string>& keys){ output_keys = keys; }
+	void SetVerbosity(int verb){ verbosity = verb; }
+	// seconds of events before its own range for each shard to also read. Default 0.
+	void SetOverlap(double secs){ overlap_secs = secs; }
+	// run all shards with the given ToolChain executable and merge. Returns 0 on success.
+	int Run(const std::string& executable);
+
+	private:
+	struct tool_config {
+		std::string name;
+		std::string tool_class;
+		std::string config_file;
+	};
+	struct output_file {
+		std::string path;                      // as given in the Tool config; where the merged output goes
+		std::vector<std::string> shard_paths;  // output of each shard
+	};
+
+	bool ReadToolChain();
+	bool GetFileList(const std::string& config_file, std::vector<std::string>& files) const;
+	bool MakeShardConfigs();
+	bool CopyConfig(const std::string& config_in, const std::string& config_out, int shard, bool is_file_list=false,
+	                const std::map<std::string, std::string>& overrides={});
+	bool FindOverlap(int shard, size_t& first_file, long& first_entry, long& overlap_entries);
+	std::string ShardOutputPath(const std::string& path, int shard);
+	bool LaunchShards(const std::string& executable);
+	bool WaitForShards();
+	bool MergeOutputs();
+	bool MergeCutFiles(const output_file& output);
+	bool MergeMatchedFiles(const output_file& output, const std::vector<std::string>& tree_names);
+	bool MergeRootFiles(const output_file& output);
+	bool ConcatenateFiles(const output_file& output);
+	// entries of the full chain before those read by a shard, or before its own range
+	long long EntryOffset(int shard, const std::string& tree_name, bool own_range=false);
+
+	std::string toolchain_config;
+	std::string shard_dir;
+	int nshards;
+	int verbosity=1;
+	double overlap_secs=0;
+	std::vector<std::string> output_keys{"outputFile", "outputfile", "output_file", "outFile", "outfile",
+	                                     "outfile_name", "outfilename", "fname_out", "distributionsFile"};
+
+	std::vector<std::string> toolchain_lines;  // ToolChainConfig, to be copied for each shard
+	std::string tools_file;                    // ToolsConfig listing the Tools and their configs
+	std::vector<tool_config> tools;
+	std::string file_list_tool;                // name of the LoadFileList Tool whose files we split
+	std::vector<std::string> reader_tools;     // TreeReaders of its files
+	std::string input_tree_name="data";
+	std::string trigger_index_dir;
+	std::vector<std::string> input_files;
+	std::vector<std::vector<std::string>> shard_files;  // files read by each shard, including any overlap
+	std::vector<size_t> shard_first_file;      // index in input_files of the first file read by each shard
+	std::vector<size_t> shard_own_file;        // and of the first in its own range
+	std::vector<output_file> outputs;
+	std::map<std::string, std::string> shard_names;  // original output path -> name within shard dir
+	std::vector<int> pids;
+	std::map<std::string, std::vector<long long>> file_entries;  // tree name -> num entries in each input file
+
+};
+
+#endif
@@ -0,0 +1,93 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "SoftwareTrigger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <iostream>
+
+int SoftwareTrigger::AddTriggerType(const software_trigger_type& atype){
+	if(atype.detector<0 || atype.window<=0){
+		std::cerr<<"SoftwareTrigger::AddTriggerType error! Trigger type "<<atype.name
+		         <<" needs a non-negative detector index and positive window"<<std::endl;
+		return -1;
+	}
+	trigger_types.push_back(atype);
+	return trigger_types.size()-1;
+}
+
+int SoftwareTrigger::GetTypeIndex(const std::string& name) const {
+	for(size_t type=0; type<trigger_types.size(); ++type){
+		if(trigger_types[type].name==name) return type;
+	}
+	return -1;
+}
+
+void SoftwareTrigger::SortedHitTimes(const float* times, int nhits, std::vector<double>& sorted_times){
+	sorted_times.assign(times, times+std::max(nhits,0));
+	std::sort(sorted_times.begin(), sorted_times.end());
+}
+
+const std::vector<software_trigger>& SoftwareTrigger::Run(const std::vector<std::vector<double>>& hits){
+	triggers.clear();
+
+	// state of each trigger type during the scan
+	struct scan_state {
+		int type;
+		size_t first=0;  // earliest hit within the window
+		double resume_time=-std::numeric_limits<double>::infinity();  // end of readout + deadtime of last trigger
+	};
+
+	for(size_t detector=0; detector<hits.size(); ++detector){
+		std::vector<scan_state> states;
+		for(size_t type=0; type<trigger_types.size(); ++type){
+			if(size_t(trigger_types[type].detector)==detector) states.push_back(scan_state{int(type)});
+		}
+		if(states.empty()) continue;
+
+		const std::vector<double>& times = hits[detector];
+		for(size_t hit_i=0; hit_i<times.size(); ++hit_i){
+			const double hit_time = times[hit_i];
+			for(scan_state& state : states){
+				const software_trigger_type& atype = trigger_types[state.type];
+				// still in readout or deadtime of this type's previous trigger
+				if(hit_time<state.resume_time) continue;
+				// drop hits that have left the window, or were before the end of the last readout
+				const double window_start = std::max(hit_time-atype.window, state.resume_time);
+				while(times[state.first]<window_start || (hit_time-times[state.first])>=atype.window){
+					++state.first;
+				}
+				const size_t nhits = hit_i-state.first+1;
+				if(nhits<size_t(std::max(atype.threshold,1))) continue;
+
+				software_trigger atrigger;
+				atrigger.type = state.type;
+				atrigger.trigger_id = atype.trigger_id;
+				atrigger.t0 = hit_time + atype.t0_offset;
+				atrigger.readout_start = atrigger.t0 - atype.pre_t0;
+				atrigger.readout_end = atrigger.t0 + atype.post_t0;
+				atrigger.nhits = nhits;
+				atrigger.first_hit = state.first;
+				triggers.push_back(atrigger);
+
+				// always move past the current hit, so a short readout can't re-trigger on it
+				state.resume_time = std::max(atrigger.readout_end + atype.deadtime,
+				                             std::nextafter(hit_time, std::numeric_limits<double>::infinity()));
+			}
+		}
+	}
+
+	// triggers of each type are already in order; merge the types
+	std::stable_sort(triggers.begin(), triggers.end(),
+	                 [](const software_trigger& a, const software_trigger& b){ return a.t0<b.t0; });
+
+	return triggers;
+}
+
+std::vector<double> SoftwareTrigger::GetTriggerTimes(int type) const {
+	std::vector<double> times;
+	for(const software_trigger& atrigger : triggers){
+		if(atrigger.type==type) times.push_back(atrigger.t0);
+	}
+	return times;
+}
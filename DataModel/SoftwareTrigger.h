@@ -0,0 +1,65 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef SOFTWARE_TRIGGER_H
+#define SOFTWARE_TRIGGER_H
+
+#include <string>
+#include <vector>
+
+// Emulation of the SK software trigger on a list of hit times.
+// Each trigger type counts the hits of one detector (e.g. 0=ID, 1=OD) within a sliding
+// window, and fires when the count reaches its threshold. After a trigger, no further
+// trigger of that type may fire until the end of its readout window plus any deadtime,
+// and hits before that time no longer count towards it.
+// All types acting on the same detector are evaluated together in a single forward pass
+// over the (sorted) hits, each with a pair of indices delimiting its current window,
+// so the cost is linear in the number of hits regardless of how many triggers fire.
+// All times are in ns, in whatever frame the hit times are given.
+
+struct software_trigger_type {
+	std::string name;
+	int trigger_id=-1;       // trigger bit, as in skhead_.idtgsk or swtrgtbl_.swtrgtype
+	int detector=0;          // index of the hit list this trigger acts on
+	int threshold=0;         // fires when at least this many hits are within the window
+	double window=200;       // width of the sliding hit-counting window
+	double t0_offset=0;      // offset from the threshold-crossing hit to the trigger t0
+	double pre_t0=0;         // readout before t0
+	double post_t0=0;        // readout after t0
+	double deadtime=0;       // after end of readout, before this type may fire again
+};
+
+struct software_trigger {
+	int type=-1;             // index of the trigger type within the SoftwareTrigger
+	int trigger_id=-1;
+	double t0=0;
+	double readout_start=0;
+	double readout_end=0;
+	size_t nhits=0;          // hits within the window when the threshold was crossed
+	size_t first_hit=0;      // index of the earliest of those hits in its hit list
+};
+
+class SoftwareTrigger {
+
+	public:
+	int AddTriggerType(const software_trigger_type& atype);
+	void ClearTriggerTypes(){ trigger_types.clear(); }
+	size_t GetNTriggerTypes() const { return trigger_types.size(); }
+	const software_trigger_type& GetTriggerType(int type) const { return trigger_types.at(type); }
+	int GetTypeIndex(const std::string& name) const;
+
+	// run all trigger types over the given hits, one hit list per detector.
+	// Each hit list must be sorted in time. Returns all triggers, ordered by t0.
+	const std::vector<software_trigger>& Run(const std::vector<std::vector<double>>& hits);
+	const std::vector<software_trigger>& GetTriggers() const { return triggers; }
+	// t0 of all triggers of a given type from the last Run, in time order
+	std::vector<double> GetTriggerTimes(int type) const;
+
+	// helper to fill a sorted hit list from an array of times (e.g. sktqz_.tiskz)
+	static void SortedHitTimes(const float* times, int nhits, std::vector<double>& sorted_times);
+
+	private:
+	std::vector<software_trigger_type> trigger_types;
+	std::vector<software_trigger> triggers;
+
+};
+
+#endif
@@ -0,0 +1,107 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "SpaceTimeIndex.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+SpaceTimeIndex::SpaceTimeIndex(double size) : cell_size(size) {}
+
+void SpaceTimeIndex::Clear(){
+	points.clear();
+	cells.clear();
+}
+
+void SpaceTimeIndex::SetCellSize(double size){
+	Clear();
+	cell_size = size;
+}
+
+SpaceTimeIndex::cell_key SpaceTimeIndex::Cell(double x, double y, double z) const {
+	return cell_key{static_cast<int64_t>(std::floor(x/cell_size)),
+	                static_cast<int64_t>(std::floor(y/cell_size)),
+	                static_cast<int64_t>(std::floor(z/cell_size))};
+}
+
+void SpaceTimeIndex::Insert(int id, const TVector3& pos, double time){
+	cells[Cell(pos.X(), pos.Y(), pos.Z())].push_back(points.size());
+	points.push_back(point{id, pos.X(), pos.Y(), pos.Z(), time});
+}
+
+double SpaceTimeIndex::Dist2(const point& p, const TVector3& pos) const {
+	const double dx = p.x-pos.X(), dy = p.y-pos.Y(), dz = p.z-pos.Z();
+	return dx*dx + dy*dy + dz*dz;
+}
+
+void SpaceTimeIndex::FindWithin(const TVector3& pos, double max_dist, double time_min, double time_max,
+                                std::vector<int>& ids) const {
+	ids.clear();
+	if(points.empty() || max_dist<0) return;
+	const double max_dist2 = max_dist*max_dist;
+	auto check = [&](const point& p){
+		if(p.t<time_min || p.t>time_max) return;
+		if(Dist2(p, pos)<=max_dist2) ids.push_back(p.id);
+	};
+
+	const cell_key low = Cell(pos.X()-max_dist, pos.Y()-max_dist, pos.Z()-max_dist);
+	const cell_key high = Cell(pos.X()+max_dist, pos.Y()+max_dist, pos.Z()+max_dist);
+	const double ncells = double(high.x-low.x+1)*double(high.y-low.y+1)*double(high.z-low.z+1);
+	if(ncells>cells.size()){
+		// cheaper to look at every occupied cell
+		for(const point& p : points) check(p);
+	} else {
+		for(int64_t x=low.x; x<=high.x; ++x){
+			for(int64_t y=low.y; y<=high.y; ++y){
+				for(int64_t z=low.z; z<=high.z; ++z){
+					auto it = cells.find(cell_key{x,y,z});
+					if(it==cells.end()) continue;
+					for(size_t point_i : it->second) check(points[point_i]);
+				}
+			}
+		}
+	}
+	std::sort(ids.begin(), ids.end());
+}
+
+int SpaceTimeIndex::FindNearest(const TVector3& pos, double time, double time_scale, double* metric) const {
+	int best_id=-1;
+	double best_metric2 = std::numeric_limits<double>::max();
+	auto check = [&](const point& p){
+		const double dt = time_scale*(p.t-time);
+		const double metric2 = Dist2(p, pos) + dt*dt;
+		if(metric2<best_metric2 || (metric2==best_metric2 && p.id<best_id)){
+			best_metric2 = metric2;
+			best_id = p.id;
+		}
+	};
+
+	// search shells of cells around that of pos, until the nearest point so far is closer
+	// than any point in the next shell could be. The spatial distance alone is a lower bound
+	// on the metric, and points in the cells k away are at least k-1 cell widths away.
+	const cell_key centre = Cell(pos.X(), pos.Y(), pos.Z());
+	for(int64_t k=0; ; ++k){
+		if(best_id>=0 && k>0 && std::sqrt(best_metric2)<(k-1)*cell_size) break;
+		const double shell_cells = std::pow(2.*k+1.,3.) - ((k>0) ? std::pow(2.*k-1.,3.) : 0.);
+		if(shell_cells>cells.size()){
+			// the shells are now bigger than the occupied part of the grid: check everything
+			best_id=-1;
+			best_metric2 = std::numeric_limits<double>::max();
+			for(const point& p : points) check(p);
+			break;
+		}
+		for(int64_t x=centre.x-k; x<=centre.x+k; ++x){
+			for(int64_t y=centre.y-k; y<=centre.y+k; ++y){
+				const bool on_face = (std::abs(x-centre.x)==k || std::abs(y-centre.y)==k);
+				// cells strictly inside the shell were done in an earlier one
+				for(int64_t z=centre.z-k; z<=centre.z+k; z+=((on_face || k==0) ? 1 : 2*k)){
+					auto it = cells.find(cell_key{x,y,z});
+					if(it==cells.end()) continue;
+					for(size_t point_i : it->second) check(points[point_i]);
+				}
+			}
+		}
+	}
+
+	if(metric!=nullptr) *metric = (best_id>=0) ? std::sqrt(best_metric2) : -1;
+	return best_id;
+}
@@ -0,0 +1,60 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef SPACE_TIME_INDEX_H
+#define SPACE_TIME_INDEX_H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+#include "TVector3.h"
+
+// An index of points in space and time (e.g. the true vertices or neutron captures of an event),
+// each with an integer id such as its position in the DataModel vector it came from.
+// Points are bucketed into a grid of cubic cells, so finding those within some distance of a
+// position, or the nearest to a point in space and time, only looks at nearby cells rather than
+// at every point. Cells should be around the size of typical query distances.
+// Points may be added at any time, e.g. while the vector they index is being filled.
+
+class SpaceTimeIndex {
+
+	public:
+	explicit SpaceTimeIndex(double cell_size=100.);  // [cm]
+	void Clear();
+	// also clears the index
+	void SetCellSize(double cell_size);
+	void Insert(int id, const TVector3& pos, double time);
+	size_t size() const { return points.size(); }
+
+	// ids of points within max_dist of pos and with time in [time_min, time_max], in increasing order
+	void FindWithin(const TVector3& pos, double max_dist, double time_min, double time_max,
+	                std::vector<int>& ids) const;
+	// id of the point minimising sqrt(dist^2 + (time_scale*(t-time))^2), or -1 if there are none.
+	// Of equally near points, that with the lowest id is returned.
+	int FindNearest(const TVector3& pos, double time, double time_scale, double* metric=nullptr) const;
+
+	private:
+	struct point {
+		int id;
+		double x, y, z, t;
+	};
+	struct cell_key {
+		int64_t x, y, z;
+		bool operator==(const cell_key& other) const { return x==other.x && y==other.y && z==other.z; }
+	};
+	struct cell_hash {
+		size_t operator()(const cell_key& k) const {
+			// large primes, as is usual for spatial hashing
+			return static_cast<size_t>(k.x*73856093LL ^ k.y*19349663LL ^ k.z*83492791LL);
+		}
+	};
+	cell_key Cell(double x, double y, double z) const;
+	double Dist2(const point& p, const TVector3& pos) const;
+
+	double cell_size;
+	std::vector<point> points;
+	std::unordered_map<cell_key, std::vector<size_t>, cell_hash> cells;  // indices in points
+
+};
+
+#endif
@@ -0,0 +1,268 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "ToolProfiler.h"
+
+#include <array>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdint>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "TFile.h"
+
+#include "MTreeReader.h"
+
+namespace {
+
+// bin 0: below 1us, bin i: [2^(i-1), 2^i) us. The last bin (~3 days) catches everything longer.
+constexpr int n_latency_bins = 40;
+
+struct phase_stats {
+	double wall=0;
+	double cpu=0;
+};
+
+struct tool_stats {
+	std::string name;
+	std::string tool_class;
+	phase_stats initialise;
+	phase_stats execute;
+	phase_stats finalise;
+	uint64_t calls=0;
+	uint64_t failures=0;
+	double max_wall=0;
+	std::array<uint64_t,n_latency_bins> latency{};
+	bool finalised=false;
+};
+
+struct reader_stats {
+	uint64_t bytes=0;
+	uint64_t entries=0;
+};
+
+struct profiler_state {
+	bool enabled=false;
+	double start_time=0;         // when profiling was enabled
+	double first_execute=-1;     // start of the first Execute call of any Tool
+	double last_execute=0;       // and end of the last
+	std::vector<tool_stats> tools;
+	std::map<std::string, reader_stats> readers;
+	size_t n_finalised=0;
+	std::ofstream timeline;
+};
+
+profiler_state& State(){
+	static profiler_state state;
+	return state;
+}
+
+int LatencyBin(double wall){
+	double usecs = wall*1E6;
+	int bin=0;
+	while(usecs>=1. && bin<n_latency_bins-1){
+		usecs /= 2.;
+		++bin;
+	}
+	return bin;
+}
+
+// in seconds
+double BinUpperEdge(int bin){
+	return double(uint64_t(1)<<bin)*1E-6;
+}
+
+// upper edge of the latency bin containing the given fraction of calls
+double Percentile(const tool_stats& tool, double fraction){
+	if(tool.calls==0) return 0;
+	const double target = fraction*tool.calls;
+	uint64_t sum=0;
+	for(int bin=0; bin<n_latency_bins; ++bin){
+		sum += tool.latency[bin];
+		if(sum>=target) return std::min(BinUpperEdge(bin), tool.max_wall);
+	}
+	return tool.max_wall;
+}
+
+std::string BinLabel(int bin){
+	if(bin==0) return "<1us";
+	auto units = [](uint64_t usecs){
+		if(usecs<1000) return std::to_string(usecs)+"us";
+		if(usecs<1000000) return std::to_string(usecs/1000)+"ms";
+		return std::to_string(usecs/1000000)+"s";
+	};
+	return units(uint64_t(1)<<(bin-1))+"-"+units(uint64_t(1)<<bin);
+}
+
+void WriteTimeline(const char* phase, int id, long iteration, double start, double wall, double cpu, bool ok){
+	profiler_state& state = State();
+	if(!state.timeline.is_open()) return;
+	state.timeline<<phase<<','<<state.tools[id].name<<','<<iteration<<','<<(start-state.start_time)<<','
+	              <<wall<<','<<cpu<<','<<ok<<'\n';
+}
+
+} // end anonymous namespace
+
+void ToolProfiler::Enable(const std::string& timeline_file){
+	profiler_state& state = State();
+	state.enabled = true;
+	state.start_time = WallTime();
+	if(!timeline_file.empty()){
+		state.timeline.open(timeline_file, std::ios::trunc);
+		if(!state.timeline.is_open()){
+			std::cerr<<"ToolProfiler::Enable error! Could not open timeline file "<<timeline_file<<std::endl;
+		} else {
+			state.timeline<<std::fixed<<std::setprecision(9);
+			state.timeline<<"phase,tool,iteration,start_s,wall_s,cpu_s,ok\n";
+		}
+	}
+}
+
+bool ToolProfiler::Enabled(){
+	return State().enabled;
+}
+
+int ToolProfiler::Register(const std::string& tool_name, const std::string& tool_class){
+	profiler_state& state = State();
+	state.tools.emplace_back();
+	state.tools.back().name = tool_name;
+	state.tools.back().tool_class = tool_class;
+	return state.tools.size()-1;
+}
+
+void ToolProfiler::RecordInitialise(int id, double start, double wall, double cpu, bool ok){
+	tool_stats& tool = State().tools.at(id);
+	tool.initialise.wall += wall;
+	tool.initialise.cpu += cpu;
+	WriteTimeline("Initialise", id, -1, start, wall, cpu, ok);
+}
+
+void ToolProfiler::RecordExecute(int id, double start, double wall, double cpu, bool ok){
+	profiler_state& state = State();
+	tool_stats& tool = state.tools.at(id);
+	++tool.calls;
+	if(!ok) ++tool.failures;
+	tool.execute.wall += wall;
+	tool.execute.cpu += cpu;
+	tool.max_wall = std::max(tool.max_wall, wall);
+	++tool.latency[LatencyBin(wall)];
+	if(state.first_execute<0) state.first_execute = start;
+	state.last_execute = start+wall;
+	// the first Tool runs once per ToolChain iteration
+	WriteTimeline("Execute", id, long(state.tools.front().calls)-1, start, wall, cpu, ok);
+}
+
+void ToolProfiler::RecordFinalise(int id, double start, double wall, double cpu, bool ok){
+	profiler_state& state = State();
+	tool_stats& tool = state.tools.at(id);
+	tool.finalise.wall += wall;
+	tool.finalise.cpu += cpu;
+	WriteTimeline("Finalise", id, -1, start, wall, cpu, ok);
+	if(!tool.finalised){
+		tool.finalised = true;
+		++state.n_finalised;
+	}
+	if(state.n_finalised==state.tools.size()){
+		PrintSummary();
+		if(state.timeline.is_open()) state.timeline.close();
+	}
+}
+
+void ToolProfiler::RecordReaders(const std::map<std::string,MTreeReader*>& trees){
+	profiler_state& state = State();
+	for(auto&& atree : trees){
+		if(atree.second==nullptr) continue;
+		reader_stats& reader = state.readers[atree.first];
+		reader.bytes = atree.second->GetBytesRead();
+		reader.entries = atree.second->GetEntriesRead();
+	}
+}
+
+void ToolProfiler::PrintSummary(std::ostream& os){
+	profiler_state& state = State();
+	if(state.tools.empty()) return;
+
+	double total_execute=0;
+	size_t name_width=4, class_width=5;
+	for(auto&& tool : state.tools){
+		total_execute += tool.execute.wall;
+		name_width = std::max(name_width, tool.name.length());
+		class_width = std::max(class_width, tool.tool_class.length());
+	}
+	const uint64_t iterations = state.tools.front().calls;
+	const double execute_span = (state.first_execute<0) ? 0 : state.last_execute-state.first_execute;
+
+	std::ios_base::fmtflags flags = os.flags();
+	std::streamsize precision = os.precision();
+	os<<std::fixed;
+
+	os<<"\n==================== ToolChain profile ====================\n";
+	os<<std::left<<std::setw(name_width)<<"Tool"<<"  "<<std::setw(class_width)<<"Class"<<std::right
+	  <<std::setw(10)<<"Calls"<<std::setw(8)<<"Fails"
+	  <<std::setw(11)<<"Exec[s]"<<std::setw(7)<<"%"<<std::setw(11)<<"CPU[s]"
+	  <<std::setw(11)<<"Mean[ms]"<<std::setw(11)<<"p50[ms]"<<std::setw(11)<<"p99[ms]"<<std::setw(11)<<"Max[ms]"
+	  <<std::setw(11)<<"Init[s]"<<std::setw(11)<<"Final[s]"<<"\n";
+	for(auto&& tool : state.tools){
+		const double mean = (tool.calls) ? tool.execute.wall/tool.calls : 0;
+		const double fraction = (total_execute>0) ? 100.*tool.execute.wall/total_execute : 0;
+		os<<std::left<<std::setw(name_width)<<tool.name<<"  "<<std::setw(class_width)<<tool.tool_class<<std::right
+		  <<std::setw(10)<<tool.calls<<std::setw(8)<<tool.failures<<std::setprecision(3)
+		  <<std::setw(11)<<tool.execute.wall<<std::setw(7)<<std::setprecision(1)<<fraction
+		  <<std::setprecision(3)<<std::setw(11)<<tool.execute.cpu
+		  <<std::setw(11)<<mean*1E3<<std::setw(11)<<Percentile(tool,0.5)*1E3
+		  <<std::setw(11)<<Percentile(tool,0.99)*1E3<<std::setw(11)<<tool.max_wall*1E3
+		  <<std::setw(11)<<tool.initialise.wall<<std::setw(11)<<tool.finalise.wall<<"\n";
+	}
+	os<<std::setprecision(3);
+	os<<"Total Execute time "<<total_execute<<" s over "<<iterations<<" iterations in "<<execute_span<<" s";
+	if(execute_span>0) os<<": "<<std::setprecision(1)<<(iterations/execute_span)<<" events/s";
+	os<<"\n";
+
+	os<<"\nExecute latencies:\n";
+	for(auto&& tool : state.tools){
+		if(tool.calls==0) continue;
+		os<<"  "<<tool.name<<":";
+		for(int bin=0; bin<n_latency_bins; ++bin){
+			if(tool.latency[bin]) os<<" ["<<BinLabel(bin)<<"] "<<tool.latency[bin];
+		}
+		os<<"\n";
+	}
+
+	if(!state.readers.empty()){
+		os<<"\nMTreeReaders:\n";
+		for(auto&& areader : state.readers){
+			os<<"  "<<areader.first<<": "<<areader.second.entries<<" entries, "
+			  <<std::setprecision(1)<<(areader.second.bytes/1E6)<<" MB";
+			if(areader.second.entries) os<<" ("<<(areader.second.bytes/1E3/areader.second.entries)<<" kB/entry)";
+			os<<"\n";
+		}
+	}
+	// includes files read through SKROOT, which do not go through an MTreeReader
+	const double total_bytes = TFile::GetFileBytesRead();
+	os<<"Total read through ROOT: "<<std::setprecision(1)<<(total_bytes/1E6)<<" MB";
+	if(execute_span>0) os<<" ("<<(total_bytes/1E6/execute_span)<<" MB/s)";
+	os<<"\nPeak RSS: "<<PeakRSS()<<" MB";
+	os<<"\n===========================================================\n"<<std::endl;
+
+	os.flags(flags);
+	os.precision(precision);
+}
+
+double ToolProfiler::WallTime(){
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec*1E-9;
+}
+
+double ToolProfiler::CpuTime(){
+	timespec now;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+	return now.tv_sec + now.tv_nsec*1E-9;
+}
+
+double ToolProfiler::PeakRSS(){
+	rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage)!=0) return 0;
+	return usage.ru_maxrss/1024.;  // kB on linux
+}
@@ -0,0 +1,50 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef TOOL_PROFILER_H
+#define TOOL_PROFILER_H
+
+#include <string>
+#include <map>
+#include <iostream>
+
+class MTreeReader;
+
+// Collects the run time of each Tool of a ToolChain. Enabled with
+//   ./main configfiles/<chain>/ToolChainConfig --profile [timeline.csv]
+// in which case the Factory wraps every Tool it makes in a ProfiledTool, which times its
+// Initialise, Execute and Finalise calls and reports them here. For each Tool this records
+// the wall and CPU time of each phase, the number of Execute calls and failures, and a
+// histogram of Execute latencies. Once every Tool has been Finalised a summary table is printed
+// with the events/sec of the ToolChain, the bytes read by each MTreeReader in DataModel::Trees,
+// and the total bytes read through ROOT.
+// If a timeline file is given each call is also written to it as a row of
+//   phase,tool,iteration,start_s,wall_s,cpu_s,ok
+// with start_s relative to when profiling was enabled, for plotting the chain's behaviour over time.
+// The overhead is two clock reads per call, so profiling is suitable for production-sized runs.
+
+class ToolProfiler {
+
+	public:
+	// must be called before the ToolChain creates its Tools
+	static void Enable(const std::string& timeline_file="");
+	static bool Enabled();
+
+	// returns the id with which to report calls of this Tool
+	static int Register(const std::string& tool_name, const std::string& tool_class);
+	static void RecordInitialise(int id, double start, double wall, double cpu, bool ok);
+	static void RecordExecute(int id, double start, double wall, double cpu, bool ok);
+	// prints the summary after the last Tool is finalised
+	static void RecordFinalise(int id, double start, double wall, double cpu, bool ok);
+	// note the bytes read by each MTreeReader, before their owning Tools close them
+	static void RecordReaders(const std::map<std::string,MTreeReader*>& trees);
+
+	static void PrintSummary(std::ostream& os=std::cout);
+
+	// monotonic wall-clock time and CPU time of this process, in seconds
+	static double WallTime();
+	static double CpuTime();
+	// peak resident set size of this process so far, in MB
+	static double PeakRSS();
+
+};
+
+#endif
@@ -0,0 +1,222 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "TriggerIndex.h"
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <sys/stat.h>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+
+#include "SkrootHeaders.h"  // Header
+
+namespace {
+
+// sidecar file layout: header, then nentries packed trigger_index_entry records
+constexpr char index_magic[8] = {'S','K','T','R','G','I','D','X'};
+constexpr uint32_t index_version = 1;
+
+struct index_file_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t record_size;
+	uint64_t nentries;
+	int64_t source_size;
+	int64_t source_mtime;
+};
+
+static_assert(std::is_trivially_copyable<trigger_index_entry>::value, "index records are written as raw bytes");
+
+bool StatFile(const std::string& filename, int64_t& size, int64_t& mtime){
+	struct stat info;
+	if(stat(filename.c_str(), &info)!=0) return false;
+	size = info.st_size;
+	mtime = info.st_mtime;
+	return true;
+}
+
+} // end anonymous namespace
+
+bool TriggerIndex::NonPhysicsEntry(const Header* header){
+	return ((header->nrunsk==0 && header->mdrnsk!=0 && header->mdrnsk!= 999999) ||
+	        (std::bitset<8*sizeof(int)>(header->ifevsk).test(19)) ||
+	        (header->nrunsk==0 && header->sk_geometry==0 && header->ifevsk!=0) );
+}
+
+int64_t TriggerIndex::TriggerTicks(int32_t nevhwsk, int32_t it0sk){
+	// see RelicMuonMatching. it0sk is signed, so interpret as unsigned to avoid sign extension.
+	int64_t ticks = (nevhwsk & ~0x1FFFF);
+	ticks = ticks << 15;
+	ticks += *reinterpret_cast<uint32_t*>(&it0sk);
+	return ticks;
+}
+
+std::string TriggerIndex::IndexPath(const std::string& input_file, const std::string& index_dir){
+	if(index_dir.empty()) return input_file+".trgidx";
+	std::string basename = input_file.substr(input_file.find_last_of('/')+1);
+	std::string dir = index_dir;
+	if(dir.back()!='/') dir += '/';
+	return dir+basename+".trgidx";
+}
+
+void TriggerIndex::Clear(){
+	entries.clear();
+	file_offsets.clear();
+	time_order.clear();
+	source_size=0;
+	source_mtime=0;
+}
+
+bool TriggerIndex::Build(const std::string& input_file, const std::string& tree_name){
+	Clear();
+	if(!StatFile(input_file, source_size, source_mtime)){
+		std::cerr<<"TriggerIndex::Build error! Could not stat "<<input_file<<std::endl;
+		return false;
+	}
+	std::unique_ptr<TFile> infile(TFile::Open(input_file.c_str(),"READ"));
+	if(!infile || infile->IsZombie()){
+		std::cerr<<"TriggerIndex::Build error! Could not open "<<input_file<<std::endl;
+		return false;
+	}
+	TTree* tree = (TTree*)infile->Get(tree_name.c_str());
+	if(tree==nullptr || tree->GetBranch("HEADER")==nullptr){
+		std::cerr<<"TriggerIndex::Build error! No tree "<<tree_name<<" with a HEADER branch in "
+		         <<input_file<<std::endl;
+		return false;
+	}
+
+	// only read the header
+	Header* header = nullptr;
+	TBranch* header_branch = nullptr;
+	tree->SetBranchStatus("*",0);
+	tree->SetBranchStatus("HEADER",1);
+	tree->SetBranchAddress("HEADER", &header, &header_branch);
+
+	const long nentries = tree->GetEntries();
+	entries.resize(nentries);
+	for(long entry_i=0; entry_i<nentries; ++entry_i){
+		if(header_branch->GetEntry(entry_i)<=0){
+			std::cerr<<"TriggerIndex::Build error reading HEADER entry "<<entry_i
+			         <<" of "<<input_file<<std::endl;
+			entries.clear();
+			tree->ResetBranchAddresses();
+			delete header;
+			return false;
+		}
+		trigger_index_entry& anentry = entries[entry_i];
+		anentry.nrunsk = header->nrunsk;
+		anentry.nsubsk = header->nsubsk;
+		anentry.nevsk = header->nevsk;
+		anentry.idtgsk = header->idtgsk;
+		anentry.ifevsk = header->ifevsk;
+		anentry.physics = !NonPhysicsEntry(header);
+		anentry.ticks = TriggerTicks(header->counter_32, header->t0);
+	}
+	tree->ResetBranchAddresses();
+	delete header;
+
+	file_offsets.push_back(0);
+	LinkPairs(0);
+	return true;
+}
+
+void TriggerIndex::LinkPairs(size_t first){
+	// an AFT is always the entry immediately following its SHE
+	if(first>0) --first;  // an SHE at the end of the previous file may pair with an AFT at the start of this one
+	for(size_t entry_i=first; entry_i+1<entries.size(); ++entry_i){
+		if(std::bitset<32>(entries[entry_i].idtgsk).test(28) && std::bitset<32>(entries[entry_i+1].idtgsk).test(29)){
+			entries[entry_i].aft_partner = entry_i+1;
+			entries[entry_i+1].aft_partner = entry_i;
+		}
+	}
+}
+
+bool TriggerIndex::Write(const std::string& index_file) const {
+	std::ofstream outfile(index_file, std::ios::binary | std::ios::trunc);
+	if(!outfile.is_open()){
+		std::cerr<<"TriggerIndex::Write error! Could not open "<<index_file<<" for writing"<<std::endl;
+		return false;
+	}
+	index_file_header header;
+	std::memcpy(header.magic, index_magic, sizeof(index_magic));
+	header.version = index_version;
+	header.record_size = sizeof(trigger_index_entry);
+	header.nentries = entries.size();
+	header.source_size = source_size;
+	header.source_mtime = source_mtime;
+	outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	outfile.write(reinterpret_cast<const char*>(entries.data()), entries.size()*sizeof(trigger_index_entry));
+	if(!outfile.good()){
+		std::cerr<<"TriggerIndex::Write error writing "<<index_file<<std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool TriggerIndex::Read(const std::string& index_file, const std::string& source_file){
+	Clear();
+	std::ifstream infile(index_file, std::ios::binary);
+	if(!infile.is_open()) return false;  // no index; not necessarily an error
+	index_file_header header;
+	infile.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if(!infile.good() || std::memcmp(header.magic, index_magic, sizeof(index_magic))!=0 ||
+	   header.version!=index_version || header.record_size!=sizeof(trigger_index_entry)){
+		std::cerr<<"TriggerIndex::Read error! "<<index_file<<" is not a compatible trigger index"<<std::endl;
+		return false;
+	}
+	if(!source_file.empty()){
+		int64_t size=0, mtime=0;
+		if(!StatFile(source_file, size, mtime) || size!=header.source_size || mtime!=header.source_mtime){
+			std::cerr<<"TriggerIndex::Read error! "<<index_file<<" is out of date with respect to "
+			         <<source_file<<std::endl;
+			return false;
+		}
+	}
+	entries.resize(header.nentries);
+	infile.read(reinterpret_cast<char*>(entries.data()), entries.size()*sizeof(trigger_index_entry));
+	if(!infile.good()){
+		std::cerr<<"TriggerIndex::Read error! "<<index_file<<" is truncated"<<std::endl;
+		Clear();
+		return false;
+	}
+	source_size = header.source_size;
+	source_mtime = header.source_mtime;
+	file_offsets.push_back(0);
+	return true;
+}
+
+void TriggerIndex::Append(const TriggerIndex& other){
+	const long offset = entries.size();
+	for(long file_offset : other.file_offsets) file_offsets.push_back(file_offset+offset);
+	entries.insert(entries.end(), other.entries.begin(), other.entries.end());
+	for(size_t entry_i=offset; entry_i<entries.size(); ++entry_i){
+		if(entries[entry_i].aft_partner>=0) entries[entry_i].aft_partner += offset;
+	}
+	LinkPairs(offset);
+	time_order.clear();
+}
+
+void TriggerIndex::SortByTime() const {
+	time_order.resize(entries.size());
+	for(size_t entry_i=0; entry_i<entries.size(); ++entry_i){
+		time_order[entry_i] = {{entries[entry_i].nrunsk, entries[entry_i].ticks}, long(entry_i)};
+	}
+	std::sort(time_order.begin(), time_order.end());
+}
+
+std::vector<long> TriggerIndex::EntriesInWindow(int32_t nrunsk, int64_t ticks_min, int64_t ticks_max) const {
+	if(time_order.size()!=entries.size()) SortByTime();
+	auto first = std::lower_bound(time_order.begin(), time_order.end(),
+	                              std::make_pair(std::make_pair(nrunsk, ticks_min), long(-1)));
+	std::vector<long> matches;
+	for(auto it=first; it!=time_order.end() && it->first.first==nrunsk && it->first.second<=ticks_max; ++it){
+		matches.push_back(it->second);
+	}
+	return matches;
+}
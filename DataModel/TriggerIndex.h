@@ -0,0 +1,72 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef TRIGGER_INDEX_H
+#define TRIGGER_INDEX_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+class Header;
+
+// A per-file index of the HEADER information of every entry in an SKROOT file:
+// run, subrun and event numbers, trigger bits, event flags, trigger clock ticks
+// and SHE+AFT pairing. This is written once to a small sidecar file next to the input
+// (see the BuildTriggerIndex tool), after which entries can be selected, paired, and
+// searched by time without reading any event data.
+// The indices of several files may be appended, in which case entry numbers are those
+// of a TChain of the files in the same order.
+
+struct trigger_index_entry {
+	int32_t nrunsk=0;
+	int32_t nsubsk=0;
+	int32_t nevsk=0;
+	uint32_t idtgsk=0;        // trigger bits
+	uint32_t ifevsk=0;        // event flags
+	int32_t physics=0;        // 0 for pedestal or status entries
+	int64_t ticks=0;          // 47-bit trigger clock, as in RelicMuonMatching
+	int64_t aft_partner=-1;   // entry of the AFT following an SHE, or the SHE preceding an AFT
+};
+
+class TriggerIndex {
+
+	public:
+	// build the index of an SKROOT file by reading only its HEADER branch
+	bool Build(const std::string& input_file, const std::string& tree_name="data");
+	bool Write(const std::string& index_file) const;
+	// read an index file. If source_file is given, fails if the index is older than it.
+	bool Read(const std::string& index_file, const std::string& source_file="");
+	// append the index of the next file of a chain
+	void Append(const TriggerIndex& other);
+	void Clear();
+
+	// default location of the index for an input file: in index_dir if given, else alongside it
+	static std::string IndexPath(const std::string& input_file, const std::string& index_dir="");
+	// checks for PDST / RUNINFO entries as per the top of headsk.F
+	static bool NonPhysicsEntry(const Header* header);
+	// 47-bit trigger clock: upper 32 bits from counter_32 (nevhwsk), lower 15 from t0 (it0sk)
+	static int64_t TriggerTicks(int32_t nevhwsk, int32_t it0sk);
+
+	size_t size() const { return entries.size(); }
+	bool empty() const { return entries.empty(); }
+	const trigger_index_entry& at(long entry) const { return entries.at(entry); }
+	size_t GetNFiles() const { return file_offsets.size(); }
+	long GetFileOffset(size_t file_i) const { return file_offsets.at(file_i); }
+
+	// entries in the given run whose trigger ticks fall within [ticks_min, ticks_max], in time order
+	std::vector<long> EntriesInWindow(int32_t nrunsk, int64_t ticks_min, int64_t ticks_max) const;
+
+	private:
+	void LinkPairs(size_t first);
+	void SortByTime() const;
+
+	std::vector<trigger_index_entry> entries;
+	std::vector<long> file_offsets;  // first entry of each file
+	int64_t source_size=0;           // size and modification time of the indexed file,
+	int64_t source_mtime=0;          // to detect stale indices
+	// (run, ticks, entry), built on first time window query
+	mutable std::vector<std::pair<std::pair<int32_t,int64_t>,long>> time_order;
+
+};
+
+#endif
@@ -0,0 +1,382 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "UnbinnedFit.h"
+#include "ParallelFor.h"
+#include "WorkerPool.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <algorithm>
+#include <memory>
+
+#include "TROOT.h"
+#include "TRandom3.h"
+#include "Math/Minimizer.h"
+#include "Math/Factory.h"
+#include "Math/IFunction.h"
+
+namespace {
+
+// events are processed in batches of this size, small enough that
+// the per-component shape arrays of a batch stay in L1 cache
+constexpr size_t batch_size = 256;
+// fewest events worth handing to another thread in each evaluation;
+// below this the handoff costs more than the work saved
+constexpr size_t min_block_size = 32*batch_size;
+
+// normalisation of the shape of a component over the fit range.
+// exponentials are evaluated relative to the start of the range, exp(-(x-lo)/tau),
+// so that neither the shape nor the integral underflow when lo >> tau.
+struct component_norm {
+	double norm=1;           // 1/integral of the shape over the range
+	double dlog_integral=0;  // d(ln integral)/d(lifetime)
+	double lifetime=0;       // lifetime for which this was calculated, for caching
+};
+
+class UnbinnedNLL : public ROOT::Math::IMultiGradFunction {
+	public:
+	UnbinnedNLL(const double* data_in, size_t nevents_in, const std::vector<unbinned_component>& components_in,
+	            size_t npar_in, double range_min_in, double range_max_in, WorkerPool* pool_in) :
+		data(data_in), nevents(nevents_in), components(components_in), npar(npar_in),
+		range_min(range_min_in), range_max(range_max_in), pool(pool_in) {
+		norms.resize(components.size());
+		for(size_t j=0; j<components.size(); ++j){
+			if(components[j].shape==unbinned_shape::flat) norms[j].norm = 1./(range_max-range_min);
+		}
+		// small datasets are evaluated serially
+		const size_t nthreads = (pool!=nullptr) ? pool->GetNThreads() : 1;
+		nblocks = std::max<size_t>(1, std::min<size_t>(nthreads, nevents/min_block_size));
+	}
+	ROOT::Math::IMultiGenFunction* Clone() const override { return new UnbinnedNLL(*this); }
+	unsigned int NDim() const override { return npar; }
+	void Gradient(const double* x, double* grad) const override {
+		Evaluate(x, grad);
+	}
+	void FdF(const double* x, double& f, double* grad) const override {
+		f = Evaluate(x, grad);
+	}
+
+	private:
+	double DoEval(const double* x) const override { return Evaluate(x, nullptr); }
+	double DoDerivative(const double* x, unsigned int icoord) const override {
+		std::vector<double> grad(npar);
+		Evaluate(x, grad.data());
+		return grad.at(icoord);
+	}
+
+	// per-block sums, combined after all blocks are done
+	struct partial_sums {
+		double log_sum=0;
+		std::vector<double> p_over_d;     // sum_i p_j(x_i)/D(x_i)
+		std::vector<double> xp_over_d;    // sum_i (x_i-lo) p_j(x_i)/D(x_i)
+	};
+
+	void Normalise(const double* x) const {
+		const double span = range_max-range_min;
+		for(size_t j=0; j<components.size(); ++j){
+			if(components[j].shape!=unbinned_shape::exponential) continue;
+			const double tau = x[components[j].lifetime_par];
+			if(tau==norms[j].lifetime) continue;
+			// integral = tau*(1-exp(-span/tau))
+			const double e = std::exp(-span/tau);
+			const double integral = -tau*std::expm1(-span/tau);
+			norms[j].norm = 1./integral;
+			norms[j].dlog_integral = ((1.-e) - (span/tau)*e)/integral;
+			norms[j].lifetime = tau;
+		}
+	}
+
+	void SumBlock(const double* x, size_t first, size_t last, bool with_gradient, partial_sums& sums) const {
+		const size_t ncomp = components.size();
+		sums.log_sum=0;
+		sums.p_over_d.assign(ncomp,0.);
+		sums.xp_over_d.assign(ncomp,0.);
+		std::vector<double> shapes(ncomp*batch_size);
+		double shifted[batch_size];
+		double density[batch_size];
+
+		for(size_t batch_start=first; batch_start<last; batch_start+=batch_size){
+			const size_t m = std::min(batch_size, last-batch_start);
+			const double* values = data + batch_start;
+			for(size_t k=0; k<m; ++k) shifted[k] = values[k]-range_min;
+			std::fill(density, density+m, 0.);
+
+			// evaluate each component's shape for the whole batch, then accumulate the total density
+			for(size_t j=0; j<ncomp; ++j){
+				const double coefficient = x[components[j].yield_par]*norms[j].norm;
+				if(components[j].shape==unbinned_shape::exponential){
+					double* shape = shapes.data() + j*batch_size;
+					const double inv_tau = 1./x[components[j].lifetime_par];
+					for(size_t k=0; k<m; ++k) shape[k] = std::exp(-shifted[k]*inv_tau);
+					for(size_t k=0; k<m; ++k) density[k] += coefficient*shape[k];
+				} else {
+					for(size_t k=0; k<m; ++k) density[k] += coefficient;
+				}
+			}
+			for(size_t k=0; k<m; ++k){
+				density[k] = std::max(density[k], std::numeric_limits<double>::min());
+				sums.log_sum += std::log(density[k]);
+			}
+
+			if(!with_gradient) continue;
+			for(size_t k=0; k<m; ++k) density[k] = 1./density[k];
+			for(size_t j=0; j<ncomp; ++j){
+				const double norm = norms[j].norm;
+				if(components[j].shape==unbinned_shape::exponential){
+					const double* shape = shapes.data() + j*batch_size;
+					double sum=0, xsum=0;
+					for(size_t k=0; k<m; ++k){
+						const double p_over_d = norm*shape[k]*density[k];
+						sum += p_over_d;
+						xsum += shifted[k]*p_over_d;
+					}
+					sums.p_over_d[j] += sum;
+					sums.xp_over_d[j] += xsum;
+				} else {
+					double sum=0;
+					for(size_t k=0; k<m; ++k) sum += density[k];
+					sums.p_over_d[j] += norm*sum;
+				}
+			}
+		}
+	}
+
+	// -2lnL = 2*(sum_j N_j - sum_i ln(sum_j N_j p_j(x_i)))
+	double Evaluate(const double* x, double* grad) const {
+		Normalise(x);
+		partials.resize(nblocks);
+		if(nblocks==1){
+			SumBlock(x, 0, nevents, grad!=nullptr, partials.front());
+		} else {
+			pool->Run(nblocks, [&](size_t block_i, int){
+				SumBlock(x, (nevents*block_i)/nblocks, (nevents*(block_i+1))/nblocks, grad!=nullptr, partials[block_i]);
+			});
+		}
+
+		double total_yield=0;
+		for(const unbinned_component& acomponent : components) total_yield += x[acomponent.yield_par];
+		double log_sum=0;
+		for(const partial_sums& sums : partials) log_sum += sums.log_sum;
+
+		if(grad!=nullptr){
+			std::fill(grad, grad+npar, 0.);
+			for(size_t j=0; j<components.size(); ++j){
+				double p_over_d=0, xp_over_d=0;
+				for(const partial_sums& sums : partials){
+					p_over_d += sums.p_over_d[j];
+					xp_over_d += sums.xp_over_d[j];
+				}
+				grad[components[j].yield_par] = 2.*(1.-p_over_d);
+				if(components[j].shape==unbinned_shape::exponential){
+					// d ln p_j/d tau = (x-lo)/tau^2 - d(ln integral)/d tau
+					const double tau = x[components[j].lifetime_par];
+					grad[components[j].lifetime_par] = -2.*x[components[j].yield_par]
+					                       *(xp_over_d/(tau*tau) - norms[j].dlog_integral*p_over_d);
+				}
+			}
+		}
+		return 2.*(total_yield-log_sum);
+	}
+
+	const double* data;
+	size_t nevents;
+	const std::vector<unbinned_component>& components;
+	size_t npar;
+	double range_min;
+	double range_max;
+	WorkerPool* pool;        // shared by copies made by the minimizer, which evaluate one at a time
+	size_t nblocks;
+	// cached normalisations and sums. Each minimizer evaluates its own copy, so these are never shared between threads
+	mutable std::vector<component_norm> norms;
+	mutable std::vector<partial_sums> partials;
+};
+
+} // end anonymous namespace
+
+UnbinnedFit::UnbinnedFit(double range_min_in, double range_max_in) :
+	range_min(range_min_in), range_max(range_max_in) {
+	if(range_max<=range_min){
+		std::cerr<<"UnbinnedFit error! Invalid fit range "<<range_min<<" to "<<range_max<<std::endl;
+	}
+}
+
+UnbinnedFit::~UnbinnedFit(){
+	for(ROOT::Math::Minimizer* aminimizer : minimizers) delete aminimizer;
+	minimizers.clear();
+}
+
+int UnbinnedFit::AddParameter(std::string name, double value, bool fixed, double lower_limit){
+	if(par_numbers.count(name)){
+		std::cerr<<"UnbinnedFit error! Parameter "<<name<<" already exists"<<std::endl;
+		return -1;
+	}
+	int par = par_names.size();
+	par_numbers.emplace(name,par);
+	par_names.push_back(name);
+	par_values.push_back(value);
+	par_fixed.push_back(fixed);
+	par_lower_limits.push_back(lower_limit);
+	return par;
+}
+
+int UnbinnedFit::AddFlat(std::string name, double yield){
+	unbinned_component acomponent;
+	acomponent.name = name;
+	acomponent.shape = unbinned_shape::flat;
+	acomponent.yield_par = AddParameter(name, yield, false, 0.);
+	if(acomponent.yield_par<0) return -1;
+	components.push_back(acomponent);
+	return acomponent.yield_par;
+}
+
+int UnbinnedFit::AddExponential(std::string name, double yield, double lifetime, bool fix_lifetime){
+	if(lifetime<=0){
+		std::cerr<<"UnbinnedFit error! Lifetime of "<<name<<" must be positive"<<std::endl;
+		return -1;
+	}
+	unbinned_component acomponent;
+	acomponent.name = name;
+	acomponent.shape = unbinned_shape::exponential;
+	acomponent.yield_par = AddParameter(name, yield, false, 0.);
+	if(acomponent.yield_par<0) return -1;
+	// lifetimes must stay positive, but a limit of exactly 0 would let the minimizer divide by zero
+	acomponent.lifetime_par = AddParameter(name+"_lifetime", lifetime, fix_lifetime, 1E-6*(range_max-range_min));
+	components.push_back(acomponent);
+	return acomponent.yield_par;
+}
+
+int UnbinnedFit::GetParNumber(std::string name) const {
+	auto it = par_numbers.find(name);
+	return (it==par_numbers.end()) ? -1 : it->second;
+}
+
+double UnbinnedFit::GetParError(int par) const {
+	if(par<0 || size_t(par)>=best_result.errors.size()) return 0;
+	return best_result.errors.at(par);
+}
+
+double UnbinnedFit::Density(double x) const {
+	double density=0;
+	for(const unbinned_component& acomponent : components){
+		const double yield = par_values.at(acomponent.yield_par);
+		if(acomponent.shape==unbinned_shape::exponential){
+			const double tau = par_values.at(acomponent.lifetime_par);
+			density += yield*std::exp(-(x-range_min)/tau)/(-tau*std::expm1(-(range_max-range_min)/tau));
+		} else {
+			density += yield/(range_max-range_min);
+		}
+	}
+	return density;
+}
+
+int UnbinnedFit::PrepareMinimizers(int nworkers){
+	if(nworkers>1) ROOT::EnableThreadSafety();
+	// creation goes via the plugin manager, which we must not call concurrently
+	while(minimizers.size()<size_t(nworkers)){
+		ROOT::Math::Minimizer* aminimizer = ROOT::Math::Factory::CreateMinimizer("Minuit2","Migrad");
+		if(aminimizer==nullptr){
+			std::cerr<<"UnbinnedFit error! Failed to create Minuit2 minimizer"<<std::endl;
+			break;
+		}
+		aminimizer->SetPrintLevel((verbosity>3 && nworkers==1) ? 1 : 0);
+		aminimizer->SetStrategy(1);
+		aminimizer->SetMaxFunctionCalls(100000);
+		aminimizer->SetTolerance(0.01);
+		minimizers.push_back(aminimizer);
+	}
+	return std::min(int(minimizers.size()), nworkers);
+}
+
+bool UnbinnedFit::Minimize(ROOT::Math::Minimizer* minimizer, const std::vector<double>& values,
+                           int event_threads, unbinned_fit_result& result) const {
+	// threads to split the events of each evaluation, kept for the whole fit
+	std::unique_ptr<WorkerPool> pool;
+	const int nthreads_used = std::min<size_t>(event_threads, values.size()/min_block_size);
+	if(nthreads_used>1) pool.reset(new WorkerPool(nthreads_used));
+	// SetFunction gives Minuit2 a clone of nll, which shares the pool and the values; the clone
+	// is not evaluated after this returns, so both need only live until then
+	UnbinnedNLL nll(values.data(), values.size(), components, par_names.size(), range_min, range_max, pool.get());
+	minimizer->Clear();
+	minimizer->SetErrorDef(1.);  // -2lnL
+	minimizer->SetFunction(nll);
+	const double default_yield = std::max(1., double(values.size())/components.size());
+	for(size_t par=0; par<par_names.size(); ++par){
+		if(par_fixed[par]){
+			minimizer->SetFixedVariable(par, par_names[par], par_values[par]);
+		} else {
+			// yields without a sensible starting value get an equal share of the events
+			double startval = par_values[par];
+			if(startval<=par_lower_limits[par]) startval = default_yield;
+			minimizer->SetLowerLimitedVariable(par, par_names[par], startval, 0.1*startval, par_lower_limits[par]);
+		}
+	}
+
+	bool ok = minimizer->Minimize();
+	if(ok) ok = minimizer->Hesse();
+
+	result.values.assign(minimizer->X(), minimizer->X()+par_names.size());
+	if(minimizer->Errors()!=nullptr){
+		result.errors.assign(minimizer->Errors(), minimizer->Errors()+par_names.size());
+	} else {
+		result.errors.assign(par_names.size(), 0.);
+	}
+	result.nll = minimizer->MinValue();
+	result.status = minimizer->Status();
+	return ok;
+}
+
+bool UnbinnedFit::Fit(){
+	if(data.empty() || components.empty()){
+		std::cerr<<"UnbinnedFit::Fit error! No data or no model components"<<std::endl;
+		return false;
+	}
+	if(PrepareMinimizers(1)==0) return false;
+	// a single fit, so split the events across threads
+	Minimize(minimizers.front(), data, nthreads, best_result);
+	if(best_result.status!=0 && verbosity){
+		std::cerr<<"UnbinnedFit warning! Fit did not converge, status "<<best_result.status<<std::endl;
+	}
+	par_values = best_result.values;
+	return best_result.status==0;
+}
+
+std::vector<double> UnbinnedFit::Bootstrap(int nreplicas, unsigned int seed, std::vector<unbinned_fit_result>* replicas){
+	std::vector<double> spread(par_names.size(),0.);
+	if(nreplicas<2 || data.empty()) return spread;
+	int nworkers = PrepareMinimizers(std::min(nthreads,nreplicas));
+	if(nworkers==0) return spread;
+
+	// many independent fits, so split the replicas across threads rather than the events
+	std::vector<unbinned_fit_result> results(nreplicas);
+	ParallelFor(nreplicas, nworkers, [&](size_t replica_i, int thread_i){
+		// seed by replica number, so the ensemble doesn't depend on the number of threads.
+		// TRandom3 treats a seed of 0 as 'random', so offset by one.
+		TRandom3 rng(seed+replica_i+1);
+		std::vector<double> resampled(data.size());
+		for(double& avalue : resampled) avalue = data[rng.Integer(data.size())];
+		Minimize(minimizers.at(thread_i), resampled, 1, results.at(replica_i));
+	});
+
+	// standard deviation of each parameter over the converged replicas
+	std::vector<double> sum(par_names.size(),0.), sum2(par_names.size(),0.);
+	int nconverged=0;
+	for(const unbinned_fit_result& aresult : results){
+		if(aresult.status!=0) continue;
+		++nconverged;
+		for(size_t par=0; par<par_names.size(); ++par){
+			sum[par] += aresult.values[par];
+			sum2[par] += aresult.values[par]*aresult.values[par];
+		}
+	}
+	if(nconverged>1){
+		for(size_t par=0; par<par_names.size(); ++par){
+			const double mean = sum[par]/nconverged;
+			spread[par] = std::sqrt(std::max(0., (sum2[par]/nconverged - mean*mean)*nconverged/(nconverged-1.)));
+		}
+	}
+	if(verbosity>1){
+		std::cout<<"UnbinnedFit: "<<nconverged<<"/"<<nreplicas<<" bootstrap replicas converged"<<std::endl;
+	}
+	if(replicas!=nullptr) *replicas = std::move(results);
+	return spread;
+}
@@ -0,0 +1,111 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef UNBINNED_FIT_H
+#define UNBINNED_FIT_H
+
+#include <string>
+#include <vector>
+#include <map>
+
+namespace ROOT { namespace Math { class Minimizer; } }
+
+// Extended unbinned maximum likelihood fit of a 1D distribution (e.g. decay times)
+// to a sum of flat and exponential components over a fixed range.
+// The data is held as one contiguous array of values, and the likelihood is evaluated
+// over it in fixed-size batches: each component's shape is computed for the whole batch
+// before the densities are combined and logged, so the inner loops are simple
+// array expressions the compiler can vectorise. Normalisation integrals depend only on
+// the parameters, so are computed once per evaluation (and cached between evaluations
+// with the same lifetimes) rather than per event. For large datasets the sum over events
+// is split across a pool of threads kept for the whole fit, with partial sums always
+// combined in the same order; small ones are evaluated serially.
+// Gradients with respect to all yields and lifetimes are computed analytically in the same pass.
+//
+// Parameters are the yield (number of events in the range) of each component,
+// and the lifetime of each exponential component, named "<component>_lifetime".
+// Errors may be estimated from the fit, or by bootstrap resampling of the data.
+
+enum class unbinned_shape { flat, exponential };
+
+struct unbinned_component {
+	std::string name;
+	unbinned_shape shape=unbinned_shape::flat;
+	int yield_par=-1;
+	int lifetime_par=-1;
+};
+
+struct unbinned_fit_result {
+	std::vector<double> values;
+	std::vector<double> errors;
+	double nll=0;     // -2lnL
+	int status=-1;    // minimizer status, 0 for success
+};
+
+class UnbinnedFit {
+
+	public:
+	UnbinnedFit(double range_min_in, double range_max_in);
+	~UnbinnedFit();
+	UnbinnedFit(const UnbinnedFit&)=delete;
+	UnbinnedFit& operator=(const UnbinnedFit&)=delete;
+
+	// data outside the fit range is dropped
+	template<typename T>
+	void SetData(const std::vector<T>& values){
+		data.clear();
+		data.reserve(values.size());
+		for(const T& avalue : values){
+			if(avalue>=range_min && avalue<=range_max) data.push_back(avalue);
+		}
+	}
+	size_t GetNEvents() const { return data.size(); }
+
+	// model
+	int AddFlat(std::string name, double yield);
+	int AddExponential(std::string name, double yield, double lifetime, bool fix_lifetime=true);
+	int GetParNumber(std::string name) const;
+	size_t GetNpar() const { return par_names.size(); }
+	const std::string& GetParName(int par) const { return par_names.at(par); }
+	void SetParameter(int par, double value){ par_values.at(par)=value; }
+	void FixParameter(int par, double value){ par_values.at(par)=value; par_fixed.at(par)=true; }
+	void ReleaseParameter(int par){ par_fixed.at(par)=false; }
+	double GetParameter(int par) const { return par_values.at(par); }
+	double GetParError(int par) const;
+	// fitted density in events per unit x, for drawing
+	double Density(double x) const;
+
+	void SetNThreads(int nthreads_in){ nthreads = (nthreads_in>1) ? nthreads_in : 1; }
+	void SetVerbosity(int verb){ verbosity=verb; }
+
+	// fit the data. On success the parameters are updated to the best fit.
+	bool Fit();
+	const unbinned_fit_result& GetResult() const { return best_result; }
+	// refit nreplicas datasets resampled (with replacement) from the data, starting from
+	// the current parameters. Returns the standard deviation of each parameter across replicas,
+	// and optionally the results of each replica.
+	std::vector<double> Bootstrap(int nreplicas, unsigned int seed, std::vector<unbinned_fit_result>* replicas=nullptr);
+
+	private:
+	int AddParameter(std::string name, double value, bool fixed, double lower_limit);
+	int PrepareMinimizers(int nworkers);
+	bool Minimize(ROOT::Math::Minimizer* minimizer, const std::vector<double>& values,
+	              int event_threads, unbinned_fit_result& result) const;
+
+	double range_min;
+	double range_max;
+	std::vector<double> data;
+
+	std::vector<unbinned_component> components;
+	std::vector<std::string> par_names;
+	std::vector<double> par_values;
+	std::vector<bool> par_fixed;
+	std::vector<double> par_lower_limits;
+	std::map<std::string,int> par_numbers;
+
+	int nthreads=1;
+	int verbosity=1;
+	unbinned_fit_result best_result;
+	std::vector<ROOT::Math::Minimizer*> minimizers;   // one per thread, reused between fits
+
+};
+
+#endif
@@ -0,0 +1,123 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <exception>
+#include <algorithm>
+
+// A fixed set of threads for running many short parallel loops, such as one per
+// likelihood evaluation, without starting and joining threads for each of them.
+// Run(n, func) calls func(i, thread_i) for every i in [0, n), partitioned into contiguous
+// blocks exactly as ParallelFor does, so results written by index are the same either way.
+// The calling thread processes the first block and waits for the rest.
+// The first exception thrown by any thread is rethrown once all blocks are done.
+// Run must not be called concurrently, or from within a loop being run.
+
+class WorkerPool {
+
+	public:
+	explicit WorkerPool(int nthreads_in) : nthreads(std::max(1, nthreads_in)) {
+		workers.reserve(nthreads-1);
+		for(int thread_i=1; thread_i<nthreads; ++thread_i){
+			workers.emplace_back(&WorkerPool::Work, this, thread_i);
+		}
+	}
+	~WorkerPool(){
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			stopping=true;
+		}
+		job_ready.notify_all();
+		for(std::thread& aworker : workers) aworker.join();
+	}
+	WorkerPool(const WorkerPool&)=delete;
+	WorkerPool& operator=(const WorkerPool&)=delete;
+
+	int GetNThreads() const { return nthreads; }
+
+	template<typename F>
+	void Run(size_t n, F&& func){
+		if(n==0) return;
+		const size_t nblocks = std::min<size_t>(nthreads, n);
+		if(nblocks==1){
+			for(size_t i=0; i<n; ++i) func(i, 0);
+			return;
+		}
+		errors.assign(nblocks, nullptr);
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			job = [&func](size_t i, int thread_i){ func(i, thread_i); };
+			job_size = n;
+			job_blocks = nblocks;
+			pending = nblocks-1;
+			++generation;
+		}
+		job_ready.notify_all();
+		RunBlock(0);
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			job_done.wait(lock, [this](){ return pending==0; });
+			job = nullptr;
+		}
+		for(std::exception_ptr& anerror : errors){
+			if(anerror) std::rethrow_exception(anerror);
+		}
+	}
+
+	private:
+	void RunBlock(size_t thread_i){
+		const size_t first = (job_size*thread_i)/job_blocks;
+		const size_t last = (job_size*(thread_i+1))/job_blocks;
+		try {
+			for(size_t i=first; i<last; ++i) job(i, static_cast<int>(thread_i));
+		} catch(...){
+			errors.at(thread_i) = std::current_exception();
+		}
+	}
+
+	void Work(int thread_i){
+		size_t done_generation=0;
+		while(true){
+			bool in_job=false;
+			{
+				std::unique_lock<std::mutex> lock(mtx);
+				job_ready.wait(lock, [&](){ return stopping || generation!=done_generation; });
+				if(stopping) return;
+				done_generation = generation;
+				// threads beyond the number of blocks of this job sit it out
+				in_job = size_t(thread_i)<job_blocks;
+			}
+			if(!in_job) continue;
+			RunBlock(thread_i);
+			bool last_one=false;
+			{
+				std::unique_lock<std::mutex> lock(mtx);
+				last_one = (--pending==0);
+			}
+			if(last_one) job_done.notify_one();
+		}
+	}
+
+	int nthreads;
+	std::vector<std::thread> workers;
+	std::mutex mtx;
+	std::condition_variable job_ready;
+	std::condition_variable job_done;
+	bool stopping=false;
+	size_t generation=0;
+
+	// the current job; only changed while no blocks are pending
+	std::function<void(size_t,int)> job;
+	size_t job_size=0;
+	size_t job_blocks=0;
+	size_t pending=0;
+	std::vector<std::exception_ptr> errors;
+
+};
+
+#endif
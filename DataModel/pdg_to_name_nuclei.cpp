@@ -1,4102 +1,4129 @@
-// if we just declare the map with an initializer list, compilation takes forever
-// according to https://gcc.gnu.org/bugzilla/show_bug.cgi?id=55402 this is a gcc bug
-// and assigning elements with a function should be much faster than a large initialiser list.
-// we could probably also disable anything we don't need
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// Names of particles and nuclei by pdg code, used by PdgToString for codes not in TDatabasePDG.
+// This used to be an unordered_map filled by assigning each element in turn, as a large
+// initializer list of a map takes forever to compile (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=55402),
+// and was refilled by every translation unit including Constants.h at startup.
+// As a constant array of plain structs it compiles quickly, is placed in read-only data
+// with nothing to do at startup, and lookups are a binary search.
+// Entries must be kept sorted by pdg code; this is checked when compiling.
 
-#include <unordered_map>
+#include "Constants.h"
 
-const std::unordered_map<int,std::string>* const GetParticleNameMap(){
-	static std::unordered_map<int,std::string> my_pdg_to_string;
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+struct pdg_name {
+	int pdg;
+	const char* name;
+};
+
+constexpr pdg_name pdg_names[] = {
 	// we actually use TDatabasePDG before we fall back to this, so these entries are probably not needed
-	my_pdg_to_string[2212] = "Proton";
-	my_pdg_to_string[-2212] = "Anti Proton";
-	my_pdg_to_string[11] = "Electron";
-	my_pdg_to_string[-11] = "Positron";
-	my_pdg_to_string[12] = "Electron Neutrino";
-	my_pdg_to_string[-12] = "Anti Electron Neutrino";
-	my_pdg_to_string[22] = "Gamma";
-	my_pdg_to_string[2112] = "Neutron";
-	my_pdg_to_string[-2112] = "Anti Neutron";
-	my_pdg_to_string[-13] = "Muon+";
-	my_pdg_to_string[13] = "Muon-";
-	my_pdg_to_string[130] = "Kaonlong";
-	my_pdg_to_string[211] = "Pion+";
-	my_pdg_to_string[-211] = "Pion-";
-	my_pdg_to_string[321] = "Kaon+";
-	my_pdg_to_string[-321] = "Kaon-";
-	my_pdg_to_string[3122] = "Lambda";
-	my_pdg_to_string[-3122] = "Antilambda";
-	my_pdg_to_string[310] = "Kaonshort";
-	my_pdg_to_string[3112] = "Sigma-";
-	my_pdg_to_string[3222] = "Sigma+";
-	my_pdg_to_string[3212] = "Sigma0";
-	my_pdg_to_string[111] = "Pion0";
-	my_pdg_to_string[311] = "Kaon0";
-	my_pdg_to_string[-311] = "Antikaon0";
-	my_pdg_to_string[14] = "Muon Neutrino";
-	my_pdg_to_string[-14] = "Anti Muon Neutrino";
-	my_pdg_to_string[-3222] = "Anti Sigma-";
-	my_pdg_to_string[-3212] = "Anti Sigma0";
-	my_pdg_to_string[-3112] = "Anti Sigma+";
-	my_pdg_to_string[3322] = "Xsi0";
-	my_pdg_to_string[-3322] = "Anti Xsi0";
-	my_pdg_to_string[3312] = "Xsi-";
-	my_pdg_to_string[-3312] = "Xsi+";
-	my_pdg_to_string[3334] = "Omega-";
-	my_pdg_to_string[-3334] = "Omega+";
-	my_pdg_to_string[-15] = "Tau+";
-	my_pdg_to_string[15] = "Tau-";
-	my_pdg_to_string[100] = "OpticalPhoton";
-	
+	{-3334, "Omega+"},
+	{-3322, "Anti Xsi0"},
+	{-3312, "Xsi+"},
+	{-3222, "Anti Sigma-"},
+	{-3212, "Anti Sigma0"},
+	{-3122, "Antilambda"},
+	{-3112, "Anti Sigma+"},
+	{-2212, "Anti Proton"},
+	{-2112, "Anti Neutron"},
+	{-321, "Kaon-"},
+	{-311, "Antikaon0"},
+	{-211, "Pion-"},
+	{-15, "Tau+"},
+	{-14, "Anti Muon Neutrino"},
+	{-13, "Muon+"},
+	{-12, "Anti Electron Neutrino"},
+	{-11, "Positron"},
+	{11, "Electron"},
+	{12, "Electron Neutrino"},
+	{13, "Muon-"},
+	{14, "Muon Neutrino"},
+	{15, "Tau-"},
+	{22, "Gamma"},
+	{100, "OpticalPhoton"},
+	{111, "Pion0"},
+	{130, "Kaonlong"},
+	{211, "Pion+"},
+	{310, "Kaonshort"},
+	{311, "Kaon0"},
+	{321, "Kaon+"},
+	{2112, "Neutron"},
+	{2212, "Proton"},
+	{3112, "Sigma-"},
+	{3122, "Lambda"},
+	{3212, "Sigma0"},
+	{3222, "Sigma+"},
+	{3312, "Xsi-"},
+	{3322, "Xsi0"},
+	{3334, "Omega-"},
 	// support skdetsim "custom" pdg codes
-	my_pdg_to_string[100045] = "Deuterium";
-	my_pdg_to_string[100046] = "Tritium";
-	my_pdg_to_string[100047] = "Alpha";
-	my_pdg_to_string[100048] = "Geantino";
-	my_pdg_to_string[100049] = "He3";
-	my_pdg_to_string[100069] = "O16";
-	
+	{100045, "Deuterium"},
+	{100046, "Tritium"},
+	{100047, "Alpha"},
+	{100048, "Geantino"},
+	{100049, "He3"},
+	{100069, "O16"},
 	// from https://twiki.cern.ch/twiki/pub/Geant4/ExtendingFnalDb/Nuclei.txt
-	my_pdg_to_string[1000010020] = "Deuterium";
-	my_pdg_to_string[1000010030] = "Tritium";
-	my_pdg_to_string[1000010060] = "H6";
-	my_pdg_to_string[1000020030] = "He3";
-	my_pdg_to_string[1000020040] = "alpha";
-	my_pdg_to_string[1000020050] = "He5";
-	my_pdg_to_string[1000020060] = "He6";
-	my_pdg_to_string[1000020070] = "He7";
-	my_pdg_to_string[1000020080] = "He8";
-	my_pdg_to_string[1000020100] = "He10";
-	my_pdg_to_string[1000030050] = "Li5";
-	my_pdg_to_string[1000030060] = "Li6";
-	my_pdg_to_string[1000030070] = "Li7";
-	my_pdg_to_string[1000030080] = "Li8";
-	my_pdg_to_string[1000030090] = "Li9";
-	my_pdg_to_string[1000030110] = "Li11";
-	my_pdg_to_string[1000040060] = "Be6";
-	my_pdg_to_string[1000040070] = "Be7";
-	my_pdg_to_string[1000040080] = "Be8";
-	my_pdg_to_string[1000040090] = "Be9";
-	my_pdg_to_string[1000040100] = "Be10";
-	my_pdg_to_string[1000040110] = "Be11";
-	my_pdg_to_string[1000040120] = "Be12";
-	my_pdg_to_string[1000040130] = "Be13";
-	my_pdg_to_string[1000040140] = "Be14";
-	my_pdg_to_string[1000050070] = "B7";
-	my_pdg_to_string[1000050080] = "B8";
-	my_pdg_to_string[1000050090] = "B9";
-	my_pdg_to_string[1000050100] = "B10";
-	my_pdg_to_string[1000050110] = "B11";
-	my_pdg_to_string[1000050120] = "B12";
-	my_pdg_to_string[1000050130] = "B13";
-	my_pdg_to_string[1000050140] = "B14";
-	my_pdg_to_string[1000050150] = "B15";
-	my_pdg_to_string[1000050160] = "B16";
-	my_pdg_to_string[1000050170] = "B17";
-	my_pdg_to_string[1000060080] = "C8";
-	my_pdg_to_string[1000060090] = "C9";
-	my_pdg_to_string[1000060100] = "C10";
-	my_pdg_to_string[1000060110] = "C11";
-	my_pdg_to_string[1000060120] = "C12";
-	my_pdg_to_string[1000060130] = "C13";
-	my_pdg_to_string[1000060140] = "C14";
-	my_pdg_to_string[1000060150] = "C15";
-	my_pdg_to_string[1000060160] = "C16";
-	my_pdg_to_string[1000060170] = "C17";
-	my_pdg_to_string[1000060180] = "C18";
-	my_pdg_to_string[1000060200] = "C20";
-	my_pdg_to_string[1000060220] = "C22";
-	my_pdg_to_string[1000070110] = "N11";
-	my_pdg_to_string[1000070120] = "N12";
-	my_pdg_to_string[1000070130] = "N13";
-	my_pdg_to_string[1000070140] = "N14";
-	my_pdg_to_string[1000070150] = "N15";
-	my_pdg_to_string[1000070160] = "N16";
-	my_pdg_to_string[1000070161] = "N16[120.420]";
-	my_pdg_to_string[1000070170] = "N17";
-	my_pdg_to_string[1000070180] = "N18";
-	my_pdg_to_string[1000070190] = "N19";
-	my_pdg_to_string[1000070200] = "N20";
-	my_pdg_to_string[1000070210] = "N21";
-	my_pdg_to_string[1000070220] = "N22";
-	my_pdg_to_string[1000070230] = "N23";
-	my_pdg_to_string[1000070240] = "N24";
-	my_pdg_to_string[1000080120] = "O12";
-	my_pdg_to_string[1000080130] = "O13";
-	my_pdg_to_string[1000080140] = "O14";
-	my_pdg_to_string[1000080150] = "O15";
-	my_pdg_to_string[1000080160] = "O16";
-	my_pdg_to_string[1000080170] = "O17";
-	my_pdg_to_string[1000080180] = "O18";
-	my_pdg_to_string[1000080190] = "O19";
-	my_pdg_to_string[1000080200] = "O20";
-	my_pdg_to_string[1000080210] = "O21";
-	my_pdg_to_string[1000080220] = "O22";
-	my_pdg_to_string[1000080230] = "O23";
-	my_pdg_to_string[1000080240] = "O24";
-	my_pdg_to_string[1000080260] = "O26";
-	my_pdg_to_string[1000090140] = "F14";
-	my_pdg_to_string[1000090150] = "F15";
-	my_pdg_to_string[1000090160] = "F16";
-	my_pdg_to_string[1000090170] = "F17";
-	my_pdg_to_string[1000090180] = "F18";
-	my_pdg_to_string[1000090190] = "F19";
-	my_pdg_to_string[1000090200] = "F20";
-	my_pdg_to_string[1000090210] = "F21";
-	my_pdg_to_string[1000090220] = "F22";
-	my_pdg_to_string[1000090230] = "F23";
-	my_pdg_to_string[1000090240] = "F24";
-	my_pdg_to_string[1000090250] = "F25";
-	my_pdg_to_string[1000090260] = "F26";
-	my_pdg_to_string[1000090270] = "F27";
-	my_pdg_to_string[1000090280] = "F28";
-	my_pdg_to_string[1000090290] = "F29";
-	my_pdg_to_string[1000090310] = "F31";
-	my_pdg_to_string[1000100160] = "Ne16";
-	my_pdg_to_string[1000100170] = "Ne17";
-	my_pdg_to_string[1000100180] = "Ne18";
-	my_pdg_to_string[1000100190] = "Ne19";
-	my_pdg_to_string[1000100200] = "Ne20";
-	my_pdg_to_string[1000100210] = "Ne21";
-	my_pdg_to_string[1000100220] = "Ne22";
-	my_pdg_to_string[1000100230] = "Ne23";
-	my_pdg_to_string[1000100240] = "Ne24";
-	my_pdg_to_string[1000100250] = "Ne25";
-	my_pdg_to_string[1000100260] = "Ne26";
-	my_pdg_to_string[1000100270] = "Ne27";
-	my_pdg_to_string[1000100280] = "Ne28";
-	my_pdg_to_string[1000100290] = "Ne29";
-	my_pdg_to_string[1000100300] = "Ne30";
-	my_pdg_to_string[1000100310] = "Ne31";
-	my_pdg_to_string[1000100320] = "Ne32";
-	my_pdg_to_string[1000100340] = "Ne34";
-	my_pdg_to_string[1000110200] = "Na20";
-	my_pdg_to_string[1000110210] = "Na21";
-	my_pdg_to_string[1000110220] = "Na22";
-	my_pdg_to_string[1000110230] = "Na23";
-	my_pdg_to_string[1000110240] = "Na24";
-	my_pdg_to_string[1000110241] = "Na24[472.207]";
-	my_pdg_to_string[1000110250] = "Na25";
-	my_pdg_to_string[1000110260] = "Na26";
-	my_pdg_to_string[1000110261] = "Na26[82.500]";
-	my_pdg_to_string[1000110270] = "Na27";
-	my_pdg_to_string[1000110280] = "Na28";
-	my_pdg_to_string[1000110290] = "Na29";
-	my_pdg_to_string[1000110300] = "Na30";
-	my_pdg_to_string[1000110310] = "Na31";
-	my_pdg_to_string[1000110320] = "Na32";
-	my_pdg_to_string[1000110330] = "Na33";
-	my_pdg_to_string[1000110340] = "Na34";
-	my_pdg_to_string[1000110350] = "Na35";
-	my_pdg_to_string[1000110370] = "Na37";
-	my_pdg_to_string[1000120190] = "Mg19";
-	my_pdg_to_string[1000120200] = "Mg20";
-	my_pdg_to_string[1000120210] = "Mg21";
-	my_pdg_to_string[1000120220] = "Mg22";
-	my_pdg_to_string[1000120230] = "Mg23";
-	my_pdg_to_string[1000120240] = "Mg24";
-	my_pdg_to_string[1000120250] = "Mg25";
-	my_pdg_to_string[1000120260] = "Mg26";
-	my_pdg_to_string[1000120270] = "Mg27";
-	my_pdg_to_string[1000120280] = "Mg28";
-	my_pdg_to_string[1000120290] = "Mg29";
-	my_pdg_to_string[1000120300] = "Mg30";
-	my_pdg_to_string[1000120310] = "Mg31";
-	my_pdg_to_string[1000120320] = "Mg32";
-	my_pdg_to_string[1000120330] = "Mg33";
-	my_pdg_to_string[1000120340] = "Mg34";
-	my_pdg_to_string[1000120350] = "Mg35";
-	my_pdg_to_string[1000120360] = "Mg36";
-	my_pdg_to_string[1000120370] = "Mg37";
-	my_pdg_to_string[1000120380] = "Mg38";
-	my_pdg_to_string[1000120400] = "Mg40";
-	my_pdg_to_string[1000130210] = "Al21";
-	my_pdg_to_string[1000130220] = "Al22";
-	my_pdg_to_string[1000130230] = "Al23";
-	my_pdg_to_string[1000130240] = "Al24";
-	my_pdg_to_string[1000130241] = "Al24[425.800]";
-	my_pdg_to_string[1000130250] = "Al25";
-	my_pdg_to_string[1000130260] = "Al26";
-	my_pdg_to_string[1000130261] = "Al26[228.305]";
-	my_pdg_to_string[1000130270] = "Al27";
-	my_pdg_to_string[1000130280] = "Al28";
-	my_pdg_to_string[1000130290] = "Al29";
-	my_pdg_to_string[1000130300] = "Al30";
-	my_pdg_to_string[1000130310] = "Al31";
-	my_pdg_to_string[1000130320] = "Al32";
-	my_pdg_to_string[1000130330] = "Al33";
-	my_pdg_to_string[1000130340] = "Al34";
-	my_pdg_to_string[1000130350] = "Al35";
-	my_pdg_to_string[1000130360] = "Al36";
-	my_pdg_to_string[1000130370] = "Al37";
-	my_pdg_to_string[1000130380] = "Al38";
-	my_pdg_to_string[1000130390] = "Al39";
-	my_pdg_to_string[1000130400] = "Al40";
-	my_pdg_to_string[1000130410] = "Al41";
-	my_pdg_to_string[1000130420] = "Al42";
-	my_pdg_to_string[1000140220] = "Si22";
-	my_pdg_to_string[1000140230] = "Si23";
-	my_pdg_to_string[1000140260] = "Si26";
-	my_pdg_to_string[1000140270] = "Si27";
-	my_pdg_to_string[1000140280] = "Si28";
-	my_pdg_to_string[1000140290] = "Si29";
-	my_pdg_to_string[1000140300] = "Si30";
-	my_pdg_to_string[1000140310] = "Si31";
-	my_pdg_to_string[1000140320] = "Si32";
-	my_pdg_to_string[1000140330] = "Si33";
-	my_pdg_to_string[1000140340] = "Si34";
-	my_pdg_to_string[1000140350] = "Si35";
-	my_pdg_to_string[1000140360] = "Si36";
-	my_pdg_to_string[1000140370] = "Si37";
-	my_pdg_to_string[1000140380] = "Si38";
-	my_pdg_to_string[1000140390] = "Si39";
-	my_pdg_to_string[1000140400] = "Si40";
-	my_pdg_to_string[1000140410] = "Si41";
-	my_pdg_to_string[1000140420] = "Si42";
-	my_pdg_to_string[1000140430] = "Si43";
-	my_pdg_to_string[1000140440] = "Si44";
-	my_pdg_to_string[1000150250] = "P25";
-	my_pdg_to_string[1000150260] = "P26";
-	my_pdg_to_string[1000150270] = "P27";
-	my_pdg_to_string[1000150280] = "P28";
-	my_pdg_to_string[1000150290] = "P29";
-	my_pdg_to_string[1000150300] = "P30";
-	my_pdg_to_string[1000150310] = "P31";
-	my_pdg_to_string[1000150320] = "P32";
-	my_pdg_to_string[1000150330] = "P33";
-	my_pdg_to_string[1000150340] = "P34";
-	my_pdg_to_string[1000150350] = "P35";
-	my_pdg_to_string[1000150360] = "P36";
-	my_pdg_to_string[1000150370] = "P37";
-	my_pdg_to_string[1000150380] = "P38";
-	my_pdg_to_string[1000150390] = "P39";
-	my_pdg_to_string[1000150400] = "P40";
-	my_pdg_to_string[1000150410] = "P41";
-	my_pdg_to_string[1000150420] = "P42";
-	my_pdg_to_string[1000150430] = "P43";
-	my_pdg_to_string[1000150440] = "P44";
-	my_pdg_to_string[1000150450] = "P45";
-	my_pdg_to_string[1000160270] = "S27";
-	my_pdg_to_string[1000160280] = "S28";
-	my_pdg_to_string[1000160290] = "S29";
-	my_pdg_to_string[1000160300] = "S30";
-	my_pdg_to_string[1000160310] = "S31";
-	my_pdg_to_string[1000160320] = "S32";
-	my_pdg_to_string[1000160330] = "S33";
-	my_pdg_to_string[1000160340] = "S34";
-	my_pdg_to_string[1000160350] = "S35";
-	my_pdg_to_string[1000160360] = "S36";
-	my_pdg_to_string[1000160370] = "S37";
-	my_pdg_to_string[1000160380] = "S38";
-	my_pdg_to_string[1000160390] = "S39";
-	my_pdg_to_string[1000160400] = "S40";
-	my_pdg_to_string[1000160410] = "S41";
-	my_pdg_to_string[1000160420] = "S42";
-	my_pdg_to_string[1000160430] = "S43";
-	my_pdg_to_string[1000160440] = "S44";
-	my_pdg_to_string[1000160441] = "S44[1365.000]";
-	my_pdg_to_string[1000160450] = "S45";
-	my_pdg_to_string[1000160460] = "S46";
-	my_pdg_to_string[1000160480] = "S48";
-	my_pdg_to_string[1000170290] = "Cl29";
-	my_pdg_to_string[1000170300] = "Cl30";
-	my_pdg_to_string[1000170310] = "Cl31";
-	my_pdg_to_string[1000170320] = "Cl32";
-	my_pdg_to_string[1000170330] = "Cl33";
-	my_pdg_to_string[1000170340] = "Cl34";
-	my_pdg_to_string[1000170341] = "Cl34[146.360]";
-	my_pdg_to_string[1000170350] = "Cl35";
-	my_pdg_to_string[1000170360] = "Cl36";
-	my_pdg_to_string[1000170370] = "Cl37";
-	my_pdg_to_string[1000170380] = "Cl38";
-	my_pdg_to_string[1000170381] = "Cl38[671.365]";
-	my_pdg_to_string[1000170390] = "Cl39";
-	my_pdg_to_string[1000170400] = "Cl40";
-	my_pdg_to_string[1000170410] = "Cl41";
-	my_pdg_to_string[1000170420] = "Cl42";
-	my_pdg_to_string[1000170430] = "Cl43";
-	my_pdg_to_string[1000170440] = "Cl44";
-	my_pdg_to_string[1000170450] = "Cl45";
-	my_pdg_to_string[1000170460] = "Cl46";
-	my_pdg_to_string[1000170470] = "Cl47";
-	my_pdg_to_string[1000170480] = "Cl48";
-	my_pdg_to_string[1000170500] = "Cl50";
-	my_pdg_to_string[1000170510] = "Cl51";
-	my_pdg_to_string[1000180310] = "Ar31";
-	my_pdg_to_string[1000180320] = "Ar32";
-	my_pdg_to_string[1000180330] = "Ar33";
-	my_pdg_to_string[1000180340] = "Ar34";
-	my_pdg_to_string[1000180350] = "Ar35";
-	my_pdg_to_string[1000180360] = "Ar36";
-	my_pdg_to_string[1000180370] = "Ar37";
-	my_pdg_to_string[1000180380] = "Ar38";
-	my_pdg_to_string[1000180390] = "Ar39";
-	my_pdg_to_string[1000180400] = "Ar40";
-	my_pdg_to_string[1000180410] = "Ar41";
-	my_pdg_to_string[1000180420] = "Ar42";
-	my_pdg_to_string[1000180430] = "Ar43";
-	my_pdg_to_string[1000180440] = "Ar44";
-	my_pdg_to_string[1000180450] = "Ar45";
-	my_pdg_to_string[1000180460] = "Ar46";
-	my_pdg_to_string[1000180470] = "Ar47";
-	my_pdg_to_string[1000180480] = "Ar48";
-	my_pdg_to_string[1000180490] = "Ar49";
-	my_pdg_to_string[1000180500] = "Ar50";
-	my_pdg_to_string[1000180510] = "Ar51";
-	my_pdg_to_string[1000180520] = "Ar52";
-	my_pdg_to_string[1000180530] = "Ar53";
-	my_pdg_to_string[1000190350] = "K35";
-	my_pdg_to_string[1000190360] = "K36";
-	my_pdg_to_string[1000190370] = "K37";
-	my_pdg_to_string[1000190380] = "K38";
-	my_pdg_to_string[1000190381] = "K38[130.400]";
-	my_pdg_to_string[1000190382] = "K38[3458.140]";
-	my_pdg_to_string[1000190390] = "K39";
-	my_pdg_to_string[1000190400] = "K40";
-	my_pdg_to_string[1000190410] = "K41";
-	my_pdg_to_string[1000190420] = "K42";
-	my_pdg_to_string[1000190430] = "K43";
-	my_pdg_to_string[1000190440] = "K44";
-	my_pdg_to_string[1000190450] = "K45";
-	my_pdg_to_string[1000190460] = "K46";
-	my_pdg_to_string[1000190470] = "K47";
-	my_pdg_to_string[1000190480] = "K48";
-	my_pdg_to_string[1000190490] = "K49";
-	my_pdg_to_string[1000190500] = "K50";
-	my_pdg_to_string[1000190510] = "K51";
-	my_pdg_to_string[1000190520] = "K52";
-	my_pdg_to_string[1000190530] = "K53";
-	my_pdg_to_string[1000190540] = "K54";
-	my_pdg_to_string[1000190550] = "K55";
-	my_pdg_to_string[1000190560] = "K56";
-	my_pdg_to_string[1000200350] = "Ca35";
-	my_pdg_to_string[1000200360] = "Ca36";
-	my_pdg_to_string[1000200370] = "Ca37";
-	my_pdg_to_string[1000200380] = "Ca38";
-	my_pdg_to_string[1000200390] = "Ca39";
-	my_pdg_to_string[1000200400] = "Ca40";
-	my_pdg_to_string[1000200410] = "Ca41";
-	my_pdg_to_string[1000200420] = "Ca42";
-	my_pdg_to_string[1000200430] = "Ca43";
-	my_pdg_to_string[1000200440] = "Ca44";
-	my_pdg_to_string[1000200450] = "Ca45";
-	my_pdg_to_string[1000200460] = "Ca46";
-	my_pdg_to_string[1000200470] = "Ca47";
-	my_pdg_to_string[1000200480] = "Ca48";
-	my_pdg_to_string[1000200490] = "Ca49";
-	my_pdg_to_string[1000200500] = "Ca50";
-	my_pdg_to_string[1000200510] = "Ca51";
-	my_pdg_to_string[1000200520] = "Ca52";
-	my_pdg_to_string[1000200530] = "Ca53";
-	my_pdg_to_string[1000200540] = "Ca54";
-	my_pdg_to_string[1000200550] = "Ca55";
-	my_pdg_to_string[1000200560] = "Ca56";
-	my_pdg_to_string[1000200570] = "Ca57";
-	my_pdg_to_string[1000200580] = "Ca58";
-	my_pdg_to_string[1000210390] = "Sc39";
-	my_pdg_to_string[1000210400] = "Sc40";
-	my_pdg_to_string[1000210410] = "Sc41";
-	my_pdg_to_string[1000210420] = "Sc42";
-	my_pdg_to_string[1000210421] = "Sc42[616.280]";
-	my_pdg_to_string[1000210430] = "Sc43";
-	my_pdg_to_string[1000210431] = "Sc43[151.400]";
-	my_pdg_to_string[1000210440] = "Sc44";
-	my_pdg_to_string[1000210441] = "Sc44[146.191]";
-	my_pdg_to_string[1000210442] = "Sc44[271.240]";
-	my_pdg_to_string[1000210450] = "Sc45";
-	my_pdg_to_string[1000210451] = "Sc45[12.400]";
-	my_pdg_to_string[1000210460] = "Sc46";
-	my_pdg_to_string[1000210461] = "Sc46[52.011]";
-	my_pdg_to_string[1000210462] = "Sc46[142.528]";
-	my_pdg_to_string[1000210470] = "Sc47";
-	my_pdg_to_string[1000210480] = "Sc48";
-	my_pdg_to_string[1000210490] = "Sc49";
-	my_pdg_to_string[1000210500] = "Sc50";
-	my_pdg_to_string[1000210501] = "Sc50[256.895]";
-	my_pdg_to_string[1000210510] = "Sc51";
-	my_pdg_to_string[1000210520] = "Sc52";
-	my_pdg_to_string[1000210530] = "Sc53";
-	my_pdg_to_string[1000210540] = "Sc54";
-	my_pdg_to_string[1000210541] = "Sc54[110.000]";
-	my_pdg_to_string[1000210550] = "Sc55";
-	my_pdg_to_string[1000210560] = "Sc56";
-	my_pdg_to_string[1000210570] = "Sc57";
-	my_pdg_to_string[1000210580] = "Sc58";
-	my_pdg_to_string[1000210590] = "Sc59";
-	my_pdg_to_string[1000210610] = "Sc61";
-	my_pdg_to_string[1000220390] = "Ti39";
-	my_pdg_to_string[1000220400] = "Ti40";
-	my_pdg_to_string[1000220410] = "Ti41";
-	my_pdg_to_string[1000220420] = "Ti42";
-	my_pdg_to_string[1000220430] = "Ti43";
-	my_pdg_to_string[1000220431] = "Ti43[313.000]";
-	my_pdg_to_string[1000220440] = "Ti44";
-	my_pdg_to_string[1000220450] = "Ti45";
-	my_pdg_to_string[1000220451] = "Ti45[36.530]";
-	my_pdg_to_string[1000220460] = "Ti46";
-	my_pdg_to_string[1000220470] = "Ti47";
-	my_pdg_to_string[1000220480] = "Ti48";
-	my_pdg_to_string[1000220490] = "Ti49";
-	my_pdg_to_string[1000220500] = "Ti50";
-	my_pdg_to_string[1000220510] = "Ti51";
-	my_pdg_to_string[1000220520] = "Ti52";
-	my_pdg_to_string[1000220530] = "Ti53";
-	my_pdg_to_string[1000220540] = "Ti54";
-	my_pdg_to_string[1000220550] = "Ti55";
-	my_pdg_to_string[1000220560] = "Ti56";
-	my_pdg_to_string[1000220570] = "Ti57";
-	my_pdg_to_string[1000220580] = "Ti58";
-	my_pdg_to_string[1000220590] = "Ti59";
-	my_pdg_to_string[1000220600] = "Ti60";
-	my_pdg_to_string[1000220610] = "Ti61";
-	my_pdg_to_string[1000220620] = "Ti62";
-	my_pdg_to_string[1000220630] = "Ti63";
-	my_pdg_to_string[1000230420] = "V42";
-	my_pdg_to_string[1000230430] = "V43";
-	my_pdg_to_string[1000230440] = "V44";
-	my_pdg_to_string[1000230450] = "V45";
-	my_pdg_to_string[1000230460] = "V46";
-	my_pdg_to_string[1000230461] = "V46[801.460]";
-	my_pdg_to_string[1000230470] = "V47";
-	my_pdg_to_string[1000230480] = "V48";
-	my_pdg_to_string[1000230490] = "V49";
-	my_pdg_to_string[1000230500] = "V50";
-	my_pdg_to_string[1000230510] = "V51";
-	my_pdg_to_string[1000230520] = "V52";
-	my_pdg_to_string[1000230530] = "V53";
-	my_pdg_to_string[1000230540] = "V54";
-	my_pdg_to_string[1000230550] = "V55";
-	my_pdg_to_string[1000230560] = "V56";
-	my_pdg_to_string[1000230570] = "V57";
-	my_pdg_to_string[1000230580] = "V58";
-	my_pdg_to_string[1000230590] = "V59";
-	my_pdg_to_string[1000230601] = "V60[0.000]";
-	my_pdg_to_string[1000230610] = "V61";
-	my_pdg_to_string[1000230620] = "V62";
-	my_pdg_to_string[1000230630] = "V63";
-	my_pdg_to_string[1000230640] = "V64";
-	my_pdg_to_string[1000230650] = "V65";
-	my_pdg_to_string[1000230660] = "V66";
-	my_pdg_to_string[1000240420] = "Cr42";
-	my_pdg_to_string[1000240430] = "Cr43";
-	my_pdg_to_string[1000240440] = "Cr44";
-	my_pdg_to_string[1000240450] = "Cr45";
-	my_pdg_to_string[1000240460] = "Cr46";
-	my_pdg_to_string[1000240470] = "Cr47";
-	my_pdg_to_string[1000240480] = "Cr48";
-	my_pdg_to_string[1000240490] = "Cr49";
-	my_pdg_to_string[1000240500] = "Cr50";
-	my_pdg_to_string[1000240510] = "Cr51";
-	my_pdg_to_string[1000240520] = "Cr52";
-	my_pdg_to_string[1000240530] = "Cr53";
-	my_pdg_to_string[1000240540] = "Cr54";
-	my_pdg_to_string[1000240550] = "Cr55";
-	my_pdg_to_string[1000240560] = "Cr56";
-	my_pdg_to_string[1000240570] = "Cr57";
-	my_pdg_to_string[1000240580] = "Cr58";
-	my_pdg_to_string[1000240590] = "Cr59";
-	my_pdg_to_string[1000240591] = "Cr59[503.000]";
-	my_pdg_to_string[1000240600] = "Cr60";
-	my_pdg_to_string[1000240610] = "Cr61";
-	my_pdg_to_string[1000240620] = "Cr62";
-	my_pdg_to_string[1000240630] = "Cr63";
-	my_pdg_to_string[1000240640] = "Cr64";
-	my_pdg_to_string[1000240650] = "Cr65";
-	my_pdg_to_string[1000240660] = "Cr66";
-	my_pdg_to_string[1000240680] = "Cr68";
-	my_pdg_to_string[1000250440] = "Mn44";
-	my_pdg_to_string[1000250460] = "Mn46";
-	my_pdg_to_string[1000250470] = "Mn47";
-	my_pdg_to_string[1000250480] = "Mn48";
-	my_pdg_to_string[1000250490] = "Mn49";
-	my_pdg_to_string[1000250500] = "Mn50";
-	my_pdg_to_string[1000250501] = "Mn50[225.280]";
-	my_pdg_to_string[1000250510] = "Mn51";
-	my_pdg_to_string[1000250520] = "Mn52";
-	my_pdg_to_string[1000250521] = "Mn52[377.749]";
-	my_pdg_to_string[1000250530] = "Mn53";
-	my_pdg_to_string[1000250540] = "Mn54";
-	my_pdg_to_string[1000250550] = "Mn55";
-	my_pdg_to_string[1000250560] = "Mn56";
-	my_pdg_to_string[1000250570] = "Mn57";
-	my_pdg_to_string[1000250580] = "Mn58";
-	my_pdg_to_string[1000250581] = "Mn58[71.770]";
-	my_pdg_to_string[1000250590] = "Mn59";
-	my_pdg_to_string[1000250600] = "Mn60";
-	my_pdg_to_string[1000250601] = "Mn60[271.800]";
-	my_pdg_to_string[1000250610] = "Mn61";
-	my_pdg_to_string[1000250621] = "Mn62[0.000]";
-	my_pdg_to_string[1000250630] = "Mn63";
-	my_pdg_to_string[1000250640] = "Mn64";
-	my_pdg_to_string[1000250641] = "Mn64[175.000]";
-	my_pdg_to_string[1000250650] = "Mn65";
-	my_pdg_to_string[1000250660] = "Mn66";
-	my_pdg_to_string[1000250670] = "Mn67";
-	my_pdg_to_string[1000250680] = "Mn68";
-	my_pdg_to_string[1000250690] = "Mn69";
-	my_pdg_to_string[1000250700] = "Mn70";
-	my_pdg_to_string[1000250710] = "Mn71";
-	my_pdg_to_string[1000260450] = "Fe45";
-	my_pdg_to_string[1000260460] = "Fe46";
-	my_pdg_to_string[1000260470] = "Fe47";
-	my_pdg_to_string[1000260480] = "Fe48";
-	my_pdg_to_string[1000260490] = "Fe49";
-	my_pdg_to_string[1000260500] = "Fe50";
-	my_pdg_to_string[1000260510] = "Fe51";
-	my_pdg_to_string[1000260520] = "Fe52";
-	my_pdg_to_string[1000260521] = "Fe52[6958.000]";
-	my_pdg_to_string[1000260530] = "Fe53";
-	my_pdg_to_string[1000260531] = "Fe53[3040.400]";
-	my_pdg_to_string[1000260540] = "Fe54";
-	my_pdg_to_string[1000260550] = "Fe55";
-	my_pdg_to_string[1000260560] = "Fe56";
-	my_pdg_to_string[1000260570] = "Fe57";
-	my_pdg_to_string[1000260580] = "Fe58";
-	my_pdg_to_string[1000260590] = "Fe59";
-	my_pdg_to_string[1000260600] = "Fe60";
-	my_pdg_to_string[1000260610] = "Fe61";
-	my_pdg_to_string[1000260620] = "Fe62";
-	my_pdg_to_string[1000260630] = "Fe63";
-	my_pdg_to_string[1000260640] = "Fe64";
-	my_pdg_to_string[1000260650] = "Fe65";
-	my_pdg_to_string[1000260651] = "Fe65[402.000]";
-	my_pdg_to_string[1000260660] = "Fe66";
-	my_pdg_to_string[1000260670] = "Fe67";
-	my_pdg_to_string[1000260671] = "Fe67[387.000]";
-	my_pdg_to_string[1000260680] = "Fe68";
-	my_pdg_to_string[1000260690] = "Fe69";
-	my_pdg_to_string[1000260700] = "Fe70";
-	my_pdg_to_string[1000260710] = "Fe71";
-	my_pdg_to_string[1000260720] = "Fe72";
-	my_pdg_to_string[1000260730] = "Fe73";
-	my_pdg_to_string[1000260740] = "Fe74";
-	my_pdg_to_string[1000270500] = "Co50";
-	my_pdg_to_string[1000270510] = "Co51";
-	my_pdg_to_string[1000270520] = "Co52";
-	my_pdg_to_string[1000270530] = "Co53";
-	my_pdg_to_string[1000270531] = "Co53[3197.000]";
-	my_pdg_to_string[1000270540] = "Co54";
-	my_pdg_to_string[1000270541] = "Co54[197.100]";
-	my_pdg_to_string[1000270550] = "Co55";
-	my_pdg_to_string[1000270560] = "Co56";
-	my_pdg_to_string[1000270570] = "Co57";
-	my_pdg_to_string[1000270580] = "Co58";
-	my_pdg_to_string[1000270581] = "Co58[24.950]";
-	my_pdg_to_string[1000270582] = "Co58[53.150]";
-	my_pdg_to_string[1000270590] = "Co59";
-	my_pdg_to_string[1000270600] = "Co60";
-	my_pdg_to_string[1000270601] = "Co60[58.590]";
-	my_pdg_to_string[1000270610] = "Co61";
-	my_pdg_to_string[1000270620] = "Co62";
-	my_pdg_to_string[1000270621] = "Co62[22.000]";
-	my_pdg_to_string[1000270630] = "Co63";
-	my_pdg_to_string[1000270640] = "Co64";
-	my_pdg_to_string[1000270650] = "Co65";
-	my_pdg_to_string[1000270660] = "Co66";
-	my_pdg_to_string[1000270661] = "Co66[175.000]";
-	my_pdg_to_string[1000270670] = "Co67";
-	my_pdg_to_string[1000270680] = "Co68";
-	my_pdg_to_string[1000270690] = "Co69";
-	my_pdg_to_string[1000270700] = "Co70";
-	my_pdg_to_string[1000270710] = "Co71";
-	my_pdg_to_string[1000270720] = "Co72";
-	my_pdg_to_string[1000270730] = "Co73";
-	my_pdg_to_string[1000270740] = "Co74";
-	my_pdg_to_string[1000270750] = "Co75";
-	my_pdg_to_string[1000270760] = "Co76";
-	my_pdg_to_string[1000280480] = "Ni48";
-	my_pdg_to_string[1000280490] = "Ni49";
-	my_pdg_to_string[1000280500] = "Ni50";
-	my_pdg_to_string[1000280510] = "Ni51";
-	my_pdg_to_string[1000280520] = "Ni52";
-	my_pdg_to_string[1000280530] = "Ni53";
-	my_pdg_to_string[1000280540] = "Ni54";
-	my_pdg_to_string[1000280550] = "Ni55";
-	my_pdg_to_string[1000280560] = "Ni56";
-	my_pdg_to_string[1000280570] = "Ni57";
-	my_pdg_to_string[1000280580] = "Ni58";
-	my_pdg_to_string[1000280590] = "Ni59";
-	my_pdg_to_string[1000280600] = "Ni60";
-	my_pdg_to_string[1000280610] = "Ni61";
-	my_pdg_to_string[1000280620] = "Ni62";
-	my_pdg_to_string[1000280630] = "Ni63";
-	my_pdg_to_string[1000280631] = "Ni63[87.150]";
-	my_pdg_to_string[1000280640] = "Ni64";
-	my_pdg_to_string[1000280650] = "Ni65";
-	my_pdg_to_string[1000280651] = "Ni65[63.370]";
-	my_pdg_to_string[1000280660] = "Ni66";
-	my_pdg_to_string[1000280670] = "Ni67";
-	my_pdg_to_string[1000280671] = "Ni67[1007.200]";
-	my_pdg_to_string[1000280680] = "Ni68";
-	my_pdg_to_string[1000280681] = "Ni68[2849.100]";
-	my_pdg_to_string[1000280690] = "Ni69";
-	my_pdg_to_string[1000280691] = "Ni69[321.000]";
-	my_pdg_to_string[1000280700] = "Ni70";
-	my_pdg_to_string[1000280710] = "Ni71";
-	my_pdg_to_string[1000280711] = "Ni71[499.000]";
-	my_pdg_to_string[1000280720] = "Ni72";
-	my_pdg_to_string[1000280730] = "Ni73";
-	my_pdg_to_string[1000280740] = "Ni74";
-	my_pdg_to_string[1000280750] = "Ni75";
-	my_pdg_to_string[1000280760] = "Ni76";
-	my_pdg_to_string[1000280770] = "Ni77";
-	my_pdg_to_string[1000280780] = "Ni78";
-	my_pdg_to_string[1000280790] = "Ni79";
-	my_pdg_to_string[1000290530] = "Cu53";
-	my_pdg_to_string[1000290540] = "Cu54";
-	my_pdg_to_string[1000290550] = "Cu55";
-	my_pdg_to_string[1000290560] = "Cu56";
-	my_pdg_to_string[1000290570] = "Cu57";
-	my_pdg_to_string[1000290580] = "Cu58";
-	my_pdg_to_string[1000290590] = "Cu59";
-	my_pdg_to_string[1000290600] = "Cu60";
-	my_pdg_to_string[1000290610] = "Cu61";
-	my_pdg_to_string[1000290620] = "Cu62";
-	my_pdg_to_string[1000290630] = "Cu63";
-	my_pdg_to_string[1000290640] = "Cu64";
-	my_pdg_to_string[1000290650] = "Cu65";
-	my_pdg_to_string[1000290660] = "Cu66";
-	my_pdg_to_string[1000290670] = "Cu67";
-	my_pdg_to_string[1000290680] = "Cu68";
-	my_pdg_to_string[1000290681] = "Cu68[721.260]";
-	my_pdg_to_string[1000290690] = "Cu69";
-	my_pdg_to_string[1000290700] = "Cu70";
-	my_pdg_to_string[1000290701] = "Cu70[101.100]";
-	my_pdg_to_string[1000290702] = "Cu70[242.600]";
-	my_pdg_to_string[1000290710] = "Cu71";
-	my_pdg_to_string[1000290720] = "Cu72";
-	my_pdg_to_string[1000290721] = "Cu72[270.300]";
-	my_pdg_to_string[1000290730] = "Cu73";
-	my_pdg_to_string[1000290740] = "Cu74";
-	my_pdg_to_string[1000290750] = "Cu75";
-	my_pdg_to_string[1000290761] = "Cu76[0.000]";
-	my_pdg_to_string[1000290770] = "Cu77";
-	my_pdg_to_string[1000290780] = "Cu78";
-	my_pdg_to_string[1000290790] = "Cu79";
-	my_pdg_to_string[1000290800] = "Cu80";
-	my_pdg_to_string[1000290810] = "Cu81";
-	my_pdg_to_string[1000290820] = "Cu82";
-	my_pdg_to_string[1000300540] = "Zn54";
-	my_pdg_to_string[1000300550] = "Zn55";
-	my_pdg_to_string[1000300560] = "Zn56";
-	my_pdg_to_string[1000300570] = "Zn57";
-	my_pdg_to_string[1000300580] = "Zn58";
-	my_pdg_to_string[1000300590] = "Zn59";
-	my_pdg_to_string[1000300600] = "Zn60";
-	my_pdg_to_string[1000300610] = "Zn61";
-	my_pdg_to_string[1000300611] = "Zn61[88.400]";
-	my_pdg_to_string[1000300612] = "Zn61[418.100]";
-	my_pdg_to_string[1000300613] = "Zn61[756.020]";
-	my_pdg_to_string[1000300620] = "Zn62";
-	my_pdg_to_string[1000300630] = "Zn63";
-	my_pdg_to_string[1000300640] = "Zn64";
-	my_pdg_to_string[1000300650] = "Zn65";
-	my_pdg_to_string[1000300651] = "Zn65[53.928]";
-	my_pdg_to_string[1000300660] = "Zn66";
-	my_pdg_to_string[1000300670] = "Zn67";
-	my_pdg_to_string[1000300671] = "Zn67[93.312]";
-	my_pdg_to_string[1000300680] = "Zn68";
-	my_pdg_to_string[1000300690] = "Zn69";
-	my_pdg_to_string[1000300691] = "Zn69[438.636]";
-	my_pdg_to_string[1000300700] = "Zn70";
-	my_pdg_to_string[1000300710] = "Zn71";
-	my_pdg_to_string[1000300711] = "Zn71[157.700]";
-	my_pdg_to_string[1000300720] = "Zn72";
-	my_pdg_to_string[1000300730] = "Zn73";
-	my_pdg_to_string[1000300732] = "Zn73[195.500]";
-	my_pdg_to_string[1000300740] = "Zn74";
-	my_pdg_to_string[1000300750] = "Zn75";
-	my_pdg_to_string[1000300760] = "Zn76";
-	my_pdg_to_string[1000300770] = "Zn77";
-	my_pdg_to_string[1000300771] = "Zn77[772.440]";
-	my_pdg_to_string[1000300780] = "Zn78";
-	my_pdg_to_string[1000300790] = "Zn79";
-	my_pdg_to_string[1000300800] = "Zn80";
-	my_pdg_to_string[1000300810] = "Zn81";
-	my_pdg_to_string[1000300820] = "Zn82";
-	my_pdg_to_string[1000300830] = "Zn83";
-	my_pdg_to_string[1000300840] = "Zn84";
-	my_pdg_to_string[1000300850] = "Zn85";
-	my_pdg_to_string[1000310600] = "Ga60";
-	my_pdg_to_string[1000310610] = "Ga61";
-	my_pdg_to_string[1000310620] = "Ga62";
-	my_pdg_to_string[1000310630] = "Ga63";
-	my_pdg_to_string[1000310640] = "Ga64";
-	my_pdg_to_string[1000310641] = "Ga64[42.850]";
-	my_pdg_to_string[1000310650] = "Ga65";
-	my_pdg_to_string[1000310660] = "Ga66";
-	my_pdg_to_string[1000310670] = "Ga67";
-	my_pdg_to_string[1000310680] = "Ga68";
-	my_pdg_to_string[1000310690] = "Ga69";
-	my_pdg_to_string[1000310700] = "Ga70";
-	my_pdg_to_string[1000310710] = "Ga71";
-	my_pdg_to_string[1000310720] = "Ga72";
-	my_pdg_to_string[1000310721] = "Ga72[119.660]";
-	my_pdg_to_string[1000310730] = "Ga73";
-	my_pdg_to_string[1000310740] = "Ga74";
-	my_pdg_to_string[1000310741] = "Ga74[59.571]";
-	my_pdg_to_string[1000310750] = "Ga75";
-	my_pdg_to_string[1000310760] = "Ga76";
-	my_pdg_to_string[1000310770] = "Ga77";
-	my_pdg_to_string[1000310780] = "Ga78";
-	my_pdg_to_string[1000310790] = "Ga79";
-	my_pdg_to_string[1000310800] = "Ga80";
-	my_pdg_to_string[1000310801] = "Ga80[22.400]";
-	my_pdg_to_string[1000310810] = "Ga81";
-	my_pdg_to_string[1000310820] = "Ga82";
-	my_pdg_to_string[1000310830] = "Ga83";
-	my_pdg_to_string[1000310840] = "Ga84";
-	my_pdg_to_string[1000310850] = "Ga85";
-	my_pdg_to_string[1000310860] = "Ga86";
-	my_pdg_to_string[1000310870] = "Ga87";
-	my_pdg_to_string[1000320600] = "Ge60";
-	my_pdg_to_string[1000320610] = "Ge61";
-	my_pdg_to_string[1000320620] = "Ge62";
-	my_pdg_to_string[1000320630] = "Ge63";
-	my_pdg_to_string[1000320640] = "Ge64";
-	my_pdg_to_string[1000320650] = "Ge65";
-	my_pdg_to_string[1000320660] = "Ge66";
-	my_pdg_to_string[1000320670] = "Ge67";
-	my_pdg_to_string[1000320671] = "Ge67[18.200]";
-	my_pdg_to_string[1000320680] = "Ge68";
-	my_pdg_to_string[1000320690] = "Ge69";
-	my_pdg_to_string[1000320691] = "Ge69[86.760]";
-	my_pdg_to_string[1000320692] = "Ge69[397.940]";
-	my_pdg_to_string[1000320700] = "Ge70";
-	my_pdg_to_string[1000320710] = "Ge71";
-	my_pdg_to_string[1000320711] = "Ge71[198.354]";
-	my_pdg_to_string[1000320720] = "Ge72";
-	my_pdg_to_string[1000320730] = "Ge73";
-	my_pdg_to_string[1000320731] = "Ge73[13.285]";
-	my_pdg_to_string[1000320732] = "Ge73[66.726]";
-	my_pdg_to_string[1000320740] = "Ge74";
-	my_pdg_to_string[1000320750] = "Ge75";
-	my_pdg_to_string[1000320751] = "Ge75[139.690]";
-	my_pdg_to_string[1000320760] = "Ge76";
-	my_pdg_to_string[1000320770] = "Ge77";
-	my_pdg_to_string[1000320771] = "Ge77[159.710]";
-	my_pdg_to_string[1000320780] = "Ge78";
-	my_pdg_to_string[1000320790] = "Ge79";
-	my_pdg_to_string[1000320791] = "Ge79[185.950]";
-	my_pdg_to_string[1000320800] = "Ge80";
-	my_pdg_to_string[1000320810] = "Ge81";
-	my_pdg_to_string[1000320811] = "Ge81[679.140]";
-	my_pdg_to_string[1000320820] = "Ge82";
-	my_pdg_to_string[1000320830] = "Ge83";
-	my_pdg_to_string[1000320840] = "Ge84";
-	my_pdg_to_string[1000320850] = "Ge85";
-	my_pdg_to_string[1000320860] = "Ge86";
-	my_pdg_to_string[1000320870] = "Ge87";
-	my_pdg_to_string[1000320880] = "Ge88";
-	my_pdg_to_string[1000320890] = "Ge89";
-	my_pdg_to_string[1000320900] = "Ge90";
-	my_pdg_to_string[1000330630] = "As63";
-	my_pdg_to_string[1000330640] = "As64";
-	my_pdg_to_string[1000330650] = "As65";
-	my_pdg_to_string[1000330660] = "As66";
-	my_pdg_to_string[1000330661] = "As66[1356.630]";
-	my_pdg_to_string[1000330662] = "As66[3023.800]";
-	my_pdg_to_string[1000330670] = "As67";
-	my_pdg_to_string[1000330680] = "As68";
-	my_pdg_to_string[1000330690] = "As69";
-	my_pdg_to_string[1000330700] = "As70";
-	my_pdg_to_string[1000330701] = "As70[32.008]";
-	my_pdg_to_string[1000330710] = "As71";
-	my_pdg_to_string[1000330720] = "As72";
-	my_pdg_to_string[1000330730] = "As73";
-	my_pdg_to_string[1000330731] = "As73[427.906]";
-	my_pdg_to_string[1000330740] = "As74";
-	my_pdg_to_string[1000330750] = "As75";
-	my_pdg_to_string[1000330751] = "As75[303.924]";
-	my_pdg_to_string[1000330760] = "As76";
-	my_pdg_to_string[1000330761] = "As76[44.425]";
-	my_pdg_to_string[1000330770] = "As77";
-	my_pdg_to_string[1000330771] = "As77[475.480]";
-	my_pdg_to_string[1000330780] = "As78";
-	my_pdg_to_string[1000330790] = "As79";
-	my_pdg_to_string[1000330800] = "As80";
-	my_pdg_to_string[1000330810] = "As81";
-	my_pdg_to_string[1000330820] = "As82";
-	my_pdg_to_string[1000330830] = "As83";
-	my_pdg_to_string[1000330840] = "As84";
-	my_pdg_to_string[1000330850] = "As85";
-	my_pdg_to_string[1000330860] = "As86";
-	my_pdg_to_string[1000330870] = "As87";
-	my_pdg_to_string[1000330880] = "As88";
-	my_pdg_to_string[1000330890] = "As89";
-	my_pdg_to_string[1000330900] = "As90";
-	my_pdg_to_string[1000340640] = "Se64";
-	my_pdg_to_string[1000340650] = "Se65";
-	my_pdg_to_string[1000340660] = "Se66";
-	my_pdg_to_string[1000340670] = "Se67";
-	my_pdg_to_string[1000340680] = "Se68";
-	my_pdg_to_string[1000340690] = "Se69";
-	my_pdg_to_string[1000340691] = "Se69[38.850]";
-	my_pdg_to_string[1000340700] = "Se70";
-	my_pdg_to_string[1000340710] = "Se71";
-	my_pdg_to_string[1000340711] = "Se71[48.790]";
-	my_pdg_to_string[1000340712] = "Se71[260.480]";
-	my_pdg_to_string[1000340720] = "Se72";
-	my_pdg_to_string[1000340730] = "Se73";
-	my_pdg_to_string[1000340731] = "Se73[25.710]";
-	my_pdg_to_string[1000340740] = "Se74";
-	my_pdg_to_string[1000340750] = "Se75";
-	my_pdg_to_string[1000340760] = "Se76";
-	my_pdg_to_string[1000340770] = "Se77";
-	my_pdg_to_string[1000340771] = "Se77[161.922]";
-	my_pdg_to_string[1000340780] = "Se78";
-	my_pdg_to_string[1000340790] = "Se79";
-	my_pdg_to_string[1000340791] = "Se79[95.770]";
-	my_pdg_to_string[1000340800] = "Se80";
-	my_pdg_to_string[1000340810] = "Se81";
-	my_pdg_to_string[1000340811] = "Se81[103.000]";
-	my_pdg_to_string[1000340820] = "Se82";
-	my_pdg_to_string[1000340830] = "Se83";
-	my_pdg_to_string[1000340831] = "Se83[228.500]";
-	my_pdg_to_string[1000340840] = "Se84";
-	my_pdg_to_string[1000340850] = "Se85";
-	my_pdg_to_string[1000340860] = "Se86";
-	my_pdg_to_string[1000340870] = "Se87";
-	my_pdg_to_string[1000340880] = "Se88";
-	my_pdg_to_string[1000340890] = "Se89";
-	my_pdg_to_string[1000340900] = "Se90";
-	my_pdg_to_string[1000340910] = "Se91";
-	my_pdg_to_string[1000340940] = "Se94";
-	my_pdg_to_string[1000340950] = "Se95";
-	my_pdg_to_string[1000350700] = "Br70";
-	my_pdg_to_string[1000350701] = "Br70[2292.300]";
-	my_pdg_to_string[1000350710] = "Br71";
-	my_pdg_to_string[1000350720] = "Br72";
-	my_pdg_to_string[1000350721] = "Br72[100.760]";
-	my_pdg_to_string[1000350730] = "Br73";
-	my_pdg_to_string[1000350740] = "Br74";
-	my_pdg_to_string[1000350741] = "Br74[13.580]";
-	my_pdg_to_string[1000350750] = "Br75";
-	my_pdg_to_string[1000350760] = "Br76";
-	my_pdg_to_string[1000350761] = "Br76[102.580]";
-	my_pdg_to_string[1000350770] = "Br77";
-	my_pdg_to_string[1000350771] = "Br77[105.860]";
-	my_pdg_to_string[1000350780] = "Br78";
-	my_pdg_to_string[1000350781] = "Br78[180.890]";
-	my_pdg_to_string[1000350790] = "Br79";
-	my_pdg_to_string[1000350791] = "Br79[207.610]";
-	my_pdg_to_string[1000350800] = "Br80";
-	my_pdg_to_string[1000350801] = "Br80[85.843]";
-	my_pdg_to_string[1000350810] = "Br81";
-	my_pdg_to_string[1000350811] = "Br81[536.200]";
-	my_pdg_to_string[1000350820] = "Br82";
-	my_pdg_to_string[1000350821] = "Br82[45.949]";
-	my_pdg_to_string[1000350830] = "Br83";
-	my_pdg_to_string[1000350840] = "Br84";
-	my_pdg_to_string[1000350841] = "Br84[320.000]";
-	my_pdg_to_string[1000350850] = "Br85";
-	my_pdg_to_string[1000350860] = "Br86";
-	my_pdg_to_string[1000350870] = "Br87";
-	my_pdg_to_string[1000350880] = "Br88";
-	my_pdg_to_string[1000350881] = "Br88[270.100]";
-	my_pdg_to_string[1000350890] = "Br89";
-	my_pdg_to_string[1000350900] = "Br90";
-	my_pdg_to_string[1000350910] = "Br91";
-	my_pdg_to_string[1000350920] = "Br92";
-	my_pdg_to_string[1000350930] = "Br93";
-	my_pdg_to_string[1000350940] = "Br94";
-	my_pdg_to_string[1000350950] = "Br95";
-	my_pdg_to_string[1000350960] = "Br96";
-	my_pdg_to_string[1000350970] = "Br97";
-	my_pdg_to_string[1000350980] = "Br98";
-	my_pdg_to_string[1000360690] = "Kr69";
-	my_pdg_to_string[1000360700] = "Kr70";
-	my_pdg_to_string[1000360710] = "Kr71";
-	my_pdg_to_string[1000360720] = "Kr72";
-	my_pdg_to_string[1000360730] = "Kr73";
-	my_pdg_to_string[1000360740] = "Kr74";
-	my_pdg_to_string[1000360750] = "Kr75";
-	my_pdg_to_string[1000360760] = "Kr76";
-	my_pdg_to_string[1000360770] = "Kr77";
-	my_pdg_to_string[1000360780] = "Kr78";
-	my_pdg_to_string[1000360790] = "Kr79";
-	my_pdg_to_string[1000360791] = "Kr79[129.770]";
-	my_pdg_to_string[1000360800] = "Kr80";
-	my_pdg_to_string[1000360810] = "Kr81";
-	my_pdg_to_string[1000360811] = "Kr81[190.640]";
-	my_pdg_to_string[1000360820] = "Kr82";
-	my_pdg_to_string[1000360830] = "Kr83";
-	my_pdg_to_string[1000360831] = "Kr83[41.557]";
-	my_pdg_to_string[1000360840] = "Kr84";
-	my_pdg_to_string[1000360841] = "Kr84[3236.070]";
-	my_pdg_to_string[1000360850] = "Kr85";
-	my_pdg_to_string[1000360851] = "Kr85[304.871]";
-	my_pdg_to_string[1000360852] = "Kr85[1991.800]";
-	my_pdg_to_string[1000360860] = "Kr86";
-	my_pdg_to_string[1000360870] = "Kr87";
-	my_pdg_to_string[1000360880] = "Kr88";
-	my_pdg_to_string[1000360890] = "Kr89";
-	my_pdg_to_string[1000360900] = "Kr90";
-	my_pdg_to_string[1000360910] = "Kr91";
-	my_pdg_to_string[1000360920] = "Kr92";
-	my_pdg_to_string[1000360930] = "Kr93";
-	my_pdg_to_string[1000360940] = "Kr94";
-	my_pdg_to_string[1000360950] = "Kr95";
-	my_pdg_to_string[1000360951] = "Kr95[195.500]";
-	my_pdg_to_string[1000360960] = "Kr96";
-	my_pdg_to_string[1000360970] = "Kr97";
-	my_pdg_to_string[1000360980] = "Kr98";
-	my_pdg_to_string[1000360990] = "Kr99";
-	my_pdg_to_string[1000361000] = "Kr100";
-	my_pdg_to_string[1000361010] = "Kr101";
-	my_pdg_to_string[1000370730] = "Rb73";
-	my_pdg_to_string[1000370740] = "Rb74";
-	my_pdg_to_string[1000370750] = "Rb75";
-	my_pdg_to_string[1000370760] = "Rb76";
-	my_pdg_to_string[1000370761] = "Rb76[316.930]";
-	my_pdg_to_string[1000370770] = "Rb77";
-	my_pdg_to_string[1000370780] = "Rb78";
-	my_pdg_to_string[1000370781] = "Rb78[111.190]";
-	my_pdg_to_string[1000370790] = "Rb79";
-	my_pdg_to_string[1000370800] = "Rb80";
-	my_pdg_to_string[1000370801] = "Rb80[493.900]";
-	my_pdg_to_string[1000370810] = "Rb81";
-	my_pdg_to_string[1000370811] = "Rb81[86.310]";
-	my_pdg_to_string[1000370820] = "Rb82";
-	my_pdg_to_string[1000370821] = "Rb82[69.000]";
-	my_pdg_to_string[1000370830] = "Rb83";
-	my_pdg_to_string[1000370831] = "Rb83[42.110]";
-	my_pdg_to_string[1000370840] = "Rb84";
-	my_pdg_to_string[1000370841] = "Rb84[463.590]";
-	my_pdg_to_string[1000370850] = "Rb85";
-	my_pdg_to_string[1000370851] = "Rb85[514.006]";
-	my_pdg_to_string[1000370860] = "Rb86";
-	my_pdg_to_string[1000370861] = "Rb86[556.050]";
-	my_pdg_to_string[1000370870] = "Rb87";
-	my_pdg_to_string[1000370880] = "Rb88";
-	my_pdg_to_string[1000370890] = "Rb89";
-	my_pdg_to_string[1000370900] = "Rb90";
-	my_pdg_to_string[1000370901] = "Rb90[106.900]";
-	my_pdg_to_string[1000370910] = "Rb91";
-	my_pdg_to_string[1000370920] = "Rb92";
-	my_pdg_to_string[1000370930] = "Rb93";
-	my_pdg_to_string[1000370940] = "Rb94";
-	my_pdg_to_string[1000370950] = "Rb95";
-	my_pdg_to_string[1000370960] = "Rb96";
-	my_pdg_to_string[1000370961] = "Rb96[1134.600]";
-	my_pdg_to_string[1000370970] = "Rb97";
-	my_pdg_to_string[1000370980] = "Rb98";
-	my_pdg_to_string[1000370981] = "Rb98[270.000]";
-	my_pdg_to_string[1000370990] = "Rb99";
-	my_pdg_to_string[1000371000] = "Rb100";
-	my_pdg_to_string[1000371010] = "Rb101";
-	my_pdg_to_string[1000371020] = "Rb102";
-	my_pdg_to_string[1000371030] = "Rb103";
-	my_pdg_to_string[1000380730] = "Sr73";
-	my_pdg_to_string[1000380740] = "Sr74";
-	my_pdg_to_string[1000380750] = "Sr75";
-	my_pdg_to_string[1000380760] = "Sr76";
-	my_pdg_to_string[1000380770] = "Sr77";
-	my_pdg_to_string[1000380780] = "Sr78";
-	my_pdg_to_string[1000380790] = "Sr79";
-	my_pdg_to_string[1000380800] = "Sr80";
-	my_pdg_to_string[1000380810] = "Sr81";
-	my_pdg_to_string[1000380811] = "Sr81[89.050]";
-	my_pdg_to_string[1000380820] = "Sr82";
-	my_pdg_to_string[1000380830] = "Sr83";
-	my_pdg_to_string[1000380831] = "Sr83[259.150]";
-	my_pdg_to_string[1000380840] = "Sr84";
-	my_pdg_to_string[1000380850] = "Sr85";
-	my_pdg_to_string[1000380851] = "Sr85[238.790]";
-	my_pdg_to_string[1000380860] = "Sr86";
-	my_pdg_to_string[1000380870] = "Sr87";
-	my_pdg_to_string[1000380871] = "Sr87[388.533]";
-	my_pdg_to_string[1000380880] = "Sr88";
-	my_pdg_to_string[1000380890] = "Sr89";
-	my_pdg_to_string[1000380900] = "Sr90";
-	my_pdg_to_string[1000380910] = "Sr91";
-	my_pdg_to_string[1000380920] = "Sr92";
-	my_pdg_to_string[1000380930] = "Sr93";
-	my_pdg_to_string[1000380940] = "Sr94";
-	my_pdg_to_string[1000380950] = "Sr95";
-	my_pdg_to_string[1000380960] = "Sr96";
-	my_pdg_to_string[1000380970] = "Sr97";
-	my_pdg_to_string[1000380980] = "Sr98";
-	my_pdg_to_string[1000380990] = "Sr99";
-	my_pdg_to_string[1000381000] = "Sr100";
-	my_pdg_to_string[1000381010] = "Sr101";
-	my_pdg_to_string[1000381020] = "Sr102";
-	my_pdg_to_string[1000381030] = "Sr103";
-	my_pdg_to_string[1000381060] = "Sr106";
-	my_pdg_to_string[1000381070] = "Sr107";
-	my_pdg_to_string[1000390760] = "Y76";
-	my_pdg_to_string[1000390770] = "Y77";
-	my_pdg_to_string[1000390780] = "Y78";
-	my_pdg_to_string[1000390790] = "Y79";
-	my_pdg_to_string[1000390800] = "Y80";
-	my_pdg_to_string[1000390801] = "Y80[228.500]";
-	my_pdg_to_string[1000390802] = "Y80[312.600]";
-	my_pdg_to_string[1000390810] = "Y81";
-	my_pdg_to_string[1000390820] = "Y82";
-	my_pdg_to_string[1000390830] = "Y83";
-	my_pdg_to_string[1000390831] = "Y83[61.980]";
-	my_pdg_to_string[1000390840] = "Y84";
-	my_pdg_to_string[1000390841] = "Y84[67.000]";
-	my_pdg_to_string[1000390850] = "Y85";
-	my_pdg_to_string[1000390851] = "Y85[19.680]";
-	my_pdg_to_string[1000390860] = "Y86";
-	my_pdg_to_string[1000390861] = "Y86[218.210]";
-	my_pdg_to_string[1000390870] = "Y87";
-	my_pdg_to_string[1000390871] = "Y87[380.820]";
-	my_pdg_to_string[1000390880] = "Y88";
-	my_pdg_to_string[1000390881] = "Y88[392.860]";
-	my_pdg_to_string[1000390882] = "Y88[674.550]";
-	my_pdg_to_string[1000390890] = "Y89";
-	my_pdg_to_string[1000390891] = "Y89[908.970]";
-	my_pdg_to_string[1000390900] = "Y90";
-	my_pdg_to_string[1000390901] = "Y90[681.670]";
-	my_pdg_to_string[1000390910] = "Y91";
-	my_pdg_to_string[1000390911] = "Y91[555.580]";
-	my_pdg_to_string[1000390920] = "Y92";
-	my_pdg_to_string[1000390930] = "Y93";
-	my_pdg_to_string[1000390931] = "Y93[758.719]";
-	my_pdg_to_string[1000390940] = "Y94";
-	my_pdg_to_string[1000390941] = "Y94[1202.300]";
-	my_pdg_to_string[1000390950] = "Y95";
-	my_pdg_to_string[1000390951] = "Y95[1087.600]";
-	my_pdg_to_string[1000390960] = "Y96";
-	my_pdg_to_string[1000390961] = "Y96[1140.000]";
-	my_pdg_to_string[1000390970] = "Y97";
-	my_pdg_to_string[1000390971] = "Y97[667.520]";
-	my_pdg_to_string[1000390972] = "Y97[3522.600]";
-	my_pdg_to_string[1000390980] = "Y98";
-	my_pdg_to_string[1000390981] = "Y98[410.000]";
-	my_pdg_to_string[1000390982] = "Y98[496.190]";
-	my_pdg_to_string[1000390990] = "Y99";
-	my_pdg_to_string[1000390991] = "Y99[2141.650]";
-	my_pdg_to_string[1000391000] = "Y100";
-	my_pdg_to_string[1000391001] = "Y100[145.000]";
-	my_pdg_to_string[1000391010] = "Y101";
-	my_pdg_to_string[1000391021] = "Y102[0.000]";
-	my_pdg_to_string[1000391030] = "Y103";
-	my_pdg_to_string[1000391040] = "Y104";
-	my_pdg_to_string[1000391060] = "Y106";
-	my_pdg_to_string[1000391070] = "Y107";
-	my_pdg_to_string[1000391080] = "Y108";
-	my_pdg_to_string[1000391090] = "Y109";
-	my_pdg_to_string[1000400780] = "Zr78";
-	my_pdg_to_string[1000400790] = "Zr79";
-	my_pdg_to_string[1000400800] = "Zr80";
-	my_pdg_to_string[1000400810] = "Zr81";
-	my_pdg_to_string[1000400820] = "Zr82";
-	my_pdg_to_string[1000400830] = "Zr83";
-	my_pdg_to_string[1000400840] = "Zr84";
-	my_pdg_to_string[1000400850] = "Zr85";
-	my_pdg_to_string[1000400851] = "Zr85[292.200]";
-	my_pdg_to_string[1000400860] = "Zr86";
-	my_pdg_to_string[1000400870] = "Zr87";
-	my_pdg_to_string[1000400871] = "Zr87[335.840]";
-	my_pdg_to_string[1000400880] = "Zr88";
-	my_pdg_to_string[1000400881] = "Zr88[2887.790]";
-	my_pdg_to_string[1000400890] = "Zr89";
-	my_pdg_to_string[1000400891] = "Zr89[587.820]";
-	my_pdg_to_string[1000400900] = "Zr90";
-	my_pdg_to_string[1000400901] = "Zr90[2319.000]";
-	my_pdg_to_string[1000400910] = "Zr91";
-	my_pdg_to_string[1000400911] = "Zr91[3167.300]";
-	my_pdg_to_string[1000400920] = "Zr92";
-	my_pdg_to_string[1000400930] = "Zr93";
-	my_pdg_to_string[1000400940] = "Zr94";
-	my_pdg_to_string[1000400950] = "Zr95";
-	my_pdg_to_string[1000400960] = "Zr96";
-	my_pdg_to_string[1000400970] = "Zr97";
-	my_pdg_to_string[1000400980] = "Zr98";
-	my_pdg_to_string[1000400990] = "Zr99";
-	my_pdg_to_string[1000401000] = "Zr100";
-	my_pdg_to_string[1000401010] = "Zr101";
-	my_pdg_to_string[1000401020] = "Zr102";
-	my_pdg_to_string[1000401030] = "Zr103";
-	my_pdg_to_string[1000401040] = "Zr104";
-	my_pdg_to_string[1000401050] = "Zr105";
-	my_pdg_to_string[1000401060] = "Zr106";
-	my_pdg_to_string[1000401070] = "Zr107";
-	my_pdg_to_string[1000401080] = "Zr108";
-	my_pdg_to_string[1000401100] = "Zr110";
-	my_pdg_to_string[1000401110] = "Zr111";
-	my_pdg_to_string[1000401120] = "Zr112";
-	my_pdg_to_string[1000410810] = "Nb81";
-	my_pdg_to_string[1000410820] = "Nb82";
-	my_pdg_to_string[1000410830] = "Nb83";
-	my_pdg_to_string[1000410840] = "Nb84";
-	my_pdg_to_string[1000410850] = "Nb85";
-	my_pdg_to_string[1000410852] = "Nb85[69.000]";
-	my_pdg_to_string[1000410860] = "Nb86";
-	my_pdg_to_string[1000410870] = "Nb87";
-	my_pdg_to_string[1000410871] = "Nb87[3.840]";
-	my_pdg_to_string[1000410880] = "Nb88";
-	my_pdg_to_string[1000410890] = "Nb89";
-	my_pdg_to_string[1000410891] = "Nb89[35.000]";
-	my_pdg_to_string[1000410900] = "Nb90";
-	my_pdg_to_string[1000410901] = "Nb90[122.370]";
-	my_pdg_to_string[1000410902] = "Nb90[124.670]";
-	my_pdg_to_string[1000410903] = "Nb90[382.010]";
-	my_pdg_to_string[1000410910] = "Nb91";
-	my_pdg_to_string[1000410911] = "Nb91[104.600]";
-	my_pdg_to_string[1000410912] = "Nb91[2034.420]";
-	my_pdg_to_string[1000410920] = "Nb92";
-	my_pdg_to_string[1000410921] = "Nb92[135.500]";
-	my_pdg_to_string[1000410922] = "Nb92[225.800]";
-	my_pdg_to_string[1000410930] = "Nb93";
-	my_pdg_to_string[1000410931] = "Nb93[30.770]";
-	my_pdg_to_string[1000410932] = "Nb93[7435.300]";
-	my_pdg_to_string[1000410940] = "Nb94";
-	my_pdg_to_string[1000410941] = "Nb94[40.892]";
-	my_pdg_to_string[1000410950] = "Nb95";
-	my_pdg_to_string[1000410951] = "Nb95[235.690]";
-	my_pdg_to_string[1000410960] = "Nb96";
-	my_pdg_to_string[1000410970] = "Nb97";
-	my_pdg_to_string[1000410971] = "Nb97[743.350]";
-	my_pdg_to_string[1000410980] = "Nb98";
-	my_pdg_to_string[1000410981] = "Nb98[84.000]";
-	my_pdg_to_string[1000410990] = "Nb99";
-	my_pdg_to_string[1000410991] = "Nb99[365.270]";
-	my_pdg_to_string[1000411000] = "Nb100";
-	my_pdg_to_string[1000411001] = "Nb100[314.000]";
-	my_pdg_to_string[1000411002] = "Nb100[420.700]";
-	my_pdg_to_string[1000411010] = "Nb101";
-	my_pdg_to_string[1000411020] = "Nb102";
-	my_pdg_to_string[1000411030] = "Nb103";
-	my_pdg_to_string[1000411040] = "Nb104";
-	my_pdg_to_string[1000411041] = "Nb104[215.000]";
-	my_pdg_to_string[1000411050] = "Nb105";
-	my_pdg_to_string[1000411060] = "Nb106";
-	my_pdg_to_string[1000411070] = "Nb107";
-	my_pdg_to_string[1000411080] = "Nb108";
-	my_pdg_to_string[1000411090] = "Nb109";
-	my_pdg_to_string[1000411100] = "Nb110";
-	my_pdg_to_string[1000411110] = "Nb111";
-	my_pdg_to_string[1000411120] = "Nb112";
-	my_pdg_to_string[1000411130] = "Nb113";
-	my_pdg_to_string[1000411140] = "Nb114";
-	my_pdg_to_string[1000420830] = "Mo83";
-	my_pdg_to_string[1000420840] = "Mo84";
-	my_pdg_to_string[1000420850] = "Mo85";
-	my_pdg_to_string[1000420860] = "Mo86";
-	my_pdg_to_string[1000420870] = "Mo87";
-	my_pdg_to_string[1000420880] = "Mo88";
-	my_pdg_to_string[1000420890] = "Mo89";
-	my_pdg_to_string[1000420891] = "Mo89[387.500]";
-	my_pdg_to_string[1000420900] = "Mo90";
-	my_pdg_to_string[1000420901] = "Mo90[2874.730]";
-	my_pdg_to_string[1000420910] = "Mo91";
-	my_pdg_to_string[1000420911] = "Mo91[653.010]";
-	my_pdg_to_string[1000420920] = "Mo92";
-	my_pdg_to_string[1000420930] = "Mo93";
-	my_pdg_to_string[1000420931] = "Mo93[2424.950]";
-	my_pdg_to_string[1000420932] = "Mo93[9670.000]";
-	my_pdg_to_string[1000420940] = "Mo94";
-	my_pdg_to_string[1000420950] = "Mo95";
-	my_pdg_to_string[1000420960] = "Mo96";
-	my_pdg_to_string[1000420970] = "Mo97";
-	my_pdg_to_string[1000420980] = "Mo98";
-	my_pdg_to_string[1000420990] = "Mo99";
-	my_pdg_to_string[1000420991] = "Mo99[97.785]";
-	my_pdg_to_string[1000421000] = "Mo100";
-	my_pdg_to_string[1000421010] = "Mo101";
-	my_pdg_to_string[1000421020] = "Mo102";
-	my_pdg_to_string[1000421030] = "Mo103";
-	my_pdg_to_string[1000421040] = "Mo104";
-	my_pdg_to_string[1000421050] = "Mo105";
-	my_pdg_to_string[1000421060] = "Mo106";
-	my_pdg_to_string[1000421070] = "Mo107";
-	my_pdg_to_string[1000421080] = "Mo108";
-	my_pdg_to_string[1000421090] = "Mo109";
-	my_pdg_to_string[1000421100] = "Mo110";
-	my_pdg_to_string[1000421110] = "Mo111";
-	my_pdg_to_string[1000421120] = "Mo112";
-	my_pdg_to_string[1000421130] = "Mo113";
-	my_pdg_to_string[1000421140] = "Mo114";
-	my_pdg_to_string[1000421150] = "Mo115";
-	my_pdg_to_string[1000421160] = "Mo116";
-	my_pdg_to_string[1000421170] = "Mo117";
-	my_pdg_to_string[1000430850] = "Tc85";
-	my_pdg_to_string[1000430860] = "Tc86";
-	my_pdg_to_string[1000430861] = "Tc86[1524.000]";
-	my_pdg_to_string[1000430870] = "Tc87";
-	my_pdg_to_string[1000430881] = "Tc88[0.000]";
-	my_pdg_to_string[1000430890] = "Tc89";
-	my_pdg_to_string[1000430891] = "Tc89[62.600]";
-	my_pdg_to_string[1000430901] = "Tc90[0.000]";
-	my_pdg_to_string[1000430902] = "Tc90[500.000]";
-	my_pdg_to_string[1000430910] = "Tc91";
-	my_pdg_to_string[1000430911] = "Tc91[139.300]";
-	my_pdg_to_string[1000430920] = "Tc92";
-	my_pdg_to_string[1000430921] = "Tc92[270.090]";
-	my_pdg_to_string[1000430930] = "Tc93";
-	my_pdg_to_string[1000430931] = "Tc93[391.840]";
-	my_pdg_to_string[1000430932] = "Tc93[2185.160]";
-	my_pdg_to_string[1000430940] = "Tc94";
-	my_pdg_to_string[1000430941] = "Tc94[76.000]";
-	my_pdg_to_string[1000430950] = "Tc95";
-	my_pdg_to_string[1000430951] = "Tc95[38.910]";
-	my_pdg_to_string[1000430960] = "Tc96";
-	my_pdg_to_string[1000430961] = "Tc96[34.230]";
-	my_pdg_to_string[1000430970] = "Tc97";
-	my_pdg_to_string[1000430971] = "Tc97[96.570]";
-	my_pdg_to_string[1000430980] = "Tc98";
-	my_pdg_to_string[1000430981] = "Tc98[90.760]";
-	my_pdg_to_string[1000430990] = "Tc99";
-	my_pdg_to_string[1000430991] = "Tc99[142.683]";
-	my_pdg_to_string[1000431000] = "Tc100";
-	my_pdg_to_string[1000431001] = "Tc100[200.670]";
-	my_pdg_to_string[1000431002] = "Tc100[243.950]";
-	my_pdg_to_string[1000431010] = "Tc101";
-	my_pdg_to_string[1000431011] = "Tc101[207.526]";
-	my_pdg_to_string[1000431020] = "Tc102";
-	my_pdg_to_string[1000431030] = "Tc103";
-	my_pdg_to_string[1000431040] = "Tc104";
-	my_pdg_to_string[1000431041] = "Tc104[69.700]";
-	my_pdg_to_string[1000431050] = "Tc105";
-	my_pdg_to_string[1000431060] = "Tc106";
-	my_pdg_to_string[1000431070] = "Tc107";
-	my_pdg_to_string[1000431071] = "Tc107[30.100]";
-	my_pdg_to_string[1000431080] = "Tc108";
-	my_pdg_to_string[1000431090] = "Tc109";
-	my_pdg_to_string[1000431100] = "Tc110";
-	my_pdg_to_string[1000431110] = "Tc111";
-	my_pdg_to_string[1000431120] = "Tc112";
-	my_pdg_to_string[1000431130] = "Tc113";
-	my_pdg_to_string[1000431141] = "Tc114[0.000]";
-	my_pdg_to_string[1000431150] = "Tc115";
-	my_pdg_to_string[1000431160] = "Tc116";
-	my_pdg_to_string[1000431170] = "Tc117";
-	my_pdg_to_string[1000431180] = "Tc118";
-	my_pdg_to_string[1000431190] = "Tc119";
-	my_pdg_to_string[1000431200] = "Tc120";
-	my_pdg_to_string[1000440880] = "Ru88";
-	my_pdg_to_string[1000440890] = "Ru89";
-	my_pdg_to_string[1000440900] = "Ru90";
-	my_pdg_to_string[1000440910] = "Ru91";
-	my_pdg_to_string[1000440920] = "Ru92";
-	my_pdg_to_string[1000440930] = "Ru93";
-	my_pdg_to_string[1000440931] = "Ru93[734.400]";
-	my_pdg_to_string[1000440932] = "Ru93[2082.500]";
-	my_pdg_to_string[1000440940] = "Ru94";
-	my_pdg_to_string[1000440941] = "Ru94[2644.100]";
-	my_pdg_to_string[1000440950] = "Ru95";
-	my_pdg_to_string[1000440960] = "Ru96";
-	my_pdg_to_string[1000440970] = "Ru97";
-	my_pdg_to_string[1000440980] = "Ru98";
-	my_pdg_to_string[1000440990] = "Ru99";
-	my_pdg_to_string[1000441000] = "Ru100";
-	my_pdg_to_string[1000441010] = "Ru101";
-	my_pdg_to_string[1000441011] = "Ru101[527.560]";
-	my_pdg_to_string[1000441020] = "Ru102";
-	my_pdg_to_string[1000441030] = "Ru103";
-	my_pdg_to_string[1000441031] = "Ru103[238.200]";
-	my_pdg_to_string[1000441040] = "Ru104";
-	my_pdg_to_string[1000441050] = "Ru105";
-	my_pdg_to_string[1000441060] = "Ru106";
-	my_pdg_to_string[1000441070] = "Ru107";
-	my_pdg_to_string[1000441080] = "Ru108";
-	my_pdg_to_string[1000441090] = "Ru109";
-	my_pdg_to_string[1000441100] = "Ru110";
-	my_pdg_to_string[1000441110] = "Ru111";
-	my_pdg_to_string[1000441120] = "Ru112";
-	my_pdg_to_string[1000441130] = "Ru113";
-	my_pdg_to_string[1000441140] = "Ru114";
-	my_pdg_to_string[1000441150] = "Ru115";
-	my_pdg_to_string[1000441151] = "Ru115[61.700]";
-	my_pdg_to_string[1000441160] = "Ru116";
-	my_pdg_to_string[1000441170] = "Ru117";
-	my_pdg_to_string[1000441180] = "Ru118";
-	my_pdg_to_string[1000441190] = "Ru119";
-	my_pdg_to_string[1000441200] = "Ru120";
-	my_pdg_to_string[1000441210] = "Ru121";
-	my_pdg_to_string[1000441220] = "Ru122";
-	my_pdg_to_string[1000441230] = "Ru123";
-	my_pdg_to_string[1000441240] = "Ru124";
-	my_pdg_to_string[1000450900] = "Rh90";
-	my_pdg_to_string[1000450910] = "Rh91";
-	my_pdg_to_string[1000450911] = "Rh91[172.900]";
-	my_pdg_to_string[1000450920] = "Rh92";
-	my_pdg_to_string[1000450930] = "Rh93";
-	my_pdg_to_string[1000450940] = "Rh94";
-	my_pdg_to_string[1000450950] = "Rh95";
-	my_pdg_to_string[1000450951] = "Rh95[543.300]";
-	my_pdg_to_string[1000450960] = "Rh96";
-	my_pdg_to_string[1000450961] = "Rh96[51.980]";
-	my_pdg_to_string[1000450970] = "Rh97";
-	my_pdg_to_string[1000450971] = "Rh97[258.760]";
-	my_pdg_to_string[1000450980] = "Rh98";
-	my_pdg_to_string[1000450990] = "Rh99";
-	my_pdg_to_string[1000450991] = "Rh99[64.600]";
-	my_pdg_to_string[1000451000] = "Rh100";
-	my_pdg_to_string[1000451001] = "Rh100[107.600]";
-	my_pdg_to_string[1000451010] = "Rh101";
-	my_pdg_to_string[1000451011] = "Rh101[157.320]";
-	my_pdg_to_string[1000451020] = "Rh102";
-	my_pdg_to_string[1000451021] = "Rh102[140.730]";
-	my_pdg_to_string[1000451030] = "Rh103";
-	my_pdg_to_string[1000451031] = "Rh103[39.753]";
-	my_pdg_to_string[1000451040] = "Rh104";
-	my_pdg_to_string[1000451041] = "Rh104[128.968]";
-	my_pdg_to_string[1000451050] = "Rh105";
-	my_pdg_to_string[1000451051] = "Rh105[129.782]";
-	my_pdg_to_string[1000451060] = "Rh106";
-	my_pdg_to_string[1000451061] = "Rh106[137.000]";
-	my_pdg_to_string[1000451070] = "Rh107";
-	my_pdg_to_string[1000451071] = "Rh107[268.360]";
-	my_pdg_to_string[1000451080] = "Rh108";
-	my_pdg_to_string[1000451090] = "Rh109";
-	my_pdg_to_string[1000451091] = "Rh109[225.974]";
-	my_pdg_to_string[1000451100] = "Rh110";
-	my_pdg_to_string[1000451110] = "Rh111";
-	my_pdg_to_string[1000451120] = "Rh112";
-	my_pdg_to_string[1000451130] = "Rh113";
-	my_pdg_to_string[1000451140] = "Rh114";
-	my_pdg_to_string[1000451150] = "Rh115";
-	my_pdg_to_string[1000451160] = "Rh116";
-	my_pdg_to_string[1000451161] = "Rh116[150.000]";
-	my_pdg_to_string[1000451170] = "Rh117";
-	my_pdg_to_string[1000451180] = "Rh118";
-	my_pdg_to_string[1000451190] = "Rh119";
-	my_pdg_to_string[1000451200] = "Rh120";
-	my_pdg_to_string[1000451210] = "Rh121";
-	my_pdg_to_string[1000451220] = "Rh122";
-	my_pdg_to_string[1000451230] = "Rh123";
-	my_pdg_to_string[1000451240] = "Rh124";
-	my_pdg_to_string[1000451250] = "Rh125";
-	my_pdg_to_string[1000451260] = "Rh126";
-	my_pdg_to_string[1000460920] = "Pd92";
-	my_pdg_to_string[1000460930] = "Pd93";
-	my_pdg_to_string[1000460940] = "Pd94";
-	my_pdg_to_string[1000460950] = "Pd95";
-	my_pdg_to_string[1000460951] = "Pd95[1875.130]";
-	my_pdg_to_string[1000460960] = "Pd96";
-	my_pdg_to_string[1000460961] = "Pd96[2530.570]";
-	my_pdg_to_string[1000460970] = "Pd97";
-	my_pdg_to_string[1000460980] = "Pd98";
-	my_pdg_to_string[1000460990] = "Pd99";
-	my_pdg_to_string[1000461000] = "Pd100";
-	my_pdg_to_string[1000461010] = "Pd101";
-	my_pdg_to_string[1000461020] = "Pd102";
-	my_pdg_to_string[1000461030] = "Pd103";
-	my_pdg_to_string[1000461040] = "Pd104";
-	my_pdg_to_string[1000461050] = "Pd105";
-	my_pdg_to_string[1000461051] = "Pd105[489.140]";
-	my_pdg_to_string[1000461060] = "Pd106";
-	my_pdg_to_string[1000461070] = "Pd107";
-	my_pdg_to_string[1000461071] = "Pd107[214.600]";
-	my_pdg_to_string[1000461080] = "Pd108";
-	my_pdg_to_string[1000461090] = "Pd109";
-	my_pdg_to_string[1000461091] = "Pd109[188.990]";
-	my_pdg_to_string[1000461100] = "Pd110";
-	my_pdg_to_string[1000461110] = "Pd111";
-	my_pdg_to_string[1000461111] = "Pd111[172.180]";
-	my_pdg_to_string[1000461120] = "Pd112";
-	my_pdg_to_string[1000461130] = "Pd113";
-	my_pdg_to_string[1000461131] = "Pd113[81.100]";
-	my_pdg_to_string[1000461140] = "Pd114";
-	my_pdg_to_string[1000461150] = "Pd115";
-	my_pdg_to_string[1000461151] = "Pd115[89.210]";
-	my_pdg_to_string[1000461160] = "Pd116";
-	my_pdg_to_string[1000461170] = "Pd117";
-	my_pdg_to_string[1000461171] = "Pd117[203.300]";
-	my_pdg_to_string[1000461180] = "Pd118";
-	my_pdg_to_string[1000461190] = "Pd119";
-	my_pdg_to_string[1000461200] = "Pd120";
-	my_pdg_to_string[1000461210] = "Pd121";
-	my_pdg_to_string[1000461220] = "Pd122";
-	my_pdg_to_string[1000461230] = "Pd123";
-	my_pdg_to_string[1000461240] = "Pd124";
-	my_pdg_to_string[1000461241] = "Pd124[62.200]";
-	my_pdg_to_string[1000461250] = "Pd125";
-	my_pdg_to_string[1000461260] = "Pd126";
-	my_pdg_to_string[1000461280] = "Pd128";
-	my_pdg_to_string[1000461281] = "Pd128[2151.000]";
-	my_pdg_to_string[1000470940] = "Ag94";
-	my_pdg_to_string[1000470942] = "Ag94[6670.000]";
-	my_pdg_to_string[1000470950] = "Ag95";
-	my_pdg_to_string[1000470951] = "Ag95[344.200]";
-	my_pdg_to_string[1000470952] = "Ag95[2531.300]";
-	my_pdg_to_string[1000470953] = "Ag95[4860.000]";
-	my_pdg_to_string[1000470961] = "Ag96[0.000]";
-	my_pdg_to_string[1000470970] = "Ag97";
-	my_pdg_to_string[1000470980] = "Ag98";
-	my_pdg_to_string[1000470990] = "Ag99";
-	my_pdg_to_string[1000470991] = "Ag99[506.200]";
-	my_pdg_to_string[1000471000] = "Ag100";
-	my_pdg_to_string[1000471001] = "Ag100[15.520]";
-	my_pdg_to_string[1000471010] = "Ag101";
-	my_pdg_to_string[1000471011] = "Ag101[274.100]";
-	my_pdg_to_string[1000471020] = "Ag102";
-	my_pdg_to_string[1000471021] = "Ag102[9.400]";
-	my_pdg_to_string[1000471030] = "Ag103";
-	my_pdg_to_string[1000471031] = "Ag103[134.450]";
-	my_pdg_to_string[1000471040] = "Ag104";
-	my_pdg_to_string[1000471041] = "Ag104[6.900]";
-	my_pdg_to_string[1000471050] = "Ag105";
-	my_pdg_to_string[1000471051] = "Ag105[25.479]";
-	my_pdg_to_string[1000471060] = "Ag106";
-	my_pdg_to_string[1000471061] = "Ag106[89.660]";
-	my_pdg_to_string[1000471070] = "Ag107";
-	my_pdg_to_string[1000471071] = "Ag107[93.125]";
-	my_pdg_to_string[1000471080] = "Ag108";
-	my_pdg_to_string[1000471081] = "Ag108[109.466]";
-	my_pdg_to_string[1000471090] = "Ag109";
-	my_pdg_to_string[1000471091] = "Ag109[88.034]";
-	my_pdg_to_string[1000471100] = "Ag110";
-	my_pdg_to_string[1000471101] = "Ag110[117.590]";
-	my_pdg_to_string[1000471110] = "Ag111";
-	my_pdg_to_string[1000471111] = "Ag111[59.820]";
-	my_pdg_to_string[1000471120] = "Ag112";
-	my_pdg_to_string[1000471130] = "Ag113";
-	my_pdg_to_string[1000471131] = "Ag113[43.500]";
-	my_pdg_to_string[1000471140] = "Ag114";
-	my_pdg_to_string[1000471141] = "Ag114[199.000]";
-	my_pdg_to_string[1000471150] = "Ag115";
-	my_pdg_to_string[1000471151] = "Ag115[41.160]";
-	my_pdg_to_string[1000471160] = "Ag116";
-	my_pdg_to_string[1000471161] = "Ag116[47.900]";
-	my_pdg_to_string[1000471162] = "Ag116[129.800]";
-	my_pdg_to_string[1000471170] = "Ag117";
-	my_pdg_to_string[1000471171] = "Ag117[28.600]";
-	my_pdg_to_string[1000471180] = "Ag118";
-	my_pdg_to_string[1000471181] = "Ag118[127.630]";
-	my_pdg_to_string[1000471191] = "Ag119[0.000]";
-	my_pdg_to_string[1000471200] = "Ag120";
-	my_pdg_to_string[1000471201] = "Ag120[203.000]";
-	my_pdg_to_string[1000471210] = "Ag121";
-	my_pdg_to_string[1000471220] = "Ag122";
-	my_pdg_to_string[1000471222] = "Ag122[80.000]";
-	my_pdg_to_string[1000471230] = "Ag123";
-	my_pdg_to_string[1000471240] = "Ag124";
-	my_pdg_to_string[1000471250] = "Ag125";
-	my_pdg_to_string[1000471260] = "Ag126";
-	my_pdg_to_string[1000471270] = "Ag127";
-	my_pdg_to_string[1000471280] = "Ag128";
-	my_pdg_to_string[1000471290] = "Ag129";
-	my_pdg_to_string[1000480960] = "Cd96";
-	my_pdg_to_string[1000480970] = "Cd97";
-	my_pdg_to_string[1000480980] = "Cd98";
-	my_pdg_to_string[1000480990] = "Cd99";
-	my_pdg_to_string[1000481000] = "Cd100";
-	my_pdg_to_string[1000481010] = "Cd101";
-	my_pdg_to_string[1000481020] = "Cd102";
-	my_pdg_to_string[1000481030] = "Cd103";
-	my_pdg_to_string[1000481040] = "Cd104";
-	my_pdg_to_string[1000481050] = "Cd105";
-	my_pdg_to_string[1000481060] = "Cd106";
-	my_pdg_to_string[1000481070] = "Cd107";
-	my_pdg_to_string[1000481080] = "Cd108";
-	my_pdg_to_string[1000481090] = "Cd109";
-	my_pdg_to_string[1000481091] = "Cd109[59.490]";
-	my_pdg_to_string[1000481092] = "Cd109[463.500]";
-	my_pdg_to_string[1000481100] = "Cd110";
-	my_pdg_to_string[1000481110] = "Cd111";
-	my_pdg_to_string[1000481111] = "Cd111[396.214]";
-	my_pdg_to_string[1000481120] = "Cd112";
-	my_pdg_to_string[1000481130] = "Cd113";
-	my_pdg_to_string[1000481131] = "Cd113[263.540]";
-	my_pdg_to_string[1000481140] = "Cd114";
-	my_pdg_to_string[1000481150] = "Cd115";
-	my_pdg_to_string[1000481151] = "Cd115[181.000]";
-	my_pdg_to_string[1000481160] = "Cd116";
-	my_pdg_to_string[1000481170] = "Cd117";
-	my_pdg_to_string[1000481171] = "Cd117[136.400]";
-	my_pdg_to_string[1000481180] = "Cd118";
-	my_pdg_to_string[1000481190] = "Cd119";
-	my_pdg_to_string[1000481191] = "Cd119[146.540]";
-	my_pdg_to_string[1000481200] = "Cd120";
-	my_pdg_to_string[1000481210] = "Cd121";
-	my_pdg_to_string[1000481211] = "Cd121[214.860]";
-	my_pdg_to_string[1000481220] = "Cd122";
-	my_pdg_to_string[1000481230] = "Cd123";
-	my_pdg_to_string[1000481231] = "Cd123[316.530]";
-	my_pdg_to_string[1000481240] = "Cd124";
-	my_pdg_to_string[1000481250] = "Cd125";
-	my_pdg_to_string[1000481260] = "Cd126";
-	my_pdg_to_string[1000481270] = "Cd127";
-	my_pdg_to_string[1000481280] = "Cd128";
-	my_pdg_to_string[1000481290] = "Cd129";
-	my_pdg_to_string[1000481292] = "Cd129[1940.000]";
-	my_pdg_to_string[1000481300] = "Cd130";
-	my_pdg_to_string[1000481310] = "Cd131";
-	my_pdg_to_string[1000481320] = "Cd132";
-	my_pdg_to_string[1000481330] = "Cd133";
-	my_pdg_to_string[1000490981] = "In98[0.000]";
-	my_pdg_to_string[1000490990] = "In99";
-	my_pdg_to_string[1000491000] = "In100";
-	my_pdg_to_string[1000491010] = "In101";
-	my_pdg_to_string[1000491020] = "In102";
-	my_pdg_to_string[1000491030] = "In103";
-	my_pdg_to_string[1000491031] = "In103[631.700]";
-	my_pdg_to_string[1000491040] = "In104";
-	my_pdg_to_string[1000491041] = "In104[93.480]";
-	my_pdg_to_string[1000491050] = "In105";
-	my_pdg_to_string[1000491051] = "In105[674.080]";
-	my_pdg_to_string[1000491060] = "In106";
-	my_pdg_to_string[1000491061] = "In106[28.600]";
-	my_pdg_to_string[1000491070] = "In107";
-	my_pdg_to_string[1000491071] = "In107[678.500]";
-	my_pdg_to_string[1000491080] = "In108";
-	my_pdg_to_string[1000491081] = "In108[29.750]";
-	my_pdg_to_string[1000491090] = "In109";
-	my_pdg_to_string[1000491091] = "In109[650.100]";
-	my_pdg_to_string[1000491092] = "In109[2101.800]";
-	my_pdg_to_string[1000491100] = "In110";
-	my_pdg_to_string[1000491101] = "In110[62.080]";
-	my_pdg_to_string[1000491110] = "In111";
-	my_pdg_to_string[1000491111] = "In111[536.990]";
-	my_pdg_to_string[1000491120] = "In112";
-	my_pdg_to_string[1000491121] = "In112[156.592]";
-	my_pdg_to_string[1000491122] = "In112[613.820]";
-	my_pdg_to_string[1000491130] = "In113";
-	my_pdg_to_string[1000491131] = "In113[391.699]";
-	my_pdg_to_string[1000491140] = "In114";
-	my_pdg_to_string[1000491141] = "In114[190.268]";
-	my_pdg_to_string[1000491142] = "In114[501.948]";
-	my_pdg_to_string[1000491150] = "In115";
-	my_pdg_to_string[1000491151] = "In115[336.244]";
-	my_pdg_to_string[1000491160] = "In116";
-	my_pdg_to_string[1000491161] = "In116[127.267]";
-	my_pdg_to_string[1000491162] = "In116[289.660]";
-	my_pdg_to_string[1000491170] = "In117";
-	my_pdg_to_string[1000491171] = "In117[315.303]";
-	my_pdg_to_string[1000491180] = "In118";
-	my_pdg_to_string[1000491181] = "In118[60.000]";
-	my_pdg_to_string[1000491182] = "In118[200.000]";
-	my_pdg_to_string[1000491190] = "In119";
-	my_pdg_to_string[1000491191] = "In119[311.370]";
-	my_pdg_to_string[1000491200] = "In120";
-	my_pdg_to_string[1000491202] = "In120[70.000]";
-	my_pdg_to_string[1000491210] = "In121";
-	my_pdg_to_string[1000491211] = "In121[313.680]";
-	my_pdg_to_string[1000491220] = "In122";
-	my_pdg_to_string[1000491221] = "In122[40.000]";
-	my_pdg_to_string[1000491222] = "In122[290.000]";
-	my_pdg_to_string[1000491230] = "In123";
-	my_pdg_to_string[1000491231] = "In123[327.210]";
-	my_pdg_to_string[1000491240] = "In124";
-	my_pdg_to_string[1000491241] = "In124[50.000]";
-	my_pdg_to_string[1000491250] = "In125";
-	my_pdg_to_string[1000491251] = "In125[360.120]";
-	my_pdg_to_string[1000491252] = "In125[2009.400]";
-	my_pdg_to_string[1000491253] = "In125[2161.200]";
-	my_pdg_to_string[1000491260] = "In126";
-	my_pdg_to_string[1000491261] = "In126[102.000]";
-	my_pdg_to_string[1000491270] = "In127";
-	my_pdg_to_string[1000491271] = "In127[408.900]";
-	my_pdg_to_string[1000491272] = "In127[1863.000]";
-	my_pdg_to_string[1000491273] = "In127[2364.000]";
-	my_pdg_to_string[1000491280] = "In128";
-	my_pdg_to_string[1000491281] = "In128[340.000]";
-	my_pdg_to_string[1000491290] = "In129";
-	my_pdg_to_string[1000491291] = "In129[459.000]";
-	my_pdg_to_string[1000491292] = "In129[1630.000]";
-	my_pdg_to_string[1000491293] = "In129[1687.970]";
-	my_pdg_to_string[1000491294] = "In129[1911.000]";
-	my_pdg_to_string[1000491300] = "In130";
-	my_pdg_to_string[1000491301] = "In130[50.000]";
-	my_pdg_to_string[1000491302] = "In130[388.300]";
-	my_pdg_to_string[1000491303] = "In130[400.000]";
-	my_pdg_to_string[1000491310] = "In131";
-	my_pdg_to_string[1000491311] = "In131[302.000]";
-	my_pdg_to_string[1000491312] = "In131[3764.000]";
-	my_pdg_to_string[1000491320] = "In132";
-	my_pdg_to_string[1000491330] = "In133";
-	my_pdg_to_string[1000491331] = "In133[330.000]";
-	my_pdg_to_string[1000491340] = "In134";
-	my_pdg_to_string[1000491350] = "In135";
-	my_pdg_to_string[1000501000] = "Sn100";
-	my_pdg_to_string[1000501010] = "Sn101";
-	my_pdg_to_string[1000501020] = "Sn102";
-	my_pdg_to_string[1000501030] = "Sn103";
-	my_pdg_to_string[1000501040] = "Sn104";
-	my_pdg_to_string[1000501050] = "Sn105";
-	my_pdg_to_string[1000501060] = "Sn106";
-	my_pdg_to_string[1000501070] = "Sn107";
-	my_pdg_to_string[1000501080] = "Sn108";
-	my_pdg_to_string[1000501090] = "Sn109";
-	my_pdg_to_string[1000501100] = "Sn110";
-	my_pdg_to_string[1000501110] = "Sn111";
-	my_pdg_to_string[1000501111] = "Sn111[254.710]";
-	my_pdg_to_string[1000501120] = "Sn112";
-	my_pdg_to_string[1000501130] = "Sn113";
-	my_pdg_to_string[1000501131] = "Sn113[77.389]";
-	my_pdg_to_string[1000501140] = "Sn114";
-	my_pdg_to_string[1000501150] = "Sn115";
-	my_pdg_to_string[1000501151] = "Sn115[612.810]";
-	my_pdg_to_string[1000501152] = "Sn115[713.640]";
-	my_pdg_to_string[1000501160] = "Sn116";
-	my_pdg_to_string[1000501170] = "Sn117";
-	my_pdg_to_string[1000501171] = "Sn117[314.580]";
-	my_pdg_to_string[1000501172] = "Sn117[2406.400]";
-	my_pdg_to_string[1000501180] = "Sn118";
-	my_pdg_to_string[1000501181] = "Sn118[3108.060]";
-	my_pdg_to_string[1000501190] = "Sn119";
-	my_pdg_to_string[1000501191] = "Sn119[89.531]";
-	my_pdg_to_string[1000501192] = "Sn119[2127.000]";
-	my_pdg_to_string[1000501200] = "Sn120";
-	my_pdg_to_string[1000501201] = "Sn120[2481.630]";
-	my_pdg_to_string[1000501202] = "Sn120[2902.220]";
-	my_pdg_to_string[1000501210] = "Sn121";
-	my_pdg_to_string[1000501211] = "Sn121[6.310]";
-	my_pdg_to_string[1000501212] = "Sn121[1998.000]";
-	my_pdg_to_string[1000501220] = "Sn122";
-	my_pdg_to_string[1000501221] = "Sn122[2409.030]";
-	my_pdg_to_string[1000501222] = "Sn122[2765.600]";
-	my_pdg_to_string[1000501230] = "Sn123";
-	my_pdg_to_string[1000501231] = "Sn123[24.600]";
-	my_pdg_to_string[1000501232] = "Sn123[1945.000]";
-	my_pdg_to_string[1000501233] = "Sn123[2153.000]";
-	my_pdg_to_string[1000501234] = "Sn123[2713.000]";
-	my_pdg_to_string[1000501240] = "Sn124";
-	my_pdg_to_string[1000501241] = "Sn124[2325.010]";
-	my_pdg_to_string[1000501242] = "Sn124[2656.600]";
-	my_pdg_to_string[1000501250] = "Sn125";
-	my_pdg_to_string[1000501251] = "Sn125[27.500]";
-	my_pdg_to_string[1000501252] = "Sn125[1892.800]";
-	my_pdg_to_string[1000501260] = "Sn126";
-	my_pdg_to_string[1000501261] = "Sn126[2218.990]";
-	my_pdg_to_string[1000501262] = "Sn126[2564.500]";
-	my_pdg_to_string[1000501270] = "Sn127";
-	my_pdg_to_string[1000501271] = "Sn127[5.070]";
-	my_pdg_to_string[1000501272] = "Sn127[1826.670]";
-	my_pdg_to_string[1000501273] = "Sn127[1930.970]";
-	my_pdg_to_string[1000501280] = "Sn128";
-	my_pdg_to_string[1000501281] = "Sn128[2091.500]";
-	my_pdg_to_string[1000501282] = "Sn128[2491.910]";
-	my_pdg_to_string[1000501290] = "Sn129";
-	my_pdg_to_string[1000501291] = "Sn129[35.150]";
-	my_pdg_to_string[1000501292] = "Sn129[1761.600]";
-	my_pdg_to_string[1000501293] = "Sn129[1802.600]";
-	my_pdg_to_string[1000501300] = "Sn130";
-	my_pdg_to_string[1000501301] = "Sn130[1946.880]";
-	my_pdg_to_string[1000501302] = "Sn130[2434.790]";
-	my_pdg_to_string[1000501310] = "Sn131";
-	my_pdg_to_string[1000501320] = "Sn132";
-	my_pdg_to_string[1000501321] = "Sn132[4848.520]";
-	my_pdg_to_string[1000501330] = "Sn133";
-	my_pdg_to_string[1000501340] = "Sn134";
-	my_pdg_to_string[1000501350] = "Sn135";
-	my_pdg_to_string[1000501360] = "Sn136";
-	my_pdg_to_string[1000501370] = "Sn137";
-	my_pdg_to_string[1000501380] = "Sn138";
-	my_pdg_to_string[1000511040] = "Sb104";
-	my_pdg_to_string[1000511050] = "Sb105";
-	my_pdg_to_string[1000511060] = "Sb106";
-	my_pdg_to_string[1000511070] = "Sb107";
-	my_pdg_to_string[1000511080] = "Sb108";
-	my_pdg_to_string[1000511090] = "Sb109";
-	my_pdg_to_string[1000511100] = "Sb110";
-	my_pdg_to_string[1000511110] = "Sb111";
-	my_pdg_to_string[1000511120] = "Sb112";
-	my_pdg_to_string[1000511130] = "Sb113";
-	my_pdg_to_string[1000511140] = "Sb114";
-	my_pdg_to_string[1000511141] = "Sb114[495.500]";
-	my_pdg_to_string[1000511150] = "Sb115";
-	my_pdg_to_string[1000511160] = "Sb116";
-	my_pdg_to_string[1000511161] = "Sb116[383.000]";
-	my_pdg_to_string[1000511170] = "Sb117";
-	my_pdg_to_string[1000511171] = "Sb117[3130.760]";
-	my_pdg_to_string[1000511180] = "Sb118";
-	my_pdg_to_string[1000511181] = "Sb118[50.814]";
-	my_pdg_to_string[1000511182] = "Sb118[250.000]";
-	my_pdg_to_string[1000511190] = "Sb119";
-	my_pdg_to_string[1000511191] = "Sb119[2841.700]";
-	my_pdg_to_string[1000511200] = "Sb120";
-	my_pdg_to_string[1000511210] = "Sb121";
-	my_pdg_to_string[1000511211] = "Sb121[2721.500]";
-	my_pdg_to_string[1000511220] = "Sb122";
-	my_pdg_to_string[1000511221] = "Sb122[61.413]";
-	my_pdg_to_string[1000511222] = "Sb122[137.473]";
-	my_pdg_to_string[1000511223] = "Sb122[163.559]";
-	my_pdg_to_string[1000511230] = "Sb123";
-	my_pdg_to_string[1000511240] = "Sb124";
-	my_pdg_to_string[1000511241] = "Sb124[10.863]";
-	my_pdg_to_string[1000511242] = "Sb124[36.844]";
-	my_pdg_to_string[1000511243] = "Sb124[40.804]";
-	my_pdg_to_string[1000511250] = "Sb125";
-	my_pdg_to_string[1000511251] = "Sb125[1971.250]";
-	my_pdg_to_string[1000511253] = "Sb125[2112.100]";
-	my_pdg_to_string[1000511260] = "Sb126";
-	my_pdg_to_string[1000511261] = "Sb126[17.700]";
-	my_pdg_to_string[1000511262] = "Sb126[40.400]";
-	my_pdg_to_string[1000511270] = "Sb127";
-	my_pdg_to_string[1000511271] = "Sb127[1920.190]";
-	my_pdg_to_string[1000511280] = "Sb128";
-	my_pdg_to_string[1000511290] = "Sb129";
-	my_pdg_to_string[1000511291] = "Sb129[1851.310]";
-	my_pdg_to_string[1000511292] = "Sb129[1861.060]";
-	my_pdg_to_string[1000511293] = "Sb129[2139.400]";
-	my_pdg_to_string[1000511300] = "Sb130";
-	my_pdg_to_string[1000511301] = "Sb130[4.800]";
-	my_pdg_to_string[1000511310] = "Sb131";
-	my_pdg_to_string[1000511311] = "Sb131[1676.060]";
-	my_pdg_to_string[1000511312] = "Sb131[1687.200]";
-	my_pdg_to_string[1000511313] = "Sb131[2165.600]";
-	my_pdg_to_string[1000511320] = "Sb132";
-	my_pdg_to_string[1000511330] = "Sb133";
-	my_pdg_to_string[1000511331] = "Sb133[4560.000]";
-	my_pdg_to_string[1000511340] = "Sb134";
-	my_pdg_to_string[1000511341] = "Sb134[279.000]";
-	my_pdg_to_string[1000511350] = "Sb135";
-	my_pdg_to_string[1000511360] = "Sb136";
-	my_pdg_to_string[1000511370] = "Sb137";
-	my_pdg_to_string[1000511390] = "Sb139";
-	my_pdg_to_string[1000511400] = "Sb140";
-	my_pdg_to_string[1000521050] = "Te105";
-	my_pdg_to_string[1000521060] = "Te106";
-	my_pdg_to_string[1000521070] = "Te107";
-	my_pdg_to_string[1000521080] = "Te108";
-	my_pdg_to_string[1000521090] = "Te109";
-	my_pdg_to_string[1000521100] = "Te110";
-	my_pdg_to_string[1000521110] = "Te111";
-	my_pdg_to_string[1000521120] = "Te112";
-	my_pdg_to_string[1000521130] = "Te113";
-	my_pdg_to_string[1000521140] = "Te114";
-	my_pdg_to_string[1000521150] = "Te115";
-	my_pdg_to_string[1000521151] = "Te115[20.000]";
-	my_pdg_to_string[1000521152] = "Te115[280.050]";
-	my_pdg_to_string[1000521160] = "Te116";
-	my_pdg_to_string[1000521170] = "Te117";
-	my_pdg_to_string[1000521171] = "Te117[296.100]";
-	my_pdg_to_string[1000521180] = "Te118";
-	my_pdg_to_string[1000521190] = "Te119";
-	my_pdg_to_string[1000521191] = "Te119[260.960]";
-	my_pdg_to_string[1000521200] = "Te120";
-	my_pdg_to_string[1000521210] = "Te121";
-	my_pdg_to_string[1000521211] = "Te121[293.974]";
-	my_pdg_to_string[1000521220] = "Te122";
-	my_pdg_to_string[1000521230] = "Te123";
-	my_pdg_to_string[1000521231] = "Te123[247.470]";
-	my_pdg_to_string[1000521240] = "Te124";
-	my_pdg_to_string[1000521250] = "Te125";
-	my_pdg_to_string[1000521251] = "Te125[144.775]";
-	my_pdg_to_string[1000521260] = "Te126";
-	my_pdg_to_string[1000521270] = "Te127";
-	my_pdg_to_string[1000521271] = "Te127[88.230]";
-	my_pdg_to_string[1000521280] = "Te128";
-	my_pdg_to_string[1000521290] = "Te129";
-	my_pdg_to_string[1000521291] = "Te129[105.510]";
-	my_pdg_to_string[1000521300] = "Te130";
-	my_pdg_to_string[1000521301] = "Te130[2648.600]";
-	my_pdg_to_string[1000521310] = "Te131";
-	my_pdg_to_string[1000521311] = "Te131[182.258]";
-	my_pdg_to_string[1000521312] = "Te131[1940.000]";
-	my_pdg_to_string[1000521320] = "Te132";
-	my_pdg_to_string[1000521321] = "Te132[1925.470]";
-	my_pdg_to_string[1000521322] = "Te132[2723.300]";
-	my_pdg_to_string[1000521330] = "Te133";
-	my_pdg_to_string[1000521331] = "Te133[334.260]";
-	my_pdg_to_string[1000521340] = "Te134";
-	my_pdg_to_string[1000521350] = "Te135";
-	my_pdg_to_string[1000521360] = "Te136";
-	my_pdg_to_string[1000521370] = "Te137";
-	my_pdg_to_string[1000521380] = "Te138";
-	my_pdg_to_string[1000521390] = "Te139";
-	my_pdg_to_string[1000521430] = "Te143";
-	my_pdg_to_string[1000531080] = "I108";
-	my_pdg_to_string[1000531090] = "I109";
-	my_pdg_to_string[1000531100] = "I110";
-	my_pdg_to_string[1000531110] = "I111";
-	my_pdg_to_string[1000531120] = "I112";
-	my_pdg_to_string[1000531130] = "I113";
-	my_pdg_to_string[1000531140] = "I114";
-	my_pdg_to_string[1000531141] = "I114[265.900]";
-	my_pdg_to_string[1000531150] = "I115";
-	my_pdg_to_string[1000531160] = "I116";
-	my_pdg_to_string[1000531161] = "I116[430.400]";
-	my_pdg_to_string[1000531170] = "I117";
-	my_pdg_to_string[1000531180] = "I118";
-	my_pdg_to_string[1000531181] = "I118[104.000]";
-	my_pdg_to_string[1000531190] = "I119";
-	my_pdg_to_string[1000531200] = "I120";
-	my_pdg_to_string[1000531201] = "I120[320.000]";
-	my_pdg_to_string[1000531210] = "I121";
-	my_pdg_to_string[1000531211] = "I121[2376.900]";
-	my_pdg_to_string[1000531220] = "I122";
-	my_pdg_to_string[1000531221] = "I122[379.400]";
-	my_pdg_to_string[1000531222] = "I122[394.100]";
-	my_pdg_to_string[1000531230] = "I123";
-	my_pdg_to_string[1000531240] = "I124";
-	my_pdg_to_string[1000531250] = "I125";
-	my_pdg_to_string[1000531260] = "I126";
-	my_pdg_to_string[1000531270] = "I127";
-	my_pdg_to_string[1000531280] = "I128";
-	my_pdg_to_string[1000531290] = "I129";
-	my_pdg_to_string[1000531300] = "I130";
-	my_pdg_to_string[1000531301] = "I130[39.953]";
-	my_pdg_to_string[1000531310] = "I131";
-	my_pdg_to_string[1000531320] = "I132";
-	my_pdg_to_string[1000531321] = "I132[120.000]";
-	my_pdg_to_string[1000531330] = "I133";
-	my_pdg_to_string[1000531331] = "I133[1634.148]";
-	my_pdg_to_string[1000531340] = "I134";
-	my_pdg_to_string[1000531341] = "I134[316.490]";
-	my_pdg_to_string[1000531350] = "I135";
-	my_pdg_to_string[1000531360] = "I136";
-	my_pdg_to_string[1000531361] = "I136[640.000]";
-	my_pdg_to_string[1000531370] = "I137";
-	my_pdg_to_string[1000531380] = "I138";
-	my_pdg_to_string[1000531390] = "I139";
-	my_pdg_to_string[1000531400] = "I140";
-	my_pdg_to_string[1000531410] = "I141";
-	my_pdg_to_string[1000531420] = "I142";
-	my_pdg_to_string[1000531430] = "I143";
-	my_pdg_to_string[1000531450] = "I145";
-	my_pdg_to_string[1000541090] = "Xe109";
-	my_pdg_to_string[1000541100] = "Xe110";
-	my_pdg_to_string[1000541110] = "Xe111";
-	my_pdg_to_string[1000541120] = "Xe112";
-	my_pdg_to_string[1000541130] = "Xe113";
-	my_pdg_to_string[1000541140] = "Xe114";
-	my_pdg_to_string[1000541150] = "Xe115";
-	my_pdg_to_string[1000541160] = "Xe116";
-	my_pdg_to_string[1000541170] = "Xe117";
-	my_pdg_to_string[1000541180] = "Xe118";
-	my_pdg_to_string[1000541190] = "Xe119";
-	my_pdg_to_string[1000541200] = "Xe120";
-	my_pdg_to_string[1000541210] = "Xe121";
-	my_pdg_to_string[1000541220] = "Xe122";
-	my_pdg_to_string[1000541230] = "Xe123";
-	my_pdg_to_string[1000541231] = "Xe123[185.180]";
-	my_pdg_to_string[1000541240] = "Xe124";
-	my_pdg_to_string[1000541250] = "Xe125";
-	my_pdg_to_string[1000541251] = "Xe125[252.610]";
-	my_pdg_to_string[1000541260] = "Xe126";
-	my_pdg_to_string[1000541270] = "Xe127";
-	my_pdg_to_string[1000541271] = "Xe127[297.100]";
-	my_pdg_to_string[1000541280] = "Xe128";
-	my_pdg_to_string[1000541290] = "Xe129";
-	my_pdg_to_string[1000541291] = "Xe129[236.140]";
-	my_pdg_to_string[1000541300] = "Xe130";
-	my_pdg_to_string[1000541310] = "Xe131";
-	my_pdg_to_string[1000541311] = "Xe131[163.930]";
-	my_pdg_to_string[1000541320] = "Xe132";
-	my_pdg_to_string[1000541321] = "Xe132[2752.210]";
-	my_pdg_to_string[1000541330] = "Xe133";
-	my_pdg_to_string[1000541331] = "Xe133[233.221]";
-	my_pdg_to_string[1000541340] = "Xe134";
-	my_pdg_to_string[1000541341] = "Xe134[1965.500]";
-	my_pdg_to_string[1000541342] = "Xe134[3025.200]";
-	my_pdg_to_string[1000541350] = "Xe135";
-	my_pdg_to_string[1000541351] = "Xe135[526.551]";
-	my_pdg_to_string[1000541360] = "Xe136";
-	my_pdg_to_string[1000541361] = "Xe136[1891.703]";
-	my_pdg_to_string[1000541370] = "Xe137";
-	my_pdg_to_string[1000541380] = "Xe138";
-	my_pdg_to_string[1000541390] = "Xe139";
-	my_pdg_to_string[1000541400] = "Xe140";
-	my_pdg_to_string[1000541410] = "Xe141";
-	my_pdg_to_string[1000541420] = "Xe142";
-	my_pdg_to_string[1000541430] = "Xe143";
-	my_pdg_to_string[1000541440] = "Xe144";
-	my_pdg_to_string[1000541450] = "Xe145";
-	my_pdg_to_string[1000541470] = "Xe147";
-	my_pdg_to_string[1000541480] = "Xe148";
-	my_pdg_to_string[1000551120] = "Cs112";
-	my_pdg_to_string[1000551130] = "Cs113";
-	my_pdg_to_string[1000551140] = "Cs114";
-	my_pdg_to_string[1000551150] = "Cs115";
-	my_pdg_to_string[1000551160] = "Cs116";
-	my_pdg_to_string[1000551161] = "Cs116[100.000]";
-	my_pdg_to_string[1000551171] = "Cs117[0.000]";
-	my_pdg_to_string[1000551180] = "Cs118";
-	my_pdg_to_string[1000551190] = "Cs119";
-	my_pdg_to_string[1000551200] = "Cs120";
-	my_pdg_to_string[1000551210] = "Cs121";
-	my_pdg_to_string[1000551211] = "Cs121[68.500]";
-	my_pdg_to_string[1000551220] = "Cs122";
-	my_pdg_to_string[1000551221] = "Cs122[127.070]";
-	my_pdg_to_string[1000551222] = "Cs122[140.000]";
-	my_pdg_to_string[1000551230] = "Cs123";
-	my_pdg_to_string[1000551231] = "Cs123[156.270]";
-	my_pdg_to_string[1000551240] = "Cs124";
-	my_pdg_to_string[1000551241] = "Cs124[462.630]";
-	my_pdg_to_string[1000551250] = "Cs125";
-	my_pdg_to_string[1000551251] = "Cs125[266.100]";
-	my_pdg_to_string[1000551260] = "Cs126";
-	my_pdg_to_string[1000551261] = "Cs126[596.100]";
-	my_pdg_to_string[1000551270] = "Cs127";
-	my_pdg_to_string[1000551271] = "Cs127[452.230]";
-	my_pdg_to_string[1000551280] = "Cs128";
-	my_pdg_to_string[1000551290] = "Cs129";
-	my_pdg_to_string[1000551300] = "Cs130";
-	my_pdg_to_string[1000551301] = "Cs130[163.250]";
-	my_pdg_to_string[1000551310] = "Cs131";
-	my_pdg_to_string[1000551320] = "Cs132";
-	my_pdg_to_string[1000551330] = "Cs133";
-	my_pdg_to_string[1000551340] = "Cs134";
-	my_pdg_to_string[1000551341] = "Cs134[138.744]";
-	my_pdg_to_string[1000551350] = "Cs135";
-	my_pdg_to_string[1000551351] = "Cs135[1632.900]";
-	my_pdg_to_string[1000551360] = "Cs136";
-	my_pdg_to_string[1000551370] = "Cs137";
-	my_pdg_to_string[1000551380] = "Cs138";
-	my_pdg_to_string[1000551381] = "Cs138[79.900]";
-	my_pdg_to_string[1000551390] = "Cs139";
-	my_pdg_to_string[1000551400] = "Cs140";
-	my_pdg_to_string[1000551410] = "Cs141";
-	my_pdg_to_string[1000551420] = "Cs142";
-	my_pdg_to_string[1000551430] = "Cs143";
-	my_pdg_to_string[1000551440] = "Cs144";
-	my_pdg_to_string[1000551442] = "Cs144[92.200]";
-	my_pdg_to_string[1000551450] = "Cs145";
-	my_pdg_to_string[1000551460] = "Cs146";
-	my_pdg_to_string[1000551470] = "Cs147";
-	my_pdg_to_string[1000551480] = "Cs148";
-	my_pdg_to_string[1000551490] = "Cs149";
-	my_pdg_to_string[1000551500] = "Cs150";
-	my_pdg_to_string[1000551510] = "Cs151";
-	my_pdg_to_string[1000561140] = "Ba114";
-	my_pdg_to_string[1000561150] = "Ba115";
-	my_pdg_to_string[1000561160] = "Ba116";
-	my_pdg_to_string[1000561170] = "Ba117";
-	my_pdg_to_string[1000561180] = "Ba118";
-	my_pdg_to_string[1000561190] = "Ba119";
-	my_pdg_to_string[1000561200] = "Ba120";
-	my_pdg_to_string[1000561210] = "Ba121";
-	my_pdg_to_string[1000561220] = "Ba122";
-	my_pdg_to_string[1000561230] = "Ba123";
-	my_pdg_to_string[1000561240] = "Ba124";
-	my_pdg_to_string[1000561250] = "Ba125";
-	my_pdg_to_string[1000561251] = "Ba125[67.700]";
-	my_pdg_to_string[1000561260] = "Ba126";
-	my_pdg_to_string[1000561270] = "Ba127";
-	my_pdg_to_string[1000561271] = "Ba127[80.320]";
-	my_pdg_to_string[1000561280] = "Ba128";
-	my_pdg_to_string[1000561290] = "Ba129";
-	my_pdg_to_string[1000561291] = "Ba129[8.420]";
-	my_pdg_to_string[1000561300] = "Ba130";
-	my_pdg_to_string[1000561301] = "Ba130[2475.120]";
-	my_pdg_to_string[1000561310] = "Ba131";
-	my_pdg_to_string[1000561311] = "Ba131[187.995]";
-	my_pdg_to_string[1000561320] = "Ba132";
-	my_pdg_to_string[1000561330] = "Ba133";
-	my_pdg_to_string[1000561331] = "Ba133[288.252]";
-	my_pdg_to_string[1000561340] = "Ba134";
-	my_pdg_to_string[1000561341] = "Ba134[2957.200]";
-	my_pdg_to_string[1000561350] = "Ba135";
-	my_pdg_to_string[1000561351] = "Ba135[268.218]";
-	my_pdg_to_string[1000561360] = "Ba136";
-	my_pdg_to_string[1000561361] = "Ba136[2030.466]";
-	my_pdg_to_string[1000561370] = "Ba137";
-	my_pdg_to_string[1000561371] = "Ba137[661.659]";
-	my_pdg_to_string[1000561380] = "Ba138";
-	my_pdg_to_string[1000561390] = "Ba139";
-	my_pdg_to_string[1000561400] = "Ba140";
-	my_pdg_to_string[1000561410] = "Ba141";
-	my_pdg_to_string[1000561420] = "Ba142";
-	my_pdg_to_string[1000561430] = "Ba143";
-	my_pdg_to_string[1000561440] = "Ba144";
-	my_pdg_to_string[1000561450] = "Ba145";
-	my_pdg_to_string[1000561460] = "Ba146";
-	my_pdg_to_string[1000561470] = "Ba147";
-	my_pdg_to_string[1000561480] = "Ba148";
-	my_pdg_to_string[1000561490] = "Ba149";
-	my_pdg_to_string[1000561500] = "Ba150";
-	my_pdg_to_string[1000561510] = "Ba151";
-	my_pdg_to_string[1000561520] = "Ba152";
-	my_pdg_to_string[1000571170] = "La117";
-	my_pdg_to_string[1000571171] = "La117[151.000]";
-	my_pdg_to_string[1000571201] = "La120[0.000]";
-	my_pdg_to_string[1000571210] = "La121";
-	my_pdg_to_string[1000571220] = "La122";
-	my_pdg_to_string[1000571230] = "La123";
-	my_pdg_to_string[1000571241] = "La124[0.000]";
-	my_pdg_to_string[1000571250] = "La125";
-	my_pdg_to_string[1000571251] = "La125[107.000]";
-	my_pdg_to_string[1000571261] = "La126[0.000]";
-	my_pdg_to_string[1000571270] = "La127";
-	my_pdg_to_string[1000571271] = "La127[14.200]";
-	my_pdg_to_string[1000571280] = "La128";
-	my_pdg_to_string[1000571290] = "La129";
-	my_pdg_to_string[1000571291] = "La129[172.330]";
-	my_pdg_to_string[1000571300] = "La130";
-	my_pdg_to_string[1000571310] = "La131";
-	my_pdg_to_string[1000571311] = "La131[304.600]";
-	my_pdg_to_string[1000571320] = "La132";
-	my_pdg_to_string[1000571321] = "La132[188.200]";
-	my_pdg_to_string[1000571330] = "La133";
-	my_pdg_to_string[1000571340] = "La134";
-	my_pdg_to_string[1000571341] = "La134[336.440]";
-	my_pdg_to_string[1000571350] = "La135";
-	my_pdg_to_string[1000571360] = "La136";
-	my_pdg_to_string[1000571361] = "La136[230.000]";
-	my_pdg_to_string[1000571370] = "La137";
-	my_pdg_to_string[1000571380] = "La138";
-	my_pdg_to_string[1000571390] = "La139";
-	my_pdg_to_string[1000571400] = "La140";
-	my_pdg_to_string[1000571410] = "La141";
-	my_pdg_to_string[1000571420] = "La142";
-	my_pdg_to_string[1000571430] = "La143";
-	my_pdg_to_string[1000571440] = "La144";
-	my_pdg_to_string[1000571450] = "La145";
-	my_pdg_to_string[1000571460] = "La146";
-	my_pdg_to_string[1000571470] = "La147";
-	my_pdg_to_string[1000571480] = "La148";
-	my_pdg_to_string[1000571490] = "La149";
-	my_pdg_to_string[1000571500] = "La150";
-	my_pdg_to_string[1000571510] = "La151";
-	my_pdg_to_string[1000571520] = "La152";
-	my_pdg_to_string[1000571530] = "La153";
-	my_pdg_to_string[1000581210] = "Ce121";
-	my_pdg_to_string[1000581230] = "Ce123";
-	my_pdg_to_string[1000581240] = "Ce124";
-	my_pdg_to_string[1000581250] = "Ce125";
-	my_pdg_to_string[1000581260] = "Ce126";
-	my_pdg_to_string[1000581270] = "Ce127";
-	my_pdg_to_string[1000581271] = "Ce127[7.300]";
-	my_pdg_to_string[1000581272] = "Ce127[36.800]";
-	my_pdg_to_string[1000581280] = "Ce128";
-	my_pdg_to_string[1000581290] = "Ce129";
-	my_pdg_to_string[1000581300] = "Ce130";
-	my_pdg_to_string[1000581310] = "Ce131";
-	my_pdg_to_string[1000581311] = "Ce131[63.090]";
-	my_pdg_to_string[1000581320] = "Ce132";
-	my_pdg_to_string[1000581321] = "Ce132[2341.150]";
-	my_pdg_to_string[1000581330] = "Ce133";
-	my_pdg_to_string[1000581331] = "Ce133[37.200]";
-	my_pdg_to_string[1000581340] = "Ce134";
-	my_pdg_to_string[1000581350] = "Ce135";
-	my_pdg_to_string[1000581351] = "Ce135[445.810]";
-	my_pdg_to_string[1000581360] = "Ce136";
-	my_pdg_to_string[1000581361] = "Ce136[3095.500]";
-	my_pdg_to_string[1000581370] = "Ce137";
-	my_pdg_to_string[1000581371] = "Ce137[254.290]";
-	my_pdg_to_string[1000581380] = "Ce138";
-	my_pdg_to_string[1000581381] = "Ce138[2129.170]";
-	my_pdg_to_string[1000581390] = "Ce139";
-	my_pdg_to_string[1000581391] = "Ce139[754.240]";
-	my_pdg_to_string[1000581400] = "Ce140";
-	my_pdg_to_string[1000581401] = "Ce140[2107.860]";
-	my_pdg_to_string[1000581410] = "Ce141";
-	my_pdg_to_string[1000581420] = "Ce142";
-	my_pdg_to_string[1000581430] = "Ce143";
-	my_pdg_to_string[1000581440] = "Ce144";
-	my_pdg_to_string[1000581450] = "Ce145";
-	my_pdg_to_string[1000581460] = "Ce146";
-	my_pdg_to_string[1000581470] = "Ce147";
-	my_pdg_to_string[1000581480] = "Ce148";
-	my_pdg_to_string[1000581490] = "Ce149";
-	my_pdg_to_string[1000581500] = "Ce150";
-	my_pdg_to_string[1000581510] = "Ce151";
-	my_pdg_to_string[1000581520] = "Ce152";
-	my_pdg_to_string[1000581530] = "Ce153";
-	my_pdg_to_string[1000581540] = "Ce154";
-	my_pdg_to_string[1000581550] = "Ce155";
-	my_pdg_to_string[1000591210] = "Pr121";
-	my_pdg_to_string[1000591240] = "Pr124";
-	my_pdg_to_string[1000591250] = "Pr125";
-	my_pdg_to_string[1000591260] = "Pr126";
-	my_pdg_to_string[1000591270] = "Pr127";
-	my_pdg_to_string[1000591280] = "Pr128";
-	my_pdg_to_string[1000591290] = "Pr129";
-	my_pdg_to_string[1000591301] = "Pr130[0.000]";
-	my_pdg_to_string[1000591310] = "Pr131";
-	my_pdg_to_string[1000591311] = "Pr131[152.400]";
-	my_pdg_to_string[1000591320] = "Pr132";
-	my_pdg_to_string[1000591330] = "Pr133";
-	my_pdg_to_string[1000591331] = "Pr133[192.120]";
-	my_pdg_to_string[1000591341] = "Pr134[0.000]";
-	my_pdg_to_string[1000591350] = "Pr135";
-	my_pdg_to_string[1000591351] = "Pr135[358.060]";
-	my_pdg_to_string[1000591360] = "Pr136";
-	my_pdg_to_string[1000591370] = "Pr137";
-	my_pdg_to_string[1000591371] = "Pr137[561.220]";
-	my_pdg_to_string[1000591380] = "Pr138";
-	my_pdg_to_string[1000591381] = "Pr138[364.000]";
-	my_pdg_to_string[1000591390] = "Pr139";
-	my_pdg_to_string[1000591400] = "Pr140";
-	my_pdg_to_string[1000591401] = "Pr140[763.700]";
-	my_pdg_to_string[1000591410] = "Pr141";
-	my_pdg_to_string[1000591420] = "Pr142";
-	my_pdg_to_string[1000591421] = "Pr142[3.694]";
-	my_pdg_to_string[1000591430] = "Pr143";
-	my_pdg_to_string[1000591440] = "Pr144";
-	my_pdg_to_string[1000591441] = "Pr144[59.030]";
-	my_pdg_to_string[1000591450] = "Pr145";
-	my_pdg_to_string[1000591460] = "Pr146";
-	my_pdg_to_string[1000591470] = "Pr147";
-	my_pdg_to_string[1000591480] = "Pr148";
-	my_pdg_to_string[1000591481] = "Pr148[76.800]";
-	my_pdg_to_string[1000591490] = "Pr149";
-	my_pdg_to_string[1000591500] = "Pr150";
-	my_pdg_to_string[1000591510] = "Pr151";
-	my_pdg_to_string[1000591511] = "Pr151[35.100]";
-	my_pdg_to_string[1000591520] = "Pr152";
-	my_pdg_to_string[1000591521] = "Pr152[114.800]";
-	my_pdg_to_string[1000591530] = "Pr153";
-	my_pdg_to_string[1000591540] = "Pr154";
-	my_pdg_to_string[1000591550] = "Pr155";
-	my_pdg_to_string[1000601250] = "Nd125";
-	my_pdg_to_string[1000601270] = "Nd127";
-	my_pdg_to_string[1000601280] = "Nd128";
-	my_pdg_to_string[1000601290] = "Nd129";
-	my_pdg_to_string[1000601300] = "Nd130";
-	my_pdg_to_string[1000601310] = "Nd131";
-	my_pdg_to_string[1000601320] = "Nd132";
-	my_pdg_to_string[1000601330] = "Nd133";
-	my_pdg_to_string[1000601331] = "Nd133[127.970]";
-	my_pdg_to_string[1000601340] = "Nd134";
-	my_pdg_to_string[1000601341] = "Nd134[2293.000]";
-	my_pdg_to_string[1000601350] = "Nd135";
-	my_pdg_to_string[1000601351] = "Nd135[64.950]";
-	my_pdg_to_string[1000601360] = "Nd136";
-	my_pdg_to_string[1000601370] = "Nd137";
-	my_pdg_to_string[1000601371] = "Nd137[519.430]";
-	my_pdg_to_string[1000601380] = "Nd138";
-	my_pdg_to_string[1000601390] = "Nd139";
-	my_pdg_to_string[1000601391] = "Nd139[231.150]";
-	my_pdg_to_string[1000601400] = "Nd140";
-	my_pdg_to_string[1000601401] = "Nd140[2221.400]";
-	my_pdg_to_string[1000601410] = "Nd141";
-	my_pdg_to_string[1000601411] = "Nd141[756.510]";
-	my_pdg_to_string[1000601420] = "Nd142";
-	my_pdg_to_string[1000601421] = "Nd142[2209.303]";
-	my_pdg_to_string[1000601430] = "Nd143";
-	my_pdg_to_string[1000601440] = "Nd144";
-	my_pdg_to_string[1000601450] = "Nd145";
-	my_pdg_to_string[1000601460] = "Nd146";
-	my_pdg_to_string[1000601470] = "Nd147";
-	my_pdg_to_string[1000601480] = "Nd148";
-	my_pdg_to_string[1000601490] = "Nd149";
-	my_pdg_to_string[1000601500] = "Nd150";
-	my_pdg_to_string[1000601510] = "Nd151";
-	my_pdg_to_string[1000601520] = "Nd152";
-	my_pdg_to_string[1000601530] = "Nd153";
-	my_pdg_to_string[1000601531] = "Nd153[191.700]";
-	my_pdg_to_string[1000601540] = "Nd154";
-	my_pdg_to_string[1000601541] = "Nd154[233.200]";
-	my_pdg_to_string[1000601550] = "Nd155";
-	my_pdg_to_string[1000601560] = "Nd156";
-	my_pdg_to_string[1000601570] = "Nd157";
-	my_pdg_to_string[1000601580] = "Nd158";
-	my_pdg_to_string[1000601590] = "Nd159";
-	my_pdg_to_string[1000601600] = "Nd160";
-	my_pdg_to_string[1000601610] = "Nd161";
-	my_pdg_to_string[1000611280] = "Pm128";
-	my_pdg_to_string[1000611290] = "Pm129";
-	my_pdg_to_string[1000611300] = "Pm130";
-	my_pdg_to_string[1000611310] = "Pm131";
-	my_pdg_to_string[1000611320] = "Pm132";
-	my_pdg_to_string[1000611330] = "Pm133";
-	my_pdg_to_string[1000611331] = "Pm133[129.700]";
-	my_pdg_to_string[1000611340] = "Pm134";
-	my_pdg_to_string[1000611351] = "Pm135[0.000]";
-	my_pdg_to_string[1000611352] = "Pm135[68.700]";
-	my_pdg_to_string[1000611361] = "Pm136[0.000]";
-	my_pdg_to_string[1000611370] = "Pm137";
-	my_pdg_to_string[1000611380] = "Pm138";
-	my_pdg_to_string[1000611381] = "Pm138[20.000]";
-	my_pdg_to_string[1000611390] = "Pm139";
-	my_pdg_to_string[1000611391] = "Pm139[188.700]";
-	my_pdg_to_string[1000611400] = "Pm140";
-	my_pdg_to_string[1000611410] = "Pm141";
-	my_pdg_to_string[1000611411] = "Pm141[2530.750]";
-	my_pdg_to_string[1000611412] = "Pm141[2574.400]";
-	my_pdg_to_string[1000611420] = "Pm142";
-	my_pdg_to_string[1000611421] = "Pm142[883.170]";
-	my_pdg_to_string[1000611422] = "Pm142[2828.700]";
-	my_pdg_to_string[1000611430] = "Pm143";
-	my_pdg_to_string[1000611440] = "Pm144";
-	my_pdg_to_string[1000611441] = "Pm144[8595.800]";
-	my_pdg_to_string[1000611450] = "Pm145";
-	my_pdg_to_string[1000611460] = "Pm146";
-	my_pdg_to_string[1000611470] = "Pm147";
-	my_pdg_to_string[1000611480] = "Pm148";
-	my_pdg_to_string[1000611481] = "Pm148[137.900]";
-	my_pdg_to_string[1000611490] = "Pm149";
-	my_pdg_to_string[1000611491] = "Pm149[240.214]";
-	my_pdg_to_string[1000611500] = "Pm150";
-	my_pdg_to_string[1000611510] = "Pm151";
-	my_pdg_to_string[1000611520] = "Pm152";
-	my_pdg_to_string[1000611521] = "Pm152[150.000]";
-	my_pdg_to_string[1000611530] = "Pm153";
-	my_pdg_to_string[1000611540] = "Pm154";
-	my_pdg_to_string[1000611550] = "Pm155";
-	my_pdg_to_string[1000611560] = "Pm156";
-	my_pdg_to_string[1000611561] = "Pm156[150.300]";
-	my_pdg_to_string[1000611570] = "Pm157";
-	my_pdg_to_string[1000611580] = "Pm158";
-	my_pdg_to_string[1000611590] = "Pm159";
-	my_pdg_to_string[1000611600] = "Pm160";
-	my_pdg_to_string[1000611610] = "Pm161";
-	my_pdg_to_string[1000611620] = "Pm162";
-	my_pdg_to_string[1000611630] = "Pm163";
-	my_pdg_to_string[1000621290] = "Sm129";
-	my_pdg_to_string[1000621310] = "Sm131";
-	my_pdg_to_string[1000621320] = "Sm132";
-	my_pdg_to_string[1000621330] = "Sm133";
-	my_pdg_to_string[1000621340] = "Sm134";
-	my_pdg_to_string[1000621350] = "Sm135";
-	my_pdg_to_string[1000621360] = "Sm136";
-	my_pdg_to_string[1000621361] = "Sm136[2264.700]";
-	my_pdg_to_string[1000621370] = "Sm137";
-	my_pdg_to_string[1000621380] = "Sm138";
-	my_pdg_to_string[1000621390] = "Sm139";
-	my_pdg_to_string[1000621391] = "Sm139[457.400]";
-	my_pdg_to_string[1000621400] = "Sm140";
-	my_pdg_to_string[1000621410] = "Sm141";
-	my_pdg_to_string[1000621411] = "Sm141[175.900]";
-	my_pdg_to_string[1000621420] = "Sm142";
-	my_pdg_to_string[1000621430] = "Sm143";
-	my_pdg_to_string[1000621431] = "Sm143[753.990]";
-	my_pdg_to_string[1000621432] = "Sm143[2793.800]";
-	my_pdg_to_string[1000621440] = "Sm144";
-	my_pdg_to_string[1000621450] = "Sm145";
-	my_pdg_to_string[1000621460] = "Sm146";
-	my_pdg_to_string[1000621470] = "Sm147";
-	my_pdg_to_string[1000621480] = "Sm148";
-	my_pdg_to_string[1000621490] = "Sm149";
-	my_pdg_to_string[1000621500] = "Sm150";
-	my_pdg_to_string[1000621510] = "Sm151";
-	my_pdg_to_string[1000621511] = "Sm151[261.130]";
-	my_pdg_to_string[1000621520] = "Sm152";
-	my_pdg_to_string[1000621530] = "Sm153";
-	my_pdg_to_string[1000621531] = "Sm153[98.370]";
-	my_pdg_to_string[1000621540] = "Sm154";
-	my_pdg_to_string[1000621550] = "Sm155";
-	my_pdg_to_string[1000621560] = "Sm156";
-	my_pdg_to_string[1000621570] = "Sm157";
-	my_pdg_to_string[1000621580] = "Sm158";
-	my_pdg_to_string[1000621590] = "Sm159";
-	my_pdg_to_string[1000621600] = "Sm160";
-	my_pdg_to_string[1000621610] = "Sm161";
-	my_pdg_to_string[1000621620] = "Sm162";
-	my_pdg_to_string[1000621630] = "Sm163";
-	my_pdg_to_string[1000621640] = "Sm164";
-	my_pdg_to_string[1000621650] = "Sm165";
-	my_pdg_to_string[1000631300] = "Eu130";
-	my_pdg_to_string[1000631310] = "Eu131";
-	my_pdg_to_string[1000631340] = "Eu134";
-	my_pdg_to_string[1000631350] = "Eu135";
-	my_pdg_to_string[1000631361] = "Eu136[0.000]";
-	my_pdg_to_string[1000631370] = "Eu137";
-	my_pdg_to_string[1000631380] = "Eu138";
-	my_pdg_to_string[1000631390] = "Eu139";
-	my_pdg_to_string[1000631400] = "Eu140";
-	my_pdg_to_string[1000631410] = "Eu141";
-	my_pdg_to_string[1000631411] = "Eu141[96.450]";
-	my_pdg_to_string[1000631420] = "Eu142";
-	my_pdg_to_string[1000631430] = "Eu143";
-	my_pdg_to_string[1000631431] = "Eu143[389.510]";
-	my_pdg_to_string[1000631440] = "Eu144";
-	my_pdg_to_string[1000631450] = "Eu145";
-	my_pdg_to_string[1000631460] = "Eu146";
-	my_pdg_to_string[1000631461] = "Eu146[666.370]";
-	my_pdg_to_string[1000631470] = "Eu147";
-	my_pdg_to_string[1000631480] = "Eu148";
-	my_pdg_to_string[1000631490] = "Eu149";
-	my_pdg_to_string[1000631491] = "Eu149[496.386]";
-	my_pdg_to_string[1000631500] = "Eu150";
-	my_pdg_to_string[1000631501] = "Eu150[41.700]";
-	my_pdg_to_string[1000631510] = "Eu151";
-	my_pdg_to_string[1000631511] = "Eu151[196.245]";
-	my_pdg_to_string[1000631520] = "Eu152";
-	my_pdg_to_string[1000631521] = "Eu152[45.600]";
-	my_pdg_to_string[1000631522] = "Eu152[147.860]";
-	my_pdg_to_string[1000631530] = "Eu153";
-	my_pdg_to_string[1000631540] = "Eu154";
-	my_pdg_to_string[1000631541] = "Eu154[68.170]";
-	my_pdg_to_string[1000631542] = "Eu154[145.300]";
-	my_pdg_to_string[1000631550] = "Eu155";
-	my_pdg_to_string[1000631560] = "Eu156";
-	my_pdg_to_string[1000631570] = "Eu157";
-	my_pdg_to_string[1000631580] = "Eu158";
-	my_pdg_to_string[1000631590] = "Eu159";
-	my_pdg_to_string[1000631600] = "Eu160";
-	my_pdg_to_string[1000631610] = "Eu161";
-	my_pdg_to_string[1000631620] = "Eu162";
-	my_pdg_to_string[1000631630] = "Eu163";
-	my_pdg_to_string[1000631640] = "Eu164";
-	my_pdg_to_string[1000631650] = "Eu165";
-	my_pdg_to_string[1000631660] = "Eu166";
-	my_pdg_to_string[1000631670] = "Eu167";
-	my_pdg_to_string[1000641350] = "Gd135";
-	my_pdg_to_string[1000641360] = "Gd136";
-	my_pdg_to_string[1000641370] = "Gd137";
-	my_pdg_to_string[1000641380] = "Gd138";
-	my_pdg_to_string[1000641381] = "Gd138[2232.700]";
-	my_pdg_to_string[1000641390] = "Gd139";
-	my_pdg_to_string[1000641400] = "Gd140";
-	my_pdg_to_string[1000641410] = "Gd141";
-	my_pdg_to_string[1000641411] = "Gd141[377.760]";
-	my_pdg_to_string[1000641420] = "Gd142";
-	my_pdg_to_string[1000641430] = "Gd143";
-	my_pdg_to_string[1000641431] = "Gd143[152.600]";
-	my_pdg_to_string[1000641440] = "Gd144";
-	my_pdg_to_string[1000641450] = "Gd145";
-	my_pdg_to_string[1000641451] = "Gd145[749.100]";
-	my_pdg_to_string[1000641460] = "Gd146";
-	my_pdg_to_string[1000641470] = "Gd147";
-	my_pdg_to_string[1000641480] = "Gd148";
-	my_pdg_to_string[1000641490] = "Gd149";
-	my_pdg_to_string[1000641500] = "Gd150";
-	my_pdg_to_string[1000641510] = "Gd151";
-	my_pdg_to_string[1000641520] = "Gd152";
-	my_pdg_to_string[1000641530] = "Gd153";
-	my_pdg_to_string[1000641531] = "Gd153[95.174]";
-	my_pdg_to_string[1000641532] = "Gd153[171.188]";
-	my_pdg_to_string[1000641540] = "Gd154";
-	my_pdg_to_string[1000641550] = "Gd155";
-	my_pdg_to_string[1000641551] = "Gd155[121.050]";
-	my_pdg_to_string[1000641560] = "Gd156";
-	my_pdg_to_string[1000641561] = "Gd156[2137.600]";
-	my_pdg_to_string[1000641570] = "Gd157";
-	my_pdg_to_string[1000641571] = "Gd157[426.600]";
-	my_pdg_to_string[1000641580] = "Gd158";
-	my_pdg_to_string[1000641590] = "Gd159";
-	my_pdg_to_string[1000641600] = "Gd160";
-	my_pdg_to_string[1000641610] = "Gd161";
-	my_pdg_to_string[1000641620] = "Gd162";
-	my_pdg_to_string[1000641630] = "Gd163";
-	my_pdg_to_string[1000641640] = "Gd164";
-	my_pdg_to_string[1000641650] = "Gd165";
-	my_pdg_to_string[1000641660] = "Gd166";
-	my_pdg_to_string[1000641670] = "Gd167";
-	my_pdg_to_string[1000641680] = "Gd168";
-	my_pdg_to_string[1000641690] = "Gd169";
-	my_pdg_to_string[1000651350] = "Tb135";
-	my_pdg_to_string[1000651390] = "Tb139";
-	my_pdg_to_string[1000651400] = "Tb140";
-	my_pdg_to_string[1000651410] = "Tb141";
-	my_pdg_to_string[1000651420] = "Tb142";
-	my_pdg_to_string[1000651421] = "Tb142[279.700]";
-	my_pdg_to_string[1000651422] = "Tb142[652.100]";
-	my_pdg_to_string[1000651430] = "Tb143";
-	my_pdg_to_string[1000651440] = "Tb144";
-	my_pdg_to_string[1000651441] = "Tb144[396.900]";
-	my_pdg_to_string[1000651442] = "Tb144[476.200]";
-	my_pdg_to_string[1000651451] = "Tb145[0.000]";
-	my_pdg_to_string[1000651460] = "Tb146";
-	my_pdg_to_string[1000651462] = "Tb146[779.600]";
-	my_pdg_to_string[1000651470] = "Tb147";
-	my_pdg_to_string[1000651471] = "Tb147[50.600]";
-	my_pdg_to_string[1000651480] = "Tb148";
-	my_pdg_to_string[1000651481] = "Tb148[90.100]";
-	my_pdg_to_string[1000651482] = "Tb148[8618.600]";
-	my_pdg_to_string[1000651490] = "Tb149";
-	my_pdg_to_string[1000651491] = "Tb149[35.780]";
-	my_pdg_to_string[1000651500] = "Tb150";
-	my_pdg_to_string[1000651501] = "Tb150[461.000]";
-	my_pdg_to_string[1000651510] = "Tb151";
-	my_pdg_to_string[1000651511] = "Tb151[99.530]";
-	my_pdg_to_string[1000651520] = "Tb152";
-	my_pdg_to_string[1000651521] = "Tb152[501.740]";
-	my_pdg_to_string[1000651530] = "Tb153";
-	my_pdg_to_string[1000651531] = "Tb153[163.175]";
-	my_pdg_to_string[1000651540] = "Tb154";
-	my_pdg_to_string[1000651550] = "Tb155";
-	my_pdg_to_string[1000651560] = "Tb156";
-	my_pdg_to_string[1000651561] = "Tb156[49.630]";
-	my_pdg_to_string[1000651562] = "Tb156[88.400]";
-	my_pdg_to_string[1000651570] = "Tb157";
-	my_pdg_to_string[1000651580] = "Tb158";
-	my_pdg_to_string[1000651581] = "Tb158[110.300]";
-	my_pdg_to_string[1000651582] = "Tb158[388.400]";
-	my_pdg_to_string[1000651590] = "Tb159";
-	my_pdg_to_string[1000651600] = "Tb160";
-	my_pdg_to_string[1000651610] = "Tb161";
-	my_pdg_to_string[1000651620] = "Tb162";
-	my_pdg_to_string[1000651630] = "Tb163";
-	my_pdg_to_string[1000651640] = "Tb164";
-	my_pdg_to_string[1000651650] = "Tb165";
-	my_pdg_to_string[1000651660] = "Tb166";
-	my_pdg_to_string[1000651670] = "Tb167";
-	my_pdg_to_string[1000651680] = "Tb168";
-	my_pdg_to_string[1000651690] = "Tb169";
-	my_pdg_to_string[1000651700] = "Tb170";
-	my_pdg_to_string[1000651710] = "Tb171";
-	my_pdg_to_string[1000661390] = "Dy139";
-	my_pdg_to_string[1000661401] = "Dy140[2166.100]";
-	my_pdg_to_string[1000661410] = "Dy141";
-	my_pdg_to_string[1000661420] = "Dy142";
-	my_pdg_to_string[1000661430] = "Dy143";
-	my_pdg_to_string[1000661431] = "Dy143[310.700]";
-	my_pdg_to_string[1000661432] = "Dy143[405.700]";
-	my_pdg_to_string[1000661440] = "Dy144";
-	my_pdg_to_string[1000661450] = "Dy145";
-	my_pdg_to_string[1000661451] = "Dy145[118.200]";
-	my_pdg_to_string[1000661460] = "Dy146";
-	my_pdg_to_string[1000661461] = "Dy146[2935.700]";
-	my_pdg_to_string[1000661470] = "Dy147";
-	my_pdg_to_string[1000661471] = "Dy147[750.500]";
-	my_pdg_to_string[1000661480] = "Dy148";
-	my_pdg_to_string[1000661490] = "Dy149";
-	my_pdg_to_string[1000661491] = "Dy149[2661.100]";
-	my_pdg_to_string[1000661500] = "Dy150";
-	my_pdg_to_string[1000661510] = "Dy151";
-	my_pdg_to_string[1000661520] = "Dy152";
-	my_pdg_to_string[1000661530] = "Dy153";
-	my_pdg_to_string[1000661540] = "Dy154";
-	my_pdg_to_string[1000661550] = "Dy155";
-	my_pdg_to_string[1000661551] = "Dy155[234.330]";
-	my_pdg_to_string[1000661560] = "Dy156";
-	my_pdg_to_string[1000661570] = "Dy157";
-	my_pdg_to_string[1000661571] = "Dy157[161.990]";
-	my_pdg_to_string[1000661572] = "Dy157[199.380]";
-	my_pdg_to_string[1000661580] = "Dy158";
-	my_pdg_to_string[1000661590] = "Dy159";
-	my_pdg_to_string[1000661591] = "Dy159[352.770]";
-	my_pdg_to_string[1000661600] = "Dy160";
-	my_pdg_to_string[1000661610] = "Dy161";
-	my_pdg_to_string[1000661620] = "Dy162";
-	my_pdg_to_string[1000661630] = "Dy163";
-	my_pdg_to_string[1000661640] = "Dy164";
-	my_pdg_to_string[1000661650] = "Dy165";
-	my_pdg_to_string[1000661651] = "Dy165[108.155]";
-	my_pdg_to_string[1000661660] = "Dy166";
-	my_pdg_to_string[1000661670] = "Dy167";
-	my_pdg_to_string[1000661680] = "Dy168";
-	my_pdg_to_string[1000661690] = "Dy169";
-	my_pdg_to_string[1000661710] = "Dy171";
-	my_pdg_to_string[1000661720] = "Dy172";
-	my_pdg_to_string[1000661730] = "Dy173";
-	my_pdg_to_string[1000671400] = "Ho140";
-	my_pdg_to_string[1000671410] = "Ho141";
-	my_pdg_to_string[1000671411] = "Ho141[66.000]";
-	my_pdg_to_string[1000671420] = "Ho142";
-	my_pdg_to_string[1000671440] = "Ho144";
-	my_pdg_to_string[1000671450] = "Ho145";
-	my_pdg_to_string[1000671460] = "Ho146";
-	my_pdg_to_string[1000671470] = "Ho147";
-	my_pdg_to_string[1000671480] = "Ho148";
-	my_pdg_to_string[1000671482] = "Ho148[694.400]";
-	my_pdg_to_string[1000671490] = "Ho149";
-	my_pdg_to_string[1000671491] = "Ho149[48.800]";
-	my_pdg_to_string[1000671500] = "Ho150";
-	my_pdg_to_string[1000671510] = "Ho151";
-	my_pdg_to_string[1000671511] = "Ho151[41.000]";
-	my_pdg_to_string[1000671520] = "Ho152";
-	my_pdg_to_string[1000671521] = "Ho152[160.000]";
-	my_pdg_to_string[1000671522] = "Ho152[3019.590]";
-	my_pdg_to_string[1000671530] = "Ho153";
-	my_pdg_to_string[1000671531] = "Ho153[68.700]";
-	my_pdg_to_string[1000671540] = "Ho154";
-	my_pdg_to_string[1000671550] = "Ho155";
-	my_pdg_to_string[1000671551] = "Ho155[141.970]";
-	my_pdg_to_string[1000671560] = "Ho156";
-	my_pdg_to_string[1000671561] = "Ho156[52.370]";
-	my_pdg_to_string[1000671570] = "Ho157";
-	my_pdg_to_string[1000671580] = "Ho158";
-	my_pdg_to_string[1000671581] = "Ho158[67.199]";
-	my_pdg_to_string[1000671582] = "Ho158[180.000]";
-	my_pdg_to_string[1000671590] = "Ho159";
-	my_pdg_to_string[1000671591] = "Ho159[205.910]";
-	my_pdg_to_string[1000671600] = "Ho160";
-	my_pdg_to_string[1000671601] = "Ho160[59.980]";
-	my_pdg_to_string[1000671602] = "Ho160[169.600]";
-	my_pdg_to_string[1000671610] = "Ho161";
-	my_pdg_to_string[1000671611] = "Ho161[211.150]";
-	my_pdg_to_string[1000671620] = "Ho162";
-	my_pdg_to_string[1000671621] = "Ho162[105.870]";
-	my_pdg_to_string[1000671630] = "Ho163";
-	my_pdg_to_string[1000671631] = "Ho163[297.880]";
-	my_pdg_to_string[1000671640] = "Ho164";
-	my_pdg_to_string[1000671641] = "Ho164[139.770]";
-	my_pdg_to_string[1000671650] = "Ho165";
-	my_pdg_to_string[1000671651] = "Ho165[361.675]";
-	my_pdg_to_string[1000671660] = "Ho166";
-	my_pdg_to_string[1000671661] = "Ho166[5.969]";
-	my_pdg_to_string[1000671662] = "Ho166[190.902]";
-	my_pdg_to_string[1000671670] = "Ho167";
-	my_pdg_to_string[1000671671] = "Ho167[259.340]";
-	my_pdg_to_string[1000671680] = "Ho168";
-	my_pdg_to_string[1000671681] = "Ho168[59.000]";
-	my_pdg_to_string[1000671682] = "Ho168[143.430]";
-	my_pdg_to_string[1000671690] = "Ho169";
-	my_pdg_to_string[1000671700] = "Ho170";
-	my_pdg_to_string[1000671701] = "Ho170[120.000]";
-	my_pdg_to_string[1000671710] = "Ho171";
-	my_pdg_to_string[1000671720] = "Ho172";
-	my_pdg_to_string[1000671730] = "Ho173";
-	my_pdg_to_string[1000671740] = "Ho174";
-	my_pdg_to_string[1000671750] = "Ho175";
-	my_pdg_to_string[1000681440] = "Er144";
-	my_pdg_to_string[1000681451] = "Er145[253.000]";
-	my_pdg_to_string[1000681460] = "Er146";
-	my_pdg_to_string[1000681470] = "Er147";
-	my_pdg_to_string[1000681480] = "Er148";
-	my_pdg_to_string[1000681481] = "Er148[2913.200]";
-	my_pdg_to_string[1000681490] = "Er149";
-	my_pdg_to_string[1000681491] = "Er149[741.800]";
-	my_pdg_to_string[1000681492] = "Er149[3242.700]";
-	my_pdg_to_string[1000681500] = "Er150";
-	my_pdg_to_string[1000681501] = "Er150[2796.500]";
-	my_pdg_to_string[1000681510] = "Er151";
-	my_pdg_to_string[1000681511] = "Er151[2586.000]";
-	my_pdg_to_string[1000681520] = "Er152";
-	my_pdg_to_string[1000681530] = "Er153";
-	my_pdg_to_string[1000681540] = "Er154";
-	my_pdg_to_string[1000681550] = "Er155";
-	my_pdg_to_string[1000681560] = "Er156";
-	my_pdg_to_string[1000681570] = "Er157";
-	my_pdg_to_string[1000681571] = "Er157[155.400]";
-	my_pdg_to_string[1000681580] = "Er158";
-	my_pdg_to_string[1000681590] = "Er159";
-	my_pdg_to_string[1000681600] = "Er160";
-	my_pdg_to_string[1000681610] = "Er161";
-	my_pdg_to_string[1000681611] = "Er161[396.440]";
-	my_pdg_to_string[1000681620] = "Er162";
-	my_pdg_to_string[1000681630] = "Er163";
-	my_pdg_to_string[1000681640] = "Er164";
-	my_pdg_to_string[1000681650] = "Er165";
-	my_pdg_to_string[1000681660] = "Er166";
-	my_pdg_to_string[1000681670] = "Er167";
-	my_pdg_to_string[1000681671] = "Er167[207.801]";
-	my_pdg_to_string[1000681680] = "Er168";
-	my_pdg_to_string[1000681690] = "Er169";
-	my_pdg_to_string[1000681700] = "Er170";
-	my_pdg_to_string[1000681710] = "Er171";
-	my_pdg_to_string[1000681720] = "Er172";
-	my_pdg_to_string[1000681730] = "Er173";
-	my_pdg_to_string[1000681740] = "Er174";
-	my_pdg_to_string[1000681750] = "Er175";
-	my_pdg_to_string[1000681760] = "Er176";
-	my_pdg_to_string[1000681770] = "Er177";
-	my_pdg_to_string[1000691440] = "Tm144";
-	my_pdg_to_string[1000691450] = "Tm145";
-	my_pdg_to_string[1000691460] = "Tm146";
-	my_pdg_to_string[1000691461] = "Tm146[180.000]";
-	my_pdg_to_string[1000691470] = "Tm147";
-	my_pdg_to_string[1000691471] = "Tm147[68.000]";
-	my_pdg_to_string[1000691481] = "Tm148[0.000]";
-	my_pdg_to_string[1000691490] = "Tm149";
-	my_pdg_to_string[1000691500] = "Tm150";
-	my_pdg_to_string[1000691501] = "Tm150[671.300]";
-	my_pdg_to_string[1000691510] = "Tm151";
-	my_pdg_to_string[1000691520] = "Tm152";
-	my_pdg_to_string[1000691530] = "Tm153";
-	my_pdg_to_string[1000691531] = "Tm153[43.200]";
-	my_pdg_to_string[1000691540] = "Tm154";
-	my_pdg_to_string[1000691550] = "Tm155";
-	my_pdg_to_string[1000691551] = "Tm155[41.000]";
-	my_pdg_to_string[1000691560] = "Tm156";
-	my_pdg_to_string[1000691570] = "Tm157";
-	my_pdg_to_string[1000691580] = "Tm158";
-	my_pdg_to_string[1000691590] = "Tm159";
-	my_pdg_to_string[1000691600] = "Tm160";
-	my_pdg_to_string[1000691601] = "Tm160[70.000]";
-	my_pdg_to_string[1000691610] = "Tm161";
-	my_pdg_to_string[1000691620] = "Tm162";
-	my_pdg_to_string[1000691630] = "Tm163";
-	my_pdg_to_string[1000691640] = "Tm164";
-	my_pdg_to_string[1000691650] = "Tm165";
-	my_pdg_to_string[1000691651] = "Tm165[80.370]";
-	my_pdg_to_string[1000691652] = "Tm165[160.470]";
-	my_pdg_to_string[1000691660] = "Tm166";
-	my_pdg_to_string[1000691661] = "Tm166[109.338]";
-	my_pdg_to_string[1000691670] = "Tm167";
-	my_pdg_to_string[1000691671] = "Tm167[179.480]";
-	my_pdg_to_string[1000691680] = "Tm168";
-	my_pdg_to_string[1000691690] = "Tm169";
-	my_pdg_to_string[1000691700] = "Tm170";
-	my_pdg_to_string[1000691701] = "Tm170[183.197]";
-	my_pdg_to_string[1000691710] = "Tm171";
-	my_pdg_to_string[1000691711] = "Tm171[424.956]";
-	my_pdg_to_string[1000691720] = "Tm172";
-	my_pdg_to_string[1000691730] = "Tm173";
-	my_pdg_to_string[1000691731] = "Tm173[317.730]";
-	my_pdg_to_string[1000691740] = "Tm174";
-	my_pdg_to_string[1000691750] = "Tm175";
-	my_pdg_to_string[1000691760] = "Tm176";
-	my_pdg_to_string[1000691771] = "Tm177[0.000]";
-	my_pdg_to_string[1000691780] = "Tm178";
-	my_pdg_to_string[1000691790] = "Tm179";
-	my_pdg_to_string[1000701490] = "Yb149";
-	my_pdg_to_string[1000701500] = "Yb150";
-	my_pdg_to_string[1000701510] = "Yb151";
-	my_pdg_to_string[1000701512] = "Yb151[1791.200]";
-	my_pdg_to_string[1000701513] = "Yb151[2448.000]";
-	my_pdg_to_string[1000701520] = "Yb152";
-	my_pdg_to_string[1000701521] = "Yb152[2744.500]";
-	my_pdg_to_string[1000701530] = "Yb153";
-	my_pdg_to_string[1000701531] = "Yb153[2578.200]";
-	my_pdg_to_string[1000701540] = "Yb154";
-	my_pdg_to_string[1000701550] = "Yb155";
-	my_pdg_to_string[1000701560] = "Yb156";
-	my_pdg_to_string[1000701570] = "Yb157";
-	my_pdg_to_string[1000701580] = "Yb158";
-	my_pdg_to_string[1000701590] = "Yb159";
-	my_pdg_to_string[1000701600] = "Yb160";
-	my_pdg_to_string[1000701610] = "Yb161";
-	my_pdg_to_string[1000701620] = "Yb162";
-	my_pdg_to_string[1000701630] = "Yb163";
-	my_pdg_to_string[1000701640] = "Yb164";
-	my_pdg_to_string[1000701650] = "Yb165";
-	my_pdg_to_string[1000701660] = "Yb166";
-	my_pdg_to_string[1000701670] = "Yb167";
-	my_pdg_to_string[1000701680] = "Yb168";
-	my_pdg_to_string[1000701690] = "Yb169";
-	my_pdg_to_string[1000701691] = "Yb169[24.200]";
-	my_pdg_to_string[1000701700] = "Yb170";
-	my_pdg_to_string[1000701710] = "Yb171";
-	my_pdg_to_string[1000701711] = "Yb171[95.282]";
-	my_pdg_to_string[1000701720] = "Yb172";
-	my_pdg_to_string[1000701721] = "Yb172[1550.430]";
-	my_pdg_to_string[1000701730] = "Yb173";
-	my_pdg_to_string[1000701731] = "Yb173[398.900]";
-	my_pdg_to_string[1000701740] = "Yb174";
-	my_pdg_to_string[1000701741] = "Yb174[1518.148]";
-	my_pdg_to_string[1000701750] = "Yb175";
-	my_pdg_to_string[1000701751] = "Yb175[514.866]";
-	my_pdg_to_string[1000701760] = "Yb176";
-	my_pdg_to_string[1000701761] = "Yb176[1049.800]";
-	my_pdg_to_string[1000701770] = "Yb177";
-	my_pdg_to_string[1000701771] = "Yb177[331.500]";
-	my_pdg_to_string[1000701780] = "Yb178";
-	my_pdg_to_string[1000701790] = "Yb179";
-	my_pdg_to_string[1000701800] = "Yb180";
-	my_pdg_to_string[1000701810] = "Yb181";
-	my_pdg_to_string[1000711500] = "Lu150";
-	my_pdg_to_string[1000711501] = "Lu150[22.000]";
-	my_pdg_to_string[1000711510] = "Lu151";
-	my_pdg_to_string[1000711511] = "Lu151[78.000]";
-	my_pdg_to_string[1000711520] = "Lu152";
-	my_pdg_to_string[1000711530] = "Lu153";
-	my_pdg_to_string[1000711531] = "Lu153[2632.900]";
-	my_pdg_to_string[1000711541] = "Lu154[0.000]";
-	my_pdg_to_string[1000711542] = "Lu154[130.400]";
-	my_pdg_to_string[1000711550] = "Lu155";
-	my_pdg_to_string[1000711551] = "Lu155[20.000]";
-	my_pdg_to_string[1000711552] = "Lu155[1781.000]";
-	my_pdg_to_string[1000711560] = "Lu156";
-	my_pdg_to_string[1000711570] = "Lu157";
-	my_pdg_to_string[1000711571] = "Lu157[26.000]";
-	my_pdg_to_string[1000711580] = "Lu158";
-	my_pdg_to_string[1000711590] = "Lu159";
-	my_pdg_to_string[1000711600] = "Lu160";
-	my_pdg_to_string[1000711610] = "Lu161";
-	my_pdg_to_string[1000711611] = "Lu161[166.500]";
-	my_pdg_to_string[1000711620] = "Lu162";
-	my_pdg_to_string[1000711630] = "Lu163";
-	my_pdg_to_string[1000711640] = "Lu164";
-	my_pdg_to_string[1000711650] = "Lu165";
-	my_pdg_to_string[1000711660] = "Lu166";
-	my_pdg_to_string[1000711661] = "Lu166[34.370]";
-	my_pdg_to_string[1000711662] = "Lu166[43.000]";
-	my_pdg_to_string[1000711670] = "Lu167";
-	my_pdg_to_string[1000711680] = "Lu168";
-	my_pdg_to_string[1000711681] = "Lu168[202.810]";
-	my_pdg_to_string[1000711690] = "Lu169";
-	my_pdg_to_string[1000711691] = "Lu169[29.000]";
-	my_pdg_to_string[1000711700] = "Lu170";
-	my_pdg_to_string[1000711701] = "Lu170[92.910]";
-	my_pdg_to_string[1000711710] = "Lu171";
-	my_pdg_to_string[1000711711] = "Lu171[71.130]";
-	my_pdg_to_string[1000711720] = "Lu172";
-	my_pdg_to_string[1000711721] = "Lu172[41.860]";
-	my_pdg_to_string[1000711722] = "Lu172[109.410]";
-	my_pdg_to_string[1000711730] = "Lu173";
-	my_pdg_to_string[1000711731] = "Lu173[123.672]";
-	my_pdg_to_string[1000711740] = "Lu174";
-	my_pdg_to_string[1000711741] = "Lu174[170.830]";
-	my_pdg_to_string[1000711750] = "Lu175";
-	my_pdg_to_string[1000711751] = "Lu175[353.480]";
-	my_pdg_to_string[1000711752] = "Lu175[1392.200]";
-	my_pdg_to_string[1000711760] = "Lu176";
-	my_pdg_to_string[1000711761] = "Lu176[122.845]";
-	my_pdg_to_string[1000711762] = "Lu176[1587.500]";
-	my_pdg_to_string[1000711770] = "Lu177";
-	my_pdg_to_string[1000711771] = "Lu177[569.707]";
-	my_pdg_to_string[1000711772] = "Lu177[970.175]";
-	my_pdg_to_string[1000711773] = "Lu177[2700.000]";
-	my_pdg_to_string[1000711780] = "Lu178";
-	my_pdg_to_string[1000711781] = "Lu178[123.800]";
-	my_pdg_to_string[1000711790] = "Lu179";
-	my_pdg_to_string[1000711791] = "Lu179[592.400]";
-	my_pdg_to_string[1000711800] = "Lu180";
-	my_pdg_to_string[1000711801] = "Lu180[624.000]";
-	my_pdg_to_string[1000711810] = "Lu181";
-	my_pdg_to_string[1000711820] = "Lu182";
-	my_pdg_to_string[1000711830] = "Lu183";
-	my_pdg_to_string[1000711840] = "Lu184";
-	my_pdg_to_string[1000721530] = "Hf153";
-	my_pdg_to_string[1000721540] = "Hf154";
-	my_pdg_to_string[1000721541] = "Hf154[2671.000]";
-	my_pdg_to_string[1000721550] = "Hf155";
-	my_pdg_to_string[1000721560] = "Hf156";
-	my_pdg_to_string[1000721561] = "Hf156[1959.000]";
-	my_pdg_to_string[1000721570] = "Hf157";
-	my_pdg_to_string[1000721580] = "Hf158";
-	my_pdg_to_string[1000721590] = "Hf159";
-	my_pdg_to_string[1000721600] = "Hf160";
-	my_pdg_to_string[1000721610] = "Hf161";
-	my_pdg_to_string[1000721611] = "Hf161[329.000]";
-	my_pdg_to_string[1000721620] = "Hf162";
-	my_pdg_to_string[1000721630] = "Hf163";
-	my_pdg_to_string[1000721640] = "Hf164";
-	my_pdg_to_string[1000721650] = "Hf165";
-	my_pdg_to_string[1000721660] = "Hf166";
-	my_pdg_to_string[1000721670] = "Hf167";
-	my_pdg_to_string[1000721680] = "Hf168";
-	my_pdg_to_string[1000721690] = "Hf169";
-	my_pdg_to_string[1000721700] = "Hf170";
-	my_pdg_to_string[1000721710] = "Hf171";
-	my_pdg_to_string[1000721711] = "Hf171[21.930]";
-	my_pdg_to_string[1000721720] = "Hf172";
-	my_pdg_to_string[1000721730] = "Hf173";
-	my_pdg_to_string[1000721740] = "Hf174";
-	my_pdg_to_string[1000721741] = "Hf174[1797.500]";
-	my_pdg_to_string[1000721742] = "Hf174[3311.700]";
-	my_pdg_to_string[1000721750] = "Hf175";
-	my_pdg_to_string[1000721751] = "Hf175[125.890]";
-	my_pdg_to_string[1000721752] = "Hf175[1433.410]";
-	my_pdg_to_string[1000721753] = "Hf175[3015.600]";
-	my_pdg_to_string[1000721754] = "Hf175[4636.200]";
-	my_pdg_to_string[1000721760] = "Hf176";
-	my_pdg_to_string[1000721761] = "Hf176[1333.070]";
-	my_pdg_to_string[1000721762] = "Hf176[1559.310]";
-	my_pdg_to_string[1000721763] = "Hf176[2865.800]";
-	my_pdg_to_string[1000721764] = "Hf176[4863.500]";
-	my_pdg_to_string[1000721770] = "Hf177";
-	my_pdg_to_string[1000721771] = "Hf177[1315.450]";
-	my_pdg_to_string[1000721772] = "Hf177[1342.380]";
-	my_pdg_to_string[1000721773] = "Hf177[2740.020]";
-	my_pdg_to_string[1000721780] = "Hf178";
-	my_pdg_to_string[1000721781] = "Hf178[1147.416]";
-	my_pdg_to_string[1000721782] = "Hf178[2446.090]";
-	my_pdg_to_string[1000721783] = "Hf178[2572.400]";
-	my_pdg_to_string[1000721790] = "Hf179";
-	my_pdg_to_string[1000721791] = "Hf179[375.035]";
-	my_pdg_to_string[1000721792] = "Hf179[1105.740]";
-	my_pdg_to_string[1000721793] = "Hf179[3775.200]";
-	my_pdg_to_string[1000721800] = "Hf180";
-	my_pdg_to_string[1000721801] = "Hf180[1141.500]";
-	my_pdg_to_string[1000721802] = "Hf180[2425.800]";
-	my_pdg_to_string[1000721803] = "Hf180[2486.300]";
-	my_pdg_to_string[1000721804] = "Hf180[2538.300]";
-	my_pdg_to_string[1000721805] = "Hf180[3599.300]";
-	my_pdg_to_string[1000721810] = "Hf181";
-	my_pdg_to_string[1000721811] = "Hf181[1043.500]";
-	my_pdg_to_string[1000721812] = "Hf181[1741.900]";
-	my_pdg_to_string[1000721820] = "Hf182";
-	my_pdg_to_string[1000721821] = "Hf182[1172.870]";
-	my_pdg_to_string[1000721822] = "Hf182[2571.300]";
-	my_pdg_to_string[1000721830] = "Hf183";
-	my_pdg_to_string[1000721840] = "Hf184";
-	my_pdg_to_string[1000721841] = "Hf184[1272.200]";
-	my_pdg_to_string[1000721850] = "Hf185";
-	my_pdg_to_string[1000721860] = "Hf186";
-	my_pdg_to_string[1000721890] = "Hf189";
-	my_pdg_to_string[1000731551] = "Ta155[0.000]";
-	my_pdg_to_string[1000731560] = "Ta156";
-	my_pdg_to_string[1000731561] = "Ta156[102.000]";
-	my_pdg_to_string[1000731570] = "Ta157";
-	my_pdg_to_string[1000731571] = "Ta157[22.000]";
-	my_pdg_to_string[1000731572] = "Ta157[1589.000]";
-	my_pdg_to_string[1000731580] = "Ta158";
-	my_pdg_to_string[1000731581] = "Ta158[141.000]";
-	my_pdg_to_string[1000731590] = "Ta159";
-	my_pdg_to_string[1000731591] = "Ta159[64.000]";
-	my_pdg_to_string[1000731600] = "Ta160";
-	my_pdg_to_string[1000731611] = "Ta161[0.000]";
-	my_pdg_to_string[1000731620] = "Ta162";
-	my_pdg_to_string[1000731630] = "Ta163";
-	my_pdg_to_string[1000731640] = "Ta164";
-	my_pdg_to_string[1000731650] = "Ta165";
-	my_pdg_to_string[1000731660] = "Ta166";
-	my_pdg_to_string[1000731670] = "Ta167";
-	my_pdg_to_string[1000731680] = "Ta168";
-	my_pdg_to_string[1000731690] = "Ta169";
-	my_pdg_to_string[1000731700] = "Ta170";
-	my_pdg_to_string[1000731710] = "Ta171";
-	my_pdg_to_string[1000731720] = "Ta172";
-	my_pdg_to_string[1000731730] = "Ta173";
-	my_pdg_to_string[1000731740] = "Ta174";
-	my_pdg_to_string[1000731750] = "Ta175";
-	my_pdg_to_string[1000731751] = "Ta175[1567.600]";
-	my_pdg_to_string[1000731760] = "Ta176";
-	my_pdg_to_string[1000731761] = "Ta176[103.000]";
-	my_pdg_to_string[1000731762] = "Ta176[1371.000]";
-	my_pdg_to_string[1000731763] = "Ta176[2771.000]";
-	my_pdg_to_string[1000731770] = "Ta177";
-	my_pdg_to_string[1000731771] = "Ta177[186.150]";
-	my_pdg_to_string[1000731772] = "Ta177[1355.010]";
-	my_pdg_to_string[1000731773] = "Ta177[4656.300]";
-	my_pdg_to_string[1000731781] = "Ta178[0.000]";
-	my_pdg_to_string[1000731783] = "Ta178[1467.820]";
-	my_pdg_to_string[1000731784] = "Ta178[2902.200]";
-	my_pdg_to_string[1000731790] = "Ta179";
-	my_pdg_to_string[1000731791] = "Ta179[30.700]";
-	my_pdg_to_string[1000731792] = "Ta179[1317.200]";
-	my_pdg_to_string[1000731793] = "Ta179[1328.000]";
-	my_pdg_to_string[1000731794] = "Ta179[2639.500]";
-	my_pdg_to_string[1000731800] = "Ta180";
-	my_pdg_to_string[1000731801] = "Ta180[77.100]";
-	my_pdg_to_string[1000731802] = "Ta180[1452.400]";
-	my_pdg_to_string[1000731803] = "Ta180[3679.000]";
-	my_pdg_to_string[1000731804] = "Ta180[4171.000]";
-	my_pdg_to_string[1000731810] = "Ta181";
-	my_pdg_to_string[1000731811] = "Ta181[6.237]";
-	my_pdg_to_string[1000731812] = "Ta181[615.190]";
-	my_pdg_to_string[1000731813] = "Ta181[1483.430]";
-	my_pdg_to_string[1000731814] = "Ta181[2227.900]";
-	my_pdg_to_string[1000731820] = "Ta182";
-	my_pdg_to_string[1000731821] = "Ta182[16.273]";
-	my_pdg_to_string[1000731822] = "Ta182[519.577]";
-	my_pdg_to_string[1000731830] = "Ta183";
-	my_pdg_to_string[1000731840] = "Ta184";
-	my_pdg_to_string[1000731850] = "Ta185";
-	my_pdg_to_string[1000731851] = "Ta185[1258.500]";
-	my_pdg_to_string[1000731860] = "Ta186";
-	my_pdg_to_string[1000731900] = "Ta190";
-	my_pdg_to_string[1000731910] = "Ta191";
-	my_pdg_to_string[1000731920] = "Ta192";
-	my_pdg_to_string[1000741580] = "W158";
-	my_pdg_to_string[1000741581] = "W158[1888.000]";
-	my_pdg_to_string[1000741590] = "W159";
-	my_pdg_to_string[1000741600] = "W160";
-	my_pdg_to_string[1000741610] = "W161";
-	my_pdg_to_string[1000741620] = "W162";
-	my_pdg_to_string[1000741630] = "W163";
-	my_pdg_to_string[1000741640] = "W164";
-	my_pdg_to_string[1000741650] = "W165";
-	my_pdg_to_string[1000741660] = "W166";
-	my_pdg_to_string[1000741670] = "W167";
-	my_pdg_to_string[1000741680] = "W168";
-	my_pdg_to_string[1000741690] = "W169";
-	my_pdg_to_string[1000741700] = "W170";
-	my_pdg_to_string[1000741710] = "W171";
-	my_pdg_to_string[1000741720] = "W172";
-	my_pdg_to_string[1000741730] = "W173";
-	my_pdg_to_string[1000741740] = "W174";
-	my_pdg_to_string[1000741750] = "W175";
-	my_pdg_to_string[1000741760] = "W176";
-	my_pdg_to_string[1000741770] = "W177";
-	my_pdg_to_string[1000741780] = "W178";
-	my_pdg_to_string[1000741790] = "W179";
-	my_pdg_to_string[1000741791] = "W179[221.910]";
-	my_pdg_to_string[1000741800] = "W180";
-	my_pdg_to_string[1000741801] = "W180[1529.010]";
-	my_pdg_to_string[1000741802] = "W180[3264.560]";
-	my_pdg_to_string[1000741810] = "W181";
-	my_pdg_to_string[1000741811] = "W181[365.550]";
-	my_pdg_to_string[1000741820] = "W182";
-	my_pdg_to_string[1000741821] = "W182[2230.650]";
-	my_pdg_to_string[1000741830] = "W183";
-	my_pdg_to_string[1000741831] = "W183[309.493]";
-	my_pdg_to_string[1000741840] = "W184";
-	my_pdg_to_string[1000741841] = "W184[1284.997]";
-	my_pdg_to_string[1000741850] = "W185";
-	my_pdg_to_string[1000741851] = "W185[197.383]";
-	my_pdg_to_string[1000741860] = "W186";
-	my_pdg_to_string[1000741861] = "W186[1517.200]";
-	my_pdg_to_string[1000741862] = "W186[3542.800]";
-	my_pdg_to_string[1000741870] = "W187";
-	my_pdg_to_string[1000741871] = "W187[410.060]";
-	my_pdg_to_string[1000741880] = "W188";
-	my_pdg_to_string[1000741890] = "W189";
-	my_pdg_to_string[1000741900] = "W190";
-	my_pdg_to_string[1000741901] = "W190[2381.000]";
-	my_pdg_to_string[1000741930] = "W193";
-	my_pdg_to_string[1000741940] = "W194";
-	my_pdg_to_string[1000751591] = "Re159[0.000]";
-	my_pdg_to_string[1000751600] = "Re160";
-	my_pdg_to_string[1000751610] = "Re161";
-	my_pdg_to_string[1000751611] = "Re161[123.800]";
-	my_pdg_to_string[1000751620] = "Re162";
-	my_pdg_to_string[1000751621] = "Re162[173.000]";
-	my_pdg_to_string[1000751630] = "Re163";
-	my_pdg_to_string[1000751631] = "Re163[115.000]";
-	my_pdg_to_string[1000751640] = "Re164";
-	my_pdg_to_string[1000751650] = "Re165";
-	my_pdg_to_string[1000751651] = "Re165[48.000]";
-	my_pdg_to_string[1000751660] = "Re166";
-	my_pdg_to_string[1000751670] = "Re167";
-	my_pdg_to_string[1000751680] = "Re168";
-	my_pdg_to_string[1000751690] = "Re169";
-	my_pdg_to_string[1000751700] = "Re170";
-	my_pdg_to_string[1000751710] = "Re171";
-	my_pdg_to_string[1000751721] = "Re172[0.000]";
-	my_pdg_to_string[1000751730] = "Re173";
-	my_pdg_to_string[1000751740] = "Re174";
-	my_pdg_to_string[1000751750] = "Re175";
-	my_pdg_to_string[1000751760] = "Re176";
-	my_pdg_to_string[1000751770] = "Re177";
-	my_pdg_to_string[1000751771] = "Re177[84.710]";
-	my_pdg_to_string[1000751780] = "Re178";
-	my_pdg_to_string[1000751790] = "Re179";
-	my_pdg_to_string[1000751791] = "Re179[65.350]";
-	my_pdg_to_string[1000751792] = "Re179[5408.000]";
-	my_pdg_to_string[1000751800] = "Re180";
-	my_pdg_to_string[1000751810] = "Re181";
-	my_pdg_to_string[1000751811] = "Re181[1880.570]";
-	my_pdg_to_string[1000751812] = "Re181[3869.400]";
-	my_pdg_to_string[1000751820] = "Re182";
-	my_pdg_to_string[1000751830] = "Re183";
-	my_pdg_to_string[1000751831] = "Re183[1907.600]";
-	my_pdg_to_string[1000751840] = "Re184";
-	my_pdg_to_string[1000751841] = "Re184[188.046]";
-	my_pdg_to_string[1000751850] = "Re185";
-	my_pdg_to_string[1000751860] = "Re186";
-	my_pdg_to_string[1000751861] = "Re186[149.000]";
-	my_pdg_to_string[1000751870] = "Re187";
-	my_pdg_to_string[1000751880] = "Re188";
-	my_pdg_to_string[1000751881] = "Re188[172.069]";
-	my_pdg_to_string[1000751890] = "Re189";
-	my_pdg_to_string[1000751900] = "Re190";
-	my_pdg_to_string[1000751901] = "Re190[210.000]";
-	my_pdg_to_string[1000751910] = "Re191";
-	my_pdg_to_string[1000751920] = "Re192";
-	my_pdg_to_string[1000751921] = "Re192[160.100]";
-	my_pdg_to_string[1000751922] = "Re192[267.000]";
-	my_pdg_to_string[1000751931] = "Re193[146.000]";
-	my_pdg_to_string[1000751940] = "Re194";
-	my_pdg_to_string[1000751942] = "Re194[285.000]";
-	my_pdg_to_string[1000751943] = "Re194[833.000]";
-	my_pdg_to_string[1000751950] = "Re195";
-	my_pdg_to_string[1000751960] = "Re196";
-	my_pdg_to_string[1000751980] = "Re198";
-	my_pdg_to_string[1000761610] = "Os161";
-	my_pdg_to_string[1000761620] = "Os162";
-	my_pdg_to_string[1000761630] = "Os163";
-	my_pdg_to_string[1000761640] = "Os164";
-	my_pdg_to_string[1000761650] = "Os165";
-	my_pdg_to_string[1000761660] = "Os166";
-	my_pdg_to_string[1000761670] = "Os167";
-	my_pdg_to_string[1000761680] = "Os168";
-	my_pdg_to_string[1000761690] = "Os169";
-	my_pdg_to_string[1000761700] = "Os170";
-	my_pdg_to_string[1000761710] = "Os171";
-	my_pdg_to_string[1000761720] = "Os172";
-	my_pdg_to_string[1000761730] = "Os173";
-	my_pdg_to_string[1000761740] = "Os174";
-	my_pdg_to_string[1000761750] = "Os175";
-	my_pdg_to_string[1000761760] = "Os176";
-	my_pdg_to_string[1000761770] = "Os177";
-	my_pdg_to_string[1000761780] = "Os178";
-	my_pdg_to_string[1000761790] = "Os179";
-	my_pdg_to_string[1000761800] = "Os180";
-	my_pdg_to_string[1000761810] = "Os181";
-	my_pdg_to_string[1000761811] = "Os181[49.200]";
-	my_pdg_to_string[1000761820] = "Os182";
-	my_pdg_to_string[1000761821] = "Os182[1831.400]";
-	my_pdg_to_string[1000761830] = "Os183";
-	my_pdg_to_string[1000761831] = "Os183[170.710]";
-	my_pdg_to_string[1000761840] = "Os184";
-	my_pdg_to_string[1000761850] = "Os185";
-	my_pdg_to_string[1000761851] = "Os185[102.370]";
-	my_pdg_to_string[1000761860] = "Os186";
-	my_pdg_to_string[1000761870] = "Os187";
-	my_pdg_to_string[1000761871] = "Os187[257.100]";
-	my_pdg_to_string[1000761880] = "Os188";
-	my_pdg_to_string[1000761890] = "Os189";
-	my_pdg_to_string[1000761891] = "Os189[30.812]";
-	my_pdg_to_string[1000761900] = "Os190";
-	my_pdg_to_string[1000761901] = "Os190[1705.400]";
-	my_pdg_to_string[1000761910] = "Os191";
-	my_pdg_to_string[1000761911] = "Os191[74.382]";
-	my_pdg_to_string[1000761920] = "Os192";
-	my_pdg_to_string[1000761921] = "Os192[2015.400]";
-	my_pdg_to_string[1000761930] = "Os193";
-	my_pdg_to_string[1000761940] = "Os194";
-	my_pdg_to_string[1000761950] = "Os195";
-	my_pdg_to_string[1000761951] = "Os195[454.000]";
-	my_pdg_to_string[1000761960] = "Os196";
-	my_pdg_to_string[1000761970] = "Os197";
-	my_pdg_to_string[1000761990] = "Os199";
-	my_pdg_to_string[1000762000] = "Os200";
-	my_pdg_to_string[1000762010] = "Os201";
-	my_pdg_to_string[1000762020] = "Os202";
-	my_pdg_to_string[1000771641] = "Ir164[0.000]";
-	my_pdg_to_string[1000771650] = "Ir165";
-	my_pdg_to_string[1000771651] = "Ir165[180.000]";
-	my_pdg_to_string[1000771660] = "Ir166";
-	my_pdg_to_string[1000771661] = "Ir166[172.000]";
-	my_pdg_to_string[1000771670] = "Ir167";
-	my_pdg_to_string[1000771671] = "Ir167[175.300]";
-	my_pdg_to_string[1000771680] = "Ir168";
-	my_pdg_to_string[1000771690] = "Ir169";
-	my_pdg_to_string[1000771691] = "Ir169[153.000]";
-	my_pdg_to_string[1000771700] = "Ir170";
-	my_pdg_to_string[1000771710] = "Ir171";
-	my_pdg_to_string[1000771720] = "Ir172";
-	my_pdg_to_string[1000771721] = "Ir172[139.000]";
-	my_pdg_to_string[1000771731] = "Ir173[0.000]";
-	my_pdg_to_string[1000771740] = "Ir174";
-	my_pdg_to_string[1000771741] = "Ir174[193.000]";
-	my_pdg_to_string[1000771750] = "Ir175";
-	my_pdg_to_string[1000771760] = "Ir176";
-	my_pdg_to_string[1000771770] = "Ir177";
-	my_pdg_to_string[1000771780] = "Ir178";
-	my_pdg_to_string[1000771790] = "Ir179";
-	my_pdg_to_string[1000771800] = "Ir180";
-	my_pdg_to_string[1000771810] = "Ir181";
-	my_pdg_to_string[1000771820] = "Ir182";
-	my_pdg_to_string[1000771830] = "Ir183";
-	my_pdg_to_string[1000771840] = "Ir184";
-	my_pdg_to_string[1000771841] = "Ir184[225.650]";
-	my_pdg_to_string[1000771850] = "Ir185";
-	my_pdg_to_string[1000771860] = "Ir186";
-	my_pdg_to_string[1000771870] = "Ir187";
-	my_pdg_to_string[1000771871] = "Ir187[186.160]";
-	my_pdg_to_string[1000771880] = "Ir188";
-	my_pdg_to_string[1000771881] = "Ir188[923.500]";
-	my_pdg_to_string[1000771890] = "Ir189";
-	my_pdg_to_string[1000771891] = "Ir189[372.170]";
-	my_pdg_to_string[1000771892] = "Ir189[2333.200]";
-	my_pdg_to_string[1000771900] = "Ir190";
-	my_pdg_to_string[1000771901] = "Ir190[26.100]";
-	my_pdg_to_string[1000771902] = "Ir190[36.154]";
-	my_pdg_to_string[1000771903] = "Ir190[376.400]";
-	my_pdg_to_string[1000771910] = "Ir191";
-	my_pdg_to_string[1000771911] = "Ir191[171.290]";
-	my_pdg_to_string[1000771912] = "Ir191[2046.700]";
-	my_pdg_to_string[1000771920] = "Ir192";
-	my_pdg_to_string[1000771921] = "Ir192[56.720]";
-	my_pdg_to_string[1000771922] = "Ir192[168.140]";
-	my_pdg_to_string[1000771930] = "Ir193";
-	my_pdg_to_string[1000771931] = "Ir193[80.239]";
-	my_pdg_to_string[1000771940] = "Ir194";
-	my_pdg_to_string[1000771941] = "Ir194[147.072]";
-	my_pdg_to_string[1000771942] = "Ir194[190.000]";
-	my_pdg_to_string[1000771950] = "Ir195";
-	my_pdg_to_string[1000771951] = "Ir195[100.000]";
-	my_pdg_to_string[1000771960] = "Ir196";
-	my_pdg_to_string[1000771961] = "Ir196[410.000]";
-	my_pdg_to_string[1000771970] = "Ir197";
-	my_pdg_to_string[1000771971] = "Ir197[115.000]";
-	my_pdg_to_string[1000771980] = "Ir198";
-	my_pdg_to_string[1000771990] = "Ir199";
-	my_pdg_to_string[1000772000] = "Ir200";
-	my_pdg_to_string[1000772010] = "Ir201";
-	my_pdg_to_string[1000772020] = "Ir202";
-	my_pdg_to_string[1000772030] = "Ir203";
-	my_pdg_to_string[1000772040] = "Ir204";
-	my_pdg_to_string[1000781660] = "Pt166";
-	my_pdg_to_string[1000781670] = "Pt167";
-	my_pdg_to_string[1000781680] = "Pt168";
-	my_pdg_to_string[1000781690] = "Pt169";
-	my_pdg_to_string[1000781700] = "Pt170";
-	my_pdg_to_string[1000781710] = "Pt171";
-	my_pdg_to_string[1000781720] = "Pt172";
-	my_pdg_to_string[1000781730] = "Pt173";
-	my_pdg_to_string[1000781740] = "Pt174";
-	my_pdg_to_string[1000781750] = "Pt175";
-	my_pdg_to_string[1000781760] = "Pt176";
-	my_pdg_to_string[1000781770] = "Pt177";
-	my_pdg_to_string[1000781771] = "Pt177[147.400]";
-	my_pdg_to_string[1000781780] = "Pt178";
-	my_pdg_to_string[1000781790] = "Pt179";
-	my_pdg_to_string[1000781800] = "Pt180";
-	my_pdg_to_string[1000781810] = "Pt181";
-	my_pdg_to_string[1000781820] = "Pt182";
-	my_pdg_to_string[1000781830] = "Pt183";
-	my_pdg_to_string[1000781831] = "Pt183[34.500]";
-	my_pdg_to_string[1000781840] = "Pt184";
-	my_pdg_to_string[1000781841] = "Pt184[1840.300]";
-	my_pdg_to_string[1000781850] = "Pt185";
-	my_pdg_to_string[1000781851] = "Pt185[103.410]";
-	my_pdg_to_string[1000781860] = "Pt186";
-	my_pdg_to_string[1000781870] = "Pt187";
-	my_pdg_to_string[1000781871] = "Pt187[174.380]";
-	my_pdg_to_string[1000781880] = "Pt188";
-	my_pdg_to_string[1000781890] = "Pt189";
-	my_pdg_to_string[1000781891] = "Pt189[191.500]";
-	my_pdg_to_string[1000781900] = "Pt190";
-	my_pdg_to_string[1000781910] = "Pt191";
-	my_pdg_to_string[1000781911] = "Pt191[149.035]";
-	my_pdg_to_string[1000781920] = "Pt192";
-	my_pdg_to_string[1000781930] = "Pt193";
-	my_pdg_to_string[1000781940] = "Pt194";
-	my_pdg_to_string[1000781950] = "Pt195";
-	my_pdg_to_string[1000781951] = "Pt195[259.077]";
-	my_pdg_to_string[1000781960] = "Pt196";
-	my_pdg_to_string[1000781970] = "Pt197";
-	my_pdg_to_string[1000781971] = "Pt197[399.590]";
-	my_pdg_to_string[1000781980] = "Pt198";
-	my_pdg_to_string[1000781990] = "Pt199";
-	my_pdg_to_string[1000781991] = "Pt199[424.000]";
-	my_pdg_to_string[1000782000] = "Pt200";
-	my_pdg_to_string[1000782010] = "Pt201";
-	my_pdg_to_string[1000782020] = "Pt202";
-	my_pdg_to_string[1000782021] = "Pt202[1788.500]";
-	my_pdg_to_string[1000782030] = "Pt203";
-	my_pdg_to_string[1000782040] = "Pt204";
-	my_pdg_to_string[1000782041] = "Pt204[1995.000]";
-	my_pdg_to_string[1000782050] = "Pt205";
-	my_pdg_to_string[1000791700] = "Au170";
-	my_pdg_to_string[1000791701] = "Au170[275.000]";
-	my_pdg_to_string[1000791710] = "Au171";
-	my_pdg_to_string[1000791711] = "Au171[250.000]";
-	my_pdg_to_string[1000791720] = "Au172";
-	my_pdg_to_string[1000791730] = "Au173";
-	my_pdg_to_string[1000791731] = "Au173[214.000]";
-	my_pdg_to_string[1000791740] = "Au174";
-	my_pdg_to_string[1000791751] = "Au175[0.000]";
-	my_pdg_to_string[1000791761] = "Au176[0.000]";
-	my_pdg_to_string[1000791770] = "Au177";
-	my_pdg_to_string[1000791771] = "Au177[157.900]";
-	my_pdg_to_string[1000791780] = "Au178";
-	my_pdg_to_string[1000791790] = "Au179";
-	my_pdg_to_string[1000791791] = "Au179[86.000]";
-	my_pdg_to_string[1000791800] = "Au180";
-	my_pdg_to_string[1000791810] = "Au181";
-	my_pdg_to_string[1000791820] = "Au182";
-	my_pdg_to_string[1000791830] = "Au183";
-	my_pdg_to_string[1000791840] = "Au184";
-	my_pdg_to_string[1000791841] = "Au184[68.460]";
-	my_pdg_to_string[1000791850] = "Au185";
-	my_pdg_to_string[1000791860] = "Au186";
-	my_pdg_to_string[1000791870] = "Au187";
-	my_pdg_to_string[1000791871] = "Au187[120.330]";
-	my_pdg_to_string[1000791880] = "Au188";
-	my_pdg_to_string[1000791890] = "Au189";
-	my_pdg_to_string[1000791891] = "Au189[247.230]";
-	my_pdg_to_string[1000791900] = "Au190";
-	my_pdg_to_string[1000791910] = "Au191";
-	my_pdg_to_string[1000791911] = "Au191[266.200]";
-	my_pdg_to_string[1000791920] = "Au192";
-	my_pdg_to_string[1000791921] = "Au192[135.410]";
-	my_pdg_to_string[1000791922] = "Au192[431.600]";
-	my_pdg_to_string[1000791930] = "Au193";
-	my_pdg_to_string[1000791931] = "Au193[290.190]";
-	my_pdg_to_string[1000791940] = "Au194";
-	my_pdg_to_string[1000791941] = "Au194[107.400]";
-	my_pdg_to_string[1000791942] = "Au194[475.800]";
-	my_pdg_to_string[1000791950] = "Au195";
-	my_pdg_to_string[1000791951] = "Au195[318.580]";
-	my_pdg_to_string[1000791952] = "Au195[2460.840]";
-	my_pdg_to_string[1000791960] = "Au196";
-	my_pdg_to_string[1000791961] = "Au196[84.656]";
-	my_pdg_to_string[1000791962] = "Au196[595.660]";
-	my_pdg_to_string[1000791970] = "Au197";
-	my_pdg_to_string[1000791971] = "Au197[409.150]";
-	my_pdg_to_string[1000791980] = "Au198";
-	my_pdg_to_string[1000791981] = "Au198[811.700]";
-	my_pdg_to_string[1000791990] = "Au199";
-	my_pdg_to_string[1000791991] = "Au199[548.941]";
-	my_pdg_to_string[1000792000] = "Au200";
-	my_pdg_to_string[1000792001] = "Au200[962.000]";
-	my_pdg_to_string[1000792010] = "Au201";
-	my_pdg_to_string[1000792020] = "Au202";
-	my_pdg_to_string[1000792030] = "Au203";
-	my_pdg_to_string[1000792031] = "Au203[641.000]";
-	my_pdg_to_string[1000792040] = "Au204";
-	my_pdg_to_string[1000792041] = "Au204[976.600]";
-	my_pdg_to_string[1000792050] = "Au205";
-	my_pdg_to_string[1000792060] = "Au206";
-	my_pdg_to_string[1000792070] = "Au207";
-	my_pdg_to_string[1000792080] = "Au208";
-	my_pdg_to_string[1000792090] = "Au209";
-	my_pdg_to_string[1000792100] = "Au210";
-	my_pdg_to_string[1000801710] = "Hg171";
-	my_pdg_to_string[1000801720] = "Hg172";
-	my_pdg_to_string[1000801730] = "Hg173";
-	my_pdg_to_string[1000801740] = "Hg174";
-	my_pdg_to_string[1000801750] = "Hg175";
-	my_pdg_to_string[1000801760] = "Hg176";
-	my_pdg_to_string[1000801770] = "Hg177";
-	my_pdg_to_string[1000801780] = "Hg178";
-	my_pdg_to_string[1000801790] = "Hg179";
-	my_pdg_to_string[1000801791] = "Hg179[171.400]";
-	my_pdg_to_string[1000801800] = "Hg180";
-	my_pdg_to_string[1000801810] = "Hg181";
-	my_pdg_to_string[1000801820] = "Hg182";
-	my_pdg_to_string[1000801830] = "Hg183";
-	my_pdg_to_string[1000801840] = "Hg184";
-	my_pdg_to_string[1000801850] = "Hg185";
-	my_pdg_to_string[1000801851] = "Hg185[99.300]";
-	my_pdg_to_string[1000801860] = "Hg186";
-	my_pdg_to_string[1000801861] = "Hg186[2217.300]";
-	my_pdg_to_string[1000801870] = "Hg187";
-	my_pdg_to_string[1000801880] = "Hg188";
-	my_pdg_to_string[1000801890] = "Hg189";
-	my_pdg_to_string[1000801900] = "Hg190";
-	my_pdg_to_string[1000801910] = "Hg191";
-	my_pdg_to_string[1000801920] = "Hg192";
-	my_pdg_to_string[1000801930] = "Hg193";
-	my_pdg_to_string[1000801931] = "Hg193[140.760]";
-	my_pdg_to_string[1000801940] = "Hg194";
-	my_pdg_to_string[1000801950] = "Hg195";
-	my_pdg_to_string[1000801951] = "Hg195[176.070]";
-	my_pdg_to_string[1000801960] = "Hg196";
-	my_pdg_to_string[1000801970] = "Hg197";
-	my_pdg_to_string[1000801971] = "Hg197[298.930]";
-	my_pdg_to_string[1000801980] = "Hg198";
-	my_pdg_to_string[1000801990] = "Hg199";
-	my_pdg_to_string[1000801991] = "Hg199[532.480]";
-	my_pdg_to_string[1000802000] = "Hg200";
-	my_pdg_to_string[1000802010] = "Hg201";
-	my_pdg_to_string[1000802011] = "Hg201[766.220]";
-	my_pdg_to_string[1000802020] = "Hg202";
-	my_pdg_to_string[1000802030] = "Hg203";
-	my_pdg_to_string[1000802031] = "Hg203[933.140]";
-	my_pdg_to_string[1000802040] = "Hg204";
-	my_pdg_to_string[1000802050] = "Hg205";
-	my_pdg_to_string[1000802051] = "Hg205[1556.400]";
-	my_pdg_to_string[1000802060] = "Hg206";
-	my_pdg_to_string[1000802061] = "Hg206[2102.400]";
-	my_pdg_to_string[1000802070] = "Hg207";
-	my_pdg_to_string[1000802080] = "Hg208";
-	my_pdg_to_string[1000802090] = "Hg209";
-	my_pdg_to_string[1000802101] = "Hg210[663.000]";
-	my_pdg_to_string[1000802102] = "Hg210[1366.000]";
-	my_pdg_to_string[1000802110] = "Hg211";
-	my_pdg_to_string[1000802120] = "Hg212";
-	my_pdg_to_string[1000802130] = "Hg213";
-	my_pdg_to_string[1000802140] = "Hg214";
-	my_pdg_to_string[1000802150] = "Hg215";
-	my_pdg_to_string[1000802160] = "Hg216";
-	my_pdg_to_string[1000811760] = "Tl176";
-	my_pdg_to_string[1000811770] = "Tl177";
-	my_pdg_to_string[1000811771] = "Tl177[807.000]";
-	my_pdg_to_string[1000811780] = "Tl178";
-	my_pdg_to_string[1000811790] = "Tl179";
-	my_pdg_to_string[1000811800] = "Tl180";
-	my_pdg_to_string[1000811810] = "Tl181";
-	my_pdg_to_string[1000811811] = "Tl181[835.900]";
-	my_pdg_to_string[1000811820] = "Tl182";
-	my_pdg_to_string[1000811830] = "Tl183";
-	my_pdg_to_string[1000811831] = "Tl183[630.000]";
-	my_pdg_to_string[1000811832] = "Tl183[976.800]";
-	my_pdg_to_string[1000811840] = "Tl184";
-	my_pdg_to_string[1000811850] = "Tl185";
-	my_pdg_to_string[1000811851] = "Tl185[454.800]";
-	my_pdg_to_string[1000811861] = "Tl186[0.000]";
-	my_pdg_to_string[1000811862] = "Tl186[374.000]";
-	my_pdg_to_string[1000811870] = "Tl187";
-	my_pdg_to_string[1000811871] = "Tl187[334.000]";
-	my_pdg_to_string[1000811872] = "Tl187[1434.230]";
-	my_pdg_to_string[1000811881] = "Tl188[0.000]";
-	my_pdg_to_string[1000811883] = "Tl188[268.800]";
-	my_pdg_to_string[1000811890] = "Tl189";
-	my_pdg_to_string[1000811891] = "Tl189[281.000]";
-	my_pdg_to_string[1000811901] = "Tl190[0.000]";
-	my_pdg_to_string[1000811903] = "Tl190[161.900]";
-	my_pdg_to_string[1000811911] = "Tl191[0.000]";
-	my_pdg_to_string[1000811920] = "Tl192";
-	my_pdg_to_string[1000811921] = "Tl192[138.000]";
-	my_pdg_to_string[1000811930] = "Tl193";
-	my_pdg_to_string[1000811931] = "Tl193[365.200]";
-	my_pdg_to_string[1000811940] = "Tl194";
-	my_pdg_to_string[1000811950] = "Tl195";
-	my_pdg_to_string[1000811951] = "Tl195[482.630]";
-	my_pdg_to_string[1000811960] = "Tl196";
-	my_pdg_to_string[1000811961] = "Tl196[394.200]";
-	my_pdg_to_string[1000811970] = "Tl197";
-	my_pdg_to_string[1000811971] = "Tl197[608.220]";
-	my_pdg_to_string[1000811980] = "Tl198";
-	my_pdg_to_string[1000811981] = "Tl198[543.600]";
-	my_pdg_to_string[1000811982] = "Tl198[742.400]";
-	my_pdg_to_string[1000811990] = "Tl199";
-	my_pdg_to_string[1000811991] = "Tl199[748.870]";
-	my_pdg_to_string[1000812000] = "Tl200";
-	my_pdg_to_string[1000812001] = "Tl200[753.600]";
-	my_pdg_to_string[1000812010] = "Tl201";
-	my_pdg_to_string[1000812011] = "Tl201[919.160]";
-	my_pdg_to_string[1000812020] = "Tl202";
-	my_pdg_to_string[1000812021] = "Tl202[950.190]";
-	my_pdg_to_string[1000812030] = "Tl203";
-	my_pdg_to_string[1000812031] = "Tl203[3514.600]";
-	my_pdg_to_string[1000812040] = "Tl204";
-	my_pdg_to_string[1000812041] = "Tl204[1103.900]";
-	my_pdg_to_string[1000812042] = "Tl204[2318.800]";
-	my_pdg_to_string[1000812050] = "Tl205";
-	my_pdg_to_string[1000812051] = "Tl205[3290.600]";
-	my_pdg_to_string[1000812060] = "Tl206";
-	my_pdg_to_string[1000812061] = "Tl206[2643.100]";
-	my_pdg_to_string[1000812070] = "Tl207";
-	my_pdg_to_string[1000812071] = "Tl207[1348.180]";
-	my_pdg_to_string[1000812080] = "Tl208";
-	my_pdg_to_string[1000812090] = "Tl209";
-	my_pdg_to_string[1000812100] = "Tl210";
-	my_pdg_to_string[1000812110] = "Tl211";
-	my_pdg_to_string[1000812120] = "Tl212";
-	my_pdg_to_string[1000812130] = "Tl213";
-	my_pdg_to_string[1000812140] = "Tl214";
-	my_pdg_to_string[1000812150] = "Tl215";
-	my_pdg_to_string[1000812160] = "Tl216";
-	my_pdg_to_string[1000812170] = "Tl217";
-	my_pdg_to_string[1000821780] = "Pb178";
-	my_pdg_to_string[1000821790] = "Pb179";
-	my_pdg_to_string[1000821800] = "Pb180";
-	my_pdg_to_string[1000821811] = "Pb181[0.000]";
-	my_pdg_to_string[1000821820] = "Pb182";
-	my_pdg_to_string[1000821830] = "Pb183";
-	my_pdg_to_string[1000821831] = "Pb183[97.000]";
-	my_pdg_to_string[1000821840] = "Pb184";
-	my_pdg_to_string[1000821850] = "Pb185";
-	my_pdg_to_string[1000821860] = "Pb186";
-	my_pdg_to_string[1000821870] = "Pb187";
-	my_pdg_to_string[1000821871] = "Pb187[33.000]";
-	my_pdg_to_string[1000821880] = "Pb188";
-	my_pdg_to_string[1000821890] = "Pb189";
-	my_pdg_to_string[1000821892] = "Pb189[2434.500]";
-	my_pdg_to_string[1000821900] = "Pb190";
-	my_pdg_to_string[1000821901] = "Pb190[2615.000]";
-	my_pdg_to_string[1000821902] = "Pb190[2658.200]";
-	my_pdg_to_string[1000821910] = "Pb191";
-	my_pdg_to_string[1000821920] = "Pb192";
-	my_pdg_to_string[1000821921] = "Pb192[2624.000]";
-	my_pdg_to_string[1000821931] = "Pb193[0.000]";
-	my_pdg_to_string[1000821940] = "Pb194";
-	my_pdg_to_string[1000821950] = "Pb195";
-	my_pdg_to_string[1000821951] = "Pb195[202.900]";
-	my_pdg_to_string[1000821952] = "Pb195[1759.000]";
-	my_pdg_to_string[1000821960] = "Pb196";
-	my_pdg_to_string[1000821970] = "Pb197";
-	my_pdg_to_string[1000821971] = "Pb197[319.310]";
-	my_pdg_to_string[1000821972] = "Pb197[1914.100]";
-	my_pdg_to_string[1000821980] = "Pb198";
-	my_pdg_to_string[1000821981] = "Pb198[2141.400]";
-	my_pdg_to_string[1000821990] = "Pb199";
-	my_pdg_to_string[1000821991] = "Pb199[424.800]";
-	my_pdg_to_string[1000821992] = "Pb199[2559.100]";
-	my_pdg_to_string[1000822000] = "Pb200";
-	my_pdg_to_string[1000822010] = "Pb201";
-	my_pdg_to_string[1000822011] = "Pb201[629.100]";
-	my_pdg_to_string[1000822020] = "Pb202";
-	my_pdg_to_string[1000822021] = "Pb202[2169.850]";
-	my_pdg_to_string[1000822030] = "Pb203";
-	my_pdg_to_string[1000822031] = "Pb203[825.200]";
-	my_pdg_to_string[1000822032] = "Pb203[2949.200]";
-	my_pdg_to_string[1000822040] = "Pb204";
-	my_pdg_to_string[1000822041] = "Pb204[2185.880]";
-	my_pdg_to_string[1000822050] = "Pb205";
-	my_pdg_to_string[1000822051] = "Pb205[2.329]";
-	my_pdg_to_string[1000822052] = "Pb205[1013.850]";
-	my_pdg_to_string[1000822060] = "Pb206";
-	my_pdg_to_string[1000822061] = "Pb206[2200.160]";
-	my_pdg_to_string[1000822070] = "Pb207";
-	my_pdg_to_string[1000822071] = "Pb207[1633.356]";
-	my_pdg_to_string[1000822080] = "Pb208";
-	my_pdg_to_string[1000822090] = "Pb209";
-	my_pdg_to_string[1000822100] = "Pb210";
-	my_pdg_to_string[1000822110] = "Pb211";
-	my_pdg_to_string[1000822120] = "Pb212";
-	my_pdg_to_string[1000822130] = "Pb213";
-	my_pdg_to_string[1000822140] = "Pb214";
-	my_pdg_to_string[1000822141] = "Pb214[1365.000]";
-	my_pdg_to_string[1000822150] = "Pb215";
-	my_pdg_to_string[1000822160] = "Pb216";
-	my_pdg_to_string[1000822170] = "Pb217";
-	my_pdg_to_string[1000822180] = "Pb218";
-	my_pdg_to_string[1000822190] = "Pb219";
-	my_pdg_to_string[1000822200] = "Pb220";
-	my_pdg_to_string[1000831841] = "Bi184[0.000]";
-	my_pdg_to_string[1000831850] = "Bi185";
-	my_pdg_to_string[1000831860] = "Bi186";
-	my_pdg_to_string[1000831870] = "Bi187";
-	my_pdg_to_string[1000831871] = "Bi187[112.000]";
-	my_pdg_to_string[1000831872] = "Bi187[252.000]";
-	my_pdg_to_string[1000831881] = "Bi188[0.000]";
-	my_pdg_to_string[1000831890] = "Bi189";
-	my_pdg_to_string[1000831891] = "Bi189[184.000]";
-	my_pdg_to_string[1000831892] = "Bi189[357.600]";
-	my_pdg_to_string[1000831901] = "Bi190[0.000]";
-	my_pdg_to_string[1000831910] = "Bi191";
-	my_pdg_to_string[1000831911] = "Bi191[241.000]";
-	my_pdg_to_string[1000831920] = "Bi192";
-	my_pdg_to_string[1000831921] = "Bi192[147.000]";
-	my_pdg_to_string[1000831930] = "Bi193";
-	my_pdg_to_string[1000831931] = "Bi193[308.000]";
-	my_pdg_to_string[1000831932] = "Bi193[2357.000]";
-	my_pdg_to_string[1000831940] = "Bi194";
-	my_pdg_to_string[1000831950] = "Bi195";
-	my_pdg_to_string[1000831951] = "Bi195[401.000]";
-	my_pdg_to_string[1000831960] = "Bi196";
-	my_pdg_to_string[1000831961] = "Bi196[169.000]";
-	my_pdg_to_string[1000831962] = "Bi196[271.000]";
-	my_pdg_to_string[1000831970] = "Bi197";
-	my_pdg_to_string[1000831971] = "Bi197[500.000]";
-	my_pdg_to_string[1000831980] = "Bi198";
-	my_pdg_to_string[1000831982] = "Bi198[248.500]";
-	my_pdg_to_string[1000831990] = "Bi199";
-	my_pdg_to_string[1000831991] = "Bi199[667.000]";
-	my_pdg_to_string[1000832000] = "Bi200";
-	my_pdg_to_string[1000832002] = "Bi200[428.200]";
-	my_pdg_to_string[1000832010] = "Bi201";
-	my_pdg_to_string[1000832011] = "Bi201[846.350]";
-	my_pdg_to_string[1000832020] = "Bi202";
-	my_pdg_to_string[1000832021] = "Bi202[605.000]";
-	my_pdg_to_string[1000832030] = "Bi203";
-	my_pdg_to_string[1000832031] = "Bi203[1098.120]";
-	my_pdg_to_string[1000832040] = "Bi204";
-	my_pdg_to_string[1000832041] = "Bi204[805.500]";
-	my_pdg_to_string[1000832042] = "Bi204[2833.400]";
-	my_pdg_to_string[1000832050] = "Bi205";
-	my_pdg_to_string[1000832051] = "Bi205[1497.170]";
-	my_pdg_to_string[1000832060] = "Bi206";
-	my_pdg_to_string[1000832061] = "Bi206[59.897]";
-	my_pdg_to_string[1000832062] = "Bi206[1044.800]";
-	my_pdg_to_string[1000832070] = "Bi207";
-	my_pdg_to_string[1000832071] = "Bi207[2101.610]";
-	my_pdg_to_string[1000832080] = "Bi208";
-	my_pdg_to_string[1000832081] = "Bi208[1571.100]";
-	my_pdg_to_string[1000832090] = "Bi209";
-	my_pdg_to_string[1000832100] = "Bi210";
-	my_pdg_to_string[1000832101] = "Bi210[271.310]";
-	my_pdg_to_string[1000832110] = "Bi211";
-	my_pdg_to_string[1000832111] = "Bi211[1257.000]";
-	my_pdg_to_string[1000832120] = "Bi212";
-	my_pdg_to_string[1000832121] = "Bi212[250.000]";
-	my_pdg_to_string[1000832122] = "Bi212[1910.000]";
-	my_pdg_to_string[1000832130] = "Bi213";
-	my_pdg_to_string[1000832140] = "Bi214";
-	my_pdg_to_string[1000832150] = "Bi215";
-	my_pdg_to_string[1000832151] = "Bi215[1347.500]";
-	my_pdg_to_string[1000832160] = "Bi216";
-	my_pdg_to_string[1000832170] = "Bi217";
-	my_pdg_to_string[1000832171] = "Bi217[1436.000]";
-	my_pdg_to_string[1000832180] = "Bi218";
-	my_pdg_to_string[1000832190] = "Bi219";
-	my_pdg_to_string[1000832200] = "Bi220";
-	my_pdg_to_string[1000832210] = "Bi221";
-	my_pdg_to_string[1000832230] = "Bi223";
-	my_pdg_to_string[1000832240] = "Bi224";
-	my_pdg_to_string[1000841860] = "Po186";
-	my_pdg_to_string[1000841870] = "Po187";
-	my_pdg_to_string[1000841880] = "Po188";
-	my_pdg_to_string[1000841890] = "Po189";
-	my_pdg_to_string[1000841900] = "Po190";
-	my_pdg_to_string[1000841910] = "Po191";
-	my_pdg_to_string[1000841911] = "Po191[40.000]";
-	my_pdg_to_string[1000841920] = "Po192";
-	my_pdg_to_string[1000841931] = "Po193[0.000]";
-	my_pdg_to_string[1000841940] = "Po194";
-	my_pdg_to_string[1000841941] = "Po194[2525.200]";
-	my_pdg_to_string[1000841950] = "Po195";
-	my_pdg_to_string[1000841951] = "Po195[230.000]";
-	my_pdg_to_string[1000841960] = "Po196";
-	my_pdg_to_string[1000841970] = "Po197";
-	my_pdg_to_string[1000841971] = "Po197[204.000]";
-	my_pdg_to_string[1000841980] = "Po198";
-	my_pdg_to_string[1000841990] = "Po199";
-	my_pdg_to_string[1000841991] = "Po199[310.000]";
-	my_pdg_to_string[1000842000] = "Po200";
-	my_pdg_to_string[1000842010] = "Po201";
-	my_pdg_to_string[1000842011] = "Po201[424.100]";
-	my_pdg_to_string[1000842020] = "Po202";
-	my_pdg_to_string[1000842030] = "Po203";
-	my_pdg_to_string[1000842031] = "Po203[641.680]";
-	my_pdg_to_string[1000842040] = "Po204";
-	my_pdg_to_string[1000842050] = "Po205";
-	my_pdg_to_string[1000842051] = "Po205[880.310]";
-	my_pdg_to_string[1000842052] = "Po205[1461.210]";
-	my_pdg_to_string[1000842060] = "Po206";
-	my_pdg_to_string[1000842061] = "Po206[2262.090]";
-	my_pdg_to_string[1000842070] = "Po207";
-	my_pdg_to_string[1000842071] = "Po207[1115.076]";
-	my_pdg_to_string[1000842072] = "Po207[1383.160]";
-	my_pdg_to_string[1000842080] = "Po208";
-	my_pdg_to_string[1000842090] = "Po209";
-	my_pdg_to_string[1000842100] = "Po210";
-	my_pdg_to_string[1000842110] = "Po211";
-	my_pdg_to_string[1000842111] = "Po211[1462.000]";
-	my_pdg_to_string[1000842112] = "Po211[4872.000]";
-	my_pdg_to_string[1000842120] = "Po212";
-	my_pdg_to_string[1000842121] = "Po212[2922.000]";
-	my_pdg_to_string[1000842130] = "Po213";
-	my_pdg_to_string[1000842140] = "Po214";
-	my_pdg_to_string[1000842150] = "Po215";
-	my_pdg_to_string[1000842160] = "Po216";
-	my_pdg_to_string[1000842170] = "Po217";
-	my_pdg_to_string[1000842180] = "Po218";
-	my_pdg_to_string[1000842190] = "Po219";
-	my_pdg_to_string[1000842200] = "Po220";
-	my_pdg_to_string[1000842210] = "Po221";
-	my_pdg_to_string[1000842220] = "Po222";
-	my_pdg_to_string[1000842230] = "Po223";
-	my_pdg_to_string[1000842240] = "Po224";
-	my_pdg_to_string[1000842250] = "Po225";
-	my_pdg_to_string[1000842260] = "Po226";
-	my_pdg_to_string[1000842270] = "Po227";
-	my_pdg_to_string[1000851910] = "At191";
-	my_pdg_to_string[1000851911] = "At191[55.000]";
-	my_pdg_to_string[1000851921] = "At192[0.000]";
-	my_pdg_to_string[1000851930] = "At193";
-	my_pdg_to_string[1000851931] = "At193[5.000]";
-	my_pdg_to_string[1000851932] = "At193[39.000]";
-	my_pdg_to_string[1000851941] = "At194[0.000]";
-	my_pdg_to_string[1000851950] = "At195";
-	my_pdg_to_string[1000851951] = "At195[33.000]";
-	my_pdg_to_string[1000851960] = "At196";
-	my_pdg_to_string[1000851961] = "At196[157.900]";
-	my_pdg_to_string[1000851970] = "At197";
-	my_pdg_to_string[1000851971] = "At197[52.000]";
-	my_pdg_to_string[1000851980] = "At198";
-	my_pdg_to_string[1000851981] = "At198[102.000]";
-	my_pdg_to_string[1000851990] = "At199";
-	my_pdg_to_string[1000852000] = "At200";
-	my_pdg_to_string[1000852001] = "At200[112.000]";
-	my_pdg_to_string[1000852002] = "At200[344.000]";
-	my_pdg_to_string[1000852010] = "At201";
-	my_pdg_to_string[1000852020] = "At202";
-	my_pdg_to_string[1000852022] = "At202[391.700]";
-	my_pdg_to_string[1000852030] = "At203";
-	my_pdg_to_string[1000852040] = "At204";
-	my_pdg_to_string[1000852041] = "At204[587.300]";
-	my_pdg_to_string[1000852050] = "At205";
-	my_pdg_to_string[1000852051] = "At205[2339.650]";
-	my_pdg_to_string[1000852060] = "At206";
-	my_pdg_to_string[1000852070] = "At207";
-	my_pdg_to_string[1000852080] = "At208";
-	my_pdg_to_string[1000852081] = "At208[2276.400]";
-	my_pdg_to_string[1000852090] = "At209";
-	my_pdg_to_string[1000852100] = "At210";
-	my_pdg_to_string[1000852101] = "At210[4027.700]";
-	my_pdg_to_string[1000852110] = "At211";
-	my_pdg_to_string[1000852111] = "At211[4814.500]";
-	my_pdg_to_string[1000852120] = "At212";
-	my_pdg_to_string[1000852121] = "At212[223.000]";
-	my_pdg_to_string[1000852122] = "At212[4771.600]";
-	my_pdg_to_string[1000852130] = "At213";
-	my_pdg_to_string[1000852131] = "At213[2926.000]";
-	my_pdg_to_string[1000852140] = "At214";
-	my_pdg_to_string[1000852150] = "At215";
-	my_pdg_to_string[1000852160] = "At216";
-	my_pdg_to_string[1000852161] = "At216[413.000]";
-	my_pdg_to_string[1000852170] = "At217";
-	my_pdg_to_string[1000852180] = "At218";
-	my_pdg_to_string[1000852190] = "At219";
-	my_pdg_to_string[1000852200] = "At220";
-	my_pdg_to_string[1000852210] = "At221";
-	my_pdg_to_string[1000852220] = "At222";
-	my_pdg_to_string[1000852230] = "At223";
-	my_pdg_to_string[1000852240] = "At224";
-	my_pdg_to_string[1000852250] = "At225";
-	my_pdg_to_string[1000852260] = "At226";
-	my_pdg_to_string[1000852270] = "At227";
-	my_pdg_to_string[1000852280] = "At228";
-	my_pdg_to_string[1000852290] = "At229";
-	my_pdg_to_string[1000861940] = "Rn194";
-	my_pdg_to_string[1000861950] = "Rn195";
-	my_pdg_to_string[1000861951] = "Rn195[59.000]";
-	my_pdg_to_string[1000861960] = "Rn196";
-	my_pdg_to_string[1000861970] = "Rn197";
-	my_pdg_to_string[1000861980] = "Rn198";
-	my_pdg_to_string[1000861990] = "Rn199";
-	my_pdg_to_string[1000861991] = "Rn199[180.000]";
-	my_pdg_to_string[1000862000] = "Rn200";
-	my_pdg_to_string[1000862001] = "Rn200[2300.500]";
-	my_pdg_to_string[1000862010] = "Rn201";
-	my_pdg_to_string[1000862020] = "Rn202";
-	my_pdg_to_string[1000862030] = "Rn203";
-	my_pdg_to_string[1000862031] = "Rn203[362.000]";
-	my_pdg_to_string[1000862040] = "Rn204";
-	my_pdg_to_string[1000862050] = "Rn205";
-	my_pdg_to_string[1000862060] = "Rn206";
-	my_pdg_to_string[1000862070] = "Rn207";
-	my_pdg_to_string[1000862071] = "Rn207[899.100]";
-	my_pdg_to_string[1000862080] = "Rn208";
-	my_pdg_to_string[1000862090] = "Rn209";
-	my_pdg_to_string[1000862091] = "Rn209[1173.980]";
-	my_pdg_to_string[1000862092] = "Rn209[3636.780]";
-	my_pdg_to_string[1000862100] = "Rn210";
-	my_pdg_to_string[1000862101] = "Rn210[3812.400]";
-	my_pdg_to_string[1000862102] = "Rn210[6469.020]";
-	my_pdg_to_string[1000862110] = "Rn211";
-	my_pdg_to_string[1000862120] = "Rn212";
-	my_pdg_to_string[1000862130] = "Rn213";
-	my_pdg_to_string[1000862131] = "Rn213[2186.700]";
-	my_pdg_to_string[1000862140] = "Rn214";
-	my_pdg_to_string[1000862150] = "Rn215";
-	my_pdg_to_string[1000862160] = "Rn216";
-	my_pdg_to_string[1000862170] = "Rn217";
-	my_pdg_to_string[1000862180] = "Rn218";
-	my_pdg_to_string[1000862190] = "Rn219";
-	my_pdg_to_string[1000862200] = "Rn220";
-	my_pdg_to_string[1000862210] = "Rn221";
-	my_pdg_to_string[1000862220] = "Rn222";
-	my_pdg_to_string[1000862230] = "Rn223";
-	my_pdg_to_string[1000862240] = "Rn224";
-	my_pdg_to_string[1000862250] = "Rn225";
-	my_pdg_to_string[1000862260] = "Rn226";
-	my_pdg_to_string[1000862270] = "Rn227";
-	my_pdg_to_string[1000862280] = "Rn228";
-	my_pdg_to_string[1000862290] = "Rn229";
-	my_pdg_to_string[1000871990] = "Fr199";
-	my_pdg_to_string[1000872000] = "Fr200";
-	my_pdg_to_string[1000872010] = "Fr201";
-	my_pdg_to_string[1000872020] = "Fr202";
-	my_pdg_to_string[1000872030] = "Fr203";
-	my_pdg_to_string[1000872040] = "Fr204";
-	my_pdg_to_string[1000872041] = "Fr204[41.000]";
-	my_pdg_to_string[1000872042] = "Fr204[316.000]";
-	my_pdg_to_string[1000872050] = "Fr205";
-	my_pdg_to_string[1000872060] = "Fr206";
-	my_pdg_to_string[1000872062] = "Fr206[531.000]";
-	my_pdg_to_string[1000872070] = "Fr207";
-	my_pdg_to_string[1000872080] = "Fr208";
-	my_pdg_to_string[1000872090] = "Fr209";
-	my_pdg_to_string[1000872100] = "Fr210";
-	my_pdg_to_string[1000872110] = "Fr211";
-	my_pdg_to_string[1000872120] = "Fr212";
-	my_pdg_to_string[1000872121] = "Fr212[1551.400]";
-	my_pdg_to_string[1000872122] = "Fr212[8533.400]";
-	my_pdg_to_string[1000872130] = "Fr213";
-	my_pdg_to_string[1000872131] = "Fr213[8094.800]";
-	my_pdg_to_string[1000872140] = "Fr214";
-	my_pdg_to_string[1000872141] = "Fr214[122.000]";
-	my_pdg_to_string[1000872150] = "Fr215";
-	my_pdg_to_string[1000872160] = "Fr216";
-	my_pdg_to_string[1000872170] = "Fr217";
-	my_pdg_to_string[1000872180] = "Fr218";
-	my_pdg_to_string[1000872181] = "Fr218[86.000]";
-	my_pdg_to_string[1000872190] = "Fr219";
-	my_pdg_to_string[1000872200] = "Fr220";
-	my_pdg_to_string[1000872210] = "Fr221";
-	my_pdg_to_string[1000872220] = "Fr222";
-	my_pdg_to_string[1000872230] = "Fr223";
-	my_pdg_to_string[1000872240] = "Fr224";
-	my_pdg_to_string[1000872250] = "Fr225";
-	my_pdg_to_string[1000872260] = "Fr226";
-	my_pdg_to_string[1000872270] = "Fr227";
-	my_pdg_to_string[1000872280] = "Fr228";
-	my_pdg_to_string[1000872290] = "Fr229";
-	my_pdg_to_string[1000872300] = "Fr230";
-	my_pdg_to_string[1000872310] = "Fr231";
-	my_pdg_to_string[1000872320] = "Fr232";
-	my_pdg_to_string[1000872330] = "Fr233";
-	my_pdg_to_string[1000882011] = "Ra201[0.000]";
-	my_pdg_to_string[1000882020] = "Ra202";
-	my_pdg_to_string[1000882030] = "Ra203";
-	my_pdg_to_string[1000882040] = "Ra204";
-	my_pdg_to_string[1000882050] = "Ra205";
-	my_pdg_to_string[1000882060] = "Ra206";
-	my_pdg_to_string[1000882070] = "Ra207";
-	my_pdg_to_string[1000882071] = "Ra207[554.000]";
-	my_pdg_to_string[1000882080] = "Ra208";
-	my_pdg_to_string[1000882090] = "Ra209";
-	my_pdg_to_string[1000882100] = "Ra210";
-	my_pdg_to_string[1000882101] = "Ra210[2050.900]";
-	my_pdg_to_string[1000882110] = "Ra211";
-	my_pdg_to_string[1000882111] = "Ra211[1198.100]";
-	my_pdg_to_string[1000882120] = "Ra212";
-	my_pdg_to_string[1000882121] = "Ra212[1958.400]";
-	my_pdg_to_string[1000882130] = "Ra213";
-	my_pdg_to_string[1000882131] = "Ra213[1770.000]";
-	my_pdg_to_string[1000882140] = "Ra214";
-	my_pdg_to_string[1000882141] = "Ra214[1865.200]";
-	my_pdg_to_string[1000882150] = "Ra215";
-	my_pdg_to_string[1000882151] = "Ra215[1877.800]";
-	my_pdg_to_string[1000882152] = "Ra215[2246.900]";
-	my_pdg_to_string[1000882160] = "Ra216";
-	my_pdg_to_string[1000882170] = "Ra217";
-	my_pdg_to_string[1000882180] = "Ra218";
-	my_pdg_to_string[1000882190] = "Ra219";
-	my_pdg_to_string[1000882200] = "Ra220";
-	my_pdg_to_string[1000882210] = "Ra221";
-	my_pdg_to_string[1000882220] = "Ra222";
-	my_pdg_to_string[1000882230] = "Ra223";
-	my_pdg_to_string[1000882240] = "Ra224";
-	my_pdg_to_string[1000882250] = "Ra225";
-	my_pdg_to_string[1000882260] = "Ra226";
-	my_pdg_to_string[1000882270] = "Ra227";
-	my_pdg_to_string[1000882290] = "Ra229";
-	my_pdg_to_string[1000882300] = "Ra230";
-	my_pdg_to_string[1000882310] = "Ra231";
-	my_pdg_to_string[1000882311] = "Ra231[66.210]";
-	my_pdg_to_string[1000882320] = "Ra232";
-	my_pdg_to_string[1000882330] = "Ra233";
-	my_pdg_to_string[1000882340] = "Ra234";
-	my_pdg_to_string[1000892060] = "Ac206";
-	my_pdg_to_string[1000892070] = "Ac207";
-	my_pdg_to_string[1000892080] = "Ac208";
-	my_pdg_to_string[1000892081] = "Ac208[506.000]";
-	my_pdg_to_string[1000892090] = "Ac209";
-	my_pdg_to_string[1000892100] = "Ac210";
-	my_pdg_to_string[1000892110] = "Ac211";
-	my_pdg_to_string[1000892120] = "Ac212";
-	my_pdg_to_string[1000892130] = "Ac213";
-	my_pdg_to_string[1000892140] = "Ac214";
-	my_pdg_to_string[1000892150] = "Ac215";
-	my_pdg_to_string[1000892160] = "Ac216";
-	my_pdg_to_string[1000892161] = "Ac216[48.000]";
-	my_pdg_to_string[1000892170] = "Ac217";
-	my_pdg_to_string[1000892180] = "Ac218";
-	my_pdg_to_string[1000892190] = "Ac219";
-	my_pdg_to_string[1000892200] = "Ac220";
-	my_pdg_to_string[1000892210] = "Ac221";
-	my_pdg_to_string[1000892220] = "Ac222";
-	my_pdg_to_string[1000892230] = "Ac223";
-	my_pdg_to_string[1000892240] = "Ac224";
-	my_pdg_to_string[1000892260] = "Ac226";
-	my_pdg_to_string[1000892270] = "Ac227";
-	my_pdg_to_string[1000892280] = "Ac228";
-	my_pdg_to_string[1000892290] = "Ac229";
-	my_pdg_to_string[1000892300] = "Ac230";
-	my_pdg_to_string[1000892310] = "Ac231";
-	my_pdg_to_string[1000892320] = "Ac232";
-	my_pdg_to_string[1000892330] = "Ac233";
-	my_pdg_to_string[1000892340] = "Ac234";
-	my_pdg_to_string[1000892350] = "Ac235";
-	my_pdg_to_string[1000902080] = "Th208";
-	my_pdg_to_string[1000902090] = "Th209";
-	my_pdg_to_string[1000902100] = "Th210";
-	my_pdg_to_string[1000902110] = "Th211";
-	my_pdg_to_string[1000902120] = "Th212";
-	my_pdg_to_string[1000902130] = "Th213";
-	my_pdg_to_string[1000902140] = "Th214";
-	my_pdg_to_string[1000902141] = "Th214[2181.000]";
-	my_pdg_to_string[1000902150] = "Th215";
-	my_pdg_to_string[1000902160] = "Th216";
-	my_pdg_to_string[1000902161] = "Th216[2040.000]";
-	my_pdg_to_string[1000902170] = "Th217";
-	my_pdg_to_string[1000902180] = "Th218";
-	my_pdg_to_string[1000902190] = "Th219";
-	my_pdg_to_string[1000902200] = "Th220";
-	my_pdg_to_string[1000902210] = "Th221";
-	my_pdg_to_string[1000902220] = "Th222";
-	my_pdg_to_string[1000902230] = "Th223";
-	my_pdg_to_string[1000902240] = "Th224";
-	my_pdg_to_string[1000902250] = "Th225";
-	my_pdg_to_string[1000902260] = "Th226";
-	my_pdg_to_string[1000902270] = "Th227";
-	my_pdg_to_string[1000902280] = "Th228";
-	my_pdg_to_string[1000902290] = "Th229";
-	my_pdg_to_string[1000902300] = "Th230";
-	my_pdg_to_string[1000902310] = "Th231";
-	my_pdg_to_string[1000902320] = "Th232";
-	my_pdg_to_string[1000902330] = "Th233";
-	my_pdg_to_string[1000902340] = "Th234";
-	my_pdg_to_string[1000902350] = "Th235";
-	my_pdg_to_string[1000902360] = "Th236";
-	my_pdg_to_string[1000902370] = "Th237";
-	my_pdg_to_string[1000902380] = "Th238";
-	my_pdg_to_string[1000912120] = "Pa212";
-	my_pdg_to_string[1000912130] = "Pa213";
-	my_pdg_to_string[1000912140] = "Pa214";
-	my_pdg_to_string[1000912150] = "Pa215";
-	my_pdg_to_string[1000912160] = "Pa216";
-	my_pdg_to_string[1000912170] = "Pa217";
-	my_pdg_to_string[1000912171] = "Pa217[1850.000]";
-	my_pdg_to_string[1000912180] = "Pa218";
-	my_pdg_to_string[1000912210] = "Pa221";
-	my_pdg_to_string[1000912220] = "Pa222";
-	my_pdg_to_string[1000912230] = "Pa223";
-	my_pdg_to_string[1000912240] = "Pa224";
-	my_pdg_to_string[1000912250] = "Pa225";
-	my_pdg_to_string[1000912260] = "Pa226";
-	my_pdg_to_string[1000912270] = "Pa227";
-	my_pdg_to_string[1000912280] = "Pa228";
-	my_pdg_to_string[1000912290] = "Pa229";
-	my_pdg_to_string[1000912300] = "Pa230";
-	my_pdg_to_string[1000912310] = "Pa231";
-	my_pdg_to_string[1000912320] = "Pa232";
-	my_pdg_to_string[1000912330] = "Pa233";
-	my_pdg_to_string[1000912340] = "Pa234";
-	my_pdg_to_string[1000912341] = "Pa234[73.920]";
-	my_pdg_to_string[1000912350] = "Pa235";
-	my_pdg_to_string[1000912360] = "Pa236";
-	my_pdg_to_string[1000912370] = "Pa237";
-	my_pdg_to_string[1000912380] = "Pa238";
-	my_pdg_to_string[1000912390] = "Pa239";
-	my_pdg_to_string[1000922170] = "U217";
-	my_pdg_to_string[1000922180] = "U218";
-	my_pdg_to_string[1000922181] = "U218[2105.000]";
-	my_pdg_to_string[1000922190] = "U219";
-	my_pdg_to_string[1000922210] = "U221";
-	my_pdg_to_string[1000922220] = "U222";
-	my_pdg_to_string[1000922230] = "U223";
-	my_pdg_to_string[1000922240] = "U224";
-	my_pdg_to_string[1000922250] = "U225";
-	my_pdg_to_string[1000922260] = "U226";
-	my_pdg_to_string[1000922270] = "U227";
-	my_pdg_to_string[1000922280] = "U228";
-	my_pdg_to_string[1000922290] = "U229";
-	my_pdg_to_string[1000922300] = "U230";
-	my_pdg_to_string[1000922310] = "U231";
-	my_pdg_to_string[1000922320] = "U232";
-	my_pdg_to_string[1000922330] = "U233";
-	my_pdg_to_string[1000922340] = "U234";
-	my_pdg_to_string[1000922341] = "U234[1421.257]";
-	my_pdg_to_string[1000922350] = "U235";
-	my_pdg_to_string[1000922352] = "U235[2500.000]";
-	my_pdg_to_string[1000922360] = "U236";
-	my_pdg_to_string[1000922370] = "U237";
-	my_pdg_to_string[1000922380] = "U238";
-	my_pdg_to_string[1000922390] = "U239";
-	my_pdg_to_string[1000922400] = "U240";
-	my_pdg_to_string[1000922420] = "U242";
-	my_pdg_to_string[1000932260] = "Np226";
-	my_pdg_to_string[1000932270] = "Np227";
-	my_pdg_to_string[1000932280] = "Np228";
-	my_pdg_to_string[1000932290] = "Np229";
-	my_pdg_to_string[1000932300] = "Np230";
-	my_pdg_to_string[1000932310] = "Np231";
-	my_pdg_to_string[1000932320] = "Np232";
-	my_pdg_to_string[1000932330] = "Np233";
-	my_pdg_to_string[1000932340] = "Np234";
-	my_pdg_to_string[1000932350] = "Np235";
-	my_pdg_to_string[1000932360] = "Np236";
-	my_pdg_to_string[1000932370] = "Np237";
-	my_pdg_to_string[1000932380] = "Np238";
-	my_pdg_to_string[1000932390] = "Np239";
-	my_pdg_to_string[1000932400] = "Np240";
-	my_pdg_to_string[1000932410] = "Np241";
-	my_pdg_to_string[1000932420] = "Np242";
-	my_pdg_to_string[1000932430] = "Np243";
-	my_pdg_to_string[1000932440] = "Np244";
-	my_pdg_to_string[1000942280] = "Pu228";
-	my_pdg_to_string[1000942290] = "Pu229";
-	my_pdg_to_string[1000942300] = "Pu230";
-	my_pdg_to_string[1000942310] = "Pu231";
-	my_pdg_to_string[1000942320] = "Pu232";
-	my_pdg_to_string[1000942330] = "Pu233";
-	my_pdg_to_string[1000942340] = "Pu234";
-	my_pdg_to_string[1000942350] = "Pu235";
-	my_pdg_to_string[1000942360] = "Pu236";
-	my_pdg_to_string[1000942361] = "Pu236[1185.450]";
-	my_pdg_to_string[1000942370] = "Pu237";
-	my_pdg_to_string[1000942371] = "Pu237[145.543]";
-	my_pdg_to_string[1000942372] = "Pu237[2900.000]";
-	my_pdg_to_string[1000942380] = "Pu238";
-	my_pdg_to_string[1000942390] = "Pu239";
-	my_pdg_to_string[1000942391] = "Pu239[3100.000]";
-	my_pdg_to_string[1000942400] = "Pu240";
-	my_pdg_to_string[1000942410] = "Pu241";
-	my_pdg_to_string[1000942411] = "Pu241[2200.000]";
-	my_pdg_to_string[1000942420] = "Pu242";
-	my_pdg_to_string[1000942430] = "Pu243";
-	my_pdg_to_string[1000942440] = "Pu244";
-	my_pdg_to_string[1000942450] = "Pu245";
-	my_pdg_to_string[1000942460] = "Pu246";
-	my_pdg_to_string[1000942470] = "Pu247";
-	my_pdg_to_string[1000952300] = "Am230";
-	my_pdg_to_string[1000952320] = "Am232";
-	my_pdg_to_string[1000952330] = "Am233";
-	my_pdg_to_string[1000952340] = "Am234";
-	my_pdg_to_string[1000952350] = "Am235";
-	my_pdg_to_string[1000952360] = "Am236";
-	my_pdg_to_string[1000952370] = "Am237";
-	my_pdg_to_string[1000952380] = "Am238";
-	my_pdg_to_string[1000952381] = "Am238[2500.000]";
-	my_pdg_to_string[1000952390] = "Am239";
-	my_pdg_to_string[1000952400] = "Am240";
-	my_pdg_to_string[1000952401] = "Am240[3000.000]";
-	my_pdg_to_string[1000952410] = "Am241";
-	my_pdg_to_string[1000952411] = "Am241[2200.000]";
-	my_pdg_to_string[1000952420] = "Am242";
-	my_pdg_to_string[1000952421] = "Am242[48.600]";
-	my_pdg_to_string[1000952422] = "Am242[2200.000]";
-	my_pdg_to_string[1000952430] = "Am243";
-	my_pdg_to_string[1000952431] = "Am243[2300.000]";
-	my_pdg_to_string[1000952440] = "Am244";
-	my_pdg_to_string[1000952443] = "Am244[86.100]";
-	my_pdg_to_string[1000952450] = "Am245";
-	my_pdg_to_string[1000952460] = "Am246";
-	my_pdg_to_string[1000952462] = "Am246[2000.000]";
-	my_pdg_to_string[1000952470] = "Am247";
-	my_pdg_to_string[1000962340] = "Cm234";
-	my_pdg_to_string[1000962380] = "Cm238";
-	my_pdg_to_string[1000962390] = "Cm239";
-	my_pdg_to_string[1000962400] = "Cm240";
-	my_pdg_to_string[1000962410] = "Cm241";
-	my_pdg_to_string[1000962420] = "Cm242";
-	my_pdg_to_string[1000962430] = "Cm243";
-	my_pdg_to_string[1000962431] = "Cm243[87.400]";
-	my_pdg_to_string[1000962440] = "Cm244";
-	my_pdg_to_string[1000962441] = "Cm244[1040.188]";
-	my_pdg_to_string[1000962450] = "Cm245";
-	my_pdg_to_string[1000962460] = "Cm246";
-	my_pdg_to_string[1000962470] = "Cm247";
-	my_pdg_to_string[1000962471] = "Cm247[227.380]";
-	my_pdg_to_string[1000962480] = "Cm248";
-	my_pdg_to_string[1000962490] = "Cm249";
-	my_pdg_to_string[1000962491] = "Cm249[48.760]";
-	my_pdg_to_string[1000962500] = "Cm250";
-	my_pdg_to_string[1000962510] = "Cm251";
-	my_pdg_to_string[1000962520] = "Cm252";
-	my_pdg_to_string[1000972340] = "Bk234";
-	my_pdg_to_string[1000972380] = "Bk238";
-	my_pdg_to_string[1000972400] = "Bk240";
-	my_pdg_to_string[1000972410] = "Bk241";
-	my_pdg_to_string[1000972420] = "Bk242";
-	my_pdg_to_string[1000972430] = "Bk243";
-	my_pdg_to_string[1000972440] = "Bk244";
-	my_pdg_to_string[1000972450] = "Bk245";
-	my_pdg_to_string[1000972461] = "Bk246[0.000]";
-	my_pdg_to_string[1000972470] = "Bk247";
-	my_pdg_to_string[1000972481] = "Bk248[0.000]";
-	my_pdg_to_string[1000972490] = "Bk249";
-	my_pdg_to_string[1000972491] = "Bk249[8.777]";
-	my_pdg_to_string[1000972500] = "Bk250";
-	my_pdg_to_string[1000972501] = "Bk250[35.590]";
-	my_pdg_to_string[1000972502] = "Bk250[86.000]";
-	my_pdg_to_string[1000972510] = "Bk251";
-	my_pdg_to_string[1000972511] = "Bk251[35.500]";
-	my_pdg_to_string[1000972531] = "Bk253[0.000]";
-	my_pdg_to_string[1000982370] = "Cf237";
-	my_pdg_to_string[1000982380] = "Cf238";
-	my_pdg_to_string[1000982390] = "Cf239";
-	my_pdg_to_string[1000982400] = "Cf240";
-	my_pdg_to_string[1000982410] = "Cf241";
-	my_pdg_to_string[1000982420] = "Cf242";
-	my_pdg_to_string[1000982430] = "Cf243";
-	my_pdg_to_string[1000982440] = "Cf244";
-	my_pdg_to_string[1000982450] = "Cf245";
-	my_pdg_to_string[1000982460] = "Cf246";
-	my_pdg_to_string[1000982470] = "Cf247";
-	my_pdg_to_string[1000982480] = "Cf248";
-	my_pdg_to_string[1000982490] = "Cf249";
-	my_pdg_to_string[1000982491] = "Cf249[144.980]";
-	my_pdg_to_string[1000982500] = "Cf250";
-	my_pdg_to_string[1000982510] = "Cf251";
-	my_pdg_to_string[1000982511] = "Cf251[370.470]";
-	my_pdg_to_string[1000982520] = "Cf252";
-	my_pdg_to_string[1000982530] = "Cf253";
-	my_pdg_to_string[1000982540] = "Cf254";
-	my_pdg_to_string[1000982550] = "Cf255";
-	my_pdg_to_string[1000982560] = "Cf256";
-	my_pdg_to_string[1000992410] = "Es241";
-	my_pdg_to_string[1000992420] = "Es242";
-	my_pdg_to_string[1000992431] = "Es243[0.000]";
-	my_pdg_to_string[1000992440] = "Es244";
-	my_pdg_to_string[1000992450] = "Es245";
-	my_pdg_to_string[1000992461] = "Es246[0.000]";
-	my_pdg_to_string[1000992470] = "Es247";
-	my_pdg_to_string[1000992480] = "Es248";
-	my_pdg_to_string[1000992490] = "Es249";
-	my_pdg_to_string[1000992500] = "Es250";
-	my_pdg_to_string[1000992510] = "Es251";
-	my_pdg_to_string[1000992520] = "Es252";
-	my_pdg_to_string[1000992530] = "Es253";
-	my_pdg_to_string[1000992540] = "Es254";
-	my_pdg_to_string[1000992541] = "Es254[84.200]";
-	my_pdg_to_string[1000992550] = "Es255";
-	my_pdg_to_string[1000992560] = "Es256";
-	my_pdg_to_string[1000992570] = "Es257";
-	my_pdg_to_string[1001002410] = "Fm241";
-	my_pdg_to_string[1001002420] = "Fm242";
-	my_pdg_to_string[1001002430] = "Fm243";
-	my_pdg_to_string[1001002440] = "Fm244";
-	my_pdg_to_string[1001002450] = "Fm245";
-	my_pdg_to_string[1001002460] = "Fm246";
-	my_pdg_to_string[1001002470] = "Fm247";
-	my_pdg_to_string[1001002480] = "Fm248";
-	my_pdg_to_string[1001002481] = "Fm248[1074.000]";
-	my_pdg_to_string[1001002490] = "Fm249";
-	my_pdg_to_string[1001002500] = "Fm250";
-	my_pdg_to_string[1001002510] = "Fm251";
-	my_pdg_to_string[1001002511] = "Fm251[200.000]";
-	my_pdg_to_string[1001002520] = "Fm252";
-	my_pdg_to_string[1001002530] = "Fm253";
-	my_pdg_to_string[1001002540] = "Fm254";
-	my_pdg_to_string[1001002550] = "Fm255";
-	my_pdg_to_string[1001002560] = "Fm256";
-	my_pdg_to_string[1001002570] = "Fm257";
-	my_pdg_to_string[1001002580] = "Fm258";
-	my_pdg_to_string[1001002590] = "Fm259";
-	my_pdg_to_string[1001012450] = "Md245";
-	my_pdg_to_string[1001012451] = "Md245[300.000]";
-	my_pdg_to_string[1001012461] = "Md246[0.000]";
-	my_pdg_to_string[1001012470] = "Md247";
-	my_pdg_to_string[1001012480] = "Md248";
-	my_pdg_to_string[1001012490] = "Md249";
-	my_pdg_to_string[1001012500] = "Md250";
-	my_pdg_to_string[1001012510] = "Md251";
-	my_pdg_to_string[1001012520] = "Md252";
-	my_pdg_to_string[1001012530] = "Md253";
-	my_pdg_to_string[1001012541] = "Md254[0.000]";
-	my_pdg_to_string[1001012550] = "Md255";
-	my_pdg_to_string[1001012560] = "Md256";
-	my_pdg_to_string[1001012570] = "Md257";
-	my_pdg_to_string[1001012580] = "Md258";
-	my_pdg_to_string[1001012590] = "Md259";
-	my_pdg_to_string[1001012600] = "Md260";
-	my_pdg_to_string[1001022480] = "No248";
-	my_pdg_to_string[1001022510] = "No251";
-	my_pdg_to_string[1001022511] = "No251[106.000]";
-	my_pdg_to_string[1001022512] = "No251[1699.700]";
-	my_pdg_to_string[1001022520] = "No252";
-	my_pdg_to_string[1001022530] = "No253";
-	my_pdg_to_string[1001022532] = "No253[167.500]";
-	my_pdg_to_string[1001022533] = "No253[1440.000]";
-	my_pdg_to_string[1001022540] = "No254";
-	my_pdg_to_string[1001022550] = "No255";
-	my_pdg_to_string[1001022560] = "No256";
-	my_pdg_to_string[1001022570] = "No257";
-	my_pdg_to_string[1001022580] = "No258";
-	my_pdg_to_string[1001022590] = "No259";
-	my_pdg_to_string[1001022600] = "No260";
-	my_pdg_to_string[1001022620] = "No262";
-	my_pdg_to_string[1001032520] = "Lr252";
-	my_pdg_to_string[1001032530] = "Lr253";
-	my_pdg_to_string[1001032540] = "Lr254";
-	my_pdg_to_string[1001032550] = "Lr255";
-	my_pdg_to_string[1001032551] = "Lr255[38.000]";
-	my_pdg_to_string[1001032552] = "Lr255[1408.600]";
-	my_pdg_to_string[1001032560] = "Lr256";
-	my_pdg_to_string[1001032570] = "Lr257";
-	my_pdg_to_string[1001032580] = "Lr258";
-	my_pdg_to_string[1001032590] = "Lr259";
-	my_pdg_to_string[1001032600] = "Lr260";
-	my_pdg_to_string[1001032610] = "Lr261";
-	my_pdg_to_string[1001032620] = "Lr262";
-	my_pdg_to_string[1001032660] = "Lr266";
-	my_pdg_to_string[1001042531] = "Rf253[0.000]";
-	my_pdg_to_string[1001042540] = "Rf254";
-	my_pdg_to_string[1001042550] = "Rf255";
-	my_pdg_to_string[1001042560] = "Rf256";
-	my_pdg_to_string[1001042561] = "Rf256[1120.000]";
-	my_pdg_to_string[1001042562] = "Rf256[1400.000]";
-	my_pdg_to_string[1001042563] = "Rf256[2200.000]";
-	my_pdg_to_string[1001042570] = "Rf257";
-	my_pdg_to_string[1001042571] = "Rf257[75.000]";
-	my_pdg_to_string[1001042572] = "Rf257[1157.000]";
-	my_pdg_to_string[1001042580] = "Rf258";
-	my_pdg_to_string[1001042590] = "Rf259";
-	my_pdg_to_string[1001042600] = "Rf260";
-	my_pdg_to_string[1001042611] = "Rf261[0.000]";
-	my_pdg_to_string[1001042612] = "Rf261[227.000]";
-	my_pdg_to_string[1001042620] = "Rf262";
-	my_pdg_to_string[1001042630] = "Rf263";
-	my_pdg_to_string[1001052550] = "Db255";
-	my_pdg_to_string[1001052560] = "Db256";
-	my_pdg_to_string[1001052570] = "Db257";
-	my_pdg_to_string[1001052571] = "Db257[370.000]";
-	my_pdg_to_string[1001052580] = "Db258";
-	my_pdg_to_string[1001052590] = "Db259";
-	my_pdg_to_string[1001052600] = "Db260";
-	my_pdg_to_string[1001052610] = "Db261";
-	my_pdg_to_string[1001052620] = "Db262";
-	my_pdg_to_string[1001052630] = "Db263";
-	my_pdg_to_string[1001052701] = "Db270[0.000]";
-	my_pdg_to_string[1001062580] = "Sg258";
-	my_pdg_to_string[1001062590] = "Sg259";
-	my_pdg_to_string[1001062600] = "Sg260";
-	my_pdg_to_string[1001062610] = "Sg261";
-	my_pdg_to_string[1001062620] = "Sg262";
-	my_pdg_to_string[1001062630] = "Sg263";
-	my_pdg_to_string[1001062640] = "Sg264";
-	my_pdg_to_string[1001062651] = "Sg265[0.000]";
-	my_pdg_to_string[1001062652] = "Sg265[150.000]";
-	my_pdg_to_string[1001062660] = "Sg266";
-	my_pdg_to_string[1001062690] = "Sg269";
-	my_pdg_to_string[1001072610] = "Bh261";
-	my_pdg_to_string[1001072621] = "Bh262[0.000]";
-	my_pdg_to_string[1001072640] = "Bh264";
-	my_pdg_to_string[1001072671] = "Bh267[0.000]";
-	my_pdg_to_string[1001072741] = "Bh274[0.000]";
-	my_pdg_to_string[1001082640] = "Hs264";
-	my_pdg_to_string[1001082650] = "Hs265";
-	my_pdg_to_string[1001082651] = "Hs265[300.000]";
-	my_pdg_to_string[1001082660] = "Hs266";
-	my_pdg_to_string[1001082670] = "Hs267";
-	my_pdg_to_string[1001082691] = "Hs269[0.000]";
-	my_pdg_to_string[1001082730] = "Hs273";
-	my_pdg_to_string[1001082770] = "Hs277";
-	my_pdg_to_string[1001092661] = "Mt266[0.000]";
-	my_pdg_to_string[1001092681] = "Mt268[0.000]";
-	my_pdg_to_string[1001092741] = "Mt274[0.000]";
-	my_pdg_to_string[1001092770] = "Mt277";
-	my_pdg_to_string[1001092781] = "Mt278[0.000]";
-	my_pdg_to_string[1001102710] = "Ds271";
-	my_pdg_to_string[1001102730] = "Ds273";
-	my_pdg_to_string[1001102770] = "Ds277";
-	my_pdg_to_string[1001112721] = "Rg272[0.000]";
-	my_pdg_to_string[1001112781] = "Rg278[0.000]";
-	my_pdg_to_string[1001112811] = "Rg281[0.000]";
-	my_pdg_to_string[1001112821] = "Rg282[0.000]";
-	my_pdg_to_string[1001122770] = "Cp277";
-	my_pdg_to_string[1001122810] = "Cp281";
-	my_pdg_to_string[1001132851] = "Uut285[0.000]";
-	my_pdg_to_string[1001132861] = "Uut286[0.000]";
-	my_pdg_to_string[1001152891] = "Uup289[0.000]";
-	my_pdg_to_string[1001152901] = "Uup290[0.000]";
-	my_pdg_to_string[1001172931] = "Uus293[0.000]";
-	return &my_pdg_to_string;
+	{1000010020, "Deuterium"},
+	{1000010030, "Tritium"},
+	{1000010060, "H6"},
+	{1000020030, "He3"},
+	{1000020040, "alpha"},
+	{1000020050, "He5"},
+	{1000020060, "He6"},
+	{1000020070, "He7"},
+	{1000020080, "He8"},
+	{1000020100, "He10"},
+	{1000030050, "Li5"},
+	{1000030060, "Li6"},
+	{1000030070, "Li7"},
+	{1000030080, "Li8"},
+	{1000030090, "Li9"},
+	{1000030110, "Li11"},
+	{1000040060, "Be6"},
+	{1000040070, "Be7"},
+	{1000040080, "Be8"},
+	{1000040090, "Be9"},
+	{1000040100, "Be10"},
+	{1000040110, "Be11"},
+	{1000040120, "Be12"},
+	{1000040130, "Be13"},
+	{1000040140, "Be14"},
+	{1000050070, "B7"},
+	{1000050080, "B8"},
+	{1000050090, "B9"},
+	{1000050100, "B10"},
+	{1000050110, "B11"},
+	{1000050120, "B12"},
+	{1000050130, "B13"},
+	{1000050140, "B14"},
+	{1000050150, "B15"},
+	{1000050160, "B16"},
+	{1000050170, "B17"},
+	{1000060080, "C8"},
+	{1000060090, "C9"},
+	{1000060100, "C10"},
+	{1000060110, "C11"},
+	{1000060120, "C12"},
+	{1000060130, "C13"},
+	{1000060140, "C14"},
+	{1000060150, "C15"},
+	{1000060160, "C16"},
+	{1000060170, "C17"},
+	{1000060180, "C18"},
+	{1000060200, "C20"},
+	{1000060220, "C22"},
+	{1000070110, "N11"},
+	{1000070120, "N12"},
+	{1000070130, "N13"},
+	{1000070140, "N14"},
+	{1000070150, "N15"},
+	{1000070160, "N16"},
+	{1000070161, "N16[120.420]"},
+	{1000070170, "N17"},
+	{1000070180, "N18"},
+	{1000070190, "N19"},
+	{1000070200, "N20"},
+	{1000070210, "N21"},
+	{1000070220, "N22"},
+	{1000070230, "N23"},
+	{1000070240, "N24"},
+	{1000080120, "O12"},
+	{1000080130, "O13"},
+	{1000080140, "O14"},
+	{1000080150, "O15"},
+	{1000080160, "O16"},
+	{1000080170, "O17"},
+	{1000080180, "O18"},
+	{1000080190, "O19"},
+	{1000080200, "O20"},
+	{1000080210, "O21"},
+	{1000080220, "O22"},
+	{1000080230, "O23"},
+	{1000080240, "O24"},
+	{1000080260, "O26"},
+	{1000090140, "F14"},
+	{1000090150, "F15"},
+	{1000090160, "F16"},
+	{1000090170, "F17"},
+	{1000090180, "F18"},
+	{1000090190, "F19"},
+	{1000090200, "F20"},
+	{1000090210, "F21"},
+	{1000090220, "F22"},
+	{1000090230, "F23"},
+	{1000090240, "F24"},
+	{1000090250, "F25"},
+	{1000090260, "F26"},
+	{1000090270, "F27"},
+	{1000090280, "F28"},
+	{1000090290, "F29"},
+	{1000090310, "F31"},
+	{1000100160, "Ne16"},
+	{1000100170, "Ne17"},
+	{1000100180, "Ne18"},
+	{1000100190, "Ne19"},
+	{1000100200, "Ne20"},
+	{1000100210, "Ne21"},
+	{1000100220, "Ne22"},
+	{1000100230, "Ne23"},
+	{1000100240, "Ne24"},
+	{1000100250, "Ne25"},
+	{1000100260, "Ne26"},
+	{1000100270, "Ne27"},
+	{1000100280, "Ne28"},
+	{1000100290, "Ne29"},
+	{1000100300, "Ne30"},
+	{1000100310, "Ne31"},
+	{1000100320, "Ne32"},
+	{1000100340, "Ne34"},
+	{1000110200, "Na20"},
+	{1000110210, "Na21"},
+	{1000110220, "Na22"},
+	{1000110230, "Na23"},
+	{1000110240, "Na24"},
+	{1000110241, "Na24[472.207]"},
+	{1000110250, "Na25"},
+	{1000110260, "Na26"},
+	{1000110261, "Na26[82.500]"},
+	{1000110270, "Na27"},
+	{1000110280, "Na28"},
+	{1000110290, "Na29"},
+	{1000110300, "Na30"},
+	{1000110310, "Na31"},
+	{1000110320, "Na32"},
+	{1000110330, "Na33"},
+	{1000110340, "Na34"},
+	{1000110350, "Na35"},
+	{1000110370, "Na37"},
+	{1000120190, "Mg19"},
+	{1000120200, "Mg20"},
+	{1000120210, "Mg21"},
+	{1000120220, "Mg22"},
+	{1000120230, "Mg23"},
+	{1000120240, "Mg24"},
+	{1000120250, "Mg25"},
+	{1000120260, "Mg26"},
+	{1000120270, "Mg27"},
+	{1000120280, "Mg28"},
+	{1000120290, "Mg29"},
+	{1000120300, "Mg30"},
+	{1000120310, "Mg31"},
+	{1000120320, "Mg32"},
+	{1000120330, "Mg33"},
+	{1000120340, "Mg34"},
+	{1000120350, "Mg35"},
+	{1000120360, "Mg36"},
+	{1000120370, "Mg37"},
+	{1000120380, "Mg38"},
+	{1000120400, "Mg40"},
+	{1000130210, "Al21"},
+	{1000130220, "Al22"},
+	{1000130230, "Al23"},
+	{1000130240, "Al24"},
+	{1000130241, "Al24[425.800]"},
+	{1000130250, "Al25"},
+	{1000130260, "Al26"},
+	{1000130261, "Al26[228.305]"},
+	{1000130270, "Al27"},
+	{1000130280, "Al28"},
+	{1000130290, "Al29"},
+	{1000130300, "Al30"},
+	{1000130310, "Al31"},
+	{1000130320, "Al32"},
+	{1000130330, "Al33"},
+	{1000130340, "Al34"},
+	{1000130350, "Al35"},
+	{1000130360, "Al36"},
+	{1000130370, "Al37"},
+	{1000130380, "Al38"},
+	{1000130390, "Al39"},
+	{1000130400, "Al40"},
+	{1000130410, "Al41"},
+	{1000130420, "Al42"},
+	{1000140220, "Si22"},
+	{1000140230, "Si23"},
+	{1000140260, "Si26"},
+	{1000140270, "Si27"},
+	{1000140280, "Si28"},
+	{1000140290, "Si29"},
+	{1000140300, "Si30"},
+	{1000140310, "Si31"},
+	{1000140320, "Si32"},
+	{1000140330, "Si33"},
+	{1000140340, "Si34"},
+	{1000140350, "Si35"},
+	{1000140360, "Si36"},
+	{1000140370, "Si37"},
+	{1000140380, "Si38"},
+	{1000140390, "Si39"},
+	{1000140400, "Si40"},
+	{1000140410, "Si41"},
+	{1000140420, "Si42"},
+	{1000140430, "Si43"},
+	{1000140440, "Si44"},
+	{1000150250, "P25"},
+	{1000150260, "P26"},
+	{1000150270, "P27"},
+	{1000150280, "P28"},
+	{1000150290, "P29"},
+	{1000150300, "P30"},
+	{1000150310, "P31"},
+	{1000150320, "P32"},
+	{1000150330, "P33"},
+	{1000150340, "P34"},
+	{1000150350, "P35"},
+	{1000150360, "P36"},
+	{1000150370, "P37"},
+	{1000150380, "P38"},
+	{1000150390, "P39"},
+	{1000150400, "P40"},
+	{1000150410, "P41"},
+	{1000150420, "P42"},
+	{1000150430, "P43"},
+	{1000150440, "P44"},
+	{1000150450, "P45"},
+	{1000160270, "S27"},
+	{1000160280, "S28"},
+	{1000160290, "S29"},
+	{1000160300, "S30"},
+	{1000160310, "S31"},
+	{1000160320, "S32"},
+	{1000160330, "S33"},
+	{1000160340, "S34"},
+	{1000160350, "S35"},
+	{1000160360, "S36"},
+	{1000160370, "S37"},
+	{1000160380, "S38"},
+	{1000160390, "S39"},
+	{1000160400, "S40"},
+	{1000160410, "S41"},
+	{1000160420, "S42"},
+	{1000160430, "S43"},
+	{1000160440, "S44"},
+	{1000160441, "S44[1365.000]"},
+	{1000160450, "S45"},
+	{1000160460, "S46"},
+	{1000160480, "S48"},
+	{1000170290, "Cl29"},
+	{1000170300, "Cl30"},
+	{1000170310, "Cl31"},
+	{1000170320, "Cl32"},
+	{1000170330, "Cl33"},
+	{1000170340, "Cl34"},
+	{1000170341, "Cl34[146.360]"},
+	{1000170350, "Cl35"},
+	{1000170360, "Cl36"},
+	{1000170370, "Cl37"},
+	{1000170380, "Cl38"},
+	{1000170381, "Cl38[671.365]"},
+	{1000170390, "Cl39"},
+	{1000170400, "Cl40"},
+	{1000170410, "Cl41"},
+	{1000170420, "Cl42"},
+	{1000170430, "Cl43"},
+	{1000170440, "Cl44"},
+	{1000170450, "Cl45"},
+	{1000170460, "Cl46"},
+	{1000170470, "Cl47"},
+	{1000170480, "Cl48"},
+	{1000170500, "Cl50"},
+	{1000170510, "Cl51"},
+	{1000180310, "Ar31"},
+	{1000180320, "Ar32"},
+	{1000180330, "Ar33"},
+	{1000180340, "Ar34"},
+	{1000180350, "Ar35"},
+	{1000180360, "Ar36"},
+	{1000180370, "Ar37"},
+	{1000180380, "Ar38"},
+	{1000180390, "Ar39"},
+	{1000180400, "Ar40"},
+	{1000180410, "Ar41"},
+	{1000180420, "Ar42"},
+	{1000180430, "Ar43"},
+	{1000180440, "Ar44"},
+	{1000180450, "Ar45"},
+	{1000180460, "Ar46"},
+	{1000180470, "Ar47"},
+	{1000180480, "Ar48"},
+	{1000180490, "Ar49"},
+	{1000180500, "Ar50"},
+	{1000180510, "Ar51"},
+	{1000180520, "Ar52"},
+	{1000180530, "Ar53"},
+	{1000190350, "K35"},
+	{1000190360, "K36"},
+	{1000190370, "K37"},
+	{1000190380, "K38"},
+	{1000190381, "K38[130.400]"},
+	{1000190382, "K38[3458.140]"},
+	{1000190390, "K39"},
+	{1000190400, "K40"},
+	{1000190410, "K41"},
+	{1000190420, "K42"},
+	{1000190430, "K43"},
+	{1000190440, "K44"},
+	{1000190450, "K45"},
+	{1000190460, "K46"},
+	{1000190470, "K47"},
+	{1000190480, "K48"},
+	{1000190490, "K49"},
+	{1000190500, "K50"},
+	{1000190510, "K51"},
+	{1000190520, "K52"},
+	{1000190530, "K53"},
+	{1000190540, "K54"},
+	{1000190550, "K55"},
+	{1000190560, "K56"},
+	{1000200350, "Ca35"},
+	{1000200360, "Ca36"},
+	{1000200370, "Ca37"},
+	{1000200380, "Ca38"},
+	{1000200390, "Ca39"},
+	{1000200400, "Ca40"},
+	{1000200410, "Ca41"},
+	{1000200420, "Ca42"},
+	{1000200430, "Ca43"},
+	{1000200440, "Ca44"},
+	{1000200450, "Ca45"},
+	{1000200460, "Ca46"},
+	{1000200470, "Ca47"},
+	{1000200480, "Ca48"},
+	{1000200490, "Ca49"},
+	{1000200500, "Ca50"},
+	{1000200510, "Ca51"},
+	{1000200520, "Ca52"},
+	{1000200530, "Ca53"},
+	{1000200540, "Ca54"},
+	{1000200550, "Ca55"},
+	{1000200560, "Ca56"},
+	{1000200570, "Ca57"},
+	{1000200580, "Ca58"},
+	{1000210390, "Sc39"},
+	{1000210400, "Sc40"},
+	{1000210410, "Sc41"},
+	{1000210420, "Sc42"},
+	{1000210421, "Sc42[616.280]"},
+	{1000210430, "Sc43"},
+	{1000210431, "Sc43[151.400]"},
+	{1000210440, "Sc44"},
+	{1000210441, "Sc44[146.191]"},
+	{1000210442, "Sc44[271.240]"},
+	{1000210450, "Sc45"},
+	{1000210451, "Sc45[12.400]"},
+	{1000210460, "Sc46"},
+	{1000210461, "Sc46[52.011]"},
+	{1000210462, "Sc46[142.528]"},
+	{1000210470, "Sc47"},
+	{1000210480, "Sc48"},
+	{1000210490, "Sc49"},
+	{1000210500, "Sc50"},
+	{1000210501, "Sc50[256.895]"},
+	{1000210510, "Sc51"},
+	{1000210520, "Sc52"},
+	{1000210530, "Sc53"},
+	{1000210540, "Sc54"},
+	{1000210541, "Sc54[110.000]"},
+	{1000210550, "Sc55"},
+	{1000210560, "Sc56"},
+	{1000210570, "Sc57"},
+	{1000210580, "Sc58"},
+	{1000210590, "Sc59"},
+	{1000210610, "Sc61"},
+	{1000220390, "Ti39"},
+	{1000220400, "Ti40"},
+	{1000220410, "Ti41"},
+	{1000220420, "Ti42"},
+	{1000220430, "Ti43"},
+	{1000220431, "Ti43[313.000]"},
+	{1000220440, "Ti44"},
+	{1000220450, "Ti45"},
+	{1000220451, "Ti45[36.530]"},
+	{1000220460, "Ti46"},
+	{1000220470, "Ti47"},
+	{1000220480, "Ti48"},
+	{1000220490, "Ti49"},
+	{1000220500, "Ti50"},
+	{1000220510, "Ti51"},
+	{1000220520, "Ti52"},
+	{1000220530, "Ti53"},
+	{1000220540, "Ti54"},
+	{1000220550, "Ti55"},
+	{1000220560, "Ti56"},
+	{1000220570, "Ti57"},
+	{1000220580, "Ti58"},
+	{1000220590, "Ti59"},
+	{1000220600, "Ti60"},
+	{1000220610, "Ti61"},
+	{1000220620, "Ti62"},
+	{1000220630, "Ti63"},
+	{1000230420, "V42"},
+	{1000230430, "V43"},
+	{1000230440, "V44"},
+	{1000230450, "V45"},
+	{1000230460, "V46"},
+	{1000230461, "V46[801.460]"},
+	{1000230470, "V47"},
+	{1000230480, "V48"},
+	{1000230490, "V49"},
+	{1000230500, "V50"},
+	{1000230510, "V51"},
+	{1000230520, "V52"},
+	{1000230530, "V53"},
+	{1000230540, "V54"},
+	{1000230550, "V55"},
+	{1000230560, "V56"},
+	{1000230570, "V57"},
+	{1000230580, "V58"},
+	{1000230590, "V59"},
+	{1000230601, "V60[0.000]"},
+	{1000230610, "V61"},
+	{1000230620, "V62"},
+	{1000230630, "V63"},
+	{1000230640, "V64"},
+	{1000230650, "V65"},
+	{1000230660, "V66"},
+	{1000240420, "Cr42"},
+	{1000240430, "Cr43"},
+	{1000240440, "Cr44"},
+	{1000240450, "Cr45"},
+	{1000240460, "Cr46"},
+	{1000240470, "Cr47"},
+	{1000240480, "Cr48"},
+	{1000240490, "Cr49"},
+	{1000240500, "Cr50"},
+	{1000240510, "Cr51"},
+	{1000240520, "Cr52"},
+	{1000240530, "Cr53"},
+	{1000240540, "Cr54"},
+	{1000240550, "Cr55"},
+	{1000240560, "Cr56"},
+	{1000240570, "Cr57"},
+	{1000240580, "Cr58"},
+	{1000240590, "Cr59"},
+	{1000240591, "Cr59[503.000]"},
+	{1000240600, "Cr60"},
+	{1000240610, "Cr61"},
+	{1000240620, "Cr62"},
+	{1000240630, "Cr63"},
+	{1000240640, "Cr64"},
+	{1000240650, "Cr65"},
+	{1000240660, "Cr66"},
+	{1000240680, "Cr68"},
+	{1000250440, "Mn44"},
+	{1000250460, "Mn46"},
+	{1000250470, "Mn47"},
+	{1000250480, "Mn48"},
+	{1000250490, "Mn49"},
+	{1000250500, "Mn50"},
+	{1000250501, "Mn50[225.280]"},
+	{1000250510, "Mn51"},
+	{1000250520, "Mn52"},
+	{1000250521, "Mn52[377.749]"},
+	{1000250530, "Mn53"},
+	{1000250540, "Mn54"},
+	{1000250550, "Mn55"},
+	{1000250560, "Mn56"},
+	{1000250570, "Mn57"},
+	{1000250580, "Mn58"},
+	{1000250581, "Mn58[71.770]"},
+	{1000250590, "Mn59"},
+	{1000250600, "Mn60"},
+	{1000250601, "Mn60[271.800]"},
+	{1000250610, "Mn61"},
+	{1000250621, "Mn62[0.000]"},
+	{1000250630, "Mn63"},
+	{1000250640, "Mn64"},
+	{1000250641, "Mn64[175.000]"},
+	{1000250650, "Mn65"},
+	{1000250660, "Mn66"},
+	{1000250670, "Mn67"},
+	{1000250680, "Mn68"},
+	{1000250690, "Mn69"},
+	{1000250700, "Mn70"},
+	{1000250710, "Mn71"},
+	{1000260450, "Fe45"},
+	{1000260460, "Fe46"},
+	{1000260470, "Fe47"},
+	{1000260480, "Fe48"},
+	{1000260490, "Fe49"},
+	{1000260500, "Fe50"},
+	{1000260510, "Fe51"},
+	{1000260520, "Fe52"},
+	{1000260521, "Fe52[6958.000]"},
+	{1000260530, "Fe53"},
+	{1000260531, "Fe53[3040.400]"},
+	{1000260540, "Fe54"},
+	{1000260550, "Fe55"},
+	{1000260560, "Fe56"},
+	{1000260570, "Fe57"},
+	{1000260580, "Fe58"},
+	{1000260590, "Fe59"},
+	{1000260600, "Fe60"},
+	{1000260610, "Fe61"},
+	{1000260620, "Fe62"},
+	{1000260630, "Fe63"},
+	{1000260640, "Fe64"},
+	{1000260650, "Fe65"},
+	{1000260651, "Fe65[402.000]"},
+	{1000260660, "Fe66"},
+	{1000260670, "Fe67"},
+	{1000260671, "Fe67[387.000]"},
+	{1000260680, "Fe68"},
+	{1000260690, "Fe69"},
+	{1000260700, "Fe70"},
+	{1000260710, "Fe71"},
+	{1000260720, "Fe72"},
+	{1000260730, "Fe73"},
+	{1000260740, "Fe74"},
+	{1000270500, "Co50"},
+	{1000270510, "Co51"},
+	{1000270520, "Co52"},
+	{1000270530, "Co53"},
+	{1000270531, "Co53[3197.000]"},
+	{1000270540, "Co54"},
+	{1000270541, "Co54[197.100]"},
+	{1000270550, "Co55"},
+	{1000270560, "Co56"},
+	{1000270570, "Co57"},
+	{1000270580, "Co58"},
+	{1000270581, "Co58[24.950]"},
+	{1000270582, "Co58[53.150]"},
+	{1000270590, "Co59"},
+	{1000270600, "Co60"},
+	{1000270601, "Co60[58.590]"},
+	{1000270610, "Co61"},
+	{1000270620, "Co62"},
+	{1000270621, "Co62[22.000]"},
+	{1000270630, "Co63"},
+	{1000270640, "Co64"},
+	{1000270650, "Co65"},
+	{1000270660, "Co66"},
+	{1000270661, "Co66[175.000]"},
+	{1000270670, "Co67"},
+	{1000270680, "Co68"},
+	{1000270690, "Co69"},
+	{1000270700, "Co70"},
+	{1000270710, "Co71"},
+	{1000270720, "Co72"},
+	{1000270730, "Co73"},
+	{1000270740, "Co74"},
+	{1000270750, "Co75"},
+	{1000270760, "Co76"},
+	{1000280480, "Ni48"},
+	{1000280490, "Ni49"},
+	{1000280500, "Ni50"},
+	{1000280510, "Ni51"},
+	{1000280520, "Ni52"},
+	{1000280530, "Ni53"},
+	{1000280540, "Ni54"},
+	{1000280550, "Ni55"},
+	{1000280560, "Ni56"},
+	{1000280570, "Ni57"},
+	{1000280580, "Ni58"},
+	{1000280590, "Ni59"},
+	{1000280600, "Ni60"},
+	{1000280610, "Ni61"},
+	{1000280620, "Ni62"},
+	{1000280630, "Ni63"},
+	{1000280631, "Ni63[87.150]"},
+	{1000280640, "Ni64"},
+	{1000280650, "Ni65"},
+	{1000280651, "Ni65[63.370]"},
+	{1000280660, "Ni66"},
+	{1000280670, "Ni67"},
+	{1000280671, "Ni67[1007.200]"},
+	{1000280680, "Ni68"},
+	{1000280681, "Ni68[2849.100]"},
+	{1000280690, "Ni69"},
+	{1000280691, "Ni69[321.000]"},
+	{1000280700, "Ni70"},
+	{1000280710, "Ni71"},
+	{1000280711, "Ni71[499.000]"},
+	{1000280720, "Ni72"},
+	{1000280730, "Ni73"},
+	{1000280740, "Ni74"},
+	{1000280750, "Ni75"},
+	{1000280760, "Ni76"},
+	{1000280770, "Ni77"},
+	{1000280780, "Ni78"},
+	{1000280790, "Ni79"},
+	{1000290530, "Cu53"},
+	{1000290540, "Cu54"},
+	{1000290550, "Cu55"},
+	{1000290560, "Cu56"},
+	{1000290570, "Cu57"},
+	{1000290580, "Cu58"},
+	{1000290590, "Cu59"},
+	{1000290600, "Cu60"},
+	{1000290610, "Cu61"},
+	{1000290620, "Cu62"},
+	{1000290630, "Cu63"},
+	{1000290640, "Cu64"},
+	{1000290650, "Cu65"},
+	{1000290660, "Cu66"},
+	{1000290670, "Cu67"},
+	{1000290680, "Cu68"},
+	{1000290681, "Cu68[721.260]"},
+	{1000290690, "Cu69"},
+	{1000290700, "Cu70"},
+	{1000290701, "Cu70[101.100]"},
+	{1000290702, "Cu70[242.600]"},
+	{1000290710, "Cu71"},
+	{1000290720, "Cu72"},
+	{1000290721, "Cu72[270.300]"},
+	{1000290730, "Cu73"},
+	{1000290740, "Cu74"},
+	{1000290750, "Cu75"},
+	{1000290761, "Cu76[0.000]"},
+	{1000290770, "Cu77"},
+	{1000290780, "Cu78"},
+	{1000290790, "Cu79"},
+	{1000290800, "Cu80"},
+	{1000290810, "Cu81"},
+	{1000290820, "Cu82"},
+	{1000300540, "Zn54"},
+	{1000300550, "Zn55"},
+	{1000300560, "Zn56"},
+	{1000300570, "Zn57"},
+	{1000300580, "Zn58"},
+	{1000300590, "Zn59"},
+	{1000300600, "Zn60"},
+	{1000300610, "Zn61"},
+	{1000300611, "Zn61[88.400]"},
+	{1000300612, "Zn61[418.100]"},
+	{1000300613, "Zn61[756.020]"},
+	{1000300620, "Zn62"},
+	{1000300630, "Zn63"},
+	{1000300640, "Zn64"},
+	{1000300650, "Zn65"},
+	{1000300651, "Zn65[53.928]"},
+	{1000300660, "Zn66"},
+	{1000300670, "Zn67"},
+	{1000300671, "Zn67[93.312]"},
+	{1000300680, "Zn68"},
+	{1000300690, "Zn69"},
+	{1000300691, "Zn69[438.636]"},
+	{1000300700, "Zn70"},
+	{1000300710, "Zn71"},
+	{1000300711, "Zn71[157.700]"},
+	{1000300720, "Zn72"},
+	{1000300730, "Zn73"},
+	{1000300732, "Zn73[195.500]"},
+	{1000300740, "Zn74"},
+	{1000300750, "Zn75"},
+	{1000300760, "Zn76"},
+	{1000300770, "Zn77"},
+	{1000300771, "Zn77[772.440]"},
+	{1000300780, "Zn78"},
+	{1000300790, "Zn79"},
+	{1000300800, "Zn80"},
+	{1000300810, "Zn81"},
+	{1000300820, "Zn82"},
+	{1000300830, "Zn83"},
+	{1000300840, "Zn84"},
+	{1000300850, "Zn85"},
+	{1000310600, "Ga60"},
+	{1000310610, "Ga61"},
+	{1000310620, "Ga62"},
+	{1000310630, "Ga63"},
+	{1000310640, "Ga64"},
+	{1000310641, "Ga64[42.850]"},
+	{1000310650, "Ga65"},
+	{1000310660, "Ga66"},
+	{1000310670, "Ga67"},
+	{1000310680, "Ga68"},
+	{1000310690, "Ga69"},
+	{1000310700, "Ga70"},
+	{1000310710, "Ga71"},
+	{1000310720, "Ga72"},
+	{1000310721, "Ga72[119.660]"},
+	{1000310730, "Ga73"},
+	{1000310740, "Ga74"},
+	{1000310741, "Ga74[59.571]"},
+	{1000310750, "Ga75"},
+	{1000310760, "Ga76"},
+	{1000310770, "Ga77"},
+	{1000310780, "Ga78"},
+	{1000310790, "Ga79"},
+	{1000310800, "Ga80"},
+	{1000310801, "Ga80[22.400]"},
+	{1000310810, "Ga81"},
+	{1000310820, "Ga82"},
+	{1000310830, "Ga83"},
+	{1000310840, "Ga84"},
+	{1000310850, "Ga85"},
+	{1000310860, "Ga86"},
+	{1000310870, "Ga87"},
+	{1000320600, "Ge60"},
+	{1000320610, "Ge61"},
+	{1000320620, "Ge62"},
+	{1000320630, "Ge63"},
+	{1000320640, "Ge64"},
+	{1000320650, "Ge65"},
+	{1000320660, "Ge66"},
+	{1000320670, "Ge67"},
+	{1000320671, "Ge67[18.200]"},
+	{1000320680, "Ge68"},
+	{1000320690, "Ge69"},
+	{1000320691, "Ge69[86.760]"},
+	{1000320692, "Ge69[397.940]"},
+	{1000320700, "Ge70"},
+	{1000320710, "Ge71"},
+	{1000320711, "Ge71[198.354]"},
+	{1000320720, "Ge72"},
+	{1000320730, "Ge73"},
+	{1000320731, "Ge73[13.285]"},
+	{1000320732, "Ge73[66.726]"},
+	{1000320740, "Ge74"},
+	{1000320750, "Ge75"},
+	{1000320751, "Ge75[139.690]"},
+	{1000320760, "Ge76"},
+	{1000320770, "Ge77"},
+	{1000320771, "Ge77[159.710]"},
+	{1000320780, "Ge78"},
+	{1000320790, "Ge79"},
+	{1000320791, "Ge79[185.950]"},
+	{1000320800, "Ge80"},
+	{1000320810, "Ge81"},
+	{1000320811, "Ge81[679.140]"},
+	{1000320820, "Ge82"},
+	{1000320830, "Ge83"},
+	{1000320840, "Ge84"},
+	{1000320850, "Ge85"},
+	{1000320860, "Ge86"},
+	{1000320870, "Ge87"},
+	{1000320880, "Ge88"},
+	{1000320890, "Ge89"},
+	{1000320900, "Ge90"},
+	{1000330630, "As63"},
+	{1000330640, "As64"},
+	{1000330650, "As65"},
+	{1000330660, "As66"},
+	{1000330661, "As66[1356.630]"},
+	{1000330662, "As66[3023.800]"},
+	{1000330670, "As67"},
+	{1000330680, "As68"},
+	{1000330690, "As69"},
+	{1000330700, "As70"},
+	{1000330701, "As70[32.008]"},
+	{1000330710, "As71"},
+	{1000330720, "As72"},
+	{1000330730, "As73"},
+	{1000330731, "As73[427.906]"},
+	{1000330740, "As74"},
+	{1000330750, "As75"},
+	{1000330751, "As75[303.924]"},
+	{1000330760, "As76"},
+	{1000330761, "As76[44.425]"},
+	{1000330770, "As77"},
+	{1000330771, "As77[475.480]"},
+	{1000330780, "As78"},
+	{1000330790, "As79"},
+	{1000330800, "As80"},
+	{1000330810, "As81"},
+	{1000330820, "As82"},
+	{1000330830, "As83"},
+	{1000330840, "As84"},
+	{1000330850, "As85"},
+	{1000330860, "As86"},
+	{1000330870, "As87"},
+	{1000330880, "As88"},
+	{1000330890, "As89"},
+	{1000330900, "As90"},
+	{1000340640, "Se64"},
+	{1000340650, "Se65"},
+	{1000340660, "Se66"},
+	{1000340670, "Se67"},
+	{1000340680, "Se68"},
+	{1000340690, "Se69"},
+	{1000340691, "Se69[38.850]"},
+	{1000340700, "Se70"},
+	{1000340710, "Se71"},
+	{1000340711, "Se71[48.790]"},
+	{1000340712, "Se71[260.480]"},
+	{1000340720, "Se72"},
+	{1000340730, "Se73"},
+	{1000340731, "Se73[25.710]"},
+	{1000340740, "Se74"},
+	{1000340750, "Se75"},
+	{1000340760, "Se76"},
+	{1000340770, "Se77"},
+	{1000340771, "Se77[161.922]"},
+	{1000340780, "Se78"},
+	{1000340790, "Se79"},
+	{1000340791, "Se79[95.770]"},
+	{1000340800, "Se80"},
+	{1000340810, "Se81"},
+	{1000340811, "Se81[103.000]"},
+	{1000340820, "Se82"},
+	{1000340830, "Se83"},
+	{1000340831, "Se83[228.500]"},
+	{1000340840, "Se84"},
+	{1000340850, "Se85"},
+	{1000340860, "Se86"},
+	{1000340870, "Se87"},
+	{1000340880, "Se88"},
+	{1000340890, "Se89"},
+	{1000340900, "Se90"},
+	{1000340910, "Se91"},
+	{1000340940, "Se94"},
+	{1000340950, "Se95"},
+	{1000350700, "Br70"},
+	{1000350701, "Br70[2292.300]"},
+	{1000350710, "Br71"},
+	{1000350720, "Br72"},
+	{1000350721, "Br72[100.760]"},
+	{1000350730, "Br73"},
+	{1000350740, "Br74"},
+	{1000350741, "Br74[13.580]"},
+	{1000350750, "Br75"},
+	{1000350760, "Br76"},
+	{1000350761, "Br76[102.580]"},
+	{1000350770, "Br77"},
+	{1000350771, "Br77[105.860]"},
+	{1000350780, "Br78"},
+	{1000350781, "Br78[180.890]"},
+	{1000350790, "Br79"},
+	{1000350791, "Br79[207.610]"},
+	{1000350800, "Br80"},
+	{1000350801, "Br80[85.843]"},
+	{1000350810, "Br81"},
+	{1000350811, "Br81[536.200]"},
+	{1000350820, "Br82"},
+	{1000350821, "Br82[45.949]"},
+	{1000350830, "Br83"},
+	{1000350840, "Br84"},
+	{1000350841, "Br84[320.000]"},
+	{1000350850, "Br85"},
+	{1000350860, "Br86"},
+	{1000350870, "Br87"},
+	{1000350880, "Br88"},
+	{1000350881, "Br88[270.100]"},
+	{1000350890, "Br89"},
+	{1000350900, "Br90"},
+	{1000350910, "Br91"},
+	{1000350920, "Br92"},
+	{1000350930, "Br93"},
+	{1000350940, "Br94"},
+	{1000350950, "Br95"},
+	{1000350960, "Br96"},
+	{1000350970, "Br97"},
+	{1000350980, "Br98"},
+	{1000360690, "Kr69"},
+	{1000360700, "Kr70"},
+	{1000360710, "Kr71"},
+	{1000360720, "Kr72"},
+	{1000360730, "Kr73"},
+	{1000360740, "Kr74"},
+	{1000360750, "Kr75"},
+	{1000360760, "Kr76"},
+	{1000360770, "Kr77"},
+	{1000360780, "Kr78"},
+	{1000360790, "Kr79"},
+	{1000360791, "Kr79[129.770]"},
+	{1000360800, "Kr80"},
+	{1000360810, "Kr81"},
+	{1000360811, "Kr81[190.640]"},
+	{1000360820, "Kr82"},
+	{1000360830, "Kr83"},
+	{1000360831, "Kr83[41.557]"},
+	{1000360840, "Kr84"},
+	{1000360841, "Kr84[3236.070]"},
+	{1000360850, "Kr85"},
+	{1000360851, "Kr85[304.871]"},
+	{1000360852, "Kr85[1991.800]"},
+	{1000360860, "Kr86"},
+	{1000360870, "Kr87"},
+	{1000360880, "Kr88"},
+	{1000360890, "Kr89"},
+	{1000360900, "Kr90"},
+	{1000360910, "Kr91"},
+	{1000360920, "Kr92"},
+	{1000360930, "Kr93"},
+	{1000360940, "Kr94"},
+	{1000360950, "Kr95"},
+	{1000360951, "Kr95[195.500]"},
+	{1000360960, "Kr96"},
+	{1000360970, "Kr97"},
+	{1000360980, "Kr98"},
+	{1000360990, "Kr99"},
+	{1000361000, "Kr100"},
+	{1000361010, "Kr101"},
+	{1000370730, "Rb73"},
+	{1000370740, "Rb74"},
+	{1000370750, "Rb75"},
+	{1000370760, "Rb76"},
+	{1000370761, "Rb76[316.930]"},
+	{1000370770, "Rb77"},
+	{1000370780, "Rb78"},
+	{1000370781, "Rb78[111.190]"},
+	{1000370790, "Rb79"},
+	{1000370800, "Rb80"},
+	{1000370801, "Rb80[493.900]"},
+	{1000370810, "Rb81"},
+	{1000370811, "Rb81[86.310]"},
+	{1000370820, "Rb82"},
+	{1000370821, "Rb82[69.000]"},
+	{1000370830, "Rb83"},
+	{1000370831, "Rb83[42.110]"},
+	{1000370840, "Rb84"},
+	{1000370841, "Rb84[463.590]"},
+	{1000370850, "Rb85"},
+	{1000370851, "Rb85[514.006]"},
+	{1000370860, "Rb86"},
+	{1000370861, "Rb86[556.050]"},
+	{1000370870, "Rb87"},
+	{1000370880, "Rb88"},
+	{1000370890, "Rb89"},
+	{1000370900, "Rb90"},
+	{1000370901, "Rb90[106.900]"},
+	{1000370910, "Rb91"},
+	{1000370920, "Rb92"},
+	{1000370930, "Rb93"},
+	{1000370940, "Rb94"},
+	{1000370950, "Rb95"},
+	{1000370960, "Rb96"},
+	{1000370961, "Rb96[1134.600]"},
+	{1000370970, "Rb97"},
+	{1000370980, "Rb98"},
+	{1000370981, "Rb98[270.000]"},
+	{1000370990, "Rb99"},
+	{1000371000, "Rb100"},
+	{1000371010, "Rb101"},
+	{1000371020, "Rb102"},
+	{1000371030, "Rb103"},
+	{1000380730, "Sr73"},
+	{1000380740, "Sr74"},
+	{1000380750, "Sr75"},
+	{1000380760, "Sr76"},
+	{1000380770, "Sr77"},
+	{1000380780, "Sr78"},
+	{1000380790, "Sr79"},
+	{1000380800, "Sr80"},
+	{1000380810, "Sr81"},
+	{1000380811, "Sr81[89.050]"},
+	{1000380820, "Sr82"},
+	{1000380830, "Sr83"},
+	{1000380831, "Sr83[259.150]"},
+	{1000380840, "Sr84"},
+	{1000380850, "Sr85"},
+	{1000380851, "Sr85[238.790]"},
+	{1000380860, "Sr86"},
+	{1000380870, "Sr87"},
+	{1000380871, "Sr87[388.533]"},
+	{1000380880, "Sr88"},
+	{1000380890, "Sr89"},
+	{1000380900, "Sr90"},
+	{1000380910, "Sr91"},
+	{1000380920, "Sr92"},
+	{1000380930, "Sr93"},
+	{1000380940, "Sr94"},
+	{1000380950, "Sr95"},
+	{1000380960, "Sr96"},
+	{1000380970, "Sr97"},
+	{1000380980, "Sr98"},
+	{1000380990, "Sr99"},
+	{1000381000, "Sr100"},
+	{1000381010, "Sr101"},
+	{1000381020, "Sr102"},
+	{1000381030, "Sr103"},
+	{1000381060, "Sr106"},
+	{1000381070, "Sr107"},
+	{1000390760, "Y76"},
+	{1000390770, "Y77"},
+	{1000390780, "Y78"},
+	{1000390790, "Y79"},
+	{1000390800, "Y80"},
+	{1000390801, "Y80[228.500]"},
+	{1000390802, "Y80[312.600]"},
+	{1000390810, "Y81"},
+	{1000390820, "Y82"},
+	{1000390830, "Y83"},
+	{1000390831, "Y83[61.980]"},
+	{1000390840, "Y84"},
+	{1000390841, "Y84[67.000]"},
+	{1000390850, "Y85"},
+	{1000390851, "Y85[19.680]"},
+	{1000390860, "Y86"},
+	{1000390861, "Y86[218.210]"},
+	{1000390870, "Y87"},
+	{1000390871, "Y87[380.820]"},
+	{1000390880, "Y88"},
+	{1000390881, "Y88[392.860]"},
+	{1000390882, "Y88[674.550]"},
+	{1000390890, "Y89"},
+	{1000390891, "Y89[908.970]"},
+	{1000390900, "Y90"},
+	{1000390901, "Y90[681.670]"},
+	{1000390910, "Y91"},
+	{1000390911, "Y91[555.580]"},
+	{1000390920, "Y92"},
+	{1000390930, "Y93"},
+	{1000390931, "Y93[758.719]"},
+	{1000390940, "Y94"},
+	{1000390941, "Y94[1202.300]"},
+	{1000390950, "Y95"},
+	{1000390951, "Y95[1087.600]"},
+	{1000390960, "Y96"},
+	{1000390961, "Y96[1140.000]"},
+	{1000390970, "Y97"},
+	{1000390971, "Y97[667.520]"},
+	{1000390972, "Y97[3522.600]"},
+	{1000390980, "Y98"},
+	{1000390981, "Y98[410.000]"},
+	{1000390982, "Y98[496.190]"},
+	{1000390990, "Y99"},
+	{1000390991, "Y99[2141.650]"},
+	{1000391000, "Y100"},
+	{1000391001, "Y100[145.000]"},
+	{1000391010, "Y101"},
+	{1000391021, "Y102[0.000]"},
+	{1000391030, "Y103"},
+	{1000391040, "Y104"},
+	{1000391060, "Y106"},
+	{1000391070, "Y107"},
+	{1000391080, "Y108"},
+	{1000391090, "Y109"},
+	{1000400780, "Zr78"},
+	{1000400790, "Zr79"},
+	{1000400800, "Zr80"},
+	{1000400810, "Zr81"},
+	{1000400820, "Zr82"},
+	{1000400830, "Zr83"},
+	{1000400840, "Zr84"},
+	{1000400850, "Zr85"},
+	{1000400851, "Zr85[292.200]"},
+	{1000400860, "Zr86"},
+	{1000400870, "Zr87"},
+	{1000400871, "Zr87[335.840]"},
+	{1000400880, "Zr88"},
+	{1000400881, "Zr88[2887.790]"},
+	{1000400890, "Zr89"},
+	{1000400891, "Zr89[587.820]"},
+	{1000400900, "Zr90"},
+	{1000400901, "Zr90[2319.000]"},
+	{1000400910, "Zr91"},
+	{1000400911, "Zr91[3167.300]"},
+	{1000400920, "Zr92"},
+	{1000400930, "Zr93"},
+	{1000400940, "Zr94"},
+	{1000400950, "Zr95"},
+	{1000400960, "Zr96"},
+	{1000400970, "Zr97"},
+	{1000400980, "Zr98"},
+	{1000400990, "Zr99"},
+	{1000401000, "Zr100"},
+	{1000401010, "Zr101"},
+	{1000401020, "Zr102"},
+	{1000401030, "Zr103"},
+	{1000401040, "Zr104"},
+	{1000401050, "Zr105"},
+	{1000401060, "Zr106"},
+	{1000401070, "Zr107"},
+	{1000401080, "Zr108"},
+	{1000401100, "Zr110"},
+	{1000401110, "Zr111"},
+	{1000401120, "Zr112"},
+	{1000410810, "Nb81"},
+	{1000410820, "Nb82"},
+	{1000410830, "Nb83"},
+	{1000410840, "Nb84"},
+	{1000410850, "Nb85"},
+	{1000410852, "Nb85[69.000]"},
+	{1000410860, "Nb86"},
+	{1000410870, "Nb87"},
+	{1000410871, "Nb87[3.840]"},
+	{1000410880, "Nb88"},
+	{1000410890, "Nb89"},
+	{1000410891, "Nb89[35.000]"},
+	{1000410900, "Nb90"},
+	{1000410901, "Nb90[122.370]"},
+	{1000410902, "Nb90[124.670]"},
+	{1000410903, "Nb90[382.010]"},
+	{1000410910, "Nb91"},
+	{1000410911, "Nb91[104.600]"},
+	{1000410912, "Nb91[2034.420]"},
+	{1000410920, "Nb92"},
+	{1000410921, "Nb92[135.500]"},
+	{1000410922, "Nb92[225.800]"},
+	{1000410930, "Nb93"},
+	{1000410931, "Nb93[30.770]"},
+	{1000410932, "Nb93[7435.300]"},
+	{1000410940, "Nb94"},
+	{1000410941, "Nb94[40.892]"},
+	{1000410950, "Nb95"},
+	{1000410951, "Nb95[235.690]"},
+	{1000410960, "Nb96"},
+	{1000410970, "Nb97"},
+	{1000410971, "Nb97[743.350]"},
+	{1000410980, "Nb98"},
+	{1000410981, "Nb98[84.000]"},
+	{1000410990, "Nb99"},
+	{1000410991, "Nb99[365.270]"},
+	{1000411000, "Nb100"},
+	{1000411001, "Nb100[314.000]"},
+	{1000411002, "Nb100[420.700]"},
+	{1000411010, "Nb101"},
+	{1000411020, "Nb102"},
+	{1000411030, "Nb103"},
+	{1000411040, "Nb104"},
+	{1000411041, "Nb104[215.000]"},
+	{1000411050, "Nb105"},
+	{1000411060, "Nb106"},
+	{1000411070, "Nb107"},
+	{1000411080, "Nb108"},
+	{1000411090, "Nb109"},
+	{1000411100, "Nb110"},
+	{1000411110, "Nb111"},
+	{1000411120, "Nb112"},
+	{1000411130, "Nb113"},
+	{1000411140, "Nb114"},
+	{1000420830, "Mo83"},
+	{1000420840, "Mo84"},
+	{1000420850, "Mo85"},
+	{1000420860, "Mo86"},
+	{1000420870, "Mo87"},
+	{1000420880, "Mo88"},
+	{1000420890, "Mo89"},
+	{1000420891, "Mo89[387.500]"},
+	{1000420900, "Mo90"},
+	{1000420901, "Mo90[2874.730]"},
+	{1000420910, "Mo91"},
+	{1000420911, "Mo91[653.010]"},
+	{1000420920, "Mo92"},
+	{1000420930, "Mo93"},
+	{1000420931, "Mo93[2424.950]"},
+	{1000420932, "Mo93[9670.000]"},
+	{1000420940, "Mo94"},
+	{1000420950, "Mo95"},
+	{1000420960, "Mo96"},
+	{1000420970, "Mo97"},
+	{1000420980, "Mo98"},
+	{1000420990, "Mo99"},
+	{1000420991, "Mo99[97.785]"},
+	{1000421000, "Mo100"},
+	{1000421010, "Mo101"},
+	{1000421020, "Mo102"},
+	{1000421030, "Mo103"},
+	{1000421040, "Mo104"},
+	{1000421050, "Mo105"},
+	{1000421060, "Mo106"},
+	{1000421070, "Mo107"},
+	{1000421080, "Mo108"},
+	{1000421090, "Mo109"},
+	{1000421100, "Mo110"},
+	{1000421110, "Mo111"},
+	{1000421120, "Mo112"},
+	{1000421130, "Mo113"},
+	{1000421140, "Mo114"},
+	{1000421150, "Mo115"},
+	{1000421160, "Mo116"},
+	{1000421170, "Mo117"},
+	{1000430850, "Tc85"},
+	{1000430860, "Tc86"},
+	{1000430861, "Tc86[1524.000]"},
+	{1000430870, "Tc87"},
+	{1000430881, "Tc88[0.000]"},
+	{1000430890, "Tc89"},
+	{1000430891, "Tc89[62.600]"},
+	{1000430901, "Tc90[0.000]"},
+	{1000430902, "Tc90[500.000]"},
+	{1000430910, "Tc91"},
+	{1000430911, "Tc91[139.300]"},
+	{1000430920, "Tc92"},
+	{1000430921, "Tc92[270.090]"},
+	{1000430930, "Tc93"},
+	{1000430931, "Tc93[391.840]"},
+	{1000430932, "Tc93[2185.160]"},
+	{1000430940, "Tc94"},
+	{1000430941, "Tc94[76.000]"},
+	{1000430950, "Tc95"},
+	{1000430951, "Tc95[38.910]"},
+	{1000430960, "Tc96"},
+	{1000430961, "Tc96[34.230]"},
+	{1000430970, "Tc97"},
+	{1000430971, "Tc97[96.570]"},
+	{1000430980, "Tc98"},
+	{1000430981, "Tc98[90.760]"},
+	{1000430990, "Tc99"},
+	{1000430991, "Tc99[142.683]"},
+	{1000431000, "Tc100"},
+	{1000431001, "Tc100[200.670]"},
+	{1000431002, "Tc100[243.950]"},
+	{1000431010, "Tc101"},
+	{1000431011, "Tc101[207.526]"},
+	{1000431020, "Tc102"},
+	{1000431030, "Tc103"},
+	{1000431040, "Tc104"},
+	{1000431041, "Tc104[69.700]"},
+	{1000431050, "Tc105"},
+	{1000431060, "Tc106"},
+	{1000431070, "Tc107"},
+	{1000431071, "Tc107[30.100]"},
+	{1000431080, "Tc108"},
+	{1000431090, "Tc109"},
+	{1000431100, "Tc110"},
+	{1000431110, "Tc111"},
+	{1000431120, "Tc112"},
+	{1000431130, "Tc113"},
+	{1000431141, "Tc114[0.000]"},
+	{1000431150, "Tc115"},
+	{1000431160, "Tc116"},
+	{1000431170, "Tc117"},
+	{1000431180, "Tc118"},
+	{1000431190, "Tc119"},
+	{1000431200, "Tc120"},
+	{1000440880, "Ru88"},
+	{1000440890, "Ru89"},
+	{1000440900, "Ru90"},
+	{1000440910, "Ru91"},
+	{1000440920, "Ru92"},
+	{1000440930, "Ru93"},
+	{1000440931, "Ru93[734.400]"},
+	{1000440932, "Ru93[2082.500]"},
+	{1000440940, "Ru94"},
+	{1000440941, "Ru94[2644.100]"},
+	{1000440950, "Ru95"},
+	{1000440960, "Ru96"},
+	{1000440970, "Ru97"},
+	{1000440980, "Ru98"},
+	{1000440990, "Ru99"},
+	{1000441000, "Ru100"},
+	{1000441010, "Ru101"},
+	{1000441011, "Ru101[527.560]"},
+	{1000441020, "Ru102"},
+	{1000441030, "Ru103"},
+	{1000441031, "Ru103[238.200]"},
+	{1000441040, "Ru104"},
+	{1000441050, "Ru105"},
+	{1000441060, "Ru106"},
+	{1000441070, "Ru107"},
+	{1000441080, "Ru108"},
+	{1000441090, "Ru109"},
+	{1000441100, "Ru110"},
+	{1000441110, "Ru111"},
+	{1000441120, "Ru112"},
+	{1000441130, "Ru113"},
+	{1000441140, "Ru114"},
+	{1000441150, "Ru115"},
+	{1000441151, "Ru115[61.700]"},
+	{1000441160, "Ru116"},
+	{1000441170, "Ru117"},
+	{1000441180, "Ru118"},
+	{1000441190, "Ru119"},
+	{1000441200, "Ru120"},
+	{1000441210, "Ru121"},
+	{1000441220, "Ru122"},
+	{1000441230, "Ru123"},
+	{1000441240, "Ru124"},
+	{1000450900, "Rh90"},
+	{1000450910, "Rh91"},
+	{1000450911, "Rh91[172.900]"},
+	{1000450920, "Rh92"},
+	{1000450930, "Rh93"},
+	{1000450940, "Rh94"},
+	{1000450950, "Rh95"},
+	{1000450951, "Rh95[543.300]"},
+	{1000450960, "Rh96"},
+	{1000450961, "Rh96[51.980]"},
+	{1000450970, "Rh97"},
+	{1000450971, "Rh97[258.760]"},
+	{1000450980, "Rh98"},
+	{1000450990, "Rh99"},
+	{1000450991, "Rh99[64.600]"},
+	{1000451000, "Rh100"},
+	{1000451001, "Rh100[107.600]"},
+	{1000451010, "Rh101"},
+	{1000451011, "Rh101[157.320]"},
+	{1000451020, "Rh102"},
+	{1000451021, "Rh102[140.730]"},
+	{1000451030, "Rh103"},
+	{1000451031, "Rh103[39.753]"},
+	{1000451040, "Rh104"},
+	{1000451041, "Rh104[128.968]"},
+	{1000451050, "Rh105"},
+	{1000451051, "Rh105[129.782]"},
+	{1000451060, "Rh106"},
+	{1000451061, "Rh106[137.000]"},
+	{1000451070, "Rh107"},
+	{1000451071, "Rh107[268.360]"},
+	{1000451080, "Rh108"},
+	{1000451090, "Rh109"},
+	{1000451091, "Rh109[225.974]"},
+	{1000451100, "Rh110"},
+	{1000451110, "Rh111"},
+	{1000451120, "Rh112"},
+	{1000451130, "Rh113"},
+	{1000451140, "Rh114"},
+	{1000451150, "Rh115"},
+	{1000451160, "Rh116"},
+	{1000451161, "Rh116[150.000]"},
+	{1000451170, "Rh117"},
+	{1000451180, "Rh118"},
+	{1000451190, "Rh119"},
+	{1000451200, "Rh120"},
+	{1000451210, "Rh121"},
+	{1000451220, "Rh122"},
+	{1000451230, "Rh123"},
+	{1000451240, "Rh124"},
+	{1000451250, "Rh125"},
+	{1000451260, "Rh126"},
+	{1000460920, "Pd92"},
+	{1000460930, "Pd93"},
+	{1000460940, "Pd94"},
+	{1000460950, "Pd95"},
+	{1000460951, "Pd95[1875.130]"},
+	{1000460960, "Pd96"},
+	{1000460961, "Pd96[2530.570]"},
+	{1000460970, "Pd97"},
+	{1000460980, "Pd98"},
+	{1000460990, "Pd99"},
+	{1000461000, "Pd100"},
+	{1000461010, "Pd101"},
+	{1000461020, "Pd102"},
+	{1000461030, "Pd103"},
+	{1000461040, "Pd104"},
+	{1000461050, "Pd105"},
+	{1000461051, "Pd105[489.140]"},
+	{1000461060, "Pd106"},
+	{1000461070, "Pd107"},
+	{1000461071, "Pd107[214.600]"},
+	{1000461080, "Pd108"},
+	{1000461090, "Pd109"},
+	{1000461091, "Pd109[188.990]"},
+	{1000461100, "Pd110"},
+	{1000461110, "Pd111"},
+	{1000461111, "Pd111[172.180]"},
+	{1000461120, "Pd112"},
+	{1000461130, "Pd113"},
+	{1000461131, "Pd113[81.100]"},
+	{1000461140, "Pd114"},
+	{1000461150, "Pd115"},
+	{1000461151, "Pd115[89.210]"},
+	{1000461160, "Pd116"},
+	{1000461170, "Pd117"},
+	{1000461171, "Pd117[203.300]"},
+	{1000461180, "Pd118"},
+	{1000461190, "Pd119"},
+	{1000461200, "Pd120"},
+	{1000461210, "Pd121"},
+	{1000461220, "Pd122"},
+	{1000461230, "Pd123"},
+	{1000461240, "Pd124"},
+	{1000461241, "Pd124[62.200]"},
+	{1000461250, "Pd125"},
+	{1000461260, "Pd126"},
+	{1000461280, "Pd128"},
+	{1000461281, "Pd128[2151.000]"},
+	{1000470940, "Ag94"},
+	{1000470942, "Ag94[6670.000]"},
+	{1000470950, "Ag95"},
+	{1000470951, "Ag95[344.200]"},
+	{1000470952, "Ag95[2531.300]"},
+	{1000470953, "Ag95[4860.000]"},
+	{1000470961, "Ag96[0.000]"},
+	{1000470970, "Ag97"},
+	{1000470980, "Ag98"},
+	{1000470990, "Ag99"},
+	{1000470991, "Ag99[506.200]"},
+	{1000471000, "Ag100"},
+	{1000471001, "Ag100[15.520]"},
+	{1000471010, "Ag101"},
+	{1000471011, "Ag101[274.100]"},
+	{1000471020, "Ag102"},
+	{1000471021, "Ag102[9.400]"},
+	{1000471030, "Ag103"},
+	{1000471031, "Ag103[134.450]"},
+	{1000471040, "Ag104"},
+	{1000471041, "Ag104[6.900]"},
+	{1000471050, "Ag105"},
+	{1000471051, "Ag105[25.479]"},
+	{1000471060, "Ag106"},
+	{1000471061, "Ag106[89.660]"},
+	{1000471070, "Ag107"},
+	{1000471071, "Ag107[93.125]"},
+	{1000471080, "Ag108"},
+	{1000471081, "Ag108[109.466]"},
+	{1000471090, "Ag109"},
+	{1000471091, "Ag109[88.034]"},
+	{1000471100, "Ag110"},
+	{1000471101, "Ag110[117.590]"},
+	{1000471110, "Ag111"},
+	{1000471111, "Ag111[59.820]"},
+	{1000471120, "Ag112"},
+	{1000471130, "Ag113"},
+	{1000471131, "Ag113[43.500]"},
+	{1000471140, "Ag114"},
+	{1000471141, "Ag114[199.000]"},
+	{1000471150, "Ag115"},
+	{1000471151, "Ag115[41.160]"},
+	{1000471160, "Ag116"},
+	{1000471161, "Ag116[47.900]"},
+	{1000471162, "Ag116[129.800]"},
+	{1000471170, "Ag117"},
+	{1000471171, "Ag117[28.600]"},
+	{1000471180, "Ag118"},
+	{1000471181, "Ag118[127.630]"},
+	{1000471191, "Ag119[0.000]"},
+	{1000471200, "Ag120"},
+	{1000471201, "Ag120[203.000]"},
+	{1000471210, "Ag121"},
+	{1000471220, "Ag122"},
+	{1000471222, "Ag122[80.000]"},
+	{1000471230, "Ag123"},
+	{1000471240, "Ag124"},
+	{1000471250, "Ag125"},
+	{1000471260, "Ag126"},
+	{1000471270, "Ag127"},
+	{1000471280, "Ag128"},
+	{1000471290, "Ag129"},
+	{1000480960, "Cd96"},
+	{1000480970, "Cd97"},
+	{1000480980, "Cd98"},
+	{1000480990, "Cd99"},
+	{1000481000, "Cd100"},
+	{1000481010, "Cd101"},
+	{1000481020, "Cd102"},
+	{1000481030, "Cd103"},
+	{1000481040, "Cd104"},
+	{1000481050, "Cd105"},
+	{1000481060, "Cd106"},
+	{1000481070, "Cd107"},
+	{1000481080, "Cd108"},
+	{1000481090, "Cd109"},
+	{1000481091, "Cd109[59.490]"},
+	{1000481092, "Cd109[463.500]"},
+	{1000481100, "Cd110"},
+	{1000481110, "Cd111"},
+	{1000481111, "Cd111[396.214]"},
+	{1000481120, "Cd112"},
+	{1000481130, "Cd113"},
+	{1000481131, "Cd113[263.540]"},
+	{1000481140, "Cd114"},
+	{1000481150, "Cd115"},
+	{1000481151, "Cd115[181.000]"},
+	{1000481160, "Cd116"},
+	{1000481170, "Cd117"},
+	{1000481171, "Cd117[136.400]"},
+	{1000481180, "Cd118"},
+	{1000481190, "Cd119"},
+	{1000481191, "Cd119[146.540]"},
+	{1000481200, "Cd120"},
+	{1000481210, "Cd121"},
+	{1000481211, "Cd121[214.860]"},
+	{1000481220, "Cd122"},
+	{1000481230, "Cd123"},
+	{1000481231, "Cd123[316.530]"},
+	{1000481240, "Cd124"},
+	{1000481250, "Cd125"},
+	{1000481260, "Cd126"},
+	{1000481270, "Cd127"},
+	{1000481280, "Cd128"},
+	{1000481290, "Cd129"},
+	{1000481292, "Cd129[1940.000]"},
+	{1000481300, "Cd130"},
+	{1000481310, "Cd131"},
+	{1000481320, "Cd132"},
+	{1000481330, "Cd133"},
+	{1000490981, "In98[0.000]"},
+	{1000490990, "In99"},
+	{1000491000, "In100"},
+	{1000491010, "In101"},
+	{1000491020, "In102"},
+	{1000491030, "In103"},
+	{1000491031, "In103[631.700]"},
+	{1000491040, "In104"},
+	{1000491041, "In104[93.480]"},
+	{1000491050, "In105"},
+	{1000491051, "In105[674.080]"},
+	{1000491060, "In106"},
+	{1000491061, "In106[28.600]"},
+	{1000491070, "In107"},
+	{1000491071, "In107[678.500]"},
+	{1000491080, "In108"},
+	{1000491081, "In108[29.750]"},
+	{1000491090, "In109"},
+	{1000491091, "In109[650.100]"},
+	{1000491092, "In109[2101.800]"},
+	{1000491100, "In110"},
+	{1000491101, "In110[62.080]"},
+	{1000491110, "In111"},
+	{1000491111, "In111[536.990]"},
+	{1000491120, "In112"},
+	{1000491121, "In112[156.592]"},
+	{1000491122, "In112[613.820]"},
+	{1000491130, "In113"},
+	{1000491131, "In113[391.699]"},
+	{1000491140, "In114"},
+	{1000491141, "In114[190.268]"},
+	{1000491142, "In114[501.948]"},
+	{1000491150, "In115"},
+	{1000491151, "In115[336.244]"},
+	{1000491160, "In116"},
+	{1000491161, "In116[127.267]"},
+	{1000491162, "In116[289.660]"},
+	{1000491170, "In117"},
+	{1000491171, "In117[315.303]"},
+	{1000491180, "In118"},
+	{1000491181, "In118[60.000]"},
+	{1000491182, "In118[200.000]"},
+	{1000491190, "In119"},
+	{1000491191, "In119[311.370]"},
+	{1000491200, "In120"},
+	{1000491202, "In120[70.000]"},
+	{1000491210, "In121"},
+	{1000491211, "In121[313.680]"},
+	{1000491220, "In122"},
+	{1000491221, "In122[40.000]"},
+	{1000491222, "In122[290.000]"},
+	{1000491230, "In123"},
+	{1000491231, "In123[327.210]"},
+	{1000491240, "In124"},
+	{1000491241, "In124[50.000]"},
+	{1000491250, "In125"},
+	{1000491251, "In125[360.120]"},
+	{1000491252, "In125[2009.400]"},
+	{1000491253, "In125[2161.200]"},
+	{1000491260, "In126"},
+	{1000491261, "In126[102.000]"},
+	{1000491270, "In127"},
+	{1000491271, "In127[408.900]"},
+	{1000491272, "In127[1863.000]"},
+	{1000491273, "In127[2364.000]"},
+	{1000491280, "In128"},
+	{1000491281, "In128[340.000]"},
+	{1000491290, "In129"},
+	{1000491291, "In129[459.000]"},
+	{1000491292, "In129[1630.000]"},
+	{1000491293, "In129[1687.970]"},
+	{1000491294, "In129[1911.000]"},
+	{1000491300, "In130"},
+	{1000491301, "In130[50.000]"},
+	{1000491302, "In130[388.300]"},
+	{1000491303, "In130[400.000]"},
+	{1000491310, "In131"},
+	{1000491311, "In131[302.000]"},
+	{1000491312, "In131[3764.000]"},
+	{1000491320, "In132"},
+	{1000491330, "In133"},
+	{1000491331, "In133[330.000]"},
+	{1000491340, "In134"},
+	{1000491350, "In135"},
+	{1000501000, "Sn100"},
+	{1000501010, "Sn101"},
+	{1000501020, "Sn102"},
+	{1000501030, "Sn103"},
+	{1000501040, "Sn104"},
+	{1000501050, "Sn105"},
+	{1000501060, "Sn106"},
+	{1000501070, "Sn107"},
+	{1000501080, "Sn108"},
+	{1000501090, "Sn109"},
+	{1000501100, "Sn110"},
+	{1000501110, "Sn111"},
+	{1000501111, "Sn111[254.710]"},
+	{1000501120, "Sn112"},
+	{1000501130, "Sn113"},
+	{1000501131, "Sn113[77.389]"},
+	{1000501140, "Sn114"},
+	{1000501150, "Sn115"},
+	{1000501151, "Sn115[612.810]"},
+	{1000501152, "Sn115[713.640]"},
+	{1000501160, "Sn116"},
+	{1000501170, "Sn117"},
+	{1000501171, "Sn117[314.580]"},
+	{1000501172, "Sn117[2406.400]"},
+	{1000501180, "Sn118"},
+	{1000501181, "Sn118[3108.060]"},
+	{1000501190, "Sn119"},
+	{1000501191, "Sn119[89.531]"},
+	{1000501192, "Sn119[2127.000]"},
+	{1000501200, "Sn120"},
+	{1000501201, "Sn120[2481.630]"},
+	{1000501202, "Sn120[2902.220]"},
+	{1000501210, "Sn121"},
+	{1000501211, "Sn121[6.310]"},
+	{1000501212, "Sn121[1998.000]"},
+	{1000501220, "Sn122"},
+	{1000501221, "Sn122[2409.030]"},
+	{1000501222, "Sn122[2765.600]"},
+	{1000501230, "Sn123"},
+	{1000501231, "Sn123[24.600]"},
+	{1000501232, "Sn123[1945.000]"},
+	{1000501233, "Sn123[2153.000]"},
+	{1000501234, "Sn123[2713.000]"},
+	{1000501240, "Sn124"},
+	{1000501241, "Sn124[2325.010]"},
+	{1000501242, "Sn124[2656.600]"},
+	{1000501250, "Sn125"},
+	{1000501251, "Sn125[27.500]"},
+	{1000501252, "Sn125[1892.800]"},
+	{1000501260, "Sn126"},
+	{1000501261, "Sn126[2218.990]"},
+	{1000501262, "Sn126[2564.500]"},
+	{1000501270, "Sn127"},
+	{1000501271, "Sn127[5.070]"},
+	{1000501272, "Sn127[1826.670]"},
+	{1000501273, "Sn127[1930.970]"},
+	{1000501280, "Sn128"},
+	{1000501281, "Sn128[2091.500]"},
+	{1000501282, "Sn128[2491.910]"},
+	{1000501290, "Sn129"},
+	{1000501291, "Sn129[35.150]"},
+	{1000501292, "Sn129[1761.600]"},
+	{1000501293, "Sn129[1802.600]"},
+	{1000501300, "Sn130"},
+	{1000501301, "Sn130[1946.880]"},
+	{1000501302, "Sn130[2434.790]"},
+	{1000501310, "Sn131"},
+	{1000501320, "Sn132"},
+	{1000501321, "Sn132[4848.520]"},
+	{1000501330, "Sn133"},
+	{1000501340, "Sn134"},
+	{1000501350, "Sn135"},
+	{1000501360, "Sn136"},
+	{1000501370, "Sn137"},
+	{1000501380, "Sn138"},
+	{1000511040, "Sb104"},
+	{1000511050, "Sb105"},
+	{1000511060, "Sb106"},
+	{1000511070, "Sb107"},
+	{1000511080, "Sb108"},
+	{1000511090, "Sb109"},
+	{1000511100, "Sb110"},
+	{1000511110, "Sb111"},
+	{1000511120, "Sb112"},
+	{1000511130, "Sb113"},
+	{1000511140, "Sb114"},
+	{1000511141, "Sb114[495.500]"},
+	{1000511150, "Sb115"},
+	{1000511160, "Sb116"},
+	{1000511161, "Sb116[383.000]"},
+	{1000511170, "Sb117"},
+	{1000511171, "Sb117[3130.760]"},
+	{1000511180, "Sb118"},
+	{1000511181, "Sb118[50.814]"},
+	{1000511182, "Sb118[250.000]"},
+	{1000511190, "Sb119"},
+	{1000511191, "Sb119[2841.700]"},
+	{1000511200, "Sb120"},
+	{1000511210, "Sb121"},
+	{1000511211, "Sb121[2721.500]"},
+	{1000511220, "Sb122"},
+	{1000511221, "Sb122[61.413]"},
+	{1000511222, "Sb122[137.473]"},
+	{1000511223, "Sb122[163.559]"},
+	{1000511230, "Sb123"},
+	{1000511240, "Sb124"},
+	{1000511241, "Sb124[10.863]"},
+	{1000511242, "Sb124[36.844]"},
+	{1000511243, "Sb124[40.804]"},
+	{1000511250, "Sb125"},
+	{1000511251, "Sb125[1971.250]"},
+	{1000511253, "Sb125[2112.100]"},
+	{1000511260, "Sb126"},
+	{1000511261, "Sb126[17.700]"},
+	{1000511262, "Sb126[40.400]"},
+	{1000511270, "Sb127"},
+	{1000511271, "Sb127[1920.190]"},
+	{1000511280, "Sb128"},
+	{1000511290, "Sb129"},
+	{1000511291, "Sb129[1851.310]"},
+	{1000511292, "Sb129[1861.060]"},
+	{1000511293, "Sb129[2139.400]"},
+	{1000511300, "Sb130"},
+	{1000511301, "Sb130[4.800]"},
+	{1000511310, "Sb131"},
+	{1000511311, "Sb131[1676.060]"},
+	{1000511312, "Sb131[1687.200]"},
+	{1000511313, "Sb131[2165.600]"},
+	{1000511320, "Sb132"},
+	{1000511330, "Sb133"},
+	{1000511331, "Sb133[4560.000]"},
+	{1000511340, "Sb134"},
+	{1000511341, "Sb134[279.000]"},
+	{1000511350, "Sb135"},
+	{1000511360, "Sb136"},
+	{1000511370, "Sb137"},
+	{1000511390, "Sb139"},
+	{1000511400, "Sb140"},
+	{1000521050, "Te105"},
+	{1000521060, "Te106"},
+	{1000521070, "Te107"},
+	{1000521080, "Te108"},
+	{1000521090, "Te109"},
+	{1000521100, "Te110"},
+	{1000521110, "Te111"},
+	{1000521120, "Te112"},
+	{1000521130, "Te113"},
+	{1000521140, "Te114"},
+	{1000521150, "Te115"},
+	{1000521151, "Te115[20.000]"},
+	{1000521152, "Te115[280.050]"},
+	{1000521160, "Te116"},
+	{1000521170, "Te117"},
+	{1000521171, "Te117[296.100]"},
+	{1000521180, "Te118"},
+	{1000521190, "Te119"},
+	{1000521191, "Te119[260.960]"},
+	{1000521200, "Te120"},
+	{1000521210, "Te121"},
+	{1000521211, "Te121[293.974]"},
+	{1000521220, "Te122"},
+	{1000521230, "Te123"},
+	{1000521231, "Te123[247.470]"},
+	{1000521240, "Te124"},
+	{1000521250, "Te125"},
+	{1000521251, "Te125[144.775]"},
+	{1000521260, "Te126"},
+	{1000521270, "Te127"},
+	{1000521271, "Te127[88.230]"},
+	{1000521280, "Te128"},
+	{1000521290, "Te129"},
+	{1000521291, "Te129[105.510]"},
+	{1000521300, "Te130"},
+	{1000521301, "Te130[2648.600]"},
+	{1000521310, "Te131"},
+	{1000521311, "Te131[182.258]"},
+	{1000521312, "Te131[1940.000]"},
+	{1000521320, "Te132"},
+	{1000521321, "Te132[1925.470]"},
+	{1000521322, "Te132[2723.300]"},
+	{1000521330, "Te133"},
+	{1000521331, "Te133[334.260]"},
+	{1000521340, "Te134"},
+	{1000521350, "Te135"},
+	{1000521360, "Te136"},
+	{1000521370, "Te137"},
+	{1000521380, "Te138"},
+	{1000521390, "Te139"},
+	{1000521430, "Te143"},
+	{1000531080, "I108"},
+	{1000531090, "I109"},
+	{1000531100, "I110"},
+	{1000531110, "I111"},
+	{1000531120, "I112"},
+	{1000531130, "I113"},
+	{1000531140, "I114"},
+	{1000531141, "I114[265.900]"},
+	{1000531150, "I115"},
+	{1000531160, "I116"},
+	{1000531161, "I116[430.400]"},
+	{1000531170, "I117"},
+	{1000531180, "I118"},
+	{1000531181, "I118[104.000]"},
+	{1000531190, "I119"},
+	{1000531200, "I120"},
+	{1000531201, "I120[320.000]"},
+	{1000531210, "I121"},
+	{1000531211, "I121[2376.900]"},
+	{1000531220, "I122"},
+	{1000531221, "I122[379.400]"},
+	{1000531222, "I122[394.100]"},
+	{1000531230, "I123"},
+	{1000531240, "I124"},
+	{1000531250, "I125"},
+	{1000531260, "I126"},
+	{1000531270, "I127"},
+	{1000531280, "I128"},
+	{1000531290, "I129"},
+	{1000531300, "I130"},
+	{1000531301, "I130[39.953]"},
+	{1000531310, "I131"},
+	{1000531320, "I132"},
+	{1000531321, "I132[120.000]"},
+	{1000531330, "I133"},
+	{1000531331, "I133[1634.148]"},
+	{1000531340, "I134"},
+	{1000531341, "I134[316.490]"},
+	{1000531350, "I135"},
+	{1000531360, "I136"},
+	{1000531361, "I136[640.000]"},
+	{1000531370, "I137"},
+	{1000531380, "I138"},
+	{1000531390, "I139"},
+	{1000531400, "I140"},
+	{1000531410, "I141"},
+	{1000531420, "I142"},
+	{1000531430, "I143"},
+	{1000531450, "I145"},
+	{1000541090, "Xe109"},
+	{1000541100, "Xe110"},
+	{1000541110, "Xe111"},
+	{1000541120, "Xe112"},
+	{1000541130, "Xe113"},
+	{1000541140, "Xe114"},
+	{1000541150, "Xe115"},
+	{1000541160, "Xe116"},
+	{1000541170, "Xe117"},
+	{1000541180, "Xe118"},
+	{1000541190, "Xe119"},
+	{1000541200, "Xe120"},
+	{1000541210, "Xe121"},
+	{1000541220, "Xe122"},
+	{1000541230, "Xe123"},
+	{1000541231, "Xe123[185.180]"},
+	{1000541240, "Xe124"},
+	{1000541250, "Xe125"},
+	{1000541251, "Xe125[252.610]"},
+	{1000541260, "Xe126"},
+	{1000541270, "Xe127"},
+	{1000541271, "Xe127[297.100]"},
+	{1000541280, "Xe128"},
+	{1000541290, "Xe129"},
+	{1000541291, "Xe129[236.140]"},
+	{1000541300, "Xe130"},
+	{1000541310, "Xe131"},
+	{1000541311, "Xe131[163.930]"},
+	{1000541320, "Xe132"},
+	{1000541321, "Xe132[2752.210]"},
+	{1000541330, "Xe133"},
+	{1000541331, "Xe133[233.221]"},
+	{1000541340, "Xe134"},
+	{1000541341, "Xe134[1965.500]"},
+	{1000541342, "Xe134[3025.200]"},
+	{1000541350, "Xe135"},
+	{1000541351, "Xe135[526.551]"},
+	{1000541360, "Xe136"},
+	{1000541361, "Xe136[1891.703]"},
+	{1000541370, "Xe137"},
+	{1000541380, "Xe138"},
+	{1000541390, "Xe139"},
+	{1000541400, "Xe140"},
+	{1000541410, "Xe141"},
+	{1000541420, "Xe142"},
+	{1000541430, "Xe143"},
+	{1000541440, "Xe144"},
+	{1000541450, "Xe145"},
+	{1000541470, "Xe147"},
+	{1000541480, "Xe148"},
+	{1000551120, "Cs112"},
+	{1000551130, "Cs113"},
+	{1000551140, "Cs114"},
+	{1000551150, "Cs115"},
+	{1000551160, "Cs116"},
+	{1000551161, "Cs116[100.000]"},
+	{1000551171, "Cs117[0.000]"},
+	{1000551180, "Cs118"},
+	{1000551190, "Cs119"},
+	{1000551200, "Cs120"},
+	{1000551210, "Cs121"},
+	{1000551211, "Cs121[68.500]"},
+	{1000551220, "Cs122"},
+	{1000551221, "Cs122[127.070]"},
+	{1000551222, "Cs122[140.000]"},
+	{1000551230, "Cs123"},
+	{1000551231, "Cs123[156.270]"},
+	{1000551240, "Cs124"},
+	{1000551241, "Cs124[462.630]"},
+	{1000551250, "Cs125"},
+	{1000551251, "Cs125[266.100]"},
+	{1000551260, "Cs126"},
+	{1000551261, "Cs126[596.100]"},
+	{1000551270, "Cs127"},
+	{1000551271, "Cs127[452.230]"},
+	{1000551280, "Cs128"},
+	{1000551290, "Cs129"},
+	{1000551300, "Cs130"},
+	{1000551301, "Cs130[163.250]"},
+	{1000551310, "Cs131"},
+	{1000551320, "Cs132"},
+	{1000551330, "Cs133"},
+	{1000551340, "Cs134"},
+	{1000551341, "Cs134[138.744]"},
+	{1000551350, "Cs135"},
+	{1000551351, "Cs135[1632.900]"},
+	{1000551360, "Cs136"},
+	{1000551370, "Cs137"},
+	{1000551380, "Cs138"},
+	{1000551381, "Cs138[79.900]"},
+	{1000551390, "Cs139"},
+	{1000551400, "Cs140"},
+	{1000551410, "Cs141"},
+	{1000551420, "Cs142"},
+	{1000551430, "Cs143"},
+	{1000551440, "Cs144"},
+	{1000551442, "Cs144[92.200]"},
+	{1000551450, "Cs145"},
+	{1000551460, "Cs146"},
+	{1000551470, "Cs147"},
+	{1000551480, "Cs148"},
+	{1000551490, "Cs149"},
+	{1000551500, "Cs150"},
+	{1000551510, "Cs151"},
+	{1000561140, "Ba114"},
+	{1000561150, "Ba115"},
+	{1000561160, "Ba116"},
+	{1000561170, "Ba117"},
+	{1000561180, "Ba118"},
+	{1000561190, "Ba119"},
+	{1000561200, "Ba120"},
+	{1000561210, "Ba121"},
+	{1000561220, "Ba122"},
+	{1000561230, "Ba123"},
+	{1000561240, "Ba124"},
+	{1000561250, "Ba125"},
+	{1000561251, "Ba125[67.700]"},
+	{1000561260, "Ba126"},
+	{1000561270, "Ba127"},
+	{1000561271, "Ba127[80.320]"},
+	{1000561280, "Ba128"},
+	{1000561290, "Ba129"},
+	{1000561291, "Ba129[8.420]"},
+	{1000561300, "Ba130"},
+	{1000561301, "Ba130[2475.120]"},
+	{1000561310, "Ba131"},
+	{1000561311, "Ba131[187.995]"},
+	{1000561320, "Ba132"},
+	{1000561330, "Ba133"},
+	{1000561331, "Ba133[288.252]"},
+	{1000561340, "Ba134"},
+	{1000561341, "Ba134[2957.200]"},
+	{1000561350, "Ba135"},
+	{1000561351, "Ba135[268.218]"},
+	{1000561360, "Ba136"},
+	{1000561361, "Ba136[2030.466]"},
+	{1000561370, "Ba137"},
+	{1000561371, "Ba137[661.659]"},
+	{1000561380, "Ba138"},
+	{1000561390, "Ba139"},
+	{1000561400, "Ba140"},
+	{1000561410, "Ba141"},
+	{1000561420, "Ba142"},
+	{1000561430, "Ba143"},
+	{1000561440, "Ba144"},
+	{1000561450, "Ba145"},
+	{1000561460, "Ba146"},
+	{1000561470, "Ba147"},
+	{1000561480, "Ba148"},
+	{1000561490, "Ba149"},
+	{1000561500, "Ba150"},
+	{1000561510, "Ba151"},
+	{1000561520, "Ba152"},
+	{1000571170, "La117"},
+	{1000571171, "La117[151.000]"},
+	{1000571201, "La120[0.000]"},
+	{1000571210, "La121"},
+	{1000571220, "La122"},
+	{1000571230, "La123"},
+	{1000571241, "La124[0.000]"},
+	{1000571250, "La125"},
+	{1000571251, "La125[107.000]"},
+	{1000571261, "La126[0.000]"},
+	{1000571270, "La127"},
+	{1000571271, "La127[14.200]"},
+	{1000571280, "La128"},
+	{1000571290, "La129"},
+	{1000571291, "La129[172.330]"},
+	{1000571300, "La130"},
+	{1000571310, "La131"},
+	{1000571311, "La131[304.600]"},
+	{1000571320, "La132"},
+	{1000571321, "La132[188.200]"},
+	{1000571330, "La133"},
+	{1000571340, "La134"},
+	{1000571341, "La134[336.440]"},
+	{1000571350, "La135"},
+	{1000571360, "La136"},
+	{1000571361, "La136[230.000]"},
+	{1000571370, "La137"},
+	{1000571380, "La138"},
+	{1000571390, "La139"},
+	{1000571400, "La140"},
+	{1000571410, "La141"},
+	{1000571420, "La142"},
+	{1000571430, "La143"},
+	{1000571440, "La144"},
+	{1000571450, "La145"},
+	{1000571460, "La146"},
+	{1000571470, "La147"},
+	{1000571480, "La148"},
+	{1000571490, "La149"},
+	{1000571500, "La150"},
+	{1000571510, "La151"},
+	{1000571520, "La152"},
+	{1000571530, "La153"},
+	{1000581210, "Ce121"},
+	{1000581230, "Ce123"},
+	{1000581240, "Ce124"},
+	{1000581250, "Ce125"},
+	{1000581260, "Ce126"},
+	{1000581270, "Ce127"},
+	{1000581271, "Ce127[7.300]"},
+	{1000581272, "Ce127[36.800]"},
+	{1000581280, "Ce128"},
+	{1000581290, "Ce129"},
+	{1000581300, "Ce130"},
+	{1000581310, "Ce131"},
+	{1000581311, "Ce131[63.090]"},
+	{1000581320, "Ce132"},
+	{1000581321, "Ce132[2341.150]"},
+	{1000581330, "Ce133"},
+	{1000581331, "Ce133[37.200]"},
+	{1000581340, "Ce134"},
+	{1000581350, "Ce135"},
+	{1000581351, "Ce135[445.810]"},
+	{1000581360, "Ce136"},
+	{1000581361, "Ce136[3095.500]"},
+	{1000581370, "Ce137"},
+	{1000581371, "Ce137[254.290]"},
+	{1000581380, "Ce138"},
+	{1000581381, "Ce138[2129.170]"},
+	{1000581390, "Ce139"},
+	{1000581391, "Ce139[754.240]"},
+	{1000581400, "Ce140"},
+	{1000581401, "Ce140[2107.860]"},
+	{1000581410, "Ce141"},
+	{1000581420, "Ce142"},
+	{1000581430, "Ce143"},
+	{1000581440, "Ce144"},
+	{1000581450, "Ce145"},
+	{1000581460, "Ce146"},
+	{1000581470, "Ce147"},
+	{1000581480, "Ce148"},
+	{1000581490, "Ce149"},
+	{1000581500, "Ce150"},
+	{1000581510, "Ce151"},
+	{1000581520, "Ce152"},
+	{1000581530, "Ce153"},
+	{1000581540, "Ce154"},
+	{1000581550, "Ce155"},
+	{1000591210, "Pr121"},
+	{1000591240, "Pr124"},
+	{1000591250, "Pr125"},
+	{1000591260, "Pr126"},
+	{1000591270, "Pr127"},
+	{1000591280, "Pr128"},
+	{1000591290, "Pr129"},
+	{1000591301, "Pr130[0.000]"},
+	{1000591310, "Pr131"},
+	{1000591311, "Pr131[152.400]"},
+	{1000591320, "Pr132"},
+	{1000591330, "Pr133"},
+	{1000591331, "Pr133[192.120]"},
+	{1000591341, "Pr134[0.000]"},
+	{1000591350, "Pr135"},
+	{1000591351, "Pr135[358.060]"},
+	{1000591360, "Pr136"},
+	{1000591370, "Pr137"},
+	{1000591371, "Pr137[561.220]"},
+	{1000591380, "Pr138"},
+	{1000591381, "Pr138[364.000]"},
+	{1000591390, "Pr139"},
+	{1000591400, "Pr140"},
+	{1000591401, "Pr140[763.700]"},
+	{1000591410, "Pr141"},
+	{1000591420, "Pr142"},
+	{1000591421, "Pr142[3.694]"},
+	{1000591430, "Pr143"},
+	{1000591440, "Pr144"},
+	{1000591441, "Pr144[59.030]"},
+	{1000591450, "Pr145"},
+	{1000591460, "Pr146"},
+	{1000591470, "Pr147"},
+	{1000591480, "Pr148"},
+	{1000591481, "Pr148[76.800]"},
+	{1000591490, "Pr149"},
+	{1000591500, "Pr150"},
+	{1000591510, "Pr151"},
+	{1000591511, "Pr151[35.100]"},
+	{1000591520, "Pr152"},
+	{1000591521, "Pr152[114.800]"},
+	{1000591530, "Pr153"},
+	{1000591540, "Pr154"},
+	{1000591550, "Pr155"},
+	{1000601250, "Nd125"},
+	{1000601270, "Nd127"},
+	{1000601280, "Nd128"},
+	{1000601290, "Nd129"},
+	{1000601300, "Nd130"},
+	{1000601310, "Nd131"},
+	{1000601320, "Nd132"},
+	{1000601330, "Nd133"},
+	{1000601331, "Nd133[127.970]"},
+	{1000601340, "Nd134"},
+	{1000601341, "Nd134[2293.000]"},
+	{1000601350, "Nd135"},
+	{1000601351, "Nd135[64.950]"},
+	{1000601360, "Nd136"},
+	{1000601370, "Nd137"},
+	{1000601371, "Nd137[519.430]"},
+	{1000601380, "Nd138"},
+	{1000601390, "Nd139"},
+	{1000601391, "Nd139[231.150]"},
+	{1000601400, "Nd140"},
+	{1000601401, "Nd140[2221.400]"},
+	{1000601410, "Nd141"},
+	{1000601411, "Nd141[756.510]"},
+	{1000601420, "Nd142"},
+	{1000601421, "Nd142[2209.303]"},
+	{1000601430, "Nd143"},
+	{1000601440, "Nd144"},
+	{1000601450, "Nd145"},
+	{1000601460, "Nd146"},
+	{1000601470, "Nd147"},
+	{1000601480, "Nd148"},
+	{1000601490, "Nd149"},
+	{1000601500, "Nd150"},
+	{1000601510, "Nd151"},
+	{1000601520, "Nd152"},
+	{1000601530, "Nd153"},
+	{1000601531, "Nd153[191.700]"},
+	{1000601540, "Nd154"},
+	{1000601541, "Nd154[233.200]"},
+	{1000601550, "Nd155"},
+	{1000601560, "Nd156"},
+	{1000601570, "Nd157"},
+	{1000601580, "Nd158"},
+	{1000601590, "Nd159"},
+	{1000601600, "Nd160"},
+	{1000601610, "Nd161"},
+	{1000611280, "Pm128"},
+	{1000611290, "Pm129"},
+	{1000611300, "Pm130"},
+	{1000611310, "Pm131"},
+	{1000611320, "Pm132"},
+	{1000611330, "Pm133"},
+	{1000611331, "Pm133[129.700]"},
+	{1000611340, "Pm134"},
+	{1000611351, "Pm135[0.000]"},
+	{1000611352, "Pm135[68.700]"},
+	{1000611361, "Pm136[0.000]"},
+	{1000611370, "Pm137"},
+	{1000611380, "Pm138"},
+	{1000611381, "Pm138[20.000]"},
+	{1000611390, "Pm139"},
+	{1000611391, "Pm139[188.700]"},
+	{1000611400, "Pm140"},
+	{1000611410, "Pm141"},
+	{1000611411, "Pm141[2530.750]"},
+	{1000611412, "Pm141[2574.400]"},
+	{1000611420, "Pm142"},
+	{1000611421, "Pm142[883.170]"},
+	{1000611422, "Pm142[2828.700]"},
+	{1000611430, "Pm143"},
+	{1000611440, "Pm144"},
+	{1000611441, "Pm144[8595.800]"},
+	{1000611450, "Pm145"},
+	{1000611460, "Pm146"},
+	{1000611470, "Pm147"},
+	{1000611480, "Pm148"},
+	{1000611481, "Pm148[137.900]"},
+	{1000611490, "Pm149"},
+	{1000611491, "Pm149[240.214]"},
+	{1000611500, "Pm150"},
+	{1000611510, "Pm151"},
+	{1000611520, "Pm152"},
+	{1000611521, "Pm152[150.000]"},
+	{1000611530, "Pm153"},
+	{1000611540, "Pm154"},
+	{1000611550, "Pm155"},
+	{1000611560, "Pm156"},
+	{1000611561, "Pm156[150.300]"},
+	{1000611570, "Pm157"},
+	{1000611580, "Pm158"},
+	{1000611590, "Pm159"},
+	{1000611600, "Pm160"},
+	{1000611610, "Pm161"},
+	{1000611620, "Pm162"},
+	{1000611630, "Pm163"},
+	{1000621290, "Sm129"},
+	{1000621310, "Sm131"},
+	{1000621320, "Sm132"},
+	{1000621330, "Sm133"},
+	{1000621340, "Sm134"},
+	{1000621350, "Sm135"},
+	{1000621360, "Sm136"},
+	{1000621361, "Sm136[2264.700]"},
+	{1000621370, "Sm137"},
+	{1000621380, "Sm138"},
+	{1000621390, "Sm139"},
+	{1000621391, "Sm139[457.400]"},
+	{1000621400, "Sm140"},
+	{1000621410, "Sm141"},
+	{1000621411, "Sm141[175.900]"},
+	{1000621420, "Sm142"},
+	{1000621430, "Sm143"},
+	{1000621431, "Sm143[753.990]"},
+	{1000621432, "Sm143[2793.800]"},
+	{1000621440, "Sm144"},
+	{1000621450, "Sm145"},
+	{1000621460, "Sm146"},
+	{1000621470, "Sm147"},
+	{1000621480, "Sm148"},
+	{1000621490, "Sm149"},
+	{1000621500, "Sm150"},
+	{1000621510, "Sm151"},
+	{1000621511, "Sm151[261.130]"},
+	{1000621520, "Sm152"},
+	{1000621530, "Sm153"},
+	{1000621531, "Sm153[98.370]"},
+	{1000621540, "Sm154"},
+	{1000621550, "Sm155"},
+	{1000621560, "Sm156"},
+	{1000621570, "Sm157"},
+	{1000621580, "Sm158"},
+	{1000621590, "Sm159"},
+	{1000621600, "Sm160"},
+	{1000621610, "Sm161"},
+	{1000621620, "Sm162"},
+	{1000621630, "Sm163"},
+	{1000621640, "Sm164"},
+	{1000621650, "Sm165"},
+	{1000631300, "Eu130"},
+	{1000631310, "Eu131"},
+	{1000631340, "Eu134"},
+	{1000631350, "Eu135"},
+	{1000631361, "Eu136[0.000]"},
+	{1000631370, "Eu137"},
+	{1000631380, "Eu138"},
+	{1000631390, "Eu139"},
+	{1000631400, "Eu140"},
+	{1000631410, "Eu141"},
+	{1000631411, "Eu141[96.450]"},
+	{1000631420, "Eu142"},
+	{1000631430, "Eu143"},
+	{1000631431, "Eu143[389.510]"},
+	{1000631440, "Eu144"},
+	{1000631450, "Eu145"},
+	{1000631460, "Eu146"},
+	{1000631461, "Eu146[666.370]"},
+	{1000631470, "Eu147"},
+	{1000631480, "Eu148"},
+	{1000631490, "Eu149"},
+	{1000631491, "Eu149[496.386]"},
+	{1000631500, "Eu150"},
+	{1000631501, "Eu150[41.700]"},
+	{1000631510, "Eu151"},
+	{1000631511, "Eu151[196.245]"},
+	{1000631520, "Eu152"},
+	{1000631521, "Eu152[45.600]"},
+	{1000631522, "Eu152[147.860]"},
+	{1000631530, "Eu153"},
+	{1000631540, "Eu154"},
+	{1000631541, "Eu154[68.170]"},
+	{1000631542, "Eu154[145.300]"},
+	{1000631550, "Eu155"},
+	{1000631560, "Eu156"},
+	{1000631570, "Eu157"},
+	{1000631580, "Eu158"},
+	{1000631590, "Eu159"},
+	{1000631600, "Eu160"},
+	{1000631610, "Eu161"},
+	{1000631620, "Eu162"},
+	{1000631630, "Eu163"},
+	{1000631640, "Eu164"},
+	{1000631650, "Eu165"},
+	{1000631660, "Eu166"},
+	{1000631670, "Eu167"},
+	{1000641350, "Gd135"},
+	{1000641360, "Gd136"},
+	{1000641370, "Gd137"},
+	{1000641380, "Gd138"},
+	{1000641381, "Gd138[2232.700]"},
+	{1000641390, "Gd139"},
+	{1000641400, "Gd140"},
+	{1000641410, "Gd141"},
+	{1000641411, "Gd141[377.760]"},
+	{1000641420, "Gd142"},
+	{1000641430, "Gd143"},
+	{1000641431, "Gd143[152.600]"},
+	{1000641440, "Gd144"},
+	{1000641450, "Gd145"},
+	{1000641451, "Gd145[749.100]"},
+	{1000641460, "Gd146"},
+	{1000641470, "Gd147"},
+	{1000641480, "Gd148"},
+	{1000641490, "Gd149"},
+	{1000641500, "Gd150"},
+	{1000641510, "Gd151"},
+	{1000641520, "Gd152"},
+	{1000641530, "Gd153"},
+	{1000641531, "Gd153[95.174]"},
+	{1000641532, "Gd153[171.188]"},
+	{1000641540, "Gd154"},
+	{1000641550, "Gd155"},
+	{1000641551, "Gd155[121.050]"},
+	{1000641560, "Gd156"},
+	{1000641561, "Gd156[2137.600]"},
+	{1000641570, "Gd157"},
+	{1000641571, "Gd157[426.600]"},
+	{1000641580, "Gd158"},
+	{1000641590, "Gd159"},
+	{1000641600, "Gd160"},
+	{1000641610, "Gd161"},
+	{1000641620, "Gd162"},
+	{1000641630, "Gd163"},
+	{1000641640, "Gd164"},
+	{1000641650, "Gd165"},
+	{1000641660, "Gd166"},
+	{1000641670, "Gd167"},
+	{1000641680, "Gd168"},
+	{1000641690, "Gd169"},
+	{1000651350, "Tb135"},
+	{1000651390, "Tb139"},
+	{1000651400, "Tb140"},
+	{1000651410, "Tb141"},
+	{1000651420, "Tb142"},
+	{1000651421, "Tb142[279.700]"},
+	{1000651422, "Tb142[652.100]"},
+	{1000651430, "Tb143"},
+	{1000651440, "Tb144"},
+	{1000651441, "Tb144[396.900]"},
+	{1000651442, "Tb144[476.200]"},
+	{1000651451, "Tb145[0.000]"},
+	{1000651460, "Tb146"},
+	{1000651462, "Tb146[779.600]"},
+	{1000651470, "Tb147"},
+	{1000651471, "Tb147[50.600]"},
+	{1000651480, "Tb148"},
+	{1000651481, "Tb148[90.100]"},
+	{1000651482, "Tb148[8618.600]"},
+	{1000651490, "Tb149"},
+	{1000651491, "Tb149[35.780]"},
+	{1000651500, "Tb150"},
+	{1000651501, "Tb150[461.000]"},
+	{1000651510, "Tb151"},
+	{1000651511, "Tb151[99.530]"},
+	{1000651520, "Tb152"},
+	{1000651521, "Tb152[501.740]"},
+	{1000651530, "Tb153"},
+	{1000651531, "Tb153[163.175]"},
+	{1000651540, "Tb154"},
+	{1000651550, "Tb155"},
+	{1000651560, "Tb156"},
+	{1000651561, "Tb156[49.630]"},
+	{1000651562, "Tb156[88.400]"},
+	{1000651570, "Tb157"},
+	{1000651580, "Tb158"},
+	{1000651581, "Tb158[110.300]"},
+	{1000651582, "Tb158[388.400]"},
+	{1000651590, "Tb159"},
+	{1000651600, "Tb160"},
+	{1000651610, "Tb161"},
+	{1000651620, "Tb162"},
+	{1000651630, "Tb163"},
+	{1000651640, "Tb164"},
+	{1000651650, "Tb165"},
+	{1000651660, "Tb166"},
+	{1000651670, "Tb167"},
+	{1000651680, "Tb168"},
+	{1000651690, "Tb169"},
+	{1000651700, "Tb170"},
+	{1000651710, "Tb171"},
+	{1000661390, "Dy139"},
+	{1000661401, "Dy140[2166.100]"},
+	{1000661410, "Dy141"},
+	{1000661420, "Dy142"},
+	{1000661430, "Dy143"},
+	{1000661431, "Dy143[310.700]"},
+	{1000661432, "Dy143[405.700]"},
+	{1000661440, "Dy144"},
+	{1000661450, "Dy145"},
+	{1000661451, "Dy145[118.200]"},
+	{1000661460, "Dy146"},
+	{1000661461, "Dy146[2935.700]"},
+	{1000661470, "Dy147"},
+	{1000661471, "Dy147[750.500]"},
+	{1000661480, "Dy148"},
+	{1000661490, "Dy149"},
+	{1000661491, "Dy149[2661.100]"},
+	{1000661500, "Dy150"},
+	{1000661510, "Dy151"},
+	{1000661520, "Dy152"},
+	{1000661530, "Dy153"},
+	{1000661540, "Dy154"},
+	{1000661550, "Dy155"},
+	{1000661551, "Dy155[234.330]"},
+	{1000661560, "Dy156"},
+	{1000661570, "Dy157"},
+	{1000661571, "Dy157[161.990]"},
+	{1000661572, "Dy157[199.380]"},
+	{1000661580, "Dy158"},
+	{1000661590, "Dy159"},
+	{1000661591, "Dy159[352.770]"},
+	{1000661600, "Dy160"},
+	{1000661610, "Dy161"},
+	{1000661620, "Dy162"},
+	{1000661630, "Dy163"},
+	{1000661640, "Dy164"},
+	{1000661650, "Dy165"},
+	{1000661651, "Dy165[108.155]"},
+	{1000661660, "Dy166"},
+	{1000661670, "Dy167"},
+	{1000661680, "Dy168"},
+	{1000661690, "Dy169"},
+	{1000661710, "Dy171"},
+	{1000661720, "Dy172"},
+	{1000661730, "Dy173"},
+	{1000671400, "Ho140"},
+	{1000671410, "Ho141"},
+	{1000671411, "Ho141[66.000]"},
+	{1000671420, "Ho142"},
+	{1000671440, "Ho144"},
+	{1000671450, "Ho145"},
+	{1000671460, "Ho146"},
+	{1000671470, "Ho147"},
+	{1000671480, "Ho148"},
+	{1000671482, "Ho148[694.400]"},
+	{1000671490, "Ho149"},
+	{1000671491, "Ho149[48.800]"},
+	{1000671500, "Ho150"},
+	{1000671510, "Ho151"},
+	{1000671511, "Ho151[41.000]"},
+	{1000671520, "Ho152"},
+	{1000671521, "Ho152[160.000]"},
+	{1000671522, "Ho152[3019.590]"},
+	{1000671530, "Ho153"},
+	{1000671531, "Ho153[68.700]"},
+	{1000671540, "Ho154"},
+	{1000671550, "Ho155"},
+	{1000671551, "Ho155[141.970]"},
+	{1000671560, "Ho156"},
+	{1000671561, "Ho156[52.370]"},
+	{1000671570, "Ho157"},
+	{1000671580, "Ho158"},
+	{1000671581, "Ho158[67.199]"},
+	{1000671582, "Ho158[180.000]"},
+	{1000671590, "Ho159"},
+	{1000671591, "Ho159[205.910]"},
+	{1000671600, "Ho160"},
+	{1000671601, "Ho160[59.980]"},
+	{1000671602, "Ho160[169.600]"},
+	{1000671610, "Ho161"},
+	{1000671611, "Ho161[211.150]"},
+	{1000671620, "Ho162"},
+	{1000671621, "Ho162[105.870]"},
+	{1000671630, "Ho163"},
+	{1000671631, "Ho163[297.880]"},
+	{1000671640, "Ho164"},
+	{1000671641, "Ho164[139.770]"},
+	{1000671650, "Ho165"},
+	{1000671651, "Ho165[361.675]"},
+	{1000671660, "Ho166"},
+	{1000671661, "Ho166[5.969]"},
+	{1000671662, "Ho166[190.902]"},
+	{1000671670, "Ho167"},
+	{1000671671, "Ho167[259.340]"},
+	{1000671680, "Ho168"},
+	{1000671681, "Ho168[59.000]"},
+	{1000671682, "Ho168[143.430]"},
+	{1000671690, "Ho169"},
+	{1000671700, "Ho170"},
+	{1000671701, "Ho170[120.000]"},
+	{1000671710, "Ho171"},
+	{1000671720, "Ho172"},
+	{1000671730, "Ho173"},
+	{1000671740, "Ho174"},
+	{1000671750, "Ho175"},
+	{1000681440, "Er144"},
+	{1000681451, "Er145[253.000]"},
+	{1000681460, "Er146"},
+	{1000681470, "Er147"},
+	{1000681480, "Er148"},
+	{1000681481, "Er148[2913.200]"},
+	{1000681490, "Er149"},
+	{1000681491, "Er149[741.800]"},
+	{1000681492, "Er149[3242.700]"},
+	{1000681500, "Er150"},
+	{1000681501, "Er150[2796.500]"},
+	{1000681510, "Er151"},
+	{1000681511, "Er151[2586.000]"},
+	{1000681520, "Er152"},
+	{1000681530, "Er153"},
+	{1000681540, "Er154"},
+	{1000681550, "Er155"},
+	{1000681560, "Er156"},
+	{1000681570, "Er157"},
+	{1000681571, "Er157[155.400]"},
+	{1000681580, "Er158"},
+	{1000681590, "Er159"},
+	{1000681600, "Er160"},
+	{1000681610, "Er161"},
+	{1000681611, "Er161[396.440]"},
+	{1000681620, "Er162"},
+	{1000681630, "Er163"},
+	{1000681640, "Er164"},
+	{1000681650, "Er165"},
+	{1000681660, "Er166"},
+	{1000681670, "Er167"},
+	{1000681671, "Er167[207.801]"},
+	{1000681680, "Er168"},
+	{1000681690, "Er169"},
+	{1000681700, "Er170"},
+	{1000681710, "Er171"},
+	{1000681720, "Er172"},
+	{1000681730, "Er173"},
+	{1000681740, "Er174"},
+	{1000681750, "Er175"},
+	{1000681760, "Er176"},
+	{1000681770, "Er177"},
+	{1000691440, "Tm144"},
+	{1000691450, "Tm145"},
+	{1000691460, "Tm146"},
+	{1000691461, "Tm146[180.000]"},
+	{1000691470, "Tm147"},
+	{1000691471, "Tm147[68.000]"},
+	{1000691481, "Tm148[0.000]"},
+	{1000691490, "Tm149"},
+	{1000691500, "Tm150"},
+	{1000691501, "Tm150[671.300]"},
+	{1000691510, "Tm151"},
+	{1000691520, "Tm152"},
+	{1000691530, "Tm153"},
+	{1000691531, "Tm153[43.200]"},
+	{1000691540, "Tm154"},
+	{1000691550, "Tm155"},
+	{1000691551, "Tm155[41.000]"},
+	{1000691560, "Tm156"},
+	{1000691570, "Tm157"},
+	{1000691580, "Tm158"},
+	{1000691590, "Tm159"},
+	{1000691600, "Tm160"},
+	{1000691601, "Tm160[70.000]"},
+	{1000691610, "Tm161"},
+	{1000691620, "Tm162"},
+	{1000691630, "Tm163"},
+	{1000691640, "Tm164"},
+	{1000691650, "Tm165"},
+	{1000691651, "Tm165[80.370]"},
+	{1000691652, "Tm165[160.470]"},
+	{1000691660, "Tm166"},
+	{1000691661, "Tm166[109.338]"},
+	{1000691670, "Tm167"},
+	{1000691671, "Tm167[179.480]"},
+	{1000691680, "Tm168"},
+	{1000691690, "Tm169"},
+	{1000691700, "Tm170"},
+	{1000691701, "Tm170[183.197]"},
+	{1000691710, "Tm171"},
+	{1000691711, "Tm171[424.956]"},
+	{1000691720, "Tm172"},
+	{1000691730, "Tm173"},
+	{1000691731, "Tm173[317.730]"},
+	{1000691740, "Tm174"},
+	{1000691750, "Tm175"},
+	{1000691760, "Tm176"},
+	{1000691771, "Tm177[0.000]"},
+	{1000691780, "Tm178"},
+	{1000691790, "Tm179"},
+	{1000701490, "Yb149"},
+	{1000701500, "Yb150"},
+	{1000701510, "Yb151"},
+	{1000701512, "Yb151[1791.200]"},
+	{1000701513, "Yb151[2448.000]"},
+	{1000701520, "Yb152"},
+	{1000701521, "Yb152[2744.500]"},
+	{1000701530, "Yb153"},
+	{1000701531, "Yb153[2578.200]"},
+	{1000701540, "Yb154"},
+	{1000701550, "Yb155"},
+	{1000701560, "Yb156"},
+	{1000701570, "Yb157"},
+	{1000701580, "Yb158"},
+	{1000701590, "Yb159"},
+	{1000701600, "Yb160"},
+	{1000701610, "Yb161"},
+	{1000701620, "Yb162"},
+	{1000701630, "Yb163"},
+	{1000701640, "Yb164"},
+	{1000701650, "Yb165"},
+	{1000701660, "Yb166"},
+	{1000701670, "Yb167"},
+	{1000701680, "Yb168"},
+	{1000701690, "Yb169"},
+	{1000701691, "Yb169[24.200]"},
+	{1000701700, "Yb170"},
+	{1000701710, "Yb171"},
+	{1000701711, "Yb171[95.282]"},
+	{1000701720, "Yb172"},
+	{1000701721, "Yb172[1550.430]"},
+	{1000701730, "Yb173"},
+	{1000701731, "Yb173[398.900]"},
+	{1000701740, "Yb174"},
+	{1000701741, "Yb174[1518.148]"},
+	{1000701750, "Yb175"},
+	{1000701751, "Yb175[514.866]"},
+	{1000701760, "Yb176"},
+	{1000701761, "Yb176[1049.800]"},
+	{1000701770, "Yb177"},
+	{1000701771, "Yb177[331.500]"},
+	{1000701780, "Yb178"},
+	{1000701790, "Yb179"},
+	{1000701800, "Yb180"},
+	{1000701810, "Yb181"},
+	{1000711500, "Lu150"},
+	{1000711501, "Lu150[22.000]"},
+	{1000711510, "Lu151"},
+	{1000711511, "Lu151[78.000]"},
+	{1000711520, "Lu152"},
+	{1000711530, "Lu153"},
+	{1000711531, "Lu153[2632.900]"},
+	{1000711541, "Lu154[0.000]"},
+	{1000711542, "Lu154[130.400]"},
+	{1000711550, "Lu155"},
+	{1000711551, "Lu155[20.000]"},
+	{1000711552, "Lu155[1781.000]"},
+	{1000711560, "Lu156"},
+	{1000711570, "Lu157"},
+	{1000711571, "Lu157[26.000]"},
+	{1000711580, "Lu158"},
+	{1000711590, "Lu159"},
+	{1000711600, "Lu160"},
+	{1000711610, "Lu161"},
+	{1000711611, "Lu161[166.500]"},
+	{1000711620, "Lu162"},
+	{1000711630, "Lu163"},
+	{1000711640, "Lu164"},
+	{1000711650, "Lu165"},
+	{1000711660, "Lu166"},
+	{1000711661, "Lu166[34.370]"},
+	{1000711662, "Lu166[43.000]"},
+	{1000711670, "Lu167"},
+	{1000711680, "Lu168"},
+	{1000711681, "Lu168[202.810]"},
+	{1000711690, "Lu169"},
+	{1000711691, "Lu169[29.000]"},
+	{1000711700, "Lu170"},
+	{1000711701, "Lu170[92.910]"},
+	{1000711710, "Lu171"},
+	{1000711711, "Lu171[71.130]"},
+	{1000711720, "Lu172"},
+	{1000711721, "Lu172[41.860]"},
+	{1000711722, "Lu172[109.410]"},
+	{1000711730, "Lu173"},
+	{1000711731, "Lu173[123.672]"},
+	{1000711740, "Lu174"},
+	{1000711741, "Lu174[170.830]"},
+	{1000711750, "Lu175"},
+	{1000711751, "Lu175[353.480]"},
+	{1000711752, "Lu175[1392.200]"},
+	{1000711760, "Lu176"},
+	{1000711761, "Lu176[122.845]"},
+	{1000711762, "Lu176[1587.500]"},
+	{1000711770, "Lu177"},
+	{1000711771, "Lu177[569.707]"},
+	{1000711772, "Lu177[970.175]"},
+	{1000711773, "Lu177[2700.000]"},
+	{1000711780, "Lu178"},
+	{1000711781, "Lu178[123.800]"},
+	{1000711790, "Lu179"},
+	{1000711791, "Lu179[592.400]"},
+	{1000711800, "Lu180"},
+	{1000711801, "Lu180[624.000]"},
+	{1000711810, "Lu181"},
+	{1000711820, "Lu182"},
+	{1000711830, "Lu183"},
+	{1000711840, "Lu184"},
+	{1000721530, "Hf153"},
+	{1000721540, "Hf154"},
+	{1000721541, "Hf154[2671.000]"},
+	{1000721550, "Hf155"},
+	{1000721560, "Hf156"},
+	{1000721561, "Hf156[1959.000]"},
+	{1000721570, "Hf157"},
+	{1000721580, "Hf158"},
+	{1000721590, "Hf159"},
+	{1000721600, "Hf160"},
+	{1000721610, "Hf161"},
+	{1000721611, "Hf161[329.000]"},
+	{1000721620, "Hf162"},
+	{1000721630, "Hf163"},
+	{1000721640, "Hf164"},
+	{1000721650, "Hf165"},
+	{1000721660, "Hf166"},
+	{1000721670, "Hf167"},
+	{1000721680, "Hf168"},
+	{1000721690, "Hf169"},
+	{1000721700, "Hf170"},
+	{1000721710, "Hf171"},
+	{1000721711, "Hf171[21.930]"},
+	{1000721720, "Hf172"},
+	{1000721730, "Hf173"},
+	{1000721740, "Hf174"},
+	{1000721741, "Hf174[1797.500]"},
+	{1000721742, "Hf174[3311.700]"},
+	{1000721750, "Hf175"},
+	{1000721751, "Hf175[125.890]"},
+	{1000721752, "Hf175[1433.410]"},
+	{1000721753, "Hf175[3015.600]"},
+	{1000721754, "Hf175[4636.200]"},
+	{1000721760, "Hf176"},
+	{1000721761, "Hf176[1333.070]"},
+	{1000721762, "Hf176[1559.310]"},
+	{1000721763, "Hf176[2865.800]"},
+	{1000721764, "Hf176[4863.500]"},
+	{1000721770, "Hf177"},
+	{1000721771, "Hf177[1315.450]"},
+	{1000721772, "Hf177[1342.380]"},
+	{1000721773, "Hf177[2740.020]"},
+	{1000721780, "Hf178"},
+	{1000721781, "Hf178[1147.416]"},
+	{1000721782, "Hf178[2446.090]"},
+	{1000721783, "Hf178[2572.400]"},
+	{1000721790, "Hf179"},
+	{1000721791, "Hf179[375.035]"},
+	{1000721792, "Hf179[1105.740]"},
+	{1000721793, "Hf179[3775.200]"},
+	{1000721800, "Hf180"},
+	{1000721801, "Hf180[1141.500]"},
+	{1000721802, "Hf180[2425.800]"},
+	{1000721803, "Hf180[2486.300]"},
+	{1000721804, "Hf180[2538.300]"},
+	{1000721805, "Hf180[3599.300]"},
+	{1000721810, "Hf181"},
+	{1000721811, "Hf181[1043.500]"},
+	{1000721812, "Hf181[1741.900]"},
+	{1000721820, "Hf182"},
+	{1000721821, "Hf182[1172.870]"},
+	{1000721822, "Hf182[2571.300]"},
+	{1000721830, "Hf183"},
+	{1000721840, "Hf184"},
+	{1000721841, "Hf184[1272.200]"},
+	{1000721850, "Hf185"},
+	{1000721860, "Hf186"},
+	{1000721890, "Hf189"},
+	{1000731551, "Ta155[0.000]"},
+	{1000731560, "Ta156"},
+	{1000731561, "Ta156[102.000]"},
+	{1000731570, "Ta157"},
+	{1000731571, "Ta157[22.000]"},
+	{1000731572, "Ta157[1589.000]"},
+	{1000731580, "Ta158"},
+	{1000731581, "Ta158[141.000]"},
+	{1000731590, "Ta159"},
+	{1000731591, "Ta159[64.000]"},
+	{1000731600, "Ta160"},
+	{1000731611, "Ta161[0.000]"},
+	{1000731620, "Ta162"},
+	{1000731630, "Ta163"},
+	{1000731640, "Ta164"},
+	{1000731650, "Ta165"},
+	{1000731660, "Ta166"},
+	{1000731670, "Ta167"},
+	{1000731680, "Ta168"},
+	{1000731690, "Ta169"},
+	{1000731700, "Ta170"},
+	{1000731710, "Ta171"},
+	{1000731720, "Ta172"},
+	{1000731730, "Ta173"},
+	{1000731740, "Ta174"},
+	{1000731750, "Ta175"},
+	{1000731751, "Ta175[1567.600]"},
+	{1000731760, "Ta176"},
+	{1000731761, "Ta176[103.000]"},
+	{1000731762, "Ta176[1371.000]"},
+	{1000731763, "Ta176[2771.000]"},
+	{1000731770, "Ta177"},
+	{1000731771, "Ta177[186.150]"},
+	{1000731772, "Ta177[1355.010]"},
+	{1000731773, "Ta177[4656.300]"},
+	{1000731781, "Ta178[0.000]"},
+	{1000731783, "Ta178[1467.820]"},
+	{1000731784, "Ta178[2902.200]"},
+	{1000731790, "Ta179"},
+	{1000731791, "Ta179[30.700]"},
+	{1000731792, "Ta179[1317.200]"},
+	{1000731793, "Ta179[1328.000]"},
+	{1000731794, "Ta179[2639.500]"},
+	{1000731800, "Ta180"},
+	{1000731801, "Ta180[77.100]"},
+	{1000731802, "Ta180[1452.400]"},
+	{1000731803, "Ta180[3679.000]"},
+	{1000731804, "Ta180[4171.000]"},
+	{1000731810, "Ta181"},
+	{1000731811, "Ta181[6.237]"},
+	{1000731812, "Ta181[615.190]"},
+	{1000731813, "Ta181[1483.430]"},
+	{1000731814, "Ta181[2227.900]"},
+	{1000731820, "Ta182"},
+	{1000731821, "Ta182[16.273]"},
+	{1000731822, "Ta182[519.577]"},
+	{1000731830, "Ta183"},
+	{1000731840, "Ta184"},
+	{1000731850, "Ta185"},
+	{1000731851, "Ta185[1258.500]"},
+	{1000731860, "Ta186"},
+	{1000731900, "Ta190"},
+	{1000731910, "Ta191"},
+	{1000731920, "Ta192"},
+	{1000741580, "W158"},
+	{1000741581, "W158[1888.000]"},
+	{1000741590, "W159"},
+	{1000741600, "W160"},
+	{1000741610, "W161"},
+	{1000741620, "W162"},
+	{1000741630, "W163"},
+	{1000741640, "W164"},
+	{1000741650, "W165"},
+	{1000741660, "W166"},
+	{1000741670, "W167"},
+	{1000741680, "W168"},
+	{1000741690, "W169"},
+	{1000741700, "W170"},
+	{1000741710, "W171"},
+	{1000741720, "W172"},
+	{1000741730, "W173"},
+	{1000741740, "W174"},
+	{1000741750, "W175"},
+	{1000741760, "W176"},
+	{1000741770, "W177"},
+	{1000741780, "W178"},
+	{1000741790, "W179"},
+	{1000741791, "W179[221.910]"},
+	{1000741800, "W180"},
+	{1000741801, "W180[1529.010]"},
+	{1000741802, "W180[3264.560]"},
+	{1000741810, "W181"},
+	{1000741811, "W181[365.550]"},
+	{1000741820, "W182"},
+	{1000741821, "W182[2230.650]"},
+	{1000741830, "W183"},
+	{1000741831, "W183[309.493]"},
+	{1000741840, "W184"},
+	{1000741841, "W184[1284.997]"},
+	{1000741850, "W185"},
+	{1000741851, "W185[197.383]"},
+	{1000741860, "W186"},
+	{1000741861, "W186[1517.200]"},
+	{1000741862, "W186[3542.800]"},
+	{1000741870, "W187"},
+	{1000741871, "W187[410.060]"},
+	{1000741880, "W188"},
+	{1000741890, "W189"},
+	{1000741900, "W190"},
+	{1000741901, "W190[2381.000]"},
+	{1000741930, "W193"},
+	{1000741940, "W194"},
+	{1000751591, "Re159[0.000]"},
+	{1000751600, "Re160"},
+	{1000751610, "Re161"},
+	{1000751611, "Re161[123.800]"},
+	{1000751620, "Re162"},
+	{1000751621, "Re162[173.000]"},
+	{1000751630, "Re163"},
+	{1000751631, "Re163[115.000]"},
+	{1000751640, "Re164"},
+	{1000751650, "Re165"},
+	{1000751651, "Re165[48.000]"},
+	{1000751660, "Re166"},
+	{1000751670, "Re167"},
+	{1000751680, "Re168"},
+	{1000751690, "Re169"},
+	{1000751700, "Re170"},
+	{1000751710, "Re171"},
+	{1000751721, "Re172[0.000]"},
+	{1000751730, "Re173"},
+	{1000751740, "Re174"},
+	{1000751750, "Re175"},
+	{1000751760, "Re176"},
+	{1000751770, "Re177"},
+	{1000751771, "Re177[84.710]"},
+	{1000751780, "Re178"},
+	{1000751790, "Re179"},
+	{1000751791, "Re179[65.350]"},
+	{1000751792, "Re179[5408.000]"},
+	{1000751800, "Re180"},
+	{1000751810, "Re181"},
+	{1000751811, "Re181[1880.570]"},
+	{1000751812, "Re181[3869.400]"},
+	{1000751820, "Re182"},
+	{1000751830, "Re183"},
+	{1000751831, "Re183[1907.600]"},
+	{1000751840, "Re184"},
+	{1000751841, "Re184[188.046]"},
+	{1000751850, "Re185"},
+	{1000751860, "Re186"},
+	{1000751861, "Re186[149.000]"},
+	{1000751870, "Re187"},
+	{1000751880, "Re188"},
+	{1000751881, "Re188[172.069]"},
+	{1000751890, "Re189"},
+	{1000751900, "Re190"},
+	{1000751901, "Re190[210.000]"},
+	{1000751910, "Re191"},
+	{1000751920, "Re192"},
+	{1000751921, "Re192[160.100]"},
+	{1000751922, "Re192[267.000]"},
+	{1000751931, "Re193[146.000]"},
+	{1000751940, "Re194"},
+	{1000751942, "Re194[285.000]"},
+	{1000751943, "Re194[833.000]"},
+	{1000751950, "Re195"},
+	{1000751960, "Re196"},
+	{1000751980, "Re198"},
+	{1000761610, "Os161"},
+	{1000761620, "Os162"},
+	{1000761630, "Os163"},
+	{1000761640, "Os164"},
+	{1000761650, "Os165"},
+	{1000761660, "Os166"},
+	{1000761670, "Os167"},
+	{1000761680, "Os168"},
+	{1000761690, "Os169"},
+	{1000761700, "Os170"},
+	{1000761710, "Os171"},
+	{1000761720, "Os172"},
+	{1000761730, "Os173"},
+	{1000761740, "Os174"},
+	{1000761750, "Os175"},
+	{1000761760, "Os176"},
+	{1000761770, "Os177"},
+	{1000761780, "Os178"},
+	{1000761790, "Os179"},
+	{1000761800, "Os180"},
+	{1000761810, "Os181"},
+	{1000761811, "Os181[49.200]"},
+	{1000761820, "Os182"},
+	{1000761821, "Os182[1831.400]"},
+	{1000761830, "Os183"},
+	{1000761831, "Os183[170.710]"},
+	{1000761840, "Os184"},
+	{1000761850, "Os185"},
+	{1000761851, "Os185[102.370]"},
+	{1000761860, "Os186"},
+	{1000761870, "Os187"},
+	{1000761871, "Os187[257.100]"},
+	{1000761880, "Os188"},
+	{1000761890, "Os189"},
+	{1000761891, "Os189[30.812]"},
+	{1000761900, "Os190"},
+	{1000761901, "Os190[1705.400]"},
+	{1000761910, "Os191"},
+	{1000761911, "Os191[74.382]"},
+	{1000761920, "Os192"},
+	{1000761921, "Os192[2015.400]"},
+	{1000761930, "Os193"},
+	{1000761940, "Os194"},
+	{1000761950, "Os195"},
+	{1000761951, "Os195[454.000]"},
+	{1000761960, "Os196"},
+	{1000761970, "Os197"},
+	{1000761990, "Os199"},
+	{1000762000, "Os200"},
+	{1000762010, "Os201"},
+	{1000762020, "Os202"},
+	{1000771641, "Ir164[0.000]"},
+	{1000771650, "Ir165"},
+	{1000771651, "Ir165[180.000]"},
+	{1000771660, "Ir166"},
+	{1000771661, "Ir166[172.000]"},
+	{1000771670, "Ir167"},
+	{1000771671, "Ir167[175.300]"},
+	{1000771680, "Ir168"},
+	{1000771690, "Ir169"},
+	{1000771691, "Ir169[153.000]"},
+	{1000771700, "Ir170"},
+	{1000771710, "Ir171"},
+	{1000771720, "Ir172"},
+	{1000771721, "Ir172[139.000]"},
+	{1000771731, "Ir173[0.000]"},
+	{1000771740, "Ir174"},
+	{1000771741, "Ir174[193.000]"},
+	{1000771750, "Ir175"},
+	{1000771760, "Ir176"},
+	{1000771770, "Ir177"},
+	{1000771780, "Ir178"},
+	{1000771790, "Ir179"},
+	{1000771800, "Ir180"},
+	{1000771810, "Ir181"},
+	{1000771820, "Ir182"},
+	{1000771830, "Ir183"},
+	{1000771840, "Ir184"},
+	{1000771841, "Ir184[225.650]"},
+	{1000771850, "Ir185"},
+	{1000771860, "Ir186"},
+	{1000771870, "Ir187"},
+	{1000771871, "Ir187[186.160]"},
+	{1000771880, "Ir188"},
+	{1000771881, "Ir188[923.500]"},
+	{1000771890, "Ir189"},
+	{1000771891, "Ir189[372.170]"},
+	{1000771892, "Ir189[2333.200]"},
+	{1000771900, "Ir190"},
+	{1000771901, "Ir190[26.100]"},
+	{1000771902, "Ir190[36.154]"},
+	{1000771903, "Ir190[376.400]"},
+	{1000771910, "Ir191"},
+	{1000771911, "Ir191[171.290]"},
+	{1000771912, "Ir191[2046.700]"},
+	{1000771920, "Ir192"},
+	{1000771921, "Ir192[56.720]"},
+	{1000771922, "Ir192[168.140]"},
+	{1000771930, "Ir193"},
+	{1000771931, "Ir193[80.239]"},
+	{1000771940, "Ir194"},
+	{1000771941, "Ir194[147.072]"},
+	{1000771942, "Ir194[190.000]"},
+	{1000771950, "Ir195"},
+	{1000771951, "Ir195[100.000]"},
+	{1000771960, "Ir196"},
+	{1000771961, "Ir196[410.000]"},
+	{1000771970, "Ir197"},
+	{1000771971, "Ir197[115.000]"},
+	{1000771980, "Ir198"},
+	{1000771990, "Ir199"},
+	{1000772000, "Ir200"},
+	{1000772010, "Ir201"},
+	{1000772020, "Ir202"},
+	{1000772030, "Ir203"},
+	{1000772040, "Ir204"},
+	{1000781660, "Pt166"},
+	{1000781670, "Pt167"},
+	{1000781680, "Pt168"},
+	{1000781690, "Pt169"},
+	{1000781700, "Pt170"},
+	{1000781710, "Pt171"},
+	{1000781720, "Pt172"},
+	{1000781730, "Pt173"},
+	{1000781740, "Pt174"},
+	{1000781750, "Pt175"},
+	{1000781760, "Pt176"},
+	{1000781770, "Pt177"},
+	{1000781771, "Pt177[147.400]"},
+	{1000781780, "Pt178"},
+	{1000781790, "Pt179"},
+	{1000781800, "Pt180"},
+	{1000781810, "Pt181"},
+	{1000781820, "Pt182"},
+	{1000781830, "Pt183"},
+	{1000781831, "Pt183[34.500]"},
+	{1000781840, "Pt184"},
+	{1000781841, "Pt184[1840.300]"},
+	{1000781850, "Pt185"},
+	{1000781851, "Pt185[103.410]"},
+	{1000781860, "Pt186"},
+	{1000781870, "Pt187"},
+	{1000781871, "Pt187[174.380]"},
+	{1000781880, "Pt188"},
+	{1000781890, "Pt189"},
+	{1000781891, "Pt189[191.500]"},
+	{1000781900, "Pt190"},
+	{1000781910, "Pt191"},
+	{1000781911, "Pt191[149.035]"},
+	{1000781920, "Pt192"},
+	{1000781930, "Pt193"},
+	{1000781940, "Pt194"},
+	{1000781950, "Pt195"},
+	{1000781951, "Pt195[259.077]"},
+	{1000781960, "Pt196"},
+	{1000781970, "Pt197"},
+	{1000781971, "Pt197[399.590]"},
+	{1000781980, "Pt198"},
+	{1000781990, "Pt199"},
+	{1000781991, "Pt199[424.000]"},
+	{1000782000, "Pt200"},
+	{1000782010, "Pt201"},
+	{1000782020, "Pt202"},
+	{1000782021, "Pt202[1788.500]"},
+	{1000782030, "Pt203"},
+	{1000782040, "Pt204"},
+	{1000782041, "Pt204[1995.000]"},
+	{1000782050, "Pt205"},
+	{1000791700, "Au170"},
+	{1000791701, "Au170[275.000]"},
+	{1000791710, "Au171"},
+	{1000791711, "Au171[250.000]"},
+	{1000791720, "Au172"},
+	{1000791730, "Au173"},
+	{1000791731, "Au173[214.000]"},
+	{1000791740, "Au174"},
+	{1000791751, "Au175[0.000]"},
+	{1000791761, "Au176[0.000]"},
+	{1000791770, "Au177"},
+	{1000791771, "Au177[157.900]"},
+	{1000791780, "Au178"},
+	{1000791790, "Au179"},
+	{1000791791, "Au179[86.000]"},
+	{1000791800, "Au180"},
+	{1000791810, "Au181"},
+	{1000791820, "Au182"},
+	{1000791830, "Au183"},
+	{1000791840, "Au184"},
+	{1000791841, "Au184[68.460]"},
+	{1000791850, "Au185"},
+	{1000791860, "Au186"},
+	{1000791870, "Au187"},
+	{1000791871, "Au187[120.330]"},
+	{1000791880, "Au188"},
+	{1000791890, "Au189"},
+	{1000791891, "Au189[247.230]"},
+	{1000791900, "Au190"},
+	{1000791910, "Au191"},
+	{1000791911, "Au191[266.200]"},
+	{1000791920, "Au192"},
+	{1000791921, "Au192[135.410]"},
+	{1000791922, "Au192[431.600]"},
+	{1000791930, "Au193"},
+	{1000791931, "Au193[290.190]"},
+	{1000791940, "Au194"},
+	{1000791941, "Au194[107.400]"},
+	{1000791942, "Au194[475.800]"},
+	{1000791950, "Au195"},
+	{1000791951, "Au195[318.580]"},
+	{1000791952, "Au195[2460.840]"},
+	{1000791960, "Au196"},
+	{1000791961, "Au196[84.656]"},
+	{1000791962, "Au196[595.660]"},
+	{1000791970, "Au197"},
+	{1000791971, "Au197[409.150]"},
+	{1000791980, "Au198"},
+	{1000791981, "Au198[811.700]"},
+	{1000791990, "Au199"},
+	{1000791991, "Au199[548.941]"},
+	{1000792000, "Au200"},
+	{1000792001, "Au200[962.000]"},
+	{1000792010, "Au201"},
+	{1000792020, "Au202"},
+	{1000792030, "Au203"},
+	{1000792031, "Au203[641.000]"},
+	{1000792040, "Au204"},
+	{1000792041, "Au204[976.600]"},
+	{1000792050, "Au205"},
+	{1000792060, "Au206"},
+	{1000792070, "Au207"},
+	{1000792080, "Au208"},
+	{1000792090, "Au209"},
+	{1000792100, "Au210"},
+	{1000801710, "Hg171"},
+	{1000801720, "Hg172"},
+	{1000801730, "Hg173"},
+	{1000801740, "Hg174"},
+	{1000801750, "Hg175"},
+	{1000801760, "Hg176"},
+	{1000801770, "Hg177"},
+	{1000801780, "Hg178"},
+	{1000801790, "Hg179"},
+	{1000801791, "Hg179[171.400]"},
+	{1000801800, "Hg180"},
+	{1000801810, "Hg181"},
+	{1000801820, "Hg182"},
+	{1000801830, "Hg183"},
+	{1000801840, "Hg184"},
+	{1000801850, "Hg185"},
+	{1000801851, "Hg185[99.300]"},
+	{1000801860, "Hg186"},
+	{1000801861, "Hg186[2217.300]"},
+	{1000801870, "Hg187"},
+	{1000801880, "Hg188"},
+	{1000801890, "Hg189"},
+	{1000801900, "Hg190"},
+	{1000801910, "Hg191"},
+	{1000801920, "Hg192"},
+	{1000801930, "Hg193"},
+	{1000801931, "Hg193[140.760]"},
+	{1000801940, "Hg194"},
+	{1000801950, "Hg195"},
+	{1000801951, "Hg195[176.070]"},
+	{1000801960, "Hg196"},
+	{1000801970, "Hg197"},
+	{1000801971, "Hg197[298.930]"},
+	{1000801980, "Hg198"},
+	{1000801990, "Hg199"},
+	{1000801991, "Hg199[532.480]"},
+	{1000802000, "Hg200"},
+	{1000802010, "Hg201"},
+	{1000802011, "Hg201[766.220]"},
+	{1000802020, "Hg202"},
+	{1000802030, "Hg203"},
+	{1000802031, "Hg203[933.140]"},
+	{1000802040, "Hg204"},
+	{1000802050, "Hg205"},
+	{1000802051, "Hg205[1556.400]"},
+	{1000802060, "Hg206"},
+	{1000802061, "Hg206[2102.400]"},
+	{1000802070, "Hg207"},
+	{1000802080, "Hg208"},
+	{1000802090, "Hg209"},
+	{1000802101, "Hg210[663.000]"},
+	{1000802102, "Hg210[1366.000]"},
+	{1000802110, "Hg211"},
+	{1000802120, "Hg212"},
+	{1000802130, "Hg213"},
+	{1000802140, "Hg214"},
+	{1000802150, "Hg215"},
+	{1000802160, "Hg216"},
+	{1000811760, "Tl176"},
+	{1000811770, "Tl177"},
+	{1000811771, "Tl177[807.000]"},
+	{1000811780, "Tl178"},
+	{1000811790, "Tl179"},
+	{1000811800, "Tl180"},
+	{1000811810, "Tl181"},
+	{1000811811, "Tl181[835.900]"},
+	{1000811820, "Tl182"},
+	{1000811830, "Tl183"},
+	{1000811831, "Tl183[630.000]"},
+	{1000811832, "Tl183[976.800]"},
+	{1000811840, "Tl184"},
+	{1000811850, "Tl185"},
+	{1000811851, "Tl185[454.800]"},
+	{1000811861, "Tl186[0.000]"},
+	{1000811862, "Tl186[374.000]"},
+	{1000811870, "Tl187"},
+	{1000811871, "Tl187[334.000]"},
+	{1000811872, "Tl187[1434.230]"},
+	{1000811881, "Tl188[0.000]"},
+	{1000811883, "Tl188[268.800]"},
+	{1000811890, "Tl189"},
+	{1000811891, "Tl189[281.000]"},
+	{1000811901, "Tl190[0.000]"},
+	{1000811903, "Tl190[161.900]"},
+	{1000811911, "Tl191[0.000]"},
+	{1000811920, "Tl192"},
+	{1000811921, "Tl192[138.000]"},
+	{1000811930, "Tl193"},
+	{1000811931, "Tl193[365.200]"},
+	{1000811940, "Tl194"},
+	{1000811950, "Tl195"},
+	{1000811951, "Tl195[482.630]"},
+	{1000811960, "Tl196"},
+	{1000811961, "Tl196[394.200]"},
+	{1000811970, "Tl197"},
+	{1000811971, "Tl197[608.220]"},
+	{1000811980, "Tl198"},
+	{1000811981, "Tl198[543.600]"},
+	{1000811982, "Tl198[742.400]"},
+	{1000811990, "Tl199"},
+	{1000811991, "Tl199[748.870]"},
+	{1000812000, "Tl200"},
+	{1000812001, "Tl200[753.600]"},
+	{1000812010, "Tl201"},
+	{1000812011, "Tl201[919.160]"},
+	{1000812020, "Tl202"},
+	{1000812021, "Tl202[950.190]"},
+	{1000812030, "Tl203"},
+	{1000812031, "Tl203[3514.600]"},
+	{1000812040, "Tl204"},
+	{1000812041, "Tl204[1103.900]"},
+	{1000812042, "Tl204[2318.800]"},
+	{1000812050, "Tl205"},
+	{1000812051, "Tl205[3290.600]"},
+	{1000812060, "Tl206"},
+	{1000812061, "Tl206[2643.100]"},
+	{1000812070, "Tl207"},
+	{1000812071, "Tl207[1348.180]"},
+	{1000812080, "Tl208"},
+	{1000812090, "Tl209"},
+	{1000812100, "Tl210"},
+	{1000812110, "Tl211"},
+	{1000812120, "Tl212"},
+	{1000812130, "Tl213"},
+	{1000812140, "Tl214"},
+	{1000812150, "Tl215"},
+	{1000812160, "Tl216"},
+	{1000812170, "Tl217"},
+	{1000821780, "Pb178"},
+	{1000821790, "Pb179"},
+	{1000821800, "Pb180"},
+	{1000821811, "Pb181[0.000]"},
+	{1000821820, "Pb182"},
+	{1000821830, "Pb183"},
+	{1000821831, "Pb183[97.000]"},
+	{1000821840, "Pb184"},
+	{1000821850, "Pb185"},
+	{1000821860, "Pb186"},
+	{1000821870, "Pb187"},
+	{1000821871, "Pb187[33.000]"},
+	{1000821880, "Pb188"},
+	{1000821890, "Pb189"},
+	{1000821892, "Pb189[2434.500]"},
+	{1000821900, "Pb190"},
+	{1000821901, "Pb190[2615.000]"},
+	{1000821902, "Pb190[2658.200]"},
+	{1000821910, "Pb191"},
+	{1000821920, "Pb192"},
+	{1000821921, "Pb192[2624.000]"},
+	{1000821931, "Pb193[0.000]"},
+	{1000821940, "Pb194"},
+	{1000821950, "Pb195"},
+	{1000821951, "Pb195[202.900]"},
+	{1000821952, "Pb195[1759.000]"},
+	{1000821960, "Pb196"},
+	{1000821970, "Pb197"},
+	{1000821971, "Pb197[319.310]"},
+	{1000821972, "Pb197[1914.100]"},
+	{1000821980, "Pb198"},
+	{1000821981, "Pb198[2141.400]"},
+	{1000821990, "Pb199"},
+	{1000821991, "Pb199[424.800]"},
+	{1000821992, "Pb199[2559.100]"},
+	{1000822000, "Pb200"},
+	{1000822010, "Pb201"},
+	{1000822011, "Pb201[629.100]"},
+	{1000822020, "Pb202"},
+	{1000822021, "Pb202[2169.850]"},
+	{1000822030, "Pb203"},
+	{1000822031, "Pb203[825.200]"},
+	{1000822032, "Pb203[2949.200]"},
+	{1000822040, "Pb204"},
+	{1000822041, "Pb204[2185.880]"},
+	{1000822050, "Pb205"},
+	{1000822051, "Pb205[2.329]"},
+	{1000822052, "Pb205[1013.850]"},
+	{1000822060, "Pb206"},
+	{1000822061, "Pb206[2200.160]"},
+	{1000822070, "Pb207"},
+	{1000822071, "Pb207[1633.356]"},
+	{1000822080, "Pb208"},
+	{1000822090, "Pb209"},
+	{1000822100, "Pb210"},
+	{1000822110, "Pb211"},
+	{1000822120, "Pb212"},
+	{1000822130, "Pb213"},
+	{1000822140, "Pb214"},
+	{1000822141, "Pb214[1365.000]"},
+	{1000822150, "Pb215"},
+	{1000822160, "Pb216"},
+	{1000822170, "Pb217"},
+	{1000822180, "Pb218"},
+	{1000822190, "Pb219"},
+	{1000822200, "Pb220"},
+	{1000831841, "Bi184[0.000]"},
+	{1000831850, "Bi185"},
+	{1000831860, "Bi186"},
+	{1000831870, "Bi187"},
+	{1000831871, "Bi187[112.000]"},
+	{1000831872, "Bi187[252.000]"},
+	{1000831881, "Bi188[0.000]"},
+	{1000831890, "Bi189"},
+	{1000831891, "Bi189[184.000]"},
+	{1000831892, "Bi189[357.600]"},
+	{1000831901, "Bi190[0.000]"},
+	{1000831910, "Bi191"},
+	{1000831911, "Bi191[241.000]"},
+	{1000831920, "Bi192"},
+	{1000831921, "Bi192[147.000]"},
+	{1000831930, "Bi193"},
+	{1000831931, "Bi193[308.000]"},
+	{1000831932, "Bi193[2357.000]"},
+	{1000831940, "Bi194"},
+	{1000831950, "Bi195"},
+	{1000831951, "Bi195[401.000]"},
+	{1000831960, "Bi196"},
+	{1000831961, "Bi196[169.000]"},
+	{1000831962, "Bi196[271.000]"},
+	{1000831970, "Bi197"},
+	{1000831971, "Bi197[500.000]"},
+	{1000831980, "Bi198"},
+	{1000831982, "Bi198[248.500]"},
+	{1000831990, "Bi199"},
+	{1000831991, "Bi199[667.000]"},
+	{1000832000, "Bi200"},
+	{1000832002, "Bi200[428.200]"},
+	{1000832010, "Bi201"},
+	{1000832011, "Bi201[846.350]"},
+	{1000832020, "Bi202"},
+	{1000832021, "Bi202[605.000]"},
+	{1000832030, "Bi203"},
+	{1000832031, "Bi203[1098.120]"},
+	{1000832040, "Bi204"},
+	{1000832041, "Bi204[805.500]"},
+	{1000832042, "Bi204[2833.400]"},
+	{1000832050, "Bi205"},
+	{1000832051, "Bi205[1497.170]"},
+	{1000832060, "Bi206"},
+	{1000832061, "Bi206[59.897]"},
+	{1000832062, "Bi206[1044.800]"},
+	{1000832070, "Bi207"},
+	{1000832071, "Bi207[2101.610]"},
+	{1000832080, "Bi208"},
+	{1000832081, "Bi208[1571.100]"},
+	{1000832090, "Bi209"},
+	{1000832100, "Bi210"},
+	{1000832101, "Bi210[271.310]"},
+	{1000832110, "Bi211"},
+	{1000832111, "Bi211[1257.000]"},
+	{1000832120, "Bi212"},
+	{1000832121, "Bi212[250.000]"},
+	{1000832122, "Bi212[1910.000]"},
+	{1000832130, "Bi213"},
+	{1000832140, "Bi214"},
+	{1000832150, "Bi215"},
+	{1000832151, "Bi215[1347.500]"},
+	{1000832160, "Bi216"},
+	{1000832170, "Bi217"},
+	{1000832171, "Bi217[1436.000]"},
+	{1000832180, "Bi218"},
+	{1000832190, "Bi219"},
+	{1000832200, "Bi220"},
+	{1000832210, "Bi221"},
+	{1000832230, "Bi223"},
+	{1000832240, "Bi224"},
+	{1000841860, "Po186"},
+	{1000841870, "Po187"},
+	{1000841880, "Po188"},
+	{1000841890, "Po189"},
+	{1000841900, "Po190"},
+	{1000841910, "Po191"},
+	{1000841911, "Po191[40.000]"},
+	{1000841920, "Po192"},
+	{1000841931, "Po193[0.000]"},
+	{1000841940, "Po194"},
+	{1000841941, "Po194[2525.200]"},
+	{1000841950, "Po195"},
+	{1000841951, "Po195[230.000]"},
+	{1000841960, "Po196"},
+	{1000841970, "Po197"},
+	{1000841971, "Po197[204.000]"},
+	{1000841980, "Po198"},
+	{1000841990, "Po199"},
+	{1000841991, "Po199[310.000]"},
+	{1000842000, "Po200"},
+	{1000842010, "Po201"},
+	{1000842011, "Po201[424.100]"},
+	{1000842020, "Po202"},
+	{1000842030, "Po203"},
+	{1000842031, "Po203[641.680]"},
+	{1000842040, "Po204"},
+	{1000842050, "Po205"},
+	{1000842051, "Po205[880.310]"},
+	{1000842052, "Po205[1461.210]"},
+	{1000842060, "Po206"},
+	{1000842061, "Po206[2262.090]"},
+	{1000842070, "Po207"},
+	{1000842071, "Po207[1115.076]"},
+	{1000842072, "Po207[1383.160]"},
+	{1000842080, "Po208"},
+	{1000842090, "Po209"},
+	{1000842100, "Po210"},
+	{1000842110, "Po211"},
+	{1000842111, "Po211[1462.000]"},
+	{1000842112, "Po211[4872.000]"},
+	{1000842120, "Po212"},
+	{1000842121, "Po212[2922.000]"},
+	{1000842130, "Po213"},
+	{1000842140, "Po214"},
+	{1000842150, "Po215"},
+	{1000842160, "Po216"},
+	{1000842170, "Po217"},
+	{1000842180, "Po218"},
+	{1000842190, "Po219"},
+	{1000842200, "Po220"},
+	{1000842210, "Po221"},
+	{1000842220, "Po222"},
+	{1000842230, "Po223"},
+	{1000842240, "Po224"},
+	{1000842250, "Po225"},
+	{1000842260, "Po226"},
+	{1000842270, "Po227"},
+	{1000851910, "At191"},
+	{1000851911, "At191[55.000]"},
+	{1000851921, "At192[0.000]"},
+	{1000851930, "At193"},
+	{1000851931, "At193[5.000]"},
+	{1000851932, "At193[39.000]"},
+	{1000851941, "At194[0.000]"},
+	{1000851950, "At195"},
+	{1000851951, "At195[33.000]"},
+	{1000851960, "At196"},
+	{1000851961, "At196[157.900]"},
+	{1000851970, "At197"},
+	{1000851971, "At197[52.000]"},
+	{1000851980, "At198"},
+	{1000851981, "At198[102.000]"},
+	{1000851990, "At199"},
+	{1000852000, "At200"},
+	{1000852001, "At200[112.000]"},
+	{1000852002, "At200[344.000]"},
+	{1000852010, "At201"},
+	{1000852020, "At202"},
+	{1000852022, "At202[391.700]"},
+	{1000852030, "At203"},
+	{1000852040, "At204"},
+	{1000852041, "At204[587.300]"},
+	{1000852050, "At205"},
+	{1000852051, "At205[2339.650]"},
+	{1000852060, "At206"},
+	{1000852070, "At207"},
+	{1000852080, "At208"},
+	{1000852081, "At208[2276.400]"},
+	{1000852090, "At209"},
+	{1000852100, "At210"},
+	{1000852101, "At210[4027.700]"},
+	{1000852110, "At211"},
+	{1000852111, "At211[4814.500]"},
+	{1000852120, "At212"},
+	{1000852121, "At212[223.000]"},
+	{1000852122, "At212[4771.600]"},
+	{1000852130, "At213"},
+	{1000852131, "At213[2926.000]"},
+	{1000852140, "At214"},
+	{1000852150, "At215"},
+	{1000852160, "At216"},
+	{1000852161, "At216[413.000]"},
+	{1000852170, "At217"},
+	{1000852180, "At218"},
+	{1000852190, "At219"},
+	{1000852200, "At220"},
+	{1000852210, "At221"},
+	{1000852220, "At222"},
+	{1000852230, "At223"},
+	{1000852240, "At224"},
+	{1000852250, "At225"},
+	{1000852260, "At226"},
+	{1000852270, "At227"},
+	{1000852280, "At228"},
+	{1000852290, "At229"},
+	{1000861940, "Rn194"},
+	{1000861950, "Rn195"},
+	{1000861951, "Rn195[59.000]"},
+	{1000861960, "Rn196"},
+	{1000861970, "Rn197"},
+	{1000861980, "Rn198"},
+	{1000861990, "Rn199"},
+	{1000861991, "Rn199[180.000]"},
+	{1000862000, "Rn200"},
+	{1000862001, "Rn200[2300.500]"},
+	{1000862010, "Rn201"},
+	{1000862020, "Rn202"},
+	{1000862030, "Rn203"},
+	{1000862031, "Rn203[362.000]"},
+	{1000862040, "Rn204"},
+	{1000862050, "Rn205"},
+	{1000862060, "Rn206"},
+	{1000862070, "Rn207"},
+	{1000862071, "Rn207[899.100]"},
+	{1000862080, "Rn208"},
+	{1000862090, "Rn209"},
+	{1000862091, "Rn209[1173.980]"},
+	{1000862092, "Rn209[3636.780]"},
+	{1000862100, "Rn210"},
+	{1000862101, "Rn210[3812.400]"},
+	{1000862102, "Rn210[6469.020]"},
+	{1000862110, "Rn211"},
+	{1000862120, "Rn212"},
+	{1000862130, "Rn213"},
+	{1000862131, "Rn213[2186.700]"},
+	{1000862140, "Rn214"},
+	{1000862150, "Rn215"},
+	{1000862160, "Rn216"},
+	{1000862170, "Rn217"},
+	{1000862180, "Rn218"},
+	{1000862190, "Rn219"},
+	{1000862200, "Rn220"},
+	{1000862210, "Rn221"},
+	{1000862220, "Rn222"},
+	{1000862230, "Rn223"},
+	{1000862240, "Rn224"},
+	{1000862250, "Rn225"},
+	{1000862260, "Rn226"},
+	{1000862270, "Rn227"},
+	{1000862280, "Rn228"},
+	{1000862290, "Rn229"},
+	{1000871990, "Fr199"},
+	{1000872000, "Fr200"},
+	{1000872010, "Fr201"},
+	{1000872020, "Fr202"},
+	{1000872030, "Fr203"},
+	{1000872040, "Fr204"},
+	{1000872041, "Fr204[41.000]"},
+	{1000872042, "Fr204[316.000]"},
+	{1000872050, "Fr205"},
+	{1000872060, "Fr206"},
+	{1000872062, "Fr206[531.000]"},
+	{1000872070, "Fr207"},
+	{1000872080, "Fr208"},
+	{1000872090, "Fr209"},
+	{1000872100, "Fr210"},
+	{1000872110, "Fr211"},
+	{1000872120, "Fr212"},
+	{1000872121, "Fr212[1551.400]"},
+	{1000872122, "Fr212[8533.400]"},
+	{1000872130, "Fr213"},
+	{1000872131, "Fr213[8094.800]"},
+	{1000872140, "Fr214"},
+	{1000872141, "Fr214[122.000]"},
+	{1000872150, "Fr215"},
+	{1000872160, "Fr216"},
+	{1000872170, "Fr217"},
+	{1000872180, "Fr218"},
+	{1000872181, "Fr218[86.000]"},
+	{1000872190, "Fr219"},
+	{1000872200, "Fr220"},
+	{1000872210, "Fr221"},
+	{1000872220, "Fr222"},
+	{1000872230, "Fr223"},
+	{1000872240, "Fr224"},
+	{1000872250, "Fr225"},
+	{1000872260, "Fr226"},
+	{1000872270, "Fr227"},
+	{1000872280, "Fr228"},
+	{1000872290, "Fr229"},
+	{1000872300, "Fr230"},
+	{1000872310, "Fr231"},
+	{1000872320, "Fr232"},
+	{1000872330, "Fr233"},
+	{1000882011, "Ra201[0.000]"},
+	{1000882020, "Ra202"},
+	{1000882030, "Ra203"},
+	{1000882040, "Ra204"},
+	{1000882050, "Ra205"},
+	{1000882060, "Ra206"},
+	{1000882070, "Ra207"},
+	{1000882071, "Ra207[554.000]"},
+	{1000882080, "Ra208"},
+	{1000882090, "Ra209"},
+	{1000882100, "Ra210"},
+	{1000882101, "Ra210[2050.900]"},
+	{1000882110, "Ra211"},
+	{1000882111, "Ra211[1198.100]"},
+	{1000882120, "Ra212"},
+	{1000882121, "Ra212[1958.400]"},
+	{1000882130, "Ra213"},
+	{1000882131, "Ra213[1770.000]"},
+	{1000882140, "Ra214"},
+	{1000882141, "Ra214[1865.200]"},
+	{1000882150, "Ra215"},
+	{1000882151, "Ra215[1877.800]"},
+	{1000882152, "Ra215[2246.900]"},
+	{1000882160, "Ra216"},
+	{1000882170, "Ra217"},
+	{1000882180, "Ra218"},
+	{1000882190, "Ra219"},
+	{1000882200, "Ra220"},
+	{1000882210, "Ra221"},
+	{1000882220, "Ra222"},
+	{1000882230, "Ra223"},
+	{1000882240, "Ra224"},
+	{1000882250, "Ra225"},
+	{1000882260, "Ra226"},
+	{1000882270, "Ra227"},
+	{1000882290, "Ra229"},
+	{1000882300, "Ra230"},
+	{1000882310, "Ra231"},
+	{1000882311, "Ra231[66.210]"},
+	{1000882320, "Ra232"},
+	{1000882330, "Ra233"},
+	{1000882340, "Ra234"},
+	{1000892060, "Ac206"},
+	{1000892070, "Ac207"},
+	{1000892080, "Ac208"},
+	{1000892081, "Ac208[506.000]"},
+	{1000892090, "Ac209"},
+	{1000892100, "Ac210"},
+	{1000892110, "Ac211"},
+	{1000892120, "Ac212"},
+	{1000892130, "Ac213"},
+	{1000892140, "Ac214"},
+	{1000892150, "Ac215"},
+	{1000892160, "Ac216"},
+	{1000892161, "Ac216[48.000]"},
+	{1000892170, "Ac217"},
+	{1000892180, "Ac218"},
+	{1000892190, "Ac219"},
+	{1000892200, "Ac220"},
+	{1000892210, "Ac221"},
+	{1000892220, "Ac222"},
+	{1000892230, "Ac223"},
+	{1000892240, "Ac224"},
+	{1000892260, "Ac226"},
+	{1000892270, "Ac227"},
+	{1000892280, "Ac228"},
+	{1000892290, "Ac229"},
+	{1000892300, "Ac230"},
+	{1000892310, "Ac231"},
+	{1000892320, "Ac232"},
+	{1000892330, "Ac233"},
+	{1000892340, "Ac234"},
+	{1000892350, "Ac235"},
+	{1000902080, "Th208"},
+	{1000902090, "Th209"},
+	{1000902100, "Th210"},
+	{1000902110, "Th211"},
+	{1000902120, "Th212"},
+	{1000902130, "Th213"},
+	{1000902140, "Th214"},
+	{1000902141, "Th214[2181.000]"},
+	{1000902150, "Th215"},
+	{1000902160, "Th216"},
+	{1000902161, "Th216[2040.000]"},
+	{1000902170, "Th217"},
+	{1000902180, "Th218"},
+	{1000902190, "Th219"},
+	{1000902200, "Th220"},
+	{1000902210, "Th221"},
+	{1000902220, "Th222"},
+	{1000902230, "Th223"},
+	{1000902240, "Th224"},
+	{1000902250, "Th225"},
+	{1000902260, "Th226"},
+	{1000902270, "Th227"},
+	{1000902280, "Th228"},
+	{1000902290, "Th229"},
+	{1000902300, "Th230"},
+	{1000902310, "Th231"},
+	{1000902320, "Th232"},
+	{1000902330, "Th233"},
+	{1000902340, "Th234"},
+	{1000902350, "Th235"},
+	{1000902360, "Th236"},
+	{1000902370, "Th237"},
+	{1000902380, "Th238"},
+	{1000912120, "Pa212"},
+	{1000912130, "Pa213"},
+	{1000912140, "Pa214"},
+	{1000912150, "Pa215"},
+	{1000912160, "Pa216"},
+	{1000912170, "Pa217"},
+	{1000912171, "Pa217[1850.000]"},
+	{1000912180, "Pa218"},
+	{1000912210, "Pa221"},
+	{1000912220, "Pa222"},
+	{1000912230, "Pa223"},
+	{1000912240, "Pa224"},
+	{1000912250, "Pa225"},
+	{1000912260, "Pa226"},
+	{1000912270, "Pa227"},
+	{1000912280, "Pa228"},
+	{1000912290, "Pa229"},
+	{1000912300, "Pa230"},
+	{1000912310, "Pa231"},
+	{1000912320, "Pa232"},
+	{1000912330, "Pa233"},
+	{1000912340, "Pa234"},
+	{1000912341, "Pa234[73.920]"},
+	{1000912350, "Pa235"},
+	{1000912360, "Pa236"},
+	{1000912370, "Pa237"},
+	{1000912380, "Pa238"},
+	{1000912390, "Pa239"},
+	{1000922170, "U217"},
+	{1000922180, "U218"},
+	{1000922181, "U218[2105.000]"},
+	{1000922190, "U219"},
+	{1000922210, "U221"},
+	{1000922220, "U222"},
+	{1000922230, "U223"},
+	{1000922240, "U224"},
+	{1000922250, "U225"},
+	{1000922260, "U226"},
+	{1000922270, "U227"},
+	{1000922280, "U228"},
+	{1000922290, "U229"},
+	{1000922300, "U230"},
+	{1000922310, "U231"},
+	{1000922320, "U232"},
+	{1000922330, "U233"},
+	{1000922340, "U234"},
+	{1000922341, "U234[1421.257]"},
+	{1000922350, "U235"},
+	{1000922352, "U235[2500.000]"},
+	{1000922360, "U236"},
+	{1000922370, "U237"},
+	{1000922380, "U238"},
+	{1000922390, "U239"},
+	{1000922400, "U240"},
+	{1000922420, "U242"},
+	{1000932260, "Np226"},
+	{1000932270, "Np227"},
+	{1000932280, "Np228"},
+	{1000932290, "Np229"},
+	{1000932300, "Np230"},
+	{1000932310, "Np231"},
+	{1000932320, "Np232"},
+	{1000932330, "Np233"},
+	{1000932340, "Np234"},
+	{1000932350, "Np235"},
+	{1000932360, "Np236"},
+	{1000932370, "Np237"},
+	{1000932380, "Np238"},
+	{1000932390, "Np239"},
+	{1000932400, "Np240"},
+	{1000932410, "Np241"},
+	{1000932420, "Np242"},
+	{1000932430, "Np243"},
+	{1000932440, "Np244"},
+	{1000942280, "Pu228"},
+	{1000942290, "Pu229"},
+	{1000942300, "Pu230"},
+	{1000942310, "Pu231"},
+	{1000942320, "Pu232"},
+	{1000942330, "Pu233"},
+	{1000942340, "Pu234"},
+	{1000942350, "Pu235"},
+	{1000942360, "Pu236"},
+	{1000942361, "Pu236[1185.450]"},
+	{1000942370, "Pu237"},
+	{1000942371, "Pu237[145.543]"},
+	{1000942372, "Pu237[2900.000]"},
+	{1000942380, "Pu238"},
+	{1000942390, "Pu239"},
+	{1000942391, "Pu239[3100.000]"},
+	{1000942400, "Pu240"},
+	{1000942410, "Pu241"},
+	{1000942411, "Pu241[2200.000]"},
+	{1000942420, "Pu242"},
+	{1000942430, "Pu243"},
+	{1000942440, "Pu244"},
+	{1000942450, "Pu245"},
+	{1000942460, "Pu246"},
+	{1000942470, "Pu247"},
+	{1000952300, "Am230"},
+	{1000952320, "Am232"},
+	{1000952330, "Am233"},
+	{1000952340, "Am234"},
+	{1000952350, "Am235"},
+	{1000952360, "Am236"},
+	{1000952370, "Am237"},
+	{1000952380, "Am238"},
+	{1000952381, "Am238[2500.000]"},
+	{1000952390, "Am239"},
+	{1000952400, "Am240"},
+	{1000952401, "Am240[3000.000]"},
+	{1000952410, "Am241"},
+	{1000952411, "Am241[2200.000]"},
+	{1000952420, "Am242"},
+	{1000952421, "Am242[48.600]"},
+	{1000952422, "Am242[2200.000]"},
+	{1000952430, "Am243"},
+	{1000952431, "Am243[2300.000]"},
+	{1000952440, "Am244"},
+	{1000952443, "Am244[86.100]"},
+	{1000952450, "Am245"},
+	{1000952460, "Am246"},
+	{1000952462, "Am246[2000.000]"},
+	{1000952470, "Am247"},
+	{1000962340, "Cm234"},
+	{1000962380, "Cm238"},
+	{1000962390, "Cm239"},
+	{1000962400, "Cm240"},
+	{1000962410, "Cm241"},
+	{1000962420, "Cm242"},
+	{1000962430, "Cm243"},
+	{1000962431, "Cm243[87.400]"},
+	{1000962440, "Cm244"},
+	{1000962441, "Cm244[1040.188]"},
+	{1000962450, "Cm245"},
+	{1000962460, "Cm246"},
+	{1000962470, "Cm247"},
+	{1000962471, "Cm247[227.380]"},
+	{1000962480, "Cm248"},
+	{1000962490, "Cm249"},
+	{1000962491, "Cm249[48.760]"},
+	{1000962500, "Cm250"},
+	{1000962510, "Cm251"},
+	{1000962520, "Cm252"},
+	{1000972340, "Bk234"},
+	{1000972380, "Bk238"},
+	{1000972400, "Bk240"},
+	{1000972410, "Bk241"},
+	{1000972420, "Bk242"},
+	{1000972430, "Bk243"},
+	{1000972440, "Bk244"},
+	{1000972450, "Bk245"},
+	{1000972461, "Bk246[0.000]"},
+	{1000972470, "Bk247"},
+	{1000972481, "Bk248[0.000]"},
+	{1000972490, "Bk249"},
+	{1000972491, "Bk249[8.777]"},
+	{1000972500, "Bk250"},
+	{1000972501, "Bk250[35.590]"},
+	{1000972502, "Bk250[86.000]"},
+	{1000972510, "Bk251"},
+	{1000972511, "Bk251[35.500]"},
+	{1000972531, "Bk253[0.000]"},
+	{1000982370, "Cf237"},
+	{1000982380, "Cf238"},
+	{1000982390, "Cf239"},
+	{1000982400, "Cf240"},
+	{1000982410, "Cf241"},
+	{1000982420, "Cf242"},
+	{1000982430, "Cf243"},
+	{1000982440, "Cf244"},
+	{1000982450, "Cf245"},
+	{1000982460, "Cf246"},
+	{1000982470, "Cf247"},
+	{1000982480, "Cf248"},
+	{1000982490, "Cf249"},
+	{1000982491, "Cf249[144.980]"},
+	{1000982500, "Cf250"},
+	{1000982510, "Cf251"},
+	{1000982511, "Cf251[370.470]"},
+	{1000982520, "Cf252"},
+	{1000982530, "Cf253"},
+	{1000982540, "Cf254"},
+	{1000982550, "Cf255"},
+	{1000982560, "Cf256"},
+	{1000992410, "Es241"},
+	{1000992420, "Es242"},
+	{1000992431, "Es243[0.000]"},
+	{1000992440, "Es244"},
+	{1000992450, "Es245"},
+	{1000992461, "Es246[0.000]"},
+	{1000992470, "Es247"},
+	{1000992480, "Es248"},
+	{1000992490, "Es249"},
+	{1000992500, "Es250"},
+	{1000992510, "Es251"},
+	{1000992520, "Es252"},
+	{1000992530, "Es253"},
+	{1000992540, "Es254"},
+	{1000992541, "Es254[84.200]"},
+	{1000992550, "Es255"},
+	{1000992560, "Es256"},
+	{1000992570, "Es257"},
+	{1001002410, "Fm241"},
+	{1001002420, "Fm242"},
+	{1001002430, "Fm243"},
+	{1001002440, "Fm244"},
+	{1001002450, "Fm245"},
+	{1001002460, "Fm246"},
+	{1001002470, "Fm247"},
+	{1001002480, "Fm248"},
+	{1001002481, "Fm248[1074.000]"},
+	{1001002490, "Fm249"},
+	{1001002500, "Fm250"},
+	{1001002510, "Fm251"},
+	{1001002511, "Fm251[200.000]"},
+	{1001002520, "Fm252"},
+	{1001002530, "Fm253"},
+	{1001002540, "Fm254"},
+	{1001002550, "Fm255"},
+	{1001002560, "Fm256"},
+	{1001002570, "Fm257"},
+	{1001002580, "Fm258"},
+	{1001002590, "Fm259"},
+	{1001012450, "Md245"},
+	{1001012451, "Md245[300.000]"},
+	{1001012461, "Md246[0.000]"},
+	{1001012470, "Md247"},
+	{1001012480, "Md248"},
+	{1001012490, "Md249"},
+	{1001012500, "Md250"},
+	{1001012510, "Md251"},
+	{1001012520, "Md252"},
+	{1001012530, "Md253"},
+	{1001012541, "Md254[0.000]"},
+	{1001012550, "Md255"},
+	{1001012560, "Md256"},
+	{1001012570, "Md257"},
+	{1001012580, "Md258"},
+	{1001012590, "Md259"},
+	{1001012600, "Md260"},
+	{1001022480, "No248"},
+	{1001022510, "No251"},
+	{1001022511, "No251[106.000]"},
+	{1001022512, "No251[1699.700]"},
+	{1001022520, "No252"},
+	{1001022530, "No253"},
+	{1001022532, "No253[167.500]"},
+	{1001022533, "No253[1440.000]"},
+	{1001022540, "No254"},
+	{1001022550, "No255"},
+	{1001022560, "No256"},
+	{1001022570, "No257"},
+	{1001022580, "No258"},
+	{1001022590, "No259"},
+	{1001022600, "No260"},
+	{1001022620, "No262"},
+	{1001032520, "Lr252"},
+	{1001032530, "Lr253"},
+	{1001032540, "Lr254"},
+	{1001032550, "Lr255"},
+	{1001032551, "Lr255[38.000]"},
+	{1001032552, "Lr255[1408.600]"},
+	{1001032560, "Lr256"},
+	{1001032570, "Lr257"},
+	{1001032580, "Lr258"},
+	{1001032590, "Lr259"},
+	{1001032600, "Lr260"},
+	{1001032610, "Lr261"},
+	{1001032620, "Lr262"},
+	{1001032660, "Lr266"},
+	{1001042531, "Rf253[0.000]"},
+	{1001042540, "Rf254"},
+	{1001042550, "Rf255"},
+	{1001042560, "Rf256"},
+	{1001042561, "Rf256[1120.000]"},
+	{1001042562, "Rf256[1400.000]"},
+	{1001042563, "Rf256[2200.000]"},
+	{1001042570, "Rf257"},
+	{1001042571, "Rf257[75.000]"},
+	{1001042572, "Rf257[1157.000]"},
+	{1001042580, "Rf258"},
+	{1001042590, "Rf259"},
+	{1001042600, "Rf260"},
+	{1001042611, "Rf261[0.000]"},
+	{1001042612, "Rf261[227.000]"},
+	{1001042620, "Rf262"},
+	{1001042630, "Rf263"},
+	{1001052550, "Db255"},
+	{1001052560, "Db256"},
+	{1001052570, "Db257"},
+	{1001052571, "Db257[370.000]"},
+	{1001052580, "Db258"},
+	{1001052590, "Db259"},
+	{1001052600, "Db260"},
+	{1001052610, "Db261"},
+	{1001052620, "Db262"},
+	{1001052630, "Db263"},
+	{1001052701, "Db270[0.000]"},
+	{1001062580, "Sg258"},
+	{1001062590, "Sg259"},
+	{1001062600, "Sg260"},
+	{1001062610, "Sg261"},
+	{1001062620, "Sg262"},
+	{1001062630, "Sg263"},
+	{1001062640, "Sg264"},
+	{1001062651, "Sg265[0.000]"},
+	{1001062652, "Sg265[150.000]"},
+	{1001062660, "Sg266"},
+	{1001062690, "Sg269"},
+	{1001072610, "Bh261"},
+	{1001072621, "Bh262[0.000]"},
+	{1001072640, "Bh264"},
+	{1001072671, "Bh267[0.000]"},
+	{1001072741, "Bh274[0.000]"},
+	{1001082640, "Hs264"},
+	{1001082650, "Hs265"},
+	{1001082651, "Hs265[300.000]"},
+	{1001082660, "Hs266"},
+	{1001082670, "Hs267"},
+	{1001082691, "Hs269[0.000]"},
+	{1001082730, "Hs273"},
+	{1001082770, "Hs277"},
+	{1001092661, "Mt266[0.000]"},
+	{1001092681, "Mt268[0.000]"},
+	{1001092741, "Mt274[0.000]"},
+	{1001092770, "Mt277"},
+	{1001092781, "Mt278[0.000]"},
+	{1001102710, "Ds271"},
+	{1001102730, "Ds273"},
+	{1001102770, "Ds277"},
+	{1001112721, "Rg272[0.000]"},
+	{1001112781, "Rg278[0.000]"},
+	{1001112811, "Rg281[0.000]"},
+	{1001112821, "Rg282[0.000]"},
+	{1001122770, "Cp277"},
+	{1001122810, "Cp281"},
+	{1001132851, "Uut285[0.000]"},
+	{1001132861, "Uut286[0.000]"},
+	{1001152891, "Uup289[0.000]"},
+	{1001152901, "Uup290[0.000]"},
+	{1001172931, "Uus293[0.000]"},
+};
+
+constexpr bool IsSortedByPdg(){
+	for(size_t i=1; i<std::size(pdg_names); ++i){
+		if(pdg_names[i-1].pdg>=pdg_names[i].pdg) return false;
+	}
+	return true;
 }
+static_assert(IsSortedByPdg(), "pdg_names must be sorted by pdg code, without duplicates");
+
+} // end anonymous namespace
 
+const char* LookupPdgName(int code){
+	const pdg_name* end = std::end(pdg_names);
+	const pdg_name* it = std::lower_bound(std::begin(pdg_names), end, code,
+	                                      [](const pdg_name& entry, int pdg){ return entry.pdg<pdg; });
+	if(it==end || it->pdg!=code) return nullptr;
+	return it->name;
+}
@@ -1,18 +1,17 @@
 #ifndef ADDNOISE_HH
 #define ADDNOISE_HH
 
-#include "Tool.h"
-
-#include "TChain.h"
+#include <memory>
+#include <random>
 
+#include "Tool.h"
 
-class TChain;
-class TQReal;
+class NoisePool;
 
 class AddNoise : public Tool
 {
     public:
-        AddNoise(): noiseChain("data")
+        AddNoise()
         { name = "AddNoise"; }
         
         bool Initialise(std::string configfile, DataModel &data);
@@ -21,26 +20,23 @@ class AddNoise : public Tool
         
     private:
         std::string name;
-        void GetNewEntry();
-        void SetNoiseHitCluster();
-        
-        TChain noiseChain;
+        // start the next pass over the noise windows; false once they are used up
+        bool NextPass();
         
-        TQReal* tqi;
+        // decoded noise windows, shared with other AddNoise Tools reading the same noise
+        std::shared_ptr<NoisePool> noisePool;
         
-        float noiseEventLength;
         float noiseStartTime, noiseEndTime, noiseTimeWindowWidth;
         
-        int iEntry, nEntries;
-        int iPart, nParts;
+        bool randomOrder = false;       // use the windows in a random order, rather than as read
+        int windowReuse = 1;            // times each window may be used; 0 for no limit
+        std::mt19937 rng;
         
-        unsigned int iHit, nHits;
-        float noiseT0;
-        std::vector<float> t;
-        std::vector<float> q;
-        std::vector<int>   i;
+        int iPass = 0;
+        std::size_t iWindow = 0;
+        std::vector<std::size_t> windowOrder;
         
-        PMTHitCluster noiseEventHits;
+        std::vector<PMTHit> noiseHits;  // hits of the current window, reused between events
 };
 
 #endif
@@ -0,0 +1,75 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "BuildTriggerIndex.h"
+#include "TriggerIndex.h"
+
+BuildTriggerIndex::BuildTriggerIndex():Tool(){}
+
+bool BuildTriggerIndex::Initialise(std::string configfile, DataModel &data){
+	
+	if(configfile!="")  m_variables.Initialise(configfile);
+	//m_variables.Print();
+	
+	m_data= &data;
+	m_log= m_data->Log;
+	
+	if(!m_variables.Get("verbosity",m_verbose)) m_verbose=1;
+	
+	std::string inputFile="";
+	std::string FileListName="";
+	m_variables.Get("inputFile",inputFile);
+	m_variables.Get("FileListName",FileListName);
+	m_variables.Get("treeName",treeName);
+	m_variables.Get("indexDir",indexDir);
+	m_variables.Get("overwrite",overwrite);
+	
+	// input files as for TreeReader
+	if(inputFile!=""){
+		list_of_files.emplace_back(inputFile);
+	} else if(FileListName=="" || !m_data->CStore.Get(FileListName, list_of_files)){
+		Log(m_unique_name+" error! no inputFile given and could not find file list '"+FileListName
+		    +"' in CStore! Ensure LoadFileList tool is run before this tool!",v_error,m_verbose);
+		m_data->vars.Set("StopLoop",1);
+		return false;
+	}
+	
+	return true;
+}
+
+
+bool BuildTriggerIndex::Execute(){
+	
+	// a single pass over the HEADER branch of each file does it all
+	for(const std::string& input_file : list_of_files){
+		std::string index_file = TriggerIndex::IndexPath(input_file, indexDir);
+		TriggerIndex file_index;
+		
+		if(!overwrite && file_index.Read(index_file, input_file)){
+			Log(m_unique_name+" index "+index_file+" is up to date",v_debug,m_verbose);
+			++nskipped;
+			continue;
+		}
+		
+		Log(m_unique_name+" indexing "+input_file,v_message,m_verbose);
+		if(!file_index.Build(input_file, treeName) || !file_index.Write(index_file)){
+			Log(m_unique_name+" error! failed to build trigger index "+index_file+" for "+input_file,
+			    v_error,m_verbose);
+			++nfailed;
+			continue;
+		}
+		Log(m_unique_name+" wrote "+toString(file_index.size())+" entries to "+index_file,v_debug,m_verbose);
+		++nbuilt;
+	}
+	
+	m_data->vars.Set("StopLoop",1);
+	
+	return true;
+}
+
+
+bool BuildTriggerIndex::Finalise(){
+	
+	Log(m_unique_name+" built "+toString(nbuilt)+" trigger indices, "+toString(nskipped)
+	    +" already up to date, "+toString(nfailed)+" failed",v_message,m_verbose);
+	
+	return true;
+}
@@ -0,0 +1,39 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef BuildTriggerIndex_H
+#define BuildTriggerIndex_H
+
+#include <string>
+#include <iostream>
+#include <vector>
+
+#include "Tool.h"
+
+/**
+* \class BuildTriggerIndex
+*
+* Writes a TriggerIndex sidecar file for each input SK ROOT file, for use by TreeReader (useTriggerIndex).
+*/
+
+class BuildTriggerIndex: public Tool {
+	
+	public:
+	
+	BuildTriggerIndex();
+	bool Initialise(std::string configfile,DataModel &data);
+	bool Execute();
+	bool Finalise();
+	
+	private:
+	std::vector<std::string> list_of_files;
+	std::string treeName="data";
+	std::string indexDir="";      // where to write the indices; alongside the input files if empty
+	bool overwrite=false;         // rebuild indices even if they are up to date
+	
+	int nbuilt=0;
+	int nskipped=0;
+	int nfailed=0;
+	
+};
+
+
+#endif
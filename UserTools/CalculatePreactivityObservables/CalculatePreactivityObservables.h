@@ -6,13 +6,7 @@
 
 #include "Tool.h"
 #include "MTreeReader.h"
-
-struct Hit {
-  double time = 0;
-  double goodness = 0;
-  double charge = 0;
-  Hit(const double& t, const double& g, const double& q) : time{t}, goodness{g}, charge{q} {}
-};
+#include "PreactivityKernel.h"
 
 class CalculatePreactivityObservables: public Tool {
 
@@ -25,14 +19,11 @@ class CalculatePreactivityObservables: public Tool {
 
  private:
 
-  double dark_threshold = 4;
-  double fraction = 0.4;
+  PreactivityKernel kernel;   // holds the dark_threshold and fraction of the goodness cut
   ConnectionTable* connection_table = nullptr;
   MTreeReader* LOWE_tree_reader;
 
   void GetTreeReader();
-  double TimeOfFlight(const float*, const float*) const;
-  bool CalculateGoodness(const double&, const double&) const;
   
 };
 
@@ -8,6 +8,7 @@
 #include <numeric>
 #include <functional>
 #include <algorithm>
+#include <cmath>
 
 #include "TFile.h"
 #include "TTree.h"
@@ -25,6 +26,7 @@
 #include "TMethodCall.h"
 #include "TClassEdit.h"
 #include "TClonesArray.h"
+#include "TVirtualCollectionProxy.h"
 
 CompareRootFiles::CompareRootFiles():Tool(){}
 
@@ -305,6 +307,22 @@ bool CompareRootFiles::Initialise(std::string configfile, DataModel &data){
 				return false;
 			}
 		//}   // loop over shared trees
+		
+		// if the index is a simple number we can read it directly rather than via the interpreter
+		CompileIndex();
+	}
+	
+	// resolve the layout of each branch once, so that entries can be compared
+	// without walking the member tree or going through the interpreter
+	CompileComparisonPlans();
+	
+	// start worker threads for comparing trees in parallel.
+	// The main thread also takes a share of the work.
+	if(nthreads>1){
+		ROOT::EnableThreadSafety();
+		for(int i=1; i<nthreads; ++i){
+			workers.emplace_back(&CompareRootFiles::ComparisonWorker, this, i);
+		}
 	}
 	
 	return true;
@@ -818,12 +836,13 @@ bool CompareRootFiles::Execute(){
 	Log(m_unique_name+" doing comparison "+toString(entry_number),v_debug,m_verbose);
 	bool all_equal=true;
 	
+	// first get the next entries from all trees. Trees may share a TFile, so reading is serial.
+	std::vector<std::string> trees_to_compare;
+	std::vector<std::string> entry_strings;
 	for(auto&& apair : common_trees){
 		// skip this shared tree if we already hit the end of it.
 		if(!active_trees.at(apair.first)) continue;
 		
-		shared_tree& atree = apair.second;
-		
 		// find the next entry to compare from each TTree
 		Log(m_unique_name+" Looking for next entry with matching indices "+index_name,v_debug,m_verbose);
 		get_ok = GetNextMatchingEntries(apair);
@@ -831,35 +850,62 @@ bool CompareRootFiles::Execute(){
 		if(!get_ok) active_trees.at(apair.first) = false;
 		more_entries |= get_ok;
 		
-		entry_number_1 = entry_numbers_1.at(apair.first);
-		entry_number_2 = entry_numbers_2.at(apair.first);
-		entry_string = toString(entry_number_1)+"/"+toString(entry_number_2);
-		
 		if(get_ok){
-			Log(m_unique_name+": comparing tree " + atree.file1_tree->GetName() + " entry "+toString(entry_number_1)
-			    + " in file " + atree.file1_tree->GetCurrentFile()->GetName() + " with entry "
-			    + toString(entry_number_2)+" in file "+atree.file2_tree->GetCurrentFile()->GetName(),
-			    v_debug,m_verbose);
-			
-			// compare branches in this TTree entry
-			auto file1_it = atree.file1_branches.begin();
-			bool all_branches_equal=true;
-			while(file1_it!=atree.file1_branches.end()){
-				Log(m_unique_name+": comparing branch "+file1_it->first,v_debug,m_verbose);
-				branch_structure& file1_branch = file1_it->second;
-				branch_structure& file2_branch = atree.file2_branches.at(file1_it->first);
-				all_branches_equal &= CompareBranchMembers(file1_branch.held_data, file2_branch.held_data);
-				++file1_it;
-			}
-			all_equal &= all_branches_equal;
-			if(all_branches_equal) Log(m_unique_name+": Entry "+toString(entry_number_1)+" in file "+
-					      atree.file1_tree->GetCurrentFile()->GetName()+" Tree "+atree.file1_tree->GetName()+
-					      " is identical to entry "+toString(entry_number_2)+" in file "+
-					      atree.file2_tree->GetCurrentFile()->GetName(),
-					      v_warning,m_verbose);
-			
+			trees_to_compare.push_back(apair.first);
+			entry_strings.push_back(toString(entry_numbers_1.at(apair.first))+"/"
+			                        +toString(entry_numbers_2.at(apair.first)));
 		} // no more entries in this TTree
 	}
+	
+	// compare the branches with compiled plans, spreading the trees over our threads
+	jobs.assign(trees_to_compare.size(), comparison_job{});
+	for(size_t i=0; i<trees_to_compare.size(); ++i){
+		jobs.at(i).plans = &tree_plans.at(trees_to_compare.at(i));
+	}
+	if(workers.size() && jobs.size()>1){
+		{
+			std::unique_lock<std::mutex> lock(jobs_mtx);
+			workers_finished=0;
+			++jobs_generation;
+		}
+		jobs_ready.notify_all();
+		RunComparisonJobs(0, workers.size()+1);
+		std::unique_lock<std::mutex> lock(jobs_mtx);
+		jobs_done.wait(lock, [this]{ return workers_finished==workers.size(); });
+	} else {
+		RunComparisonJobs(0, 1);
+	}
+	
+	// report the results, and compare any remaining branches with the interpreter
+	for(size_t i=0; i<trees_to_compare.size(); ++i){
+		shared_tree& atree = common_trees.at(trees_to_compare.at(i));
+		entry_number_1 = entry_numbers_1.at(trees_to_compare.at(i));
+		entry_number_2 = entry_numbers_2.at(trees_to_compare.at(i));
+		entry_string = entry_strings.at(i);
+		
+		Log(m_unique_name+": comparing tree " + atree.file1_tree->GetName() + " entry "+toString(entry_number_1)
+		    + " in file " + atree.file1_tree->GetCurrentFile()->GetName() + " with entry "
+		    + toString(entry_number_2)+" in file "+atree.file2_tree->GetCurrentFile()->GetName(),
+		    v_debug,m_verbose);
+		
+		bool all_branches_equal = jobs.at(i).all_equal;
+		for(std::string& amismatch : jobs.at(i).report){
+			Log(m_unique_name+" Mismatch! Entry "+entry_string+" "+amismatch,v_error,m_verbose);
+		}
+		
+		for(std::string& abranch : legacy_branches.at(trees_to_compare.at(i))){
+			Log(m_unique_name+": comparing branch "+abranch,v_debug,m_verbose);
+			branch_structure& file1_branch = atree.file1_branches.at(abranch);
+			branch_structure& file2_branch = atree.file2_branches.at(abranch);
+			all_branches_equal &= CompareBranchMembers(file1_branch.held_data, file2_branch.held_data);
+		}
+		all_equal &= all_branches_equal;
+		if(all_branches_equal) Log(m_unique_name+": Entry "+toString(entry_number_1)+" in file "+
+				      atree.file1_tree->GetCurrentFile()->GetName()+" Tree "+atree.file1_tree->GetName()+
+				      " is identical to entry "+toString(entry_number_2)+" in file "+
+				      atree.file2_tree->GetCurrentFile()->GetName(),
+				      v_warning,m_verbose);
+	}
 	Log(m_unique_name+": "+toString(entry_number)+" entries compared so far",v_debug,m_verbose);
 	if(all_equal){
 		Log(m_unique_name+": Comparison "+toString(++matching_entries)+" found matching entries so far",
@@ -883,6 +929,127 @@ bool CompareRootFiles::Execute(){
 	return true;
 }
 
+void CompareRootFiles::RunComparisonJobs(size_t first, size_t step){
+	// compare the jobs first, first+step, first+2*step...
+	// Nothing here may use the interpreter or Log, as it may be run from a worker thread.
+	for(size_t i=first; i<jobs.size(); i+=step){
+		comparison_job& ajob = jobs.at(i);
+		for(const ComparisonPlan& aplan : *ajob.plans){
+			ajob.all_equal &= aplan.Compare(&ajob.report);
+		}
+	}
+}
+
+void CompareRootFiles::ComparisonWorker(size_t worker_i){
+	unsigned long last_generation=0;
+	while(true){
+		{
+			std::unique_lock<std::mutex> lock(jobs_mtx);
+			jobs_ready.wait(lock, [&]{ return stop_workers || jobs_generation!=last_generation; });
+			if(stop_workers) return;
+			last_generation = jobs_generation;
+		}
+		RunComparisonJobs(worker_i, workers.size()+1);
+		{
+			std::unique_lock<std::mutex> lock(jobs_mtx);
+			++workers_finished;
+		}
+		jobs_done.notify_one();
+	}
+}
+
+void CompareRootFiles::CompileComparisonPlans(){
+	for(auto&& apair : common_trees){
+		shared_tree& atree = apair.second;
+		std::vector<ComparisonPlan>& plans = tree_plans[apair.first];
+		std::vector<std::string>& legacy = legacy_branches[apair.first];
+		for(auto&& abranch : atree.file1_branches){
+			data_instance& data1 = abranch.second.held_data;
+			data_instance& data2 = atree.file2_branches.at(abranch.first).held_data;
+			if(not compiled_comparison || data1.instance_type<0 || data1.instance_type!=data2.instance_type){
+				legacy.push_back(abranch.first);
+				continue;
+			}
+			
+			ComparisonPlan aplan(data1.name, ftolerance);
+			// top level arrays of primitives have their dimensions parsed from the branch title,
+			// everything else is described by its type
+			std::vector<int> static_dims;
+			if(data1.instance_type==1 || data1.instance_type==2) static_dims = data1.static_dims;
+			if(data1.static_dims!=data2.static_dims){
+				Log(m_unique_name+" Warning! Different static dimensions of item "+data1.name
+				    +", comparison will not be compiled",v_warning,m_verbose);
+				legacy.push_back(abranch.first);
+				continue;
+			}
+			aplan.AddType("", data1.type_as_string, 0, static_dims);
+			if(data1.instance_type==2){
+				aplan.SetDynamicDimension(data1.dimension_ptr, data2.dimension_ptr);
+			}
+			aplan.SetAddresses(data1.address, data2.address);
+			aplan.Finalise();
+			
+			if(aplan.IsCompiled()){
+				Log(m_unique_name+" compiled comparison plan for branch "+aplan.Describe(),v_debug,m_verbose);
+				plans.push_back(aplan);
+			} else {
+				Log(m_unique_name+" unable to compile comparison of branch "+data1.name+" ("+aplan.GetError()
+				    +"), it will be compared via the interpreter",v_warning,m_verbose);
+				legacy.push_back(abranch.first);
+			}
+		}
+		Log(m_unique_name+" tree "+apair.first+" has "+toString(plans.size())+" compiled and "
+		    +toString(legacy.size())+" interpreted branch comparisons",v_message,m_verbose);
+	}
+}
+
+bool CompareRootFiles::CompileIndex(){
+	// a primitive index that is not within a container has a fixed address
+	// so can be read directly.
+	if(file1_index->instance_type!=0 || file1_index->is_ptr || file2_index->is_ptr ||
+	   file1_index->name.find(".at(*)")!=std::string::npos ||
+	   file1_index->name.find(".At(*)")!=std::string::npos){
+		return false;
+	}
+	TDataType index_type(CppName(file1_index->type_as_string));
+	switch(index_type.GetType()){
+		case kChar_t: case kUChar_t: case kShort_t: case kUShort_t: case kInt_t: case kUInt_t:
+		case kLong_t: case kULong_t: case kLong64_t: case kULong64_t:
+		case kFloat_t: case kDouble_t: case kDouble32_t: case kFloat16_t:
+			index_datatype = (EDataType)index_type.GetType();
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool CompareRootFiles::CompareIndices(int* less){
+	// returns whether the indices are equal, and if not, whether index 1 < index 2
+	if(index_datatype==kNoType_t) return CompareBranchMembers(*file1_index, *file2_index, less);
+	
+	auto getval = [this](void* add){
+		switch(index_datatype){
+			case kChar_t: return (double)*(char*)add;
+			case kUChar_t: return (double)*(unsigned char*)add;
+			case kShort_t: return (double)*(short*)add;
+			case kUShort_t: return (double)*(unsigned short*)add;
+			case kInt_t: return (double)*(int*)add;
+			case kUInt_t: return (double)*(unsigned int*)add;
+			case kLong_t: return (double)*(long*)add;
+			case kULong_t: return (double)*(unsigned long*)add;
+			case kLong64_t: return (double)*(long long*)add;
+			case kULong64_t: return (double)*(unsigned long long*)add;
+			case kFloat_t: case kFloat16_t: return (double)*(float*)add;
+			default: return *(double*)add;
+		}
+	};
+	double index_1 = getval(file1_index->address);
+	double index_2 = getval(file2_index->address);
+	if(std::fabs(index_1-index_2) < ftolerance) return true;
+	if(less!=nullptr) *less = (index_1<index_2) ? 1 : 0;
+	return false;
+}
+
 
 bool CompareRootFiles::CompareBranchMembers(data_instance &branch1, data_instance &branch2, int* less){
 	// if we've not yet found the index branches, check if this is them, and note the instances if so.
@@ -1561,6 +1728,15 @@ TMethodCall* CompareRootFiles::GetAtCaller(data_instance& thedata){
 
 bool CompareRootFiles::Finalise(){
 	
+	// stop any worker threads
+	{
+		std::unique_lock<std::mutex> lock(jobs_mtx);
+		stop_workers=true;
+	}
+	jobs_ready.notify_all();
+	for(std::thread& aworker : workers) aworker.join();
+	workers.clear();
+	
 	return true;
 }
 
@@ -1634,6 +1810,8 @@ bool CompareRootFiles::LoadConfig(std::string configfile){
 		else if(thekey=="max_entries") max_entries = stoi(thevalue);
 		else if(thekey=="ftolerance") ftolerance = stof(thevalue);
 		else if(thekey=="index_name") index_name = thevalue;
+		else if(thekey=="compiled_comparison") compiled_comparison = stoi(thevalue);
+		else if(thekey=="nthreads") nthreads = stoi(thevalue);
 		else {
 			Log(m_unique_name+" unrecognised option in config file line: \""+LineCopy,v_error,m_verbose);
 		}
@@ -2045,7 +2223,7 @@ bool CompareRootFiles::GetNextMatchingEntries(std::pair<const std::string, share
 			
 			// compare the indexes to see if these represent a comparable event
 			int less = -1;
-			get_ok = CompareBranchMembers(*file1_index, *file2_index, &less);
+			get_ok = CompareIndices(&less);
 			Log(m_unique_name+" Index variable comparison returned "+toString(get_ok)
 			    +", with less value "+toString(less),v_debug,m_verbose);
 			
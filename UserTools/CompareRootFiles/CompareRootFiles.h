@@ -5,10 +5,14 @@
 #include <string>
 #include <iostream>
 #include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "Tool.h"
 #include "MTreeReader.h"
 #include "SkrootHeaders.h" // MCInfo, Header etc.
+#include "ComparisonPlan.h"
 
 /**
 * \class CompareRootFiles
@@ -70,6 +74,13 @@ struct shared_tree {
 	std::map<std::string, branch_structure> file2_branches;
 };
 
+// the compiled comparison of one entry of one shared tree, which may be run on a worker thread
+struct comparison_job {
+	const std::vector<ComparisonPlan>* plans=nullptr;
+	bool all_equal=true;
+	std::vector<std::string> report;
+};
+
 class CompareRootFiles: public Tool {
 	
 	public:
@@ -102,6 +113,13 @@ class CompareRootFiles: public Tool {
 	const char* CppName(std::string type);
 	bool GetNextMatchingEntries(std::pair<const std::string, shared_tree>& apair);
 	
+	// compiled comparison plans
+	void CompileComparisonPlans();
+	bool CompileIndex();
+	bool CompareIndices(int* less);
+	void RunComparisonJobs(size_t first, size_t step);
+	void ComparisonWorker(size_t worker_i);
+	
 	// methods for building dictionaries on the fly
 	bool LoadDictionary(data_instance& thedata);
 	bool GetListOfHeaders(data_instance &thedata, std::vector<std::pair<std::string,std::string>> &headerlist);
@@ -138,6 +156,23 @@ class CompareRootFiles: public Tool {
 	int mismatching_entries = 0;
 	std::string entry_string;
 	
+	// compiled comparisons
+	bool compiled_comparison=true;
+	std::map<std::string, std::vector<ComparisonPlan>> tree_plans; // branches compared via compiled plans
+	std::map<std::string, std::vector<std::string>> legacy_branches; // branches needing the interpreter
+	EDataType index_datatype=kNoType_t; // set if the index can be read directly
+	
+	// worker threads for comparing trees concurrently
+	int nthreads=1;
+	std::vector<std::thread> workers;
+	std::vector<comparison_job> jobs;
+	std::mutex jobs_mtx;
+	std::condition_variable jobs_ready;
+	std::condition_variable jobs_done;
+	unsigned long jobs_generation=0;
+	size_t workers_finished=0;
+	bool stop_workers=false;
+	
 	std::stringstream smessage;
 	
 	
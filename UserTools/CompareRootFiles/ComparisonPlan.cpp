@@ -0,0 +1,585 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "ComparisonPlan.h"
+
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <functional>
+#include <sstream>
+
+#include "TClass.h"
+#include "TClassEdit.h"
+#include "TDataMember.h"
+#include "TBaseClass.h"
+#include "TList.h"
+#include "TString.h"
+#include "TVirtualCollectionProxy.h"
+
+namespace {
+	// deepest nesting of classes / pointers we will follow before giving up
+	constexpr int max_plan_depth = 16;
+
+	// un-ROOTish typenames so TDataType can recognise them, as CompareRootFiles::CppName
+	std::string BasicTypeName(std::string type){
+		if(type=="Char_t") return "char";
+		if(type=="Short_t") return "short";
+		if(type=="Int_t") return "int";
+		if(type=="Long_t") return "long";
+		if(type=="Float_t" || type=="Float16_t") return "float";
+		if(type=="Double_t" || type=="Double32_t") return "double";
+		if(type=="UChar_t") return "unsigned char";
+		if(type=="UShort_t") return "unsigned short";
+		if(type=="UInt_t") return "unsigned int";
+		if(type=="ULong_t") return "unsigned long";
+		if(type=="Long64_t") return "long long";
+		if(type=="ULong64_t") return "unsigned long long";
+		if(type=="Bool_t") return "bool";
+		return type;
+	}
+
+	std::string IndexString(long i, const std::vector<int>& dims){
+		// convert a flat index back to multidimensional array format for printing
+		if(dims.size()<2) return "["+std::to_string(i)+"]";
+		std::string dimstring="";
+		long remdr = i;
+		for(size_t j=1; j<dims.size()+1; ++j){
+			long nextdimsize = std::accumulate(dims.begin()+j, dims.end(), 1l, std::multiplies<long>());
+			dimstring.append(std::string("[")+std::to_string(remdr/nextdimsize)+"]");
+			remdr = (remdr % nextdimsize);
+		}
+		return dimstring;
+	}
+
+	template<typename T>
+	std::string ValueString(const char* add){
+		T val;
+		memcpy(&val, add, sizeof(T));
+		std::stringstream ss;
+		ss << +val;  // promote chars so they print as numbers
+		return ss.str();
+	}
+
+	std::string ValueToString(EDataType type, const char* add){
+		switch(type){
+			case kChar_t: case kchar: return ValueString<char>(add);
+			case kUChar_t: return ValueString<unsigned char>(add);
+			case kShort_t: return ValueString<short>(add);
+			case kUShort_t: return ValueString<unsigned short>(add);
+			case kInt_t: return ValueString<int>(add);
+			case kUInt_t: case kBits: return ValueString<unsigned int>(add);
+			case kLong_t: return ValueString<long>(add);
+			case kULong_t: return ValueString<unsigned long>(add);
+			case kLong64_t: return ValueString<long long>(add);
+			case kULong64_t: return ValueString<unsigned long long>(add);
+			case kFloat_t: case kFloat16_t: return ValueString<float>(add);
+			case kDouble_t: case kDouble32_t: return ValueString<double>(add);
+			case kBool_t: return ValueString<bool>(add);
+			default: return "?";
+		}
+	}
+
+	// element-wise comparison within an absolute tolerance.
+	// written as a branchless reduction so the compiler can vectorise it.
+	template<typename T>
+	bool WithinTolerance(const char* add_1, const char* add_2, long count, float tolerance){
+		const T* a = reinterpret_cast<const T*>(add_1);
+		const T* b = reinterpret_cast<const T*>(add_2);
+		bool all_ok = true;
+		for(long i=0; i<count; ++i){
+			all_ok &= (std::fabs(a[i]-b[i]) < tolerance);
+		}
+		return all_ok;
+	}
+
+	template<typename T>
+	bool ElementWithinTolerance(const char* add_1, const char* add_2, float tolerance){
+		T a, b;
+		memcpy(&a, add_1, sizeof(T));
+		memcpy(&b, add_2, sizeof(T));
+		return std::fabs(a-b) < tolerance;
+	}
+
+	bool IsFloating(EDataType type){
+		return (type==kFloat_t || type==kFloat16_t || type==kDouble_t || type==kDouble32_t);
+	}
+}
+
+ComparisonPlan::ComparisonPlan(std::string branchname, float tolerance) :
+	branch_name(branchname), ftolerance(tolerance){}
+
+// ===================================================== //
+//                      Compilation                      //
+// ===================================================== //
+
+bool ComparisonPlan::AddType(std::string name, std::string type_as_string, long offset, std::vector<int> dims){
+	compiled = CompileType(name, type_as_string, offset, dims, steps, 0);
+	if(not compiled) steps.clear();
+	return compiled;
+}
+
+void ComparisonPlan::SetAddresses(void* add_1, void* add_2){
+	address_1 = add_1;
+	address_2 = add_2;
+	if(address_1==nullptr || address_2==nullptr){
+		compiled=false;
+		error = "null branch address";
+	}
+}
+
+void ComparisonPlan::SetDynamicDimension(const int* dim_ptr_1, const int* dim_ptr_2){
+	dimension_ptr_1 = dim_ptr_1;
+	dimension_ptr_2 = dim_ptr_2;
+	for(plan_step& step : steps) step.dynamic = true;
+	if(dimension_ptr_1==nullptr || dimension_ptr_2==nullptr){
+		compiled=false;
+		error = "null pointer to dynamic array dimension";
+	}
+}
+
+void ComparisonPlan::Finalise(){
+	Coalesce(steps);
+}
+
+bool ComparisonPlan::CompileType(std::string name, std::string type_as_string, long offset,
+	                             std::vector<int> dims, std::vector<plan_step>& plan, int depth){
+
+	if(depth>max_plan_depth){
+		error = "nesting too deep at "+name;
+		return false;
+	}
+	long count = std::accumulate(dims.begin(), dims.end(), 1l, std::multiplies<long>());
+	if(count<=0){
+		error = "zero-sized array "+name;
+		return false;
+	}
+
+	// note that TClass::GetClass won't work if we give it a pointer, so strip those
+	std::string strippedtype = TClassEdit::ShortType(type_as_string.c_str(),1);
+	TClass* cl = TClass::GetClass(strippedtype.c_str());
+
+	if(cl==nullptr){
+		// should be a primitive type
+		TDataType basic_type(BasicTypeName(strippedtype).c_str());
+		if(basic_type.GetType()<=0 || basic_type.GetType()==kCharStar || basic_type.GetType()==kVoid_t){
+			error = "unknown or unsupported type '"+type_as_string+"' for "+name;
+			return false;
+		}
+		plan_step step;
+		step.kind = plan_kind::primitive;
+		step.name = name;
+		step.offset = offset;
+		step.datatype = (EDataType)basic_type.GetType();
+		step.item_size = basic_type.Size();
+		step.count = count;
+		step.dims = dims;
+		plan.push_back(step);
+		return true;
+	}
+
+	if(strippedtype=="string" || strippedtype=="std::string" || strippedtype=="TString"){
+		// compared with ==, but arrays of them are laid out like any other array
+		plan_step step;
+		step.kind = (strippedtype=="TString") ? plan_kind::tstring : plan_kind::string;
+		step.name = name;
+		step.offset = offset;
+		step.item_size = cl->Size();
+		step.count = count;
+		step.dims = dims;
+		plan.push_back(step);
+		return true;
+	}
+
+	// statically sized arrays of classes or containers: one sub-plan, repeated with a stride
+	if(count>1){
+		plan_step step;
+		step.kind = plan_kind::repeat;
+		step.name = name;
+		step.offset = offset;
+		step.item_size = cl->Size();
+		step.stride = cl->Size();
+		step.count = count;
+		step.dims = dims;
+		if(not CompileType("", type_as_string, 0, {}, step.element_plan, depth+1)) return false;
+		Coalesce(step.element_plan);
+		plan.push_back(step);
+		return true;
+	}
+
+	if(cl->GetCollectionProxy()!=nullptr){
+		return CompileCollection(cl, name, offset, plan, depth);
+	}
+
+	return CompileClass(cl, name, offset, plan, depth);
+}
+
+bool ComparisonPlan::CompileCollection(TClass* cl, std::string name, long offset,
+	                                   std::vector<plan_step>& plan, int depth){
+
+	TVirtualCollectionProxy* proxy = cl->GetCollectionProxy();
+	if(proxy->HasPointers()){
+		error = "collection of pointers "+name+" ("+cl->GetName()+")";
+		return false;
+	}
+
+	plan_step step;
+	step.kind = plan_kind::collection;
+	step.name = name;
+	step.offset = offset;
+	step.stride = proxy->GetIncrement();
+	// each file gets its own proxy, so that the pair (and the plans for other trees)
+	// can be used independently of one another
+	step.proxy_1 = std::shared_ptr<TVirtualCollectionProxy>(proxy->Generate());
+	step.proxy_2 = std::shared_ptr<TVirtualCollectionProxy>(proxy->Generate());
+
+	// vector<bool> proxies return pointers to temporaries, so aren't contiguous
+	EDataType element_type = proxy->GetType();
+	step.contiguous = (proxy->GetCollectionType()==ROOT::kSTLvector && element_type!=kBool_t);
+
+	if(proxy->GetValueClass()!=nullptr){
+		if(not CompileType("", proxy->GetValueClass()->GetName(), 0, {}, step.element_plan, depth+1)){
+			return false;
+		}
+	} else if(element_type>0 && element_type!=kCharStar && element_type!=kVoid_t){
+		plan_step element;
+		element.kind = plan_kind::primitive;
+		element.datatype = element_type;
+		element.item_size = TDataType(element_type).Size();
+		step.element_plan.push_back(element);
+	} else {
+		error = "collection "+name+" of unknown element type ("+cl->GetName()+")";
+		return false;
+	}
+	Coalesce(step.element_plan);
+	plan.push_back(step);
+	return true;
+}
+
+bool ComparisonPlan::CompileClass(TClass* cl, std::string name, long offset,
+	                              std::vector<plan_step>& plan, int depth){
+
+	// without a dictionary the data members (and their offsets) are not reliable
+	std::string classname = cl->GetName();
+	if(cl->GetState()<TClass::kInterpreted){
+		error = "no dictionary for class "+classname+" of "+name;
+		return false;
+	}
+	// the element types of ROOT collections vary per-instance
+	if(classname=="TClonesArray" || classname=="TObjArray" || cl->InheritsFrom("TCollection")){
+		error = "ROOT collection "+classname+" of "+name;
+		return false;
+	}
+
+	// base classes first, placed at their offset within the derived class
+	TIter nextbase(cl->GetListOfBases());
+	while(TBaseClass* base = (TBaseClass*)nextbase()){
+		TClass* basecl = base->GetClassPointer();
+		Long_t baseoffset = base->GetDelta();
+		if(basecl==nullptr || baseoffset<0){
+			error = "unable to locate base class "+std::string(base->GetName())+" of "+classname;
+			return false;
+		}
+		if(not CompileClass(basecl, name, offset+baseoffset, plan, depth+1)) return false;
+	}
+
+	TIter nextmember(cl->GetListOfDataMembers());
+	while(TDataMember* member = (TDataMember*)nextmember()){
+		// skip static members and anything not streamed to file
+		if(member->Property() & kIsStatic) continue;
+		if(not member->IsPersistent()) continue;
+		// it seems as though the following are part of ROOT's internal streamer functionality,
+		// and are very unlikely to be anything we care about being different
+		if(strcmp(member->GetName(),"fBits")==0 || strcmp(member->GetName(),"fUniqueID")==0) continue;
+
+		std::string membername = name+"."+member->GetName();
+		long memberoffset = offset + member->GetOffset();
+		std::vector<int> dims;
+		for(int dim_i=0; dim_i<member->GetArrayDim(); ++dim_i){
+			dims.push_back(member->GetMaxIndex(dim_i));
+		}
+
+		if(member->IsaPointer()){
+			if(member->IsBasic() || member->GetArrayDim()>0){
+				// variable length arrays of basic types (//[n]), char*, and arrays of pointers
+				error = "pointer member "+membername+" of type "+member->GetFullTypeName();
+				return false;
+			}
+			plan_step step;
+			step.kind = plan_kind::pointer;
+			step.name = membername;
+			step.offset = memberoffset;
+			if(not CompileType("", member->GetTypeName(), 0, {}, step.element_plan, depth+1)) return false;
+			Coalesce(step.element_plan);
+			plan.push_back(step);
+			continue;
+		}
+
+		std::string membertype = member->GetTypeName();
+		if(member->IsEnum()) membertype = "int";
+		if(not CompileType(membername, membertype, memberoffset, dims, plan, depth+1)) return false;
+	}
+
+	return true;
+}
+
+void ComparisonPlan::Coalesce(std::vector<plan_step>& plan) const {
+	// merge adjacent primitive steps that occupy a contiguous block of memory into runs
+	// that can be checked with a single memcmp. The original steps are kept for reporting.
+	std::vector<plan_step> merged;
+	for(plan_step& step : plan){
+		bool mergeable = (step.kind==plan_kind::primitive && not step.dynamic);
+		if(mergeable && not merged.empty()){
+			plan_step& last = merged.back();
+			bool last_mergeable = (last.kind==plan_kind::run) ||
+			                      (last.kind==plan_kind::primitive && not last.dynamic);
+			long last_end = last.offset + last.count*last.item_size;
+			if(last_mergeable && step.offset==last_end){
+				if(last.kind==plan_kind::primitive){
+					plan_step run;
+					run.kind = plan_kind::run;
+					run.name = last.name;
+					run.offset = last.offset;
+					run.item_size = 1;
+					run.count = last.count*last.item_size;
+					run.element_plan.push_back(last);
+					last = run;
+				}
+				last.count += step.count*step.item_size;
+				last.element_plan.push_back(step);
+				continue;
+			}
+		}
+		merged.push_back(step);
+	}
+	plan.swap(merged);
+}
+
+std::string ComparisonPlan::Describe() const {
+	std::string out = branch_name+(compiled ? "" : " (not compiled: "+error+")")+"\n";
+	DescribeSteps(steps, "\t", out);
+	return out;
+}
+
+void ComparisonPlan::DescribeSteps(const std::vector<plan_step>& plan, std::string indent, std::string& out) const {
+	for(const plan_step& step : plan){
+		out += indent+"+"+std::to_string(step.offset)+" ";
+		switch(step.kind){
+			case plan_kind::primitive: out += std::string(TDataType::GetTypeName(step.datatype))
+			                                  +" x"+std::to_string(step.count); break;
+			case plan_kind::run: out += "run of "+std::to_string(step.count)+" bytes"; break;
+			case plan_kind::string: out += "string x"+std::to_string(step.count); break;
+			case plan_kind::tstring: out += "TString x"+std::to_string(step.count); break;
+			case plan_kind::collection: out += std::string(step.contiguous ? "contiguous " : "")+"collection"; break;
+			case plan_kind::pointer: out += "pointer"; break;
+			case plan_kind::repeat: out += "repeated x"+std::to_string(step.count); break;
+		}
+		out += " "+step.name+(step.dynamic ? " (dynamic)" : "")+"\n";
+		if(step.kind!=plan_kind::run) DescribeSteps(step.element_plan, indent+"\t", out);
+	}
+}
+
+// ===================================================== //
+//                       Evaluation                      //
+// ===================================================== //
+
+bool ComparisonPlan::Compare(std::vector<std::string>* report) const {
+	long dynamic_count = 1;
+	if(dimension_ptr_1!=nullptr){
+		int dynamic_dim_1 = *dimension_ptr_1;
+		int dynamic_dim_2 = *dimension_ptr_2;
+		if(dynamic_dim_1<0 || dynamic_dim_2<0){
+			if(report) report->push_back("item "+branch_name+" has negative dynamic array size");
+			return false;
+		}
+		dynamic_count = std::min(dynamic_dim_1, dynamic_dim_2);
+		if(dynamic_dim_1!=dynamic_dim_2){
+			if(report) report->push_back("item "+branch_name+" dynamic array sizes differ: "
+			                             +std::to_string(dynamic_dim_1)+" != "+std::to_string(dynamic_dim_2)
+			                             +", comparing fewest ("+std::to_string(dynamic_count)+") entries");
+			CompareSteps(steps, (const char*)address_1, (const char*)address_2, dynamic_count, report, "");
+			return false;
+		}
+	}
+	return CompareSteps(steps, (const char*)address_1, (const char*)address_2, dynamic_count, report, "");
+}
+
+bool ComparisonPlan::CompareSteps(const std::vector<plan_step>& plan, const char* base_1, const char* base_2,
+	                              long dynamic_count, std::vector<std::string>* report, const std::string& context) const {
+
+	bool are_equal = true;
+	for(const plan_step& step : plan){
+		const char* add_1 = base_1 + step.offset;
+		const char* add_2 = base_2 + step.offset;
+		switch(step.kind){
+			case plan_kind::primitive:
+			case plan_kind::run: {
+				if(not step.dynamic){
+					are_equal &= CompareRun(step, add_1, add_2, step.count, report, context);
+					break;
+				}
+				// dynamic arrays: the dynamic dimension is always the first
+				long count = step.count*dynamic_count;
+				if(CompareRun(step, add_1, add_2, count, nullptr, context)) break;
+				are_equal = false;
+				if(report==nullptr) return false;
+				plan_step dynamic_step = step;
+				dynamic_step.dims.insert(dynamic_step.dims.begin(), dynamic_count);
+				CompareRun(dynamic_step, add_1, add_2, count, report, context);
+				break;
+			}
+			case plan_kind::string:
+			case plan_kind::tstring: {
+				for(long i=0; i<step.count; ++i){
+					const char* el_1 = add_1 + i*step.item_size;
+					const char* el_2 = add_2 + i*step.item_size;
+					bool is_equal;
+					std::string val_1, val_2;
+					if(step.kind==plan_kind::string){
+						const std::string& s1 = *reinterpret_cast<const std::string*>(el_1);
+						const std::string& s2 = *reinterpret_cast<const std::string*>(el_2);
+						is_equal = (s1==s2);
+						if(!is_equal && report){ val_1 = s1; val_2 = s2; }
+					} else {
+						const TString& s1 = *reinterpret_cast<const TString*>(el_1);
+						const TString& s2 = *reinterpret_cast<const TString*>(el_2);
+						is_equal = (s1==s2);
+						if(!is_equal && report){ val_1 = s1.Data(); val_2 = s2.Data(); }
+					}
+					if(not is_equal){
+						are_equal = false;
+						if(report==nullptr) return false;
+						std::string idx = (step.count>1) ? IndexString(i, step.dims) : "";
+						report->push_back("item "+branch_name+context+step.name+idx+": "+val_1+" != "+val_2);
+					}
+				}
+				break;
+			}
+			case plan_kind::pointer: {
+				const char* obj_1 = *reinterpret_cast<const char* const*>(add_1);
+				const char* obj_2 = *reinterpret_cast<const char* const*>(add_2);
+				if(obj_1==nullptr || obj_2==nullptr){
+					if(obj_1!=obj_2){
+						are_equal = false;
+						if(report) report->push_back("item "+branch_name+context+step.name+" is null in only one file");
+					}
+				} else {
+					are_equal &= CompareSteps(step.element_plan, obj_1, obj_2, 1, report, context+step.name+"->");
+				}
+				break;
+			}
+			case plan_kind::repeat: {
+				for(long i=0; i<step.count; ++i){
+					const char* el_1 = add_1 + i*step.stride;
+					const char* el_2 = add_2 + i*step.stride;
+					if(CompareSteps(step.element_plan, el_1, el_2, 1, nullptr, "")) continue;
+					are_equal = false;
+					if(report==nullptr) return false;
+					// re-run with reporting only for the mismatching element
+					std::string idx = IndexString(i, step.dims);
+					CompareSteps(step.element_plan, el_1, el_2, 1, report, context+step.name+idx);
+				}
+				break;
+			}
+			case plan_kind::collection: {
+				are_equal &= CompareCollection(step, add_1, add_2, report, context);
+				break;
+			}
+		}
+		if(!are_equal && report==nullptr) return false;
+	}
+	return are_equal;
+}
+
+bool ComparisonPlan::CompareRun(const plan_step& step, const char* add_1, const char* add_2, long count,
+	                            std::vector<std::string>* report, const std::string& context) const {
+
+	// fast path: identical bytes
+	if(memcmp(add_1, add_2, count*step.item_size)==0) return true;
+
+	if(step.kind==plan_kind::run){
+		// something in this block differs; go through the constituent members
+		bool are_equal = true;
+		for(const plan_step& part : step.element_plan){
+			const char* part_1 = add_1 + (part.offset-step.offset);
+			const char* part_2 = add_2 + (part.offset-step.offset);
+			are_equal &= CompareRun(part, part_1, part_2, part.count, report, context);
+			if(!are_equal && report==nullptr) return false;
+		}
+		return are_equal;
+	}
+
+	// floating point values may legitimately differ within tolerance.
+	// Anything else that is not bitwise identical is a mismatch.
+	if(IsFloating(step.datatype)){
+		bool within = (step.item_size==sizeof(float))
+			? WithinTolerance<float>(add_1, add_2, count, ftolerance)
+			: WithinTolerance<double>(add_1, add_2, count, ftolerance);
+		if(within) return true;
+	}
+	if(report==nullptr) return false;
+
+	// find and report the mismatching elements
+	for(long i=0; i<count; ++i){
+		const char* el_1 = add_1 + i*step.item_size;
+		const char* el_2 = add_2 + i*step.item_size;
+		bool is_equal;
+		if(IsFloating(step.datatype)){
+			is_equal = (step.item_size==sizeof(float))
+				? ElementWithinTolerance<float>(el_1, el_2, ftolerance)
+				: ElementWithinTolerance<double>(el_1, el_2, ftolerance);
+		} else {
+			is_equal = (memcmp(el_1, el_2, step.item_size)==0);
+		}
+		if(is_equal) continue;
+		std::string idx = (count>1 || step.dims.size()) ? IndexString(i, step.dims) : "";
+		report->push_back("item "+branch_name+context+step.name+idx+": "
+		                  +ValueToString(step.datatype, el_1)+" != "+ValueToString(step.datatype, el_2));
+	}
+	return false;
+}
+
+bool ComparisonPlan::CompareCollection(const plan_step& step, const char* add_1, const char* add_2,
+	                                   std::vector<std::string>* report, const std::string& context) const {
+
+	TVirtualCollectionProxy::TPushPop helper_1(step.proxy_1.get(), (void*)add_1);
+	TVirtualCollectionProxy::TPushPop helper_2(step.proxy_2.get(), (void*)add_2);
+	UInt_t size_1 = step.proxy_1->Size();
+	UInt_t size_2 = step.proxy_2->Size();
+	bool are_equal = true;
+	if(size_1!=size_2){
+		are_equal = false;
+		if(report==nullptr) return false;
+		report->push_back("item "+branch_name+context+step.name+" container sizes are different: "
+		                  +std::to_string(size_1)+" != "+std::to_string(size_2));
+	}
+	// compare as many as we have
+	UInt_t minsize = std::min(size_1, size_2);
+	if(minsize==0) return are_equal;
+
+	// a vector of primitives is one contiguous run
+	if(step.contiguous && step.element_plan.size()==1 && step.element_plan.front().count==1 &&
+	   step.element_plan.front().kind==plan_kind::primitive){
+		const char* el_1 = (const char*)step.proxy_1->At(0);
+		const char* el_2 = (const char*)step.proxy_2->At(0);
+		const plan_step& element = step.element_plan.front();
+		if(CompareRun(element, el_1, el_2, minsize, nullptr, context)) return are_equal;
+		if(report) CompareRun(element, el_1, el_2, minsize, report, context+step.name);
+		return false;
+	}
+
+	const char* first_1 = step.contiguous ? (const char*)step.proxy_1->At(0) : nullptr;
+	const char* first_2 = step.contiguous ? (const char*)step.proxy_2->At(0) : nullptr;
+	for(UInt_t i=0; i<minsize; ++i){
+		const char* el_1 = step.contiguous ? first_1 + i*step.stride : (const char*)step.proxy_1->At(i);
+		const char* el_2 = step.contiguous ? first_2 + i*step.stride : (const char*)step.proxy_2->At(i);
+		if(el_1==nullptr || el_2==nullptr){
+			if(report) report->push_back("item "+branch_name+context+step.name
+			                             +" returned nullptr for element "+std::to_string(i));
+			return false;
+		}
+		if(CompareSteps(step.element_plan, el_1, el_2, 1, nullptr, "")) continue;
+		are_equal = false;
+		if(report==nullptr) return false;
+		CompareSteps(step.element_plan, el_1, el_2, 1, report, context+step.name+".at("+std::to_string(i)+")");
+	}
+	return are_equal;
+}
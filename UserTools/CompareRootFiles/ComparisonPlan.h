@@ -0,0 +1,101 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef ComparisonPlan_H
+#define ComparisonPlan_H
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "TDataType.h"  // EDataType
+
+class TClass;
+class TVirtualCollectionProxy;
+
+/**
+* \class ComparisonPlan
+*
+* A flat, compiled description of how to compare one branch in two files.
+* The layout of the branch type is resolved once via the class dictionaries,
+* producing a list of steps of (offset, primitive type, count, tolerance).
+* Adjacent primitive members are merged into contiguous runs that are first
+* compared with a single memcmp, only falling back to an element-wise
+* (tolerance-aware) comparison when the raw bytes differ.
+* STL containers are accessed via their TVirtualCollectionProxy, with
+* std::vector contents treated as contiguous runs.
+* Types we cannot describe (TClonesArray, TObjArray, classes without a dictionary...)
+* leave the plan uncompiled, and the caller should fall back to the interpreted comparison.
+*
+* A compiled plan only touches the memory of the two branch objects (and its own
+* collection proxies), so plans for different trees may be evaluated concurrently.
+*/
+
+enum class plan_kind { primitive, run, string, tstring, collection, pointer, repeat };
+
+struct plan_step {
+	plan_kind kind=plan_kind::primitive;
+	std::string name;                 // member path, for reporting mismatches
+	long offset=0;                    // byte offset from the start of the enclosing object
+	EDataType datatype=kNoType_t;     // for primitives
+	long item_size=0;                 // size of one element in bytes
+	long count=1;                     // number of consecutive elements
+	std::vector<int> dims;            // static array dimensions, for printing indices
+	bool dynamic=false;               // count is scaled by the branch's dynamic dimension
+
+	// collections, pointers, repeated classes and merged runs compare with a sub-plan.
+	// for runs this holds the constituent primitive steps, used to identify mismatching elements
+	std::vector<plan_step> element_plan;
+	std::shared_ptr<TVirtualCollectionProxy> proxy_1;
+	std::shared_ptr<TVirtualCollectionProxy> proxy_2;
+	bool contiguous=false;            // collection elements are contiguous in memory (std::vector)
+	long stride=0;                    // distance between consecutive collection / repeated elements
+};
+
+class ComparisonPlan {
+
+	public:
+	ComparisonPlan(){};
+	ComparisonPlan(std::string branchname, float tolerance);
+
+	// compiling
+	bool AddType(std::string name, std::string type_as_string, long offset=0, std::vector<int> dims={});
+	void SetAddresses(void* address_1, void* address_2);
+	void SetDynamicDimension(const int* dimension_ptr_1, const int* dimension_ptr_2);
+	void Finalise();
+	bool IsCompiled() const { return compiled; }
+	const std::string& GetError() const { return error; }
+	const std::string& GetName() const { return branch_name; }
+	std::string Describe() const;
+
+	// evaluation. Mismatch descriptions are appended to the report, if given.
+	bool Compare(std::vector<std::string>* report) const;
+
+	private:
+	bool CompileType(std::string name, std::string type_as_string, long offset,
+	                 std::vector<int> dims, std::vector<plan_step>& plan, int depth);
+	bool CompileClass(TClass* cl, std::string name, long offset,
+	                  std::vector<plan_step>& plan, int depth);
+	bool CompileCollection(TClass* cl, std::string name, long offset,
+	                       std::vector<plan_step>& plan, int depth);
+	void Coalesce(std::vector<plan_step>& plan) const;
+
+	bool CompareSteps(const std::vector<plan_step>& plan, const char* base_1, const char* base_2,
+	                  long dynamic_count, std::vector<std::string>* report, const std::string& context) const;
+	bool CompareRun(const plan_step& step, const char* add_1, const char* add_2, long count,
+	                std::vector<std::string>* report, const std::string& context) const;
+	bool CompareCollection(const plan_step& step, const char* add_1, const char* add_2,
+	                       std::vector<std::string>* report, const std::string& context) const;
+	void DescribeSteps(const std::vector<plan_step>& plan, std::string indent, std::string& out) const;
+
+	std::string branch_name;
+	float ftolerance=0.005f;
+	std::vector<plan_step> steps;
+	void* address_1=nullptr;
+	void* address_2=nullptr;
+	const int* dimension_ptr_1=nullptr;
+	const int* dimension_ptr_2=nullptr;
+	bool compiled=false;
+	std::string error;
+
+};
+
+#endif
@@ -1,5 +1,4 @@
 #include "DataQualityCuts.h"
-#include <bitset>
 
 DataQualityCuts::DataQualityCuts():Tool(){}
 
@@ -13,6 +12,7 @@ bool DataQualityCuts::Initialise(std::string configfile, DataModel &data){
 	m_log= m_data->Log;
 	
 	if(!m_variables.Get("verbosity",m_verbose)) m_verbose=1;
+	m_variables.Get("useRunConditions",useRunConditions);
 	
 	// these cuts are based on some in lowfit_sk4.F, and others in make_precut.F
 	// order is different, but there's no point doing lowe reconstruction if we're
@@ -22,11 +22,30 @@ bool DataQualityCuts::Initialise(std::string configfile, DataModel &data){
 	//skoptn_("31,30,26,25");
 	//skbadopt_(23);
 	
+	// cuts from lf_1st_reduction on the event flags, in the order we apply them
+	// 4.4 remove incomplete events
+	flagCuts.AddCut("Incomplete", FlagCuts::event_flag, 1u<<EventFlagSKIV::INCOMPLETE_TQ);
+	// 4.5 remove ID off events
+	flagCuts.AddCut("ID_Off", FlagCuts::event_flag, 1u<<EventFlagSKIV::INNER_DETECTOR_OFF);
+	// 4.5 remove OD off events
+	flagCuts.AddCut("OD_Off", FlagCuts::event_flag, 1u<<EventFlagSKIV::ANTI_DETECTOR_OFF);
+	// skip 'slow data' events (? slow control data?)
+	flagCuts.AddCut("SlowData", FlagCuts::event_flag, 1u<<EventFlagSKIV::INNER_SLOW_DATA);
+	// remove 'run info' events
+	flagCuts.AddCut("RunInfo", FlagCuts::event_flag, 1u<<EventFlagSKIV::RUN_INFORMATION);
+	// remove spacer events
+	flagCuts.AddCut("Spacer", FlagCuts::event_flag, 1u<<EventFlagSKIV::SPACER_BLOCK);
+	// remove LED burst
+	flagCuts.AddCut("LEDburst", FlagCuts::event_flag, 1u<<EventFlagSKIV::LED_BURST_ON);
+	
 	// see if recording cuts, and if so make the selector
 	get_ok = m_variables.Get("selectorName",selectorName);
 	if(get_ok){
 		// make note of all the cuts we're going to make in the order we're going to apply them
 		// AddCut(selectorName, cutname, description)
+		if(useRunConditions){
+			m_data->AddCut(selectorName, "RunConditions", "reject runs flagged in the run conditions",false);
+		}
 		m_data->AddCut(selectorName, "Incomplete", "reject incomplete events",false);
 		m_data->AddCut(selectorName, "ID_Off", "reject events with the ID off",false);
 		m_data->AddCut(selectorName, "OD_Off", "reject events with the OD off",false);
@@ -34,6 +53,7 @@ bool DataQualityCuts::Initialise(std::string configfile, DataModel &data){
 		m_data->AddCut(selectorName, "RunInfo", "reject runinfo entries",false);
 		m_data->AddCut(selectorName, "Spacer", "reject spacer entries",false);
 		m_data->AddCut(selectorName, "LEDburst", "reject LED burst entries",false);
+		if(!flagCuts.RecordIn(m_data->Selectors, selectorName)) return false;
 	}
 	
 	return true;
@@ -42,7 +62,18 @@ bool DataQualityCuts::Initialise(std::string configfile, DataModel &data){
 
 bool DataQualityCuts::Execute(){
 	
-	// 3. bad run cut - now part of TreeReader (FIXME TODO)
+	// 3. bad run cut - lfbadrun is applied by TreeReader. Runs rejected for other reasons
+	// (short runs, after HV recovery, test or calibration runs...) are flagged in the run conditions.
+	if(useRunConditions){
+		const run_conditions& conditions = m_data->runConditions.Get(skhead_.nrunsk);
+		if(!conditions.Good()){
+			m_data->vars.Set("Skip", true);
+			Log(m_unique_name+": event failed RunConditions cut "
+			    +RunConditions::FlagNames(conditions.flags),v_debug,m_verbose);
+			return true;
+		}
+		if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "RunConditions");
+	}
 	
 	// cuts from lf_1st_reduction, called by make_precut, which don't depend on lowe reco variables.
 	// if we're going to skip these events, may as well do it early.
@@ -55,72 +86,23 @@ bool DataQualityCuts::Execute(){
 	
 	// the following cuts seem to be related to outright data quality;
 	// these events probably just shouldn't be used
-	std::bitset<32> triggerID(skhead_.idtgsk);
-	std::bitset<32> eventFlags(skhead_.ifevsk);
-	
-	// 4.4 remove incomplete events
-	if(eventFlags.test(EventFlagSKIV::INCOMPLETE_TQ)){
-		m_data->vars.Set("Skip", true);
-		Log(m_unique_name+": event failed Incomplete cut",v_debug,m_verbose);
-		return true;
-	}
-	if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "Incomplete");
-	
-	// 4.5 remove ID off events
-	if(eventFlags.test(EventFlagSKIV::INNER_DETECTOR_OFF)){
-		m_data->vars.Set("Skip", true);
-		Log(m_unique_name+": event failed ID_Off cut",v_debug,m_verbose);
-		return true;
-	}
-	if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "ID_Off");
-	
-	// 4.5 remove OD off events
-	if(eventFlags.test(EventFlagSKIV::ANTI_DETECTOR_OFF)){
+	// these are all tests of the event flags, so FlagCuts makes them together,
+	// counting and recording the events that pass each one
+	int failed_cut = flagCuts.Apply(skhead_.idtgsk, skhead_.ifevsk);
+	if(failed_cut>=0){
 		m_data->vars.Set("Skip", true);
-		Log(m_unique_name+": event failed OD_Off cut",v_debug,m_verbose);
+		Log(m_unique_name+": event failed "+flagCuts.CutName(failed_cut)+" cut",v_debug,m_verbose);
 		return true;
 	}
-	if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "OD_Off");
 	
-	// skip 'slow data' events (? slow control data?)
-	if(eventFlags.test(EventFlagSKIV::INNER_SLOW_DATA)){
-		m_data->vars.Set("Skip", true);
-		Log(m_unique_name+": event failed SlowData cut",v_debug,m_verbose);
-		return true;
-	}
-	if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "SlowData");
-	
-	// remove 'run info' events
-	if(eventFlags.test(EventFlagSKIV::RUN_INFORMATION)){
-		m_data->vars.Set("Skip", true);
-		Log(m_unique_name+": event failed RunInfo cut",v_debug,m_verbose);
-		return true;
-	}
-	if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "RunInfo");
-	
-	// remove spacer events
-	if(eventFlags.test(EventFlagSKIV::SPACER_BLOCK)){
-		m_data->vars.Set("Skip", true);
-		Log(m_unique_name+": event failed Spacer cut",v_debug,m_verbose);
-		return true;
-	}
-	if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "Spacer");
-	
-	// remove LED burst
-	if(eventFlags.test(EventFlagSKIV::LED_BURST_ON)){
-		m_data->vars.Set("Skip", true);
-		Log(m_unique_name+": event failed LEDburst cut",v_debug,m_verbose);
-		return true;
-	}
-	if(!selectorName.empty()) m_data->AddPassingEvent(selectorName, "LEDburst");
-	
-	// TODO: from relic sk4:
+	// TODO: from relic sk4, the following are covered by the run conditions if listed there:
 	// reject "test runs"
 	// reject "calibration runs" (LINAC?)
 	// reject runs < 5mins
 	// reject runs started <15 mins after HV recovery
 	// reject runs with hardware problems?
 	// reject runs with "odd event distriubtions"
+	// but we still need to:
 	// reject "badly processed events"?
 	Log(m_unique_name+": event passed Data Quality cuts",v_debug,m_verbose);
 	
@@ -130,5 +112,7 @@ bool DataQualityCuts::Execute(){
 
 bool DataQualityCuts::Finalise(){
 	
+	if(m_verbose>=v_message) flagCuts.PrintCutFlow();
+	
 	return true;
 }
@@ -5,6 +5,7 @@
 #include <iostream>
 
 #include "Tool.h"
+#include "FlagCuts.h"
 
 
 /**
@@ -28,6 +29,8 @@ class DataQualityCuts: public Tool {
 	
 	private:
 	std::string selectorName;
+	bool useRunConditions=false;   // reject runs that are not good in m_data->runConditions
+	FlagCuts flagCuts;             // cuts on the event flags
 	
 };
 
@@ -1,4 +1,5 @@
 #include "Factory.h"
+#include "ProfiledTool.h"
 
 Tool* Factory(std::string tool){
 Tool* ret=0;
@@ -92,6 +93,13 @@ if (tool=="CompareCommons") ret=new CompareCommons;
 // if (tool=="NTagAnalysis") ret=new NTagAnalysis;
 // if (tool=="MergeDipstickFiles") ret=new MergeDipstickFiles;
 if (tool=="GetSubTriggers") ret=new GetSubTriggers;
+if (tool=="BuildTriggerIndex") ret=new BuildTriggerIndex;
+if (tool=="GenerateSyntheticInput") ret=new GenerateSyntheticInput;
+if (tool=="ThroughputBenchmark") ret=new ThroughputBenchmark;
+if (tool=="LoadRunConditions") ret=new LoadRunConditions;
+
+// time each Tool's calls if profiling with --profile
+if (ret!=0 && ToolProfiler::Enabled()) ret=new ProfiledTool(ret, tool);
 
 return ret;
 }
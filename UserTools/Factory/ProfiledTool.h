@@ -0,0 +1,56 @@
+#ifndef PROFILEDTOOL_H
+#define PROFILEDTOOL_H
+
+#include <string>
+
+#include "Tool.h"
+#include "ToolProfiler.h"
+
+/**
+ * \class ProfiledTool
+ *
+ * Wraps a Tool made by the Factory when profiling is enabled (see ToolProfiler),
+ * forwarding each call to it and reporting how long it took.
+ */
+
+class ProfiledTool: public Tool {
+
+	public:
+	ProfiledTool(Tool* tool_in, const std::string& tool_class_in) : tool(tool_in), tool_class(tool_class_in){}
+	~ProfiledTool(){ delete tool; }
+
+	bool Initialise(std::string configfile, DataModel &data){
+		m_data = &data;
+		// the ToolChain names the wrapper, so pass that on to the Tool
+		tool->SetName(GetName());
+		id = ToolProfiler::Register(GetName(), tool_class);
+		const double wall = ToolProfiler::WallTime(), cpu = ToolProfiler::CpuTime();
+		bool ok = tool->Initialise(configfile, data);
+		ToolProfiler::RecordInitialise(id, wall, ToolProfiler::WallTime()-wall, ToolProfiler::CpuTime()-cpu, ok);
+		return ok;
+	}
+
+	bool Execute(){
+		const double wall = ToolProfiler::WallTime(), cpu = ToolProfiler::CpuTime();
+		bool ok = tool->Execute();
+		ToolProfiler::RecordExecute(id, wall, ToolProfiler::WallTime()-wall, ToolProfiler::CpuTime()-cpu, ok);
+		return ok;
+	}
+
+	bool Finalise(){
+		// TreeReaders may close their files in Finalise
+		ToolProfiler::RecordReaders(m_data->Trees);
+		const double wall = ToolProfiler::WallTime(), cpu = ToolProfiler::CpuTime();
+		bool ok = tool->Finalise();
+		ToolProfiler::RecordFinalise(id, wall, ToolProfiler::WallTime()-wall, ToolProfiler::CpuTime()-cpu, ok);
+		return ok;
+	}
+
+	private:
+	Tool* tool=nullptr;
+	std::string tool_class;
+	int id=-1;
+
+};
+
+#endif
@@ -6,6 +6,7 @@
 #include "type_name_as_string.h"
 #include "MTreeReader.h"
 #include "MTreeSelection.h"
+#include "UnbinnedFit.h"
 
 #include "TROOT.h"
 #include "TFile.h"
@@ -15,18 +16,8 @@
 #include "TFitResult.h"
 #include "TFitResultPtr.h"
 
-// For Fitting
-#include "Fit/Fitter.h"
-//#include "Fit/BinData.h"
-#include "Fit/UnBinData.h"
-//#include "Fit/Chi2FCN.h"
-//#include "Fit/DataOptions.h"
-#include "Fit/FitConfig.h"
-
-// For defining the functions
-//#include "TList.h"
-#include "Math/WrappedMultiTF1.h"
-//#include "HFitInterface.h"
+#include <cmath>
+#include <algorithm>
 
 FitLi9Lifetime::FitLi9Lifetime():Tool(){}
 
@@ -50,6 +41,9 @@ bool FitLi9Lifetime::Initialise(std::string configfile, DataModel &data){
 	m_variables.Get("li9_lifetime_dtmax",li9_lifetime_dtmax);
 	m_variables.Get("outputFile",outputFile);          // where to save data. If empty, current TFile
 	m_variables.Get("treeReaderName",treeReaderName);
+	m_variables.Get("fitThreads",fitThreads);          // threads to split unbinned fit likelihood over
+	m_variables.Get("nBootstrap",nBootstrap);          // num resampled datasets for bootstrap errors, 0 for none
+	m_variables.Get("bootstrapSeed",bootstrapSeed);
 	
 	myTreeReader = m_data->Trees.at(treeReaderName);
 	myTreeSelections = m_data->Selectors.at(treeReaderName);
@@ -178,7 +172,9 @@ bool FitLi9Lifetime::PlotLi9LifetimeDt(){
 	std::cout<<"doing Li9 lifetime binned chi2 fit"<<std::endl;
 	double binned_estimate = BinnedLi9DtChi2Fit(&li9_muon_dt_hist);
 	
-	// TODO (un)binned extended likelihood fit to also extract number of Li9 events?
+	// unbinned extended likelihood fit to also extract the Li9 lifetime and number of Li9 events
+	std::cout<<"doing Li9 lifetime unbinned likelihood fit"<<std::endl;
+	UnbinnedLi9DtLogLikeFit(&li9_muon_dt_hist, binned_estimate);
 	
 	return true;
 }
@@ -247,6 +243,65 @@ double FitLi9Lifetime::BinnedLi9DtChi2Fit(TH1F* li9_muon_dt_hist){
 	return li9_muon_dt_func.GetParameter(1);
 }
 
+bool FitLi9Lifetime::UnbinnedLi9DtLogLikeFit(TH1F* li9_muon_dt_hist, double num_li9_events){
+	
+	// extended likelihood fit of rate = C + A*exp(-dt/τ), with the Li9 lifetime floating
+	UnbinnedFit li9_dt_fit(li9_lifetime_dtmin, li9_lifetime_dtmax);
+	li9_dt_fit.SetVerbosity(m_verbose);
+	li9_dt_fit.SetNThreads(fitThreads);
+	li9_dt_fit.SetData(li9_muon_dt_vals);
+	double num_events = li9_dt_fit.GetNEvents();
+	Log(m_unique_name+" doing unbinned likelihood fit with "+toString(num_events)
+	    +" of "+toString(li9_muon_dt_vals.size())+" values in range",v_message,m_verbose);
+	if(num_events==0){
+		Log(m_unique_name+" no mu-lowe dt values in fit range, skipping unbinned fit",v_warning,m_verbose);
+		return false;
+	}
+	
+	// the binned fit amplitude is only a rough guide to the number of Li9 events, so keep it in range
+	double num_li9_start = std::min(std::max(num_li9_events,0.5*num_events),num_events);
+	int bg_par = li9_dt_fit.AddFlat("background",num_events-num_li9_start);
+	int li9_par = li9_dt_fit.AddExponential("li9",num_li9_start,li9_lifetime_secs,false);
+	int lifetime_par = li9_dt_fit.GetParNumber("li9_lifetime");
+	
+	// DO THE FIT
+	if(!li9_dt_fit.Fit()){
+		Log(m_unique_name+" unbinned li9 dt fit did not converge, status "
+		    +toString(li9_dt_fit.GetResult().status),v_warning,m_verbose);
+	}
+	std::vector<double> errors(li9_dt_fit.GetNpar());
+	for(size_t par=0; par<errors.size(); ++par) errors.at(par) = li9_dt_fit.GetParError(par);
+	
+	// optionally estimate errors from the spread of fits to resampled datasets
+	if(nBootstrap>1){
+		std::vector<double> bootstrap_errs = li9_dt_fit.Bootstrap(nBootstrap, bootstrapSeed);
+		Log(m_unique_name+" bootstrap lifetime error from "+toString(nBootstrap)+" replicas: +-"
+		    +toString(bootstrap_errs.at(lifetime_par))+" (Hesse: +-"+toString(errors.at(lifetime_par))+")",
+		    v_message,m_verbose);
+		errors = bootstrap_errs;
+	}
+	
+	Log(m_unique_name+" li9 mu->lowe dt unbinned fit: lifetime "+toString(li9_dt_fit.GetParameter(lifetime_par))
+	    +" +- "+toString(errors.at(lifetime_par))+" s (expected "+toString(li9_lifetime_secs)+" s), "
+	    +toString(li9_dt_fit.GetParameter(li9_par))+" +- "+toString(errors.at(li9_par))+" Li9 events, "
+	    +toString(li9_dt_fit.GetParameter(bg_par))+" +- "+toString(errors.at(bg_par))+" background events",
+	    v_message,m_verbose);
+	
+	// save a histogram of the fitted distribution, in counts per bin, for comparison with the data
+	TH1F* li9_muon_dt_fit_hist = (TH1F*)li9_muon_dt_hist->Clone("li9_muon_dt_unbinned_fit");
+	li9_muon_dt_fit_hist->SetTitle("Unbinned fit to muon to Low-E dt for Li9 triplets");
+	li9_muon_dt_fit_hist->Reset();
+	for(int bini=1; bini<=li9_muon_dt_fit_hist->GetNbinsX(); ++bini){
+		li9_muon_dt_fit_hist->SetBinContent(bini,
+		    li9_dt_fit.Density(li9_muon_dt_fit_hist->GetBinCenter(bini))*li9_muon_dt_fit_hist->GetBinWidth(bini));
+	}
+	li9_muon_dt_fit_hist->Write();
+	delete li9_muon_dt_fit_hist;
+	
+	std::cout<<"li9 lifetime unbinned likelihood fit done"<<std::endl;
+	return true;
+}
+
 // =========================================================================
 // Li9 energy spectrum fits
 // =========================================================================
@@ -38,6 +38,9 @@ class FitLi9Lifetime: public Tool {
 	float li9_lifetime_dtmax;         // for Li9 candidates, seconds
 	std::string outputFile="";
 	std::string treeReaderName;
+	int fitThreads=1;                 // threads for unbinned fit
+	int nBootstrap=0;                 // num bootstrap replicas for unbinned fit errors
+	int bootstrapSeed=0;
 	MTreeReader* myTreeReader=nullptr;
 	MTreeSelection* myTreeSelections=nullptr;
 	
@@ -47,6 +50,7 @@ class FitLi9Lifetime: public Tool {
 	bool PlotLi9BetaEnergy();
 	bool PlotLi9LifetimeDt();
 	double BinnedLi9DtChi2Fit(TH1F* li9_muon_dt_hist);
+	bool UnbinnedLi9DtLogLikeFit(TH1F* li9_muon_dt_hist, double num_li9_events);
 	
 	// tool variables
 	// ==============
@@ -6,6 +6,7 @@
 #include "type_name_as_string.h"
 #include "MTreeReader.h"
 #include "MTreeSelection.h"
+#include "UnbinnedFit.h"
 
 #include "TROOT.h"
 #include "TFile.h"
@@ -17,16 +18,12 @@
 #include "TFitResultPtr.h"
 #include "TString.h"
 
-// For Fitting
-#include "Fit/Fitter.h"
-#include "Fit/UnBinData.h"
-#include "Fit/FitConfig.h"
-#include "Math/WrappedMultiTF1.h"
+#include <cmath>
+#include <algorithm>
 
 FitPurewaterLi9NcaptureDt::FitPurewaterLi9NcaptureDt():Tool(){}
 
 // from 2015 paper Table I
-constexpr double li9_lifetime_secs = 0.26;
 constexpr double ncapture_lifetime_secs = 204.8E-6;
 
 bool FitPurewaterLi9NcaptureDt::Initialise(std::string configfile, DataModel &data){
@@ -45,6 +42,9 @@ bool FitPurewaterLi9NcaptureDt::Initialise(std::string configfile, DataModel &da
 	m_variables.Get("li9_ncapture_dtmin",ncap_dtmin);
 	m_variables.Get("li9_ncapture_dtmax",ncap_dtmax);
 	m_variables.Get("treeReaderName",treeReaderName);
+	m_variables.Get("fitThreads",fitThreads);          // threads to split unbinned fit likelihood over
+	m_variables.Get("nBootstrap",nBootstrap);          // num resampled datasets for bootstrap errors, 0 for none
+	m_variables.Get("bootstrapSeed",bootstrapSeed);
 	
 	myTreeReader = m_data->Trees.at(treeReaderName);
 	myTreeSelections = m_data->Selectors.at(treeReaderName);
@@ -217,178 +217,81 @@ double FitPurewaterLi9NcaptureDt::BinnedNcapDtChi2Fit(TH1F* li9_ncap_dt_hist){
 
 bool FitPurewaterLi9NcaptureDt::UnbinnedNcapDtLogLikeFit(TH1F* li9_ncap_dt_hist, double num_li9_events){
 	
-	std::cout<<"doing unbinned likelihood fit with "<<li9_ntag_dt_vals.size()<<" values"<<std::endl;
-	
-	// TF1 of likelihood distribution
-	// ROOT provides some basic pdfs: https://root.cern.ch/doc/v610/group__PdfFunc.html
-	// but we need our likelihood to be normalized and I don't see how to do it suitably with these
-//	TF1 ncapture_dt_unbinned_like("ncapture_dt_unbinned_like",
-//	TString::Format("[0]*ROOT::Math::uniform_pdf (x,%.2f,%.2f,0) "
-//	                " + [1]*ROOT::Math::exponential_pdf(x,[1],0)",xmin,xmax),xmin,xmax);
-	
-	// so let's make our own
-	int fit_n_pars = 1;
-	int func_n_dims = 1;
-	std::cout<<"making TF1"<<std::endl;
-	TF1 ncapture_dt_unbinned_like("ncapture_dt_unbinned_like",this,&FitPurewaterLi9NcaptureDt::ncap_lifetime_loglike,
-	        ncap_dtmin, ncap_dtmax, fit_n_pars, "FitPurewaterLi9NcaptureDt", "ncap_lifetime_loglike");
-	
-	// set parameter names
-	ncapture_dt_unbinned_like.SetParName(0,"fraction of background events");
-	ncapture_dt_unbinned_like.SetParLimits(0,0,1.);
-	
-	//ncapture_dt_unbinned_like.SetParameters(allparams.data());  // pass an array or set individually
-	// set starting values to fit val from binned fit
-	std::cout<<"setting starting value of background fraction to "
-			 <<(1.-(num_li9_events/li9_ntag_dt_vals.size()))<<std::endl;
-	ncapture_dt_unbinned_like.SetParameter(0,(1.-(num_li9_events/li9_ntag_dt_vals.size())));
-	
-	int nbins=10;
-	for(int i=nbins; i>0; --i){
-		std::vector<double> pars{ncapture_dt_unbinned_like.GetParameter(0)};
-		double xval = ncap_dtmin+double(i)*((ncap_dtmax-ncap_dtmin)/double(nbins-1));
-		std::cout<<"ncapture unbinned function eval at "<<xval<<" = "
-				 <<ncapture_dt_unbinned_like.Eval(xval)<<std::endl
-				 <<", base function = "<<ncap_lifetime_loglike(&xval,pars.data())
-				 <<std::endl;
+	// fit range is configured in microseconds, but times are in seconds
+	const double fit_dtmin = ncap_dtmin*1E-6;
+	const double fit_dtmax = ncap_dtmax*1E-6;
+	
+	// extended likelihood fit of rate = C + A*exp(-dt/τ), with τ fixed to the ncapture lifetime.
+	// The fit parameters are the number of background and signal events in the range,
+	// from which the background fraction follows directly.
+	UnbinnedFit ncap_dt_fit(fit_dtmin, fit_dtmax);
+	ncap_dt_fit.SetVerbosity(m_verbose);
+	ncap_dt_fit.SetNThreads(fitThreads);
+	ncap_dt_fit.SetData(li9_ntag_dt_vals);  // already adjusted and in seconds
+	double num_events = ncap_dt_fit.GetNEvents();
+	Log(m_unique_name+" doing unbinned likelihood fit with "+toString(num_events)
+	    +" of "+toString(li9_ntag_dt_vals.size())+" values in range",v_message,m_verbose);
+	if(num_events==0){
+		Log(m_unique_name+" no ncapture times in fit range, skipping unbinned fit",v_warning,m_verbose);
+		return false;
 	}
 	
-	// draw for comparison. Since our likelihood function is normalised we need to normalise the data too
-	TH1F* li9_ncap_dt_hist_normalised = (TH1F*)li9_ncap_dt_hist->Clone();
-	li9_ncap_dt_hist_normalised->Scale(1./li9_ncap_dt_hist->Integral());
-	li9_ncap_dt_hist_normalised->Draw();
-	ncapture_dt_unbinned_like.Draw("same");
-	gPad->WaitPrimitive();
-	return true;
-	
-	// convert the TF1 for use in unbinned fit
-	std::cout<<"making TF1 wrapper"<<std::endl;
-	ROOT::Math::WrappedMultiTF1 ncapture_dt_unbinned_func(ncapture_dt_unbinned_like,
-	                                                      ncapture_dt_unbinned_like.GetNdim());
-	
-	// build a fitter
-	// 'false' says let the fitter calculate derivatives of the function itself (recommended)
-	std::cout<<"making fitter"<<std::endl;
-	ROOT::Fit::Fitter fitter;
-	fitter.SetFunction(ncapture_dt_unbinned_func);  // no bool in ROOT 5 - what's the default?
-	// important note: the fit function should be normalized, but simply calculating and dividing by
-	// the integral before returning may not be enough as this introduces a correlation
-	// between the fit parameters. Apparently the best way is to fit N-1 parameters, then derive
-	// the value of the remaining one from the others and a fixed normalization condition
-	// https://root-forum.cern.ch/t/root-fit-unbindata-example-is-not-working/28462/3
-	// in cases where it is sufficient to simply divide by the integral (which??) 
-	// a wrapper is given in https://root-forum.cern.ch/t/unbinned-log-likelihood-fits/18981/2
-	
-	// can we do it just by fixing the parameter?
-	// https://web.pa.msu.edu/people/brock/file_sharing/ATLAS/root/math/mathcore/test/fit/testRooFit.cxx
-	//fitter.Config().ParSettings(0).Fix();
-	
-	// configure the fitter
-	// there is a fitter.Config().ParSettings(#) for each parameter #
-	// these are available only after calling ROOT::Fit::Fitter::SetFunction
-	// the configurable options are:
-	// the initial values of the parameters;   (can also be set by input model func)
-	// the parameter step sizes;
-	// eventual parameter bounds;
-	// the minimizer library and the particular algorithm to use;
-	// different minimization options (print level, tolerance, max iterations, etc.)
-	// the type of parameter errors to compute (parabolic error, Minos errors, re-normalized errors using fitted chi2 values)
-	
-	// set initial values. Think it also inherits initial values from TF1 on construction?
-	//double initialParams[] = {2,1};
-	//fitter.Config().SetParamsSettings(2,initialParams);
-	
-	// set the minimizer algorithm to use
-	// https://root.cern.ch/root/htmldoc/guides/users-guide/FittingHistograms.html
-	// https://root.cern.ch/root/htmldoc/ROOT__Fit__FitConfig.html
-	fitter.Config().SetMinimizer("Minuit2","Migrad");
-//	fitter.Config().SetUpdateAfterFit();  // not in root 5
-	
-	// minimizer options include:
-	// Minimizer type (Minuit, Fumili, GSLMultiMin...)
-	// Minimizer algorithm (Migrad, Simplex, Scan...)
-	// Strategy - Minuit default 1 is to only compute full Hessian matrix after minimization(?)
-	// Print level (m_verbose 0...)
-	// Tolerance to control iterations
-	// Max function calls
-	// Max iterations (not used by Minuit)
-	// Parameter errors value (??) - default 1 for chi2, 0.5 for log-likelihood
-	// Precision in evaluation of minimization. Default double. Should we use float?
-	
-	// MinimizerOptions::SetMaxFunctionCalls(int )
-	// MinimizerOptions::SetTolerance(double )
-	// MinimizerOptions::SetPrecision(double )
-	//ROOT::Math::MinimizerOptions opt = fitter.Config().MinimizerOptions();
-	//opt.SetMaxFunctionCalls(5000);  // XXX like this?
-	
-//	ROOT::Fit::DataOptions opt;
-//	ROOT::Fit::DataRange range(0,5);
-//	ROOT::Fit::UnBinData ncap_dt_data(opt, range, x.size());
-	
-	// convert the data into a suitable 'UnBinData' object
-	std::cout<<"making unbinned dataset"<<std::endl;
-	ROOT::Fit::UnBinData ncap_dt_data(li9_ntag_dt_vals.size());
-	for(auto aval : li9_ntag_dt_vals){   // note: use auto NOT auto&&
-		ncap_dt_data.Add(aval);   // can we introduce weights here? FIXME
-	}
+	// set starting values from the binned fit
+	double num_li9_start = std::min(std::max(num_li9_events,0.),num_events);
+	int bg_par = ncap_dt_fit.AddFlat("background",num_events-num_li9_start);
+	int li9_par = ncap_dt_fit.AddExponential("li9_ncapture",num_li9_start,ncapture_lifetime_secs);
 	
 	// DO THE FIT
-	std::cout<<"doing the fit"<<std::endl;
-	fitter.LikelihoodFit(ncap_dt_data);
-	
-	// print the results
-	ROOT::Fit::FitResult r=fitter.Result();
-	r.Print(std::cout);
+	if(!ncap_dt_fit.Fit()){
+		Log(m_unique_name+" unbinned ncapture dt fit did not converge, status "
+		    +toString(ncap_dt_fit.GetResult().status),v_warning,m_verbose);
+	}
+	double num_bg = ncap_dt_fit.GetParameter(bg_par);
+	double num_li9 = ncap_dt_fit.GetParameter(li9_par);
+	double num_bg_err = ncap_dt_fit.GetParError(bg_par);
+	double num_li9_err = ncap_dt_fit.GetParError(li9_par);
+	
+	// with few events the parabolic errors may not be trustworthy, so optionally
+	// estimate them from the spread of fits to resampled datasets
+	if(nBootstrap>1){
+		std::vector<double> bootstrap_errs = ncap_dt_fit.Bootstrap(nBootstrap, bootstrapSeed);
+		Log(m_unique_name+" bootstrap errors from "+toString(nBootstrap)+" replicas: background +-"
+		    +toString(bootstrap_errs.at(bg_par))+", li9 +-"+toString(bootstrap_errs.at(li9_par))
+		    +" (Hesse: +-"+toString(num_bg_err)+", +-"+toString(num_li9_err)+")",v_message,m_verbose);
+		num_bg_err = bootstrap_errs.at(bg_par);
+		num_li9_err = bootstrap_errs.at(li9_par);
+	}
 	
-	std::cout<<"unbinned likelihood fit done"<<std::endl;
+	// propagate the yield errors to the background fraction, neglecting their correlation
+	double num_total = num_bg + num_li9;
+	double bg_fraction = (num_total>0) ? num_bg/num_total : 0;
+	double bg_fraction_err = (num_total>0) ?
+	    sqrt(pow(num_li9*num_bg_err,2.)+pow(num_bg*num_li9_err,2.))/pow(num_total,2.) : 0;
+	Log(m_unique_name+" ncapture dt unbinned fit: "+toString(num_li9)+" +- "+toString(num_li9_err)
+	    +" Li9+n events, "+toString(num_bg)+" +- "+toString(num_bg_err)+" background events;"
+	    +" background fraction "+toString(bg_fraction)+" +- "+toString(bg_fraction_err),v_message,m_verbose);
+	
+	// make a histogram of the fitted distribution, in counts per bin, for comparison with the data
+	TH1F* li9_ncap_dt_fit_hist = (TH1F*)li9_ncap_dt_hist->Clone("li9_ncap_dt_unbinned_fit");
+	li9_ncap_dt_fit_hist->SetTitle("Unbinned fit to beta to ncapture dt for Li9 triplets");
+	li9_ncap_dt_fit_hist->Reset();
+	for(int bini=1; bini<=li9_ncap_dt_fit_hist->GetNbinsX(); ++bini){
+		double bin_centre = li9_ncap_dt_fit_hist->GetBinCenter(bini);
+		if(bin_centre<fit_dtmin || bin_centre>fit_dtmax) continue;
+		li9_ncap_dt_fit_hist->SetBinContent(bini,
+		    ncap_dt_fit.Density(bin_centre)*li9_ncap_dt_fit_hist->GetBinWidth(bini));
+	}
+	li9_ncap_dt_fit_hist->SetLineColor(kRed);
+	li9_ncap_dt_fit_hist->Write();
 	
-	// TODO err, extract and return parameters for drawing
-	li9_ncap_dt_hist_normalised->Draw();
-	ncapture_dt_unbinned_like.Draw("same");
+	// draw result
+	li9_ncap_dt_hist->Draw();
+	li9_ncap_dt_fit_hist->Draw("same hist");
 	gPad->WaitPrimitive();
 	gPad->Clear();
+	delete li9_ncap_dt_fit_hist;
+	
+	std::cout<<"unbinned likelihood fit done"<<std::endl;
 	return true;
 }
 
-double FitPurewaterLi9NcaptureDt::ncap_lifetime_loglike(double* x, double* par){
-	// shouldn't be trying to fit times outside our range
-	if(((*x)<ncap_dtmin) || ((*x)>ncap_dtmax)) return 1e10;
-	// shouldn't be trying to fit parameter values outside the valid range
-	if((par[0]<0.) || (par[0]>1.)) return 1e10;
-	
-	// likelihood of an event occurring at a given time, using the specified background fraction
-	// being that this is a probability the return value should be normalised 0-1
-	// since the integral is fixed, all we can vary here is is the fraction
-	// of events that are signal vs background
-	
-	// rate = C + A*exp(-dt/τ)
-	// τ = neutron capture lifetime
-	// C = rate of accidental backgrounds
-	// A = rate of signal events
-	
-	// we need to make a PDF, so need to normalise. Calculating the integral we get:
-	// integral = C*Δt + A*τ*[exp(-tmax/τ) - exp(-tmin/τ)]
-	// the normalized function is obtained by scaling by this integral, turning C->c, A->a
-	// a = A / integral, c = C / integral, giving:
-	// c*Δt + a*τ*[exp(-tmax/τ) - exp(-tmin/τ)] = 1
-	// we can relate a and c:
-	// a = (c*Δt - 1 ) / τ*[exp(-tmax/τ) - exp(-tmin/τ)]
-	// so now c*Δt is the fraction of background events
-	// for a to remain poaitive we should restrict c to the range 0 to (1/Δt)
-	// if we define par[0] = c' = c*Δt, then we can fit it directly.
-	
-	// Now, we have been given a value par[0], so
-	// calculate a based on our value of c':
-	double timespan = ncap_dtmax-ncap_dtmin;
-	double ncap_lifetime = li9_lifetime_secs;
-	double a =  (par[0] - 1.) / (ncap_lifetime*(exp(-ncap_dtmax/ncap_lifetime) - exp(-ncap_dtmin/ncap_lifetime)));
-	
-	// calculate likelihood of an event at time (*x) given a background fraction of c'
-	// i.e. evaluate the normalised function, c + a*exp(-dt/τ), at this time
-	double thelikelihood = (par[0]/timespan) + a*exp(-(*x)/ncap_lifetime);
-	
-	// return log-likelihood
-	return thelikelihood;
-	//return log(thelikelihood);    // doesn't this mess with our normalization?
-}
-
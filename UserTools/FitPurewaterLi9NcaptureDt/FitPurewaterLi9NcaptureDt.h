@@ -37,7 +37,6 @@ class FitPurewaterLi9NcaptureDt: public Tool {
 	bool PlotNcaptureDt();
 	double BinnedNcapDtChi2Fit(TH1F* li9_ncap_dt_hist);
 	bool UnbinnedNcapDtLogLikeFit(TH1F* li9_ncap_dt_hist, double num_li9_events);
-	double ncap_lifetime_loglike(double* x, double* par);
 	
 	// tool variables
 	// ==============
@@ -46,6 +45,9 @@ class FitPurewaterLi9NcaptureDt: public Tool {
 	float ncap_dtmin;                 // range of dt_mu_ncap values to accept
 	float ncap_dtmax;                 // for Li9 abundance extraction, **microseconds**
 	std::string treeReaderName;
+	int fitThreads=1;                 // threads for unbinned fit
+	int nBootstrap=0;                 // num bootstrap replicas for unbinned fit errors
+	int bootstrapSeed=0;
 	MTreeReader* myTreeReader=nullptr;
 	MTreeSelection* myTreeSelections=nullptr;
 	
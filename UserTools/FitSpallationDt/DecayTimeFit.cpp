@@ -0,0 +1,423 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "DecayTimeFit.h"
+
+#include "ParallelFor.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "TROOT.h"
+#include "TH1.h"
+#include "TRandom3.h"
+#include "Math/Minimizer.h"
+#include "Math/Factory.h"
+#include "Math/IFunction.h"
+
+// ===========================================================================
+// decay templates
+
+double decay_template::operator()(double lo, double hi) const {
+	// exact integral of (1/τ)exp(-t/τ) over the bin, averaged over lifetimes for pairs.
+	// written as exp(-lo/τ)*(1-exp(-(hi-lo)/τ)) to retain precision for narrow bins at large t
+	double sum=0;
+	for(const double& tau : lifetimes){
+		sum += std::exp(-lo/tau) * -std::expm1(-(hi-lo)/tau);
+	}
+	return sum/lifetimes.size();
+}
+
+double decay_template::Density(double t) const {
+	double sum=0;
+	for(const double& tau : lifetimes) sum += std::exp(-t/tau)/tau;
+	return sum/lifetimes.size();
+}
+
+// ===========================================================================
+// binned Poisson likelihood
+
+namespace {
+
+// -2lnL of a Poisson likelihood relative to the saturated model (the 'Cash' / Baker-Cousins chi2)
+// for expectations mu_b = sum_p x_p * basis_pb. Because mu is linear in the parameters,
+// d(-2lnL)/dx_p = 2 * sum_b (1 - n_b/mu_b) * basis_pb, so the gradient comes for
+// the price of one more pass over the bins.
+class PoissonDecayNLL : public ROOT::Math::IMultiGradFunction {
+	public:
+	PoissonDecayNLL(const double* basis_in, const double* counts_in, size_t nbins_in, size_t npar_in) :
+		basis(basis_in), counts(counts_in), nbins(nbins_in), npar(npar_in), mu(nbins_in) {
+		saturated=0;
+		for(size_t i=0; i<nbins; ++i){
+			if(counts[i]>0) saturated += counts[i]*std::log(counts[i]) - counts[i];
+		}
+	}
+	ROOT::Math::IMultiGenFunction* Clone() const override { return new PoissonDecayNLL(*this); }
+	unsigned int NDim() const override { return npar; }
+	void Gradient(const double* x, double* grad) const override {
+		double f;
+		FdF(x,f,grad);
+	}
+	void FdF(const double* x, double& f, double* grad) const override {
+		f = Expectations(x);
+		// reuse mu to hold the per-bin weights of the gradient
+		for(size_t i=0; i<nbins; ++i) mu[i] = 1. - counts[i]/mu[i];
+		for(size_t p=0; p<npar; ++p){
+			const double* row = basis + p*nbins;
+			double sum=0;
+			for(size_t i=0; i<nbins; ++i) sum += mu[i]*row[i];
+			grad[p] = 2.*sum;
+		}
+	}
+
+	private:
+	double DoEval(const double* x) const override { return Expectations(x); }
+	double DoDerivative(const double* x, unsigned int icoord) const override {
+		std::vector<double> grad(npar);
+		Gradient(x,grad.data());
+		return grad.at(icoord);
+	}
+	// fill mu with the expected counts in each bin, and return -2lnL
+	double Expectations(const double* x) const {
+		std::fill(mu.begin(), mu.end(), 0.);
+		for(size_t p=0; p<npar; ++p){
+			if(x[p]==0) continue;
+			const double amp = x[p];
+			const double* row = basis + p*nbins;
+			for(size_t i=0; i<nbins; ++i) mu[i] += amp*row[i];
+		}
+		double sum=0;
+		for(size_t i=0; i<nbins; ++i){
+			mu[i] = std::max(mu[i], std::numeric_limits<double>::min());
+			sum += mu[i] - counts[i]*std::log(mu[i]);
+		}
+		return 2.*(sum + saturated);
+	}
+
+	const double* basis;
+	const double* counts;
+	size_t nbins;
+	size_t npar;
+	double saturated;
+	// scratch space. Each minimizer evaluates its own copy, so this is never shared between threads
+	mutable std::vector<double> mu;
+};
+
+} // end anonymous namespace
+
+// ===========================================================================
+// DecayTimeFit
+
+DecayTimeFit::~DecayTimeFit(){
+	for(ROOT::Math::Minimizer* aminimizer : minimizers) delete aminimizer;
+	minimizers.clear();
+}
+
+bool DecayTimeFit::SetData(const TH1& counts_hist){
+	const int nbins = counts_hist.GetNbinsX();
+	std::vector<double> binedges(nbins+1);
+	std::vector<double> counts(nbins);
+	for(int bini=1; bini<nbins+1; ++bini){
+		binedges[bini-1] = counts_hist.GetXaxis()->GetBinLowEdge(bini);
+		counts[bini-1] = counts_hist.GetBinContent(bini);
+	}
+	binedges[nbins] = counts_hist.GetXaxis()->GetBinUpEdge(nbins);
+	return SetData(binedges, counts);
+}
+
+bool DecayTimeFit::SetData(const std::vector<double>& binedges, const std::vector<double>& counts){
+	if(binedges.size()!=(counts.size()+1)){
+		std::cerr<<"DecayTimeFit::SetData error! Given "<<binedges.size()<<" bin edges for "
+		         <<counts.size()<<" bins"<<std::endl;
+		return false;
+	}
+	bool non_integer=false;
+	for(const double& acount : counts){
+		if(acount<0){
+			std::cerr<<"DecayTimeFit::SetData error! Negative bin counts cannot be fit with a Poisson "
+			         <<"likelihood; fit the raw counts instead of a subtracted distribution"<<std::endl;
+			return false;
+		}
+		if(std::abs(acount-std::round(acount))>1E-6) non_integer=true;
+	}
+	if(non_integer && verbosity){
+		std::cerr<<"DecayTimeFit::SetData warning! Non-integer bin counts. The likelihood assumes "
+		         <<"raw counts; scaled histograms will give incorrect errors"<<std::endl;
+	}
+	edges = binedges;
+	data_counts = counts;
+	basis.clear();
+	return true;
+}
+
+int DecayTimeFit::AddComponent(std::string name, std::vector<double> lifetimes){
+	if(par_numbers.count(name)){
+		std::cerr<<"DecayTimeFit::AddComponent error! Component "<<name<<" already exists"<<std::endl;
+		return -1;
+	}
+	if(lifetimes.empty()){
+		std::cerr<<"DecayTimeFit::AddComponent error! No lifetimes given for component "<<name<<std::endl;
+		return -1;
+	}
+	int par = par_names.size();
+	par_numbers.emplace(name,par);
+	par_names.push_back(name);
+	templates.push_back(decay_template{lifetimes});
+	unit_widths.push_back(0);
+	par_values.push_back(0);
+	par_fixed.push_back(false);
+	basis.clear();
+	return par;
+}
+
+int DecayTimeFit::AddConstant(std::string name, double unit_width){
+	if(par_numbers.count(name)){
+		std::cerr<<"DecayTimeFit::AddConstant error! Component "<<name<<" already exists"<<std::endl;
+		return -1;
+	}
+	int par = par_names.size();
+	par_numbers.emplace(name,par);
+	par_names.push_back(name);
+	templates.push_back(decay_template{});
+	unit_widths.push_back(unit_width);
+	par_values.push_back(0);
+	par_fixed.push_back(false);
+	basis.clear();
+	return par;
+}
+
+int DecayTimeFit::GetParNumber(std::string name) const {
+	auto it = par_numbers.find(name);
+	return (it==par_numbers.end()) ? -1 : it->second;
+}
+
+void DecayTimeFit::SetParameter(int par, double value){
+	par_values.at(par) = value;
+}
+
+void DecayTimeFit::FixParameter(int par, double value){
+	par_values.at(par) = value;
+	par_fixed.at(par) = true;
+}
+
+void DecayTimeFit::ReleaseParameter(int par){
+	par_fixed.at(par) = false;
+}
+
+double DecayTimeFit::GetParError(int par) const {
+	if(par<0 || size_t(par)>=best_result.errors.size()) return 0;
+	return best_result.errors.at(par);
+}
+
+double DecayTimeFit::Density(double t, const std::vector<double>& pars) const {
+	double sum=0;
+	for(size_t p=0; p<par_names.size(); ++p){
+		sum += (templates[p].lifetimes.empty()) ? pars.at(p)/unit_widths[p] : pars.at(p)*templates[p].Density(t);
+	}
+	return sum;
+}
+
+void DecayTimeFit::SetRange(double lo, double hi){
+	range_lo = lo;
+	range_hi = hi;
+	use_range = true;
+	basis.clear();
+}
+
+void DecayTimeFit::SetMinimizer(std::string type, std::string algorithm){
+	minimizer_type = type;
+	minimizer_algorithm = algorithm;
+	for(ROOT::Math::Minimizer* aminimizer : minimizers) delete aminimizer;
+	minimizers.clear();
+}
+
+bool DecayTimeFit::BuildBasis(){
+	if(!basis.empty()) return true;
+	if(data_counts.empty() || par_names.empty()){
+		std::cerr<<"DecayTimeFit::BuildBasis error! No data or no model components"<<std::endl;
+		return false;
+	}
+	// as for TH1::Fit with the 'R' option, use all bins with centres inside the fit range
+	size_t nbins = data_counts.size();
+	first_bin = 0;
+	size_t last_bin = nbins;
+	if(use_range){
+		while(first_bin<nbins && 0.5*(edges[first_bin]+edges[first_bin+1])<range_lo) ++first_bin;
+		last_bin = first_bin;
+		while(last_bin<nbins && 0.5*(edges[last_bin]+edges[last_bin+1])<=range_hi) ++last_bin;
+	}
+	n_range_bins = last_bin - first_bin;
+	if(n_range_bins==0){
+		std::cerr<<"DecayTimeFit::BuildBasis error! No bins in fit range "<<range_lo
+		         <<" to "<<range_hi<<std::endl;
+		return false;
+	}
+
+	basis.resize(par_names.size()*n_range_bins);
+	for(size_t p=0; p<par_names.size(); ++p){
+		double* row = basis.data() + p*n_range_bins;
+		const decay_template& atemplate = templates[p];
+		for(size_t i=0; i<n_range_bins; ++i){
+			const double lo = edges[first_bin+i];
+			const double hi = edges[first_bin+i+1];
+			row[i] = (atemplate.lifetimes.empty()) ? (hi-lo)/unit_widths[p] : atemplate(lo,hi);
+		}
+	}
+	return true;
+}
+
+int DecayTimeFit::PrepareMinimizers(int nworkers){
+	// TMinuit-based minimizers share global state, so can only be used one at a time
+	if(nworkers>1 && minimizer_type!="Minuit2"){
+		if(verbosity){
+			std::cerr<<"DecayTimeFit warning! Minimizer "<<minimizer_type<<" is not thread-safe, "
+			         <<"running fits serially"<<std::endl;
+		}
+		nworkers=1;
+	}
+	if(nworkers>1) ROOT::EnableThreadSafety();
+	// creation goes via the plugin manager, which we must not call concurrently
+	while(minimizers.size()<size_t(nworkers)){
+		ROOT::Math::Minimizer* aminimizer =
+			ROOT::Math::Factory::CreateMinimizer(minimizer_type, minimizer_algorithm);
+		if(aminimizer==nullptr){
+			std::cerr<<"DecayTimeFit error! Failed to create minimizer "<<minimizer_type
+			         <<" "<<minimizer_algorithm<<std::endl;
+			break;
+		}
+		aminimizer->SetPrintLevel((verbosity>3 && nworkers==1) ? 1 : 0);
+		aminimizer->SetStrategy(1);
+		aminimizer->SetMaxFunctionCalls(100000);
+		aminimizer->SetTolerance(0.01);
+		minimizers.push_back(aminimizer);
+	}
+	return std::min(int(minimizers.size()), nworkers);
+}
+
+std::vector<double> DecayTimeFit::MakeStartPoint(int start_i, const std::vector<double>& counts) const {
+	// the first start uses the current parameter values. Floating parameters that have no
+	// meaningful value yet get an equal share of the events in the fit range.
+	double total=0;
+	for(const double& acount : counts) total += acount;
+	int nfree=0;
+	for(size_t p=0; p<par_names.size(); ++p) if(!par_fixed[p]) ++nfree;
+
+	std::vector<double> start = par_values;
+	TRandom3 rng(seed+start_i);
+	for(size_t p=0; p<par_names.size(); ++p){
+		if(par_fixed[p]) continue;
+		if(start[p]<=0){
+			double sum_basis=0;
+			const double* row = basis.data() + p*n_range_bins;
+			for(size_t i=0; i<n_range_bins; ++i) sum_basis += row[i];
+			start[p] = (sum_basis>0 && nfree>0) ? total/(nfree*sum_basis) : 1.;
+		}
+		// subsequent starts scatter each parameter log-normally by up to a factor of a few
+		if(start_i>0) start[p] *= std::exp(rng.Gaus(0,1));
+	}
+	return start;
+}
+
+bool DecayTimeFit::Minimize(ROOT::Math::Minimizer* minimizer, const std::vector<double>& counts,
+                            const std::vector<double>& start, decay_fit_result& result) const {
+	// SetFunction hands Minuit2 a clone, which points into basis and counts (e.g. a bootstrap
+	// replica) rather than copying them, so counts need only outlive this call
+	PoissonDecayNLL nll(basis.data(), counts.data(), n_range_bins, par_names.size());
+	minimizer->Clear();
+	minimizer->SetErrorDef(1.);  // -2lnL
+	minimizer->SetFunction(nll);
+	result.nfree=0;
+	for(size_t p=0; p<par_names.size(); ++p){
+		if(par_fixed[p]){
+			minimizer->SetFixedVariable(p, par_names[p], start[p]);
+		} else {
+			// amplitudes are physically non-negative. Don't start on the limit.
+			double startval = std::max(start[p], 1E-3);
+			minimizer->SetLowerLimitedVariable(p, par_names[p], startval, 0.1*startval, 0.);
+			++result.nfree;
+		}
+	}
+
+	bool ok = minimizer->Minimize();
+	if(ok) ok = minimizer->Hesse();
+
+	result.values.assign(minimizer->X(), minimizer->X()+par_names.size());
+	if(minimizer->Errors()!=nullptr){
+		result.errors.assign(minimizer->Errors(), minimizer->Errors()+par_names.size());
+	} else {
+		result.errors.assign(par_names.size(), 0.);
+	}
+	result.nll = minimizer->MinValue();
+	result.edm = minimizer->Edm();
+	result.status = minimizer->Status();
+	result.nbins = n_range_bins;
+	return ok;
+}
+
+bool DecayTimeFit::Fit(){
+	if(!BuildBasis()) return false;
+	int nworkers = PrepareMinimizers(std::min(nthreads,nstarts));
+	if(nworkers==0) return false;
+
+	const std::vector<double> counts(data_counts.begin()+first_bin, data_counts.begin()+first_bin+n_range_bins);
+	std::vector<decay_fit_result> results(nstarts);
+	ParallelFor(nstarts, nworkers, [&](size_t start_i, int thread_i){
+		Minimize(minimizers.at(thread_i), counts, MakeStartPoint(start_i, counts), results.at(start_i));
+		results.at(start_i).start = start_i;
+	});
+
+	// keep the lowest converged minimum, or the lowest of any if none converged
+	int best=-1;
+	for(int pass=0; pass<2 && best<0; ++pass){
+		for(int start_i=0; start_i<nstarts; ++start_i){
+			if(pass==0 && results[start_i].status!=0) continue;
+			if(best<0 || results[start_i].nll<results[best].nll) best=start_i;
+		}
+	}
+	best_result = results.at(best);
+	par_values = best_result.values;
+
+	if(verbosity>1){
+		int nconverged=0;
+		for(const decay_fit_result& aresult : results) if(aresult.status==0) ++nconverged;
+		std::cout<<"DecayTimeFit: "<<nconverged<<"/"<<nstarts<<" starts converged, best -2lnL "
+		         <<best_result.nll<<" for "<<best_result.nbins<<" bins and "<<best_result.nfree
+		         <<" free parameters from start "<<best_result.start<<std::endl;
+	}
+	if(best_result.status!=0 && verbosity){
+		std::cerr<<"DecayTimeFit warning! No fit converged, best status "<<best_result.status<<std::endl;
+	}
+	return best_result.status==0;
+}
+
+std::vector<decay_fit_result> DecayTimeFit::RunToys(int ntoys, unsigned int toy_seed){
+	std::vector<decay_fit_result> results;
+	if(ntoys<=0 || !BuildBasis()) return results;
+	int nworkers = PrepareMinimizers(std::min(nthreads,ntoys));
+	if(nworkers==0) return results;
+
+	// toys are drawn from the model at the current parameter values, which also serve as the start point
+	const std::vector<double> truth = par_values;
+	std::vector<double> expected(n_range_bins,0.);
+	for(size_t p=0; p<par_names.size(); ++p){
+		const double* row = basis.data() + p*n_range_bins;
+		for(size_t i=0; i<n_range_bins; ++i) expected[i] += truth[p]*row[i];
+	}
+
+	results.resize(ntoys);
+	ParallelFor(ntoys, nworkers, [&](size_t toy_i, int thread_i){
+		// seed by toy number rather than thread, so the ensemble doesn't depend on the number of threads.
+		// TRandom3 treats a seed of 0 as 'random', so offset by one.
+		TRandom3 rng(toy_seed+toy_i+1);
+		std::vector<double> toy_counts(n_range_bins);
+		for(size_t i=0; i<n_range_bins; ++i) toy_counts[i] = rng.Poisson(expected[i]);
+		Minimize(minimizers.at(thread_i), toy_counts, truth, results.at(toy_i));
+		results.at(toy_i).start = 0;
+	});
+
+	if(verbosity>1){
+		int nconverged=0;
+		for(const decay_fit_result& aresult : results) if(aresult.status==0) ++nconverged;
+		std::cout<<"DecayTimeFit: "<<nconverged<<"/"<<ntoys<<" toy fits converged"<<std::endl;
+	}
+	return results;
+}
@@ -0,0 +1,134 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef DecayTimeFit_H
+#define DecayTimeFit_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+class TH1;
+namespace ROOT { namespace Math { class Minimizer; } }
+
+/**
+* \class DecayTimeFit
+*
+* Binned Poisson likelihood fit of a time distribution to a sum of exponential decays
+* with fixed lifetimes plus a flat background. Each component is a compiled functor
+* giving the expected fraction of its decays in a time bin, which is integrated exactly
+* over the bin rather than evaluated at the bin centre. Since the model is linear in
+* the amplitudes these are evaluated once per fit range into a (parameter x bin) matrix,
+* and the likelihood and its analytic gradient reduce to a few vectorisable loops.
+*
+* Fits may use several randomised starting points, minimised concurrently,
+* and the lowest minimum is kept. Toy datasets may be drawn from the fitted model
+* and refit concurrently for coverage and bias studies.
+* Amplitudes are the total number of decays of each component (integrated over all time),
+* and the constant is given in events per 'unit width' of time (e.g. events per histogram bin width).
+*
+* $Author: M.O'Flaherty $
+* $Date: 2019/05/28 $
+* Contact: marcus.o-flaherty@warwick.ac.uk
+*/
+
+// one component of the decay time distribution. A single isotope has one lifetime,
+// a degenerate pair shares its amplitude equally between two lifetimes.
+struct decay_template {
+	std::vector<double> lifetimes;
+	// fraction of all decays with decay time in [lo,hi)
+	double operator()(double lo, double hi) const;
+	// decays per unit time at time t, per unit amplitude
+	double Density(double t) const;
+};
+
+struct decay_fit_result {
+	std::vector<double> values;
+	std::vector<double> errors;
+	double nll=0;        // -2lnL relative to a saturated model, i.e. a Poisson chi2
+	double edm=0;
+	int status=-1;       // minimizer status, 0 for a successful fit
+	int start=-1;        // which starting point gave this minimum
+	int nbins=0;         // number of bins in the fit range
+	int nfree=0;         // number of floating parameters
+};
+
+class DecayTimeFit {
+
+	public:
+	DecayTimeFit(){};
+	~DecayTimeFit();
+	DecayTimeFit(const DecayTimeFit&)=delete;
+	DecayTimeFit& operator=(const DecayTimeFit&)=delete;
+
+	// data. Counts must be raw (unweighted, unscaled) numbers of entries per bin.
+	bool SetData(const TH1& counts_hist);
+	bool SetData(const std::vector<double>& binedges, const std::vector<double>& counts);
+
+	// model
+	int AddComponent(std::string name, std::vector<double> lifetimes);
+	int AddConstant(std::string name, double unit_width=1.);
+	int GetParNumber(std::string name) const;
+	size_t GetNpar() const { return par_names.size(); }
+	const std::string& GetParName(int par) const { return par_names.at(par); }
+	void SetParameter(int par, double value);
+	void FixParameter(int par, double value);
+	void ReleaseParameter(int par);
+	double GetParameter(int par) const { return par_values.at(par); }
+	double GetParError(int par) const;
+	double Density(double t, const std::vector<double>& pars) const;
+
+	// fit configuration
+	void SetRange(double lo, double hi);
+	void SetNStarts(int nstarts_in){ nstarts=std::max(1,nstarts_in); }
+	void SetNThreads(int nthreads_in){ nthreads=std::max(1,nthreads_in); }
+	void SetSeed(unsigned int seed_in){ seed=seed_in; }
+	void SetMinimizer(std::string type, std::string algorithm="");
+	void SetVerbosity(int verb){ verbosity=verb; }
+
+	// fitting. On success parameter values are updated to the best fit.
+	bool Fit();
+	const decay_fit_result& GetResult() const { return best_result; }
+	// generate Poisson toys from the current parameter values and refit each in turn
+	std::vector<decay_fit_result> RunToys(int ntoys, unsigned int toy_seed);
+
+	private:
+	bool BuildBasis();
+	int PrepareMinimizers(int nworkers);
+	std::vector<double> MakeStartPoint(int start_i, const std::vector<double>& counts) const;
+	bool Minimize(ROOT::Math::Minimizer* minimizer, const std::vector<double>& counts,
+	              const std::vector<double>& start, decay_fit_result& result) const;
+
+	// data
+	std::vector<double> edges;
+	std::vector<double> data_counts;
+
+	// model
+	std::vector<std::string> par_names;
+	std::vector<decay_template> templates;   // empty lifetimes for constants
+	std::vector<double> unit_widths;         // for constants
+	std::vector<double> par_values;
+	std::vector<bool> par_fixed;
+	std::map<std::string,int> par_numbers;
+
+	// fit range, and the basis of per-bin expectations for bins within it
+	double range_lo=0;
+	double range_hi=0;
+	bool use_range=false;
+	size_t first_bin=0;
+	size_t n_range_bins=0;
+	std::vector<double> basis;               // [par*n_range_bins + bin]
+
+	// configuration
+	int nstarts=1;
+	int nthreads=1;
+	unsigned int seed=4357;
+	std::string minimizer_type="Minuit2";
+	std::string minimizer_algorithm="Migrad";
+	int verbosity=1;
+
+	decay_fit_result best_result;
+	std::vector<ROOT::Math::Minimizer*> minimizers;   // one per thread, reused between fits
+
+};
+
+#endif
@@ -6,6 +6,7 @@
 #include "type_name_as_string.h"
 #include "MTreeReader.h"
 #include "MTreeSelection.h"
+#include "DecayTimeFit.h"
 
 #include "TROOT.h"
 #include "TFile.h"
@@ -14,6 +15,7 @@
 #include "TColor.h"
 #include "TH1.h"
 #include "TF1.h"
+#include "TTree.h"
 #include "TFitResult.h"
 #include "TFitResultPtr.h"
 
@@ -129,6 +131,13 @@ bool FitSpallationDt::Initialise(std::string configfile, DataModel &data){
 	// two expontial terms with a shared amplitude, i.e. (A/2)*{exp(-t/t1)+exp(-t/t2)}
 	// or combine them into one term with an average lifetime, i.e. A*(exp(-t/{(t1+t2)*0.5}))
 	
+	// alternatively fit with a binned Poisson likelihood, rather than chi2 fits of TF1s
+	m_variables.Get("fitEngine",fitEngine);              // use DecayTimeFit rather than TH1::Fit
+	m_variables.Get("fitStarts",fitStarts);              // number of starting points for each fit
+	m_variables.Get("fitThreads",fitThreads);            // number of threads over which to run fits
+	m_variables.Get("nToys",nToys);                      // number of toy datasets to generate and refit
+	m_variables.Get("toySeed",toySeed);                  // seed for toy generation
+	
 	// energy threshold efficiencies, from FLUKA
 	m_variables.Get("efficienciesFile",efficienciesFile);
 	
@@ -325,6 +334,10 @@ bool FitSpallationDt::PlotSpallationDt(){
 		if(aval>0) dt_mu_lowe_rand_hist_log.Fill(aval);
 		else       dt_mu_lowe_hist_log.Fill(fabs(aval));
 	}
+	// the likelihood fit needs the raw number of events in each bin, so keep a copy before scaling
+	TH1F dt_mu_lowe_hist_log_raw(dt_mu_lowe_hist_log);
+	dt_mu_lowe_hist_log_raw.SetName("dt_mu_lowe_hist_log_raw");
+	dt_mu_lowe_hist_log_raw.SetDirectory(nullptr);
 	// Since we used different bin widths, to have a consistent y axis
 	// (events per fixed time interval) we need to scale each bin's contents by its bin width
 	for(int bini=1; bini<dt_mu_lowe_hist_log.GetNbinsX()+1; ++bini){
@@ -369,9 +382,22 @@ bool FitSpallationDt::PlotSpallationDt(){
 //	the_hist_to_fit->Draw();
 //	gPad->WaitPrimitive();
 	
+	// the likelihood fit can only be used with raw counts, so not with random-subtracted
+	// histograms or externally provided (scaled) histograms. Nor does it support the 'hack'.
+	if(fitEngine && (random_subtract || laurasfile!="" || useHack)){
+		Log(m_unique_name+" Warning! fitEngine cannot be used with random_subtract, laurasfile or useHack;"
+			" using TF1 chi2 fits",v_warning,m_verbose);
+		fitEngine=false;
+	}
+	
 	// Now we have our histogram, fit it!
 	// we do the fitting in 5 stages, initially fitting sub-ranges of the distribution
-	for(int i=0; i<5; ++i) FitDtDistribution(*the_hist_to_fit, i);
+	if(fitEngine){
+		TH1* raw_counts_hist = (binning_type==0) ? (TH1*)&dt_mu_lowe_hist_log_raw : (TH1*)&dt_mu_lowe_hist;
+		FitDtDistributionEngine(*raw_counts_hist, *the_hist_to_fit);
+	} else {
+		for(int i=0; i<5; ++i) FitDtDistribution(*the_hist_to_fit, i);
+	}
 	
 	// the production rate integrated over the whole energy range is given by:
 	// Ri = Ni / (FV * T * eff_i)
@@ -811,6 +837,152 @@ bool FitSpallationDt::FitDtDistribution(TH1& dt_mu_lowe_hist, int rangenum){
 	return true;
 }
 
+bool FitSpallationDt::FitDtDistributionEngine(TH1& raw_counts_hist, TH1& dt_mu_lowe_hist){
+	/* As FitDtDistribution, but performing all five stages with DecayTimeFit:
+	   a binned Poisson likelihood of the raw bin counts, with the decay components
+	   integrated over each bin and analytic gradients. Each stage is minimised from
+	   several starting points (concurrently if fitThreads>1) and the best minimum is kept.
+	   Optionally toy datasets are then generated from the final fit and refit.
+	*/
+	
+	DecayTimeFit engine;
+	engine.SetVerbosity(m_verbose);
+	engine.SetNStarts(fitStarts);
+	engine.SetNThreads(fitThreads);
+	engine.SetSeed(toySeed);
+	if(!engine.SetData(raw_counts_hist)){
+		Log(m_unique_name+" Error setting data for likelihood fit",v_error,m_verbose);
+		return false;
+	}
+	
+	// build the model. Amplitudes are numbers of events, as with BuildFunction,
+	// and the constant is in events per binwidth, as in the TF1 fits.
+	const std::vector<std::string> isotopes{"12B","12N","16N","11Be","9Li","8He_9C","8Li_8B","15C"};
+	for(const std::string& anisotope : isotopes){
+		std::vector<double> isotope_lifetimes;
+		if(split_iso_pairs && anisotope.find("_")!=std::string::npos){
+			isotope_lifetimes.push_back(lifetimes.at(anisotope.substr(0,anisotope.find_first_of("_"))));
+			isotope_lifetimes.push_back(lifetimes.at(anisotope.substr(anisotope.find_first_of("_")+1)));
+		} else {
+			isotope_lifetimes.push_back(lifetimes.at(anisotope));
+		}
+		engine.AddComponent(anisotope, isotope_lifetimes);
+	}
+	int const_par = engine.AddConstant("const", binwidth);
+	
+	// the same sequence of fits as in FitDtDistribution: components not used in a stage are
+	// fixed to zero, those from previous stages fixed to their results, and new ones floated
+	struct fit_stage {
+		double range_min;
+		double range_max;
+		std::vector<std::string> floating;
+		std::vector<std::string> fixed;
+	};
+	const std::vector<fit_stage> stages{
+		{50e-6, 0.1, {"12B","12N"}, {}},
+		{6, 30, {"16N","11Be"}, {}},
+		{0.1, 0.8, {"9Li","8He_9C","8Li_8B"}, {"12B","12N","16N","11Be"}},
+		{0.8, 6, {"15C","16N"}, {"12B","12N","11Be","9Li","8He_9C","8Li_8B"}},
+		{0, 30, isotopes, {}}
+	};
+	
+	for(size_t stage_i=0; stage_i<stages.size(); ++stage_i){
+		const fit_stage& stage = stages.at(stage_i);
+		for(const std::string& anisotope : isotopes){
+			engine.FixParameter(engine.GetParNumber(anisotope),0);
+		}
+		for(const std::string& anisotope : stage.fixed){
+			engine.FixParameter(engine.GetParNumber(anisotope),fit_amps.at(anisotope));
+		}
+		for(const std::string& anisotope : stage.floating){
+			int par_number = engine.GetParNumber(anisotope);
+			engine.SetParameter(par_number,(fit_amps.count(anisotope)) ? fit_amps.at(anisotope) : 0.);
+			engine.ReleaseParameter(par_number);
+		}
+		if(fix_const) engine.FixParameter(const_par,0);
+		else engine.ReleaseParameter(const_par);
+		engine.SetRange(stage.range_min, stage.range_max);
+		
+		Log(m_unique_name+" doing likelihood fit stage "+toString(stage_i),v_debug,m_verbose);
+		bool fit_ok = engine.Fit();
+		const decay_fit_result& result = engine.GetResult();
+		if(!fit_ok){
+			Log(m_unique_name+" Warning! Likelihood fit stage "+toString(stage_i)+" did not converge, status "
+				+toString(result.status),v_warning,m_verbose);
+		}
+		
+		// record the results for the next step
+		for(const std::string& anisotope : stage.floating){
+			PushFitAmp(engine.GetParameter(engine.GetParNumber(anisotope)),anisotope);
+		}
+		fit_amps["const_"+toString(stage_i)] = engine.GetParameter(const_par);
+		if(m_verbose){
+			std::cout<<"stage "<<stage_i<<" -2lnL/NDOF = "<<result.nll<<"/"<<(result.nbins-result.nfree)
+					 <<", recorded results were: "<<std::endl;
+			for(const std::string& anisotope : stage.floating){
+				int par_number = engine.GetParNumber(anisotope);
+				std::cout<<anisotope<<": "<<engine.GetParameter(par_number)
+						 <<" +- "<<engine.GetParError(par_number)<<std::endl;
+			}
+			std::cout<<"const_"<<stage_i<<": "<<fit_amps["const_"+toString(stage_i)]<<std::endl;
+		}
+	}
+	
+	// attach the final result to the histogram and save it
+	TF1 func_sum = BuildFunction(isotopes,0,30);
+	func_sum.SetLineColor(kRed);
+	for(const std::string& anisotope : isotopes) PullFitAmp(func_sum,anisotope);
+	PullFitAmp(func_sum,"const_4");
+	dt_mu_lowe_hist.GetListOfFunctions()->Add(func_sum.Clone());
+	dt_mu_lowe_hist.Write("dt_mu_lowe_hist_fit");
+	dt_mu_lowe_hist.GetListOfFunctions()->Clear();
+	
+	// generate and fit toy datasets from the final fit, for coverage studies
+	if(nToys>0) WriteToys(engine, nToys);
+	
+	return true;
+}
+
+bool FitSpallationDt::WriteToys(DecayTimeFit& engine, int ntoys){
+	// refit toy datasets drawn from the engine's current parameters, and save the fit
+	// results, errors and true values of each parameter to a TTree
+	Log(m_unique_name+" generating and fitting "+toString(ntoys)+" toy datasets",v_debug,m_verbose);
+	std::vector<decay_fit_result> toy_results = engine.RunToys(ntoys, toySeed);
+	
+	const size_t npars = engine.GetNpar();
+	std::vector<double> truth(npars), values(npars), errors(npars);
+	double nll;
+	int status;
+	TTree toytree("dt_fit_toys","Likelihood fits to toy dt distributions");
+	toytree.Branch("nll",&nll);
+	toytree.Branch("status",&status);
+	for(size_t pari=0; pari<npars; ++pari){
+		// TTree::Draw doesn't like branch names starting with a number
+		std::string parname = engine.GetParName(pari);
+		if(parname!="const") parname = "amp_"+parname;
+		truth.at(pari) = engine.GetParameter(pari);
+		toytree.Branch(parname.c_str(),&values.at(pari));
+		toytree.Branch((parname+"_err").c_str(),&errors.at(pari));
+		toytree.Branch((parname+"_true").c_str(),&truth.at(pari));
+	}
+	
+	int nconverged=0;
+	for(const decay_fit_result& aresult : toy_results){
+		// copy rather than assign, so the branch addresses remain valid
+		std::copy(aresult.values.begin(), aresult.values.end(), values.begin());
+		std::copy(aresult.errors.begin(), aresult.errors.end(), errors.begin());
+		nll = aresult.nll;
+		status = aresult.status;
+		if(status==0) ++nconverged;
+		toytree.Fill();
+	}
+	toytree.Write();
+	Log(m_unique_name+" "+toString(nconverged)+" of "+toString(ntoys)+" toy fits converged",
+		v_message,m_verbose);
+	
+	return true;
+}
+
 // =========================================================================
 // =========================================================================
 
@@ -13,6 +13,7 @@
 
 class TH1;
 class TF1;
+class DecayTimeFit;
 class MTreeReader;
 class MTreeSelection;
 
@@ -43,6 +44,8 @@ class FitSpallationDt: public Tool {
 	bool GetEnergyCutEfficiencies();
 	bool PlotSpallationDt();
 	bool FitDtDistribution(TH1& dt_mu_lowe_hist_short, int rangenum);
+	bool FitDtDistributionEngine(TH1& raw_counts_hist, TH1& dt_mu_lowe_hist);
+	bool WriteToys(DecayTimeFit& engine, int ntoys);
 	// helper functions used in FitSpallationDt
 	std::vector<double> MakeLogBins(double xmin, double xmax, int nbins);
 	void FixLifetime(TF1& func, std::string isotope);
@@ -84,6 +87,13 @@ class FitSpallationDt: public Tool {
 	int binning_type=0;
 	bool random_subtract=false;
 	
+	// likelihood fitting engine
+	bool fitEngine=false;
+	int fitStarts=8;
+	int fitThreads=1;
+	int nToys=0;
+	int toySeed=0;
+	
 	// energy threshold comparison
 	// ===========================
 	std::map<std::string, double> true_effs_6mev;
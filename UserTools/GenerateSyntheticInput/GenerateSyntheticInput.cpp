@@ -0,0 +1,251 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "GenerateSyntheticInput.h"
+
+#include <cmath>
+#include <algorithm>
+#include <memory>
+#include <sys/stat.h>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TMath.h"
+
+#include "SkrootHeaders.h"  // Header, LoweInfo
+#include "skheadC.h"       // COUNT_PER_NSEC
+
+namespace {
+
+// the per-candidate branches of SK2p2MeV output, with rough distributions for their values
+struct candidate_variable {
+	const char* name;
+	char type;      // 'F' float or 'I' int
+	char dist;      // 'G' gaussian(p1, p2), 'U' uniform(p1, p2), 'P' poisson(p1)
+	double p1;
+	double p2;
+};
+
+const std::vector<candidate_variable> candidate_variables{
+	{"N10",       'I', 'P', 6,     0},
+	{"N200",      'I', 'P', 20,    0},
+	{"N10d",      'I', 'P', 6,     0},
+	{"Nc",        'I', 'P', 2,     0},
+	{"Nback",     'I', 'P', 30,    0},
+	{"N300",      'I', 'P', 25,    0},
+	{"trms",      'F', 'G', 3.,    1.},
+	{"trmsdiff",  'F', 'G', 0.,    1.},
+	{"fpdist",    'F', 'G', 300.,  150.},
+	{"bpdist",    'F', 'G', 300.,  150.},
+	{"fwall",     'F', 'U', 0.,    1690.},
+	{"bwall",     'F', 'U', 0.,    1690.},
+	{"pvx",       'F', 'U', -1490, 1490},
+	{"pvy",       'F', 'U', -1490, 1490},
+	{"pvz",       'F', 'U', -1610, 1610},
+	{"bse",       'F', 'G', 2.,    1.},
+	{"mintrms_3", 'F', 'G', 1.5,   0.5},
+	{"mintrms_6", 'F', 'G', 2.5,   0.8},
+	{"Q10",       'F', 'G', 7.,    3.},
+	{"Qrms",      'F', 'G', 0.8,   0.3},
+	{"Qmean",     'F', 'G', 1.2,   0.3},
+	{"thetarms",  'F', 'G', 0.5,   0.15},
+	{"NLowtheta", 'I', 'P', 1,     0},
+	{"phirms",    'F', 'G', 1.5,   0.4},
+	{"bsdirks",   'F', 'G', 0.4,   0.15},
+	{"thetam",    'F', 'G', 0.7,   0.2},
+	{"dt",        'F', 'U', 18000, 535000},   // ns from the primary
+	{"dtn",       'F', 'U', 0,     535000},
+	{"nvx",       'F', 'U', -1490, 1490},
+	{"nvy",       'F', 'U', -1490, 1490},
+	{"nvz",       'F', 'U', -1610, 1610},
+	{"tindex",    'I', 'U', 0,     50000},
+	{"n40index",  'I', 'U', 0,     50000},
+	{"Neff",      'I', 'P', 7,     0},
+	{"ratio",     'F', 'U', 0.,    1.},
+	{"Nc1",       'I', 'P', 2,     0},
+	{"NhighQ",    'I', 'P', 1,     0},
+	{"NlowQ",     'I', 'P', 5,     0},
+	{"Nlow1",     'I', 'P', 2,     0},
+	{"Nlow2",     'I', 'P', 2,     0},
+	{"Nlow3",     'I', 'P', 2,     0},
+	{"Nlow4",     'I', 'P', 2,     0},
+	{"Nlow5",     'I', 'P', 2,     0},
+	{"Nlow6",     'I', 'P', 2,     0},
+	{"Nlow7",     'I', 'P', 2,     0},
+	{"Nlow8",     'I', 'P', 2,     0},
+	{"Nlow9",     'I', 'P', 2,     0}
+};
+
+// added by ntag_BDT
+const std::vector<candidate_variable> bdt_variables{
+	{"neutron5",  'F', 'U', 0.,    1.},
+	{"nlow",      'I', 'P', 2,     0}
+};
+
+} // end anonymous namespace
+
+GenerateSyntheticInput::GenerateSyntheticInput():Tool(){}
+
+bool GenerateSyntheticInput::Initialise(std::string configfile, DataModel &data){
+
+	if(configfile!="")  m_variables.Initialise(configfile);
+	//m_variables.Print();
+
+	m_data= &data;
+	m_log= m_data->Log;
+
+	if(!m_variables.Get("verbosity",m_verbose)) m_verbose=1;
+
+	m_variables.Get("outputFile",outputFile);
+	m_variables.Get("treeName",treeName);
+	m_variables.Get("nEntries",nEntries);
+	m_variables.Get("meanCandidates",meanCandidates);
+	m_variables.Get("maxCandidates",maxCandidates);
+	m_variables.Get("seed",seed);
+	m_variables.Get("withBDT",withBDT);
+	m_variables.Get("overwrite",overwrite);
+
+	// the file is made here so that it is ready for downstream TreeReaders to open in their Initialise
+	struct stat info;
+	if(!overwrite && stat(outputFile.c_str(), &info)==0){
+		Log(m_unique_name+" using existing file "+outputFile+"; set 'overwrite 1' to regenerate it",
+		    v_message,m_verbose);
+		return true;
+	}
+
+	Log(m_unique_name+" writing "+toString(nEntries)+" synthetic entries to "+outputFile,v_message,m_verbose);
+	if(!WriteFile()){
+		Log(m_unique_name+" error! Failed to write "+outputFile,v_error,m_verbose);
+		m_data->vars.Set("StopLoop",1);
+		return false;
+	}
+
+	return true;
+}
+
+
+bool GenerateSyntheticInput::Execute(){
+
+	return true;
+}
+
+
+bool GenerateSyntheticInput::Finalise(){
+
+	return true;
+}
+
+bool GenerateSyntheticInput::WriteFile(){
+
+	std::unique_ptr<TFile> outfile(TFile::Open(outputFile.c_str(),"RECREATE"));
+	if(!outfile || outfile->IsZombie()) return false;
+	TTree* tree = new TTree(treeName.c_str(), treeName.c_str());
+
+	rng.seed(seed);
+	header = new Header;
+	lowe = new LoweInfo;
+	MakeBranches(tree);
+
+	for(long entry_i=0; entry_i<nEntries; ++entry_i){
+		GenerateEntry(entry_i);
+		tree->Fill();
+		if(entry_i>0 && (entry_i%100000)==0){
+			Log(m_unique_name+" generated "+toString(entry_i)+" entries",v_debug,m_verbose);
+		}
+	}
+
+	bool ok = (tree->Write()>0);
+	tree->ResetBranchAddresses();
+	outfile->Close();
+	delete header;
+	delete lowe;
+	header=nullptr;
+	lowe=nullptr;
+
+	return ok;
+}
+
+void GenerateSyntheticInput::MakeBranches(TTree* tree){
+
+	tree->Branch("HEADER", &header);
+	tree->Branch("LOWE", &lowe);
+	tree->Branch("np", &np, "np/I");
+	tree->Branch("N200M", &N200M, "N200M/I");
+	tree->Branch("T200M", &T200M, "T200M/F");
+
+	std::vector<candidate_variable> variables = candidate_variables;
+	if(withBDT) variables.insert(variables.end(), bdt_variables.begin(), bdt_variables.end());
+
+	// reserve first, so that the branch addresses don't change as we add arrays
+	float_arrays.clear();
+	int_arrays.clear();
+	float_arrays.reserve(variables.size());
+	int_arrays.reserve(variables.size());
+	for(const candidate_variable& avar : variables){
+		std::string leaflist = std::string(avar.name)+"[np]/"+avar.type;
+		if(avar.type=='F'){
+			float_arrays.emplace_back(maxCandidates);
+			tree->Branch(avar.name, float_arrays.back().data(), leaflist.c_str());
+		} else {
+			int_arrays.emplace_back(maxCandidates);
+			tree->Branch(avar.name, int_arrays.back().data(), leaflist.c_str());
+		}
+	}
+
+	tree->Branch("nhits", &nhits, "nhits/I");
+}
+
+void GenerateSyntheticInput::GenerateEntry(long entry_num){
+
+	std::uniform_real_distribution<double> uniform(0., 1.);
+
+	// 10 Hz of triggers, 1000 per subrun and 100 subruns per run
+	ticks += int64_t(-std::log(1.-uniform(rng))*0.1*1E9*COUNT_PER_NSEC);
+	header->nrunsk = 80000 + entry_num/100000;
+	header->nsubsk = (entry_num/1000)%100;
+	header->nevsk = entry_num;
+	header->idtgsk = (1<<0) | (1<<1) | (1<<28);    // LE, HE, SHE
+	header->ifevsk = 0;
+	header->counter_32 = int32_t((ticks>>32)<<17);
+	header->t0 = int32_t(ticks & 0xFFFFFFFF);
+
+	// prompt event: falling energy spectrum above 3.5 MeV, uniform in the inner detector
+	lowe->bsenergy = 3.5 + std::exponential_distribution<double>(1./3.)(rng);
+	const double r = 1690.*std::sqrt(uniform(rng));
+	const double phi = 2.*TMath::Pi()*uniform(rng);
+	lowe->bsvertex[0] = r*std::cos(phi);
+	lowe->bsvertex[1] = r*std::sin(phi);
+	lowe->bsvertex[2] = 1810.*(2.*uniform(rng)-1.);
+	lowe->bsvertex[3] = 1000.;
+	const double costheta = 2.*uniform(rng)-1.;
+	const double dirphi = 2.*TMath::Pi()*uniform(rng);
+	const double sintheta = std::sqrt(1.-costheta*costheta);
+	lowe->bsdir[0] = sintheta*std::cos(dirphi);
+	lowe->bsdir[1] = sintheta*std::sin(dirphi);
+	lowe->bsdir[2] = costheta;
+	lowe->bsgood[1] = 0.3+0.6*uniform(rng);
+	lowe->bsn50 = std::poisson_distribution<int>(6.*lowe->bsenergy)(rng);
+	nhits = lowe->bsn50 + std::poisson_distribution<int>(10)(rng);
+	N200M = std::poisson_distribution<int>(1)(rng);
+	T200M = 535000.*uniform(rng);
+
+	// neutron candidates
+	np = std::min(maxCandidates, std::poisson_distribution<int>(meanCandidates)(rng));
+	size_t float_i=0, int_i=0;
+	for(const std::vector<candidate_variable>* variables : {&candidate_variables, &bdt_variables}){
+		if(variables==&bdt_variables && !withBDT) break;
+		for(const candidate_variable& avar : *variables){
+			for(int cand_i=0; cand_i<np; ++cand_i){
+				double val=0;
+				switch(avar.dist){
+					case 'G': val = std::normal_distribution<double>(avar.p1, avar.p2)(rng); break;
+					case 'U': val = avar.p1 + (avar.p2-avar.p1)*uniform(rng); break;
+					case 'P': val = std::poisson_distribution<int>(avar.p1)(rng); break;
+				}
+				if(avar.type=='F') float_arrays[float_i][cand_i] = val;
+				else int_arrays[int_i][cand_i] = int(val);
+			}
+			if(avar.type=='F') ++float_i;
+			else ++int_i;
+		}
+	}
+
+}
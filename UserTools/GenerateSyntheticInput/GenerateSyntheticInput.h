@@ -0,0 +1,63 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef GenerateSyntheticInput_H
+#define GenerateSyntheticInput_H
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <random>
+
+#include "Tool.h"
+
+class TTree;
+class Header;
+class LoweInfo;
+
+/**
+* \class GenerateSyntheticInput
+*
+* Writes a ROOT file of random events with the branch layout of SK2p2MeV output
+* (optionally with the neutron5 and nlow branches added by ntag_BDT), so that ToolChains
+* reading such files can be run and benchmarked without any SK data or MC files.
+*/
+
+class GenerateSyntheticInput: public Tool {
+
+	public:
+
+	GenerateSyntheticInput();
+	bool Initialise(std::string configfile,DataModel &data);
+	bool Execute();
+	bool Finalise();
+
+	private:
+	bool WriteFile();
+	void MakeBranches(TTree* tree);
+	void GenerateEntry(long entry_num);
+
+	std::string outputFile="synthetic_sk2p2.root";
+	std::string treeName="sk2p2";
+	long nEntries=100000;
+	double meanCandidates=20;     // per entry
+	int maxCandidates=500;
+	unsigned int seed=12345;
+	bool withBDT=true;            // add the ntag_BDT output branches
+	bool overwrite=false;         // regenerate even if outputFile already exists
+
+	std::mt19937 rng;
+
+	// branch variables
+	Header* header=nullptr;
+	LoweInfo* lowe=nullptr;
+	int np=0;
+	int nhits=0;
+	int N200M=0;
+	float T200M=0;
+	std::vector<std::vector<float>> float_arrays;  // per candidate, one per branch
+	std::vector<std::vector<int>> int_arrays;
+	int64_t ticks=0;              // trigger clock
+
+};
+
+
+#endif
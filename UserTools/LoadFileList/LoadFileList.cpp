@@ -22,6 +22,10 @@ bool LoadFileList::Initialise(std::string configfile, DataModel &data){
 	m_variables.Get("filePattern",filePattern);       // a pattern to match files in input directory
 	m_variables.Get("useRegex",useRegex);             // is the pattern a glob or a regex
 	m_variables.Get("FileListName",FileListName);     // what key to use to store the list in the CStore
+	m_variables.Get("maxSubdirDepth",maxSubdirDepth); // levels of subdirectories to search, 0 for all
+	m_variables.Get("catalogueFile",catalogueFile);   // a cached listing of inputDirectory
+	m_variables.Get("catalogueTreeName",catalogueTreeName); // tree whose entries to record in the catalogue
+	m_variables.Get("scanThreads",scanThreads);       // threads with which to read directories
 	int maxFiles=0;
 	m_variables.Get("maxFiles",maxFiles);             // max num files to add
 	
@@ -82,10 +86,31 @@ int LoadFileList::GetFileList(){
 		+" that match pattern '"+filePattern+"'",v_debug,m_verbose);
 	
 	// This function is in DataModel/FindFilesInDirectory.cpp
-	// int FindFilesInDirectory(std::string inputdir, std::string pattern, std::vector<std::string> &matches, bool case_sensitive=false, int max_subdir_depth=0, bool use_regex=false, std::vector<std::string>* filenames=nullptr, std::vector<std::vector<std::string>>* output_submatches=nullptr, bool verbose=false);
 	bool case_sensitive = false;  // case insensitive (default false)
-	int max_subdir_depth=1;       // this dir only, 0: all the way down (default 0)
-	int num_files = FindFilesInDirectory(inputDirectory, filePattern, list_of_files, case_sensitive, max_subdir_depth, useRegex, nullptr, nullptr, (m_verbose>=v_debug));
+	
+	// reuse the listing of the directory from the catalogue if nothing has changed
+	FileCatalogue catalogue;
+	FileCatalogue* catalogue_p = nullptr;
+	if(catalogueFile!=""){
+		if(catalogue.Read(catalogueFile)){
+			Log(m_unique_name+" read file catalogue "+catalogueFile,v_debug,m_verbose);
+		}
+		catalogue_p = &catalogue;
+	}
+	int num_files = FindFilesInDirectory(inputDirectory, filePattern, list_of_files, case_sensitive, maxSubdirDepth, useRegex, nullptr, nullptr, (m_verbose>=v_debug), catalogue_p, scanThreads);
+	
+	if(catalogue_p){
+		Log(m_unique_name+" catalogue has "+toString(catalogue.GetNDirectories())+" directories, "
+			+toString(catalogue.GetNRescanned())+" of which were read",v_debug,m_verbose);
+		// record the entries of the matched files, so that later jobs need not open them to count them
+		if(catalogueTreeName!=""){
+			int ncounted = catalogue.CountEntries(catalogueTreeName, list_of_files, nullptr, scanThreads, (m_verbose>v_debug));
+			Log(m_unique_name+" counted entries of "+toString(ncounted)+" files",v_debug,m_verbose);
+		}
+		if(catalogue.Modified() && !catalogue.Write(catalogueFile)){
+			Log(m_unique_name+" warning! Failed to update file catalogue "+catalogueFile,v_warning,m_verbose);
+		}
+	}
 	
 	return num_files;
 }
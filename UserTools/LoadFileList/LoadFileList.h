@@ -37,6 +37,10 @@ class LoadFileList: public Tool {
 	std::string filePattern="";
 	bool useRegex=false;
 	std::string FileListName="InputFileList";
+	int maxSubdirDepth=0;
+	std::string catalogueFile="";
+	std::string catalogueTreeName="";
+	int scanThreads=0;
 	
 };
 
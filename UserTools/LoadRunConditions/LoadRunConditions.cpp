@@ -0,0 +1,59 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "LoadRunConditions.h"
+#include "RunConditions.h"
+
+#include <sstream>
+
+LoadRunConditions::LoadRunConditions():Tool(){}
+
+bool LoadRunConditions::Initialise(std::string configfile, DataModel &data){
+	
+	if(configfile!="")  m_variables.Initialise(configfile);
+	//m_variables.Print();
+	
+	m_data= &data;
+	m_log= m_data->Log;
+	
+	if(!m_variables.Get("verbosity",m_verbose)) m_verbose=1;
+	
+	std::string conditionsFiles="";
+	float minLivetime=-1;
+	m_variables.Get("conditionsFiles",conditionsFiles);
+	m_variables.Get("minLivetime",minLivetime);
+	
+	if(conditionsFiles==""){
+		Log(m_unique_name+" error! no conditionsFiles given",v_error,m_verbose);
+		m_data->vars.Set("StopLoop",1);
+		return false;
+	}
+	
+	// comma-separated list of files, loaded in order
+	RunConditions& conditions = m_data->runConditions;
+	std::stringstream files(conditionsFiles);
+	std::string filename;
+	while(std::getline(files, filename, ',')){
+		if(filename.empty()) continue;
+		Log(m_unique_name+" loading run conditions from "+filename,v_debug,m_verbose);
+		if(!conditions.Load(filename)){
+			Log(m_unique_name+" error! failed to load run conditions from "+filename,v_error,m_verbose);
+			m_data->vars.Set("StopLoop",1);
+			return false;
+		}
+	}
+	// overrides any min_livetime in the files
+	if(minLivetime>0) conditions.SetMinLivetime(minLivetime);
+	
+	return true;
+}
+
+
+bool LoadRunConditions::Execute(){
+	
+	return true;
+}
+
+
+bool LoadRunConditions::Finalise(){
+	
+	return true;
+}
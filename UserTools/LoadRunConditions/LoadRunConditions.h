@@ -0,0 +1,29 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef LoadRunConditions_H
+#define LoadRunConditions_H
+
+#include <string>
+#include <iostream>
+
+#include "Tool.h"
+
+/**
+* \class LoadRunConditions
+*
+* Loads per-run conditions (data quality flags, livetimes, energy thresholds...) from flat files
+* into m_data->runConditions, for use by TreeReader and cut Tools.
+*/
+
+class LoadRunConditions: public Tool {
+	
+	public:
+	
+	LoadRunConditions();
+	bool Initialise(std::string configfile,DataModel &data);
+	bool Execute();
+	bool Finalise();
+	
+};
+
+
+#endif
@@ -7,6 +7,8 @@
 // TODO run fh2h.pl on $SKOFL_ROOT/inc/softtrg_tblF.h and put it in $SKOFL_ROOT/inc
 
 #include <bitset>
+#include <algorithm>
+#include <cmath>
 
 MuonSearch::MuonSearch():Tool(){}
 
@@ -36,6 +38,16 @@ bool MuonSearch::Initialise(std::string configfile, DataModel &data){
 	// convert coincidence_threshold from ns to clock ticks for it0sk and swtrgt0ctr
 	coincidence_threshold *= COUNT_PER_NSEC;
 	
+	// by default use the fortran softtrg routines. Alternatively the native implementation
+	// scans ID and OD hits in one pass without rewriting the trigger conditions each event.
+	m_variables.Get("useNativeSofttrg",useNativeSofttrg);
+	// run both and compare the found triggers. The triggers of useNativeSofttrg are still used.
+	m_variables.Get("validateSofttrg",validateSofttrg);
+	m_variables.Get("softtrgWindow",softtrgWindow);           // [ns] hit counting window
+	m_variables.Get("hitTimeOffset",hitTimeOffset);           // [ns] hit times relative to trigger t0
+	m_variables.Get("validationTolerance",validationTolerance); // [ticks] for comparing t0s
+	sortedHits.resize(2);
+	
 	return true;
 }
 
@@ -53,49 +65,33 @@ bool MuonSearch::Execute(){
 	}
 	*/
 	
-	// get trigger settings from file (why bother?)
-	int idetector [32], ithr [32], it0_offset [32],ipret0 [32],ipostt0 [32];
-	softtrg_get_cond_(idetector,ithr,it0_offset,ipret0,ipostt0);
-	
-	// disable all triggers except 1 (HE) and 3 (OD) by setting threshold to 100k and window size to 0
-	for(int i = 0; i < 32; i++){
-		if(i != 1 && i != 3){
-			ithr[i] = 100000;
-			it0_offset[i]=0;
-			ipret0[i]=0;
-			ipostt0[i]=0;
+	// get HE and OD trigger times, in clock ticks relative to it0sk
+	std::vector<int> heTimes, odTimes;
+	if(!useNativeSofttrg || validateSofttrg) GetFortranTriggers(heTimes, odTimes);
+	if(useNativeSofttrg || validateSofttrg){
+		std::vector<int> heTimesNative, odTimesNative;
+		GetNativeTriggers(heTimesNative, odTimesNative);
+		if(validateSofttrg){
+			CompareTriggers("HE", heTimesNative, heTimes);
+			CompareTriggers("OD", odTimesNative, odTimes);
+		}
+		if(useNativeSofttrg){
+			heTimes = std::move(heTimesNative);
+			odTimes = std::move(odTimesNative);
 		}
 	}
-	// pass to the software trigger algorithm
-	softtrg_set_cond_(idetector,ithr,it0_offset,ipret0,ipostt0);
-	
-	// call softtrg_inittrgtbl_ to populate the swtrgtbl_ common block.
-	int max_qb = 1280;
-	int one = 1;
-	int zero = 0;
-	int ntrg = softtrg_inittrgtbl_(&skhead_.nrunsk, &zero, &one, &max_qb);
-	
-	Log(m_unique_name+" found "+toString(ntrg)+" software triggers...",v_debug,m_verbose);
 	
 	std::vector<int> untaggedMuonTime;
 	
 	// search for pairs of HE+OD within a 100ns window - consider these muons
-	for(int i = 0; i < ntrg; i++){                                                   // loop over triggers found
-		Log(m_unique_name+" trigger "+toString(i)+" is of type "
-		    +toString(swtrgtbl_.swtrgtype[i]),v_debug,m_verbose);
-		if(swtrgtbl_.swtrgtype[i] == 1){                                             // for each HE trigger...
-			Log(m_unique_name+" found HE trigger, looking for coincident OD trigger",v_debug,m_verbose);
-			for(int j = 0; j < ntrg; j++){                                           // loop over triggers again
-				Log("\t"+m_unique_name+" trigger "+toString(i)+" is of type "
-				    +toString(swtrgtbl_.swtrgtype[i]),v_debug,m_verbose);
-				if(swtrgtbl_.swtrgtype[j] == 3){                                     // looking for OD triggers...
-					Log(m_unique_name+" SHE+OD pair with Δt="                        // in time coincidence
-					    +toString(swtrgtbl_.swtrgt0ctr[j] - swtrgtbl_.swtrgt0ctr[i]),v_debug,m_verbose);
-					if(abs(swtrgtbl_.swtrgt0ctr[j] - swtrgtbl_.swtrgt0ctr[i])< coincidence_threshold){
-						// swtrgt0ctr is t0_sub, so time from it0sk. We would need to add it0sk to get it0xsk.
-						untaggedMuonTime.push_back(swtrgtbl_.swtrgt0ctr[i]);
-					}
-				}
+	for(size_t i = 0; i < heTimes.size(); i++){                                       // for each HE trigger...
+		Log(m_unique_name+" found HE trigger, looking for coincident OD trigger",v_debug,m_verbose);
+		for(size_t j = 0; j < odTimes.size(); j++){                                   // loop over OD triggers
+			Log(m_unique_name+" SHE+OD pair with Δt="                                // in time coincidence
+			    +toString(odTimes[j] - heTimes[i]),v_debug,m_verbose);
+			if(abs(odTimes[j] - heTimes[i])< coincidence_threshold){
+				// swtrgt0ctr is t0_sub, so time from it0sk. We would need to add it0sk to get it0xsk.
+				untaggedMuonTime.push_back(heTimes[i]);
 			}
 		}
 	}
@@ -157,5 +153,111 @@ bool MuonSearch::Execute(){
 
 bool MuonSearch::Finalise(){
 	
+	if(validateSofttrg){
+		Log(m_unique_name+" native software trigger matched fortran softtrg in "
+		    +toString(nValidated-nMismatched)+" of "+toString(nValidated)+" trigger lists",
+		    (nMismatched ? v_warning : v_message),m_verbose);
+	}
+	
 	return true;
 }
+
+void MuonSearch::GetFortranTriggers(std::vector<int>& heTimes, std::vector<int>& odTimes){
+	
+	// get trigger settings from file (why bother?)
+	int idetector [32], ithr [32], it0_offset [32],ipret0 [32],ipostt0 [32];
+	softtrg_get_cond_(idetector,ithr,it0_offset,ipret0,ipostt0);
+	
+	// disable all triggers except 1 (HE) and 3 (OD) by setting threshold to 100k and window size to 0
+	for(int i = 0; i < 32; i++){
+		if(i != 1 && i != 3){
+			ithr[i] = 100000;
+			it0_offset[i]=0;
+			ipret0[i]=0;
+			ipostt0[i]=0;
+		}
+	}
+	// pass to the software trigger algorithm
+	softtrg_set_cond_(idetector,ithr,it0_offset,ipret0,ipostt0);
+	
+	// call softtrg_inittrgtbl_ to populate the swtrgtbl_ common block.
+	int max_qb = 1280;
+	int one = 1;
+	int zero = 0;
+	int ntrg = softtrg_inittrgtbl_(&skhead_.nrunsk, &zero, &one, &max_qb);
+	
+	Log(m_unique_name+" found "+toString(ntrg)+" software triggers...",v_debug,m_verbose);
+	
+	for(int i = 0; i < ntrg; i++){
+		Log(m_unique_name+" trigger "+toString(i)+" is of type "
+		    +toString(swtrgtbl_.swtrgtype[i]),v_debug,m_verbose);
+		if(swtrgtbl_.swtrgtype[i] == 1) heTimes.push_back(swtrgtbl_.swtrgt0ctr[i]);
+		else if(swtrgtbl_.swtrgtype[i] == 3) odTimes.push_back(swtrgtbl_.swtrgt0ctr[i]);
+	}
+	
+}
+
+void MuonSearch::GetNativeTriggers(std::vector<int>& heTimes, std::vector<int>& odTimes){
+	
+	// trigger conditions only change between runs
+	if(skhead_.nrunsk!=softtrgRun){
+		softtrgRun = skhead_.nrunsk;
+		int idetector [32], ithr [32], it0_offset [32],ipret0 [32],ipostt0 [32];
+		softtrg_get_cond_(idetector,ithr,it0_offset,ipret0,ipostt0);
+		softtrg.ClearTriggerTypes();
+		// HE acts on ID hits, OD on OD hits. Windows from softtrg are in clock ticks
+		for(int trgtype : {1, 3}){
+			software_trigger_type atype;
+			atype.name = (trgtype==1) ? "HE" : "OD";
+			atype.trigger_id = trgtype;
+			atype.detector = (trgtype==1) ? 0 : 1;
+			atype.threshold = ithr[trgtype];
+			atype.window = softtrgWindow;
+			atype.t0_offset = it0_offset[trgtype]/COUNT_PER_NSEC;
+			atype.pre_t0 = ipret0[trgtype]/COUNT_PER_NSEC;
+			atype.post_t0 = ipostt0[trgtype]/COUNT_PER_NSEC;
+			softtrg.AddTriggerType(atype);
+		}
+		Log(m_unique_name+" native software trigger thresholds for run "+toString(softtrgRun)
+		    +": HE "+toString(ithr[1])+", OD "+toString(ithr[3])+" hits",v_debug,m_verbose);
+	}
+	
+	SoftwareTrigger::SortedHitTimes(sktqz_.tiskz, sktqz_.nqiskz, sortedHits.at(0));
+	SoftwareTrigger::SortedHitTimes(sktqaz_.taskz, sktqaz_.nhitaz, sortedHits.at(1));
+	softtrg.Run(sortedHits);
+	
+	Log(m_unique_name+" found "+toString(softtrg.GetTriggers().size())+" native software triggers...",
+	    v_debug,m_verbose);
+	
+	for(const software_trigger& atrigger : softtrg.GetTriggers()){
+		// convert to clock ticks from the primary trigger, as for swtrgt0ctr
+		int t0ticks = std::round((atrigger.t0 + hitTimeOffset)*COUNT_PER_NSEC);
+		if(atrigger.trigger_id == 1) heTimes.push_back(t0ticks);
+		else odTimes.push_back(t0ticks);
+	}
+	
+}
+
+void MuonSearch::CompareTriggers(const std::string& trgname, const std::vector<int>& native,
+                                 const std::vector<int>& fortran){
+	
+	// fortran trigger table is not guaranteed to be in time order
+	std::vector<int> fortranSorted = fortran;
+	std::sort(fortranSorted.begin(), fortranSorted.end());
+	bool match = (native.size()==fortranSorted.size());
+	for(size_t i=0; match && i<native.size(); ++i){
+		if(std::abs(native[i]-fortranSorted[i]) > validationTolerance) match=false;
+	}
+	++nValidated;
+	if(!match){
+		++nMismatched;
+		Log(m_unique_name+" native "+trgname+" triggers "+toString(native.size())
+		    +" do not match fortran softtrg triggers "+toString(fortranSorted.size())
+		    +" in run "+toString(skhead_.nrunsk)+" event "+toString(skhead_.nevsk),v_warning,m_verbose);
+		if(m_verbose>=v_debug){
+			for(auto&& t : native) Log("	native "+trgname+" t0: "+toString(t),v_debug,m_verbose);
+			for(auto&& t : fortranSorted) Log("	fortran "+trgname+" t0: "+toString(t),v_debug,m_verbose);
+		}
+	}
+	
+}
@@ -9,6 +9,7 @@
 #include "MTreeReader.h"
 #include "skroot.h"
 #include "ConnectionTable.h"
+#include "SoftwareTrigger.h"
 
 
 /**
@@ -32,11 +33,25 @@ class MuonSearch: public Tool {
 	bool Finalise(); ///< Finalise funciton used to clean up resorces.
 	
 	private:
+	void GetFortranTriggers(std::vector<int>& heTimes, std::vector<int>& odTimes);
+	void GetNativeTriggers(std::vector<int>& heTimes, std::vector<int>& odTimes);
+	void CompareTriggers(const std::string& trgname, const std::vector<int>& native, const std::vector<int>& fortran);
 	
 	double coincidence_threshold=100;
 	std::string selectorName;
 	EventType eventType;
 	
+	bool useNativeSofttrg=false;
+	bool validateSofttrg=false;
+	double softtrgWindow=200;            // [ns]
+	double hitTimeOffset=-885.417;       // [ns] as SLESearch
+	int validationTolerance=2;           // [ticks]
+	SoftwareTrigger softtrg;
+	int softtrgRun=-1;                   // run for which softtrg conditions were loaded
+	std::vector<std::vector<double>> sortedHits;  // ID, OD hit times
+	int nValidated=0;
+	int nMismatched=0;
+	
 };
 
 
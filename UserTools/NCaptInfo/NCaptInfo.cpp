@@ -3,6 +3,7 @@
 
 #include <thread>
 #include <chrono>
+#include <limits>
 
 #include "TH1.h"
 #include "TH2.h"
@@ -26,6 +27,8 @@ bool NCaptInfo::Initialise(std::string configfile, DataModel &data){
 	m_variables.Get("verbosity",m_verbose);
 	m_variables.Get("time_match_tolerance",time_match_tolerance); // [ns]
 	m_variables.Get("dist_match_tolerance",dist_match_tolerance); // [cm]
+	// index true captures in cells about the size of the match tolerance
+	if(dist_match_tolerance>0) trueCaptureIndex.SetCellSize(dist_match_tolerance);
 	// whether to try to match candidates to non-neutron-capture truth vertices
 	m_variables.Get("outfilename",outfilename);
 	m_variables.Get("match_mistags",match_mistags);
@@ -135,95 +138,88 @@ bool NCaptInfo::MatchToTrueCaptures(){
 	std::vector<NCaptCandidate>& candidates = m_data->NCaptureCandidates[m_unique_name];
 	
 	// make a map of match quality metrics, based on difference in time and position
-	std::vector<std::vector<double> > match_merits(candidates.size(),
-	            std::vector<double>(m_data->NCapturesTrue.size(),999999));
+	// (only needed for 1:1 matching; see Note 1)
+	//std::vector<std::vector<double> > match_merits(candidates.size(),
+	//            std::vector<double>(m_data->NCapturesTrue.size(),999999));
+	
+	// index the true captures by position, so that each candidate only needs to be compared
+	// to those nearby rather than to every one in the event
+	trueCaptureIndex.Clear();
+	for(int truecapi=0; truecapi<m_data->NCapturesTrue.size(); ++truecapi){
+		NCapture& truecap = m_data->NCapturesTrue.at(truecapi);
+		double* truetime = truecap.GetTime();
+		TVector3* truepos =truecap.GetPos();
+		if(truetime==nullptr || truepos==nullptr){
+			Log(m_unique_name+" Error! True capture "+toString(truecapi)
+			   +" returned nullptr for time or position!",v_error,m_verbose);
+			return false;
+		}
+		trueCaptureIndex.Insert(truecapi, *truepos, *truetime);
+	}
 	
 	// loop over candidates
 	Log(m_unique_name+" matching "+toString(candidates.size())+" candidates",v_debug,m_verbose);
+	std::vector<int> truecaps_in_tolerance;
 	for(int candi=0; candi<candidates.size(); ++candi){
 		NCaptCandidate& candidate = candidates.at(candi);
 		// we could place a cut on likelihood metric first
 		if(candidate.capture_likelihood_metric<likelihood_threshold) continue;
 		
-		// for each candidate, loop over all true captures and match to the best one
-		int best_match_index=-1;
-		//std::cout<<"scanning "<<m_data->NCapturesTrue.size()<<" true captures"<<std::endl;
-		for(int truecapi=0; truecapi<m_data->NCapturesTrue.size(); ++truecapi){
-			NCapture& truecap = m_data->NCapturesTrue.at(truecapi);
-			double* truetime = truecap.GetTime();
-			TVector3* truepos =truecap.GetPos();
-			if(truetime==nullptr || truepos==nullptr){
-				Log(m_unique_name+" Error! True capture "+toString(truecapi)
+		// always set the best matching true capture for every candidate so that we can
+		// make plots of pos/time error, even for candidates without a qualifying match
+		// to compare which is the better match, use a metric based on time and distance
+		//  (TODO: and likelihood?)
+		// since capture times are ~O(20us) and capture distances are ~O(20cm)
+		// let's say add them in quadrature, with 1us equivalent to 1cm
+		// and say the better match is the one with the lower sum.
+		// also, it doesn't make sense for the candidate time to be before the true capture
+		// i.e. timediff > 0 (within some uncertainty from PMT timing resolution and
+		// a combination of noise + true hits gives a candidate time a little negative)
+		// FIXME should we / how do we incorporate this into the match metric?
+		double match_metric=0;
+		int best_match_index = trueCaptureIndex.FindNearest(candidate.capture_pos, candidate.capture_time,
+		                                                    1./1000., &match_metric);
+		if(best_match_index<0) continue;  // no true captures
+		if(m_verbose>v_debug){
+			NCapture& truecap = m_data->NCapturesTrue.at(best_match_index);
+			std::cout<<"candidate "<<candi<<" at position "<<toString(candidate.capture_pos)
+			         <<", time "<<toString(candidate.capture_time)<<" is nearest true cap "<<best_match_index
+			         <<" at position "<<toString(*truecap.GetPos())<<", time "<<toString(*truecap.GetTime())
+			         <<" giving match metric "<<match_metric<<std::endl;
+		}
+		bool make_match=false;
+		if(candidate.GetTrueCapture()!=nullptr){
+			// see whether this true capture is a better match for this candidate
+			double* old_timediff = candidate.GetCaptTerr();
+			double* old_posdiff = candidate.GetCaptPosErr();
+			if(old_timediff==nullptr || old_posdiff==nullptr){
+				Log(m_unique_name+" Error! Existing true match for candidate "+toString(candi)
 				   +" returned nullptr for time or position!",v_error,m_verbose);
 				return false;
 			}
-			double timediff = (candidate.capture_time - *truetime)/1000.;
-			double posdiff = (*truepos - candidate.capture_pos).Mag();
-			if(m_verbose>v_debug){
-				std::cout<<"candidate "<<candi<<" has position "<<toString(candidate.capture_pos)
-					     <<", vs true cap "<<truecapi<<" which has position "<<toString(*truepos)
-					     <<" giving distance "<<posdiff<<" compared to tolerance "
-					     <<dist_match_tolerance<<std::endl;
-				std::cout<<"candidate "<<candi<<" has time "<<toString(candidate.capture_time)
-					     <<", vs true cap "<<truecapi<<" which has time "<<toString(*truetime)
-					     <<" giving difference "<<timediff<<" compared to tolerance "
-					     <<time_match_tolerance<<std::endl;
-			}
-			
-			// always set the best matching true capture for every candidate so that we can
-			// make plots of pos/time error, even for candidates without a qualifying match
-			// to compare which is the better match, use a metric based on time and distance
-			//  (TODO: and likelihood?)
-			// since capture times are ~O(20us) and capture distances are ~O(20cm)
-			// let's say add them in quadrature, with 1us equivalent to 1cm
-			// and say the better match is the one with the lower sum.
-			// also, it doesn't make sense for the candidate time to be before the true capture
-			// i.e. timediff > 0 (within some uncertainty from PMT timing resolution and
-			// a combination of noise + true hits gives a candidate time a little negative)
-			// FIXME should we / how do we incorporate this into the match metric?
-			double match_metric = std::sqrt(pow(timediff,2.)+pow(posdiff,2.));
-			bool make_match=false;
-			if(candidate.GetTrueCapture()!=nullptr){
-				// see whether this true capture is a better match for this candidate
-				double* old_timediff = candidate.GetCaptTerr();
-				double* old_posdiff = candidate.GetCaptPosErr();
-				if(old_timediff==nullptr || old_posdiff==nullptr){
-					Log(m_unique_name+" Error! Existing true match for candidate "+toString(candi)
-					   +" returned nullptr for time or position!",v_error,m_verbose);
-					return false;
-				}
-				double old_match_metric = std::sqrt(pow(*old_timediff/1000.,2.)+pow(*old_posdiff,2.));
-				if(match_metric<old_match_metric){
-					// this is a better match
-					make_match=true;
-					//std::cout<<"found better match metric "<<match_metric
-					//         <<" than old one "<<old_match_metric<<std::endl;
-				}
-			} else {
-				// no current match
+			double old_match_metric = std::sqrt(pow(*old_timediff/1000.,2.)+pow(*old_posdiff,2.));
+			if(match_metric<old_match_metric){
+				// this is a better match
 				make_match=true;
 			}
-			
-			if(make_match){
-				//std::cout<<"matching candidate "<<candi<<" to true capture "<<truecapi<<std::endl;
-				//std::cout<<"which is:"<<std::endl;
-				//m_data->NCapturesTrue.at(truecapi).Print();
-				candidate.SetTrueCaptureIdx(truecapi);
-				//std::cout<<"this is now matched to true capture:"<<std::endl;
-				//m_data->NCapturesTrue.at(truecapi).Print();
-				//std::cout<<"which is at "<<&m_data->NCapturesTrue.at(truecapi)<<std::endl;
-				//std::cout<<"compared to "<<candidate.GetTrueCapture()<<std::endl;
-				//std::cout<<"and printing one more time "<<std::endl;
-				//candidate.GetTrueCapture()->Print();
-			}
-			
-			// we'll only set the 'matchType' for candidates passing some qualifying limit.
-			Log(m_unique_name+"checking if candidate passes cuts:\n"+
-			    +"timediff: "+toString(timediff)+" vs tolerance "+toString(time_match_tolerance)
-			    +"\nposdiff: "+toString(posdiff)+" vs tolerance "+toString(dist_match_tolerance),
-			    v_debug,m_verbose);
-			if(timediff>time_match_tolerance) continue;
-			if(posdiff>dist_match_tolerance) continue;
+		} else {
+			// no current match
+			make_match=true;
+		}
+		if(make_match){
+			candidate.SetTrueCaptureIdx(best_match_index);
+		}
+		
+		// we'll only set the 'matchType' for candidates passing some qualifying limit:
+		// timediff = (candidate time - true time) [us] no more than time_match_tolerance,
+		// and posdiff no more than dist_match_tolerance.
+		trueCaptureIndex.FindWithin(candidate.capture_pos, dist_match_tolerance,
+		                            candidate.capture_time - time_match_tolerance*1000.,
+		                            std::numeric_limits<double>::infinity(), truecaps_in_tolerance);
+		Log(m_unique_name+" candidate "+toString(candi)+" has "+toString(truecaps_in_tolerance.size())
+		    +" true captures within tolerances",v_debug,m_verbose);
+		for(int truecapi : truecaps_in_tolerance){
+			NCapture& truecap = m_data->NCapturesTrue.at(truecapi);
 			
 			// try to set a specific match type based on isotope, if known
 			// otherwise just set to general 'UnknownCapture'
@@ -341,82 +337,79 @@ bool NCaptInfo::MakePlots(int step){
 		matchtree->GetUserInfo()->Add(mcfilename);
 		
 		// info about candidates
-		std::vector<std::string> civariables{"nrunsk", "nsubsk", "nevsk", "cand_num"};
-		std::vector<std::string> cdvariables{"prompt_t","prompt_x", "prompt_y", "prompt_z",
-		                                     "cap_t","cap_x", "cap_y", "cap_z",
-		                                     "n_travel_t", "n_travel_d","prompt_e",
-		                                     "prompt_goodness", "cap_likelihood"};
-		// info about matches
-		std::vector<std::string> mivariables{"matchtype"};
-		std::vector<std::string> mdvariables{"prompt_terr", "prompt_derr", 
-		                                     "prompt_xerr", "prompt_yerr", "prompt_zerr",
-		                                     "prompt_eerr", "cap_terr", "cap_derr",
-		                                     "cap_xerr", "cap_yerr", "cap_zerr",
-		                                     "n_travel_terr", "n_travel_derr"};
-		
-		// make branches in candidate tree
-		cibranchvars.reserve(civariables.size());
-		for(auto&& avar : civariables){
-			cibranchvars[avar] = 0;
-			candtree->Branch(avar.c_str(), &cibranchvars[avar]);
-		}
-		cdbranchvars.reserve(cdvariables.size());
-		for(auto&& avar : cdvariables){
-			cdbranchvars[avar] = 0;
-			candtree->Branch(avar.c_str(), &cdbranchvars[avar]);
-		}
+		candtree->Branch("nrunsk", &candvars.nrunsk);
+		candtree->Branch("nsubsk", &candvars.nsubsk);
+		candtree->Branch("nevsk", &candvars.nevsk);
+		candtree->Branch("cand_num", &candvars.cand_num);
+		candtree->Branch("prompt_t", &candvars.prompt_t);
+		candtree->Branch("prompt_x", &candvars.prompt_x);
+		candtree->Branch("prompt_y", &candvars.prompt_y);
+		candtree->Branch("prompt_z", &candvars.prompt_z);
+		candtree->Branch("cap_t", &candvars.cap_t);
+		candtree->Branch("cap_x", &candvars.cap_x);
+		candtree->Branch("cap_y", &candvars.cap_y);
+		candtree->Branch("cap_z", &candvars.cap_z);
+		candtree->Branch("n_travel_t", &candvars.n_travel_t);
+		candtree->Branch("n_travel_d", &candvars.n_travel_d);
+		candtree->Branch("prompt_e", &candvars.prompt_e);
+		candtree->Branch("prompt_goodness", &candvars.prompt_goodness);
+		candtree->Branch("cap_likelihood", &candvars.cap_likelihood);
 		
-		// make branches in match tree
-		mibranchvars.reserve(mivariables.size());
-		for(auto&& avar : mivariables){
-			mibranchvars[avar] = 0;
-			matchtree->Branch(avar.c_str(), &mibranchvars[avar]);
-		}
-		mdbranchvars.reserve(mdvariables.size());
-		for(auto&& avar : mdvariables){
-			mdbranchvars[avar] = 0;
-			matchtree->Branch(avar.c_str(), &mdbranchvars[avar]);
-		}
+		// info about matches
+		matchtree->Branch("matchtype", &matchvars.matchtype);
+		matchtree->Branch("prompt_terr", &matchvars.prompt_terr);
+		matchtree->Branch("prompt_derr", &matchvars.prompt_derr);
+		matchtree->Branch("prompt_xerr", &matchvars.prompt_xerr);
+		matchtree->Branch("prompt_yerr", &matchvars.prompt_yerr);
+		matchtree->Branch("prompt_zerr", &matchvars.prompt_zerr);
+		matchtree->Branch("prompt_eerr", &matchvars.prompt_eerr);
+		matchtree->Branch("cap_terr", &matchvars.cap_terr);
+		matchtree->Branch("cap_derr", &matchvars.cap_derr);
+		matchtree->Branch("cap_xerr", &matchvars.cap_xerr);
+		matchtree->Branch("cap_yerr", &matchvars.cap_yerr);
+		matchtree->Branch("cap_zerr", &matchvars.cap_zerr);
+		matchtree->Branch("n_travel_terr", &matchvars.n_travel_terr);
+		matchtree->Branch("n_travel_derr", &matchvars.n_travel_derr);
 		
 	} else if(step==1){
 		
 		// execution - fill branches/histograms
-		cibranchvars["nrunsk"] = skhead_.nrunsk;
-		cibranchvars["nsubsk"] = skhead_.nsubsk;
-		cibranchvars["nevsk"] = skhead_.nevsk;
+		candvars.nrunsk = skhead_.nrunsk;
+		candvars.nsubsk = skhead_.nsubsk;
+		candvars.nevsk = skhead_.nevsk;
 		
 		std::vector<NCaptCandidate>& candidates = m_data->NCaptureCandidates[m_unique_name];
 		Log(m_unique_name+" Filling "+toString(candidates.size())+" candidates",v_debug,m_verbose);
 		for(int cand_i=0; cand_i<candidates.size(); ++cand_i){
-			cibranchvars["cand_num"] = cand_i;
+			candvars.cand_num = cand_i;
 			NCaptCandidate& acand = candidates.at(cand_i);
 			
 			// candidate info
-			cdbranchvars["cap_likelihood"] = acand.capture_likelihood_metric;
-			cdbranchvars["cap_t"] = acand.capture_time;       // [ns]
-			cdbranchvars["cap_x"] = acand.capture_pos.X();    // these have peaks at edges
-			cdbranchvars["cap_y"] = acand.capture_pos.Y();    // 
-			cdbranchvars["cap_z"] = acand.capture_pos.Z();    // especially z
+			candvars.cap_likelihood = acand.capture_likelihood_metric;
+			candvars.cap_t = acand.capture_time;       // [ns]
+			candvars.cap_x = acand.capture_pos.X();    // these have peaks at edges
+			candvars.cap_y = acand.capture_pos.Y();    // 
+			candvars.cap_z = acand.capture_pos.Z();    // especially z
 			// prompt event info (used for start of search, usually)
 			LoweCandidate* prompt_event = acand.GetPromptEvent();
 			if(prompt_event){
-				cdbranchvars["prompt_goodness"] = prompt_event->goodness_metric;
-				cdbranchvars["prompt_t"] = prompt_event->event_time;
-				cdbranchvars["prompt_x"] = prompt_event->event_pos.X();
-				cdbranchvars["prompt_y"] = prompt_event->event_pos.Y();
-				cdbranchvars["prompt_z"] = prompt_event->event_pos.Z();
-				cdbranchvars["prompt_e"] = prompt_event->event_energy;
-				cdbranchvars["n_travel_t"] = (acand.capture_time - prompt_event->event_time);
-				cdbranchvars["n_travel_d"] = (acand.capture_pos - prompt_event->event_pos).Mag();
+				candvars.prompt_goodness = prompt_event->goodness_metric;
+				candvars.prompt_t = prompt_event->event_time;
+				candvars.prompt_x = prompt_event->event_pos.X();
+				candvars.prompt_y = prompt_event->event_pos.Y();
+				candvars.prompt_z = prompt_event->event_pos.Z();
+				candvars.prompt_e = prompt_event->event_energy;
+				candvars.n_travel_t = (acand.capture_time - prompt_event->event_time);
+				candvars.n_travel_d = (acand.capture_pos - prompt_event->event_pos).Mag();
 			} else {
-				cdbranchvars["prompt_goodness"] = -1;
-				cdbranchvars["prompt_t"] = 9999;  // ignore 9999
-				cdbranchvars["prompt_x"] = 9999;  // ignore 9999
-				cdbranchvars["prompt_y"] = 9999;  // ignore 9999
-				cdbranchvars["prompt_z"] = 9999;  // ignore 9999
-				cdbranchvars["prompt_e"] = 9999;
-				cdbranchvars["n_travel_t"] = 9999;
-				cdbranchvars["n_travel_d"] = 9999;
+				candvars.prompt_goodness = -1;
+				candvars.prompt_t = 9999;  // ignore 9999
+				candvars.prompt_x = 9999;  // ignore 9999
+				candvars.prompt_y = 9999;  // ignore 9999
+				candvars.prompt_z = 9999;  // ignore 9999
+				candvars.prompt_e = 9999;
+				candvars.n_travel_t = 9999;
+				candvars.n_travel_d = 9999;
 			}
 			
 			candtree->Fill();
@@ -425,81 +418,81 @@ bool NCaptInfo::MakePlots(int step){
 			NCapture* truecap = acand.GetTrueCapture();
 			//std::cout<<"candidate "<<cand_i<<" has true cap at: "<<truecap<<std::endl;
 			if(truecap){
-				mibranchvars["matchtype"] = int(acand.matchtype);
-				mdbranchvars["cap_terr"] = (acand.GetCaptTerr() ? *acand.GetCaptTerr() : 9999);
-				mdbranchvars["cap_derr"] = (acand.GetCaptPosErr() ? *acand.GetCaptPosErr() : 9999);
+				matchvars.matchtype = int(acand.matchtype);
+				matchvars.cap_terr = (acand.GetCaptTerr() ? *acand.GetCaptTerr() : 9999);
+				matchvars.cap_derr = (acand.GetCaptPosErr() ? *acand.GetCaptPosErr() : 9999);
 				TVector3* truecaptpos = truecap->GetPos();
 				if(truecaptpos){
-					mdbranchvars["cap_xerr"] = acand.capture_pos.X() - truecaptpos->X();
-					mdbranchvars["cap_yerr"] = acand.capture_pos.Y() - truecaptpos->Y();
-					mdbranchvars["cap_zerr"] = acand.capture_pos.Z() - truecaptpos->Z();
+					matchvars.cap_xerr = acand.capture_pos.X() - truecaptpos->X();
+					matchvars.cap_yerr = acand.capture_pos.Y() - truecaptpos->Y();
+					matchvars.cap_zerr = acand.capture_pos.Z() - truecaptpos->Z();
 				} else {
-					mdbranchvars["cap_xerr"] = 9999;
-					mdbranchvars["cap_yerr"] = 9999;
-					mdbranchvars["cap_zerr"] = 9999;
+					matchvars.cap_xerr = 9999;
+					matchvars.cap_yerr = 9999;
+					matchvars.cap_zerr = 9999;
 				}
 				double truetraveld = 0;
 				if(truecap->NeutronTravelDist(truetraveld)){
-					mdbranchvars["n_travel_derr"] = cdbranchvars["n_travel_d"] - truetraveld;
+					matchvars.n_travel_derr = candvars.n_travel_d - truetraveld;
 				} else {
-					mdbranchvars["n_travel_derr"] = 9999;
+					matchvars.n_travel_derr = 9999;
 				}
 				double truetravelt = 0;
 				if(truecap->NeutronTravelTime(truetravelt)){
-					mdbranchvars["n_travel_terr"] = cdbranchvars["n_travel_t"] - truetravelt;
+					matchvars.n_travel_terr = candvars.n_travel_t - truetravelt;
 				} else {
-					mdbranchvars["n_travel_terr"] = 9999;
+					matchvars.n_travel_terr = 9999;
 				}
 				
 				// also compare prompt events
 				// first init to defaults
-				mdbranchvars["prompt_terr"] = 9999;
-				mdbranchvars["prompt_derr"] = 9999;
-				mdbranchvars["prompt_xerr"] = 9999;
-				mdbranchvars["prompt_yerr"] = 9999;
-				mdbranchvars["prompt_zerr"] = 9999;
-				mdbranchvars["prompt_eerr"] = 9999;
+				matchvars.prompt_terr = 9999;
+				matchvars.prompt_derr = 9999;
+				matchvars.prompt_xerr = 9999;
+				matchvars.prompt_yerr = 9999;
+				matchvars.prompt_zerr = 9999;
+				matchvars.prompt_eerr = 9999;
 				MParticle* truepositron = truecap->GetIBDPositron();
 				if(prompt_event!=nullptr && truepositron!=nullptr){
 					TVector3* cand_prompt_pos = &prompt_event->event_pos;
 					TVector3* true_prompt_pos = truepositron->GetStartPos();
 					if(cand_prompt_pos && true_prompt_pos){
 						TVector3 diffvec = (*cand_prompt_pos - *true_prompt_pos);
-						mdbranchvars["prompt_derr"] = diffvec.Mag();
-						mdbranchvars["prompt_xerr"] = diffvec.X();
-						mdbranchvars["prompt_yerr"] = diffvec.Y();
-						mdbranchvars["prompt_zerr"] = diffvec.Z();
+						matchvars.prompt_derr = diffvec.Mag();
+						matchvars.prompt_xerr = diffvec.X();
+						matchvars.prompt_yerr = diffvec.Y();
+						matchvars.prompt_zerr = diffvec.Z();
 					}
 					double cand_prompt_t = prompt_event->event_time;
 					double* true_prompt_t = truepositron->GetStartTime();
 					if(true_prompt_t){
-						mdbranchvars["prompt_terr"] = cand_prompt_t - *true_prompt_t;
+						matchvars.prompt_terr = cand_prompt_t - *true_prompt_t;
 					}
 					double cand_prompt_e = prompt_event->event_energy;
 					double* true_prompt_e = truepositron->GetStartE();
 					if(true_prompt_e){
-						mdbranchvars["prompt_eerr"] = cand_prompt_e - *true_prompt_e;
+						matchvars.prompt_eerr = cand_prompt_e - *true_prompt_e;
 					}
 				}
 			} else {
-				mibranchvars["matchtype"] = int(NCaptCandidate::matchType::kNotSet);
-				mdbranchvars["cap_terr"] = 9999;
-				mdbranchvars["cap_derr"] = 9999;
-				mdbranchvars["cap_xerr"] = 9999;
-				mdbranchvars["cap_yerr"] = 9999;
-				mdbranchvars["cap_zerr"] = 9999;
-				mdbranchvars["n_travel_derr"] = 9999;
-				mdbranchvars["n_travel_terr"] = 9999;
-				mdbranchvars["prompt_derr"] = 9999;
-				mdbranchvars["prompt_xerr"] = 9999;
-				mdbranchvars["prompt_yerr"] = 9999;
-				mdbranchvars["prompt_zerr"] = 9999;
-				mdbranchvars["prompt_eerr"] = 9999;
+				matchvars.matchtype = int(NCaptCandidate::matchType::kNotSet);
+				matchvars.cap_terr = 9999;
+				matchvars.cap_derr = 9999;
+				matchvars.cap_xerr = 9999;
+				matchvars.cap_yerr = 9999;
+				matchvars.cap_zerr = 9999;
+				matchvars.n_travel_derr = 9999;
+				matchvars.n_travel_terr = 9999;
+				matchvars.prompt_derr = 9999;
+				matchvars.prompt_xerr = 9999;
+				matchvars.prompt_yerr = 9999;
+				matchvars.prompt_zerr = 9999;
+				matchvars.prompt_eerr = 9999;
 			}
 			
 			matchtree->Fill();
 			
-			if(m_verbose>v_debug && (cdbranchvars["cap_likelihood"]>0.9999)){
+			if(m_verbose>v_debug && (candvars.cap_likelihood>0.9999)){
 				double true_prompt_t = 9999;
 				if(truecap && truecap->GetIBDPositron() && truecap->GetIBDPositron()->GetStartTime()){
 					true_prompt_t = *truecap->GetIBDPositron()->GetStartTime();
@@ -509,10 +502,10 @@ bool NCaptInfo::MakePlots(int step){
 					true_cap_t = *truecap->GetTime();
 				}
 				std::cout<<"writing to match tree neutron candidate with reco prompt time "
-				         <<cdbranchvars["prompt_t"]<<", vs true prompt time "<<true_prompt_t
-				         <<", prompt t error: "<<mdbranchvars["prompt_terr"]
-				         <<", capture time "<<cdbranchvars["cap_t"]<<", true capture time: "
-				         <<true_cap_t<<", capture time error: "<<mdbranchvars["cap_terr"]<<std::endl;
+				         <<candvars.prompt_t<<", vs true prompt time "<<true_prompt_t
+				         <<", prompt t error: "<<matchvars.prompt_terr
+				         <<", capture time "<<candvars.cap_t<<", true capture time: "
+				         <<true_cap_t<<", capture time error: "<<matchvars.cap_terr<<std::endl;
 			}
 		}
 		
@@ -3,11 +3,11 @@
 
 #include <string>
 #include <iostream>
-#include <unordered_map>
 
 #include "Tool.h"
 #include "NCaptCandidate.h"
 #include "MTreeReader.h"
+#include "SpaceTimeIndex.h"
 
 /**
  * \class NCaptInfo
@@ -52,6 +52,7 @@ class NCaptInfo: public Tool {
 	double dist_match_tolerance;
 	double likelihood_threshold=-999;
 	double likelihood_cut=0.99;
+	SpaceTimeIndex trueCaptureIndex;  // true captures of this event, for matching
 	
 	// histograms
 	std::string outfilename="";
@@ -67,10 +68,20 @@ class NCaptInfo: public Tool {
 	
 	TTree* candtree = nullptr;
 	TTree* matchtree = nullptr;
-	std::unordered_map<std::string, int> cibranchvars;
-	std::unordered_map<std::string, double> cdbranchvars;
-	std::unordered_map<std::string, int> mibranchvars;
-	std::unordered_map<std::string, double> mdbranchvars;
+	// output tree variables, each bound to its branch once in MakePlots
+	struct {
+		int nrunsk=0, nsubsk=0, nevsk=0, cand_num=0;
+		double prompt_t=0, prompt_x=0, prompt_y=0, prompt_z=0;
+		double cap_t=0, cap_x=0, cap_y=0, cap_z=0;
+		double n_travel_t=0, n_travel_d=0, prompt_e=0;
+		double prompt_goodness=0, cap_likelihood=0;
+	} candvars;
+	struct {
+		int matchtype=0;
+		double prompt_terr=0, prompt_derr=0, prompt_xerr=0, prompt_yerr=0, prompt_zerr=0, prompt_eerr=0;
+		double cap_terr=0, cap_derr=0, cap_xerr=0, cap_yerr=0, cap_zerr=0;
+		double n_travel_terr=0, n_travel_derr=0;
+	} matchvars;
 	
 };
 
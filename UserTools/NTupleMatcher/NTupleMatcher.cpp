@@ -1,3 +1,7 @@
+#include <sstream>
+#include <algorithm>
+#include <functional>
+
 #include "NTupleMatcher.h"
 #include "NTupleReader.h"
 
@@ -6,103 +10,154 @@
 
 #include "skheadC.h"
 
+// an ntuple variable passed to other Tools, and the branches needed to read it
+struct ntuple_variable
+{
+    std::string name;
+    std::vector<std::string> branches;
+    std::function<void(const NTupleReader&, BStore&)> set;
+};
+
+namespace {
+
+const std::vector<ntuple_variable> ntupleVariables = {
+    {"nev",        {"nev"},            [](const NTupleReader& r, BStore& s){ s.Set("nev", r.nev); }},
+    {"nring",      {"nring"},          [](const NTupleReader& r, BStore& s){ s.Set("nring", r.nring); }},
+    {"nhitac",     {"nhitac"},         [](const NTupleReader& r, BStore& s){ s.Set("nhitac", r.nhitac); }},
+    {"evis",       {"evis"},           [](const NTupleReader& r, BStore& s){ s.Set("evis", r.evis); }},
+    {"wall",       {"wall"},           [](const NTupleReader& r, BStore& s){ s.Set("wall", r.wall); }},
+    {"ip",         {"nring", "ip"},    [](const NTupleReader& r, BStore& s){ s.Set("ip", r.ip[0]); }},
+    {"ipnu",       {"numnu", "ipnu"},  [](const NTupleReader& r, BStore& s){ s.Set("ipnu", r.ipnu[0]); }},
+    {"amome",      {"nring", "amome"}, [](const NTupleReader& r, BStore& s){ s.Set("amome", r.amome[0]); }},
+    {"amomm",      {"nring", "amomm"}, [](const NTupleReader& r, BStore& s){ s.Set("amomm", r.amomm[0]); }},
+    {"potot",      {"potot"},          [](const NTupleReader& r, BStore& s){ s.Set("potot", r.potot); }},
+    {"nn",         {"ntag_nn"},        [](const NTupleReader& r, BStore& s){ s.Set("nn", r.ntag_nn); }},
+    {"mctruth_nn", {"ntag_mctruth_nn"},[](const NTupleReader& r, BStore& s){ s.Set("mctruth_nn", r.ntag_mctruth_nn); }},
+    {"ndcy",       {"ndcy"},           [](const NTupleReader& r, BStore& s){ s.Set("ndcy", r.ndcy); }},
+    {"nmue",       {"nmue"},           [](const NTupleReader& r, BStore& s){ s.Set("nmue", r.nmue); }}
+};
+
+} // end anonymous namespace
+
 bool NTupleMatcher::Initialise(std::string configfile, DataModel &data)
 {
 	if(configfile!="")  m_variables.Initialise(configfile);
 	m_data= &data;
 	m_data->tool_configs[name] = &m_variables;
-    iEntry = 0; nEntries = 0; eventNo = 1;
+    nMatched = 0; nUnmatched = 0;
 
     // get ntuple file name and file id
-    std::string ntupleFilePath; int fileID;
+    std::string ntupleFilePath;
+    fileID = 0; matchRunSubrun = false;
     m_variables.Get("ntuple_file_path", ntupleFilePath);
     m_variables.Get("mc_file_id", fileID);
+    m_variables.Get("match_run_subrun", matchRunSubrun);
+    
+    // find which variables to read: by default all those we know of
+    std::string variableList;
+    if (m_variables.Get("ntuple_variables", variableList)) {
+        std::stringstream ss(variableList);
+        std::string variableName;
+        while (std::getline(ss, variableName, ',')) {
+            auto it = std::find_if(ntupleVariables.begin(), ntupleVariables.end(),
+                                   [&](const ntuple_variable& v){ return v.name == variableName; });
+            if (it == ntupleVariables.end()) {
+                Log("Unknown ntuple variable " + variableName, pERROR, m_verbose);
+                return false;
+            }
+            variables.push_back(&(*it));
+        }
+    }
+    else {
+        for (auto const& variable: ntupleVariables) variables.push_back(&variable);
+    }
+    
+    if (!LoadIndex(ntupleFilePath)) return false;
     
-    // get ntuple and set branch address of event number
     ntupleFile = TFile::Open(ntupleFilePath.c_str());
+    if (!ntupleFile || ntupleFile->IsZombie()) {
+        Log("Could not open ntuple file " + ntupleFilePath, pERROR, m_verbose);
+        return false;
+    }
     ntuple = (TTree*)ntupleFile->Get("h1");
-    //ntuple->SetBranchAddress("nev", &eventNo);
-    nEntries = ntuple->GetEntries();
     ntupleReader = new NTupleReader(ntuple);
-    ntupleReader->nev = 1;
     
-    // fill the first event number
-    int prevEventNo = -1;
+    // only read the branches of the variables we pass on
+    ntuple->SetBranchStatus("*", 0);
+    for (auto const& variable: variables)
+        for (auto const& branch: variable->branches)
+            ntuple->SetBranchStatus(branch.c_str(), 1);
     
-    // skip file
-    for (int i=0; i<fileID; i++) {
-        while (prevEventNo <= eventNo) {
-            prevEventNo = eventNo;
-            GetNewEntry();
-        }
-        prevEventNo = eventNo;
+    Log(Form("NTuple entries: %zu, segments: %d", ntupleIndex.size(), ntupleIndex.GetNSegments()));
+    if (!matchRunSubrun && fileID >= ntupleIndex.GetNSegments()) {
+        Log(Form("mc_file_id %d is beyond the %d MC files in the ntuple!", fileID, ntupleIndex.GetNSegments()), pERROR, m_verbose);
+        return false;
     }
-    Log(Form("NTuple iEntry: %d, nEntries: %d", iEntry, nEntries));
     std::cout << "\n";
     
     return true;
 }
 
-bool NTupleMatcher::Execute()
+bool NTupleMatcher::LoadIndex(const std::string& ntupleFilePath)
 {
-    // get event number from skread
-    Log(Form("skhead_.nevsk: %d, eventNo: %d", skhead_.nevsk, eventNo));
-    if (skhead_.nevsk < eventNo) {
-        Log(Form("No matching event in the ntuple (skhead_.nevsk %d, eventNo: %d). Skipping...", skhead_.nevsk, eventNo));
-        m_data->vars.Set("Skip",true);
+    // use the index file alongside the ntuple (or in index_dir) if up to date,
+    // otherwise build it, and save it for next time if possible
+    std::string indexDir;
+    bool writeIndex = true;
+    m_variables.Get("index_dir", indexDir);
+    m_variables.Get("write_index", writeIndex);
+    
+    std::string indexFile = NTupleIndex::IndexPath(ntupleFilePath, indexDir);
+    if (ntupleIndex.Read(indexFile, ntupleFilePath)) {
+        Log("Read ntuple index " + indexFile);
+        return true;
     }
-    else if (skhead_.nevsk == eventNo) {
-        SetNTupleVariables();
-        Log(Form("A matching event exists for event %d in the ntuple! Continuing toolchain execution...", eventNo));
-        //try { GetNewEntry(); }
-        //catch(...){}
-        //catch (ExceptionBehavior& e) { throw e; }
-        GetNewEntry();
+    
+    Log("Building ntuple index of " + ntupleFilePath);
+    if (!ntupleIndex.Build(ntupleFilePath)) {
+        Log("Failed to index ntuple " + ntupleFilePath, pERROR, m_verbose);
+        return false;
     }
-    else {
-        Log(Form("skhead_.nevsk %d is larger than eventNo %d! Ending toolchain execution...", skhead_.nevsk, eventNo));
+    if (writeIndex && !ntupleIndex.Write(indexFile)) {
+        Log("Could not save ntuple index to " + indexFile, pWARNING, m_verbose);
+    }
+    
+    return true;
+}
+
+bool NTupleMatcher::Execute()
+{
+    // find the ntuple entry of the event from skread
+    int64_t entry = (matchRunSubrun) ? ntupleIndex.Find(skhead_.nrunsk, skhead_.nsubsk, skhead_.nevsk)
+                                     : ntupleIndex.FindInSegment(fileID, skhead_.nevsk);
+    if (entry < 0) {
+        if (m_verbose >= pDEBUG)
+            Log(Form("No matching event in the ntuple (run %d, subrun %d, event %d). Skipping...",
+                     skhead_.nrunsk, skhead_.nsubsk, skhead_.nevsk));
         m_data->vars.Set("Skip",true);
-        m_data->vars.Set("StopLoop",true);
+        nUnmatched++;
+        return true;
     }
+    
+    ntupleReader->GetEntry(entry);
+    SetNTupleVariables();
+    nMatched++;
+    if (m_verbose >= pDEBUG)
+        Log(Form("Event %d matches ntuple entry %ld", skhead_.nevsk, (long)entry));
 
     return true;
 }
 
 bool NTupleMatcher::Finalise()
 {
+    Log(Form("Matched %d events, %d had no ntuple entry", nMatched, nUnmatched));
     ntupleFile->Close();
     delete ntupleReader;
     return true;
 }
 
-void NTupleMatcher::GetNewEntry()
-{
-    iEntry++;
-    if (iEntry < nEntries) {
-        ntupleReader->GetEntry(iEntry);
-        eventNo = ntupleReader->nev;
-    }
-    else {
-        Log("Reached the end of ntuple!");
-        m_data->vars.Set("Skip",true);
-        m_data->vars.Set("StopLoop",true);
-    }
-}
-
 void NTupleMatcher::SetNTupleVariables()
 {
-    m_data->eventVariables.Set("nev", eventNo);
-    m_data->eventVariables.Set("nring", ntupleReader->nring);
-    m_data->eventVariables.Set("nhitac", ntupleReader->nhitac);
-    m_data->eventVariables.Set("evis", ntupleReader->evis);
-    m_data->eventVariables.Set("wall", ntupleReader->wall);
-    m_data->eventVariables.Set("ip", ntupleReader->ip[0]);
-    m_data->eventVariables.Set("ipnu", ntupleReader->ipnu[0]);
-    m_data->eventVariables.Set("amome", ntupleReader->amome[0]);
-    m_data->eventVariables.Set("amomm", ntupleReader->amomm[0]);
-    m_data->eventVariables.Set("potot", ntupleReader->potot);
-    m_data->eventVariables.Set("nn", ntupleReader->ntag_nn);
-    m_data->eventVariables.Set("mctruth_nn", ntupleReader->ntag_mctruth_nn);
-    m_data->eventVariables.Set("ndcy", ntupleReader->ndcy);
-    m_data->eventVariables.Set("nmue", ntupleReader->nmue);
+    for (auto const& variable: variables)
+        variable->set(*ntupleReader, m_data->eventVariables);
 }
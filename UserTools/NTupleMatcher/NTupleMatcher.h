@@ -2,11 +2,13 @@
 #define NTUPLEMATCHER_HH
 
 #include "Tool.h"
+#include "NTupleIndex.h"
 
 class TFile;
 class TTree;
 
 class NTupleReader;
+struct ntuple_variable;
 
 class NTupleMatcher : public Tool
 {
@@ -19,16 +21,21 @@ class NTupleMatcher : public Tool
         
     private:
         std::string name;
-        void GetNewEntry();
+        bool LoadIndex(const std::string& ntupleFilePath);
         void SetNTupleVariables();
         
         TFile* ntupleFile;
         TTree* ntuple;
         
         NTupleReader* ntupleReader;
+        // (run, subrun, event) -> ntuple entry
+        NTupleIndex ntupleIndex;
+        // variables to pass on to other Tools; only their branches are read
+        std::vector<const ntuple_variable*> variables;
         
-        int iEntry, nEntries;
-        int eventNo;
+        int fileID;                 // segment of the ntuple to match to (MC files with restarting nev)
+        bool matchRunSubrun;        // match by run, subrun and event rather than event within fileID
+        int nMatched, nUnmatched;
 };
 
 #endif
@@ -4,6 +4,9 @@
 #include "TH1D.h"
 #include "TFile.h"
 
+#include <cmath>
+#include <numeric>
+
 #include "MTreeReader.h"
 
 NeutCloudCorrelationCuts::NeutCloudCorrelationCuts():Tool(){}
@@ -48,6 +51,7 @@ bool NeutCloudCorrelationCuts::Initialise(std::string configfile, DataModel &dat
   post_sample_m10_dl = TH1D("post_sample_m10_dl", "m = 10+;distance from relic candidate [cm]", 100, 0, 5000);  
 
   GetTreeReaders();
+  cloudPlanner.SetLoader([this](int entry, cloud_record& record){ return LoadCloud(entry, record); });
   
   return true;
 }
@@ -61,24 +65,20 @@ bool NeutCloudCorrelationCuts::Execute(){
 
   if (relicMatchedEntryNums->empty()){return true;}
 
-  for (size_t i = 0; i < relicMatchedEntryNums->size(); ++i){
-
-    const int match_idx = relicMatchedEntryNums->at(i);
-    std::cout << "match_idx: " << match_idx << std::endl;
-    const double dt = relicTimeDiffs->at(i);
-    std::cout << "matched time diff" << std::endl;
+  // read the matched clouds in entry order, each only once over all relics
+  const size_t n_duplicates = cloudPlanner.Plan(*relicMatchedEntryNums);
+  if (n_duplicates > 0 && m_verbose > 0){
+    std::cout << "NeutCloudCorrelationCuts::Execute - ignoring " << n_duplicates << " duplicate matched clouds" << std::endl;
+  }
 
-    ok = m_data->getTreeEntry(cloud_tree_reader_str, match_idx);
-    if (!ok){throw std::runtime_error("NeutCloudCorrelationCuts::Execute - failed to retrieve cloud file entry");} 
+  for (const auto& pair : cloudPlanner){
 
-    std::vector<double> muon_dir = {}; //std::vector<double>(skroot_mu_.mudir, skroot_mu_.mudir +3);
-    std::vector<double> neutron_cloud_vertex = {};
-    int* multiplicity = nullptr;
+    if (pair.record == nullptr){throw std::runtime_error("NeutCloudCorrelationCuts::Execute - failed to retrieve cloud file entry");}
+    const double dt = relicTimeDiffs->at(pair.match);
+    const std::vector<double>& muon_dir = pair.record->muon_dir;
+    const std::vector<double>& neutron_cloud_vertex = pair.record->neutron_cloud_vertex;
+    const int multiplicity = pair.record->multiplicity;
 
-    cloud_tree_reader->Get("neutron_cloud_vertex", neutron_cloud_vertex);
-    cloud_tree_reader->Get("neutron_cloud_multiplicity", *multiplicity);
-    cloud_tree_reader->Get("muon_dir", muon_dir);
-  
     std::vector<TVector3> coord_change_tensor = GetTensor(muon_dir, neutron_cloud_vertex);
      
     // old - regular sk coordinate system
@@ -90,7 +90,7 @@ bool NeutCloudCorrelationCuts::Execute(){
       pow(dr_old.Dot(coord_change_tensor.at(2)),2)
     };
 
-    const double dL = std::inner_product(dr_squared_new.begin(), dr_squared_new.end(), dr_squared_new.begin(), 0);
+    const double dL = std::sqrt(std::accumulate(dr_squared_new.begin(), dr_squared_new.end(), 0.));
 
     if (dt < 0){
       pre_sample_total_dl.Fill(dL);
@@ -108,7 +108,7 @@ bool NeutCloudCorrelationCuts::Execute(){
     };
       
     //ellipse cuts
-    if (*multiplicity == 2){
+    if (multiplicity == 2){
       if (dt < 0){
 	pre_sample_m2_dl.Fill(dL);
 	pre_sample_m2_dt.Fill(dt);
@@ -121,7 +121,7 @@ bool NeutCloudCorrelationCuts::Execute(){
       }
     }
 
-    if (*multiplicity == 3){
+    if (multiplicity == 3){
       if (dt < 0){
 	pre_sample_m3_dl.Fill(dL);
 	pre_sample_m3_dt.Fill(dt);
@@ -134,7 +134,7 @@ bool NeutCloudCorrelationCuts::Execute(){
       }
     }
   
-    if((*multiplicity == 4) || (*multiplicity == 5)){
+    if((multiplicity == 4) || (multiplicity == 5)){
       if (dt < 0){
 	pre_sample_m45_dl.Fill(dL);
 	pre_sample_m45_dt.Fill(dt);
@@ -147,7 +147,7 @@ bool NeutCloudCorrelationCuts::Execute(){
       }
     }
     
-    if ((*multiplicity > 6) && (*multiplicity < 9)){
+    if ((multiplicity > 6) && (multiplicity < 9)){
       if (dt < 0){
 	pre_sample_m69_dl.Fill(dL);
 	pre_sample_m69_dt.Fill(dt);
@@ -160,7 +160,7 @@ bool NeutCloudCorrelationCuts::Execute(){
       }
     }
     
-    if (*multiplicity >= 10){
+    if (multiplicity >= 10){
       if (dt < 0){
 	pre_sample_m10_dl.Fill(dL);
 	pre_sample_m10_dt.Fill(dt);
@@ -174,7 +174,7 @@ bool NeutCloudCorrelationCuts::Execute(){
     }
 
     //box cuts
-    if ((*multiplicity > 2) && ((std::abs(dt) < 0.1 && dL < 1200) || (std::abs(dt) < 1 && dL < 800))){
+    if ((multiplicity > 2) && ((std::abs(dt) < 0.1 && dL < 1200) || (std::abs(dt) < 1 && dL < 800))){
       SkipEntry();
     }
     
@@ -246,6 +246,31 @@ std::vector<TVector3> NeutCloudCorrelationCuts::GetTensor(const std::vector<doub
   return {x,y,z};
 }
  
+bool NeutCloudCorrelationCuts::LoadCloud(int entry, cloud_record& record){
+  if (!m_data->getTreeEntry(cloud_tree_reader_str, entry)){return false;}
+  bool ok = true;
+  // vector branches can only be got by pointer; copy them since the reader's buffers are reused
+  const std::vector<double>* vertex_ptr = nullptr;
+  if (cloud_tree_reader->Get("neutron_cloud_vertex", vertex_ptr) && vertex_ptr != nullptr){
+    record.neutron_cloud_vertex = *vertex_ptr;
+  } else {
+    std::cerr << "NeutCloudCorrelationCuts::LoadCloud - couldn't retrieve neutron_cloud_vertex for entry " << entry << std::endl;
+    ok = false;
+  }
+  if (!cloud_tree_reader->Get("neutron_cloud_multiplicity", record.multiplicity)){
+    std::cerr << "NeutCloudCorrelationCuts::LoadCloud - couldn't retrieve neutron_cloud_multiplicity for entry " << entry << std::endl;
+    ok = false;
+  }
+  const std::vector<double>* muon_dir_ptr = nullptr;
+  if (cloud_tree_reader->Get("muon_dir", muon_dir_ptr) && muon_dir_ptr != nullptr){
+    record.muon_dir = *muon_dir_ptr;
+  } else {
+    std::cerr << "NeutCloudCorrelationCuts::LoadCloud - couldn't retrieve muon_dir for entry " << entry << std::endl;
+    ok = false;
+  }
+  return ok;
+}
+
 void NeutCloudCorrelationCuts::SkipEntry(){
   bool skip = true;
   m_data->CStore.Set("Skip", skip);
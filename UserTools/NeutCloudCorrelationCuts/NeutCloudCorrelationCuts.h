@@ -6,6 +6,7 @@
 
 #include "Tool.h"
 #include "MTreeReader.h"
+#include "MatchedPairPlanner.h"
 
 #include "TH1D.h"
 
@@ -59,6 +60,16 @@ class NeutCloudCorrelationCuts: public Tool {
   
   std::vector<int>* relicMatchedEntryNums = nullptr;
   std::vector<float>* relicTimeDiffs = nullptr;
+
+  // what we need of a neutron cloud, kept for following relics so that
+  // each cloud entry is read once rather than for every relic it's matched to
+  struct cloud_record {
+    std::vector<double> neutron_cloud_vertex;
+    int multiplicity = 0;
+    std::vector<double> muon_dir;
+  };
+  bool LoadCloud(int entry, cloud_record& record);
+  MatchedPairPlanner<cloud_record> cloudPlanner;
  
 };
 
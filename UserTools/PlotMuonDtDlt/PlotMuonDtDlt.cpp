@@ -39,6 +39,12 @@ bool PlotMuonDtDlt::Initialise(std::string configfile, DataModel &data){
 	myTreeReader = m_data->Trees.at(treeReaderName);
 	myTreeSelections = m_data->Selectors.at(treeReaderName);
 	
+	// names of the dt cuts, so we don't need to make them for every event
+	for(int dt_cut_i=0; dt_cut_i<num_dt_cuts; ++dt_cut_i){
+		pre_dt_cut_names.push_back("pre_mu_dt_cut_"+toString(dt_cut_i));
+		post_dt_cut_names.push_back("post_mu_dt_cut_"+toString(dt_cut_i));
+	}
+	
 	return true;
 }
 
@@ -51,7 +57,7 @@ bool PlotMuonDtDlt::Execute(){
 	// only consider first muboy muon (only for multi-mu events?)
 	std::set<size_t> pre_muboy_first_muons = myTreeSelections->GetPassingIndexes("pre_muon_muboy_i==0");
 	for(size_t mu_i : pre_muboy_first_muons){
-		Log(m_unique_name+" filling spallation dt and dlt distributions",v_debug+2,m_verbose);
+		LOG_DEBUG_N(2, m_unique_name+" filling spallation dt and dlt distributions");
 		dlt_vals_pre.at(mu_class[mu_i]).push_back(dlt_mu_lowe[mu_i]);   // FIXME weight by num_pre_muons
 		dt_vals_pre.at(mu_class[mu_i]).push_back(dt_mu_lowe[mu_i]);     // FIXME weight by num_pre_muons
 		
@@ -59,10 +65,10 @@ bool PlotMuonDtDlt::Execute(){
 		// since we're interested in the effect on the spallation sample, which is given by
 		// the total - post-muon sample, record both pre- and post- muon samples with various dt cuts
 		for(int dt_cut_i=0; dt_cut_i<num_dt_cuts; ++dt_cut_i){
-			Log(m_unique_name+" checking nominal dlt cut systematic",v_debug+2,m_verbose);
-			if(myTreeSelections->GetPassesCut("pre_mu_dt_cut_"+toString(dt_cut_i),mu_i)){
-				Log(m_unique_name+" filling spallation dlt distribution for dt cut "
-				            +toString(dt_cut_i),v_debug+2,m_verbose);
+			LOG_DEBUG_N(2, m_unique_name+" checking nominal dlt cut systematic");
+			if(myTreeSelections->GetPassesCut(pre_dt_cut_names[dt_cut_i],mu_i)){
+				LOG_DEBUG_N(2, m_unique_name+" filling spallation dlt distribution for dt cut "
+				            +toString(dt_cut_i));
 				dlt_systematic_dt_cuts_pre.at(dt_cut_i).push_back(dt_mu_lowe[mu_i]);
 			}
 		}
@@ -70,15 +76,15 @@ bool PlotMuonDtDlt::Execute(){
 	// post muons
 	std::set<size_t> post_muboy_first_muons = myTreeSelections->GetPassingIndexes("post_muon_muboy_i==0");
 	for(size_t mu_i : post_muboy_first_muons){
-		Log(m_unique_name+" filling spallation dt and dlt distributions",v_debug+2,m_verbose);
+		LOG_DEBUG_N(2, m_unique_name+" filling spallation dt and dlt distributions");
 		dlt_vals_post.at(mu_class[mu_i]).push_back(dlt_mu_lowe[mu_i]);   // FIXME weight by num_post_muons
 		dt_vals_post.at(mu_class[mu_i]).push_back(dt_mu_lowe[mu_i]);     // FIXME weight by num_post_muons
 		
 		for(int dt_cut_i=0; dt_cut_i<num_dt_cuts; ++dt_cut_i){
-			Log(m_unique_name+" checking nominal dlt cut systematic",v_debug+2,m_verbose);
-			if(myTreeSelections->GetPassesCut("post_mu_dt_cut_"+toString(dt_cut_i),mu_i)){
-				Log(m_unique_name+" filling spallation dlt distribution for dt cut "
-				            +toString(dt_cut_i),v_debug+2,m_verbose);
+			LOG_DEBUG_N(2, m_unique_name+" checking nominal dlt cut systematic");
+			if(myTreeSelections->GetPassesCut(post_dt_cut_names[dt_cut_i],mu_i)){
+				LOG_DEBUG_N(2, m_unique_name+" filling spallation dlt distribution for dt cut "
+				            +toString(dt_cut_i));
 				dlt_systematic_dt_cuts_post.at(dt_cut_i).push_back(dt_mu_lowe[mu_i]);
 			}
 		}
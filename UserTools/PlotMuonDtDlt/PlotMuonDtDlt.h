@@ -59,6 +59,8 @@ class PlotMuonDtDlt: public Tool {
 	// TODO retrieve the list of cuts from the MTreeSelection, count how many we have of this type?
 	std::vector<std::vector<float>> dlt_systematic_dt_cuts_pre{5};
 	std::vector<std::vector<float>> dlt_systematic_dt_cuts_post{5};
+	std::vector<std::string> pre_dt_cut_names;   // "pre_mu_dt_cut_%d"
+	std::vector<std::string> post_dt_cut_names;  // "post_mu_dt_cut_%d"
 	// each entry is a different dt cut, inner vector is the dlts of passing events
 	// for a given dt cut, the difference between values gives the distribution of *spallation* dlt.
 	// across the various dt cuts, the difference between spallation dlt distributions gives
@@ -3,6 +3,8 @@
 
 #include "MTreeReader.h"
 
+#include <limits>
+
 ReadMCParticles::ReadMCParticles():Tool(){}
 
 namespace {
@@ -457,6 +459,9 @@ bool ReadMCParticles::GetSecondaryInfo(){
 		return false;
 	}
 	
+	// vertices of this event, to find duplicates as we add them
+	vertexIndex.SetCellSize(POS_TOLERANCE);
+	
 	// debug; print MCInfo
 	if(m_verbose>3){
 		// Print method should have been const-qualified. Hack around it.
@@ -531,13 +536,12 @@ bool ReadMCParticles::GetSecondaryInfo(){
 		// so first see if this there's a matching vertex already.
 		Log(m_unique_name+" check for existing vtx",v_debug,m_verbose);
 		int vertex_idx=-1;
-		for(int j=0; j<m_data->eventVertices.size(); ++j){
-			if((m_data->eventVertices.at(j).time-primary_vtx_time.at(i))>TIME_TOLERANCE) continue;
-			TVector3 start_pos{primary_vtx_pos.at(i).data()};
-			if((m_data->eventVertices.at(j).pos-start_pos).Mag()>POS_TOLERANCE) continue;
-			vertex_idx = j;
-			primary_vertex_map.emplace(i,j);  // primary vertex i is now at index j
-			break;
+		TVector3 start_pos{primary_vtx_pos.at(i).data()};
+		vertexIndex.FindWithin(start_pos, POS_TOLERANCE, -std::numeric_limits<double>::infinity(),
+		                       primary_vtx_time.at(i)+TIME_TOLERANCE, matching_vertices);
+		if(!matching_vertices.empty()){
+			vertex_idx = matching_vertices.front();
+			primary_vertex_map.emplace(i,vertex_idx);  // primary vertex i is now at index vertex_idx
 		}
 		if(vertex_idx<0){
 			Log(m_unique_name+" no matching index found, making a new one",v_debug,m_verbose);
@@ -555,6 +559,7 @@ bool ReadMCParticles::GetSecondaryInfo(){
 			//std::cout<<"primary vtx "<<i<<" has parent "<<primary_vtx_parent.at(i)<<std::endl;
 			// instead set the parent to -1 since we use that to indicate primaries
 			avertex.SetIncidentParticle(-1);
+			vertexIndex.Insert(m_data->eventVertices.size()-1, avertex.pos, avertex.time);
 			
 			// not meaningful for primaries
 			//avertex.target_pdg = -1;
@@ -692,18 +697,16 @@ bool ReadMCParticles::GetSecondaryInfo(){
 		// vertices. so first see if this there's a matching vertex already.
 		Log(m_unique_name+" check for existing vtx",v_debug,m_verbose);
 		int vertex_idx=-1;
-		for(int j=0; j<m_data->eventVertices.size(); ++j){
-			if((m_data->eventVertices.at(j).time-secondary_start_time.at(i))>TIME_TOLERANCE) continue;
-			TVector3 start_pos{secondary_start_vertex.at(i).data()};
-			if((m_data->eventVertices.at(j).pos-start_pos).Mag()>POS_TOLERANCE) continue;
+		TVector3 start_pos{secondary_start_vertex.at(i).data()};
+		vertexIndex.FindWithin(start_pos, POS_TOLERANCE, -std::numeric_limits<double>::infinity(),
+		                       secondary_start_time.at(i)+TIME_TOLERANCE, matching_vertices);
+		if(!matching_vertices.empty()){
 			// warning
-			if(vertex_idx>0){
+			if(matching_vertices.size()>1){
 				Log(m_unique_name+" secondary "+toString(i)+" start vertex matches more than"
 				    " one vertex in eventParticles! Reduce matching tolerance!",v_warning,m_verbose);
 			}
-			vertex_idx = j;
-			// if we don't care about the warning, we can just break after finding the first one
-			break;
+			vertex_idx = matching_vertices.front();
 		}
 		Log(m_unique_name+" check done, vertex_idx "+toString(vertex_idx),v_debug,m_verbose);
 		if(vertex_idx>0){
@@ -737,6 +740,7 @@ bool ReadMCParticles::GetSecondaryInfo(){
 			start_vtx.processes = std::vector<int>{secondary_gen_process.at(i)};
 			start_vtx.incident_particle_mom = TVector3{secondary_parent_mom_at_sec_creation.at(i).data()};
 			start_vtx.incident_particle_pdg = secondary_parent_PDG_code.at(i);
+			vertexIndex.Insert(m_data->eventVertices.size()-1, start_vtx.pos, start_vtx.time);
 			
 			// not available for this source
 			//start_vxt.target_pdg = -1;
@@ -6,6 +6,7 @@
 #include <iostream>
 
 #include "Tool.h"
+#include "SpaceTimeIndex.h"
 
 /**
 * \class ReadMCParticles
@@ -36,6 +37,8 @@ class ReadMCParticles: public Tool {
 	
 	const SecondaryInfo * sec_info = nullptr;
 	const MCInfo* mc_info = nullptr;
+	SpaceTimeIndex vertexIndex;           // eventVertices, for removing duplicates
+	std::vector<int> matching_vertices;
 	
 };
 
@@ -25,6 +25,13 @@ bool RelicMuonMatching::Initialise(std::string configfile, DataModel &data){
 	match_window *= 1E9; // convert to [ns]
 	match_window_ticks = match_window * COUNT_PER_NSEC;
 	
+	// set by ShardDriver when running in parallel with an overlap (--shardOverlap)
+	m_variables.Get("overlapEntries", overlapEntries);
+	if(overlapEntries>0){
+		Log(m_unique_name+" treating the first "+toString(overlapEntries)+" input entries as overlap with "
+		    +"the previous shard: these are only used as matching targets",v_message,m_verbose);
+	}
+	
 	std::string rfmReaderName;
 	m_variables.Get("rfmReaderName", rfmReaderName);
 	if(m_data->Trees.count(rfmReaderName)==0){
@@ -102,15 +109,15 @@ bool RelicMuonMatching::Execute(){
 	if(skhead_.idtgsk & (1<<29)){
 		std::deque<ParticleCand>* thedeque=nullptr;
 		if(lastEventType==EventType::Muon){
-			Log(m_unique_name+" found AFT after muon",v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" found AFT after muon");
 			thedeque = &m_data->muonCandDeque;
 		} else if(lastEventType==EventType::LowE){
-			Log(m_unique_name+" found AFT after relic",v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" found AFT after relic");
 			thedeque = &m_data->relicCandDeque;
 		}
 		if(thedeque!=nullptr && thedeque->size() && thedeque->back().EventNumber==(skhead_.nevsk-1)){
-			Log(m_unique_name+" Setting AFT flag for "+(lastEventType==EventType::Muon ? "Muon " : "relic ")
-			         +toString(thedeque->back().EventNumber),v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" Setting AFT flag for "+(lastEventType==EventType::Muon ? "Muon " : "relic ")
+			         +toString(thedeque->back().EventNumber));
 			thedeque->back().hasAFT = true;
 			thedeque->back().AFTEntryNum = rfmReader->GetEntryNumber();
 			/*
@@ -138,8 +145,10 @@ bool RelicMuonMatching::Execute(){
 		m_data->vars.Set("StopLoop",1);
 		return false;
 	}
-	if(eventType==EventType::LowE) ++reliccount;
-	if(eventType==EventType::Muon) ++muoncount;
+	// candidates in the overlap with the previous shard are counted by that shard
+	const bool in_overlap = rfmReader->GetEntryNumber() < overlapEntries;
+	if(eventType==EventType::LowE && !in_overlap) ++reliccount;
+	if(eventType==EventType::Muon && !in_overlap) ++muoncount;
 	
 	// *************************** //
 	// *** START SANITY CHECKS *** //
@@ -198,7 +207,7 @@ bool RelicMuonMatching::Execute(){
 	double secs_since_last = double(ticksDiff/COUNT_PER_NSEC)/1.E9;
 	//std::cout<<m_unique_name<<" secs to last event: "<<secs_since_last<<std::endl;
 	
-	if(!distros_file.empty()){
+	if(!distros_file.empty() && !in_overlap){
 		if(eventType==EventType::Muon){
 			ticksDiff = (thiseventticks - lastmuticks);
 			if(ticksDiff<0) ticksDiff += (int64_t(1) << 47);
@@ -258,7 +267,7 @@ bool RelicMuonMatching::Execute(){
 		// in c++ we can just interpret it as uint so it fills with 0's!
 		currentTicks += *reinterpret_cast<uint32_t*>(&skheadqb_.it0sk);
 		
-		Log(m_unique_name+" !!!NEW RELIC!!!",v_warning,m_verbose);
+		LOG_WARNING(m_unique_name+" !!!NEW RELIC!!!");
 		
 		// match this relic candidate to any held muon candidates
 		RelicMuonMatch(true, currentTicks, 0, 0);
@@ -289,8 +298,8 @@ bool RelicMuonMatching::Execute(){
 	}
 	
 	// prune any match candidates that have dropped off our window of interest
-	Log(m_unique_name+" Relics to prune: "+toString(relicsToRemove.size())+
-	                  ", muons to prune: "+toString(muonsToRemove.size()),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Relics to prune: "+toString(relicsToRemove.size())+
+	                  ", muons to prune: "+toString(muonsToRemove.size()));
 	if(muonsToRemove.size() > 0){
 		RemoveFromDeque(muonsToRemove, m_data->muonCandDeque);
 	}
@@ -298,8 +307,8 @@ bool RelicMuonMatching::Execute(){
 		RemoveFromDeque(relicsToRemove, m_data->relicCandDeque);
 	}
 	
-	Log(m_unique_name+" Relics to Write out: "+toString(m_data->writeOutRelics.size())+
-	                  ", muons to write out: "+toString(m_data->muonsToRec.size()),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Relics to Write out: "+toString(m_data->writeOutRelics.size())+
+	                  ", muons to write out: "+toString(m_data->muonsToRec.size()));
 	
 	return true;
 }
@@ -310,9 +319,12 @@ bool RelicMuonMatching::Finalise(){
 	// write out any remaining relics still being matched
 	for(int i = 0; i < m_data->relicCandDeque.size(); i++){
 		ParticleCand& targetCand = m_data->relicCandDeque.at(i);
+		// relics in the shard overlap are written by the previous shard, and only need writing
+		// here to record their matches to muons in our range
+		if(targetCand.Overlap && targetCand.matchedParticleEvNum.size()==0) continue;
 		m_data->writeOutRelics.push_back(targetCand);
 		Log(m_unique_name+" Adding a relic to write out!",v_warning,m_verbose);
-		if(!relicSelectorName.empty()){
+		if(!relicSelectorName.empty() && !targetCand.Overlap){
 			m_data->ApplyCut(relicSelectorName, m_unique_name,
 			                 targetCand.matchedParticleEvNum.size());
 		}
@@ -326,7 +338,7 @@ bool RelicMuonMatching::Finalise(){
 			m_data->muonsToRec.push_back(targetCand);
 			Log(m_unique_name+" Adding a muon to write out!",v_warning,m_verbose);
 		}
-		if(!muSelectorName.empty()){
+		if(!muSelectorName.empty() && !targetCand.Overlap){
 			m_data->ApplyCut(muSelectorName, m_unique_name,
 			                 targetCand.matchedParticleEvNum.size());
 		}
@@ -381,6 +393,7 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 	currentParticle.LowECommon = skroot_lowe_;
 	currentParticle.hasAFT = false;
 	currentParticle.AFTEntryNum = -1;
+	currentParticle.Overlap = (currentParticle.InEntryNumber < overlapEntries);
 	
 //	// XXX XXX XXX DEBUG Force insertion of muon XXX XXX XXX
 //	// assume it has an AFT
@@ -398,8 +411,11 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 		currentDeque = &m_data->relicCandDeque;
 		targetDeque = &m_data->muonCandDeque;
 		// we save every relic, so can already assign its output ttree entry number
-		currentParticle.OutEntryNumber = nextrelicentry;
-		++nextrelicentry;
+		// (except those in the shard overlap, which are only saved if matched)
+		if(!currentParticle.Overlap){
+			currentParticle.OutEntryNumber = nextrelicentry;
+			++nextrelicentry;
+		}
 	} else {
 		currentParticle.PID = 2;
 		currentDeque = &m_data->muonCandDeque;
@@ -409,8 +425,8 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 	
 	// scan over targets, oldest to newest
 	if(targetDeque->size()){
-		Log(m_unique_name+" matching this "+(loweEventFlag ? "lowE" : "muon")+" candidate to "
-		    +toString(targetDeque->size())+" targets",v_warning,m_verbose);
+		LOG_WARNING(m_unique_name+" matching this "+(loweEventFlag ? "lowE" : "muon")+" candidate to "
+		    +toString(targetDeque->size())+" targets");
 	}
 	
 	bool firstmatch=true;
@@ -424,8 +440,8 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 		if(ticksDiff<0) ticksDiff +=  (int64_t(1) << 47);
 		
 		if(subtrg_num==0 && i==0){
-			Log(m_unique_name+" secs to oldest candidate "+toString(i)+": "
-			   +toString(double(ticksDiff/COUNT_PER_NSEC)/1E9),v_warning,m_verbose);
+			LOG_WARNING(m_unique_name+" secs to oldest candidate "+toString(i)+": "
+			   +toString(double(ticksDiff/COUNT_PER_NSEC)/1E9));
 		}
 		
 		// validate: compare to tdiff_muon result (returns ns)
@@ -442,21 +458,26 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 		}
 		*/
 		
+		// pairs within the overlap of a previous shard are recorded by that shard.
+		// Since the overlap precedes our range, the targets of an overlap candidate are all in the overlap,
+		// so all we need do for them is prune those that are now out of the window.
+		const bool record_pair = !currentParticle.Overlap;
+		
 		// make a note of the time diff. The selector is just a recorder, so this won't
 		// affect any actual selections, but we can use it to get the distribution of time diffs
-		++tdiffcount;
+		if(record_pair) ++tdiffcount;
 		
 		// get subtrigger number from target muon if the candidate is a relic
 		if(loweEventFlag){
 			subtrg_num = targetCand.SubTriggerNumber;
 		}
 		// fill relic matching tdiff histogram
-		if(!relicSelectorName.empty()){
+		if(!relicSelectorName.empty() && record_pair){
 			double t_diff_sign = (loweEventFlag ? 1 : -1);
 			m_data->ApplyCut(relicSelectorName, "relic_mu_tdiff", t_diff_sign*(ticksDiff/COUNT_PER_NSEC)/1.E9, subtrg_num);
 		}
 		// fill muon matching tdiff histogram
-		if(!muSelectorName.empty()){
+		if(!muSelectorName.empty() && record_pair){
 			double t_diff_sign = (loweEventFlag ? -1 : 1);
 			m_data->ApplyCut(muSelectorName, "relic_mu_tdiff", t_diff_sign*(ticksDiff/COUNT_PER_NSEC)/1.E9, subtrg_num);
 		}
@@ -464,6 +485,7 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 		//If the time difference between the two events is less than 60 seconds then "match" the particles.
 		//N.B. since events are time ordered, timediff is always positive
 		if(ticksDiff < match_window_ticks){
+			if(!record_pair) continue;
 			++passing_tdiffcount;
 			
 			/*
@@ -478,21 +500,27 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 			// if this is the first match of this particle, set its event number in the output file
 			// and increment the counter for the next event which will be written out
 			if(firstmatch){
-				Log(m_unique_name+" First match for current "+((loweEventFlag) ? "relic" : "muon"),v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" First match for current "+((loweEventFlag) ? "relic" : "muon"));
 				if(!loweEventFlag){
 					currentParticle.OutEntryNumber = nextmuentry;
 					++nextmuentry;
+				} else if(currentParticle.Overlap){
+					currentParticle.OutEntryNumber = nextrelicentry;
+					++nextrelicentry;
 				}
 				firstmatch=false;
 			}
 			if(targetCand.matchedParticleEvNum.size()==0){
-				Log(m_unique_name+" First match for target "+((loweEventFlag) ? "muon" : "relic"),v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" First match for target "+((loweEventFlag) ? "muon" : "relic"));
 				// if this is the first match for a muon, we now know we'll be writing it out
 				// so can set its output entry number and increment that for the next.
 				if(loweEventFlag){
 					targetCand.OutEntryNumber = nextmuentry;
 					++nextmuentry;
 					//if(targetCand.hasAFT) ++nextmuentry; // we merge the AFT so one output entry for both now.
+				} else if(targetCand.Overlap){
+					targetCand.OutEntryNumber = nextrelicentry;
+					++nextrelicentry;
 				}
 			}
 			
@@ -516,34 +544,36 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 		// since any subsequent events will also be >60s after this target event there will
 		// be no more matches for this target, and we can write it out if appropriate.
 		} else {
-			Log(m_unique_name+((loweEventFlag) ? "relic" : "muon")+" entry "
+			LOG_DEBUG(m_unique_name+((loweEventFlag) ? "relic" : "muon")+" entry "
 			    +toString(currentParticle.InEntryNumber)+" is >60s after target entry "
-			    +toString(targetCand.InEntryNumber),v_debug,m_verbose);
+			    +toString(targetCand.InEntryNumber));
 			if(loweEventFlag){
-				Log(m_unique_name+" Muon "+toString(targetCand.InEntryNumber)+" matched to "
-				    +toString(targetCand.matchedParticleEvNum.size())+" relics",v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" Muon "+toString(targetCand.InEntryNumber)+" matched to "
+				    +toString(targetCand.matchedParticleEvNum.size())+" relics");
 				// we'll find a lot of muons, but we're only interested in ones matched to relic candidates.
 				// only add it to the set of muons to record if it was matched to at least one relic.
 				if(targetCand.matchedParticleEvNum.size()){
 					m_data->muonsToRec.push_back(targetCand);
-					Log(m_unique_name+" Adding a muon to write out!",v_warning,m_verbose);
+					LOG_WARNING(m_unique_name+" Adding a muon to write out!");
 				}
 				// remove it from the set of muons being matched
 				muonsToRemove.push_back(targetCand.EventNumber);
-				if(!muSelectorName.empty()){
+				if(!muSelectorName.empty() && !targetCand.Overlap){
 					// make a note of this muon and its number of matches
 					m_data->ApplyCut(muSelectorName, m_unique_name,
 					                 targetCand.matchedParticleEvNum.size());
 				}
 			} else {
-				Log(m_unique_name+" Relic "+toString(targetCand.InEntryNumber)+" matched to "
-				    +toString(targetCand.matchedParticleEvNum.size())+" muons",v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" Relic "+toString(targetCand.InEntryNumber)+" matched to "
+				    +toString(targetCand.matchedParticleEvNum.size())+" muons");
 				// add it to the set of relic candidates ready to write out
-				m_data->writeOutRelics.push_back(targetCand);
-				Log(m_unique_name+" Adding a relic to write out!",v_warning,m_verbose);
+				if(!targetCand.Overlap || targetCand.matchedParticleEvNum.size()){
+					m_data->writeOutRelics.push_back(targetCand);
+					LOG_WARNING(m_unique_name+" Adding a relic to write out!");
+				}
 				// remove it from the set of relic candidates being matched
 				relicsToRemove.push_back(targetCand.EventNumber);
-				if(!relicSelectorName.empty()){
+				if(!relicSelectorName.empty() && !targetCand.Overlap){
 					// make a note of this relic and its number of matches
 					m_data->ApplyCut(relicSelectorName, m_unique_name,
 					                 targetCand.matchedParticleEvNum.size());
@@ -561,8 +591,8 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 	//We can safely prune any muons more than 60s older than the current event that have no matches.
 	//only bother with this scan if we have >150 muons (~60s) of muons
 	if(!loweEventFlag && currentDeque->size() > 150){
-		Log(m_unique_name+" We have "+toString(currentDeque->size())
-		    +" muons, dropping any more than 60s older than the current one",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" We have "+toString(currentDeque->size())
+		    +" muons, dropping any more than 60s older than the current one");
 		for(int i = 0; i < (int(currentDeque->size()) - 2); i++){
 			ParticleCand& targetCand = currentDeque->at(i);
 			
@@ -603,20 +633,22 @@ bool RelicMuonMatching::RelicMuonMatch(bool loweEventFlag, int64_t currentTicks,
 			// so we can prune it now.
 			if(ticksDiff > match_window_ticks){
 				if(loweEventFlag){
-					m_data->writeOutRelics.push_back(targetCand);
-					Log(m_unique_name+" Adding a relic to write out!",v_warning,m_verbose);
+					if(!targetCand.Overlap || targetCand.matchedParticleEvNum.size()){
+						m_data->writeOutRelics.push_back(targetCand);
+						LOG_WARNING(m_unique_name+" Adding a relic to write out!");
+					}
 					relicsToRemove.push_back(targetCand.EventNumber);
-					if(!relicSelectorName.empty()){
+					if(!relicSelectorName.empty() && !targetCand.Overlap){
 						m_data->ApplyCut(relicSelectorName, m_unique_name,
 						                 targetCand.matchedParticleEvNum.size());
 					}
 				} else {
 					if(targetCand.matchedParticleEvNum.size()){
 						m_data->muonsToRec.push_back(targetCand);
-						Log(m_unique_name+" Adding a muon to write out!",v_warning,m_verbose);
+						LOG_WARNING(m_unique_name+" Adding a muon to write out!");
 					}
 					muonsToRemove.push_back(targetCand.EventNumber);
-					if(!muSelectorName.empty()){
+					if(!muSelectorName.empty() && !targetCand.Overlap){
 						m_data->ApplyCut(muSelectorName, m_unique_name,
 						                 targetCand.matchedParticleEvNum.size());
 					}
@@ -4,6 +4,7 @@
 #include "TH1.h"
 #include "THStack.h"
 #include <cmath>
+#include <algorithm>
 #include <bitset>
 #include "geotnkC.h"  // for SK tank geometric constants
 #include "type_name_as_string.h"
@@ -48,6 +49,7 @@ bool RelicMuonPlots::Initialise(std::string configfile, DataModel &data){
 		return false;
 	}
 	muReader = m_data->Trees.at(muReaderName);
+	muonPlanner.SetLoader([this](int entry, muon_record& record){ return LoadMuon(entry, record); });
 	
 	// make output files
 	m_variables.Get("outputFile", outputFile);  // pair (spall) variables
@@ -102,44 +104,29 @@ bool RelicMuonPlots::Execute(){
 	std::cout<<"relicTimeDiffs is of size "<<relicTimeDiffs->size()<<" vs "
 	         <<relicMatchedEntryNums->size()<<" matches"<<std::endl;
 	
-	// scan for dups
-	std::set<int> unique_muon_entry_nums;
-	std::vector<int> unique_entry_posns;
-	for(size_t i=0; i<relicMatchedEntryNums->size(); ++i){
-		int next_mu_ent_num = relicMatchedEntryNums->at(i);
-		if(unique_muon_entry_nums.emplace(next_mu_ent_num).second==false){
-			Log(m_unique_name+" removing duplicate muon "+toString(next_mu_ent_num)
-			    +" in matches for relic "+toString(relicEntryNum),v_error,m_verbose);
-		} else {
-			unique_entry_posns.push_back(i);
-		}
+	// get the matched muons without duplicates and in entry order, reading only those
+	// not already read for previous relics
+	size_t n_duplicates = muonPlanner.Plan(*relicMatchedEntryNums);
+	if(n_duplicates>0){
+		Log(m_unique_name+" removed "+toString(n_duplicates)+" duplicate muons in matches for relic "
+		    +toString(relicEntryNum),v_error,m_verbose);
 	}
 	
-	//for(size_t i=0; i<relicMatchedEntryNums->size(); ++i){
-	for(size_t u=0; u<unique_entry_posns.size(); ++u){
-		
-		int i=unique_entry_posns.at(u);
-		
-		// get the next matched muon entry number in muon tree
-		muEntryNum = relicMatchedEntryNums->at(i);
+	for(auto&& apair : muonPlanner){
 		
-		// sanity check that this pair is unique
-		std::pair<int,int> pair2{relicEntryNum,muEntryNum};
-		if(pairs_compared2.count(pair2)!=0){
-			Log(m_unique_name+" Error! Duplicate comparison between relic entry "+toString(relicEntryNum)
-			    +" and muon entry "+toString(muEntryNum),v_error,m_verbose);
-			return false;
-		}
-		pairs_compared2.emplace(pair2);
-		
-		// get the muon entry
-		get_ok = GetMuonEvt();
-		if(!get_ok){
+		muEntryNum = apair.entry;
+		if(apair.record==nullptr){
 			Log(m_unique_name+" Error getting muon entry "+toString(muEntryNum),v_error,m_verbose);
 			continue;
 		}
+		muRecord = apair.record;
+		muEvNum = muRecord->nevsk;
+		muon_entrypoint = const_cast<float*>(muRecord->entrypoint);
+		muon_direction = const_cast<float*>(muRecord->direction);
+		muon_tracklen = muRecord->tracklen;
 		
 		// sanity check that this pair is unique
+		std::pair<int,int> pair2{relicEntryNum,muEntryNum};
 		std::pair<int,int> pair{relicEvNum,muEvNum};
 		if(evmap.count(pair)!=0){
 			Log(m_unique_name+" Error! Duplicate comparison between relic "+toString(relicEvNum)
@@ -151,7 +138,7 @@ bool RelicMuonPlots::Execute(){
 		}
 		evmap.emplace(std::pair<std::pair<int,int>,std::pair<int,int>>{pair,pair2});
 		
-		dt = relicTimeDiffs->at(i);
+		dt = relicTimeDiffs->at(apair.match);
 		
 		get_ok = MakePairVariables();
 		if(get_ok) MakeHists(1);
@@ -166,6 +153,9 @@ bool RelicMuonPlots::Finalise(){
 	
 	MakeHists(2);
 	
+	Log(m_unique_name+" read "+toString(muonPlanner.NumRead())+" muon entries for "
+	    +toString(muonPlanner.NumRead()+muonPlanner.NumReused())+" muon-relic pairs",v_message,m_verbose);
+	
 	std::cout<<"found "<<spall_count<<" spall candidates (muon before relic) "
 	         <<"and "<<rand_count<<" random candidates (muon after relic)"<<std::endl;
 	
@@ -508,6 +498,26 @@ bool RelicMuonPlots::GetMuonEvt(){
 	return get_ok;
 }
 
+bool RelicMuonPlots::LoadMuon(int entry, muon_record& record){
+	
+	// read a muon entry and keep what we need to pair it with relics
+	muEntryNum = entry;
+	if(!GetMuonEvt()) return false;
+	
+	record.nevsk = muEvNum;
+	record.nrunsk = muHeader->nrunsk;
+	record.muqismsk = muMu->muqismsk;
+	std::copy(muon_entrypoint, muon_entrypoint+3, record.entrypoint);
+	std::copy(muon_direction, muon_direction+3, record.direction);
+	record.tracklen = muon_tracklen;
+	// seems like scotts is the latest
+	record.dedx.assign(std::begin(muMu->muboy_dedx), std::end(muMu->muboy_dedx));
+	//float (&kirk_dedx_arr)[200] = *(float(*)[200])(&muMu->muinfo[10]);
+	//record.dedx.assign(std::begin(kirk_dedx_arr), std::end(kirk_dedx_arr));
+	
+	return true;
+}
+
 double RelicMuonPlots::CalculateTrackLen(float* muon_entrypoint, float* muon_direction, double* exitpt){
 	
 	// for reference HITKTK is the water volume height and DITKTK is its diameter,
@@ -625,33 +635,8 @@ bool RelicMuonPlots::MakePairVariables(){
 	std::cout<<"relic nevsk: "<<relicEvNum<<", muon nevsk: "<<muEvNum
 	         <<"; spall cand? "<<(mu_before_relic ? "Y" : "N")<<std::endl;
 	
-	basic_array<float> scott_dedx(muMu->muboy_dedx);
-	//float (*kirk_dedx_arr)[200] = (float(*)[200])(muMu->muinfo+10);
-	float (&kirk_dedx_arr)[200] = *(float(*)[200])(&muMu->muinfo[10]);
-	basic_array<float> kirk_dedx(kirk_dedx_arr);
-	
-	
-	// debug check
-	/*
-	std::cout<<"scott's dedx: size "<<scott_dedx.size()<<" at "<<scott_dedx.data()<<std::endl;
-	for(int i=0; i<std::min(200,scott_dedx.size()); ++i){
-		if(i>0) std::cout<<", ";
-		std::cout<<scott_dedx.at(i);
-	}
-	std::cout<<"}"<<std::endl;
-	*/
-	/*
-	std::cout<<"kirk's dedx: size "<<kirk_dedx.size()<<" at "<<kirk_dedx.data()<<std::endl;
-	for(int i=0; i<std::min(200,kirk_dedx.size()); ++i){
-		if(i>0) std::cout<<", ";
-		std::cout<<kirk_dedx.at(i);
-	}
-	std::cout<<"}"<<std::endl;
-	*/
-	
-	// seems like scotts is the latest
-	muon_dedx = const_cast<float*>(scott_dedx.data());
-	//muon_dedx = const_cast<float*>(kirk_dedx.data());
+	// dE/dx along the track, from scott's (see LoadMuon)
+	muon_dedx = const_cast<float*>(muRecord->dedx.data());
 	
 	// find position of max dedx
 	// defined as bin where a sliding window of 4.5m (9x 50cm bins) has maximum sum
@@ -679,21 +664,21 @@ bool RelicMuonPlots::MakePairVariables(){
 	std::cout<<"scanning petable for pe_to_coulombs conversion"<<std::endl;
 	while(pe_per_coulomb == 0 && pe_table_index < petable_startrun.size()){
 		std::cout<<"entry "<<pe_table_index<<std::endl;
-		if(petable_startrun[pe_table_index] <= muHeader->nrunsk && petable_endrun[pe_table_index] >= muHeader->nrunsk){
+		if(petable_startrun[pe_table_index] <= muRecord->nrunsk && petable_endrun[pe_table_index] >= muRecord->nrunsk){
 		    pe_per_coulomb = pe_to_coulombs[pe_table_index][1];
 		    break;
 		}
 		pe_table_index++;
 	}
 	if(pe_table_index==petable_startrun.size()){
-		Log(m_unique_name+" Error! Did not find run "+toString(muHeader->nrunsk)+" in petable!",v_error,m_verbose);
+		Log(m_unique_name+" Error! Did not find run "+toString(muRecord->nrunsk)+" in petable!",v_error,m_verbose);
 		// use a nominal value?
 		pe_per_coulomb = 30;
 	}
 	
 	// XXX not sure why pe_per_cm is in this formula?
 	std::cout<<"calculating observed pe from this muon"<<std::endl;
-	double pe_from_muon = muMu->muqismsk * (pe_per_cm / pe_per_coulomb);  // pe*cm^-1 / pe*C^-1 = C/cm
+	double pe_from_muon = muRecord->muqismsk * (pe_per_cm / pe_per_coulomb);  // pe*cm^-1 / pe*C^-1 = C/cm
 	// mu_info.C calculates this based on tracklen from muboy (resq_tmp), tracklen calculated
 	// based on muboy secondary track entry point and muboy dir (resq_sprt_tmp, for mutiple muons)
 	// and calculated tracklen BFF track (resq_sprt_tmp_bff)
@@ -10,6 +10,7 @@
 #include "Tool.h"
 #include "HistogramBuilder.h"
 #include "MTreeReader.h"
+#include "MatchedPairPlanner.h"
 
 /**
 * \class RelicMuonPlots
@@ -50,7 +51,6 @@ class RelicMuonPlots: public Tool {
 	std::map<int,int> relic_nevsks; // FIXME this shouldn't be needed!
 	std::map<int,int> muon_nevsks;
 	std::set<std::pair<int,int>> pairs_compared;   // FIXME this shouldn't be needed!
-	std::set<std::pair<int,int>> pairs_compared2;   // FIXME this shouldn't be needed!
 	std::map<std::pair<int,int>,std::pair<int,int>> evmap;
 	std::map<std::pair<int,int>, int> muon_pair_plotted;
 	std::map<int,int> muon_plotted;
@@ -92,6 +92,21 @@ class RelicMuonPlots: public Tool {
 	TQReal* muTQReal=nullptr;
 	TQReal* muTQAReal=nullptr;
 	
+	// what we need of a muon to pair it with relics, kept for following relics
+	// so that each muon entry is read once rather than for every relic it's matched to
+	struct muon_record {
+		int nevsk=0;
+		int nrunsk=0;
+		float muqismsk=0;
+		float entrypoint[3]={};
+		float direction[3]={};
+		double tracklen=0;
+		std::vector<float> dedx;
+	};
+	MatchedPairPlanner<muon_record> muonPlanner;
+	const muon_record* muRecord=nullptr;
+	bool LoadMuon(int entry, muon_record& record);
+	
 	// for tracking rates:
 	int64_t lastmuticks=0;
 	int lastmu_nevsk=0;
@@ -13,6 +13,7 @@ bool RunwiseEnergyCut::Initialise(std::string configfile, DataModel &data){
 	m_log= m_data->Log;
 	
 	if(!m_variables.Get("verbosity",m_verbose)) m_verbose=1;
+	m_variables.Get("useRunConditions",useRunConditions);
 	
 	if(!ParseOptions(configfile)){
 		m_data->vars.Set("StopLoop",1);
@@ -44,23 +45,19 @@ bool RunwiseEnergyCut::Execute(){
 	
 	float reconEnergy = skroot_lowe_.bsenergy;
 	
-	bool rejected=false;
-	for(auto&& acut : cuts){
-		int runmin = acut.first.first;
-		int runmax = acut.first.second;
-		if(runmin>0 && runmin <= skhead_.nrunsk) continue;
-		if(runmax>0 && runmax >= skhead_.nrunsk) continue;
-		if(reconEnergy < acut.second.first){  rejected=true; break; }
-		if(reconEnergy > acut.second.second){ rejected=true; break; }
+	// the cuts covering each run have been combined into a single range, so this is one lookup
+	bool rejected = !energyCuts.Get(skhead_.nrunsk).AcceptsEnergy(reconEnergy);
+	if(useRunConditions && !m_data->runConditions.Get(skhead_.nrunsk).AcceptsEnergy(reconEnergy)){
+		rejected=true;
 	}
 	
-	if(!rejected){
+	if(rejected){
 		Nskipped++;
 		m_data->vars.Set("Skip", true);
 		return true;
 	}
 	
-	if(!selectorName.empty() && !rejected) m_data->ApplyCut(selectorName, m_unique_name, reconEnergy);
+	if(!selectorName.empty()) m_data->ApplyCut(selectorName, m_unique_name, reconEnergy);
 	
 	Log(m_unique_name+" Event passed with energy: "+toString(skroot_lowe_.bsenergy),v_debug,m_verbose);
 	
@@ -83,18 +80,18 @@ bool RunwiseEnergyCut::ParseOptions(std::string& configfile){
 		Log(m_unique_name+" Error opening config file "+configfile,v_error,m_verbose);
 		return false;
 	}
-	std::stringstream ss;
 	std::string key;
 	int startrun, endrun;
 	float minE, maxE;
 	while(getline(infile, line)){
 		if(line.empty()) continue;
-		ss.str(line);
-		if(!(ss >> key)) break; // ?? what happened?
+		std::istringstream ss(line);
+		if(!(ss >> key)) continue;
 		if(key[0]=='#') continue;
 		if(key!="cut") continue;
 		if(!(ss >> startrun >> endrun >> minE >> maxE)) continue;
-		cuts.emplace_back(std::pair<int,int>{startrun, endrun}, std::pair<int,int>{minE, maxE});
+		cuts.emplace_back(std::pair<int,int>{startrun, endrun}, std::pair<float,float>{minE, maxE});
+		energyCuts.AddEnergyRange(startrun, endrun, minE, maxE);
 	}
 	
 	if(m_verbose >= v_debug){
@@ -106,7 +103,7 @@ bool RunwiseEnergyCut::ParseOptions(std::string& configfile){
 		std::cout<<std::flush;
 	}
 	
-	if(cuts.empty()){
+	if(cuts.empty() && !useRunConditions){
 		Log(m_unique_name+" Error! Found no valid cut specifications in config file!",v_error,m_verbose);
 		return false;
 	}
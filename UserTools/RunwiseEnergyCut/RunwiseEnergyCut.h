@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "Tool.h"
+#include "RunConditions.h"
 
 /**
 * \class RunwiseEnergyCut
@@ -31,7 +32,9 @@ class RunwiseEnergyCut: public Tool {
 	private:
 	std::string selectorName;
 	int Nskipped = 0;
+	bool useRunConditions = false;   // also apply the energy ranges of m_data->runConditions
 	std::vector<std::pair<std::pair<int,int>,std::pair<float,float>>> cuts;
+	RunConditions energyCuts;        // the above, resolved by run
 };
 
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <bitset>
 #include <iomanip>
+#include <stdexcept>
 
 
 #include "MTreeReader.h"
@@ -12,8 +13,6 @@
 #include "TableReader.h"
 #include "TableEntry.h"
 
-#include <algorithm>
-
 #include "TH1D.h"
 
 SLESearch::SLESearch():Tool(){}
@@ -35,6 +34,29 @@ bool SLESearch::Initialise(std::string configfile, DataModel &data){
 
   max_triggers = -999;
   m_variables.Get("max_triggers", max_triggers);
+
+  // SLE trigger: the SLE window is 1.5us, with no deadtime
+  software_trigger_type sle;
+  sle.name = "SLE";
+  sle.trigger_id = 0;
+  sle.detector = 0;
+  if(!m_variables.Get("SLE_threshold", sle.threshold)) sle.threshold = 35;  // hits in 200ns
+  if(!m_variables.Get("SLE_window", sle.window)) sle.window = 200;
+  if(!m_variables.Get("SLE_readout_length", sle.post_t0)) sle.post_t0 = 1501.56;
+  if(!m_variables.Get("SLE_deadtime", sle.deadtime)) sle.deadtime = 0;
+  // the reported SLE time: by default the median hit time of the 200ns window that fired,
+  // or the time of the hit that took the window over threshold
+  if(!m_variables.Get("SLE_time_definition", SLE_time_definition)) SLE_time_definition = "median";
+  if (SLE_time_definition != "median" && SLE_time_definition != "crossing"){
+    throw std::runtime_error("SLESearch::Initialise - unknown SLE_time_definition "+SLE_time_definition
+                             +", should be median or crossing");
+  }
+  // triggers are found in the hit time frame; any offset to the primary trigger t0
+  // is added to the reported times only, so it does not shift the readout and holdoff
+  sle.t0_offset = 0;
+  sle_window = sle.window;
+  sle_trigger.AddTriggerType(sle);
+  sorted_hits.resize(1);
   
   return true;
 }
@@ -72,187 +94,39 @@ bool SLESearch::Execute(){
 
   /* 
      SLE search algorithm:
-     1. Construct vector of hits from event
-     2. sort hits in time order
-     3. Starting at the first hit, construct a deque of the first [window size] hits
-     4. is number of hits in the window greater than SLE threshold?
-     5. Yes to 4? Use "algorithm" to determine the timing of the SLE trigger (eg median or quantile calculation)
-     6. move start of trigger search to time of SLE trigger + trigger deadtime
-     7. Store new SLE time
-     8. Drop the first hit from the beginning of the window
-     9. Add on hits not already in the deque until the window size (last hit time - first hit time) is back up to [window_length]
-     10. Loop steps 4 to 9 until all last hit in window == last hit in event
-
+     1. Construct vector of hits from event, sorted in time order
+     2. Scan forward through the hits, keeping the window of hits within [window_size] of the current hit
+     3. When the number of hits in the window reaches the SLE threshold, store the trigger time
+     4. Skip forward past the SLE readout (+ deadtime) and continue the scan
+     This is done by the SoftwareTrigger engine in a single pass over the hits.
   */
   std::vector<double> SLE_times;
-  double current_SLE_time = 0;
-      
-  // 1. Construct vector of hits from event
-  // std::cout << "constructing vector of hits from event" << std::endl;
-  std::vector<double> hits = std::vector<double>(sktqz_.tiskz, sktqz_.tiskz + sktqz_.nqiskz);
-  std::vector<double> first_hit_times;
-
-  //event_hit_times_plot = TH1D("event_hit_times_plot", "event_hit_times_plot", 200, hits.front(), hits.back());
   
-  // 2. sort hits in time order
-  // std::cout << "sorting hits into time order" << std::endl;
-  std::sort(hits.begin(), hits.end());
-
-  //for (const auto& time : hits){event_hit_times_plot.Fill(time);}
+  // 1. Construct vector of hits from event, sorted in time order
+  SoftwareTrigger::SortedHitTimes(sktqz_.tiskz, sktqz_.nqiskz, sorted_hits.front());
   
-  // 3. Starting from the first hit, construct a deque of the first [window size] hits
-  const double window_size = 200;
-
-  std::deque<double> window = {};
-
-  // std::cout << "hits.size(): " << hits.size() << std::endl;
-  // std::cout << "hits.front(): " << hits.front() << std::endl;
-  // std::cout << "hits.back(): " << hits.back() << std::endl;
-  // std::cout<<"event window length: "<<(hits.back()-hits.front())<<" ns"<<std::endl;
-  // std::cout<<"window length: "<<window_size<<" ns"<<std::endl;
-  size_t next_hit_idx = 0;
-  for (size_t i = 0; i < hits.size(); ++i){
-    if (hits.at(i) - hits.front() < window_size){
-      window.push_back(hits.at(i));
-    } else {
-      next_hit_idx = i;
-      break;
+  // 2.-4. scan for SLE triggers
+  sle_trigger.Run(sorted_hits);
+  const double time_offset = include_offset ? SLE_t0_offset : 0;
+  const std::vector<double>& times = sorted_hits.front();
+  for (const software_trigger& atrigger : sle_trigger.GetTriggers()){
+    double SLE_time = atrigger.t0;
+    if (SLE_time_definition == "median"){
+      // median of the hits within the window starting from the first hit of the triggering window
+      const auto window_begin = times.begin() + atrigger.first_hit;
+      const auto window_end = std::lower_bound(window_begin, times.end(), *window_begin + sle_window);
+      SLE_time = *(window_begin + (window_end - window_begin)/2);
     }
-  }
-
-  const int SLE_threshold = 34;
-  const double SLE_deadtime = 0; // assume no deadtime?
-  const double SLE_readout_length = 1501.56; //nope
-
-  // std::cout<<"initial hits window had "<<window.size()<<" hits vs threshold "<<SLE_threshold<<std::endl;
-
-  //  while (window.back() != hits.back()){
-  //std::cout<<"window front index: "<<next_hit_idx<<std::endl;
-  while ( (next_hit_idx != hits.size()) && (window.back() != hits.back()) ){
-    //  std::cout << "next_hit_idx: " << next_hit_idx << std::endl;
-
-    // 4. is number of hits in the window greater than SLE threshold?
-    //const int SLE_threshold = GetTriggerThreshold(TriggerType::SLE);
-
-    if (window.size() > SLE_threshold){
-      //std::cout << "number of hits in window exceeds SLE threshold!" << std::endl;
-      //std::cout << " threshold exceeded with window.size(): " << window.size() << std::endl;
-      //std::cout << "hits size: " << hits.size() << " next hit idx: " << next_hit_idx << std::endl;
-      //std::cout << "before adding deadtime" << std::endl;
-      //      std::cout<< "at time: " << window.front() << ", window.back() at: " << window.back() << std::endl;
-
-      // std::cout << "window.front() at in ticks: " << (window.front() * COUNT_PER_NSEC) + skheadqb_.it0sk;
-      // std::cout << "window.back() at in ticks: " << (window.back() * COUNT_PER_NSEC) + skheadqb_.it0sk;
-      
-      first_hit_times.push_back(window.front() + (include_offset ? SLE_t0_offset : 0));
-
-      // 5. Yes to 4? Use "algorithm" to determine the timing of the SLE trigger (eg median or quantile calculation)
-      // since this may not be accurate for where the hit cluster is, maybe also try to better estimate it
-      current_SLE_time = window.at(static_cast<size_t>(window.size() / 2)); //shit - fix this
-      //std::cout << "sum: " << std::accumulate(window.begin(), window.end(), 0.0) << std::endl;
-      // double this_SLE_time = 0;
-      //      for (int i = ; 
-      // 7. Store new SLE time
-      //std::cout << "estimated SLE time: " << current_SLE_time << std::endl;
-      if (current_SLE_time > 0){
-	hit_times_plot.Fill(current_SLE_time);
-	SLE_times.push_back(current_SLE_time);
-      } else {
-	//std::cout << "SLE time was before primary trigger - so we ignore" << std::endl; 
-      }
-	
-      /*std::cout << "some hits: " << std::endl;
-	for (int i = 0; i < window.size(); ++i){
-	if (i % 50 == 0){std::cout << window.at(i) << std::endl;}
-	}*/
-      
-      // 6. move start of trigger search to start of trigger window + trigger window length + trigger deadtime
-
-      // 6a. add on SLE_deadtime worth of hits
-      double new_start_time = window.front() + SLE_readout_length + SLE_deadtime;
-      //std::cout << "last_hit_in_window_time: " << last_hit_in_window_time << std::endl;
-      //std::cout << "last hit in event time " << hits.back() << std::endl;
-      //std::cout<<"scanning forward by readout lenght "<<SLE_readout_length<<" + deadtime "<<SLE_deadtime
-      //<<" from end of window "<<new_start_time<<" ns -> new start time "<<new_start_time << " ns"<<std::endl;
-      for (size_t i = next_hit_idx; i < hits.size(); ++i){
-	++next_hit_idx; // next hit to consider
-	//if (hits.at(i) - new_start_time < SLE_deadtime){
-        if(hits.at(i) < new_start_time){
-	  //if (i % 1000 == 0){ std::cout << "hits.at(i): " << hits.at(i) << std::endl;}
-	  //window.push_back(hits.at(i));
-	} else {
-	  break;
-	}
-      }
-      //      std::cout << "added SLE deadtime: " << SLE_deadtime << std::endl;
-      //     std::cout << "after adding on dead time" << std::endl;
-      //      std::cout<< "window.front(): " << window.front() << ", window.back(): " << window.back() << std::endl;
-      
-      // 6b. remove hits from the front of the window so that the window returns back to its proper size
-      // empty the window
-      window.clear();
-      // re-fill the new trigger window
-      for (size_t i = next_hit_idx; i < hits.size(); ++i){
-	if (hits.at(i) - hits.at(next_hit_idx) < window_size){
-	  window.push_back(hits.at(i));
-	} else {
-	  next_hit_idx = i;
-	  break;
-	}
-      }
-      /*
-	last_hit_in_window_time = window.back();
-	window.erase(std::remove_if(window.begin(), window.end(),
-	[ last_hit_in_window_time, window_size](const double& hit){
-	return last_hit_in_window_time - hit > window_size;
-	}), window.end());
-	std::cout << "after removing hits so the window has its original size" << std::endl;
-	std::cout<< "window.front(): " << window.front() << ", window.back(): " << window.back() << std::endl;
-      */
-
-      // // 6b*. construct new window, with same length, with start time equal to old first time + deadtime
-      // const double last_hit_in_window_time = window.back();
-      // for (size_t i = next_hit_idx; i < hits.size()){
-      // 	if (hits.at(i) - last_hit_in_window_time < SLE_deadtime){
-      // 	  ++next_hit_idx;
-      // 	} else {
-      // 	  next_hit_idx = i;
-      // 	  break;
-      // 	}
-      // }
-      
-      // window.clear();
-      // for (size_t i = next_hit_idx; i < hits.size(); ++i){
-      // 	if (hits.at(i) - hits.front() < window_size){
-      // 	  window.push_back(hits.at(i));
-      // 	} else {
-      // 	  next_hit_idx = i;
-      // 	  break;
-      // 	}
-      // }
-            
-    }
-
-    // 8. Drop the first hit from the beginning of the window
-    else {
-      if (window.size() > 0){window.pop_front();}
-      // 9. Add on hits not already in the deque until the window size (last hit time - first hit time) is back up to [window_size]
-      //std::cout << "e0" << std::endl;
-      for (size_t i = next_hit_idx; i < hits.size(); ++i){
-        //std::cout << "i: " << i << "   next hit idx: " << next_hit_idx << std::endl;
-        if ((window.size() == 0) || (window.back() - window.front() < window_size)){
-	  ++next_hit_idx;
-	  window.push_back(hits.at(i));
-        } else {
-	  break;
-        }
-      }
+    // we don't want triggers before the primary trigger
+    if (SLE_time > 0){
+      hit_times_plot.Fill(SLE_time + time_offset);
+      SLE_times.push_back(SLE_time + time_offset);
     }
   }
 
   // we don't want the primary trigger either - aka muon not the neutrons
 
-  if (max_triggers != -999){
+  if (max_triggers != -999 && SLE_times.size() > size_t(max_triggers)){
     SLE_times.resize(max_triggers);
   }
   
@@ -5,6 +5,7 @@
 #include <iostream>
 
 #include "Tool.h"
+#include "SoftwareTrigger.h"
 
 #include "TH1D.h"
 
@@ -29,6 +30,11 @@ class SLESearch: public Tool {
   
   double TimeOfFlight(const float*, const float*) const;
 
+  std::string SLE_time_definition = "median";  // or "crossing"
+  double sle_window = 200;
+  SoftwareTrigger sle_trigger;
+  std::vector<std::vector<double>> sorted_hits;  // ID hits, reused between events
+
   TH1D hit_times_plot;
   TH1D event_hit_times_plot;
   
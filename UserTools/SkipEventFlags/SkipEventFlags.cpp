@@ -2,7 +2,6 @@
 
 #include "fortran_routines.h" // for access to skhead_.ifevsk
 #include "Constants.h"
-#include "MTreeSelection.h"
 #include <bitset>
 
 SkipEventFlags::SkipEventFlags():Tool(){}
@@ -23,21 +22,8 @@ bool SkipEventFlags::Initialise(std::string configfile, DataModel &data){
 	// if saving the passing events to an MTreeSelection...
 	get_ok = m_variables.Get("selectorName", selectorName);
 	if(get_ok){
-		std::string description="";
-		if(allowedFlags.size()){
-			description="allowed flags: {";
-			for(int i=0; i<allowedFlags.size(); ++i){
-				if(i>0) description+=", ";
-				description+=std::to_string(allowedFlags.at(i));
-			}
-		} else {
-			description="rejected flags: {";
-			for(int i=0; i<skippedFlags.size(); ++i){
-				if(i>0) description+=", ";
-				description+=std::to_string(skippedFlags.at(i));
-			}
-		}
-		m_data->AddCut(selectorName, m_unique_name, description,false);
+		m_data->AddCut(selectorName, m_unique_name, flagCuts.Description(0),false);
+		if(!flagCuts.RecordIn(m_data->Selectors, selectorName)) return false;
 	}
 	
 	return true;
@@ -46,34 +32,12 @@ bool SkipEventFlags::Initialise(std::string configfile, DataModel &data){
 
 bool SkipEventFlags::Execute(){
 	
-	std::bitset<sizeof(int)*8> flags_bits = skhead_.ifevsk;
-	
 	// debug prints
 	if(m_verbose >= v_debug) PrintFlags();
 	
-	bool skipit=false;
-	// specify only the types we do want
-	if(allowedFlags.size()){
-		skipit = true;
-		for(size_t bit_i=0; bit_i<allowedFlags.size(); ++bit_i){
-			int test_bit = allowedFlags.at(bit_i);
-			if(flags_bits.test(test_bit)){
-				skipit=false;
-			}
-		}
-	}
-	
-	// skip all events matching flags types in skippedFlags
-	for(size_t bit_i=0; bit_i<skippedFlags.size(); ++bit_i){
-		int test_bit = skippedFlags.at(bit_i);
-		if(flags_bits.test(test_bit)){
-			skipit=true; // skip this event
-		}
-	}
-	
-	if(skipit) m_data->vars.Set("Skip", true); // skip this event
-	
-	if(!selectorName.empty() && !skipit) m_data->AddPassingEvent(selectorName, m_unique_name);
+	// skip events with any of the skipped bits set, or none of the allowed ones.
+	// Passing events are recorded in the selector by FlagCuts.
+	if(flagCuts.Apply(skhead_.idtgsk, skhead_.ifevsk)>=0) m_data->vars.Set("Skip", true);
 	
 	return true;
 }
@@ -112,52 +76,22 @@ bool SkipEventFlags::ParseOptions(std::string configfile){
 	}
 	ifile.close();
 	
-	std::stringstream allowedFlagsSS(allowedFlagsString);
-	std::stringstream skippedFlagsSS(skippedFlagsString);
-	// parse the allowedFlagsString for allowed flags
-	std::string next_flag;
-	while(allowedFlagsSS >> next_flag){
-		if(next_flag[0]=='#') break; // trailing comments
-		if(constants::string_to_flag_SKIV.count(next_flag)){
-			allowedFlags.push_back(constants::string_to_flag_SKIV.at(next_flag));
-			continue;
-		}
-		if(constants::string_to_flag_SKI_III.count(next_flag)){
-			allowedFlags.push_back(constants::string_to_flag_SKI_III.at(next_flag));
-			continue;
-		}
-		try{
-			int next_bit = stoi(next_flag);
-			allowedFlags.push_back(next_bit);
-		} catch (...) {
-			Log(m_unique_name+" error parsing allowed flag '"+next_flag+"'",v_error,m_verbose);
-			return false;
-		}
+	uint32_t allowed_mask=0, skipped_mask=0;
+	std::string bad_entry;
+	if(!FlagCuts::ParseBits(allowedFlagsString, FlagCuts::event_flag, allowed_mask, &bad_entry)){
+		Log(m_unique_name+" error parsing allowed flag '"+bad_entry+"'",v_error,m_verbose);
+		return false;
 	}
-	// same for skippedFlagString
-	while(skippedFlagsSS >> next_flag){
-		if(next_flag[0]=='#') break; // trailing comments
-		if(constants::string_to_flag_SKIV.count(next_flag)){
-			skippedFlags.push_back(constants::string_to_flag_SKIV.at(next_flag));
-			continue;
-		}
-		if(constants::string_to_flag_SKI_III.count(next_flag)){
-			skippedFlags.push_back(constants::string_to_flag_SKI_III.at(next_flag));
-			continue;
-		}
-		try{
-			int next_bit = stoi(next_flag);
-			skippedFlags.push_back(next_bit);
-		} catch (...) {
-			Log(m_unique_name+" error parsing skipped flag '"+next_flag+"'",v_error,m_verbose);
-			return false;
-		}
+	if(!FlagCuts::ParseBits(skippedFlagsString, FlagCuts::event_flag, skipped_mask, &bad_entry)){
+		Log(m_unique_name+" error parsing skipped flag '"+bad_entry+"'",v_error,m_verbose);
+		return false;
 	}
 	
-	if(skippedFlags.empty() && allowedFlags.empty()){
+	if(skipped_mask==0 && allowed_mask==0){
 		Log(m_unique_name+" Error! No 'skippedFlags' nor 'allowedFlags' in config file!",v_error,m_verbose);
 		return false;
 	}
+	flagCuts.AddCut(m_unique_name, FlagCuts::event_flag, skipped_mask, allowed_mask);
 	
 	return true;
 }
@@ -2,7 +2,6 @@
 
 #include "fortran_routines.h" // for access to skhead_.idtgsk
 #include "Constants.h"
-#include "MTreeSelection.h"
 #include <bitset>
 
 SkipTriggers::SkipTriggers():Tool(){}
@@ -23,21 +22,8 @@ bool SkipTriggers::Initialise(std::string configfile, DataModel &data){
 	// if saving the passing events to an MTreeSelection...
 	get_ok = m_variables.Get("selectorName", selectorName);
 	if(get_ok){
-		std::string description="";
-		if(allowedTriggers.size()){
-			description="allowed triggers: {";
-			for(int i=0; i<allowedTriggers.size(); ++i){
-				if(i>0) description+=", ";
-				description+=std::to_string(allowedTriggers.at(i));
-			}
-		} else {
-			description="rejected triggers: {";
-			for(int i=0; i<skippedTriggers.size(); ++i){
-				if(i>0) description+=", ";
-				description+=std::to_string(skippedTriggers.at(i));
-			}
-		}
-		m_data->AddCut(selectorName, m_unique_name, description,false);
+		m_data->AddCut(selectorName, m_unique_name, flagCuts.Description(0),false);
+		if(!flagCuts.RecordIn(m_data->Selectors, selectorName)) return false;
 	}
 	
 	return true;
@@ -46,34 +32,12 @@ bool SkipTriggers::Initialise(std::string configfile, DataModel &data){
 
 bool SkipTriggers::Execute(){
 	
-	std::bitset<sizeof(int)*8> trigger_bits = skhead_.idtgsk;
-	
 	// debug prints
 	if(m_verbose >= v_debug) PrintTriggers();
 	
-	bool skipit=false;
-	// specify only the types we do want
-	if(allowedTriggers.size()){
-		skipit = true;
-		for(size_t bit_i=0; bit_i<allowedTriggers.size(); ++bit_i){
-			int test_bit = allowedTriggers.at(bit_i);
-			if(trigger_bits.test(test_bit)){
-				skipit=false;
-			}
-		}
-	}
-	
-	// skip all events matching trigger types in skippedTriggers
-	for(size_t bit_i=0; bit_i<skippedTriggers.size(); ++bit_i){
-		int test_bit = skippedTriggers.at(bit_i);
-		if(trigger_bits.test(test_bit)){
-			skipit=true; // skip this event
-		}
-	}
-	
-	if(skipit) m_data->vars.Set("Skip", true); // skip this event
-	
-	if(!selectorName.empty() && !skipit) m_data->AddPassingEvent(selectorName, m_unique_name);
+	// skip events with any of the skipped bits set, or none of the allowed ones.
+	// Passing events are recorded in the selector by FlagCuts.
+	if(flagCuts.Apply(skhead_.idtgsk, skhead_.ifevsk)>=0) m_data->vars.Set("Skip", true);
 	
 	return true;
 }
@@ -117,44 +81,22 @@ bool SkipTriggers::ParseOptions(std::string configfile){
 		Log(m_unique_name+" Error! Please specify either allowed or skipped triggers, not both",v_error,m_verbose);
 		return false;
 	}
-	std::stringstream allowedTriggersSS(allowedTriggersString);
-	std::stringstream skippedTriggersSS(skippedTriggersString);
-	// parse the allowedTriggersString for allowed triggers
-	std::string next_trig;
-	while(allowedTriggersSS >> next_trig){
-		if(next_trig[0]=='#') break; // trailing comments
-		if(TriggerNameToID(next_trig)>=0){
-			allowedTriggers.push_back(TriggerNameToID(next_trig));
-			continue;
-		}
-		try{
-			int next_bit = stoi(next_trig);
-			allowedTriggers.push_back(next_bit);
-		} catch (...) {
-			Log(m_unique_name+" error parsing allowed trigger '"+next_trig+"'",v_error,m_verbose);
-			return false;
-		}
+	uint32_t allowed_mask=0, skipped_mask=0;
+	std::string bad_entry;
+	if(!FlagCuts::ParseBits(allowedTriggersString, FlagCuts::trigger, allowed_mask, &bad_entry)){
+		Log(m_unique_name+" error parsing allowed trigger '"+bad_entry+"'",v_error,m_verbose);
+		return false;
 	}
-	// same for skippedTriggersString
-	while(skippedTriggersSS >> next_trig){
-		if(next_trig[0]=='#') break; // trailing comments
-		if(TriggerNameToID(next_trig)>=0){
-			skippedTriggers.push_back(TriggerNameToID(next_trig));
-			continue;
-		}
-		try{
-			int next_bit = stoi(next_trig);
-			skippedTriggers.push_back(next_bit);
-		} catch (...) {
-			Log(m_unique_name+" error parsing skipped trigger '"+next_trig+"'",v_error,m_verbose);
-			return false;
-		}
+	if(!FlagCuts::ParseBits(skippedTriggersString, FlagCuts::trigger, skipped_mask, &bad_entry)){
+		Log(m_unique_name+" error parsing skipped trigger '"+bad_entry+"'",v_error,m_verbose);
+		return false;
 	}
 	
-	if(skippedTriggers.empty() && allowedTriggers.empty()){
+	if(skipped_mask==0 && allowed_mask==0){
 		Log(m_unique_name+" Error! No 'skippedTriggers' nor 'allowedTriggers' in config file!",v_error,m_verbose);
 		return false;
 	}
+	flagCuts.AddCut(m_unique_name, FlagCuts::trigger, skipped_mask, allowed_mask);
 	
 	return true;
 }
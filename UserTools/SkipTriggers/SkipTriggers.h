@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "Tool.h"
+#include "FlagCuts.h"
 
 
 /**
@@ -17,8 +18,6 @@
 * $Date: 2019/05/28 10:44:00 $
 */
 
-class MTreeSelection;
-
 class SkipTriggers: public Tool {
 	
 	public:
@@ -32,11 +31,9 @@ class SkipTriggers: public Tool {
 	void PrintTriggers();
 	
 	private:
-	std::vector<int> skippedTriggers;
-	std::vector<int> allowedTriggers;
+	FlagCuts flagCuts;
 	
 	std::string selectorName;
-	MTreeSelection* mySelector=nullptr;
 	
 };
 
@@ -1,5 +1,14 @@
 #include "SpectralFit.h"
 
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TGraph.h"
+#include "TH1D.h"
+
 SpectralFit::SpectralFit():Tool(){}
 
 bool SpectralFit::Initialise(std::string configfile, DataModel &data){
@@ -9,34 +18,277 @@ bool SpectralFit::Initialise(std::string configfile, DataModel &data){
 
   m_data= &data;
   m_log= m_data->Log;
-  
+
   if(!m_variables.Get("verbosity",m_verbose)) m_verbose=1;
-  
+
+  m_variables.Get("fit_threads", fit_threads);              // threads for profile scans and toys
+  m_variables.Get("scan_distribution", scan_distribution);  // normalisation to profile, -1 for none
+  m_variables.Get("scan_points", scan_n_points);
+  m_variables.Get("scan_min", scan_min);
+  m_variables.Get("scan_max", scan_max);                    // if <= scan_min, best fit + 5 sigma
+  m_variables.Get("n_toys", n_toys);                        // toys drawn from the nominal expectation
+  m_variables.Get("toy_seed", toy_seed);
+  m_variables.Get("outfile_name", outfile_name);
+
+  likelihood.SetVerbosity(m_verbose);
+  likelihood.SetNThreads(fit_threads);
+
   GetPDFs();
-  
+  GetNuisances();
+
   return true;
 }
 
 bool SpectralFit::Execute(){
 
-  // line up all regions along the x axis to make a global function
-  // normalise distributions across all regions
-  // construct functional fit
-  // do fit
-  // split up back into region plots
-  // be happy
-
-  // for (int i = 0; i < N_distributions){
-    
-  // }
-  
+  // all regions are lined up along one global bin axis, with the distributions
+  // normalised across all regions, so one fit covers every region at once
+  Log(m_unique_name+" fitting "+std::to_string(likelihood.GetNDistributions())+" distributions across "
+      +std::to_string(likelihood.GetNRegions())+" regions"+(asimov ? " (Asimov dataset)" : ""),v_message,m_verbose);
+  best_fit = likelihood.Fit();
+  if (best_fit.status != 0){
+    Log(m_unique_name+" Warning! Fit did not converge, status "+std::to_string(best_fit.status),v_warning,m_verbose);
+  }
+  for (size_t par = 0; par < likelihood.GetNpar(); ++par){
+    Log(m_unique_name+" "+likelihood.GetParName(par)+" = "+std::to_string(best_fit.values.at(par))
+        +" +- "+std::to_string(best_fit.errors.at(par)),v_message,m_verbose);
+  }
+
+  DoProfileScan();
+  DoToys();
+
+  // the fit only needs doing once
+  m_data->vars.Set("StopLoop",1);
+
   return true;
 }
 
 bool SpectralFit::Finalise(){
+
+  TFile* outfile = TFile::Open(outfile_name.c_str(), "RECREATE");
+  if (outfile == nullptr){
+    throw std::runtime_error("SpectralFit::Finalise - Couldn't open output file "+outfile_name);
+  }
+
+  // split the global fit back up into region plots
+  if (!best_fit.values.empty()){
+    for (size_t r = 0; r < likelihood.GetNRegions(); ++r){
+      const std::vector<double> edges = likelihood.GetRegionEdges(r);
+      const std::string region = "r"+std::to_string(r);
+      TH1D fit_hist((region+"_fit").c_str(), (region_names.at(r)+";Reconstructed Energy [MeV];Events").c_str(),
+                    edges.size()-1, edges.data());
+      TH1D data_hist(fit_hist);
+      data_hist.SetName((region+"_data").c_str());
+      const std::vector<double> expected = likelihood.Expected(r, best_fit.values);
+      const std::vector<double> region_data = likelihood.GetData(r);
+      for (size_t b = 0; b < expected.size(); ++b){
+        fit_hist.SetBinContent(b+1, expected.at(b));
+        data_hist.SetBinContent(b+1, region_data.at(b));
+      }
+      data_hist.Write();
+      fit_hist.Write();
+      for (size_t d = 0; d < likelihood.GetNDistributions(); ++d){
+        TH1D component_hist(fit_hist);
+        component_hist.SetName((region+"_dist"+std::to_string(distribution_indices.at(d))).c_str());
+        component_hist.SetTitle((distribution_names.at(distribution_indices.at(d))+", "+region_names.at(r)).c_str());
+        const std::vector<double> component = likelihood.Expected(r, best_fit.values, d);
+        for (size_t b = 0; b < component.size(); ++b) component_hist.SetBinContent(b+1, component.at(b));
+        component_hist.Write();
+      }
+    }
+  }
+
+  // profile likelihood, relative to the global minimum
+  if (!scan_results.empty()){
+    TGraph profile(scan_points.size());
+    profile.SetName("profile_likelihood");
+    profile.SetTitle((distribution_names.at(scan_distribution)
+                      +";Number of events;#Delta(-2lnL)").c_str());
+    for (size_t i = 0; i < scan_points.size(); ++i){
+      profile.SetPoint(i, scan_points.at(i), scan_results.at(i).nll - best_fit.nll);
+    }
+    profile.Write();
+  }
+
+  // toy fit results
+  if (!toy_results.empty()){
+    const size_t npars = likelihood.GetNpar();
+    std::vector<double> values(npars), errors(npars), truth = likelihood.GetNominalParameters();
+    double nll = 0;
+    int status = 0;
+    TTree toytree("spectral_fit_toys", "Spectral fits to toy datasets");
+    toytree.Branch("nll", &nll);
+    toytree.Branch("status", &status);
+    for (size_t par = 0; par < npars; ++par){
+      const std::string parname = "par"+std::to_string(par);
+      toytree.Branch(parname.c_str(), &values.at(par));
+      toytree.Branch((parname+"_err").c_str(), &errors.at(par));
+      toytree.Branch((parname+"_true").c_str(), &truth.at(par));
+    }
+    for (const SpectralFitResult& result : toy_results){
+      // copy rather than assign, so the branch addresses remain valid
+      std::copy(result.values.begin(), result.values.end(), values.begin());
+      std::copy(result.errors.begin(), result.errors.end(), errors.begin());
+      nll = result.nll;
+      status = result.status;
+      toytree.Fill();
+    }
+    toytree.Write();
+  }
+
+  outfile->Close();
+  delete outfile;
+
   return true;
 }
 
 void SpectralFit::GetPDFs(){
+
+  // the data to fit defines the binning of each region. Without it, use the binning
+  // of the first distribution and fit the Asimov dataset.
+  std::string data_file = "";
+  m_variables.Get("data_file", data_file);
+  asimov = data_file.empty();
+
+  // read each distribution's region histograms once, into the likelihood's bin arrays
+  std::vector<RegionHists> pdf_hists;
+  std::vector<double> pdf_scales;
+  for (int d = 0; d < N_distributions; ++d){
+    std::string pdf_file = "";
+    m_variables.Get("pdf_file_"+std::to_string(d), pdf_file);
+    if (pdf_file.empty()){
+      Log(m_unique_name+" no pdf_file_"+std::to_string(d)+" given, leaving "+distribution_names.at(d)
+          +" out of the fit",v_warning,m_verbose);
+      continue;
+    }
+    double scale = 1.;
+    m_variables.Get("pdf_scale_"+std::to_string(d), scale);
+    pdf_hists.push_back(LoadRegionHists(pdf_file));
+    pdf_scales.push_back(scale);
+    distribution_indices.push_back(d);
+  }
+  if (pdf_hists.empty()){
+    throw std::invalid_argument("SpectralFit::GetPDFs - no pdf_file_N given!");
+  }
+
+  RegionHists data_hists = (asimov) ? RegionHists{} : LoadRegionHists(data_file);
+  const RegionHists& binning_hists = (asimov) ? pdf_hists.front() : data_hists;
+  for (int r = 0; r < N_regions; ++r){
+    likelihood.AddRegion(*binning_hists.at(r));
+  }
+
+  for (size_t i = 0; i < pdf_hists.size(); ++i){
+    std::vector<const TH1*> region_hists;
+    for (const std::unique_ptr<TH1>& hist : pdf_hists.at(i)) region_hists.push_back(hist.get());
+    const int d = distribution_indices.at(i);
+    if (likelihood.AddDistribution(distribution_names.at(d), region_hists, pdf_scales.at(i)) < 0){
+      throw std::runtime_error("SpectralFit::GetPDFs - failed to add distribution "+distribution_names.at(d));
+    }
+  }
+
+  if (asimov) likelihood.SetAsimovData();
+
+  return;
+}
+
+void SpectralFit::GetNuisances(){
+
+  // nuisance parameters scale one distribution in a set of regions by a
+  // Gaussian-constrained fractional uncertainty, e.g.
+  // nuisance_0_distribution 5    # index in distribution_names
+  // nuisance_0_sigma 0.2
+  // nuisance_0_regions 0,1,2
+  int n_nuisances = 0;
+  m_variables.Get("n_nuisances", n_nuisances);
+  for (int k = 0; k < n_nuisances; ++k){
+    const std::string prefix = "nuisance_"+std::to_string(k)+"_";
+    SpectralNuisance nuisance;
+    nuisance.name = prefix+"norm";
+    int distribution = -1;
+    std::string regions = "";
+    if (!m_variables.Get(prefix+"distribution", distribution) || !m_variables.Get(prefix+"sigma", nuisance.sigma)
+        || !m_variables.Get(prefix+"regions", regions)){
+      throw std::invalid_argument("SpectralFit::GetNuisances - incomplete configuration for "+prefix);
+    }
+    auto it = std::find(distribution_indices.begin(), distribution_indices.end(), distribution);
+    if (it == distribution_indices.end()){
+      throw std::invalid_argument("SpectralFit::GetNuisances - "+prefix+"distribution is not in the fit");
+    }
+    nuisance.distribution = std::distance(distribution_indices.begin(), it);
+    std::stringstream region_stream(regions);
+    std::string region;
+    while (std::getline(region_stream, region, ',')) nuisance.regions.push_back(std::stoi(region));
+    if (likelihood.AddNuisance(nuisance) < 0){
+      throw std::invalid_argument("SpectralFit::GetNuisances - bad configuration for "+prefix);
+    }
+  }
+
+  return;
+}
+
+RegionHists SpectralFit::LoadRegionHists(const std::string& filename) const {
+  TFile* infile = TFile::Open(filename.c_str(), "READ");
+  if (infile == nullptr || infile->IsZombie()){
+    throw std::runtime_error("SpectralFit::LoadRegionHists - Couldn't open "+filename);
+  }
+  RegionHists hists;
+  for (int r = 0; r < N_regions; ++r){
+    const std::string name = "r"+std::to_string(r);
+    TH1* hist = dynamic_cast<TH1*>(infile->Get(name.c_str()));
+    if (hist == nullptr){
+      throw std::runtime_error("SpectralFit::LoadRegionHists - no histogram "+name+" in "+filename);
+    }
+    hists.at(r).reset(static_cast<TH1*>(hist->Clone()));
+    hists.at(r)->SetDirectory(nullptr);
+    // MakeSpectralFitHistos uses automatic binning, so make sure any buffered entries are binned
+    hists.at(r)->BufferEmpty();
+  }
+  infile->Close();
+  delete infile;
+  return hists;
+}
+
+void SpectralFit::DoProfileScan(){
+  if (scan_distribution < 0 || scan_n_points < 1) return;
+  auto it = std::find(distribution_indices.begin(), distribution_indices.end(), scan_distribution);
+  if (it == distribution_indices.end()){
+    Log(m_unique_name+" Warning! scan_distribution "+std::to_string(scan_distribution)+" is not in the fit",
+        v_warning,m_verbose);
+    return;
+  }
+  const int par = std::distance(distribution_indices.begin(), it);
+  double max = scan_max;
+  if (max <= scan_min) max = best_fit.values.at(par) + 5.*best_fit.errors.at(par);
+  scan_points.clear();
+  for (int i = 0; i < scan_n_points; ++i){
+    scan_points.push_back(scan_min + (max - scan_min)*i/std::max(scan_n_points - 1, 1));
+  }
+
+  // each scan point is an independent fit, so these are spread across threads
+  scan_results = likelihood.ProfileScan(par, scan_points);
+
+  // upper limit from the first crossing of delta(-2lnL) = 2.71 above the best fit
+  for (size_t i = 1; i < scan_points.size(); ++i){
+    const double previous = scan_results.at(i-1).nll - best_fit.nll;
+    const double current = scan_results.at(i).nll - best_fit.nll;
+    if (scan_points.at(i) > best_fit.values.at(par) && previous < 2.71 && current >= 2.71){
+      const double limit = scan_points.at(i-1) + (2.71 - previous)*(scan_points.at(i) - scan_points.at(i-1))/(current - previous);
+      Log(m_unique_name+" 90% C.L. upper limit on "+likelihood.GetParName(par)+": "+std::to_string(limit)+" events",
+          v_message,m_verbose);
+      break;
+    }
+  }
+
+  return;
+}
+
+void SpectralFit::DoToys(){
+  if (n_toys < 1) return;
+  Log(m_unique_name+" fitting "+std::to_string(n_toys)+" toy datasets",v_message,m_verbose);
+  toy_results = likelihood.RunToys(n_toys, toy_seed);
+  int n_converged = std::count_if(toy_results.begin(), toy_results.end(),
+                                  [](const SpectralFitResult& result){ return result.status == 0; });
+  Log(m_unique_name+" "+std::to_string(n_converged)+" of "+std::to_string(n_toys)+" toy fits converged",
+      v_message,m_verbose);
   return;
 }
@@ -3,19 +3,22 @@
 
 #include <string>
 #include <vector>
+#include <array>
+#include <memory>
 #include <iostream>
 #include <map>
 
-#include "TGraph.h"
+#include "TH1.h"
 
 #include "Tool.h"
 
+#include "SpectralLikelihood.h"
+
 static const int N_regions = 6;
 static const int N_distributions = 6;
 
-struct Distribution {
-  std::array<TGraph, N_regions> regions;
-};
+// the r0-r5 histograms of one sample, as made by MakeSpectralFitHistos
+using RegionHists = std::array<std::unique_ptr<TH1>, N_regions>;
 
 class SpectralFit: public Tool {
 
@@ -29,26 +32,46 @@ public:
 private:
 
   void GetPDFs();
+  void GetNuisances();
+  RegionHists LoadRegionHists(const std::string& filename) const;
+  void DoProfileScan();
+  void DoToys();
 
   const std::array<std::string, N_distributions> distribution_names = {
-    "SRN signal"
+    "SRN signal",
     "Invisible muons and pions",
     "nu_e CC interactions",
     "mu/pi-producing interactions",
     "NCQE interactions",
     "Spallation backgrounds"};
 
+  // regions r0-r5, as defined in MakeSpectralFitHistos
   const std::array<std::string, N_regions> region_names = {
-    "20-38deg, N_tagged = 1",
-    "38-50deg, N_tagged = 1",
-    "78-90deg, N_tagged = 1",
     "20-38deg, N_tagged != 1",
-    "38-50deg, N_tagged != 1",
-    "78-90deg, N_tagged != 1"};
-  
-  std::map<std::string, std::array<TGraph, N_regions>> distributions;
-  std::array<TGraph, N_distributions> global_distributions;
-  
+    "38-53deg, N_tagged != 1",
+    "70-90deg, N_tagged != 1",
+    "20-38deg, N_tagged = 1",
+    "38-53deg, N_tagged = 1",
+    "70-90deg, N_tagged = 1"};
+
+  SpectralLikelihood likelihood;
+  std::vector<int> distribution_indices;   // index in distribution_names of each loaded distribution
+  bool asimov = false;
+
+  SpectralFitResult best_fit;
+  std::vector<double> scan_points;
+  std::vector<SpectralFitResult> scan_results;
+  std::vector<SpectralFitResult> toy_results;
+
+  int fit_threads = 1;
+  int scan_distribution = 0;
+  int scan_n_points = 0;
+  double scan_min = 0;
+  double scan_max = 0;
+  int n_toys = 0;
+  int toy_seed = 0;
+  std::string outfile_name = "spectral_fit.root";
+
 };
 
 #endif
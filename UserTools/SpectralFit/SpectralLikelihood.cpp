@@ -0,0 +1,343 @@
+#include "SpectralLikelihood.h"
+
+#include "ParallelFor.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <algorithm>
+
+#include "TROOT.h"
+#include "TH1.h"
+#include "TRandom3.h"
+#include "Math/Minimizer.h"
+#include "Math/Factory.h"
+#include "Math/IFunction.h"
+
+namespace {
+
+// -2lnL for the SpectralLikelihood model. Expectations are linear in the normalisations,
+// and each normalisation is scaled per region by the nuisance parameters, so with
+// W_dr = sum_{b in r} (1 - n_b/mu_b) * p_db the gradient is
+//   d/dN_d     = 2 * sum_r g_dr * W_dr
+//   d/dtheta_k = 2 * sigma_k * sum_{r in k} N_{d_k} * W_{d_k r} + 2 * theta_k
+// where g_dr = 1 + sum_k sigma_k theta_k [k applies to d in r].
+class SpectralNLL : public ROOT::Math::IMultiGradFunction {
+public:
+  SpectralNLL(const double* pdfs_in, const double* counts_in, const std::vector<size_t>& offsets_in,
+              size_t ndist_in, const std::vector<SpectralNuisance>& nuisances_in) :
+    pdfs(pdfs_in), counts(counts_in), offsets(offsets_in), ndist(ndist_in), nuisances(nuisances_in)
+  {
+    nbins = offsets.back();
+    nregions = offsets.size() - 1;
+    mu.resize(nbins);
+    factors.resize(ndist*nregions);
+    region_weights.resize(ndist*nregions);
+    saturated = 0;
+    for (size_t b = 0; b < nbins; ++b){
+      if (counts[b] > 0) saturated += counts[b]*std::log(counts[b]) - counts[b];
+    }
+  }
+  ROOT::Math::IMultiGenFunction* Clone() const override { return new SpectralNLL(*this); }
+  unsigned int NDim() const override { return ndist + nuisances.size(); }
+  void Gradient(const double* x, double* grad) const override {
+    double f;
+    FdF(x, f, grad);
+  }
+  void FdF(const double* x, double& f, double* grad) const override {
+    f = Evaluate(x);
+    for (size_t b = 0; b < nbins; ++b) mu[b] = 1. - counts[b]/mu[b];
+    for (size_t d = 0; d < ndist; ++d){
+      const double* pdf = pdfs + d*nbins;
+      double sum_d = 0;
+      for (size_t r = 0; r < nregions; ++r){
+        double sum = 0;
+        for (size_t b = offsets[r]; b < offsets[r+1]; ++b) sum += mu[b]*pdf[b];
+        region_weights[d*nregions + r] = sum;
+        sum_d += factors[d*nregions + r]*sum;
+      }
+      grad[d] = 2.*sum_d;
+    }
+    for (size_t k = 0; k < nuisances.size(); ++k){
+      const SpectralNuisance& nuisance = nuisances[k];
+      double sum = 0;
+      for (const int& r : nuisance.regions) sum += region_weights[nuisance.distribution*nregions + r];
+      grad[ndist + k] = 2.*nuisance.sigma*x[nuisance.distribution]*sum + 2.*x[ndist + k];
+    }
+  }
+
+private:
+  double DoEval(const double* x) const override { return Evaluate(x); }
+  double DoDerivative(const double* x, unsigned int icoord) const override {
+    std::vector<double> grad(NDim());
+    Gradient(x, grad.data());
+    return grad.at(icoord);
+  }
+  // fill mu with the expectation in each global bin, and return -2lnL
+  double Evaluate(const double* x) const {
+    std::fill(factors.begin(), factors.end(), 1.);
+    double constraint = 0;
+    for (size_t k = 0; k < nuisances.size(); ++k){
+      const double theta = x[ndist + k];
+      constraint += theta*theta;
+      for (const int& r : nuisances[k].regions){
+        factors[nuisances[k].distribution*nregions + r] += nuisances[k].sigma*theta;
+      }
+    }
+    std::fill(mu.begin(), mu.end(), 0.);
+    for (size_t d = 0; d < ndist; ++d){
+      const double* pdf = pdfs + d*nbins;
+      for (size_t r = 0; r < nregions; ++r){
+        const double coefficient = x[d]*factors[d*nregions + r];
+        if (coefficient == 0) continue;
+        for (size_t b = offsets[r]; b < offsets[r+1]; ++b) mu[b] += coefficient*pdf[b];
+      }
+    }
+    double sum = 0;
+    for (size_t b = 0; b < nbins; ++b){
+      mu[b] = std::max(mu[b], std::numeric_limits<double>::min());
+      sum += mu[b] - counts[b]*std::log(mu[b]);
+    }
+    return 2.*(sum + saturated) + constraint;
+  }
+
+  const double* pdfs;
+  const double* counts;
+  const std::vector<size_t>& offsets;
+  size_t ndist;
+  const std::vector<SpectralNuisance>& nuisances;
+  size_t nbins;
+  size_t nregions;
+  double saturated;
+  // scratch space. Each minimizer evaluates its own copy, so these are never shared between threads
+  mutable std::vector<double> mu;
+  mutable std::vector<double> factors;
+  mutable std::vector<double> region_weights;
+};
+
+// add the contents of a histogram onto the given bins, sharing each source bin
+// between the target bins it overlaps in proportion to the overlap
+void RebinOnto(const TH1& source, const double* target_edges, size_t ntarget, double* out){
+  const TAxis* axis = source.GetXaxis();
+  size_t t = 0;
+  for (int s = 1; s <= source.GetNbinsX(); ++s){
+    const double content = source.GetBinContent(s);
+    const double lo = axis->GetBinLowEdge(s);
+    const double hi = axis->GetBinUpEdge(s);
+    if (content == 0 || hi <= lo) continue;
+    while (t < ntarget && target_edges[t+1] <= lo) ++t;
+    for (size_t u = t; u < ntarget && target_edges[u] < hi; ++u){
+      const double overlap = std::min(hi, target_edges[u+1]) - std::max(lo, target_edges[u]);
+      if (overlap > 0) out[u] += content*overlap/(hi - lo);
+    }
+  }
+}
+
+} // end anonymous namespace
+
+SpectralLikelihood::~SpectralLikelihood(){
+  for (ROOT::Math::Minimizer* minimizer : minimizers) delete minimizer;
+  minimizers.clear();
+}
+
+int SpectralLikelihood::AddRegion(const TH1& data_hist){
+  if (!distribution_names.empty()){
+    std::cerr << "SpectralLikelihood::AddRegion - regions must be added before distributions" << std::endl;
+    return -1;
+  }
+  const int nbins = data_hist.GetNbinsX();
+  for (int bin = 1; bin <= nbins; ++bin){
+    edges.push_back(data_hist.GetXaxis()->GetBinLowEdge(bin));
+    data_counts.push_back(data_hist.GetBinContent(bin));
+  }
+  edges.push_back(data_hist.GetXaxis()->GetBinUpEdge(nbins));
+  region_offsets.push_back(region_offsets.back() + nbins);
+  return GetNRegions() - 1;
+}
+
+int SpectralLikelihood::AddDistribution(std::string name, const std::vector<const TH1*>& region_hists, double scale){
+  if (!nuisances.empty()){
+    std::cerr << "SpectralLikelihood::AddDistribution - distributions must be added before nuisances" << std::endl;
+    return -1;
+  }
+  if (region_hists.size() != GetNRegions()){
+    std::cerr << "SpectralLikelihood::AddDistribution - " << name << " has " << region_hists.size()
+              << " histograms for " << GetNRegions() << " regions" << std::endl;
+    return -1;
+  }
+  const size_t nbins = region_offsets.back();
+  std::vector<double> pdf(nbins, 0.);
+  for (size_t r = 0; r < GetNRegions(); ++r){
+    if (region_hists[r] == nullptr) continue;
+    const double* region_edges = edges.data() + region_offsets[r] + r;
+    RebinOnto(*region_hists[r], region_edges, region_offsets[r+1] - region_offsets[r], pdf.data() + region_offsets[r]);
+  }
+  double total = 0;
+  for (const double& content : pdf) total += content;
+  if (total > 0){
+    for (double& content : pdf) content /= total;
+  } else {
+    std::cerr << "SpectralLikelihood::AddDistribution - " << name << " has no entries in the fit range" << std::endl;
+    total = 0;
+  }
+
+  pdfs.insert(pdfs.end(), pdf.begin(), pdf.end());
+  nominal.push_back(total*scale);
+  distribution_names.push_back(name);
+  par_names.push_back(name);
+  return distribution_names.size() - 1;
+}
+
+int SpectralLikelihood::AddNuisance(const SpectralNuisance& nuisance){
+  if (nuisance.distribution < 0 || size_t(nuisance.distribution) >= GetNDistributions()){
+    std::cerr << "SpectralLikelihood::AddNuisance - " << nuisance.name << " refers to unknown distribution "
+              << nuisance.distribution << std::endl;
+    return -1;
+  }
+  for (const int& r : nuisance.regions){
+    if (r < 0 || size_t(r) >= GetNRegions()){
+      std::cerr << "SpectralLikelihood::AddNuisance - " << nuisance.name << " refers to unknown region "
+                << r << std::endl;
+      return -1;
+    }
+  }
+  nuisances.push_back(nuisance);
+  par_names.push_back(nuisance.name);
+  return par_names.size() - 1;
+}
+
+std::vector<double> SpectralLikelihood::GetNominalParameters() const {
+  std::vector<double> pars = nominal;
+  pars.resize(GetNpar(), 0.);
+  return pars;
+}
+
+void SpectralLikelihood::SetAsimovData(){
+  data_counts = ExpectedAll(GetNominalParameters());
+}
+
+std::vector<double> SpectralLikelihood::GetRegionEdges(int region) const {
+  const double* first = edges.data() + region_offsets.at(region) + region;
+  return std::vector<double>(first, first + (region_offsets.at(region+1) - region_offsets.at(region)) + 1);
+}
+
+std::vector<double> SpectralLikelihood::GetData(int region) const {
+  return std::vector<double>(data_counts.begin() + region_offsets.at(region), data_counts.begin() + region_offsets.at(region+1));
+}
+
+std::vector<double> SpectralLikelihood::ExpectedAll(const std::vector<double>& pars) const {
+  std::vector<double> expected(region_offsets.back(), 0.);
+  for (size_t r = 0; r < GetNRegions(); ++r){
+    std::vector<double> region_expected = Expected(r, pars);
+    std::copy(region_expected.begin(), region_expected.end(), expected.begin() + region_offsets[r]);
+  }
+  return expected;
+}
+
+std::vector<double> SpectralLikelihood::Expected(int region, const std::vector<double>& pars, int distribution) const {
+  const size_t nbins = region_offsets.back();
+  const size_t first = region_offsets.at(region);
+  std::vector<double> expected(region_offsets.at(region+1) - first, 0.);
+  for (size_t d = 0; d < GetNDistributions(); ++d){
+    if (distribution >= 0 && size_t(distribution) != d) continue;
+    double coefficient = pars.at(d);
+    for (size_t k = 0; k < nuisances.size(); ++k){
+      const SpectralNuisance& nuisance = nuisances[k];
+      if (size_t(nuisance.distribution) == d && std::count(nuisance.regions.begin(), nuisance.regions.end(), region)){
+        coefficient += pars.at(d)*nuisance.sigma*pars.at(GetNDistributions() + k);
+      }
+    }
+    const double* pdf = pdfs.data() + d*nbins + first;
+    for (size_t b = 0; b < expected.size(); ++b) expected[b] += coefficient*pdf[b];
+  }
+  return expected;
+}
+
+int SpectralLikelihood::PrepareMinimizers(int nworkers){
+  if (nworkers > 1) ROOT::EnableThreadSafety();
+  // creation goes via the plugin manager, which we must not call concurrently
+  while (minimizers.size() < size_t(nworkers)){
+    ROOT::Math::Minimizer* minimizer = ROOT::Math::Factory::CreateMinimizer("Minuit2", "Migrad");
+    if (minimizer == nullptr){
+      std::cerr << "SpectralLikelihood - failed to create Minuit2 minimizer" << std::endl;
+      break;
+    }
+    minimizer->SetPrintLevel((verbosity > 3 && nworkers == 1) ? 1 : 0);
+    minimizer->SetStrategy(1);
+    minimizer->SetMaxFunctionCalls(100000);
+    minimizer->SetTolerance(0.01);
+    minimizers.push_back(minimizer);
+  }
+  return std::min(int(minimizers.size()), nworkers);
+}
+
+bool SpectralLikelihood::Minimize(ROOT::Math::Minimizer* minimizer, const std::vector<double>& counts,
+                                  int fixed_par, double fixed_value, bool get_errors,
+                                  SpectralFitResult& result) const {
+  // SetFunction gives Minuit2 its own clone of nll, so nll itself can be a local; the clone refers to our
+  // pdfs, region offsets and nuisances, and to counts, which may be a toy dataset that only outlives this call
+  SpectralNLL nll(pdfs.data(), counts.data(), region_offsets, GetNDistributions(), nuisances);
+  minimizer->Clear();
+  minimizer->SetErrorDef(1.);  // -2lnL
+  minimizer->SetFunction(nll);
+  for (size_t par = 0; par < GetNpar(); ++par){
+    if (int(par) == fixed_par){
+      minimizer->SetFixedVariable(par, par_names[par], fixed_value);
+    } else if (par < GetNDistributions()){
+      // normalisations are non-negative; distributions with no entries in range are left out
+      if (nominal[par] <= 0){
+        minimizer->SetFixedVariable(par, par_names[par], 0.);
+      } else {
+        minimizer->SetLowerLimitedVariable(par, par_names[par], nominal[par], 0.1*nominal[par], 0.);
+      }
+    } else {
+      minimizer->SetVariable(par, par_names[par], 0., 0.5);
+    }
+  }
+
+  bool ok = minimizer->Minimize();
+  if (ok && get_errors) ok = minimizer->Hesse();
+
+  result.values.assign(minimizer->X(), minimizer->X() + GetNpar());
+  if (get_errors && minimizer->Errors() != nullptr){
+    result.errors.assign(minimizer->Errors(), minimizer->Errors() + GetNpar());
+  } else {
+    result.errors.assign(GetNpar(), 0.);
+  }
+  result.nll = minimizer->MinValue();
+  result.status = minimizer->Status();
+  return ok;
+}
+
+SpectralFitResult SpectralLikelihood::Fit(){
+  SpectralFitResult result;
+  if (PrepareMinimizers(1) == 0) return result;
+  Minimize(minimizers.front(), data_counts, -1, 0., true, result);
+  return result;
+}
+
+std::vector<SpectralFitResult> SpectralLikelihood::ProfileScan(int par, const std::vector<double>& points){
+  std::vector<SpectralFitResult> results(points.size());
+  int nworkers = PrepareMinimizers(std::min(nthreads, int(points.size())));
+  if (nworkers == 0) return results;
+  ParallelFor(points.size(), nworkers, [&](size_t point_i, int thread_i){
+    Minimize(minimizers.at(thread_i), data_counts, par, points.at(point_i), false, results.at(point_i));
+  });
+  return results;
+}
+
+std::vector<SpectralFitResult> SpectralLikelihood::RunToys(int ntoys, unsigned int seed){
+  std::vector<SpectralFitResult> results(std::max(ntoys, 0));
+  int nworkers = PrepareMinimizers(std::min(nthreads, ntoys));
+  if (nworkers == 0) return results;
+  const std::vector<double> expected = ExpectedAll(GetNominalParameters());
+  ParallelFor(results.size(), nworkers, [&](size_t toy_i, int thread_i){
+    // seed by toy number rather than thread, so the ensemble doesn't depend on the number of threads.
+    // TRandom3 treats a seed of 0 as 'random', so offset by one.
+    TRandom3 rng(seed + toy_i + 1);
+    std::vector<double> toy_counts(expected.size());
+    for (size_t b = 0; b < expected.size(); ++b) toy_counts[b] = rng.Poisson(expected[b]);
+    Minimize(minimizers.at(thread_i), toy_counts, -1, 0., true, results.at(toy_i));
+  });
+  return results;
+}
@@ -0,0 +1,104 @@
+#ifndef SpectralLikelihood_H
+#define SpectralLikelihood_H
+
+#include <string>
+#include <vector>
+
+class TH1;
+namespace ROOT { namespace Math { class Minimizer; } }
+
+// Joint binned Poisson likelihood of the reconstructed energy spectra in all
+// fit regions at once. The bins of every region are lined up into one global
+// bin array, and each distribution (signal or background) is stored as one
+// contiguous array of PDF values over those global bins, normalised across all
+// regions. The expectation in a bin is then
+//   mu_b = sum_d N_d * (1 + sum_k sigma_k theta_k [k applies to d in this region]) * p_db
+// where N_d are the normalisations (expected events in the fit range) and theta_k
+// are nuisance parameters with unit Gaussian constraints, each scaling one
+// distribution in a set of regions by a fractional uncertainty sigma_k.
+// -2lnL and its derivatives with respect to all parameters are evaluated in
+// a single pass over the global bins.
+
+struct SpectralNuisance {
+  std::string name;
+  int distribution = 0;        // index of the distribution it scales
+  std::vector<int> regions;    // regions it applies in
+  double sigma = 0;            // fractional 1 sigma uncertainty
+};
+
+struct SpectralFitResult {
+  std::vector<double> values;
+  std::vector<double> errors;
+  double nll = 0;              // -2lnL relative to the saturated model, plus constraint terms
+  int status = -1;             // minimizer status, 0 for success
+};
+
+class SpectralLikelihood {
+
+public:
+
+  SpectralLikelihood(){};
+  ~SpectralLikelihood();
+  SpectralLikelihood(const SpectralLikelihood&) = delete;
+  SpectralLikelihood& operator=(const SpectralLikelihood&) = delete;
+
+  // regions must be added before distributions. The histogram defines the binning
+  // of the region and, unless SetAsimovData is used, the observed counts.
+  int AddRegion(const TH1& data_hist);
+  // one histogram per region, in the order the regions were added. Contents are
+  // rebinned onto the region binning. The nominal normalisation is the total content.
+  int AddDistribution(std::string name, const std::vector<const TH1*>& region_hists, double scale = 1.);
+  int AddNuisance(const SpectralNuisance& nuisance);
+  void SetAsimovData();
+
+  size_t GetNpar() const { return par_names.size(); }
+  size_t GetNDistributions() const { return distribution_names.size(); }
+  size_t GetNRegions() const { return region_offsets.size() - 1; }
+  const std::string& GetParName(int par) const { return par_names.at(par); }
+  // nominal normalisations, followed by zero for each nuisance parameter
+  std::vector<double> GetNominalParameters() const;
+  std::vector<double> GetRegionEdges(int region) const;
+  // expected counts in each bin of a region, for the given parameters
+  // and optionally only the given distribution
+  std::vector<double> Expected(int region, const std::vector<double>& pars, int distribution = -1) const;
+  // observed (or Asimov) counts in each bin of a region
+  std::vector<double> GetData(int region) const;
+
+  void SetNThreads(int nthreads_in){ nthreads = (nthreads_in > 1) ? nthreads_in : 1; }
+  void SetVerbosity(int verb){ verbosity = verb; }
+
+  // fit the data starting from the nominal parameters
+  SpectralFitResult Fit();
+  // profile likelihood scan of one parameter, refitting all others at each point
+  std::vector<SpectralFitResult> ProfileScan(int par, const std::vector<double>& points);
+  // fit Poisson toy datasets drawn from the nominal expectation
+  std::vector<SpectralFitResult> RunToys(int ntoys, unsigned int seed);
+
+private:
+
+  int PrepareMinimizers(int nworkers);
+  bool Minimize(ROOT::Math::Minimizer* minimizer, const std::vector<double>& counts,
+                int fixed_par, double fixed_value, bool get_errors, SpectralFitResult& result) const;
+  std::vector<double> ExpectedAll(const std::vector<double>& pars) const;
+
+  // global bins
+  std::vector<double> edges;                  // per region, nbins+1 edges each
+  std::vector<size_t> region_offsets{0};      // first global bin of each region, plus the end
+  std::vector<double> data_counts;
+
+  // distributions, [distribution*nbins + global bin]
+  std::vector<std::string> distribution_names;
+  std::vector<double> pdfs;
+  std::vector<double> nominal;
+
+  // nuisance parameters, and the (distribution,region) pairs each applies to
+  std::vector<SpectralNuisance> nuisances;
+  std::vector<std::string> par_names;
+
+  int nthreads = 1;
+  int verbosity = 1;
+  std::vector<ROOT::Math::Minimizer*> minimizers;    // one per thread, reused between fits
+
+};
+
+#endif
@@ -0,0 +1,142 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "ThroughputBenchmark.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "geotnkC.h"        // RINTK, ZPINTK
+#include "SkrootHeaders.h"  // LoweInfo
+#include "ToolProfiler.h"   // WallTime, PeakRSS
+
+ThroughputBenchmark::ThroughputBenchmark():Tool(){}
+
+bool ThroughputBenchmark::Initialise(std::string configfile, DataModel &data){
+
+	if(configfile!="")  m_variables.Initialise(configfile);
+	//m_variables.Print();
+
+	m_data= &data;
+	m_log= m_data->Log;
+
+	if(!m_variables.Get("verbosity",m_verbose)) m_verbose=1;
+
+	m_variables.Get("treeReaderName",treeReaderName);
+	m_variables.Get("outputFile",outputFile);
+	m_variables.Get("energyMin",energyMin);
+	m_variables.Get("energyMax",energyMax);
+	m_variables.Get("minWallDistance",minWallDistance);
+	m_variables.Get("neutronThreshold",neutronThreshold);
+	m_variables.Get("withBDT",withBDT);
+
+	if(m_data->Trees.count(treeReaderName)==0){
+		Log(m_unique_name+" error! Failed to find TreeReader "+treeReaderName+" in DataModel!",v_error,m_verbose);
+		m_data->vars.Set("StopLoop",1);
+		return false;
+	}
+	myTreeReader = m_data->Trees.at(treeReaderName);
+
+	// record cuts if we have a CutRecorder
+	if(m_variables.Get("selectorName",selectorName)){
+		m_data->AddCut(selectorName, "energy", "bonsai energy",true,energyMin,energyMax);
+		m_data->AddCut(selectorName, "fiducial", "distance from bonsai vertex to wall",true,minWallDistance,1E9);
+		if(withBDT){
+			m_data->AddCut(selectorName, "neutron", "neutron candidate BDT output",true,"neutron5",neutronThreshold,1.);
+		}
+	}
+
+	if(hb.MakeFile(outputFile, "tree", true)==nullptr){
+		Log(m_unique_name+" error! Failed to make output file "+outputFile,v_error,m_verbose);
+		m_data->vars.Set("StopLoop",1);
+		return false;
+	}
+	MakeHists();
+
+	return true;
+}
+
+
+bool ThroughputBenchmark::Execute(){
+
+	// rates exclude Initialise, which may include generating the input
+	if(start_time<0) start_time = ToolProfiler::WallTime();
+
+	if(!GetBranchValues()){
+		Log(m_unique_name+" error! Failed to get branch values from "+treeReaderName,v_error,m_verbose);
+		return false;
+	}
+	++nevents;
+	ncandidates += np;
+
+	// energy cut
+	if(!selectorName.empty()) m_data->ApplyCut(selectorName, "energy", lowe->bsenergy);
+	hb.Fill("bsenergy", double(lowe->bsenergy));
+	if(lowe->bsenergy<energyMin || lowe->bsenergy>energyMax) return true;
+
+	// fiducial volume cut
+	const double r = std::sqrt(lowe->bsvertex[0]*lowe->bsvertex[0] + lowe->bsvertex[1]*lowe->bsvertex[1]);
+	const double dwall = std::min(RINTK-r, ZPINTK-std::abs(lowe->bsvertex[2]));
+	if(!selectorName.empty()) m_data->ApplyCut(selectorName, "fiducial", dwall);
+	hb.Fill("dwall", dwall);
+	if(dwall<minWallDistance) return true;
+
+	hb.Fill("vertex_xy", double(lowe->bsvertex[0]), double(lowe->bsvertex[1]));
+	hb.Fill("np", np);
+	if(!withBDT) return true;
+
+	// neutron candidates
+	int nneutrons=0;
+	for(int cand_i=0; cand_i<np; ++cand_i){
+		if(!selectorName.empty()) m_data->ApplyCut(selectorName, "neutron", neutron5[cand_i], size_t(cand_i));
+		hb.Fill("neutron5", double(neutron5[cand_i]));
+		if(neutron5[cand_i]<neutronThreshold) continue;
+		hb.Fill("neutron_dt", double(dt[cand_i]/1000.));
+		++nneutrons;
+	}
+	hb.Fill("nneutrons", nneutrons);
+	++nselected;
+
+	return true;
+}
+
+
+bool ThroughputBenchmark::Finalise(){
+
+	const double elapsed = (start_time<0) ? 0 : ToolProfiler::WallTime()-start_time;
+	const double event_rate = (elapsed>0) ? nevents/elapsed : 0;
+	const double candidate_rate = (elapsed>0) ? ncandidates/elapsed : 0;
+
+	Log(m_unique_name+" processed "+toString(nevents)+" events with "+toString(ncandidates)
+	    +" neutron candidates in "+toString(elapsed)+" s; "+toString(nselected)+" passed the event cuts",
+	    v_message,m_verbose);
+	Log(m_unique_name+" throughput: "+toString(event_rate)+" events/s, "+toString(candidate_rate)
+	    +" candidates/s; peak RSS "+toString(ToolProfiler::PeakRSS())+" MB",v_warning,m_verbose);
+
+	hb.Close();
+
+	return true;
+}
+
+bool ThroughputBenchmark::GetBranchValues(){
+
+	bool success =
+	(myTreeReader->Get("LOWE", lowe)) &&
+	(myTreeReader->Get("np", np)) &&
+	(!withBDT || ((myTreeReader->Get("dt", dt)) && (myTreeReader->Get("neutron5", neutron5))));
+
+	return success;
+}
+
+void ThroughputBenchmark::MakeHists(){
+
+	// fixed binning, so that the filling cost is the same from build to build
+	hb.AddHist("bsenergy", double(0), std::array<double,3>{100, 0, 50});
+	hb.AddHist("dwall", double(0), std::array<double,3>{100, 0, 2000});
+	hb.AddHist("vertex_xy", double(0), std::array<double,6>{100, -2000, 2000, 100, -2000, 2000});
+	hb.AddHist("np", int(0), std::array<double,3>{100, 0, 100});
+	if(withBDT){
+		hb.AddHist("neutron5", double(0), std::array<double,3>{100, 0, 1});
+		hb.AddHist("neutron_dt", double(0), std::array<double,3>{100, 0, 550});
+		hb.AddHist("nneutrons", int(0), std::array<double,3>{50, 0, 50});
+	}
+
+}
@@ -0,0 +1,63 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef ThroughputBenchmark_H
+#define ThroughputBenchmark_H
+
+#include <string>
+#include <iostream>
+
+#include "Tool.h"
+#include "MTreeReader.h"
+#include "HistogramBuilder.h"
+
+class LoweInfo;
+
+/**
+* \class ThroughputBenchmark
+*
+* A representative analysis step over SK2p2MeV/ntag_BDT output: reads each entry from a TreeReader,
+* applies energy, fiducial and per-candidate neutron cuts (recorded by a CutRecorder selector if given)
+* and fills histograms of the results. In Finalise it reports the event and candidate rates and
+* the peak memory use, so that builds can be compared on the same (e.g. GenerateSyntheticInput) file.
+*/
+
+class ThroughputBenchmark: public Tool {
+
+	public:
+
+	ThroughputBenchmark();
+	bool Initialise(std::string configfile,DataModel &data);
+	bool Execute();
+	bool Finalise();
+
+	private:
+	bool GetBranchValues();
+	void MakeHists();
+
+	std::string treeReaderName;
+	std::string selectorName="";
+	std::string outputFile="throughput_benchmark.root";
+	double energyMin=8.;          // MeV
+	double energyMax=100.;
+	double minWallDistance=200.;  // cm
+	double neutronThreshold=0.7;  // on neutron5
+	bool withBDT=true;            // whether the input has the neutron5 branch
+
+	MTreeReader* myTreeReader=nullptr;
+	HistogramBuilder hb;
+
+	// variables to read in
+	const LoweInfo* lowe=nullptr;
+	int np=0;
+	basic_array<float*> dt;
+	basic_array<float*> neutron5;
+
+	// rates
+	double start_time=-1;
+	uint64_t nevents=0;
+	uint64_t ncandidates=0;
+	uint64_t nselected=0;
+
+};
+
+
+#endif
@@ -10,6 +10,7 @@
 #include "Constants.h"
 #include "type_name_as_string.h"
 #include "MTreeSelection.h"
+#include "FileCatalogue.h"
 #include "TreeManagerMod.h"
 #include "SuperWrapper.h"
 #include "fortran_routines.h"
@@ -56,7 +57,7 @@ bool TreeReader::Initialise(std::string configfile, DataModel &data){
 	
 	// Get the Tool configuration variables
 	// ------------------------------------
-	LoadConfig(configfile);
+	if(LoadConfig(configfile)<0) return false;
 	m_unique_name = "TreeReader "+readerName;
 	m_data->tool_configs[m_unique_name] = &m_variables;
 	myTreeReader.SetName(readerName);
@@ -97,6 +98,18 @@ bool TreeReader::Initialise(std::string configfile, DataModel &data){
 			skrootMode=SKROOTMODE::ZEBRA;
 		}
 	}
+
+	// the header prefilter needs both a HEADER branch and a TreeManager to do the full read
+	if(headerPrefilter && (skrootMode==SKROOTMODE::NONE || skrootMode==SKROOTMODE::ZEBRA || skrootMode==SKROOTMODE::WRITE)){
+		Log(m_unique_name+" headerPrefilter is only supported when reading SK ROOT files, disabling",
+		    v_warning,m_verbose);
+		headerPrefilter=false;
+	}
+	if(useTriggerIndex && (skrootMode==SKROOTMODE::NONE || skrootMode==SKROOTMODE::ZEBRA || skrootMode==SKROOTMODE::WRITE)){
+		Log(m_unique_name+" useTriggerIndex is only supported when reading SK ROOT files, disabling",
+		    v_warning,m_verbose);
+		useTriggerIndex=false;
+	}
 	
 	// safety check that the requested name to associate to this reader is free
 	get_ok = m_data->Trees.count(readerName);
@@ -476,9 +489,7 @@ bool TreeReader::Initialise(std::string configfile, DataModel &data){
 				}
 				const Header* header = nullptr;
 				myTreeReader.Get("HEADER", header);
-				get_ok  = ((header->nrunsk==0 && header->mdrnsk!=0 && header->mdrnsk!= 999999) ||
-				           (std::bitset<8*sizeof(int)>(header->ifevsk).test(19)) ||
-				           (header->nrunsk==0 && header->sk_geometry==0 && header->ifevsk!=0) );
+				get_ok = TriggerIndex::NonPhysicsEntry(header);
 				if(get_ok==0){
 					// physics entry!
 					isMC = (header->mdrnsk==0 || header->mdrnsk==999999);
@@ -636,7 +647,22 @@ bool TreeReader::Initialise(std::string configfile, DataModel &data){
 		
 		Log(m_unique_name+" creating MTreeReader to read tree "+treeName,v_debug,m_verbose);
 		
-		get_ok = myTreeReader.Load(list_of_files, treeName);
+		// get the number of entries in each file from the catalogue, counting and saving any not yet known,
+		// so that the TChain doesn't open every file just to count them
+		std::vector<int64_t> file_entries;
+		if(catalogueFile!=""){
+			FileCatalogue catalogue;
+			catalogue.Read(catalogueFile);
+			int ncounted = catalogue.CountEntries(treeName, list_of_files, &file_entries, countEntriesThreads,
+			                                      (m_verbose>v_debug));
+			Log(m_unique_name+" counted entries of "+toString(ncounted)+" of "+toString(list_of_files.size())
+			    +" files",v_debug,m_verbose);
+			if(catalogue.Modified() && !catalogue.Write(catalogueFile)){
+				Log(m_unique_name+" warning! Failed to update file catalogue "+catalogueFile,v_warning,m_verbose);
+			}
+		}
+		
+		get_ok = myTreeReader.Load(list_of_files, treeName, file_entries);
 		if(not get_ok){
 			Log(m_unique_name+" failed to open reader on tree "+treeName,v_error,m_verbose);
 			return false;
@@ -674,6 +700,13 @@ bool TreeReader::Initialise(std::string configfile, DataModel &data){
 	// TODO we could remove the first argument now that the MTreeReader knows its name
 	m_data->RegisterReader(readerName, &myTreeReader, hasAFT, loadSHE, loadAFT, loadCommons, getTreeEntry);
 	
+	// if we have trigger indices for our input files, we can use them to skip entries,
+	// find SHE+AFT pairs, and let other Tools search for entries by time, without reading the files.
+	if(useTriggerIndex){
+		useTriggerIndex = LoadTriggerIndex();
+		if(useTriggerIndex) m_data->TriggerIndices.emplace(readerName, &triggerIndex);
+	}
+	
 	// get first entry to process
 	if(firstEntry<0) firstEntry=0;
 	entrynum = firstEntry;
@@ -740,7 +773,7 @@ bool TreeReader::Execute(){
 	// but still want to use the TreeReader tool to populate SK common blocks.
 	if(!autoRead) return true;
 	
-	Log(m_unique_name+" getting entry "+toString(entrynum),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" getting entry "+toString(entrynum));
 	
 	// optionally buffer N entries per Execute call
 	// clear the buffers before we start, unless we're buffering events between loops
@@ -760,18 +793,30 @@ bool TreeReader::Execute(){
 		// So, we'll need a loop that will keep reading entries until we find one we like.
 		do {
 			
+			has_aft=false;
+			
+			// if we can, first check the entry's header alone, so that we don't need to
+			// decode the full entry only to find we don't want it.
+			get_ok = 1;
+			if(headerPrefilter || useTriggerIndex){
+				get_ok = PrefilterEntry(entrynum);
+				if(get_ok<0) ++prefilteredEntries;
+			}
+			
 			// load next entry
-			Log(m_unique_name+" Reading entry "+toString(entrynum),v_debug,m_verbose);
-			get_ok = ReadEntry(entrynum, true);
-			Log(m_unique_name+" ReadEntry returned "+toString(get_ok),v_debug,m_verbose);
+			if(get_ok>0){
+				LOG_DEBUG(m_unique_name+" Reading entry "+toString(entrynum));
+				get_ok = ReadEntry(entrynum, true);
+				LOG_DEBUG(m_unique_name+" ReadEntry returned "+toString(get_ok));
+			}
 			
 			// if we're processing ZBS files and ran off the end of this file,
 			// load the next file if we have one and re-try the read.
 			if(get_ok==0 && skrootMode==SKROOTMODE::ZEBRA && list_of_files.size()>0){
-				Log(m_unique_name+" hit end of this ZBS file, loading next one",v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" hit end of this ZBS file, loading next one");
 				skclosef_(&LUN);
 				get_ok = LoadNextZbsFile();
-				Log(m_unique_name+" loaded next ZBS file, return was "+toString(get_ok),v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" loaded next ZBS file, return was "+toString(get_ok));
 				if(get_ok==0){
 					Log(m_unique_name+" failure loading next ZBS file! Ending toolchain",v_error,m_verbose);
 				} else {
@@ -788,30 +833,14 @@ bool TreeReader::Execute(){
 				// debug prints
 				PrintTriggerBits();
 				
-				// apply our general check for required bits in the trigger mask
-				// skip all events matching trigger types in skippedTriggers
-				for(int bit_i=0; bit_i<skippedTriggers.size(); ++bit_i){
-					int test_bit = skippedTriggers.at(bit_i);
-					if(trigger_bits.test(test_bit)){
-						get_ok=-999; // skip this event
-					}
-				}
-				// alternatively to specifying every type we don't want,
-				// we may choose to specify only the types we do want
-				bool skipit=(allowedTriggers.size()>0); // only apply if given
-				for(int bit_i=0; bit_i<allowedTriggers.size(); ++bit_i){
-					int test_bit = allowedTriggers.at(bit_i);
-					if(trigger_bits.test(test_bit)){
-						skipit=false;
-					}
-				}
-				if(skipit) get_ok=-999; // skip this event
+				// apply our general checks of the trigger mask and event flags
+				if(!entryCuts.Passes(skhead_.idtgsk, skhead_.ifevsk)) get_ok=-999; // skip this event
 				
 				// if we're reading *only* SHE+AFT pairs, skip the entry if it's not SHE
 				if(get_ok>0 && onlyPairs && !trigger_bits.test(28)){
-					Log(m_unique_name+" Prompt entry is not SHE",v_debug,m_verbose);
+					LOG_DEBUG(m_unique_name+" Prompt entry is not SHE");
 					// its not SHE. If we only want SHE+AFT pairs, skip this entry.
-					Log(m_unique_name+" Re-starting read process",v_debug,m_verbose);
+					LOG_DEBUG(m_unique_name+" Re-starting read process");
 					get_ok=-999;
 				}
 				
@@ -824,8 +853,7 @@ bool TreeReader::Execute(){
 					// returns: -999 if not AFT (or error reading AFT) and we're only processing pairs
 					// returns: <=0  if error during AFT read and we're not only processing pairs
 				} else if(get_ok>0 && loadSheAftPairs){
-					Log(m_unique_name+" PairLoading mode on but prompt event is not SHE, skipping follow-up read",
-					    v_debug,m_verbose);
+					LOG_DEBUG(m_unique_name+" PairLoading mode on but prompt event is not SHE, skipping follow-up read");
 				}
 				
 			}  // else not SKROOT mode or bad prompt read. Skip trigger checks.
@@ -842,8 +870,8 @@ bool TreeReader::Execute(){
 				// already loaded in the common block buffers.
 				// If we don't want to read this entry, then discard it from the buffer.
 				if(buffered_entry>0 && buffered_entry != entrynum){
-					Log(m_unique_name+" Discarding buffered SHE from AFT search, since it is "
-					   +"not in our selection entry list",v_debug,m_verbose);
+					LOG_DEBUG(m_unique_name+" Discarding buffered SHE from AFT search, since it is "
+					   +"not in our selection entry list");
 					PopCommons();
 				}
 				buffered_entry = -1;
@@ -900,7 +928,7 @@ bool TreeReader::Execute(){
 	
 	++readEntries;      // keep track of the number of entries we've actually returned
 	if(readEntries%1000==0){
-		Log(m_unique_name+" Read "+toString(readEntries),v_warning,m_verbose);
+		LOG_WARNING(m_unique_name+" Read "+toString(readEntries));
 		// the TreeManager only calls TFile::Write on destructor,
 		// so it seems like if we crash, we can end up losing everything.
 		// intermittently invoke write
@@ -913,7 +941,7 @@ bool TreeReader::Execute(){
 	// check if we've hit the user-requested limit on number of entries to read
 	if( ((maxEntries>0)&&(readEntries>=maxEntries)) ||
 	    ((maxEntry>0)&&(entrynum>maxEntry)) ){
-		Log(m_unique_name+" hit max events, setting StopLoop",v_message,m_verbose);
+		LOG_MESSAGE(m_unique_name+" hit max events, setting StopLoop");
 		m_data->vars.Set("StopLoop",1);
 	}
 	// use LoadTree to check if the next entry is valid without loading it
@@ -932,10 +960,10 @@ bool TreeReader::Execute(){
 	*/
 	
 	if(skrootMode!=::SKROOTMODE::NONE){
-		Log(m_unique_name+" Returning entry skhead_.nevsk " + toString(skhead_.nevsk),v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" Returning entry skhead_.nevsk " + toString(skhead_.nevsk));
 		//std::cout<<"entry "<<entrynum<<", nevsk "<<skhead_.nevsk<<std::endl;
 	} else {
-		Log(m_unique_name+" Returning entry "+toString(entrynum),v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" Returning entry "+toString(entrynum));
 	}
 	
 	return true;
@@ -950,41 +978,48 @@ bool TreeReader::RunChange(){
 		return true;
 	}
 	
-	Log(m_unique_name+" Run Change",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Run Change");
 	m_data->vars.Set("newRun",true);
 	get_ok = true;
 	
 	// check if this run is bad
-	Log(m_unique_name+": Checking bad run flag for run "+toString(skhead_.nrunsk),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+": Checking bad run flag for run "+toString(skhead_.nrunsk));
 	int isbad = lfbadrun_(&skhead_.nrunsk, &skhead_.nsubsk);
 	if(isbad){
-		Log(m_unique_name+" run "+toString(skhead_.nrunsk)+" flagged as a bad run by lfbadrun!",
-		    v_warning,m_verbose);
-		if(skipbadruns) SkipThisRun();
+		LOG_WARNING(m_unique_name+" run "+toString(skhead_.nrunsk)+" flagged as a bad run by lfbadrun!");
+	}
+	if(useRunConditions){
+		const run_conditions& conditions = m_data->runConditions.Get(skhead_.nrunsk);
+		if(!conditions.Good()){
+			LOG_WARNING(m_unique_name+" run "+toString(skhead_.nrunsk)+" flagged as "
+			    +RunConditions::FlagNames(conditions.flags)+" in the run conditions!");
+			isbad = 1;
+		}
 	}
+	if(isbad && skipbadruns) SkipThisRun();
 	
 	// update water transparency
 	float watert;
-	Log(m_unique_name+": Checking days since SK start",v_debug,m_verbose); // guessing what days_to_run_start is
+	LOG_DEBUG(m_unique_name+": Checking days since SK start"); // guessing what days_to_run_start is
 	int days_to_run_start = skday_data_.relapse[skhead_.nrunsk]; // defined in skdayC.h
 	if(days_to_run_start==0){
-		Log(m_unique_name+" skday_data_.relapse returned 0 for run "+toString(skhead_.nrunsk)
-		   /*+", skipping lfwater call!"*/, v_warning,m_verbose);
+		LOG_WARNING(m_unique_name+" skday_data_.relapse returned 0 for run "+toString(skhead_.nrunsk)
+		   /*+", skipping lfwater call!"*/);
 		// actually lfwater does return some nominal value even for invalid inputs,
 		// which are probably better than nothing...?
 	}
 	// else {
-		Log(m_unique_name+": Getting water transparency for day "+toString(days_to_run_start),v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+": Getting water transparency for day "+toString(days_to_run_start));
 		lfwater_(&days_to_run_start, &watert);
-		Log(m_unique_name+" loaded new water transparency value "+toString(watert)
-		    +" for run "+toString(skhead_.nrunsk),v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" loaded new water transparency value "+toString(watert)
+		    +" for run "+toString(skhead_.nrunsk));
 		// pass to downstream tools
 		m_data->vars.Set("watert",watert);
 	//}
 	
 	// update dark rate
 	// What is this doing/required by?
-	Log(m_unique_name+" Updating dark rates",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Updating dark rates");
 	darklf_(&skhead_.nrunsk);
 	
 	return get_ok;
@@ -997,14 +1032,14 @@ bool TreeReader::SubrunChange(){
 		return true;
 	}
 	
-	Log(m_unique_name+" SubRun Change",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" SubRun Change");
 	m_data->vars.Set("newSubrun",true);
 	get_ok = true;
 	
 	// update bad channels
 	// read badch info & puts it into combad_ common block
-	Log(m_unique_name+" Updating bad channel list for run "+toString(skhead_.nrunsk)
-	    +", subrun "+toString(skhead_.nsubsk),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Updating bad channel list for run "+toString(skhead_.nrunsk)
+	    +", subrun "+toString(skhead_.nsubsk));
 	combad_.log_level_skbadch = 0;
 	int ierr;
 	skbadch_(&skroot_ref_run,&skhead_.nsubsk,&ierr);
@@ -1012,7 +1047,7 @@ bool TreeReader::SubrunChange(){
 		Log(m_unique_name+" Error calling skbadch_ in SubrunChange!",v_error,m_verbose);
 		get_ok = false;
 	} else {
-		Log(m_unique_name+" bad channel list updated",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" bad channel list updated");
 	}
 	
 	return get_ok;
@@ -1034,18 +1069,18 @@ bool TreeReader::SkipThisRun(){
 		// get the number of entries in this file (TTree)
 		int entry_in_current_file = myTreeReader.GetTree()->LoadTree(entrynum);
 		int entries_in_current_file = myTreeReader.GetCurrentTree()->GetEntriesFast();
-		Log(m_unique_name+" File "+myTreeReader.GetFile()->GetName()
-		    +" has "+toString(entries_in_current_file)+" entries",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" File "+myTreeReader.GetFile()->GetName()
+		    +" has "+toString(entries_in_current_file)+" entries");
 		// jump forward to the first entry of the next file
 		entrynum += (entries_in_current_file - entry_in_current_file);
-		Log(m_unique_name+" Jumping forward to entry "+toString(entrynum),v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" Jumping forward to entry "+toString(entrynum));
 		
 		// read that entry (should be first entry of next file), and get run number from the Header
 		//  - ah, but this is only populated in some entries! so we need to scan until one is populated.
 		while(true){
 			get_ok = myTreeReader.GetEntry(entrynum);
 			if(get_ok<=0){
-				Log(m_unique_name+" Hit end of tree while looking for next good run!",v_warning,m_verbose);
+				LOG_WARNING(m_unique_name+" Hit end of tree while looking for next good run!");
 				return false;
 			}
 			const Header* header = nullptr;
@@ -1062,8 +1097,8 @@ bool TreeReader::SkipThisRun(){
 			++entrynum;
 		}
 		
-		Log(m_unique_name+" Next file "+myTreeReader.GetFile()->GetName()
-		    +" is from run "+toString(next_run_num),v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" Next file "+myTreeReader.GetFile()->GetName()
+		    +" is from run "+toString(next_run_num));
 	} while (next_run_num==skhead_.nrunsk);
 	
 	
@@ -1119,13 +1154,23 @@ bool TreeReader::Write(){
 	TFile* ofile = otree->GetDirectory()->GetFile();
 	if(!ofile || ofile->IsZombie()) return false;
 	int nbyteswritten = ofile->Write(0,TObject::kOverwrite);
-	Log(m_unique_name+": Wrote "+toString(nbyteswritten)+" to output file "
-	    +ofile->GetName(),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+": Wrote "+toString(nbyteswritten)+" to output file "
+	    +ofile->GetName());
 	return (nbyteswritten>=0);
 }
 
 bool TreeReader::Finalise(){
 	
+	if(headerPrefilter || useTriggerIndex){
+		LOG_MESSAGE(m_unique_name+" skipped "+toString(prefilteredEntries)+" entries based on their header alone");
+	}
+	
+	// other Tools must not use our trigger index once we're gone
+	auto index_it = m_data->TriggerIndices.find(readerName);
+	if(index_it!=m_data->TriggerIndices.end() && index_it->second==&triggerIndex){
+		m_data->TriggerIndices.erase(index_it);
+	}
+	
 	if(myTreeSelections) delete myTreeSelections;
 	
 	if(skrootMode==SKROOTMODE::WRITE){
@@ -1171,9 +1216,9 @@ int TreeReader::ReadEntry(long entry_number, bool use_buffered){
 	
 	// skip the very first read in zebra mode as we already loaded it when checking if MC in Initialize
 	if(skrootMode==SKROOTMODE::ZEBRA && entry_number==firstEntry){
-		Log(m_unique_name+" skipping very first read as we got it from Initialize",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" skipping very first read as we got it from Initialize");
 	} else if(skrootMode!=SKROOTMODE::NONE){
-		Log(m_unique_name+" ReadEntry using SK fortran routines to load data into common blocks",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" ReadEntry using SK fortran routines to load data into common blocks");
 		// Populating fortran common blocks with SKROOT entry data requires using
 		// SKRAWREAD and/or SKREAD.
 		// These functions call various skroot_get_* functions to retrieve branch data.
@@ -1232,7 +1277,7 @@ int TreeReader::ReadEntry(long entry_number, bool use_buffered){
 		}
 		
 		if(loadSheAftPairs && skrootMode==SKROOTMODE::ZEBRA && use_buffered && skhead_vec.size()>0){
-			Log(m_unique_name+" buffered ZEBRA entry, using in place of read",v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" buffered ZEBRA entry, using in place of read");
 			// if we have a buffered entry in hand, but it is not marked as an AFT trigger
 			// for the current readout, then the buffered entry is an unprocessed event.
 			// bypass the read and just load in the buffered data into the common blocks.
@@ -1240,11 +1285,11 @@ int TreeReader::ReadEntry(long entry_number, bool use_buffered){
 			// then pop off the buffered data
 			PopCommons();
 		} else {
-			Log(m_unique_name+" reading next entry from file",v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" reading next entry from file");
 			// use skread / skrawread to get the next TTree entry and populate Fortran common blocks
 			// skreadMode: 0=skread only, 1=skrawread only, 2=both
 			if(bytesread>0 && skreadMode>0){
-				Log(m_unique_name+" calling SKRAWREAD",v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" calling SKRAWREAD");
 				skcrawread_(&LUN, &get_ok); // N.B. positive LUN (see above)
 				// for ZBS this doesn't seem to flag non-physics events as per for SKROOT...?
 				// manually add in checks as per headsk.F for ROOT ... FIXME ? is this appropriate?
@@ -1282,7 +1327,7 @@ int TreeReader::ReadEntry(long entry_number, bool use_buffered){
 				}
 			}
 			if(bytesread>0 && skreadMode!=1){  // skip skread if skrawread had an error
-				Log(m_unique_name+" calling SKREAD",v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" calling SKREAD");
 				int LUN2 = LUN;
 				if(skreadMode==2) LUN2 = -LUN;  // if we already called skrawread, use a negative LUN
 				skcread_(&LUN2, &get_ok);
@@ -1311,12 +1356,12 @@ int TreeReader::ReadEntry(long entry_number, bool use_buffered){
 			// As mentioned above, neither of these load all TTree branches.
 			// To do that we need to call skroot_get_entry.
 			if(bytesread>0 && skrootMode!=SKROOTMODE::ZEBRA){
-				Log(m_unique_name+" calling skroot_get_entry",v_debug,m_verbose);
+				LOG_DEBUG(m_unique_name+" calling skroot_get_entry");
 				skroot_get_entry_(&LUN);
 				//skroot_get_tqskz_(&LUN); // might want to fix this - god I hate it all so much
 			}
 			if(bytesread > 0 && skrootMode == SKROOTMODE::ZEBRA){
-			  Log(m_unique_name+" calling nerdnebk to retrieve NEUT bank", v_debug, m_verbose);
+			  LOG_DEBUG(m_unique_name+" calling nerdnebk to retrieve NEUT bank");
 			  std::array<float, 3> interaction_pos = {};
 			  nerdnebk_(interaction_pos.data());
 			}
@@ -1324,18 +1369,18 @@ int TreeReader::ReadEntry(long entry_number, bool use_buffered){
 		
 	}
 	if(bytesread >0 && skrootMode!=SKROOTMODE::ZEBRA) {
-		Log(m_unique_name+" using MTreeReader to get next TTree entry",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" using MTreeReader to get next TTree entry");
 		// if in SKROOT mode we've already read from disk, just want to update
 		// the internal MTreeReader variables, so skip the actual TTree::GetEntry call
 		bytesread = myTreeReader.GetEntry(entry_number, (skrootMode!=SKROOTMODE::NONE));
 	}
-	Log(m_unique_name+" bytesread is "+toString(bytesread),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" bytesread is "+toString(bytesread));
 	
 	// stop loop if we ran off the end of the tree
 	if(bytesread==0){
 		Log(m_unique_name+" entry "+toString(entry_number)+" off end of input file!",v_error,m_verbose);
 	} else if(bytesread==-999){
-		Log(m_unique_name+" skrawread pedestal or status event",v_debug+10,m_verbose);
+		LOG_DEBUG_N(10, m_unique_name+" skrawread pedestal or status event");
 	}
 	// stop loop if we had an error of some kind
 	else if(bytesread<0){
@@ -1347,9 +1392,88 @@ int TreeReader::ReadEntry(long entry_number, bool use_buffered){
 	return bytesread;
 }
 
+int TreeReader::PrefilterEntry(long entry_number){
+	// read only the HEADER branch of this entry, and check whether it is one we would skip.
+	// returns 1 if the entry should be fully read, -999 if it should be skipped,
+	// or 0 if we're off the end of the tree.
+	
+	// if we have an index, everything we need is already in memory
+	if(useTriggerIndex && entry_number<long(triggerIndex.size())){
+		const trigger_index_entry& index_entry = triggerIndex.at(entry_number);
+		if(RunRejected(index_entry.nrunsk)) return -999;
+		if(skip_ped_evts && !index_entry.physics) return -999;
+		if(!entryCuts.Passes(index_entry.idtgsk, index_entry.ifevsk)) return -999;
+		if(onlyPairs && index_entry.aft_partner!=entry_number+1) return -999;
+		return 1;
+	}
+	
+	TTree* tree = myTreeReader.GetTree();
+	if(tree==nullptr) return 1;
+	long local_entry = tree->LoadTree(entry_number);
+	if(local_entry<0) return 1;  // let ReadEntry handle end of tree as usual
+	TBranch* header_branch = tree->GetBranch("HEADER");
+	if(header_branch==nullptr || header_branch->GetEntry(local_entry)<=0){
+		// can't tell, so read it properly
+		return 1;
+	}
+	const Header* header=nullptr;
+	myTreeReader.Get("HEADER", header);
+	
+	// runs we don't want at all
+	if(RunRejected(header->nrunsk)) return -999;
+	
+	// pedestal and status entries
+	if(skip_ped_evts && TriggerIndex::NonPhysicsEntry(header)) return -999;
+	
+	// trigger and event flag checks
+	if(!entryCuts.Passes(header->idtgsk, header->ifevsk)) return -999;
+	
+	// if we only want SHE+AFT pairs, we can check both triggers now too
+	if(onlyPairs){
+		std::bitset<sizeof(int)*8> trigger_bits = header->idtgsk;
+		if(!trigger_bits.test(28)) return -999;
+		local_entry = tree->LoadTree(entry_number+1);
+		if(local_entry<0) return -999;  // no following entry, so no AFT
+		header_branch = tree->GetBranch("HEADER");
+		if(header_branch!=nullptr && header_branch->GetEntry(local_entry)>0){
+			myTreeReader.Get("HEADER", header);
+			trigger_bits = header->idtgsk;
+			if(!trigger_bits.test(29)) return -999;
+		}
+	}
+	
+	return 1;
+}
+
+bool TreeReader::RunRejected(int nrunsk) const {
+	// entries of runs flagged in the run conditions can be skipped without reading them.
+	// The run number isn't filled in every entry, so entries without one are let through.
+	return useRunConditions && skipbadruns && nrunsk>0 && !m_data->runConditions.RunIsGood(nrunsk);
+}
+
+bool TreeReader::LoadTriggerIndex(){
+	// load and concatenate the trigger index of each input file.
+	// All files must have an up-to-date index, otherwise we don't use them.
+	triggerIndex.Clear();
+	for(const std::string& fname_in : list_of_files){
+		std::string index_file = TriggerIndex::IndexPath(fname_in, triggerIndexDir);
+		TriggerIndex file_index;
+		if(!file_index.Read(index_file, fname_in)){
+			LOG_WARNING(m_unique_name+" warning! no up-to-date trigger index "+index_file+" for input file "
+			    +fname_in+"; will not use trigger indices. Run the BuildTriggerIndex tool to make one.");
+			triggerIndex.Clear();
+			return false;
+		}
+		triggerIndex.Append(file_index);
+	}
+	LOG_DEBUG(m_unique_name+" loaded trigger index of "+toString(triggerIndex.size())+" entries in "
+	    +toString(triggerIndex.GetNFiles())+" files");
+	return true;
+}
+
 int TreeReader::AFTRead(long entry_number){
 	
-	Log(m_unique_name+" Prompt entry is SHE, checking next entry for AFT", v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Prompt entry is SHE, checking next entry for AFT");
 	has_aft=false; // default assumption
 	
 	// do a pre-check to see if we need to read the next entry.
@@ -1378,12 +1502,12 @@ int TreeReader::AFTRead(long entry_number){
 	}
 	
 	// if the pre-check indicated we need to do a follow up read, do that now.
-	Log(m_unique_name+" Re-Invoking ReadEntry to check next entry",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Re-Invoking ReadEntry to check next entry");
 	
 	// i assume that if there's an AFT, it'll always be the next entry,
 	// i.e. there won't be things like status entries in between the SHE and AFT.
 	get_ok = ReadEntry(entrynum+1, false);
-	Log(m_unique_name+" Follow-up read returned "+toString(get_ok),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Follow-up read returned "+toString(get_ok));
 	
 	PrintTriggerBits();
 	
@@ -1409,7 +1533,7 @@ int TreeReader::AFTRead(long entry_number){
 		}
 		
 		if(get_ok==1){
-			Log(m_unique_name+" Successfully found SHE+AFT pair",v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" Successfully found SHE+AFT pair");
 			has_aft=true;
 		} else if(get_ok == -100){
 			// not AFT, but we're noy only reading pairs
@@ -1433,13 +1557,20 @@ int TreeReader::CheckForAFTROOT(long entry_number){
 	
 	// this event is SHE, and we're looking for SHE+AFT pairs.
 	// Peek at the next TTree entry to see if it's an associated AFT.
-	Log(m_unique_name+" prompt event is SHE, peeking at next entry for AFT check",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" prompt event is SHE, peeking at next entry for AFT check");
 	
 	int retval=-1;
 	
 	std::bitset<sizeof(int)*8> next_trigger_bits = 0;
-	// make sure we don't read off the end of the tree
-	if(myTreeReader.GetTree()->LoadTree(entry_number+1)>=0){
+	if(useTriggerIndex && entry_number+1<long(triggerIndex.size())){
+		// the index already tells us if the next entry is this SHE's AFT
+		if(triggerIndex.at(entry_number).aft_partner!=entry_number+1){
+			LOG_DEBUG(m_unique_name+" next entry is not AFT, no AFT this time.");
+			return -100;
+		}
+		next_trigger_bits.set(29);
+	} else if(myTreeReader.GetTree()->LoadTree(entry_number+1)>=0){
+		// make sure we don't read off the end of the tree
 		// try to get the next HEAD entry
 		get_ok = myTreeReader.GetTree()->GetBranch("HEADER")->GetEntry(entry_number+1);
 		if(get_ok==0){
@@ -1451,20 +1582,19 @@ int TreeReader::CheckForAFTROOT(long entry_number){
 			next_trigger_bits = header->idtgsk;
 		}
 	} else {
-		Log(m_unique_name+" can't check for AFT, no further entries in HEADER branch",
-			v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" can't check for AFT, no further entries in HEADER branch");
 			return -100;  // no error reading but no AFT
 	}
 	
 	if(next_trigger_bits.test(29)){
-		Log(m_unique_name+" next entry is AFT, requesting follow-up read",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" next entry is AFT, requesting follow-up read");
 		// The next entry is indeed an AFT. We need to read it in properly now,
 		// so buffer the current SHE data...
 		PushCommons();
 		// ... and indicate that we want to re-run ReadEntry to get the AFT entry.
 		retval=-103;
 	} else {
-		Log(m_unique_name+" next entry is not AFT, no AFT this time.",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" next entry is not AFT, no AFT this time.");
 		if(!onlyPairs){
 			// if we're not explicitly requesting pairs we'll still process this SHE event
 			// rewind Header branch so that anyone using the MTreeReader gets the right data
@@ -1490,7 +1620,7 @@ int TreeReader::CheckForAFTZebra(long entry_number){
 
 int TreeReader::LoadAFTROOT(){
 	// we peeked, so we already know this is an AFT trigger.
-	Log(m_unique_name+" Successfully found SHE+AFT pair",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Successfully found SHE+AFT pair");
 	has_aft=true;
 	
 	// We now we have an SHE in the buffer and an AFT currently loaded.
@@ -1504,14 +1634,14 @@ int TreeReader::LoadAFTZebra(){
 	// At this point we currently have an unprocessed SHE event in the common block buffers,
 	// and we've just read the next zebra file entry into the fortran common blocks.
 	// Let's now check if the next zebra file entry is an AFT associated to our buffered SHE.
-	Log(m_unique_name+" we have the next entry in active commons "
-		+"and a prompt entry buffered. Checking trigger word",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" we have the next entry in active commons "
+		+"and a prompt entry buffered. Checking trigger word");
 	
 	int bytesread=-1;
 	
 	std::bitset<sizeof(int)*8> trigger_bits = skhead_.idtgsk;
 	if(trigger_bits.test(29)){
-		Log(m_unique_name+" Successfully found an SHE+AFT pair",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" Successfully found an SHE+AFT pair");
 		// this means we have an SHE in buffer and an AFT in the common blocks right now.
 		// swap the SHE event back into the common blocks and AFT into the buffer.
 		LoadCommons(0);
@@ -1519,12 +1649,12 @@ int TreeReader::LoadAFTZebra(){
 		bytesread = 1;
 		
 	} else {
-		Log(m_unique_name+" Follow-up entry is not AFT",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+" Follow-up entry is not AFT");
 		
 		// we have two options for proceeding here.
 		// If the user ONLY wants SHE+AFT pairs...
 		if(onlyPairs){
-			Log(m_unique_name+" Dropping old SHE since we only want pairs",v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" Dropping old SHE since we only want pairs");
 			// The currently buffered SHE did not have an associated AFT, so we have no use for it.
 			PopCommons();  // drop it from the buffer.
 			// we'll start this read all over, so put the new entry into the buffer
@@ -1532,8 +1662,7 @@ int TreeReader::LoadAFTZebra(){
 			PushCommons();
 			bytesread = -999;
 		} else {
-			Log(m_unique_name+" Swapping back previous entry, keeping next entry for next Execute call",
-				v_debug,m_verbose);
+			LOG_DEBUG(m_unique_name+" Swapping back previous entry, keeping next entry for next Execute call");
 			// else the user wants an AFT if there is one, but will still accept SHE events
 			// without one. In that case, we still want to process our buffered entry,
 			// so load it back into the common blocks, and retain our next entry in the buffer.
@@ -1550,8 +1679,8 @@ int TreeReader::LoadAFTZebra(){
 void TreeReader::PrintTriggerBits(){
 	std::bitset<sizeof(int)*8> trigger_bits = skhead_.idtgsk;
 	
-	Log(m_unique_name+" Trigger word for the active entry is: "
-		+trigger_bits.to_string(),v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+" Trigger word for the active entry is: "
+		+trigger_bits.to_string());
 	if(m_verbose>(v_debug+1)){
 		for(int i=0; i<(sizeof(int)*8); ++i){
 			if(trigger_bits.test(i)) std::cout<<"bit "<<i<<" set"<<std::endl;
@@ -1655,6 +1784,7 @@ int TreeReader::LoadConfig(std::string configfile){
 	bool skFile=false;
 	std::string allowedTriggersString="";
 	std::string skippedTriggersString="";
+	std::string skippedFlagsString="";
 	
 	// scan over lines in the config file
 	while (getline(fin, Line)){
@@ -1763,8 +1893,15 @@ int TreeReader::LoadConfig(std::string configfile){
 		else if(thekey=="entriesPerExecute") entriesPerExecute = stoi(thevalue);
 		else if(thekey=="allowedTriggers") allowedTriggersString = thevalue;
 		else if(thekey=="skippedTriggers") skippedTriggersString = thevalue;
+		else if(thekey=="skippedFlags") skippedFlagsString = thevalue;
 		else if(thekey=="skipBadRuns") skipbadruns = stoi(thevalue);
+		else if(thekey=="useRunConditions") useRunConditions = stoi(thevalue);
 		else if(thekey=="autoEntryRead") autoRead = stoi(thevalue);
+		else if(thekey=="headerPrefilter") headerPrefilter = stoi(thevalue);
+		else if(thekey=="useTriggerIndex") useTriggerIndex = stoi(thevalue);
+		else if(thekey=="triggerIndexDir") triggerIndexDir = thevalue;
+		else if(thekey=="catalogueFile") catalogueFile = thevalue;
+		else if(thekey=="countEntriesThreads") countEntriesThreads = stoi(thevalue);
 		// support for adding duplicate LUN numbers. This is rather silly because some SKOFL / ATMPD routines
 		// hard-code the LUN number they read from, and if it's not matched to the one we're using, they either
 		// read the wrong file, or dereference a pointer to a non-existent file and seg. Trouble is, LOWE group
@@ -1796,26 +1933,19 @@ int TreeReader::LoadConfig(std::string configfile){
 		}
 	}
 	
-	// parse the allowedTriggersString for allowed triggers
-	while(true){
-		try{
-			size_t nextchar=0;
-			int next_bit = stoi(allowedTriggersString,&nextchar);
-			allowedTriggers.push_back(next_bit);
-			if(nextchar==allowedTriggersString.length()) break;
-			allowedTriggersString = allowedTriggersString.substr(nextchar+1,std::string::npos);
-		} catch (...) { break; }
-	}
-	// same for skippedTriggerString
-	while(true){
-		try{
-			size_t nextchar=0;
-			int next_bit = stoi(skippedTriggersString,&nextchar);
-			skippedTriggers.push_back(next_bit);
-			if(nextchar==skippedTriggersString.length()) break;
-			skippedTriggersString = skippedTriggersString.substr(nextchar+1,std::string::npos);
-		} catch (...) { break; }
+	// entries with any skippedTriggers or skippedFlags set, or none of the allowedTriggers,
+	// are skipped, before they are read in full if using the trigger index or headerPrefilter
+	uint32_t allowed_mask=0, skipped_mask=0, skipped_flags_mask=0;
+	std::string bad_entry;
+	if(!FlagCuts::ParseBits(allowedTriggersString, FlagCuts::trigger, allowed_mask, &bad_entry) ||
+	   !FlagCuts::ParseBits(skippedTriggersString, FlagCuts::trigger, skipped_mask, &bad_entry) ||
+	   !FlagCuts::ParseBits(skippedFlagsString, FlagCuts::event_flag, skipped_flags_mask, &bad_entry)){
+		Log(m_unique_name+" error parsing trigger or event flag '"+bad_entry+"'",v_error,m_verbose);
+		fin.close();
+		return -1;
 	}
+	if(skipped_mask || allowed_mask) entryCuts.AddCut("Triggers", FlagCuts::trigger, skipped_mask, allowed_mask);
+	if(skipped_flags_mask) entryCuts.AddCut("EventFlags", FlagCuts::event_flag, skipped_flags_mask);
 	
 	// done parsing, close config file
 	fin.close();
@@ -1843,10 +1973,7 @@ bool TreeReader::LoadNextZbsFile(){
 	std::string next_file = list_of_files.back();
 	list_of_files.pop_back();
 	// resolve any environmental variables and symlinks
-	std::string cmd = std::string("readlink -f ")+next_file;
-	Log(m_unique_name+" getting return from command '"+cmd+"'",v_debug+1,m_verbose);
-	//next_file = getOutputFromFunctionCall(system, cmd.c_str());  // was crashing???
-	next_file = getOutputFromFunctionCall(safeSystemCall, cmd);
+	next_file = ResolvePath(next_file);
 	Log(m_unique_name+": next ZBS file "+next_file,v_debug,m_verbose);
 	
 	// ok now actually open the ZBS file.
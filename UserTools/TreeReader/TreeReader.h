@@ -8,6 +8,8 @@
 #include "Tool.h"
 #include "MTreeReader.h"
 #include "SkrootHeaders.h" // MCInfo, Header etc.
+#include "TriggerIndex.h"
+#include "FlagCuts.h"
 #include "Constants.h"
 
 #include "fortran_routines.h"
@@ -39,6 +41,9 @@ class TreeReader: public Tool {
 	// functions
 	// =========
 	int ReadEntry(long entry_number, bool use_buffered=false);
+	int PrefilterEntry(long entry_number);
+	bool LoadTriggerIndex();
+	bool RunRejected(int nrunsk) const;
 	int AFTRead(long entry_number);
 	int CheckForAFTROOT(long entry_number);
 	int CheckForAFTZebra(long entry_number);
@@ -83,9 +88,16 @@ class TreeReader: public Tool {
 	bool loadSheAftPairs=false;       // should we load and buffer the AFT for an SHE event, if there is one?
 	bool onlyPairs=false;             // should we only return pairs of SHE+AFT events
 	int entriesPerExecute=1;          // alternatively, read and buffer N entries per Execute call
-	std::vector<int> allowedTriggers; // one of these trigger bits must be set to return an entry
-	std::vector<int> skippedTriggers; // if any of these bits are set the entry will be skipped
+	FlagCuts entryCuts;               // skippedTriggers, allowedTriggers and skippedFlags
+	bool headerPrefilter=false;       // check the HEADER branch before fully reading SKROOT entries
+	long prefilteredEntries=0;        // entries skipped based on their HEADER alone
+	bool useTriggerIndex=false;       // use BuildTriggerIndex sidecar files for the above, and SHE+AFT pairing
+	std::string triggerIndexDir="";   // directory of trigger index files, if not alongside the inputs
+	std::string catalogueFile="";     // FileCatalogue with the number of entries in each input file
+	int countEntriesThreads=0;        // threads with which to count entries not in the catalogue; 0 for all cores
+	TriggerIndex triggerIndex;        // concatenated index of all input files
 	bool skipbadruns=false;           // should we try to skip any runs identified as bad by lfbadrun?
+	bool useRunConditions=false;      // also skip runs that are not good in m_data->runConditions
 	int mTreeReaderVerbosity=0;
 	
 	std::vector<std::string> list_of_files;
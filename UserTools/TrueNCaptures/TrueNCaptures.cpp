@@ -165,35 +165,32 @@ bool TrueNCaptures::MakePlots(int step){
 		if(fplots==nullptr || fplots->IsZombie()) return false;
 		fplots->cd();
 		tplots = new TTree("eventtree","True Neutron Capture Variables");
-		std::vector<std::string> dvars{"prompt_x","prompt_y","prompt_z","prompt_t",
-		                               "capt_x","capt_y","capt_z","capt_t",
-		                               /*"prompt_dwall", "prompt_deffwall", ... other? same for capt..*/
-		                               "neutron_travel_time","neutron_travel_dist",
-		                               "xtravel","ytravel","ztravel","neutron_start_energy",
-		                               "neutron_tot_gammaE","neutron_tot_electronE","neutron_tot_daughterE"};
-		// not sure whether the entries in a std::map may be moved around when new entries are added
-		// to be sure, make all the entries first, then set the addresses after
-		for(auto&& avar : dvars){
-			dbranchvars[avar] = 0;
-		}
-		for(auto&& avar : dvars){
-			tplots->Branch(avar.c_str(), &dbranchvars[avar]);
-		}
-		std::vector<std::string> ivars{"nuclide_daughter_pdg",
-		                               "neutron_n_gammas","neutron_n_electrons","neutron_n_daughters"};
-		for(auto&& avar : ivars){
-			ibranchvars[avar] = 0;
-		}
-		for(auto&& avar : ivars){
-			tplots->Branch(avar.c_str(), &ibranchvars[avar]);
-		}
-		std::vector<std::string> vvars{"gamma_energy", "electron_energy","gamma_time","electron_time"};
-		for(auto&& avar : vvars){
-			vbranchvars[avar] = std::vector<double>{};
-		}
-		for(auto&& avar : vvars){
-			tplots->Branch(avar.c_str(), &vbranchvars[avar]);
-		}
+		tplots->Branch("prompt_x", &plotvars.prompt_x);
+		tplots->Branch("prompt_y", &plotvars.prompt_y);
+		tplots->Branch("prompt_z", &plotvars.prompt_z);
+		tplots->Branch("prompt_t", &plotvars.prompt_t);
+		tplots->Branch("capt_x", &plotvars.capt_x);
+		tplots->Branch("capt_y", &plotvars.capt_y);
+		tplots->Branch("capt_z", &plotvars.capt_z);
+		tplots->Branch("capt_t", &plotvars.capt_t);
+		// TODO "prompt_dwall", "prompt_deffwall", ... other? same for capt..
+		tplots->Branch("neutron_travel_time", &plotvars.neutron_travel_time);
+		tplots->Branch("neutron_travel_dist", &plotvars.neutron_travel_dist);
+		tplots->Branch("xtravel", &plotvars.xtravel);
+		tplots->Branch("ytravel", &plotvars.ytravel);
+		tplots->Branch("ztravel", &plotvars.ztravel);
+		tplots->Branch("neutron_start_energy", &plotvars.neutron_start_energy);
+		tplots->Branch("neutron_tot_gammaE", &plotvars.neutron_tot_gammaE);
+		tplots->Branch("neutron_tot_electronE", &plotvars.neutron_tot_electronE);
+		tplots->Branch("neutron_tot_daughterE", &plotvars.neutron_tot_daughterE);
+		tplots->Branch("nuclide_daughter_pdg", &plotvars.nuclide_daughter_pdg);
+		tplots->Branch("neutron_n_gammas", &plotvars.neutron_n_gammas);
+		tplots->Branch("neutron_n_electrons", &plotvars.neutron_n_electrons);
+		tplots->Branch("neutron_n_daughters", &plotvars.neutron_n_daughters);
+		tplots->Branch("gamma_energy", &plotvars.gamma_energy);
+		tplots->Branch("electron_energy", &plotvars.electron_energy);
+		tplots->Branch("gamma_time", &plotvars.gamma_time);
+		tplots->Branch("electron_time", &plotvars.electron_time);
 		
 	} else if(step==1){
 		
@@ -201,59 +198,59 @@ bool TrueNCaptures::MakePlots(int step){
 		// execution - fill tree
 		for(NCapture& acap : m_data->NCapturesTrue){
 			double tmpd=0;
-			ibranchvars.at("nuclide_daughter_pdg") = (acap.GetDaughterNuclide()) ? acap.GetDaughterNuclide()->pdg : 0;
-			dbranchvars.at("neutron_travel_time") = (acap.NeutronTravelTime(tmpd)) ? tmpd : -1.;
-			dbranchvars.at("neutron_travel_dist") = (acap.NeutronTravelDist(tmpd)) ? tmpd : -1.;
+			plotvars.nuclide_daughter_pdg = (acap.GetDaughterNuclide()) ? acap.GetDaughterNuclide()->pdg : 0;
+			plotvars.neutron_travel_time = (acap.NeutronTravelTime(tmpd)) ? tmpd : -1.;
+			plotvars.neutron_travel_dist = (acap.NeutronTravelDist(tmpd)) ? tmpd : -1.;
 			double* startE = acap.GetNeutron() ? acap.GetNeutron()->GetStartE() : nullptr;
-			dbranchvars.at("neutron_start_energy") = (startE) ? *startE : 0.;
+			plotvars.neutron_start_energy = (startE) ? *startE : 0.;
 			TVector3* cappos = acap.GetPos();
 			if(cappos){
-				dbranchvars.at("capt_x") = cappos->X();
-				dbranchvars.at("capt_y") = cappos->Y();
-				dbranchvars.at("capt_z") = cappos->Z();
+				plotvars.capt_x = cappos->X();
+				plotvars.capt_y = cappos->Y();
+				plotvars.capt_z = cappos->Z();
 			} else {
-				dbranchvars.at("capt_x") = 9999;
-				dbranchvars.at("capt_y") = 9999;
-				dbranchvars.at("capt_z") = 9999;
+				plotvars.capt_x = 9999;
+				plotvars.capt_y = 9999;
+				plotvars.capt_z = 9999;
 			}
 			double* cap_t = acap.GetTime();
-			dbranchvars.at("capt_t") = (cap_t ? *cap_t : 9999);
+			plotvars.capt_t = (cap_t ? *cap_t : 9999);
 			TVector3* startpos = (acap.GetNeutron()) ? acap.GetNeutron()->GetStartPos() : nullptr;
 			if(startpos){
-				dbranchvars.at("prompt_x") = startpos->X();
-				dbranchvars.at("prompt_y") = startpos->Y();
-				dbranchvars.at("prompt_z") = startpos->Z();
+				plotvars.prompt_x = startpos->X();
+				plotvars.prompt_y = startpos->Y();
+				plotvars.prompt_z = startpos->Z();
 			} else {
-				dbranchvars.at("prompt_x") = 9999;
-				dbranchvars.at("prompt_y") = 9999;
-				dbranchvars.at("prompt_z") = 9999;
+				plotvars.prompt_x = 9999;
+				plotvars.prompt_y = 9999;
+				plotvars.prompt_z = 9999;
 			}
 			double* prompt_t = (acap.GetNeutron()) ? acap.GetNeutron()->GetStartTime() : nullptr;
-			dbranchvars.at("prompt_t") = (prompt_t ? *prompt_t : 9999);
+			plotvars.prompt_t = (prompt_t ? *prompt_t : 9999);
 			double x=0,y=0,z=0;
 			if(cappos && startpos){
 				x = startpos->X() - cappos->X();
 				y = startpos->Y() - cappos->Y();
 				z = startpos->Z() - cappos->Z();
 			}
-			dbranchvars.at("xtravel") = x;
-			dbranchvars.at("ytravel") = y;
-			dbranchvars.at("ztravel") = z;
+			plotvars.xtravel = x;
+			plotvars.ytravel = y;
+			plotvars.ztravel = z;
 			int tmpi=0;
-			ibranchvars.at("neutron_n_gammas") = (acap.NGammas(tmpi) ? tmpi : -1);
-			ibranchvars.at("neutron_n_daughters") = tmpi;
+			plotvars.neutron_n_gammas = (acap.NGammas(tmpi) ? tmpi : -1);
+			plotvars.neutron_n_daughters = tmpi;
 			tmpi=0;
-			ibranchvars.at("neutron_n_electrons") = (acap.NConversiones(tmpi) ? tmpi : -1);
-			ibranchvars.at("neutron_n_daughters") += tmpi;
-			dbranchvars.at("neutron_tot_daughterE") = 0;
+			plotvars.neutron_n_electrons = (acap.NConversiones(tmpi) ? tmpi : -1);
+			plotvars.neutron_n_daughters += tmpi;
+			plotvars.neutron_tot_daughterE = 0;
 			double sumgammae=0, sumconvee=0;
-			dbranchvars.at("neutron_tot_gammaE") = acap.SumGammaE(sumgammae) ? sumgammae : 0;
-			dbranchvars.at("neutron_tot_electronE") = acap.SumConversioneE(sumconvee) ? sumconvee : 0;
-			dbranchvars.at("neutron_tot_daughterE") = sumgammae + sumconvee;
-			vbranchvars.at("gamma_energy").clear();
-			vbranchvars.at("gamma_time").clear();
-			vbranchvars.at("electron_energy").clear();
-			vbranchvars.at("electron_time").clear();
+			plotvars.neutron_tot_gammaE = acap.SumGammaE(sumgammae) ? sumgammae : 0;
+			plotvars.neutron_tot_electronE = acap.SumConversioneE(sumconvee) ? sumconvee : 0;
+			plotvars.neutron_tot_daughterE = sumgammae + sumconvee;
+			plotvars.gamma_energy.clear();
+			plotvars.gamma_time.clear();
+			plotvars.electron_energy.clear();
+			plotvars.electron_time.clear();
 			sumgammae=0; // debug...
 			std::vector<int> daughters;
 			if(acap.GetDaughters(daughters)){
@@ -291,32 +288,32 @@ bool TrueNCaptures::MakePlots(int step){
 								m_data->vars.Set("StopLoop",1);
 								break;
 							}
-							vbranchvars.at("gamma_energy").push_back(*startE);
-							vbranchvars.at("gamma_time").push_back(*startT);
+							plotvars.gamma_energy.push_back(*startE);
+							plotvars.gamma_time.push_back(*startT);
 							sumgammae += *startE;
 						} else if(adaughter->pdg==11){
-							vbranchvars.at("electron_energy").push_back(*startE);
-							vbranchvars.at("electron_time").push_back(*startT);
+							plotvars.electron_energy.push_back(*startE);
+							plotvars.electron_time.push_back(*startT);
 						}
 					}
 				}
-				if(sumgammae!=dbranchvars.at("neutron_tot_gammaE")){
+				if(sumgammae!=plotvars.neutron_tot_gammaE){
 					std::cerr<<"sumgammae ("<<sumgammae<<") != that from neutron ("
-					         <<dbranchvars.at("neutron_tot_gammaE")<<")"<<std::endl;
+					         <<plotvars.neutron_tot_gammaE<<")"<<std::endl;
 				}
 			}
 			tplots->Fill();
 			//tplots->Show(tplots->GetEntries()-1);
 			
 			if(m_verbose>v_debug){
-				std::cout<<"writing to tree neutron with prompt time "<<dbranchvars.at("prompt_t")
-				         <<", position ("<<dbranchvars.at("prompt_x")
-				         <<", "<<dbranchvars.at("prompt_y")<<", "<<dbranchvars.at("prompt_z")<<"), capture time "
-				         <<dbranchvars.at("capt_t")<<", position ("
-				         <<dbranchvars.at("capt_x")<<", "<<dbranchvars.at("capt_y")<<", "<<dbranchvars.at("capt_z")
-				         <<"), travel time "<<dbranchvars.at("neutron_travel_time")<<", distance ("
-				         <<dbranchvars.at("xtravel")<<", "<<dbranchvars.at("ytravel")<<", "
-				         <<dbranchvars.at("ztravel")<<")"<<std::endl;
+				std::cout<<"writing to tree neutron with prompt time "<<plotvars.prompt_t
+				         <<", position ("<<plotvars.prompt_x
+				         <<", "<<plotvars.prompt_y<<", "<<plotvars.prompt_z<<"), capture time "
+				         <<plotvars.capt_t<<", position ("
+				         <<plotvars.capt_x<<", "<<plotvars.capt_y<<", "<<plotvars.capt_z
+				         <<"), travel time "<<plotvars.neutron_travel_time<<", distance ("
+				         <<plotvars.xtravel<<", "<<plotvars.ytravel<<", "
+				         <<plotvars.ztravel<<")"<<std::endl;
 				std::cout<<"This is based on capture: "; acap.Print(); std::cout<<std::endl;
 			}
 			
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include "Tool.h"
 
@@ -35,9 +36,16 @@ class TrueNCaptures: public Tool {
 	std::string plotsfile="";
 	TFile* fplots=nullptr;
 	TTree* tplots=nullptr;
-	std::map<std::string, double> dbranchvars;
-	std::map<std::string, int> ibranchvars;
-	std::map<std::string, std::vector<double>> vbranchvars;
+	// output tree variables, each bound to its branch once in MakePlots
+	struct {
+		double prompt_x=0, prompt_y=0, prompt_z=0, prompt_t=0;
+		double capt_x=0, capt_y=0, capt_z=0, capt_t=0;
+		double neutron_travel_time=0, neutron_travel_dist=0;
+		double xtravel=0, ytravel=0, ztravel=0, neutron_start_energy=0;
+		double neutron_tot_gammaE=0, neutron_tot_electronE=0, neutron_tot_daughterE=0;
+		int nuclide_daughter_pdg=0, neutron_n_gammas=0, neutron_n_electrons=0, neutron_n_daughters=0;
+		std::vector<double> gamma_energy, electron_energy, gamma_time, electron_time;
+	} plotvars;
 	
 };
 
@@ -4,7 +4,7 @@
 #include "Constants.h"
 #include "type_name_as_string.h"
 
-#include <algorithm> // std::find
+#include <unordered_map>
 
 #include "TFile.h"
 #include "TTree.h"
@@ -174,6 +174,7 @@ int TruthNeutronCaptures_v3::CalculateVariables(){
 	std::map<int,int> secondary_n_ind_to_loc;
 	std::vector<int> neutron_parent_indices;         // index of neutron parent
 	std::vector<bool> neutron_terminfo_unknown;      // whether we've yet to set the neutron stopping info
+	std::unordered_map<int,int> first_daughter;      // parent_index value -> first secondary with it, if needed
 	
 	// ==========================
 	// SCAN FOR PRIMARY NEUTRONS
@@ -283,9 +284,15 @@ int TruthNeutronCaptures_v3::CalculateVariables(){
 					 <<", "<<secondary_start_time_2.at(secondary_i)<<")"
 					 <<", terminated at (";
 			// ah, but to get termination info we need to find a daughter from its termination process aughh
-			auto it = std::find(parent_index.begin(),parent_index.end(),secondary_i);
-			if(it!=parent_index.end()){
-				int daughter_index = std::distance(parent_index.begin(),it);
+			// build the map of daughters the first time we need it, rather than scanning every time
+			if(first_daughter.empty()){
+				for(int daughter_i=n_secondaries_2-1; daughter_i>=0; --daughter_i){
+					first_daughter[parent_index.at(daughter_i)] = daughter_i;
+				}
+			}
+			auto it = first_daughter.find(secondary_i);
+			if(it!=first_daughter.end()){
+				int daughter_index = it->second;
 				std::cout<<secondary_start_vertex_2.at(daughter_index).at(0)
 				         <<", "<<secondary_start_vertex_2.at(daughter_index).at(1)
 				         <<", "<<secondary_start_vertex_2.at(daughter_index).at(2)
@@ -87,3 +87,7 @@
 //#include "NTagAnalysis.h"
 //#include "MergeDipstickFiles.h"
 #include "GetSubTriggers.h"
+#include "BuildTriggerIndex.h"
+#include "GenerateSyntheticInput.h"
+#include "ThroughputBenchmark.h"
+#include "LoadRunConditions.h"
@@ -91,23 +91,23 @@ bool ntag_BDT::Execute(){
   // FIXME add mechanism to detect whether we're reading from file or tree being generated by upstream Tool
 	int n_in_entries = myTreeReader->GetEntries();
 	if(n_in_entries==last_in_entries){
-    Log(m_unique_name+": there is no new entry from upstream tools, number of candidates for this event is zero",v_debug,m_verbose);
+    LOG_DEBUG(m_unique_name+": there is no new entry from upstream tools, number of candidates for this event is zero");
 		np=0;
 	} else {
-		Log(m_unique_name+": Getting branch values",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+": Getting branch values");
 		get_ok = GetBranchValues();
 		if(not get_ok){
 			Log(m_unique_name+": Error getting branch values!",v_error,m_verbose);
 			//return false;
 		}
-    Log(m_unique_name+": "+toString(np)+" candidates this entry",v_debug,m_verbose);
+    LOG_DEBUG(m_unique_name+": "+toString(np)+" candidates this entry");
 	}
 	last_in_entries = n_in_entries;
 	
 	// unlikely to have >500 neutron candidates in an event,
 	// but still better not to segfault if we can avoid it
 	if(np > MAX_EVENTS){
-		Log(m_unique_name+": expanding output arrays",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+": expanding output arrays");
 		delete[] neutron5;
 		delete[] nlow;
 		MAX_EVENTS = np;
@@ -126,7 +126,7 @@ bool ntag_BDT::Execute(){
 	////double z = fabs(vz[0])/100.;
 	//int id = GetNlowIndex (rsqred, z, NLOWINDEX);
 	int id = 0;
-	Log("WARNING!!!!!! This is always using Nlow1!!!!",v_debug,m_verbose);
+	LOG_DEBUG("WARNING!!!!!! This is always using Nlow1!!!!");
 	
 	// vector of indices passing preselection
 	std::vector<int> passing_indices;
@@ -140,7 +140,7 @@ bool ntag_BDT::Execute(){
 	
 	// loop over neutron capture candidates
 	for(int j=0; j<np; j++){
-		Log(m_unique_name+": Checking candidate "+toString(j)+", N10="+toString(n10[j]),v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+": Checking candidate "+toString(j)+", N10="+toString(n10[j]));
 		
 		// initialize output metric for this candidate
 		neutron5[j] = -10;
@@ -188,7 +188,7 @@ bool ntag_BDT::Execute(){
 		if(j==0) NTAG_VARS = neutronvars.size();
 		
 	}
-	Log(m_unique_name+": "+toString(passing_indices.size())+" candidates passed preselection",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+": "+toString(passing_indices.size())+" candidates passed preselection");
 	
 	// only need to do prediction if any candidates passed preselectionqq
 	if(!passing_indices.size()){
@@ -203,7 +203,7 @@ bool ntag_BDT::Execute(){
 		// Make a Numpy array with variable info for current event
 		// the constructor constructs a 2D Numpy array from a pointer and the dimensions
 		const int ncount = neutronvars.size()/NTAG_VARS;
-		Log(m_unique_name+": Building pyarray from candidate data",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+": Building pyarray from candidate data");
 		if(m_verbose>v_debug){
 			std::cout<<"ncount = "<<ncount<<", NTAG_VARS="<<NTAG_VARS
 				     <<", neutronvars.data()="<<neutronvars.data()
@@ -212,9 +212,9 @@ bool ntag_BDT::Execute(){
 		auto arr = py::array_t<double>{{ncount,NTAG_VARS}, neutronvars.data()};
 		
 		// Make predictions
-		Log(m_unique_name+": Calling predict on candidates",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+": Calling predict on candidates");
 		py::array_t<double, py::array::c_style | py::array::forcecast> probas5 = predict_proba5(arr);
-		Log(m_unique_name+": Prediction done",v_debug,m_verbose);
+		LOG_DEBUG(m_unique_name+": Prediction done");
 		auto probas_u5 = probas5.unchecked<2>();
 		
 		// map the output metric values back onto the array of all neutron candidates
@@ -226,7 +226,7 @@ bool ntag_BDT::Execute(){
 	}
 	
 	// fill output tree with BDT metrics
-	Log(m_unique_name+": Filling output branches",v_debug,m_verbose);
+	LOG_DEBUG(m_unique_name+": Filling output branches");
 	std::cout << "ntag_BDT::Execute: number of entries before fill " << treeout->GetEntries() << std::endl;
 	treeout->Fill();
 	std::cout << "ntag_BDT::Execute: number of entries after fill " << treeout->GetEntries() << std::endl;
@@ -236,7 +236,7 @@ bool ntag_BDT::Execute(){
 	unsigned long num_entries = treeout->GetEntries();
 	if(num_entries%WRITE_FREQUENCY){
 		// write out intermittently for safety
-		Log(m_unique_name+": Updating output TTree",v_message,m_verbose);
+		LOG_MESSAGE(m_unique_name+": Updating output TTree");
 		outfile->Write("*",TObject::kOverwrite);
 	}
 	
@@ -0,0 +1,287 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "BenchmarkHarness.h"
+
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <ctime>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+
+std::map<std::string, BenchmarkFunction>& Registry(){
+	static std::map<std::string, BenchmarkFunction> registry;  // ordered by name
+	return registry;
+}
+
+double WallTime(){
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec*1E-9;
+}
+
+double ProcessCpuTime(){
+	timespec now;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+	return now.tv_sec + now.tv_nsec*1E-9;
+}
+
+std::string FormatTime(double nsecs){
+	std::stringstream ss;
+	ss<<std::fixed<<std::setprecision(nsecs<10 ? 2 : 1);
+	if(nsecs<1E3) ss<<nsecs<<" ns";
+	else if(nsecs<1E6) ss<<nsecs/1E3<<" us";
+	else if(nsecs<1E9) ss<<nsecs/1E6<<" ms";
+	else ss<<nsecs/1E9<<" s";
+	return ss.str();
+}
+
+std::string FormatRate(double rate){
+	if(rate<=0) return "";
+	std::stringstream ss;
+	ss<<std::fixed<<std::setprecision(2);
+	if(rate<1E3) ss<<rate;
+	else if(rate<1E6) ss<<rate/1E3<<"k";
+	else if(rate<1E9) ss<<rate/1E6<<"M";
+	else ss<<rate/1E9<<"G";
+	return ss.str();
+}
+
+std::string JSONString(const std::string& in){
+	std::string out="\"";
+	for(char c : in){
+		switch(c){
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\t': out += "\\t"; break;
+			default: out += c;
+		}
+	}
+	return out+"\"";
+}
+
+} // end anonymous namespace
+
+bool RegisterBenchmark(const std::string& name, BenchmarkFunction function){
+	if(Registry().count(name)){
+		std::cerr<<"RegisterBenchmark error! Benchmark "<<name<<" is defined more than once"<<std::endl;
+		return false;
+	}
+	Registry().emplace(name, function);
+	return true;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+bool BenchmarkState::KeepRunning(){
+	if(!started){
+		started = true;
+		ResumeTiming();
+	}
+	if(done<iterations){
+		++done;
+		return true;
+	}
+	PauseTiming();
+	return false;
+}
+
+void BenchmarkState::PauseTiming(){
+	if(!running) return;
+	real_time += WallTime()-real_start;
+	cpu_time += ProcessCpuTime()-cpu_start;
+	running = false;
+}
+
+void BenchmarkState::ResumeTiming(){
+	if(running) return;
+	real_start = WallTime();
+	cpu_start = ProcessCpuTime();
+	running = true;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+double benchmark_result::Mean(const std::vector<double>& times) const {
+	if(times.empty()) return 0;
+	return std::accumulate(times.begin(), times.end(), 0.)/times.size();
+}
+
+double benchmark_result::Median(const std::vector<double>& times) const {
+	if(times.empty()) return 0;
+	std::vector<double> sorted = times;
+	std::sort(sorted.begin(), sorted.end());
+	const size_t mid = sorted.size()/2;
+	return (sorted.size()%2) ? sorted[mid] : 0.5*(sorted[mid-1]+sorted[mid]);
+}
+
+double benchmark_result::Min(const std::vector<double>& times) const {
+	if(times.empty()) return 0;
+	return *std::min_element(times.begin(), times.end());
+}
+
+double benchmark_result::StdDev(const std::vector<double>& times) const {
+	if(times.size()<2) return 0;
+	const double mean = Mean(times);
+	double sum2=0;
+	for(double atime : times) sum2 += (atime-mean)*(atime-mean);
+	return std::sqrt(sum2/(times.size()-1));
+}
+
+// ---------------------------------------------------------------------------------------------
+
+void BenchmarkRunner::SetContext(const std::string& key, const std::string& value){
+	context.emplace_back(key, value);
+}
+
+bool BenchmarkRunner::Selected(const std::string& name) const {
+	return filter.empty() || name.find(filter)!=std::string::npos;
+}
+
+void BenchmarkRunner::List(std::ostream& os) const {
+	for(auto&& abenchmark : Registry()){
+		if(Selected(abenchmark.first)) os<<abenchmark.first<<"\n";
+	}
+	os<<std::flush;
+}
+
+int BenchmarkRunner::Run(){
+	int nfailed=0;
+	for(auto&& abenchmark : Registry()){
+		if(!Selected(abenchmark.first)) continue;
+		std::cout<<"Running "<<abenchmark.first<<"..."<<std::endl;
+		results.push_back(RunBenchmark(abenchmark.first, abenchmark.second));
+		if(!results.back().error.empty()){
+			std::cerr<<abenchmark.first<<" failed: "<<results.back().error<<std::endl;
+			++nfailed;
+		}
+	}
+	return nfailed;
+}
+
+benchmark_result BenchmarkRunner::RunBenchmark(const std::string& name, BenchmarkFunction& function){
+	benchmark_result result;
+	result.name = name;
+
+	// find a number of iterations that takes at least min_time
+	const uint64_t max_iterations = 1000000000;
+	uint64_t iterations=1;
+	while(true){
+		BenchmarkState state(iterations);
+		function(state);
+		if(!state.Error().empty()){
+			result.error = state.Error();
+			return result;
+		}
+		if(state.RealTime()>=min_time || iterations>=max_iterations) break;
+		double scale = (state.RealTime()>0) ? 1.4*min_time/state.RealTime() : 10.;
+		scale = std::min(std::max(scale, 2.), 10.);
+		iterations = std::min(max_iterations, uint64_t(iterations*scale));
+	}
+	result.iterations = iterations;
+
+	double items=0, bytes=0, total_time=0;
+	for(int rep=0; rep<repetitions; ++rep){
+		BenchmarkState state(iterations);
+		function(state);
+		if(!state.Error().empty()){
+			result.error = state.Error();
+			return result;
+		}
+		result.real_times.push_back(state.RealTime()*1E9/iterations);
+		result.cpu_times.push_back(state.CpuTime()*1E9/iterations);
+		items += state.ItemsProcessed();
+		bytes += state.BytesProcessed();
+		total_time += state.RealTime();
+		result.label = state.Label();
+	}
+	if(total_time>0){
+		result.items_per_second = items/total_time;
+		result.bytes_per_second = bytes/total_time;
+	}
+	return result;
+}
+
+void BenchmarkRunner::PrintResults(std::ostream& os) const {
+	size_t name_width=9;
+	for(auto&& aresult : results) name_width = std::max(name_width, aresult.name.length());
+
+	os<<"\n"<<std::left<<std::setw(name_width)<<"Benchmark"<<std::right
+	  <<std::setw(12)<<"Iterations"<<std::setw(12)<<"Mean"<<std::setw(12)<<"Median"<<std::setw(12)<<"Min"
+	  <<std::setw(9)<<"StdDev"<<std::setw(12)<<"CPU"<<std::setw(12)<<"Items/s"<<std::setw(12)<<"Bytes/s"
+	  <<"  Label\n";
+	os<<std::string(name_width+93,'-')<<"\n";
+	for(auto&& aresult : results){
+		os<<std::left<<std::setw(name_width)<<aresult.name<<std::right;
+		if(!aresult.error.empty()){
+			os<<"  ERROR: "<<aresult.error<<"\n";
+			continue;
+		}
+		const double mean = aresult.Mean(aresult.real_times);
+		std::stringstream spread;
+		spread<<std::fixed<<std::setprecision(1)<<((mean>0) ? 100.*aresult.StdDev(aresult.real_times)/mean : 0)<<"%";
+		os<<std::setw(12)<<aresult.iterations
+		  <<std::setw(12)<<FormatTime(mean)
+		  <<std::setw(12)<<FormatTime(aresult.Median(aresult.real_times))
+		  <<std::setw(12)<<FormatTime(aresult.Min(aresult.real_times))
+		  <<std::setw(9)<<spread.str()
+		  <<std::setw(12)<<FormatTime(aresult.Mean(aresult.cpu_times))
+		  <<std::setw(12)<<FormatRate(aresult.items_per_second)
+		  <<std::setw(12)<<FormatRate(aresult.bytes_per_second)
+		  <<"  "<<aresult.label<<"\n";
+	}
+	os<<std::endl;
+}
+
+bool BenchmarkRunner::WriteJSON(const std::string& filename) const {
+	std::ofstream out(filename, std::ios::trunc);
+	if(!out.is_open()){
+		std::cerr<<"BenchmarkRunner::WriteJSON error! Could not open "<<filename<<std::endl;
+		return false;
+	}
+
+	char date[64];
+	std::time_t now = std::time(nullptr);
+	std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+	char host[256]="";
+	gethostname(host, sizeof(host)-1);
+
+	out<<std::setprecision(10);
+	out<<"{\n  \"context\": {\n";
+	out<<"    \"date\": "<<JSONString(date)<<",\n";
+	out<<"    \"host\": "<<JSONString(host)<<",\n";
+	out<<"    \"min_time\": "<<min_time<<",\n";
+	out<<"    \"repetitions\": "<<repetitions;
+	for(auto&& akey : context) out<<",\n    "<<JSONString(akey.first)<<": "<<JSONString(akey.second);
+	out<<"\n  },\n  \"benchmarks\": [";
+	for(size_t i=0; i<results.size(); ++i){
+		const benchmark_result& aresult = results[i];
+		out<<((i) ? ",\n" : "\n")<<"    {\n";
+		out<<"      \"name\": "<<JSONString(aresult.name)<<",\n";
+		if(!aresult.error.empty()){
+			out<<"      \"error\": "<<JSONString(aresult.error)<<"\n    }";
+			continue;
+		}
+		out<<"      \"label\": "<<JSONString(aresult.label)<<",\n";
+		out<<"      \"iterations\": "<<aresult.iterations<<",\n";
+		out<<"      \"time_unit\": \"ns\",\n";
+		out<<"      \"real_time_mean\": "<<aresult.Mean(aresult.real_times)<<",\n";
+		out<<"      \"real_time_median\": "<<aresult.Median(aresult.real_times)<<",\n";
+		out<<"      \"real_time_min\": "<<aresult.Min(aresult.real_times)<<",\n";
+		out<<"      \"real_time_stddev\": "<<aresult.StdDev(aresult.real_times)<<",\n";
+		out<<"      \"cpu_time_mean\": "<<aresult.Mean(aresult.cpu_times)<<",\n";
+		out<<"      \"items_per_second\": "<<aresult.items_per_second<<",\n";
+		out<<"      \"bytes_per_second\": "<<aresult.bytes_per_second<<",\n";
+		out<<"      \"real_times\": [";
+		for(size_t j=0; j<aresult.real_times.size(); ++j) out<<((j) ? ", " : "")<<aresult.real_times[j];
+		out<<"]\n    }";
+	}
+	out<<"\n  ]\n}\n";
+	return out.good();
+}
@@ -0,0 +1,122 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef BENCHMARK_HARNESS_H
+#define BENCHMARK_HARNESS_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <iostream>
+
+// A minimal micro-benchmark harness, so that the benchmarks need nothing beyond what the
+// ToolChain already links against. Benchmarks are defined with
+//   BENCHMARK_CASE(PMTHitCluster_Sort){
+//       ... untimed setup ...
+//       while(state.KeepRunning()){
+//           ... timed code ...
+//       }
+//       state.SetItemsProcessed(state.Iterations()*nhits);
+//   }
+// Only the KeepRunning loop is timed; sections within it may be excluded with PauseTiming / ResumeTiming.
+// The harness picks a number of iterations that runs for at least the minimum time, then repeats
+// the measurement several times and reports the mean, median, minimum and spread of the time per
+// iteration. Results are printed as a table and may also be written as JSON for regression tracking.
+
+class BenchmarkState {
+
+	public:
+	explicit BenchmarkState(uint64_t iterations_in) : iterations(iterations_in){}
+	// true until the loop has run the requested number of iterations. Starts the timer on the first call.
+	bool KeepRunning();
+	void PauseTiming();
+	void ResumeTiming();
+	uint64_t Iterations() const { return iterations; }
+
+	// e.g. hits or entries processed, to report a rate
+	void SetItemsProcessed(uint64_t items){ items_processed = items; }
+	void SetBytesProcessed(uint64_t bytes){ bytes_processed = bytes; }
+	void SetLabel(const std::string& label_in){ label = label_in; }
+	// abandon this benchmark, e.g. if its setup failed
+	void SkipWithError(const std::string& message){ error = message; iterations = 0; }
+
+	double RealTime() const { return real_time; }
+	double CpuTime() const { return cpu_time; }
+	uint64_t ItemsProcessed() const { return items_processed; }
+	uint64_t BytesProcessed() const { return bytes_processed; }
+	const std::string& Label() const { return label; }
+	const std::string& Error() const { return error; }
+
+	private:
+	uint64_t iterations;
+	uint64_t done=0;
+	bool started=false;
+	bool running=false;
+	double real_start=0;
+	double cpu_start=0;
+	double real_time=0;     // seconds, total over all timed iterations
+	double cpu_time=0;
+	uint64_t items_processed=0;
+	uint64_t bytes_processed=0;
+	std::string label;
+	std::string error;
+
+};
+
+typedef std::function<void(BenchmarkState&)> BenchmarkFunction;
+
+bool RegisterBenchmark(const std::string& name, BenchmarkFunction function);
+
+#define BENCHMARK_CASE(name) \
+	static void Benchmark_##name(BenchmarkState& state); \
+	static const bool Benchmark_##name##_registered = RegisterBenchmark(#name, Benchmark_##name); \
+	static void Benchmark_##name(BenchmarkState& state)
+
+// prevent the compiler from optimising away a result that is otherwise unused
+template<typename T>
+inline void DoNotOptimize(const T& value){
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct benchmark_result {
+	std::string name;
+	std::string label;
+	std::string error;
+	uint64_t iterations=0;              // per repetition
+	std::vector<double> real_times;     // per iteration of each repetition, ns
+	std::vector<double> cpu_times;
+	double items_per_second=0;
+	double bytes_per_second=0;
+	double Mean(const std::vector<double>& times) const;
+	double Median(const std::vector<double>& times) const;
+	double Min(const std::vector<double>& times) const;
+	double StdDev(const std::vector<double>& times) const;
+};
+
+class BenchmarkRunner {
+
+	public:
+	void SetFilter(const std::string& filter_in){ filter = filter_in; }
+	void SetMinTime(double secs){ min_time = secs; }
+	void SetRepetitions(int reps){ repetitions = reps; }
+	// recorded in the JSON context to identify the configuration
+	void SetContext(const std::string& key, const std::string& value);
+
+	void List(std::ostream& os=std::cout) const;
+	// returns the number of benchmarks that failed
+	int Run();
+	void PrintResults(std::ostream& os=std::cout) const;
+	bool WriteJSON(const std::string& filename) const;
+
+	private:
+	benchmark_result RunBenchmark(const std::string& name, BenchmarkFunction& function);
+	bool Selected(const std::string& name) const;
+
+	std::string filter;
+	double min_time=0.5;    // seconds per repetition
+	int repetitions=5;
+	std::vector<std::pair<std::string,std::string>> context;
+	std::vector<benchmark_result> results;
+
+};
+
+#endif
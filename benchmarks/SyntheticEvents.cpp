@@ -0,0 +1,193 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#include "SyntheticEvents.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TMath.h"
+
+#include <skparmC.h>
+#include <geopmtC.h>
+#include <geotnkC.h>
+
+namespace {
+
+std::vector<std::string>& TempFiles(){
+	static std::vector<std::string> files;
+	return files;
+}
+
+std::string& TempDir(){
+	static std::string dir;
+	return dir;
+}
+
+void RemoveTempFiles(){
+	for(auto&& afile : TempFiles()) std::remove(afile.c_str());
+	if(!TempDir().empty()) rmdir(TempDir().c_str());
+}
+
+} // end anonymous namespace
+
+std::string BenchmarkTempPath(const std::string& filename){
+	if(TempDir().empty()){
+		const char* tmpdir = std::getenv("TMPDIR");
+		std::string dir_template = std::string((tmpdir) ? tmpdir : "/tmp")+"/benchmarks_XXXXXX";
+		std::vector<char> buffer(dir_template.begin(), dir_template.end());
+		buffer.push_back('\0');
+		if(mkdtemp(buffer.data())==nullptr){
+			std::cerr<<"BenchmarkTempPath error! Could not make a temporary directory from "
+			         <<dir_template<<std::endl;
+			return filename;
+		}
+		TempDir() = buffer.data();
+		std::atexit(RemoveTempFiles);
+	}
+	std::string path = TempDir()+"/"+filename;
+	if(std::find(TempFiles().begin(), TempFiles().end(), path)==TempFiles().end()) TempFiles().push_back(path);
+	return path;
+}
+
+SyntheticEventGenerator::SyntheticEventGenerator(unsigned int seed) : rng(seed){
+	SetupPMTGeometry(seed);
+}
+
+void SyntheticEventGenerator::SetupPMTGeometry(unsigned int seed){
+	static bool done=false;
+	if(done) return;
+	done=true;
+	// uniform over the barrel and end caps of the inner detector, by area
+	std::mt19937 geo_rng(seed);
+	std::uniform_real_distribution<double> uniform(0., 1.);
+	const double barrel_area = 2.*TMath::Pi()*RINTK*2.*ZPINTK;
+	const double cap_area = TMath::Pi()*RINTK*RINTK;
+	for(int pmt_i=0; pmt_i<MAXPM; ++pmt_i){
+		const double region = uniform(geo_rng)*(barrel_area+2.*cap_area);
+		const double phi = 2.*TMath::Pi()*uniform(geo_rng);
+		double r=RINTK, z=0;
+		if(region<barrel_area){
+			z = ZPINTK*(2.*uniform(geo_rng)-1.);
+		} else {
+			r = RINTK*std::sqrt(uniform(geo_rng));
+			z = (region<barrel_area+cap_area) ? ZPINTK : -ZPINTK;
+		}
+		geopmt_.xyzpm[pmt_i][0] = r*std::cos(phi);
+		geopmt_.xyzpm[pmt_i][1] = r*std::sin(phi);
+		geopmt_.xyzpm[pmt_i][2] = z;
+	}
+}
+
+double SyntheticEventGenerator::Uniform(double low, double high){
+	return std::uniform_real_distribution<double>(low, high)(rng);
+}
+
+double SyntheticEventGenerator::Gaus(double mean, double sigma){
+	return std::normal_distribution<double>(mean, sigma)(rng);
+}
+
+int SyntheticEventGenerator::RandomPMT(){
+	return std::uniform_int_distribution<int>(1, MAXPM)(rng);
+}
+
+TVector3 SyntheticEventGenerator::RandomVertex(){
+	// uniform within the fiducial volume, 2m from the walls
+	const double rmax = RINTK-200., zmax = ZPINTK-200.;
+	const double r = rmax*std::sqrt(Uniform(0,1));
+	const double phi = Uniform(0, 2.*TMath::Pi());
+	return TVector3(r*std::cos(phi), r*std::sin(phi), Uniform(-zmax, zmax));
+}
+
+PMTHitCluster SyntheticEventGenerator::MakeCluster(const TVector3& vertex, int nhits, double t0, double time_resolution_ns){
+	PMTHitCluster cluster;
+	for(int hit_i=0; hit_i<nhits; ++hit_i){
+		const int cable = RandomPMT();
+		const TVector3 pmt_pos(geopmt_.xyzpm[cable-1]);
+		const double tof = (pmt_pos-vertex).Mag()/NTagConstant::C_WATER;
+		cluster.Append(PMTHit(t0+tof+Gaus(0, time_resolution_ns), std::max(0.1, Gaus(1., 0.3)), cable));
+	}
+	return cluster;
+}
+
+std::vector<PMTHit> SyntheticEventGenerator::MakeHits(const synthetic_event_config& config, std::vector<TVector3>* vertices){
+	std::vector<PMTHit> hits;
+
+	// dark noise
+	const double mean_dark_hits = MAXPM*config.dark_rate_khz*1E3*config.window_ns*1E-9;
+	const int n_dark = std::poisson_distribution<int>(mean_dark_hits)(rng);
+	hits.reserve(n_dark+config.n_clusters*config.hits_per_cluster);
+	for(int hit_i=0; hit_i<n_dark; ++hit_i){
+		hits.emplace_back(Uniform(0, config.window_ns), std::max(0.1, Gaus(1., 0.3)), RandomPMT());
+	}
+
+	// signal
+	const double t0_min = (config.cluster_t0_min_ns<0) ? 0 : config.cluster_t0_min_ns;
+	const double t0_max = (config.cluster_t0_max_ns<0) ? config.window_ns : config.cluster_t0_max_ns;
+	for(int cluster_i=0; cluster_i<config.n_clusters; ++cluster_i){
+		const TVector3 vertex = RandomVertex();
+		if(vertices) vertices->push_back(vertex);
+		const double t0 = Uniform(t0_min, t0_max);
+		for(int hit_i=0; hit_i<config.hits_per_cluster; ++hit_i){
+			const int cable = RandomPMT();
+			const TVector3 pmt_pos(geopmt_.xyzpm[cable-1]);
+			const double tof = (pmt_pos-vertex).Mag()/NTagConstant::C_WATER;
+			PMTHit hit(t0+tof+Gaus(0, config.time_resolution_ns), std::max(0.1, Gaus(1., 0.3)), cable);
+			hit.SetSignalFlag(true);
+			hits.push_back(hit);
+		}
+	}
+	return hits;
+}
+
+PMTHitCluster SyntheticEventGenerator::MakeEvent(const synthetic_event_config& config, std::vector<TVector3>* vertices){
+	PMTHitCluster event;
+	for(auto&& ahit : MakeHits(config, vertices)) event.Append(ahit);
+	return event;
+}
+
+bool SyntheticEventGenerator::WriteTree(const std::string& filename, const std::string& treename, long n_entries,
+                                        const synthetic_event_config& config, unsigned int seed){
+	TFile outfile(filename.c_str(), "RECREATE");
+	if(outfile.IsZombie()){
+		std::cerr<<"SyntheticEventGenerator::WriteTree error! Could not create "<<filename<<std::endl;
+		return false;
+	}
+	TTree* tree = new TTree(treename.c_str(), treename.c_str());
+	int nhits=0;
+	float energy=0;
+	TVector3 vertex;
+	std::vector<float> T, Q;
+	std::vector<int> cable;
+	tree->Branch("nhits", &nhits);
+	tree->Branch("energy", &energy);
+	tree->Branch("vertex", &vertex);
+	tree->Branch("T", &T);
+	tree->Branch("Q", &Q);
+	tree->Branch("cable", &cable);
+
+	SyntheticEventGenerator generator(seed);
+	std::vector<TVector3> vertices;
+	for(long entry_i=0; entry_i<n_entries; ++entry_i){
+		vertices.clear();
+		std::vector<PMTHit> hits = generator.MakeHits(config, &vertices);
+		nhits = hits.size();
+		// roughly 6 hits per MeV, with some spread to give cuts something to select
+		energy = generator.Uniform(0.5, 1.5)*config.n_clusters*config.hits_per_cluster/6.;
+		vertex = (vertices.empty()) ? TVector3() : vertices.front();
+		T.clear(); Q.clear(); cable.clear();
+		for(auto&& ahit : hits){
+			T.push_back(ahit.t());
+			Q.push_back(ahit.q());
+			cable.push_back(ahit.i());
+		}
+		tree->Fill();
+	}
+	tree->Write();
+	outfile.Close();
+	return true;
+}
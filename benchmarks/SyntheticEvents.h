@@ -0,0 +1,62 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+#ifndef SYNTHETIC_EVENTS_H
+#define SYNTHETIC_EVENTS_H
+
+#include <string>
+#include <vector>
+#include <random>
+
+#include "TVector3.h"
+
+#include "PMTHit.h"
+#include "PMTHitCluster.h"
+
+// Synthetic SK-like hit data for benchmarks, so they need neither input files nor the detector
+// geometry tables: PMTs are placed uniformly over the inner detector walls, every PMT contributes
+// uniformly distributed dark noise hits, and signal clusters (e.g. neutron captures) add hits
+// whose times are the time of flight from a random vertex, smeared by the timing resolution.
+// The generator is seeded so that every run of a benchmark sees the same events.
+
+struct synthetic_event_config {
+	double window_ns=535000;        // 535us AFT window
+	double dark_rate_khz=4.5;       // per PMT
+	int n_clusters=5;               // signal clusters in the window
+	int hits_per_cluster=7;         // ~7 hits for a 2.2 MeV neutron capture gamma
+	double time_resolution_ns=3;
+	double cluster_t0_min_ns=-1;    // clusters are placed uniformly in [min, max]; <0 for the whole window
+	double cluster_t0_max_ns=-1;
+};
+
+class SyntheticEventGenerator {
+
+	public:
+	explicit SyntheticEventGenerator(unsigned int seed=20221);
+
+	// fill the SKOFL PMT position table (geopmt_) with the synthetic geometry. Done once, by the constructor.
+	static void SetupPMTGeometry(unsigned int seed=20221);
+
+	// hits of one event, in time order of generation (i.e. not sorted)
+	std::vector<PMTHit> MakeHits(const synthetic_event_config& config, std::vector<TVector3>* vertices=nullptr);
+	PMTHitCluster MakeEvent(const synthetic_event_config& config, std::vector<TVector3>* vertices=nullptr);
+	// hits of a single cluster from the given vertex, with no dark noise
+	PMTHitCluster MakeCluster(const TVector3& vertex, int nhits, double t0=1000, double time_resolution_ns=3);
+
+	TVector3 RandomVertex();
+	int RandomPMT();
+	double Uniform(double low, double high);
+	double Gaus(double mean, double sigma);
+
+	// write n_entries events to a TTree with a scalar branch per event and vector branches per hit:
+	//  nhits (int), energy (float), vertex (TVector3), T, Q (vector<float>), cable (vector<int>)
+	static bool WriteTree(const std::string& filename, const std::string& treename, long n_entries,
+	                      const synthetic_event_config& config, unsigned int seed=20221);
+
+	private:
+	std::mt19937 rng;
+
+};
+
+// a scratch path for files made by benchmarks, removed when the process exits
+std::string BenchmarkTempPath(const std::string& filename);
+
+#endif
@@ -0,0 +1,43 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// pdg code lookups made for each particle of MC truth: names for printing, and masses for kinetic energies.
+
+#include "BenchmarkHarness.h"
+
+#include "Constants.h"
+
+namespace {
+
+// a mix of what is seen in neutron capture MC: particles in TDatabasePDG, and nuclei that are not
+const std::vector<int>& TruthPdgCodes(){
+	static const std::vector<int> codes{
+		2112, 22, 11, -11, 13, 2212, 211, 111,
+		1000010020, 1000080160, 1000080150, 1000641560, 1000641580, 1000641571, 1000020040, 1000060120
+	};
+	return codes;
+}
+
+} // end anonymous namespace
+
+BENCHMARK_CASE(Constants_LookupPdgName){
+	const std::vector<int>& codes = TruthPdgCodes();
+	while(state.KeepRunning()){
+		for(int code : codes) DoNotOptimize(LookupPdgName(code));
+	}
+	state.SetItemsProcessed(state.Iterations()*codes.size());
+}
+
+BENCHMARK_CASE(Constants_PdgToString){
+	const std::vector<int>& codes = TruthPdgCodes();
+	while(state.KeepRunning()){
+		for(int code : codes) DoNotOptimize(PdgToString(code));
+	}
+	state.SetItemsProcessed(state.Iterations()*codes.size());
+}
+
+BENCHMARK_CASE(Constants_PdgToMass){
+	const std::vector<int>& codes = TruthPdgCodes();
+	while(state.KeepRunning()){
+		for(int code : codes) DoNotOptimize(PdgToMass(code));
+	}
+	state.SetItemsProcessed(state.Iterations()*codes.size());
+}
@@ -0,0 +1,58 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// HistogramBuilder fills, looked up by name as in the plotting Tools.
+
+#include "BenchmarkHarness.h"
+#include "SyntheticEvents.h"
+
+#include "HistogramBuilder.h"
+
+namespace {
+
+// values to fill, so the benchmark does not measure the random number generator
+const std::vector<double>& FillValues(){
+	static std::vector<double> values;
+	if(values.empty()){
+		SyntheticEventGenerator generator(5);
+		for(int i=0; i<65536; ++i) values.push_back(generator.Gaus(10., 3.));
+	}
+	return values;
+}
+
+} // end anonymous namespace
+
+BENCHMARK_CASE(HistogramBuilder_FillHist){
+	const std::vector<double>& values = FillValues();
+	HistogramBuilder builder;
+	builder.MakeFile(BenchmarkTempPath("hists.root"), "tree", true);
+	size_t value_i=0;
+	while(state.KeepRunning()){
+		builder.Fill("energy", values[value_i]);
+		value_i = (value_i+1) & 0xFFFF;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+BENCHMARK_CASE(HistogramBuilder_FillHist2D){
+	const std::vector<double>& values = FillValues();
+	HistogramBuilder builder;
+	builder.MakeFile(BenchmarkTempPath("hists2d.root"), "tree", true);
+	size_t value_i=0;
+	while(state.KeepRunning()){
+		builder.Fill("energy_vs_dt", values[value_i], values[value_i+1]);
+		value_i = (value_i+2) & 0xFFFF;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+// as above but filling a TTree branch of the same name
+BENCHMARK_CASE(HistogramBuilder_FillTree){
+	const std::vector<double>& values = FillValues();
+	HistogramBuilder builder;
+	builder.MakeFile(BenchmarkTempPath("tree.root"), "tree");
+	size_t value_i=0;
+	while(state.KeepRunning()){
+		builder.Fill("energy", values[value_i]);
+		value_i = (value_i+1) & 0xFFFF;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
@@ -0,0 +1,133 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// PMTHitCluster kernels used by the neutron search: building and sorting the hits of an AFT window,
+// sliding time windows over it, ToF subtraction, and the isotropy / opening angle features of candidates.
+
+#include "BenchmarkHarness.h"
+#include "SyntheticEvents.h"
+
+#include "Calculator.h"
+
+namespace {
+
+// hits of a full 535us window, shared between benchmarks
+const std::vector<PMTHit>& WindowHits(){
+	static std::vector<PMTHit> hits = SyntheticEventGenerator().MakeHits(synthetic_event_config{});
+	return hits;
+}
+
+PMTHitCluster SortedWindow(){
+	PMTHitCluster window;
+	for(auto&& ahit : WindowHits()) window.Append(ahit);
+	window.Sort();
+	return window;
+}
+
+} // end anonymous namespace
+
+BENCHMARK_CASE(PMTHitCluster_Append){
+	const std::vector<PMTHit>& hits = WindowHits();
+	while(state.KeepRunning()){
+		PMTHitCluster window;
+		for(auto&& ahit : hits) window.Append(ahit);
+		DoNotOptimize(window.GetSize());
+	}
+	state.SetItemsProcessed(state.Iterations()*hits.size());
+	state.SetLabel(std::to_string(hits.size())+" hits");
+}
+
+BENCHMARK_CASE(PMTHitCluster_Sort){
+	const std::vector<PMTHit>& hits = WindowHits();
+	while(state.KeepRunning()){
+		state.PauseTiming();
+		PMTHitCluster window;
+		for(auto&& ahit : hits) window.Append(ahit);
+		state.ResumeTiming();
+		window.Sort();
+		DoNotOptimize(window[0]);
+	}
+	state.SetItemsProcessed(state.Iterations()*hits.size());
+	state.SetLabel(std::to_string(hits.size())+" hits");
+}
+
+// N10-style search: a 10ns window starting at each hit
+BENCHMARK_CASE(PMTHitCluster_SliceWidth){
+	PMTHitCluster window = SortedWindow();
+	const int nhits = window.GetSize();
+	int start=0;
+	while(state.KeepRunning()){
+		PMTHitCluster slice = window.Slice(start, 10.);
+		DoNotOptimize(slice.GetSize());
+		if(++start==nhits) start=0;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+// [-50, +50]ns around each hit, as for candidate features
+BENCHMARK_CASE(PMTHitCluster_SliceRange){
+	PMTHitCluster window = SortedWindow();
+	// keep clear of the end of the window, where Slice would read past the last hit
+	const float t_max = window[window.GetSize()-1].t()-100.;
+	int nstarts=0;
+	while(nstarts<int(window.GetSize()) && window[nstarts].t()<t_max) ++nstarts;
+	int start=0;
+	while(state.KeepRunning()){
+		PMTHitCluster slice = window.Slice(start, -50., 50.);
+		DoNotOptimize(slice.GetSize());
+		if(++start==nstarts) start=0;
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+// ToF subtraction of a whole window for a new vertex
+BENCHMARK_CASE(PMTHitCluster_SetVertex){
+	PMTHitCluster window = SortedWindow();
+	SyntheticEventGenerator generator(1);
+	const TVector3 vertices[2] = {generator.RandomVertex(), generator.RandomVertex()};
+	int vertex_i=0;
+	while(state.KeepRunning()){
+		window.SetVertex(vertices[vertex_i]);
+		vertex_i = 1-vertex_i;
+		DoNotOptimize(window[0]);
+	}
+	state.SetItemsProcessed(state.Iterations()*window.GetSize());
+}
+
+// beta_1..5 isotropy parameters: O(N^2) in the hits of a candidate
+BENCHMARK_CASE(PMTHitCluster_BetaArray){
+	SyntheticEventGenerator generator(2);
+	const TVector3 vertex = generator.RandomVertex();
+	PMTHitCluster cluster = generator.MakeCluster(vertex, 50);
+	cluster.SetVertex(vertex);
+	while(state.KeepRunning()){
+		std::array<float, 6> beta = cluster.GetBetaArray();
+		DoNotOptimize(beta);
+	}
+	state.SetItemsProcessed(state.Iterations());
+	state.SetLabel("50 hits");
+}
+
+// opening angles of every hit triplet: O(N^3)
+BENCHMARK_CASE(PMTHitCluster_OpeningAngleStats){
+	SyntheticEventGenerator generator(3);
+	const TVector3 vertex = generator.RandomVertex();
+	PMTHitCluster cluster = generator.MakeCluster(vertex, 30);
+	cluster.SetVertex(vertex);
+	while(state.KeepRunning()){
+		OpeningAngleStats stats = cluster.GetOpeningAngleStats();
+		DoNotOptimize(stats);
+	}
+	state.SetItemsProcessed(state.Iterations());
+	state.SetLabel("30 hits");
+}
+
+BENCHMARK_CASE(PMTHitCluster_FindTRMSMinimizingVertex){
+	SyntheticEventGenerator generator(4);
+	const TVector3 vertex = generator.RandomVertex();
+	PMTHitCluster cluster = generator.MakeCluster(vertex, 10);
+	while(state.KeepRunning()){
+		TVector3 fitted = cluster.FindTRMSMinimizingVertex();
+		DoNotOptimize(fitted);
+	}
+	state.SetItemsProcessed(state.Iterations());
+	state.SetLabel("10 hits");
+}
@@ -0,0 +1,200 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// Pre-activity observables of a lowe event, as calculated by CalculatePreactivityObservables
+// for every lowe candidate: ToF subtraction, time sorting and the sliding windows.
+// PreactivityKernel_Reference times a direct implementation of the same definitions, which it
+// first checks the kernel against, failing if they give different observables.
+
+#include "BenchmarkHarness.h"
+#include "SyntheticEvents.h"
+
+#include "PreactivityKernel.h"
+#include "Constants.h"
+
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+// a ~10 MeV lowe event at 1000 ns in a 1.5 us readout window of dark noise
+struct lowe_event {
+	std::vector<int> cables;
+	std::vector<float> times;
+	std::vector<float> charges;
+	std::vector<int> flags;
+	float vertex[4];
+};
+
+// clusters at 1000 ns, the first of which is the event, optionally with pre_hits earlier hits from its vertex
+lowe_event MakeLoweEvent(SyntheticEventGenerator& generator, int hits_per_cluster, int n_clusters=1,
+                         int pre_hits=0, double pre_t0=950){
+	synthetic_event_config config;
+	config.window_ns = 1500;
+	config.n_clusters = n_clusters;
+	config.hits_per_cluster = hits_per_cluster;
+	config.cluster_t0_min_ns = 1000;
+	config.cluster_t0_max_ns = 1000;
+	std::vector<TVector3> vertices;
+	std::vector<PMTHit> hits = generator.MakeHits(config, &vertices);
+	lowe_event anevent;
+	for(auto&& ahit : hits){
+		anevent.cables.push_back(ahit.i());
+		anevent.times.push_back(ahit.t());
+		anevent.charges.push_back(ahit.q());
+		anevent.flags.push_back((ahit.t()>=800 && ahit.t()<1300) ? 1 : 0);  // in-gate hits
+	}
+	for(int i=0; i<3; ++i) anevent.vertex[i] = vertices.front()[i];
+	anevent.vertex[3] = 1000;
+	for(int hit_i=0; hit_i<pre_hits; ++hit_i){
+		const int cable = generator.RandomPMT();
+		const TVector3 pmt(geopmt_.xyzpm[cable-1][0], geopmt_.xyzpm[cable-1][1], geopmt_.xyzpm[cable-1][2]);
+		const double tof = (pmt-vertices.front()).Mag()/SOL_IN_CM_PER_NS_IN_WATER;
+		anevent.cables.push_back(cable);
+		anevent.times.push_back(generator.Gaus(pre_t0+tof, config.time_resolution_ns));
+		anevent.charges.push_back(generator.Uniform(0.5, 2.5));
+		anevent.flags.push_back(1);
+	}
+	return anevent;
+}
+
+const lowe_event& LoweEvent(){
+	static lowe_event event = [](){
+		SyntheticEventGenerator generator;
+		return MakeLoweEvent(generator, 60);
+	}();
+	return event;
+}
+
+PreactivityKernel MakeKernel(){
+	PreactivityKernel kernel;
+	for(int cable=1; cable<=MAXPM; ++cable) kernel.SetPMTPosition(cable, geopmt_.xyzpm[cable-1]);
+	return kernel;
+}
+
+// the observables straight from their definitions (see PreactivityKernel.h), without the
+// kernel's bucket sort, running sums or limited goodness range
+preactivity_observables ReferenceObservables(const lowe_event& event){
+	const PreactivityKernel defaults;
+	const size_t nhits = event.times.size();
+	std::vector<float> t(nhits);
+	bool any_in_gate=false;
+	double first_in_gate=0;
+	for(size_t i=0; i<nhits; ++i){
+		const float* pmt = geopmt_.xyzpm[event.cables[i]-1];
+		const float dx=pmt[0]-event.vertex[0], dy=pmt[1]-event.vertex[1], dz=pmt[2]-event.vertex[2];
+		t[i] = event.times[i] - event.vertex[3] - std::sqrt(dx*dx + dy*dy + dz*dz)*(1.f/SOL_IN_CM_PER_NS_IN_WATER);
+		if(!(event.flags[i] & 0x01)) continue;
+		if(!any_in_gate || t[i]<first_in_gate) first_in_gate = t[i];
+		any_in_gate=true;
+	}
+	std::vector<size_t> order(nhits);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](size_t h1, size_t h2){ return t[h1]<t[h2]; });
+	std::vector<float> sorted_t(nhits), sorted_q(nhits);
+	for(size_t i=0; i<nhits; ++i){
+		sorted_t[i] = t[order[i]];
+		sorted_q[i] = event.charges[order[i]];
+	}
+
+	preactivity_observables result;
+	for(size_t start=0; start<nhits; ++start){
+		double q_sum=0;
+		size_t end=start;
+		for(; end<nhits && sorted_t[end]-sorted_t[start]<defaults.q50n50_window; ++end) q_sum += sorted_q[end];
+		result.q50n50_ratio = std::max(result.q50n50_ratio, q_sum/(end-start));
+	}
+
+	std::vector<double> goodness(nhits, 0);
+	for(size_t i=0; i<nhits; ++i){
+		for(size_t j=0; j<nhits; ++j){
+			const double dt = sorted_t[j]-sorted_t[i];
+			if(j==i || std::abs(dt)>=defaults.goodness_range) continue;
+			goodness[i] += std::exp(-0.5*dt*dt/(defaults.goodness_sigma*defaults.goodness_sigma));
+		}
+	}
+	const double max_goodness = *std::max_element(goodness.begin(), goodness.end());
+	std::vector<float> good_t;
+	for(size_t i=0; i<nhits; ++i){
+		if(goodness[i] >= defaults.dark_threshold + defaults.fraction*max_goodness*std::exp(-sorted_t[i]/60.)){
+			good_t.push_back(sorted_t[i]);
+		}
+	}
+	for(size_t start=0; start<good_t.size(); ++start){
+		size_t end=start;
+		while(end<good_t.size() && good_t[end]-good_t[start]<defaults.preact_window) ++end;
+		if(good_t[end-1]>=defaults.preact_end) break;
+		const int nwindow = end-start;
+		result.max_pre = std::max(result.max_pre, nwindow);
+		if(any_in_gate && good_t[start]>=first_in_gate) result.max_pregate = std::max(result.max_pregate, nwindow);
+	}
+	return result;
+}
+
+// compare the kernel to the reference for a few events; returns a description of the first difference
+std::string CheckAgainstReference(){
+	SyntheticEventGenerator generator(7);
+	PreactivityKernel kernel = MakeKernel();
+	std::vector<lowe_event> events{LoweEvent()};
+	for(int hits_per_cluster : {10, 30, 100, 300}) events.push_back(MakeLoweEvent(generator, hits_per_cluster));
+	events.push_back(MakeLoweEvent(generator, 40, 3));
+	// with pre-activity, which only makes the goodness cut if it is within ~50 ns of the event
+	events.push_back(MakeLoweEvent(generator, 10, 1, 40, 970));
+	events.push_back(MakeLoweEvent(generator, 20, 1, 60, 960));
+	for(size_t event_i=0; event_i<events.size(); ++event_i){
+		const lowe_event& event = events[event_i];
+		kernel.SetHits(event.times.size(), event.cables.data(), event.times.data(), event.charges.data(),
+		               event.flags.data(), event.vertex);
+		const preactivity_observables result = kernel.Compute();
+		const preactivity_observables expected = ReferenceObservables(event);
+		if(std::abs(result.q50n50_ratio-expected.q50n50_ratio) > 1e-6*expected.q50n50_ratio
+		   || result.max_pre!=expected.max_pre || result.max_pregate!=expected.max_pregate){
+			return "event "+std::to_string(event_i)+": kernel gave q50n50_ratio "+std::to_string(result.q50n50_ratio)
+			      +", max_pre "+std::to_string(result.max_pre)+", max_pregate "+std::to_string(result.max_pregate)
+			      +" vs reference "+std::to_string(expected.q50n50_ratio)+", "+std::to_string(expected.max_pre)
+			      +", "+std::to_string(expected.max_pregate);
+		}
+	}
+	return "";
+}
+
+} // end anonymous namespace
+
+BENCHMARK_CASE(PreactivityKernel_SetHits){
+	const lowe_event& event = LoweEvent();
+	PreactivityKernel kernel = MakeKernel();
+	const int nhits = event.times.size();
+	while(state.KeepRunning()){
+		kernel.SetHits(nhits, event.cables.data(), event.times.data(), event.charges.data(), event.flags.data(), event.vertex);
+	}
+	state.SetItemsProcessed(state.Iterations()*nhits);
+	state.SetLabel(std::to_string(nhits)+" hits");
+}
+
+BENCHMARK_CASE(PreactivityKernel_Compute){
+	const lowe_event& event = LoweEvent();
+	PreactivityKernel kernel = MakeKernel();
+	const int nhits = event.times.size();
+	while(state.KeepRunning()){
+		kernel.SetHits(nhits, event.cables.data(), event.times.data(), event.charges.data(), event.flags.data(), event.vertex);
+		preactivity_observables result = kernel.Compute();
+		DoNotOptimize(result.max_pre);
+	}
+	state.SetItemsProcessed(state.Iterations()*nhits);
+	state.SetLabel(std::to_string(nhits)+" hits");
+}
+
+BENCHMARK_CASE(PreactivityKernel_Reference){
+	const std::string difference = CheckAgainstReference();
+	if(!difference.empty()){
+		state.SkipWithError("kernel disagrees with reference, "+difference);
+		return;
+	}
+	const lowe_event& event = LoweEvent();
+	const int nhits = event.times.size();
+	while(state.KeepRunning()){
+		preactivity_observables result = ReferenceObservables(event);
+		DoNotOptimize(result.max_pre);
+	}
+	state.SetItemsProcessed(state.Iterations()*nhits);
+	state.SetLabel(std::to_string(nhits)+" hits");
+}
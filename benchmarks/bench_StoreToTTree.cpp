@@ -0,0 +1,43 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// Converting the contents of a BStore into TTree entries with StoreToTTree.
+
+#include "BenchmarkHarness.h"
+#include "SyntheticEvents.h"
+
+#include <memory>
+
+#include "TFile.h"
+#include "TTree.h"
+
+#include "StoreToTTree.h"
+
+// a BStore of the kind of summary variables a Tool might save per event
+BENCHMARK_CASE(StoreToTTree_FillBranches){
+	TFile outfile(BenchmarkTempPath("storetottree.root").c_str(), "RECREATE");
+	TTree* tree = new TTree("store", "store");
+	// StoreToTTree only supports Stores on the heap
+	std::unique_ptr<BStore> store(new BStore(true));
+
+	SyntheticEventGenerator generator(6);
+	PMTHitCluster event = generator.MakeCluster(generator.RandomVertex(), 50);
+	std::vector<float> times = event.T();
+	int nhits = times.size();
+	double energy = 8.5;
+	TVector3 vertex = generator.RandomVertex();
+	store->Set("nhits", nhits);
+	store->Set("energy", energy);
+	store->Set("vertex", vertex);
+	store->Set("times", times);
+
+	StoreToTTree converter;
+	converter.MakeBranches(tree, store.get());
+	while(state.KeepRunning()){
+		energy += 0.1;
+		store->Set("energy", energy);
+		converter.FillBranches(tree, store.get());
+	}
+	state.SetItemsProcessed(state.Iterations());
+	state.SetLabel("4 variables per entry");
+	tree->ResetBranchAddresses();
+	outfile.Close();
+}
@@ -0,0 +1,181 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// Reading synthetic events with MTreeReader, and writing and reading back MTreeSelection cut files.
+
+#include "BenchmarkHarness.h"
+#include "SyntheticEvents.h"
+
+#include <memory>
+
+#include "MTreeReader.h"
+#include "MTreeSelection.h"
+
+namespace {
+
+const long n_tree_entries=5000;
+const double energy_cut=2.;      // MeV; passes about half of the events below
+
+// 5us windows, ~250 hits per entry. Written on first use.
+const std::string& InputFile(){
+	static std::string filename;
+	if(filename.empty()){
+		filename = BenchmarkTempPath("synthetic_events.root");
+		synthetic_event_config config;
+		config.window_ns = 5000;
+		config.n_clusters = 1;
+		config.hits_per_cluster = 12;
+		if(!SyntheticEventGenerator::WriteTree(filename, "data", n_tree_entries, config)) filename="";
+	}
+	return filename;
+}
+
+std::unique_ptr<MTreeReader> OpenReader(BenchmarkState& state){
+	if(InputFile().empty()){
+		state.SkipWithError("could not write synthetic input file");
+		return nullptr;
+	}
+	std::unique_ptr<MTreeReader> reader(new MTreeReader("benchmark"));
+	reader->SetVerbosity(0);
+	if(reader->Load(InputFile(), "data")<=0){
+		state.SkipWithError("MTreeReader could not load "+InputFile());
+		return nullptr;
+	}
+	return reader;
+}
+
+// a cut file from the synthetic events, passing those above energy_cut. Written on first use.
+const std::string& CutFile(){
+	static std::string filename;
+	if(filename.empty()){
+		MTreeReader reader("cutfile_writer");
+		reader.SetVerbosity(0);
+		if(InputFile().empty() || reader.Load(InputFile(), "data")<=0) return filename;
+		filename = BenchmarkTempPath("synthetic_cuts.root");
+		MTreeSelection selection(&reader, filename);
+		selection.AddCut("energy", "energy above threshold", false, energy_cut);
+		const float* energy=nullptr;
+		for(long entry_i=0; entry_i<reader.GetEntries(); ++entry_i){
+			reader.GetEntry(entry_i);
+			reader.Get("energy", energy);
+			selection.ApplyCut("energy", *energy);
+		}
+		selection.Write();
+	}
+	return filename;
+}
+
+} // end anonymous namespace
+
+// sequential reading of all branches
+BENCHMARK_CASE(MTreeReader_GetEntry){
+	std::unique_ptr<MTreeReader> reader = OpenReader(state);
+	if(!reader) return;
+	const long nentries = reader->GetEntries();
+	const uint64_t bytes_before = reader->GetBytesRead();
+	long entry=0;
+	while(state.KeepRunning()){
+		// 0 is already loaded, so would not be read again
+		if(++entry==nentries) entry=0;
+		DoNotOptimize(reader->GetEntry(entry));
+	}
+	state.SetItemsProcessed(state.Iterations());
+	state.SetBytesProcessed(reader->GetBytesRead()-bytes_before);
+}
+
+// looking up branch values of the current entry, as Tools do many times per event
+BENCHMARK_CASE(MTreeReader_Get){
+	std::unique_ptr<MTreeReader> reader = OpenReader(state);
+	if(!reader) return;
+	reader->GetEntry(1);
+	int nhits=0;
+	const float* energy=nullptr;
+	const TVector3* vertex=nullptr;
+	const std::vector<float>* T=nullptr;
+	const std::vector<float>* Q=nullptr;
+	const std::vector<int>* cable=nullptr;
+	while(state.KeepRunning()){
+		reader->Get("nhits", nhits);
+		reader->Get("energy", energy);
+		reader->Get("vertex", vertex);
+		reader->Get("T", T);
+		reader->Get("Q", Q);
+		reader->Get("cable", cable);
+		DoNotOptimize(nhits);
+		DoNotOptimize(T);
+	}
+	state.SetItemsProcessed(state.Iterations()*6);
+	state.SetLabel("6 branches per iteration");
+}
+
+// ApplyCut on each entry, without the cost of reading it
+BENCHMARK_CASE(MTreeSelection_ApplyCut){
+	std::unique_ptr<MTreeReader> reader = OpenReader(state);
+	if(!reader) return;
+	const long nentries = reader->GetEntries();
+	std::vector<float> energies;
+	const float* energy=nullptr;
+	for(long entry_i=0; entry_i<nentries; ++entry_i){
+		reader->GetEntry(entry_i);
+		reader->Get("energy", energy);
+		energies.push_back(*energy);
+	}
+	const std::string cut_file = BenchmarkTempPath("applycut.root");
+	auto make_selection = [&](){
+		std::unique_ptr<MTreeSelection> selection(new MTreeSelection(reader.get(), cut_file));
+		selection->AddCut("energy", "energy above threshold", false, energy_cut);
+		return selection;
+	};
+	std::unique_ptr<MTreeSelection> selection = make_selection();
+	long entry=0;
+	while(state.KeepRunning()){
+		reader->GetEntry(entry, true);  // just sets the entry number
+		selection->ApplyCut("energy", energies[entry]);
+		if(++entry==nentries){
+			// TEntryLists only take each entry once
+			state.PauseTiming();
+			entry=0;
+			selection = make_selection();
+			state.ResumeTiming();
+		}
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
+
+BENCHMARK_CASE(MTreeSelection_Write){
+	std::unique_ptr<MTreeReader> reader = OpenReader(state);
+	if(!reader) return;
+	const long nentries = reader->GetEntries();
+	const std::string cut_file = BenchmarkTempPath("write.root");
+	while(state.KeepRunning()){
+		state.PauseTiming();
+		MTreeSelection selection(reader.get(), cut_file);
+		selection.AddCut("all", "every entry", false);
+		for(long entry_i=0; entry_i<nentries; ++entry_i){
+			reader->GetEntry(entry_i, true);
+			selection.AddPassingEvent("all");
+		}
+		state.ResumeTiming();
+		selection.Write();
+	}
+	state.SetItemsProcessed(state.Iterations()*nentries);
+	state.SetLabel(std::to_string(nentries)+" entries");
+}
+
+// iterating over the entries passing a cut, as TreeReader does with a selectionsFile
+BENCHMARK_CASE(MTreeSelection_GetNextEntry){
+	if(CutFile().empty()){
+		state.SkipWithError("could not write synthetic cut file");
+		return;
+	}
+	std::unique_ptr<MTreeSelection> selection(new MTreeSelection(CutFile()));
+	while(state.KeepRunning()){
+		Long64_t entry = selection->GetNextEntry("energy");
+		if(entry<0){
+			state.PauseTiming();
+			selection.reset(new MTreeSelection(CutFile()));
+			state.ResumeTiming();
+			entry = selection->GetNextEntry("energy");
+		}
+		DoNotOptimize(entry);
+	}
+	state.SetItemsProcessed(state.Iterations());
+}
@@ -0,0 +1,34 @@
+/* vim:set noexpandtab tabstop=4 wrap filetype=cpp */
+// Runs the DataModel micro-benchmarks. See benchmarks/README.md.
+//   ./run_benchmarks [--filter name_part] [--json results.json] [--minTime secs] [--repetitions N] [--list]
+
+#include <iostream>
+#include <string>
+
+#include "ArgParser.h"
+
+#include "BenchmarkHarness.h"
+
+int main(int argc, char* argv[]){
+	ArgParser args(argc, argv);
+	BenchmarkRunner runner;
+	if(args.OptionExists("--filter")) runner.SetFilter(args.GetOption("--filter"));
+	if(args.OptionExists("--minTime")) runner.SetMinTime(std::stod(args.GetOption("--minTime")));
+	if(args.OptionExists("--repetitions")) runner.SetRepetitions(std::stoi(args.GetOption("--repetitions")));
+	if(args.OptionExists("--list")){
+		runner.List();
+		return 0;
+	}
+
+#ifdef __OPTIMIZE__
+	runner.SetContext("build", "optimised");
+#else
+	runner.SetContext("build", "debug");
+	std::cerr<<"Warning: benchmarks were built without optimisation"<<std::endl;
+#endif
+	int nfailed = runner.Run();
+	runner.PrintResults();
+	if(args.OptionExists("--json") && !runner.WriteJSON(args.GetOption("--json"))) ++nfailed;
+
+	return (nfailed==0) ? 0 : 1;
+}
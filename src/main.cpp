@@ -1,5 +1,10 @@
 #include <string>
+#include <sstream>
+#include <vector>
 #include "ToolChain.h"
+#include "ArgParser.h"
+#include "ShardDriver.h"
+#include "ToolProfiler.h"
 //#include "DummyTool.h"
 
 int main(int argc, char* argv[]){
@@ -12,6 +17,29 @@ int main(int argc, char* argv[]){
   if (argc==1)config_file="configfiles/Dummy/ToolChainConfig";
   else config_file=argv[1];
 
+  // run as N ToolChain processes over subsets of the input files, then merge the outputs
+  ArgParser args(argc, argv);
+  if(args.OptionExists("--shards")){
+    std::string shard_dir = args.OptionExists("--shardDir") ? args.GetOption("--shardDir") : "shards";
+    ShardDriver driver(config_file, std::stoi(args.GetOption("--shards")), shard_dir);
+    if(args.OptionExists("--outputKeys")){
+      std::vector<std::string> output_keys;
+      std::stringstream keys(args.GetOption("--outputKeys"));
+      for(std::string key; std::getline(keys, key, ',');) output_keys.push_back(key);
+      driver.SetOutputKeys(output_keys);
+    }
+    // seconds of events before each shard to also read, for Tools matching events across shard boundaries
+    if(args.OptionExists("--shardOverlap")) driver.SetOverlap(std::stod(args.GetOption("--shardOverlap")));
+    return driver.Run("/proc/self/exe");
+  }
+
+  // time each Tool, printing a summary once the ToolChain is finalised. Optionally write every call to a csv file.
+  if(args.OptionExists("--profile")){
+    std::string timeline_file = args.GetOption("--profile");
+    if(timeline_file.substr(0,2)=="--") timeline_file="";
+    ToolProfiler::Enable(timeline_file);
+  }
+
   ToolChain tools(config_file, argc, argv);
 
 